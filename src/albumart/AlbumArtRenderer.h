@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
 #include "base/Config.h"
 
 namespace albumart {
@@ -24,5 +25,31 @@ inline void centerCropPadTo480(const uint16_t* src, int sw, int sh, uint16_t* ds
   }
 }
 
+// Applies an EXIF orientation (1..8) in place to a square n x n RGB565 buffer. The
+// decoded image is centered, so rotating the whole buffer keeps it centered.
+inline void applyExifOrientation(uint16_t* buf, int n, int orientation) {
+  if (!buf || n <= 0 || orientation <= 1 || orientation > 8) return;
+  auto flipH = [&]() {
+    for (int y = 0; y < n; ++y) { uint16_t* r = &buf[(size_t)y * n]; for (int a = 0, b = n - 1; a < b; ++a, --b) { uint16_t t = r[a]; r[a] = r[b]; r[b] = t; } }
+  };
+  auto flipV = [&]() {
+    for (int a = 0, b = n - 1; a < b; ++a, --b)
+      for (int x = 0; x < n; ++x) { uint16_t t = buf[(size_t)a * n + x]; buf[(size_t)a * n + x] = buf[(size_t)b * n + x]; buf[(size_t)b * n + x] = t; }
+  };
+  auto transpose = [&]() {
+    for (int y = 0; y < n; ++y)
+      for (int x = y + 1; x < n; ++x) { uint16_t t = buf[(size_t)y * n + x]; buf[(size_t)y * n + x] = buf[(size_t)x * n + y]; buf[(size_t)x * n + y] = t; }
+  };
+  switch (orientation) {
+    case 2: flipH(); break;                          // mirror horizontal
+    case 3: flipH(); flipV(); break;                 // rotate 180
+    case 4: flipV(); break;                          // mirror vertical
+    case 5: transpose(); break;                      // mirror + rotate 270 CW
+    case 6: transpose(); flipH(); break;             // rotate 90 CW
+    case 7: transpose(); flipH(); flipV(); break;    // mirror + rotate 90 CW
+    case 8: transpose(); flipV(); break;             // rotate 270 CW
+  }
+}
+
 } // namespace albumart
 
@@ -1,81 +1,83 @@
 #pragma once
 #include <Arduino.h>
-#include <vector>
+#include <memory>
 #include "base/Config.h"
 #include "gfx/Display.h"
+#include "gfx/FramebufferPool.h"
 #include "albumart/AlbumArtRenderer.h"
+#include "albumart/JpegProbe.h"
 #include "albumart/decoders/IImageDecoder.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/semphr.h"
 
 // Factories implemented by backends
 extern "C" IImageDecoder* createJpegdecDecoder();
 extern "C" IImageDecoder* createTjpgDecoder();
+extern "C" IImageDecoder* createPngDecoder();
+extern "C" IImageDecoder* createProgJpegDecoder();
 
 namespace albumart {
 
 class AlbumArtService {
 public:
-  // Global decoder mutex to serialize non-reentrant backends
-  static SemaphoreHandle_t decoderMutex() {
-    static SemaphoreHandle_t mtx = [](){ return xSemaphoreCreateMutex(); }();
-    return mtx;
-  }
-
-  // RAII guard
-  struct Lock {
-    SemaphoreHandle_t m;
-    explicit Lock(SemaphoreHandle_t mtx): m(mtx) { if (m) xSemaphoreTake(m, portMAX_DELAY); }
-    ~Lock(){ if (m) xSemaphoreGive(m); }
-  };
-
-  // Decode bytes in RAM, center-crop/pad to 480x480, return in dst480 (no drawing)
-  static bool decodeToCropped480(const uint8_t* data, size_t n, uint16_t* dst480) {
+  // Decode bytes in RAM, center-crop/pad to 480x480, return in dst480 (no drawing).
+  // Backends keep their state per call, so this is safe to run on both cores at once.
+  // A cancelled token aborts the running backend and skips the fallback.
+  static bool decodeToCropped480(const uint8_t* data, size_t n, uint16_t* dst480, const CancelToken* cancel = nullptr) {
     if (!data || n == 0 || !dst480) { Serial.println("AlbumArt: decodeToCropped480 invalid args"); return false; }
-    Lock guard(decoderMutex()); // serialize all decode operations
 
     unsigned long t0 = millis();
-    std::unique_ptr<IImageDecoder> tjpg(createTjpgDecoder());
-    std::unique_ptr<IImageDecoder> jp(createJpegdecDecoder());
-
-    // Determine source size (prefer TJPG, fallback to JPEGDEC)
-    Serial.printf("AlbumArt: sizeOf on %u bytes...\n", (unsigned)n);
-    DecodeResult sz = tjpg->sizeOf(data, n);
-    if (!sz.ok) {
-      sz = jp->sizeOf(data, n);
-      if (!sz.ok) { Serial.println("AlbumArt: sizeOf failed (both backends)"); return false; }
+    if (isPng(data, n)) {
+      std::unique_ptr<IImageDecoder> png(createPngDecoder());
+      png->setCancel(cancel);
+      bool ok = png->decodeToRGB565(data, n, dst480, sys::kScreenW, sys::kScreenH);
+      Serial.printf("AlbumArt: PNG decode %s in %lu ms\n", ok ? "ok" : "failed", millis() - t0);
+      return ok;
     }
-    Serial.printf("AlbumArt: source dims %dx%d\n", sz.w, sz.h);
 
-    // Try TJPG first (fast, low RAM), then JPEGDEC as fallback for progressive JPEGS
-    unsigned long t1 = millis();
-    bool ok = tjpg->decodeToRGB565(data, n, dst480, sys::kScreenW, sys::kScreenH);
-    unsigned long t2 = millis();
-    if (ok) {
-      Serial.printf("AlbumArt: decode ok (TJPG, centered no-scale) in %lu ms (total %lu ms)\n", (t2 - t1), (t2 - t0));
-      return true;
-    }
-    Serial.println("AlbumArt: TJPG failed, trying JPEGDEC fallback...");
+    // One marker pass picks the backend; no trial decodes
+    JpegInfo info = probeJpeg(data, n);
+    if (!info.ok) { Serial.printf("AlbumArt: no JPEG frame header in %u bytes\n", (unsigned)n); return false; }
+    Serial.printf("AlbumArt: JPEG SOF%d %dx%d comps=%d dri=%d orient=%d\n",
+                  info.sof - 0xC0, info.w, info.h, info.components, info.restartInterval, info.orientation);
 
-    unsigned long t3 = millis();
-    bool ok2 = jp->decodeToRGB565(data, n, dst480, sys::kScreenW, sys::kScreenH);
-    unsigned long t4 = millis();
-    if (ok2) {
-      Serial.printf("AlbumArt: decode ok (JPEGDEC fallback, centered no-scale) in %lu ms (total %lu ms)\n", (t4 - t3), (t4 - t0));
-      return true;
+    bool ok = false;
+    const char* backend = "TJPG";
+    if (info.progressive) {
+      // TJPG cannot decode SOF2 and JPEGDEC only renders its DC scan
+      backend = "progressive";
+      std::unique_ptr<IImageDecoder> pj(createProgJpegDecoder());
+      pj->setCancel(cancel);
+      ok = pj->decodeToRGB565(data, n, dst480, sys::kScreenW, sys::kScreenH);
+    } else {
+      std::unique_ptr<IImageDecoder> tjpg(createTjpgDecoder());
+      tjpg->setCancel(cancel);
+      ok = tjpg->decodeToRGB565(data, n, dst480, sys::kScreenW, sys::kScreenH);
+      if (!ok && !CancelToken::isCancelled(cancel)) {
+        Serial.println("AlbumArt: TJPG failed, trying JPEGDEC fallback...");
+        backend = "JPEGDEC";
+        std::unique_ptr<IImageDecoder> jp(createJpegdecDecoder());
+        jp->setCancel(cancel);
+        ok = jp->decodeToRGB565(data, n, dst480, sys::kScreenW, sys::kScreenH);
+      }
     }
+    if (CancelToken::isCancelled(cancel)) { Serial.printf("AlbumArt: decode cancelled (%s) after %lu ms\n", backend, millis() - t0); return false; }
+    if (ok) applyExifOrientation(dst480, sys::kScreenW, info.orientation);
+    Serial.printf("AlbumArt: decode %s (%s) in %lu ms\n", ok ? "ok" : "failed", backend, millis() - t0);
+    return ok;
+  }
 
-    Serial.println("AlbumArt: decode failed on both backends");
-    return false;
+  static bool isPng(const uint8_t* d, size_t n) {
+    return n >= 8 && d[0]==0x89 && d[1]==0x50 && d[2]==0x4E && d[3]==0x47 && d[4]==0x0D && d[5]==0x0A && d[6]==0x1A && d[7]==0x0A;
   }
 
   // Legacy convenience: decode and draw via display
   static bool drawForegroundFromBytes(ui_gfx::Display& disp, const uint8_t* data, size_t n) {
     if (!data || n == 0) return false;
-    std::vector<uint16_t> dst((size_t)sys::kScreenW * (size_t)sys::kScreenH);
+    ui_gfx::FbLease dst = ui_gfx::FramebufferPool::instance().acquire();
+    if (!dst) return false;
+    memset(dst.data(), 0, ui_gfx::FramebufferPool::kSlabBytes);
     if (!decodeToCropped480(data, n, dst.data())) return false;
     for (int y = 0; y < sys::kScreenH; ++y) {
-      disp.drawRow(0, y, &dst[(size_t)y * sys::kScreenW], sys::kScreenW);
+      disp.drawRow(0, y, &dst.data()[(size_t)y * sys::kScreenW], sys::kScreenW);
     }
     return true;
   }
@@ -0,0 +1,202 @@
+#include "albumart/ArtBench.h"
+
+#ifdef ALBUMART_BENCH
+#include <Arduino.h>
+#include <FS.h>
+#include <SPIFFS.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "esp_heap_caps.h"
+#include "base/Config.h"
+#include "gfx/FramebufferPool.h"
+#include "albumart/AlbumArtService.h"
+#include "albumart/CoverScaler.h"
+#include "albumart/JpegProbe.h"
+
+#ifndef BENCH_GIT_REV
+#define BENCH_GIT_REV "unknown"
+#endif
+
+namespace albumart {
+
+namespace {
+
+static constexpr int kRuns = 5;        // timed runs per case, after one warm-up
+static const char* kDir = "/bench";
+
+// Lowest free heap seen while a case runs; sampled every tick from core 0
+struct HeapWatch {
+  volatile size_t minInternal = 0, minPsram = 0;
+  volatile bool active = false;
+  TaskHandle_t task = nullptr;
+
+  void reset() {
+    minInternal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    minPsram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  }
+  void sample() {
+    size_t i = heap_caps_get_free_size(MALLOC_CAP_INTERNAL), p = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    if (i < minInternal) minInternal = i;
+    if (p < minPsram) minPsram = p;
+  }
+  static void loop(void* arg) {
+    HeapWatch* w = (HeapWatch*)arg;
+    for (;;) { if (w->active) w->sample(); vTaskDelay(1); }
+  }
+};
+
+static HeapWatch s_watch;
+
+struct CaseResult {
+  bool ok = false;
+  unsigned long usMin = 0, usMed = 0;
+  size_t peakInternal = 0, peakPsram = 0;
+  uint32_t crc = 0;
+};
+
+static uint32_t fnv1a(const uint16_t* px, size_t n) {
+  uint32_t h = 2166136261u;
+  const uint8_t* b = (const uint8_t*)px;
+  for (size_t i = 0; i < n * 2; ++i) { h ^= b[i]; h *= 16777619u; }
+  return h;
+}
+
+// Runs fn once to warm up and kRuns times timed; fb is cleared before every run
+template <class Fn>
+static CaseResult measure(uint16_t* fb, Fn fn) {
+  CaseResult r;
+  const size_t px = (size_t)sys::kScreenW * sys::kScreenH;
+  unsigned long us[kRuns];
+  memset(fb, 0, px * sizeof(uint16_t));
+  fn();
+  size_t baseI = heap_caps_get_free_size(MALLOC_CAP_INTERNAL), baseP = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  s_watch.reset(); s_watch.active = true;
+  for (int i = 0; i < kRuns; ++i) {
+    memset(fb, 0, px * sizeof(uint16_t));
+    unsigned long t0 = micros();
+    r.ok = fn();
+    us[i] = micros() - t0;
+    s_watch.sample();
+  }
+  s_watch.active = false;
+  std::sort(us, us + kRuns);
+  r.usMin = us[0]; r.usMed = us[kRuns / 2];
+  r.peakInternal = baseI > s_watch.minInternal ? baseI - s_watch.minInternal : 0;
+  r.peakPsram = baseP > s_watch.minPsram ? baseP - s_watch.minPsram : 0;
+  r.crc = r.ok ? fnv1a(fb, px) : 0;
+  return r;
+}
+
+static void emit(const char* file, const char* stage, const char* expect, const JpegInfo* info, const CaseResult& r) {
+  Serial.printf("{\"bench\":\"albumart\",\"rev\":\"%s\",\"file\":\"%s\",\"stage\":\"%s\",\"ok\":%s",
+                BENCH_GIT_REV, file, stage, r.ok ? "true" : "false");
+  if (expect) Serial.printf(",\"expect\":\"%s\"", expect);
+  if (info && info->ok) {
+    long mcus = (long)((info->w + info->mcuW - 1) / info->mcuW) * ((info->h + info->mcuH - 1) / info->mcuH);
+    Serial.printf(",\"w\":%d,\"h\":%d,\"sof\":%d,\"dri\":%d,\"mcus\":%ld,\"mcu_per_s\":%.0f",
+                  info->w, info->h, info->sof - 0xC0, info->restartInterval, mcus, r.usMed ? mcus * 1e6 / r.usMed : 0.0);
+  }
+  Serial.printf(",\"ms\":%.2f,\"ms_min\":%.2f,\"peak_internal\":%u,\"peak_psram\":%u,\"crc\":\"%08x\"}\n",
+                r.usMed / 1000.0, r.usMin / 1000.0, (unsigned)r.peakInternal, (unsigned)r.peakPsram, (unsigned)r.crc);
+}
+
+static bool loadFile(const String& path, std::vector<uint8_t>& out) {
+  File f = SPIFFS.open(path, FILE_READ);
+  if (!f) return false;
+  out.resize(f.size());
+  bool ok = !out.empty() && f.read(out.data(), out.size()) == out.size();
+  f.close();
+  return ok;
+}
+
+static bool expectMet(const char* expect, bool ok) {
+  if (!strcmp(expect, "ok")) return ok;
+  if (!strcmp(expect, "fail")) return !ok;
+  return true;
+}
+
+// Stages independent of any file: box-filter scaling and EXIF rotation
+static void benchStages(uint16_t* fb) {
+  const int sw = 1000, sh = 1000;
+  std::unique_ptr<uint16_t[]> row(new (std::nothrow) uint16_t[sw]);
+  if (!row) return;
+  for (int x = 0; x < sw; ++x) row[x] = (uint16_t)(x * 65);
+  CaseResult r = measure(fb, [&]() {
+    CoverScaler sc;
+    if (!sc.begin(fb, sys::kScreenW, sys::kScreenH, sw, sh)) return false;
+    for (int y = 0; y < sh; ++y) if (sc.wantsRow(y)) sc.pushRow(y, row.get(), sw);
+    sc.finish();
+    return true;
+  });
+  emit("synthetic_1000", "scale", nullptr, nullptr, r);
+  r = measure(fb, [&]() { applyExifOrientation(fb, sys::kScreenW, 6); return true; });
+  emit("synthetic_480", "orient6", nullptr, nullptr, r);
+}
+}
+
+void runArtBench() {
+  Serial.printf("{\"bench\":\"start\",\"rev\":\"%s\",\"runs\":%d,\"cpu_mhz\":%u,\"psram\":%u}\n",
+                BENCH_GIT_REV, kRuns, (unsigned)getCpuFrequencyMhz(), (unsigned)ESP.getPsramSize());
+  ui_gfx::FbLease fb = ui_gfx::FramebufferPool::instance().acquire();
+  if (!fb) { Serial.println("{\"bench\":\"error\",\"reason\":\"no framebuffer\"}"); return; }
+  if (!s_watch.task) xTaskCreatePinnedToCore(HeapWatch::loop, "bench_heap", 2048, &s_watch, tskIDLE_PRIORITY + 3, &s_watch.task, 0);
+
+  File manifest = SPIFFS.open(String(kDir) + "/corpus.txt", FILE_READ);
+  if (!manifest) { Serial.println("{\"bench\":\"error\",\"reason\":\"no /bench/corpus.txt (run tools/make_bench_corpus.py + uploadfs)\"}"); return; }
+  String version = manifest.readStringUntil('\n');
+  version.trim();
+  Serial.printf("{\"bench\":\"corpus\",\"header\":\"%s\"}\n", version.c_str());
+
+  int files = 0, mismatches = 0;
+  unsigned long t0 = millis();
+  std::vector<uint8_t> data;
+  while (manifest.available()) {
+    String line = manifest.readStringUntil('\n');
+    line.trim();
+    int sp = line.indexOf(' ');
+    if (!line.length() || line[0] == '#' || sp <= 0) continue;
+    String name = line.substring(0, sp);
+    String expect = line.substring(sp + 1);
+    if (!loadFile(String(kDir) + "/" + name, data)) { Serial.printf("{\"bench\":\"error\",\"file\":\"%s\",\"reason\":\"read failed\"}\n", name.c_str()); continue; }
+    ++files;
+    const uint8_t* d = data.data(); size_t n = data.size();
+    uint16_t* out = fb.data();
+    const int W = sys::kScreenW, H = sys::kScreenH;
+
+    // Full pipeline: probe, backend choice, fallback, orientation
+    CaseResult svc = measure(out, [&]() { return AlbumArtService::decodeToCropped480(d, n, out); });
+    bool met = expectMet(expect.c_str(), svc.ok);
+    if (!met) ++mismatches;
+    JpegInfo info = probeJpeg(d, n);
+    emit(name.c_str(), "service", expect.c_str(), &info, svc);
+
+    // Individual backends
+    auto backend = [&](const char* stage, IImageDecoder* (*factory)()) {
+      std::unique_ptr<IImageDecoder> dec(factory());
+      CaseResult r = measure(out, [&]() { return dec->decodeToRGB565(d, n, out, W, H); });
+      emit(name.c_str(), stage, nullptr, &info, r);
+    };
+    if (AlbumArtService::isPng(d, n)) {
+      backend("png", createPngDecoder);
+    } else if (info.ok) {
+      backend("tjpg", createTjpgDecoder);
+      backend("jpegdec", createJpegdecDecoder);
+      if (info.progressive) backend("progjpeg", createProgJpegDecoder);
+    }
+  }
+  manifest.close();
+  benchStages(fb.data());
+  Serial.printf("{\"bench\":\"done\",\"rev\":\"%s\",\"files\":%d,\"expect_mismatch\":%d,\"total_ms\":%lu}\n",
+                BENCH_GIT_REV, files, mismatches, millis() - t0);
+}
+
+} // namespace albumart
+
+#else
+
+namespace albumart {
+void runArtBench() {}
+}
+
+#endif
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace albumart {
+
+// Album-art decode benchmark (build env `bench`, -DALBUMART_BENCH). Runs every backend,
+// the full decodeToCropped480 pipeline and the scale/orientation stages over the corpus
+// in SPIFFS /bench (generated by tools/make_bench_corpus.py) and prints one JSON object
+// per line on Serial. Without ALBUMART_BENCH this is a no-op.
+void runArtBench();
+
+} // namespace albumart
@@ -0,0 +1,205 @@
+#include "albumart/ArtScheduler.h"
+#include "albumart/Downloader.h"
+#include "albumart/AlbumArtService.h"
+#include "albumart/CoverCache.h"
+#include "base/Log.h"
+#include <FS.h>
+#include <SPIFFS.h>
+
+namespace albumart {
+
+namespace {
+struct MutexLock {
+  SemaphoreHandle_t m;
+  explicit MutexLock(SemaphoreHandle_t mtx): m(mtx) { xSemaphoreTake(m, portMAX_DELAY); }
+  ~MutexLock() { xSemaphoreGive(m); }
+};
+}
+
+bool ArtScheduler::ensureStarted() {
+  if (mtx_) return true;
+  mtx_ = xSemaphoreCreateMutex();
+  wake_ = xSemaphoreCreateCounting(64, 0);
+  decodeQ_ = xQueueCreate(1, sizeof(Job*));
+  if (!mtx_ || !wake_ || !decodeQ_) { LOGE("ART", "scheduler init failed"); return false; }
+  // Stack sizes in bytes (ESP-IDF): TLS handshake + file IO, decoder state lives on the heap.
+  // One decode at a time: the slab budget holds a single cover in decode, and the only
+  // client is the background cover. Core 0 joins in through TjpgBackend's band split.
+  xTaskCreatePinnedToCore(downloadTask, "aa_dl", 16384, this, tskIDLE_PRIORITY + 2, nullptr, 1);
+  xTaskCreatePinnedToCore(decodeTask, "aa_decode", 24576, this, tskIDLE_PRIORITY + 1, nullptr, 1);
+  return true;
+}
+
+ArtJobId ArtScheduler::submit(const String& url, ArtPriority prio, ArtSink sink, void* user) {
+  if (!url.length() || !sink || !ensureStarted()) return 0;
+  MutexLock lock(mtx_);
+  for (Job* j : inflight_) {
+    if (!j->cancel.cancelled() && j->user == user && j->url == url) { LOGI("ART", "job #%u already running for %s", (unsigned)j->id, url.c_str()); return j->id; }
+  }
+  for (Job* j : pending_) {
+    if (j->user == user && j->url == url) {
+      if (prio < j->prio) j->prio = prio;
+      LOGI("ART", "job #%u already queued, prio=%d", (unsigned)j->id, (int)j->prio);
+      return j->id;
+    }
+  }
+  if (prio != ArtPriority::Prefetch) supersedeLocked(user, prio);
+  Job* j = new Job();
+  j->id = nextId_++; j->url = url; j->prio = prio; j->sink = sink; j->user = user;
+  pending_.push_back(j);
+  LOGI("ART", "queued #%u prio=%d (%u pending) %s", (unsigned)j->id, (int)prio, (unsigned)pending_.size(), url.c_str());
+  xSemaphoreGive(wake_);
+  return j->id;
+}
+
+void ArtScheduler::cancel(ArtJobId id) {
+  if (!mtx_ || !id) return;
+  MutexLock lock(mtx_);
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    if (pending_[i]->id == id) { delete pending_[i]; pending_.erase(pending_.begin() + i); LOGI("ART", "cancelled queued #%u", (unsigned)id); return; }
+  }
+  for (Job* j : inflight_) if (j->id == id) { j->cancel.cancel(); LOGI("ART", "cancelled running #%u", (unsigned)id); }
+}
+
+// A newer URL makes the owner's older jobs of the same kind worthless; prefetches are
+// speculative and never replace each other. Caller holds mtx_.
+void ArtScheduler::supersedeLocked(void* user, ArtPriority prio) {
+  for (size_t i = 0; i < pending_.size();) {
+    Job* j = pending_[i];
+    if (j->user == user && j->prio == prio) {
+      LOGI("ART", "superseded queued #%u %s", (unsigned)j->id, j->url.c_str());
+      delete j; pending_.erase(pending_.begin() + i);
+      // its wake_ count stays; the download worker skips the empty take
+    } else {
+      ++i;
+    }
+  }
+  for (Job* j : inflight_) {
+    if (j->user == user && j->prio == prio && !j->cancel.cancelled()) {
+      j->cancel.cancel();
+      LOGI("ART", "superseded running #%u %s", (unsigned)j->id, j->url.c_str());
+    }
+  }
+}
+
+bool ArtScheduler::busy(void* user) const {
+  if (!mtx_) return false;
+  MutexLock lock(mtx_);
+  for (Job* j : pending_) if (j->user == user) return true;
+  for (Job* j : inflight_) if (j->user == user && !j->cancel.cancelled()) return true;
+  return false;
+}
+
+// Highest priority first, oldest first within a priority
+ArtScheduler::Job* ArtScheduler::takeNext() {
+  MutexLock lock(mtx_);
+  if (pending_.empty()) return nullptr;
+  size_t best = 0;
+  for (size_t i = 1; i < pending_.size(); ++i) if (pending_[i]->prio < pending_[best]->prio) best = i;
+  Job* j = pending_[best];
+  pending_.erase(pending_.begin() + best);
+  inflight_.push_back(j);
+  return j;
+}
+
+void ArtScheduler::finish(Job* j, ArtResult& r) {
+  if (!j->cancel.cancelled() && j->sink) j->sink(j->user, r);
+  r.fb.reset(); // cancelled, or the sink did not take it
+  MutexLock lock(mtx_);
+  for (size_t i = 0; i < inflight_.size(); ++i) if (inflight_[i] == j) { inflight_.erase(inflight_.begin() + i); break; }
+  delete j;
+}
+
+// The cover was evicted (or dropped as corrupt) between lookup and expansion: fetch it
+// again ahead of its priority peers instead of failing the job
+void ArtScheduler::requeueDownload(Job* j) {
+  MutexLock lock(mtx_);
+  for (size_t i = 0; i < inflight_.size(); ++i) if (inflight_[i] == j) { inflight_.erase(inflight_.begin() + i); break; }
+  j->cached = false;
+  j->refetch = true;
+  pending_.insert(pending_.begin(), j);
+  xSemaphoreGive(wake_);
+}
+
+void ArtScheduler::downloadTask(void* arg) {
+  ArtScheduler* self = (ArtScheduler*)arg;
+  for (;;) {
+    xSemaphoreTake(self->wake_, portMAX_DELAY);
+    Job* j = self->takeNext();
+    if (!j) continue; // cancelled while queued
+
+    ArtFetch fetch;
+    fetch.cancel = &j->cancel;
+    bool fresh = false;
+    if (!j->refetch && CoverCache::instance().lookup(j->url, fetch.ifCached, fresh) && fresh) {
+      j->cached = true;
+      xQueueSend(self->decodeQ_, &j, portMAX_DELAY);
+      continue;
+    }
+    LOGI("ART", "%s #%u %s", fetch.ifCached.hasValidator() ? "revalidate" : "download", (unsigned)j->id, j->url.c_str());
+    if (SPIFFS.exists(self->spool_)) SPIFFS.remove(self->spool_);
+    bool ok = !j->cancel.cancelled() && Downloader::downloadArtToFile(j->url, self->spool_, fetch);
+    if (ok && fetch.notModified && !j->cancel.cancelled()) {
+      // 304: headers only, the cached cover is still current
+      CoverCache::instance().revalidated(j->url, fetch.meta);
+      j->cached = true;
+      xQueueSend(self->decodeQ_, &j, portMAX_DELAY);
+      continue;
+    }
+    j->meta = fetch.meta;
+    if (ok && !j->cancel.cancelled()) {
+      File f = SPIFFS.open(self->spool_, FILE_READ);
+      if (f) {
+        j->bytes.resize(f.size());
+        if (!j->bytes.empty()) ok = f.read(j->bytes.data(), j->bytes.size()) == j->bytes.size();
+        f.close();
+      }
+      ok = ok && !j->bytes.empty();
+    }
+    if (!ok || j->cancel.cancelled()) {
+      ArtResult r; r.id = j->id; r.url = j->url; r.reason = j->cancel.cancelled() ? "cancelled" : "download failed";
+      self->finish(j, r);
+      continue;
+    }
+    xQueueSend(self->decodeQ_, &j, portMAX_DELAY); // back-pressure: one image waits for decode
+  }
+}
+
+void ArtScheduler::decodeTask(void* arg) {
+  ArtScheduler* self = (ArtScheduler*)arg;
+  for (;;) {
+    Job* j = nullptr;
+    if (xQueueReceive(self->decodeQ_, &j, portMAX_DELAY) != pdTRUE || !j) continue;
+    ArtResult r; r.id = j->id; r.url = j->url;
+    if (j->cancel.cancelled()) { r.reason = "cancelled"; self->finish(j, r); continue; }
+
+    r.fb = ui_gfx::FramebufferPool::instance().acquire();
+    if (!r.fb) {
+      r.reason = "no free framebuffer";
+    } else {
+      unsigned long t0 = millis();
+      if (j->cached && CoverCache::instance().get(j->url, r.fb.data())) {
+        r.ok = true;
+      } else if (!j->cached) {
+        memset(r.fb.data(), 0, ui_gfx::FramebufferPool::kSlabBytes);
+        r.ok = AlbumArtService::decodeToCropped480(j->bytes.data(), j->bytes.size(), r.fb.data(), &j->cancel);
+        if (r.ok && !j->cancel.cancelled()) CoverCache::instance().put(j->url, r.fb.data(), j->meta);
+      }
+      bool cancelled = j->cancel.cancelled();
+      if (j->cached && !r.ok && !cancelled) {
+        LOGW("ART", "cache entry for #%u lost, downloading %s", (unsigned)j->id, j->url.c_str());
+        r.fb.reset();
+        self->requeueDownload(j);
+        continue;
+      }
+      if (r.ok && !cancelled) r.tone = analyzeCover(r.fb.data());
+      LOGI("ART", "%s #%u %s in %lu ms", j->cached ? "cache" : "decode", (unsigned)j->id,
+           cancelled ? "cancelled" : (r.ok ? "ok" : "failed"), millis() - t0);
+      if (!r.ok) r.reason = cancelled ? "cancelled" : "decode failed";
+    }
+    std::vector<uint8_t>().swap(j->bytes);
+    self->finish(j, r);
+  }
+}
+
+} // namespace albumart
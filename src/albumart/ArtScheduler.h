@@ -0,0 +1,84 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "albumart/CancelToken.h"
+#include "gfx/FramebufferPool.h"
+#include "albumart/Downloader.h"
+#include "albumart/CoverTone.h"
+
+namespace albumart {
+
+enum class ArtPriority : uint8_t { Foreground = 0, Background = 1, Prefetch = 2 };
+
+using ArtJobId = uint32_t;
+
+struct ArtResult {
+  ArtJobId id = 0;
+  String url;
+  bool ok = false;
+  ui_gfx::FbLease fb;            // 480x480 RGB565 pool slab; a sink keeps it by moving it out
+  CoverTone tone;                // brightness/palette of fb, valid when ok
+  const char* reason = "";       // short failure reason when !ok
+};
+
+// Called on a worker task; must not draw. A slab left in r.fb returns to the pool afterwards.
+using ArtSink = void (*)(void* user, ArtResult& r);
+
+// Single album-art pipeline: one long-lived download worker and one decode worker
+// fed from a priority queue (foreground before background before prefetch, FIFO
+// within a priority). Submitting a URL that the same owner already has queued or
+// running returns the existing job, upgrading its priority. A different URL supersedes
+// the owner's older foreground/background jobs: queued ones are dropped, running ones
+// are cancelled mid-transfer or mid-decode. The download worker is the only writer of
+// the spool file and hands the bytes to the decoder in RAM; covers already in the
+// CoverCache skip the download (or only revalidate it with a conditional GET) and are
+// expanded by the decode worker; one evicted in between goes back to the download worker.
+class ArtScheduler {
+public:
+  static ArtScheduler& instance() { static ArtScheduler s; return s; }
+
+  // Creates the worker tasks on first use
+  ArtJobId submit(const String& url, ArtPriority prio, ArtSink sink, void* user);
+
+  // Drops a queued job; a running job stops at its next cancellation check and is discarded
+  void cancel(ArtJobId id);
+
+  // Any job of `user` queued or in flight
+  bool busy(void* user) const;
+
+private:
+  struct Job {
+    ArtJobId id = 0;
+    String url;
+    ArtPriority prio = ArtPriority::Background;
+    ArtSink sink = nullptr;
+    void* user = nullptr;
+    CancelToken cancel;
+    bool cached = false;       // expand from CoverCache instead of decoding bytes
+    bool refetch = false;      // cache entry vanished before expansion: download, skip the cache
+    HttpCacheMeta meta;        // caching headers of the download, stored with the cover
+    std::vector<uint8_t> bytes;
+  };
+
+  ArtScheduler() = default;
+  bool ensureStarted();
+  Job* takeNext();
+  void supersedeLocked(void* user, ArtPriority prio);
+  void finish(Job* j, ArtResult& r);
+  void requeueDownload(Job* j);
+  static void downloadTask(void* arg);
+  static void decodeTask(void* arg);
+
+  SemaphoreHandle_t mtx_ = nullptr;
+  SemaphoreHandle_t wake_ = nullptr;   // counts queued jobs
+  QueueHandle_t decodeQ_ = nullptr;    // Job* from download to decode worker
+  std::vector<Job*> pending_;
+  std::vector<Job*> inflight_;
+  ArtJobId nextId_ = 1;
+  const char* spool_ = "/album.bin";
+};
+
+} // namespace albumart
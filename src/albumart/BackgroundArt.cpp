@@ -1,156 +1,114 @@
 #include "albumart/BackgroundArt.h"
-#include "albumart/Downloader.h"
-#include "albumart/AlbumArtService.h"
-#include <FS.h>
-#include <SPIFFS.h>
-#include <PNGdec.h>
-#include <TJpg_Decoder.h>
-#include <JPEGDEC.h>
-#include <vector>
-#include "esp_heap_caps.h"
+#include "gfx/RoundMask.h"
+#include "gfx/Rgb565.h"
 
 namespace albumart {
 
-// Static decode context for TJpg callback
-namespace {
-  static BackgroundArt* s_curr = nullptr;
-  static int s_src_w=0, s_src_h=0;
-  static int s_src_x0=0, s_src_y0=0;
-  static int s_dst_x0=0, s_dst_y0=0;
-  static int s_crop_w=0, s_crop_h=0;
-  static bool tjpg_out(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t* bmp) {
-    if (!s_curr) return true;
-    uint16_t* fb = s_curr->fbRaw();
-    if (!fb || w==0 || h==0) return true;
-    int bx0 = x, by0 = y, bx1 = x + (int)w, by1 = y + (int)h;
-    int ix0 = (bx0 < s_src_x0) ? s_src_x0 : bx0;
-    int iy0 = (by0 < s_src_y0) ? s_src_y0 : by0;
-    int ix1 = (bx1 > s_src_x0 + s_crop_w) ? (s_src_x0 + s_crop_w) : bx1;
-    int iy1 = (by1 > s_src_y0 + s_crop_h) ? (s_src_y0 + s_crop_h) : by1;
-    if (ix0 >= ix1 || iy0 >= iy1) return true;
-    int copy_w = ix1 - ix0;
-    for (int yy = iy0; yy < iy1; ++yy) {
-      int src_row_off = (yy - by0) * (int)w + (ix0 - bx0);
-      const uint16_t* src = bmp + src_row_off;
-      int dst_x = s_dst_x0 + (ix0 - s_src_x0);
-      int dst_y = s_dst_y0 + (yy - s_src_y0);
-      // Hard safety clamp to avoid any OOB writes
-      if (dst_y < 0 || dst_y >= 480) continue;
-      if (dst_x < 0) {
-        int delta = -dst_x; dst_x = 0; src += delta; copy_w -= delta;
-      }
-      if (dst_x + copy_w > 480) {
-        int keep = 480 - dst_x; if (keep <= 0) continue; copy_w = keep;
-      }
-      uint16_t* dst = &fb[dst_y * 480 + dst_x];
-      memcpy(dst, src, (size_t)copy_w * sizeof(uint16_t));
-    }
-    return true;
-  }
+void BackgroundArt::start() {
+  if (!url_.length()) { Serial.println("AlbumArt(bg): no URL provided, skipping download"); return; }
+  if (url_ == last_started_url_) { Serial.println("AlbumArt(bg): URL unchanged, skip start"); return; }
+  last_started_url_ = url_;
+  Serial.printf("AlbumArt(bg): requesting %s\n", url_.c_str());
+  // Der Scheduler bricht den noch laufenden Job für die alte URL ab
+  job_ = ArtScheduler::instance().submit(url_, ArtPriority::Background, &BackgroundArt::onResult, this);
 }
 
-void BackgroundArt::start() {
-  if (job_busy_) return;
-  if (url_.length() && url_ == last_started_url_) { Serial.println("AlbumArt(bg): URL unchanged, skip start"); return; }
-  job_busy_ = true;
-  file_ready_ = false;
-  ready_ = false;
-  blit_row_ = 0;
+bool BackgroundArt::busy() const {
+  return ArtScheduler::instance().busy(const_cast<BackgroundArt*>(this)) || pending_fb_.load() != 0;
+}
 
-  // Start downloader task (Core 0)
-  struct Ctx { BackgroundArt* self; } *ctx = new Ctx{this};
-  auto dlTask = [](void* arg){
-    std::unique_ptr<Ctx> holder((Ctx*)arg);
-    BackgroundArt* self = holder->self;
-    // Require a URL; do not fallback to any preset
-    if (!self->url_.length()) {
-      Serial.println("AlbumArt(bg): no URL provided, skipping download");
-      self->file_ready_ = false;
-      self->job_busy_ = false;
-      vTaskDelete(NULL);
-      return;
+// Decode worker context: only hand the slab over; tick() adopts it on the UI thread
+void BackgroundArt::onResult(void* user, ArtResult& r) {
+  BackgroundArt* self = (BackgroundArt*)user;
+  if (r.id < self->job_.load()) { Serial.printf("AlbumArt(bg): dropping stale job #%u\n", (unsigned)r.id); return; }
+  if (!r.ok) {
+    Serial.printf("AlbumArt(bg): job #%u failed (%s)\n", (unsigned)r.id, r.reason);
+    if (!r.fb) r.fb = ui_gfx::FramebufferPool::instance().acquire();
+    if (!r.fb) return; // Pool erschöpft: altes Bild bleibt stehen
+    // Visible neutral fallback
+    uint16_t* fb = r.fb.data();
+    for (int y = 0; y < 480; ++y) {
+      uint8_t v = (uint8_t)(32 + (y * 192 / 479));
+      uint16_t c = ((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3);
+      for (int x = 0; x < 480; ++x) fb[y*480 + x] = c;
     }
-    String eff = self->url_;
-    Serial.printf("AlbumArt(bg): downloading %s\n", eff.c_str());
-    self->last_started_url_ = eff;
-    if (SPIFFS.exists(self->path_)) SPIFFS.remove(self->path_);
-    bool ok = Downloader::downloadToFile(eff, self->path_);
-    if (ok) {
-      File f = SPIFFS.open(self->path_, FILE_READ);
-      int sz = f ? f.size() : -1; if (f) f.close();
-      Serial.printf("AlbumArt(bg): saved %d bytes to %s\n", sz, self->path_);
-    } else {
-      Serial.println("AlbumArt(bg): download failed");
-    }
-    self->file_ready_ = SPIFFS.exists(self->path_) && (SPIFFS.open(self->path_, FILE_READ).size() > 0);
-    self->job_busy_ = false;
-    vTaskDelete(NULL);
-  };
-  const uint32_t stack_words = 16384; // 64KB for HTTPS/TLS handshake + file IO
-  xTaskCreatePinnedToCore(dlTask, "aa_bg", stack_words, ctx, tskIDLE_PRIORITY+2, nullptr, 1);
+    r.tone = analyzeCover(fb);
+    Serial.printf("AlbumArt(bg): fallback gradient shown (reason: %s)\n", r.reason);
+  } else {
+    Serial.printf("AlbumArt(bg): background ready (job #%u)\n", (unsigned)r.id);
+  }
+  self->present(std::move(r.fb), r.tone);
 }
 
-void BackgroundArt::tick() {
-  if (file_ready_ && !decode_busy_) {
-    file_ready_ = false;
-    decode_busy_ = true;
-    // Spawn decode worker
-    struct Ctx { BackgroundArt* self; } *ctx = new Ctx{this};
-    auto decTask = [](void* arg){
-      std::unique_ptr<Ctx> holder((Ctx*)arg);
-      BackgroundArt* self = holder->self;
-      char bg_reason[96]; strncpy(bg_reason, "unknown", sizeof(bg_reason));
-      self->ready_ = false;
-
-      // Read file into RAM
-      std::vector<uint8_t> jpg;
-      File fi = SPIFFS.open(self->path_, FILE_READ);
-      if (fi) {
-        size_t n = fi.size(); jpg.resize(n);
-        if (n) (void)fi.read(jpg.data(), n);
-        fi.close();
-        Serial.printf("AlbumArt(bg): file read %u bytes, head=%02X %02X %02X %02X\n", (unsigned)jpg.size(), jpg.size()>0?jpg[0]:0, jpg.size()>1?jpg[1]:0, jpg.size()>2?jpg[2]:0, jpg.size()>3?jpg[3]:0);
-      }
-
-      // Allocate internal FB
-      if (self->fb_) { heap_caps_free(self->fb_); self->fb_ = nullptr; }
-      self->fb_ = (uint16_t*) heap_caps_malloc(480*480*sizeof(uint16_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-      if (!self->fb_) self->fb_ = (uint16_t*) heap_caps_malloc(480*480*sizeof(uint16_t), MALLOC_CAP_8BIT);
-      if (!self->fb_) self->fb_ = (uint16_t*) malloc(480*480*sizeof(uint16_t));
-      if (self->fb_) memset(self->fb_, 0x00, 480*480*sizeof(uint16_t));
-
-      if (!jpg.empty() && self->fb_) {
-        bool is_png = (jpg.size() >= 8 && jpg[0]==0x89 && jpg[1]==0x50 && jpg[2]==0x4E && jpg[3]==0x47 && jpg[4]==0x0D && jpg[5]==0x0A && jpg[6]==0x1A && jpg[7]==0x0A);
-        bool is_jpeg = (jpg.size() >= 2 && jpg[0]==0xFF && jpg[1]==0xD8);
-        // Temporary: disable PNG path during stabilization (suspected misuse of PNGdec line API)
-        if (false && is_png) {
-          // PNG decode temporarily disabled
-        } else if (is_jpeg) {
-          // Use the proven AlbumArtService pipeline to decode into our framebuffer
-          bool ok = albumart::AlbumArtService::decodeToCropped480(jpg.data(), jpg.size(), self->fb_);
-          if (ok) { self->blit_row_ = 0; self->ready_ = true; Serial.printf("AlbumArt(bg): background ready (AlbumArtService RAM)\n"); }
-          else { Serial.println("AlbumArt(bg): AlbumArtService decode failed"); strncpy(bg_reason, "AlbumArtService decode failed", sizeof(bg_reason)); }
-          // Progressive JPEG fallback temporarily disabled for stability
-        }
-      }
+void BackgroundArt::present(ui_gfx::FbLease fb, const CoverTone& tone) {
+  if (!fb) return;
+  // superseded before the UI picked it up: the old slab returns to the pool
+  uint32_t h = fb.detach();
+  portENTER_CRITICAL(&pending_mux_);
+  uint32_t old = pending_fb_.exchange(h);
+  pending_tone_ = tone;
+  portEXIT_CRITICAL(&pending_mux_);
+  ui_gfx::FbLease::adopt(old);
+}
 
-      if (!self->ready_ && self->fb_) {
-        // Visible neutral fallback
-        for (int y = 0; y < 480; ++y) {
-          uint8_t v = (uint8_t)(32 + (y * 192 / 479));
-          uint16_t c = ((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3);
-          for (int x = 0; x < 480; ++x) self->fb_[y*480 + x] = c;
-        }
-        self->blit_row_ = 0; self->ready_ = true;
-        Serial.printf("AlbumArt(bg): fallback gradient shown (reason: %s)\n", bg_reason);
+void BackgroundArt::tick() {
+  if (hold_) return;
+  portENTER_CRITICAL(&pending_mux_);
+  uint32_t h = pending_fb_.exchange(0);
+  if (h) tone_ = pending_tone_;
+  portEXIT_CRITICAL(&pending_mux_);
+  if (!h) return;
+  if (sys::kCoverFadeMs && fb_ && ready_) {
+    // Fade from what is shown. A fade still running is frozen at its current mix: the
+    // old cover blended into the newer one in place, which then fades out in turn.
+    if (prev_ && fade_alpha_ == 0) {
+      fb_ = std::move(prev_); // nothing of the newer cover shown yet
+    } else if (prev_) {
+      uint16_t* fb = fb_.data();
+      const uint16_t* old = prev_.data();
+      for (int y = 0; y < 480; ++y) {
+        int x = 0, w = 480;
+        if (!ui_gfx::RoundMask::clipRow(y, x, w)) continue;
+        ui_gfx::blend565Row(fb + y * 480 + x, fb + y * 480 + x, old + y * 480 + x, w, fade_alpha_);
       }
+      prev_.reset();
+    }
+    prev_ = std::move(fb_);
+    fade_alpha_ = 0;
+    fade_started_ = false;
+  } else {
+    prev_.reset();
+    fade_alpha_ = 32;
+  }
+  fb_ = ui_gfx::FbLease::adopt(h); // previous slab returns to the pool unless fading
+  blit_row_ = 0;
+  ready_ = true;
+  new_frame_ = true;
+}
 
-      self->decode_busy_ = false;
-      vTaskDelete(NULL);
-    };
-    const uint32_t stack_words = 24576; // 96KB
-    xTaskCreatePinnedToCore(decTask, "aa_decode", stack_words, ctx, tskIDLE_PRIORITY+1, nullptr, 1);
+bool BackgroundArt::stepFade(unsigned long now_ms) {
+  if (!prev_) return false;
+  if (!fade_started_) { fade_started_ = true; fade_start_ = now_ms; fade_next_ = 0; }
+  const unsigned long t = now_ms - fade_start_;
+  if (t < fade_next_) return false;
+  if (t >= sys::kCoverFadeMs) {
+    // Last frame: the new cover alone, the old slab back to the pool
+    prev_.reset();
+    fade_alpha_ = 32;
+    return true;
   }
+  // Alpha follows the clock: a slow frame makes the fade coarser, never longer
+  const uint8_t a = (uint8_t)(t * 32 / sys::kCoverFadeMs);
+  fade_next_ = t + sys::kCoverFadeMs / sys::kCoverFadeFrames;
+  if (a == fade_alpha_) return false;
+  fade_alpha_ = a;
+  return true;
+}
+
+bool BackgroundArt::consumeNewFrame() {
+  bool v = new_frame_;
+  new_frame_ = false;
+  return v;
 }
 
 void BackgroundArt::blitStep(ui_gfx::Display& disp) {
@@ -186,7 +144,7 @@ void BackgroundArt::blitStep(ui_gfx::Display& disp) {
     if (y_start >= y_limit) { blit_row_ = 480; return; }
     int h = (y_start + STRIP <= y_limit) ? STRIP : (y_limit - y_start);
     if (h <= 0) { blit_row_ = 480; return; }
-    disp.raw()->draw16bitRGBBitmap(0, y_start, &fb_[(size_t)y_start * 480], 480, h);
+    disp.drawRectVisible(0, y_start, &fb_.data()[(size_t)y_start * 480], 480, 480, h);
     did_blit_ = true;
     blit_row_ = y_start + h;
     return;
@@ -206,16 +164,64 @@ void BackgroundArt::blitRegion(ui_gfx::Display& disp, int y0, int y1) {
   if (y0 < 0) y0 = 0; if (y1 >= 480) y1 = 479;
   if (y0 > y1) return;
   int h = y1 - y0 + 1;
-  disp.raw()->draw16bitRGBBitmap(0, y0, &fb_[(size_t)y0 * 480], 480, h);
+  disp.drawRectVisible(0, y0, &fb_.data()[(size_t)y0 * 480], 480, 480, h);
+}
+
+void BackgroundArt::blitRect(ui_gfx::Display& disp, int x, int y, int w, int h, uint8_t dimShift) {
+  if (!(fb_ && ready_)) return;
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > 480) w = 480 - x;
+  if (y + h > 480) h = 480 - y;
+  if (w <= 0 || h <= 0) return;
+  const uint16_t* src = &fb_.data()[(size_t)y * 480 + x];
+  const uint16_t* old = prev_ ? &prev_.data()[(size_t)y * 480 + x] : nullptr;
+  uint16_t row[480];
+  const uint16_t mask = CoverTone::dimMask(dimShift);
+  for (int r = 0; r < h; ++r, src += 480) {
+    int cx = x, cw = w;
+    if (!ui_gfx::RoundMask::clipRow(y + r, cx, cw)) continue;
+    const uint16_t* s = src + (cx - x);
+    if (old) { ui_gfx::blend565Row(row, s, old + (size_t)r * 480 + (cx - x), cw, fade_alpha_); s = row; }
+    if (dimShift) {
+      for (int i = 0; i < cw; ++i) row[i] = (uint16_t)((s[i] >> dimShift) & mask);
+      s = row;
+    }
+    disp.drawRow(cx, y + r, s, cw);
+  }
+}
+
+void BackgroundArt::copyRect(uint16_t* dst, int stride, int x, int y, int w, int h, uint8_t dimShift) const {
+  if (!(fb_ && ready_) || !dst) return;
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > 480) w = 480 - x;
+  if (y + h > 480) h = 480 - y;
+  if (w <= 0 || h <= 0) return;
+  const uint16_t* src = &fb_.data()[(size_t)y * 480 + x];
+  const uint16_t* old = prev_ ? &prev_.data()[(size_t)y * 480 + x] : nullptr;
+  uint16_t* out = dst + (size_t)y * stride + x;
+  const uint16_t mask = CoverTone::dimMask(dimShift);
+  for (int r = 0; r < h; ++r, src += 480, out += stride) {
+    if (old) {
+      // Mid-fade: the mix of both covers, written straight into the surface
+      ui_gfx::blend565Row(out, src, old, w, fade_alpha_);
+      old += 480;
+      if (dimShift) for (int i = 0; i < w; ++i) out[i] = (uint16_t)((out[i] >> dimShift) & mask);
+      continue;
+    }
+    if (!dimShift) { memcpy(out, src, (size_t)w * sizeof(uint16_t)); continue; }
+    for (int i = 0; i < w; ++i) out[i] = (uint16_t)((src[i] >> dimShift) & mask);
+  }
 }
 
 void BackgroundArt::forceFullRedraw(ui_gfx::Display& disp) {
   // Force complete redraw of background image (for screen switching)
-  Serial.printf("AlbumArt(bg): forceFullRedraw() called, fb_=%p ready_=%d\n", fb_, ready_);
+  Serial.printf("AlbumArt(bg): forceFullRedraw() called, fb_=%p ready_=%d\n", fb_.data(), ready_);
   if (fb_ && ready_) {
     Serial.println("AlbumArt(bg): using internal buffer for full redraw");
-    // Draw the complete background image immediately
-    disp.raw()->draw16bitRGBBitmap(0, 0, fb_, 480, 480);
+    // Draw the complete background image immediately (the visible circle of it)
+    disp.drawRectVisible(0, 0, fb_.data(), 480, 480, 480);
     // Pause progressive blitting for 5 seconds to let the full image be visible
     pauseBlitting(5000);
     // Reset progressive blitting to end state to prevent overwriting
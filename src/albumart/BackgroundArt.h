@@ -1,28 +1,54 @@
 #pragma once
 #include <Arduino.h>
+#include <atomic>
 #include "gfx/Display.h"
+#include "gfx/FramebufferPool.h"
+#include "albumart/ArtScheduler.h"
+#include "albumart/CoverTone.h"
 
 namespace albumart {
 
 // BackgroundArt kapselt Download, Decode und Blit des Album-Art-Hintergrunds.
-// Schrittweise Migration: Falls ein Legacy-Framebuffer angehängt ist, wird dieser
-// weiter unterstützt; bevorzugt wird jedoch der interne Framebuffer der Klasse.
+// Die Framebuffer sind Leases aus dem FramebufferPool; ein Trackwechsel alloziert nichts.
 class BackgroundArt {
 public:
   void setUrl(const String& url) { url_ = url; }
 
-  // Startet einen neuen Hintergrundjob (Download+Decode). Idempotent, wenn bereits busy oder URL unverändert.
+  // Reiht einen Hintergrundjob (Download+Decode) im ArtScheduler ein. Idempotent bei unveränderter URL.
   void start();
 
-  // Treibt die internen Jobs (z. B. Start des Decode-Workers, wenn Datei fertig)
+  // Übergibt ein fertiges Bild samt Tonanalyse (Decode-Worker, UI-Benchmark); tick() übernimmt es
+  void present(ui_gfx::FbLease fb, const CoverTone& tone);
+
+  // Übernimmt ein fertig dekodiertes Bild in den Framebuffer (UI-Thread). Ersetzt es ein
+  // angezeigtes Bild, bleibt das alte für die Überblendung (sys::kCoverFadeMs) erhalten;
+  // mitten in einer Überblendung wird deren aktuelle Mischung zum alten Bild.
   void tick();
 
+  // Überblendung: true, solange das alte Bild noch beteiligt ist
+  bool fading() const { return (bool)prev_; }
+  // Nächster Überblendschritt nach der Zeit; true, wenn sich das Bild geändert hat und neu
+  // gezeichnet werden muss. Nur zwischen zwei Frames aufrufen.
+  bool stepFade(unsigned long now_ms);
+  // Solange gesetzt, übernimmt tick() kein neues Bild (ein Frame wird gerade gezeichnet)
+  void hold(bool on) { hold_ = on; }
+
   // Blit eines nicht-überlappenden Strips auf das Display (24px), mit Top/Bottom-Reserve
   void blitStep(ui_gfx::Display& disp);
 
   // Blit einen vertikalen Bereich [y0..y1] aus dem aktuellen FB zurück auf das Display
   void blitRegion(ui_gfx::Display& disp, int y0, int y1);
 
+  // Blit eines Rechtecks aus dem FB, pro Kanal um dimShift Bit abgedunkelt (Hintergrund für Overlays)
+  void blitRect(ui_gfx::Display& disp, int x, int y, int w, int h, uint8_t dimShift);
+
+  // Wie blitRect, aber in eine Off-Screen-Fläche (gleiche Koordinaten, Zeilenlänge stride)
+  void copyRect(uint16_t* dst, int stride, int x, int y, int w, int h, uint8_t dimShift) const;
+  // blitRect/copyRect zeigen während einer Überblendung die Mischung aus altem und neuem Bild
+
+  // Signal, ob tick() seit dem letzten Abfragen ein neues Bild übernommen hat
+  bool consumeNewFrame();
+
   // Force complete redraw of background (for screen switching)
   void forceFullRedraw(ui_gfx::Display& disp);
 
@@ -36,26 +62,38 @@ public:
   bool consumeDidBlit();
 
   // Zugriff für Decoder-Callbacks
-  inline uint16_t* fbRaw() { return fb_; }
+  inline uint16_t* fbRaw() { return fb_.data(); }
 
   // Legacy-Unterstützung entfernt - verwende nur noch das interne System
 
+  // Helligkeit/Palette des angezeigten Bildes (valid=false ohne Bild)
+  const CoverTone& tone() const { return tone_; }
+
   // State
   bool ready() const { return fb_ && ready_; }
-  bool busy() const { return job_busy_ || decode_busy_; }
+  bool busy() const;
 
 private:
+  static void onResult(void* user, ArtResult& r);
+
   // Konfiguration/Quelle
   String url_;
   String last_started_url_ = "";
-  const char* path_ = "/album.bin";
+  std::atomic<ArtJobId> job_{0}; // neuester Job; ältere Ergebnisse werden verworfen
 
   // Interner Framebuffer und Status
-  uint16_t* fb_ = nullptr;
+  ui_gfx::FbLease fb_;
+  ui_gfx::FbLease prev_;                 // altes Bild während der Überblendung
+  uint8_t fade_alpha_ = 32;              // Anteil von fb_ über prev_, 0..32
+  unsigned long fade_start_ = 0, fade_next_ = 0;
+  bool fade_started_ = false;
+  bool hold_ = false;
+  std::atomic<uint32_t> pending_fb_{0}; // FbLease-Handle vom Decode-Worker, von tick() übernommen
+  CoverTone tone_;
+  CoverTone pending_tone_;               // gehört zu pending_fb_; beide unter pending_mux_ getauscht
+  portMUX_TYPE pending_mux_ = portMUX_INITIALIZER_UNLOCKED;
   bool ready_ = false;
-  bool decode_busy_ = false;
-  bool job_busy_ = false;
-  bool file_ready_ = false;
+  bool new_frame_ = false;
   int blit_row_ = 0;
   volatile bool did_blit_ = false;
   bool fully_redrawn_ = false;
@@ -0,0 +1,20 @@
+#pragma once
+#include <atomic>
+
+namespace albumart {
+
+// Cooperative cancellation flag shared between a job owner and the code running it.
+// Long loops (download reads, decoder bands/rows) poll cancelled() and bail out early.
+class CancelToken {
+public:
+  void cancel() { flag_.store(true, std::memory_order_relaxed); }
+  bool cancelled() const { return flag_.load(std::memory_order_relaxed); }
+
+  // Null-safe helper for optional tokens
+  static bool isCancelled(const CancelToken* t) { return t && t->cancelled(); }
+
+private:
+  std::atomic<bool> flag_{false};
+};
+
+} // namespace albumart
@@ -0,0 +1,101 @@
+#include "albumart/CoverCache.h"
+#include "base/Config.h"
+#include "base/Log.h"
+
+namespace albumart {
+
+namespace {
+struct MutexLock {
+  SemaphoreHandle_t m;
+  explicit MutexLock(SemaphoreHandle_t mtx): m(mtx) { xSemaphoreTake(m, portMAX_DELAY); }
+  ~MutexLock() { xSemaphoreGive(m); }
+};
+}
+
+CoverCache::CoverCache() : mtx_(xSemaphoreCreateMutex()) {}
+
+bool CoverCache::lookup(const String& url, HttpCacheMeta& meta, bool& fresh) const {
+  fresh = false;
+  if (!mtx_ || !url.length()) return false;
+  MutexLock lock(mtx_);
+  for (const Entry* e : entries_) {
+    if (e->url != url) continue;
+    meta = e->meta;
+    uint32_t ttl = e->meta.maxAgeS >= 0 ? (uint32_t)e->meta.maxAgeS : sys::kArtHeuristicFreshS;
+    fresh = millis() - e->validatedAt < ttl * 1000UL;
+    return true;
+  }
+  return false;
+}
+
+void CoverCache::revalidated(const String& url, const HttpCacheMeta& meta) {
+  if (!mtx_) return;
+  MutexLock lock(mtx_);
+  for (Entry* e : entries_) {
+    if (e->url != url) continue;
+    e->meta = meta;
+    e->validatedAt = millis();
+    return;
+  }
+}
+
+bool CoverCache::get(const String& url, uint16_t* dst) {
+  if (!mtx_ || !dst || !url.length()) return false;
+  MutexLock lock(mtx_); // held while decoding so the entry cannot be evicted underneath
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    Entry* e = entries_[i];
+    if (e->url != url) continue;
+    unsigned long t0 = millis();
+    ui_gfx::SurfaceDecoder dec(e->surface);
+    if (!dec.readAll(dst)) {
+      LOGE("CACHE", "corrupt entry dropped: %s", url.c_str());
+      bytes_ -= e->surface.packedBytes();
+      delete e; entries_.erase(entries_.begin() + i);
+      return false;
+    }
+    entries_.erase(entries_.begin() + i);
+    entries_.insert(entries_.begin(), e);
+    LOGI("CACHE", "hit %u KB in %lu ms: %s", (unsigned)(e->surface.packedBytes() / 1024), millis() - t0, url.c_str());
+    return true;
+  }
+  return false;
+}
+
+void CoverCache::put(const String& url, const uint16_t* fb, const HttpCacheMeta& meta) {
+  if (!mtx_ || !fb || !url.length() || !sys::kCoverCacheBytes) return;
+  if (meta.noStore) { LOGI("CACHE", "no-store, not cached: %s", url.c_str()); return; }
+  // Encode outside the lock; covers that do not compress below half size are not worth keeping
+  Entry* e = new Entry();
+  e->url = url;
+  e->meta = meta;
+  unsigned long t0 = millis();
+  const size_t raw = (size_t)sys::kScreenW * sys::kScreenH * sizeof(uint16_t);
+  if (!ui_gfx::SurfaceEncoder::encode(fb, sys::kScreenW, sys::kScreenH, e->surface, raw / 2)) {
+    LOGI("CACHE", "not cached (compresses poorly): %s", url.c_str());
+    delete e;
+    return;
+  }
+  const size_t sz = e->surface.packedBytes();
+  MutexLock lock(mtx_);
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    if (entries_[i]->url == url) { bytes_ -= entries_[i]->surface.packedBytes(); delete entries_[i]; entries_.erase(entries_.begin() + i); break; }
+  }
+  evictLocked(sz);
+  e->validatedAt = millis();
+  entries_.insert(entries_.begin(), e);
+  bytes_ += sz;
+  LOGI("CACHE", "stored %u KB (%.1fx) in %lu ms, %u covers / %u KB", (unsigned)(sz / 1024), (double)raw / sz,
+       millis() - t0, (unsigned)entries_.size(), (unsigned)(bytes_ / 1024));
+}
+
+void CoverCache::evictLocked(size_t incoming) {
+  while (!entries_.empty() && bytes_ + incoming > sys::kCoverCacheBytes) {
+    Entry* e = entries_.back();
+    bytes_ -= e->surface.packedBytes();
+    LOGI("CACHE", "evict %s", e->url.c_str());
+    delete e;
+    entries_.pop_back();
+  }
+}
+
+} // namespace albumart
@@ -0,0 +1,52 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "gfx/SurfaceCodec.h"
+#include "albumart/Downloader.h"
+
+namespace albumart {
+
+// In-memory LRU of decoded 480x480 covers, kept as compressed surfaces so a few MB
+// hold several times more covers than raw framebuffers would. A fresh hit replaces the
+// download and the JPEG/PNG decode with one streaming surface decode; a stale one is
+// revalidated with the stored ETag/Last-Modified (304 keeps it).
+class CoverCache {
+public:
+  static CoverCache& instance() { static CoverCache c; return c; }
+
+  // True if url is cached; meta gets its validators, fresh whether it may be used
+  // without asking the server (Cache-Control max-age, else sys::kArtHeuristicFreshS)
+  bool lookup(const String& url, HttpCacheMeta& meta, bool& fresh) const;
+
+  // Decodes the cached cover for url into dst (kScreenW x kScreenH); false on miss
+  bool get(const String& url, uint16_t* dst);
+
+  // Compresses fb and stores it, evicting least recently used covers over budget.
+  // Responses marked no-store are not kept.
+  void put(const String& url, const uint16_t* fb, const HttpCacheMeta& meta);
+
+  // Server confirmed the cached copy (304): restart its freshness period
+  void revalidated(const String& url, const HttpCacheMeta& meta);
+
+  size_t bytes() const { return bytes_; }
+  size_t count() const { return entries_.size(); }
+
+private:
+  struct Entry {
+    String url;
+    ui_gfx::Surface surface;
+    HttpCacheMeta meta;
+    unsigned long validatedAt = 0;  // millis() of the last 200/304
+  };
+
+  CoverCache();
+  void evictLocked(size_t incoming);
+
+  SemaphoreHandle_t mtx_ = nullptr;
+  std::vector<Entry*> entries_;   // most recently used first
+  size_t bytes_ = 0;
+};
+
+} // namespace albumart
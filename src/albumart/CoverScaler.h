@@ -0,0 +1,124 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace albumart {
+
+// Streams decoded source rows (RGB565, top to bottom) into a w x h target. Sources
+// larger than the target in both dimensions are box-filtered so the shorter side fills
+// it and the longer side is center-cropped; smaller sources are centered unscaled,
+// unless `fill` asks to enlarge them (nearest neighbour) to cover the target too.
+// Memory is bounded by one accumulator row of the target width.
+class CoverScaler {
+public:
+  bool begin(uint16_t* out, int ow, int oh, int sw, int sh, bool fill = false) {
+    if (!out || ow <= 0 || oh <= 0 || sw <= 0 || sh <= 0) return false;
+    out_ = out; ow_ = ow; oh_ = oh; sw_ = sw; sh_ = sh;
+    num_ = 1; den_ = 1;
+    if ((sw > ow && sh > oh) || (fill && (sw < ow || sh < oh))) {
+      if ((int64_t)ow * sh > (int64_t)oh * sw) { num_ = ow; den_ = sw; } else { num_ = oh; den_ = sh; }
+    }
+    up_ = num_ > den_;
+    int scw = (int)((int64_t)sw * num_ / den_), sch = (int)((int64_t)sh * num_ / den_);
+    vis_w_ = scw < ow ? scw : ow;  vis_h_ = sch < oh ? sch : oh;
+    crop_x0_ = (scw - vis_w_) / 2; crop_y0_ = (sch - vis_h_) / 2;
+    dst_x0_ = (ow - vis_w_) / 2;   dst_y0_ = (oh - vis_h_) / 2;
+    acc_.reset(new (std::nothrow) uint32_t[(size_t)vis_w_ * 3]());
+    cnt_.reset(new (std::nothrow) uint16_t[vis_w_]());
+    cur_row_ = -1;
+    return acc_ && cnt_;
+  }
+
+  // False when source row y falls outside the visible window (callers may skip it)
+  bool wantsRow(int y) const {
+    if (up_) return upEnd(y) > crop_y0_ && upBegin(y) < crop_y0_ + vis_h_;
+    int row = (int)((int64_t)y * num_ / den_);
+    return row >= crop_y0_ && row < crop_y0_ + vis_h_;
+  }
+
+  // Source columns [srcColBegin, srcColEnd) reach the visible window; decoders may
+  // leave pixels outside this range unset
+  int srcColBegin() const {
+    if (up_) return (int)((int64_t)crop_x0_ * den_ / num_);
+    return (int)(((int64_t)crop_x0_ * den_ + num_ - 1) / num_);
+  }
+  int srcColEnd() const {
+    int e = up_ ? (int)((int64_t)(crop_x0_ + vis_w_ - 1) * den_ / num_) + 1
+                : (int)(((int64_t)(crop_x0_ + vis_w_) * den_ + num_ - 1) / num_);
+    return e < sw_ ? e : sw_;
+  }
+
+  void pushRow(int y, const uint16_t* px, int n) {
+    if (up_) { pushRowUp(y, px, n); return; }
+    int row = (int)((int64_t)y * num_ / den_);
+    if (row < crop_y0_ || row >= crop_y0_ + vis_h_) return;
+    if (row != cur_row_) { flush(); cur_row_ = row; }
+    if (n > sw_) n = sw_;
+    for (int x = 0; x < n; ++x) {
+      int col = (int)((int64_t)x * num_ / den_) - crop_x0_;
+      if (col < 0) continue;
+      if (col >= vis_w_) break;
+      uint16_t p = px[x];
+      uint32_t* a = &acc_[col*3];
+      a[0] += p >> 11; a[1] += (p >> 5) & 0x3F; a[2] += p & 0x1F;
+      cnt_[col]++;
+    }
+  }
+
+  void finish() { flush(); }
+
+  int visW() const { return vis_w_; }
+  int visH() const { return vis_h_; }
+  int dstX() const { return dst_x0_; }
+  int dstY() const { return dst_y0_; }
+
+private:
+  // Enlarging: source row y becomes scaled rows [upBegin(y), upEnd(y))
+  int upBegin(int y) const { return (int)(((int64_t)y * num_ + den_ - 1) / den_); }
+  int upEnd(int y) const { return upBegin(y + 1); }
+
+  void pushRowUp(int y, const uint16_t* px, int n) {
+    int r0 = upBegin(y), r1 = upEnd(y);
+    if (r0 < crop_y0_) r0 = crop_y0_;
+    if (r1 > crop_y0_ + vis_h_) r1 = crop_y0_ + vis_h_;
+    if (r0 >= r1) return;
+    uint16_t* d = &out_[(size_t)(dst_y0_ + r0 - crop_y0_) * ow_ + dst_x0_];
+    for (int i = 0; i < vis_w_; ++i) {
+      int x = (int)((int64_t)(crop_x0_ + i) * den_ / num_);
+      d[i] = px[x < n ? x : n - 1];
+    }
+    for (int r = r0 + 1; r < r1; ++r) memcpy(d + (size_t)(r - r0) * ow_, d, sizeof(uint16_t) * vis_w_);
+  }
+
+  void flush() {
+    if (cur_row_ < 0) return;
+    int dy = dst_y0_ + (cur_row_ - crop_y0_);
+    if (dy >= 0 && dy < oh_) {
+      uint16_t* d = &out_[(size_t)dy * ow_ + dst_x0_];
+      for (int i = 0; i < vis_w_; ++i) {
+        uint32_t c = cnt_[i]; if (!c) continue;
+        uint32_t r = acc_[i*3] / c, g = acc_[i*3+1] / c, b = acc_[i*3+2] / c;
+        d[i] = (uint16_t)((r << 11) | (g << 5) | b);
+      }
+    }
+    memset(acc_.get(), 0, sizeof(uint32_t) * 3 * vis_w_);
+    memset(cnt_.get(), 0, sizeof(uint16_t) * vis_w_);
+    cur_row_ = -1;
+  }
+
+  uint16_t* out_ = nullptr; int ow_ = 0, oh_ = 0;
+  int sw_ = 0, sh_ = 0;
+  int num_ = 1, den_ = 1;         // scale factor num/den (> 1 only with fill)
+  bool up_ = false;
+  int crop_x0_ = 0, crop_y0_ = 0; // visible window origin in scaled space
+  int dst_x0_ = 0, dst_y0_ = 0;   // where the window lands in out
+  int vis_w_ = 0, vis_h_ = 0;
+  std::unique_ptr<uint32_t[]> acc_; // vis_w * 3 channel sums of the current output row
+  std::unique_ptr<uint16_t[]> cnt_; // samples per output column
+  int cur_row_ = -1;
+};
+
+} // namespace albumart
@@ -0,0 +1,97 @@
+#include "albumart/CoverTone.h"
+#include <memory>
+#include <new>
+
+namespace albumart {
+
+namespace {
+
+static constexpr int kSize = 480;
+static constexpr int kStep = 4;          // every 4th pixel of every 4th row
+static constexpr int kLumaBins = 32;
+static constexpr int kPaletteBins = 512; // 3 bits per channel
+
+struct ColorBin { uint32_t n, r, g, b; };
+
+static inline void expand565(uint16_t c, int& r, int& g, int& b) {
+  r = ((c >> 11) * 527 + 23) >> 6;
+  g = (((c >> 5) & 0x3F) * 259 + 33) >> 6;
+  b = ((c & 0x1F) * 527 + 23) >> 6;
+}
+
+static inline uint16_t pack565(int r, int g, int b) {
+  return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+static uint8_t percentile(const uint16_t* hist, uint32_t total, uint32_t rank) {
+  uint32_t acc = 0;
+  for (int i = 0; i < kLumaBins; ++i) {
+    acc += hist[i];
+    if (acc > rank) return (uint8_t)(i * (256 / kLumaBins) + (256 / kLumaBins) / 2);
+  }
+  return total ? 255 : 0;
+}
+
+} // namespace
+
+CoverTone analyzeCover(const uint16_t* fb) {
+  CoverTone t;
+  if (!fb) return t;
+  std::unique_ptr<ColorBin[]> bins(new (std::nothrow) ColorBin[kPaletteBins]());
+  const int c = kSize / 2, r2 = c * c;
+
+  for (int band = 0; band < CoverTone::kBands; ++band) {
+    uint16_t hist[kLumaBins] = {};
+    uint32_t n = 0, sum = 0;
+    for (int y = band * CoverTone::kBandH + kStep / 2; y < (band + 1) * CoverTone::kBandH; y += kStep) {
+      const uint16_t* row = fb + (size_t)y * kSize;
+      int dy = y - c;
+      for (int x = kStep / 2; x < kSize; x += kStep) {
+        int dx = x - c;
+        if (dx * dx + dy * dy > r2) continue; // outside the round panel
+        int r, g, b;
+        uint16_t px = row[x];
+        expand565(px, r, g, b);
+        int luma = (77 * r + 150 * g + 29 * b) >> 8;
+        ++hist[luma >> 3];
+        sum += luma; ++n;
+        if (bins) {
+          ColorBin& cb = bins[((r >> 5) << 6) | ((g >> 5) << 3) | (b >> 5)];
+          ++cb.n; cb.r += r; cb.g += g; cb.b += b;
+        }
+      }
+    }
+    if (!n) continue; // cannot happen for 40-row bands of a 480 circle
+    t.lo[band] = percentile(hist, n, n / 10);
+    t.hi[band] = percentile(hist, n, n - 1 - n / 10);
+    t.mean[band] = (uint8_t)(sum / n);
+  }
+
+  t.dominant = t.accent = pack565(128, 128, 128);
+  if (bins) {
+    int dom = 0;
+    for (int i = 1; i < kPaletteBins; ++i) if (bins[i].n > bins[dom].n) dom = i;
+    const ColorBin& d = bins[dom];
+    if (d.n) {
+      int dr = d.r / d.n, dg = d.g / d.n, db = d.b / d.n;
+      t.dominant = t.accent = pack565(dr, dg, db);
+      // Accent: a clearly saturated colour well away from the dominant one, by coverage
+      uint32_t best = 0;
+      for (int i = 0; i < kPaletteBins; ++i) {
+        const ColorBin& cb = bins[i];
+        if (!cb.n || i == dom) continue;
+        int r = cb.r / cb.n, g = cb.g / cb.n, b = cb.b / cb.n;
+        int mx = r > g ? (r > b ? r : b) : (g > b ? g : b);
+        int mn = r < g ? (r < b ? r : b) : (g < b ? g : b);
+        int dist = (r > dr ? r - dr : dr - r) + (g > dg ? g - dg : dg - g) + (b > db ? b - db : db - b);
+        if (mx - mn < 64 || dist < 96) continue;
+        uint32_t score = cb.n * (uint32_t)(mx - mn);
+        if (score > best) { best = score; t.accent = pack565(r, g, b); }
+      }
+    }
+  }
+  t.valid = true;
+  return t;
+}
+
+} // namespace albumart
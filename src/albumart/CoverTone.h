@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+
+namespace albumart {
+
+// How overlay text is drawn over a part of the cover
+enum class OverlayInk : uint8_t {
+  Outline, // busy background: white text with a black outline (9 passes)
+  Light,   // dark everywhere: plain white text
+  Dark,    // light everywhere: plain dark text
+};
+
+// Brightness per 40-row band and a two-colour palette of a 480x480 cover. Computed
+// once per frame by the decode worker from a 1/16 subsample of the visible circle, so
+// overlays can pick single-pass text and dim the art instead of painting boxes.
+struct CoverTone {
+  static constexpr int kBandH = 40;
+  static constexpr int kBands = 480 / kBandH;
+  // White text needs the brightest background below this; dark text the darkest above
+  static constexpr uint8_t kLightTextMaxLuma = 112;
+  static constexpr uint8_t kDarkTextMinLuma = 176;
+
+  bool valid = false;
+  uint8_t lo[kBands] = {};   // 10th percentile luma (0..255)
+  uint8_t mean[kBands] = {};
+  uint8_t hi[kBands] = {};   // 90th percentile luma
+  uint16_t dominant = 0;     // RGB565, most common colour
+  uint16_t accent = 0;       // most common saturated colour unlike dominant; dominant if none
+
+  uint8_t loOver(int y0, int y1) const {
+    uint8_t v = 255;
+    for (int b = band(y0); b <= band(y1); ++b) if (lo[b] < v) v = lo[b];
+    return v;
+  }
+  uint8_t hiOver(int y0, int y1) const {
+    uint8_t v = 0;
+    for (int b = band(y0); b <= band(y1); ++b) if (hi[b] > v) v = hi[b];
+    return v;
+  }
+
+  // Text style for rows [y0..y1]
+  OverlayInk inkFor(int y0, int y1) const {
+    if (!valid) return OverlayInk::Outline;
+    if (hiOver(y0, y1) < kLightTextMaxLuma) return OverlayInk::Light;
+    if (loOver(y0, y1) > kDarkTextMinLuma) return OverlayInk::Dark;
+    return OverlayInk::Outline;
+  }
+
+  // Right shift for the art behind white text in rows [y0..y1] (see dim565): 0 when it
+  // is dark enough already, at most 3
+  uint8_t dimShiftFor(int y0, int y1) const {
+    if (!valid) return 2;
+    uint8_t h = hiOver(y0, y1), s = 0;
+    while (s < 3 && (h >> s) >= kLightTextMaxLuma) ++s;
+    return s;
+  }
+
+  // Ink for OverlayInk::Dark: the dominant colour at 1/8 brightness
+  uint16_t darkInk() const { return dim565(dominant, 3); }
+
+  static uint16_t dim565(uint16_t c, uint8_t shift) { return (uint16_t)((c >> shift) & dimMask(shift)); }
+  // Keeps each channel's own bits after shifting the whole pixel right
+  static uint16_t dimMask(uint8_t shift) {
+    return (uint16_t)(((0x1F >> shift) << 11) | ((0x3F >> shift) << 5) | (0x1F >> shift));
+  }
+
+private:
+  static int band(int y) { return y < 0 ? 0 : (y >= kBands * kBandH ? kBands - 1 : y / kBandH); }
+};
+
+// Analyses a 480x480 RGB565 frame (~14k samples, well under a millisecond of the
+// decode); the palette needs 8 KB of scratch and is left at mid grey without it
+CoverTone analyzeCover(const uint16_t* fb);
+
+} // namespace albumart
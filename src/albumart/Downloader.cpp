@@ -0,0 +1,470 @@
+#include "albumart/Downloader.h"
+#include <WiFi.h>
+#include <WiFiClient.h>
+#include <WiFiClientSecure.h>
+#include <FS.h>
+#include <SPIFFS.h>
+#include <atomic>
+#include <memory>
+#include "base/Config.h"
+#include "base/Log.h"
+#include "albumart/UrlRewriter.h"
+
+namespace albumart {
+
+namespace {
+
+struct Url {
+  bool https = false;
+  String host;
+  uint16_t port = 80;
+  String path = "/";
+};
+
+static bool parseUrl(const String& u, Url& out) {
+  int p;
+  if (u.startsWith("https://")) { out.https = true; out.port = 443; p = 8; }
+  else if (u.startsWith("http://")) { out.https = false; out.port = 80; p = 7; }
+  else return false;
+  int slash = u.indexOf('/', p);
+  String hostport = slash < 0 ? u.substring(p) : u.substring(p, slash);
+  out.path = slash < 0 ? String("/") : u.substring(slash);
+  int colon = hostport.lastIndexOf(':');
+  if (colon > 0 && hostport.indexOf(']') < colon) {
+    out.port = (uint16_t)hostport.substring(colon + 1).toInt();
+    hostport = hostport.substring(0, colon);
+  }
+  out.host = hostport;
+  return out.host.length() > 0 && out.port != 0;
+}
+
+// Location may be absolute or host-relative
+static String resolveLocation(const Url& base, const String& loc) {
+  if (loc.startsWith("http://") || loc.startsWith("https://")) return loc;
+  String origin = String(base.https ? "https://" : "http://") + base.host;
+  if (base.port != (base.https ? 443 : 80)) origin += ":" + String(base.port);
+  if (loc.startsWith("/")) return origin + loc;
+  int slash = base.path.lastIndexOf('/');
+  return origin + base.path.substring(0, slash + 1) + loc;
+}
+
+struct Conn {
+  bool https = false;
+  String host;
+  uint16_t port = 0;
+  std::unique_ptr<WiFiClient> client;
+  unsigned long lastUse = 0;
+};
+
+// Last address each plain-HTTP host resolved to. lwIP caches lookups only for the
+// record's TTL; when a lookup fails (resolver hiccup after a WiFi reconnect) the
+// previous address is used instead of failing the cover.
+struct DnsEntry {
+  String host;
+  IPAddress ip;
+  unsigned long at = 0;
+};
+
+static Conn s_conns[sys::kHttpKeepAliveHosts];
+static DnsEntry s_dns[4];
+static DownloadStats s_stats;
+// Set by closeIdle() from any task; the download worker drops the connections
+static std::atomic<bool> s_dropAll{false};
+
+static bool resolveHost(const String& host, IPAddress& ip) {
+  if (ip.fromString(host)) return true;
+  DnsEntry* slot = &s_dns[0];
+  for (DnsEntry& e : s_dns) {
+    if (e.host.equalsIgnoreCase(host)) { slot = &e; break; }
+    if (e.at < slot->at) slot = &e;
+  }
+  bool known = slot->host.equalsIgnoreCase(host);
+  if (known && millis() - slot->at < sys::kHttpDnsCacheMs) { ++s_stats.dnsHits; ip = slot->ip; return true; }
+  if (WiFi.hostByName(host.c_str(), ip) == 1 && ip != IPAddress()) {
+    slot->host = host; slot->ip = ip; slot->at = millis();
+    return true;
+  }
+  if (!known) return false;
+  LOGW("DL","DNS lookup of %s failed, using last address %s", host.c_str(), slot->ip.toString().c_str());
+  ++s_stats.dnsHits;
+  ip = slot->ip;
+  return true;
+}
+
+static void dropConn(Conn& c) {
+  if (c.client) { c.client->stop(); c.client.reset(); }
+}
+
+// A kept TLS connection saves a full handshake (hundreds of ms of CPU; sessions are
+// not resumed, ssl_client has no hook for it), so TLS connections stay usable longer
+// and plain ones are evicted first
+static unsigned long idleLimitMs(const Conn& c) {
+  return c.https ? sys::kHttpsKeepAliveIdleMs : sys::kHttpKeepAliveIdleMs;
+}
+
+// Kept-alive connection to u's origin, or a fresh one (evicting the least recently used)
+static Conn* acquireConn(const Url& u, bool& reused) {
+  reused = false;
+  if (s_dropAll.exchange(false)) for (Conn& c : s_conns) dropConn(c);
+  for (Conn& c : s_conns) {
+    if (!c.client || c.https != u.https || c.port != u.port || !c.host.equalsIgnoreCase(u.host)) continue;
+    if (c.client->connected() && millis() - c.lastUse < idleLimitMs(c)) { reused = true; return &c; }
+    dropConn(c); // closed by the server or idle too long
+  }
+  Conn* slot = &s_conns[0];
+  for (Conn& c : s_conns) {
+    if (!c.client) { slot = &c; break; }
+    if (c.https != slot->https ? !c.https : c.lastUse < slot->lastUse) slot = &c;
+  }
+  dropConn(*slot);
+  // connect() with a timeout is not virtual: call it on the concrete client
+  bool connected;
+  unsigned long t0 = millis();
+  if (u.https) {
+    // By name: the hostname is also the SNI, and the resolver runs inside the handshake
+    WiFiClientSecure* s = new WiFiClientSecure();
+    slot->client.reset(s);
+    s->setInsecure();
+    connected = s->connect(u.host.c_str(), u.port, (int32_t)sys::kHttpTimeoutMs);
+    if (connected) { ++s_stats.handshakes; s_stats.handshakeMs += millis() - t0; }
+  } else {
+    IPAddress ip;
+    if (!resolveHost(u.host, ip)) {
+      LOGE("DL","cannot resolve %s", u.host.c_str());
+      return nullptr;
+    }
+    WiFiClient* p = new WiFiClient();
+    slot->client.reset(p);
+    connected = p->connect(ip, u.port, (int32_t)sys::kHttpTimeoutMs);
+    if (connected) p->setNoDelay(true);
+  }
+  if (!connected) {
+    LOGE("DL","connect %s:%u failed", u.host.c_str(), (unsigned)u.port);
+    slot->client.reset();
+    return nullptr;
+  }
+  ++s_stats.connects;
+  slot->https = u.https; slot->host = u.host; slot->port = u.port;
+  return slot;
+}
+
+// One header/chunk-size line without CRLF; fails on close, cancel or no byte for timeoutMs
+static bool readLine(WiFiClient& c, String& line, unsigned long timeoutMs, const CancelToken* cancel) {
+  line = "";
+  unsigned long last = millis();
+  for (;;) {
+    if (CancelToken::isCancelled(cancel)) return false;
+    int ch = c.available() > 0 ? c.read() : -1;
+    if (ch < 0) {
+      if (!c.connected()) return false;
+      if (millis() - last > timeoutMs) return false;
+      delay(2);
+      continue;
+    }
+    last = millis();
+    if (ch == '\n') { if (line.length() && line[line.length() - 1] == '\r') line.remove(line.length() - 1); return true; }
+    if (line.length() >= 1024) return false; // not HTTP
+    line += (char)ch;
+  }
+}
+
+struct Response {
+  int status = 0;
+  bool close = false;       // server will close after this response
+  bool chunked = false;
+  long length = -1;         // Content-Length
+  long rangeStart = -1;     // Content-Range first byte
+  long total = -1;          // Content-Range complete length
+  String location, etag, lastModified;
+  int32_t maxAgeS = -1;
+  bool noStore = false;
+};
+
+static bool readHeaders(WiFiClient& c, Response& rs, const CancelToken* cancel) {
+  String line;
+  if (!readLine(c, line, sys::kHttpTimeoutMs, cancel)) return false;
+  if (!line.startsWith("HTTP/1.")) return false;
+  rs.close = line.startsWith("HTTP/1.0");
+  int sp = line.indexOf(' ');
+  rs.status = sp > 0 ? line.substring(sp + 1).toInt() : 0;
+  for (;;) {
+    if (!readLine(c, line, sys::kHttpInactivityMs, cancel)) return false;
+    if (!line.length()) break;
+    int colon = line.indexOf(':');
+    if (colon <= 0) continue;
+    String name = line.substring(0, colon); name.toLowerCase();
+    String value = line.substring(colon + 1); value.trim();
+    if (name == "content-length") rs.length = value.toInt();
+    else if (name == "transfer-encoding") { value.toLowerCase(); rs.chunked = value.indexOf("chunked") >= 0; }
+    else if (name == "connection") { value.toLowerCase(); if (value.indexOf("close") >= 0) rs.close = true; else if (value.indexOf("keep-alive") >= 0) rs.close = false; }
+    else if (name == "location") rs.location = value;
+    else if (name == "etag") rs.etag = value;
+    else if (name == "last-modified") rs.lastModified = value;
+    else if (name == "cache-control") {
+      value.toLowerCase();
+      int ma = value.indexOf("max-age=");
+      if (ma >= 0) rs.maxAgeS = (int32_t)value.substring(ma + 8).toInt();
+      if (value.indexOf("no-cache") >= 0) rs.maxAgeS = 0;
+      if (value.indexOf("no-store") >= 0) rs.noStore = true;
+    }
+    else if (name == "content-range") {
+      // bytes <start>-<end>/<total|*>
+      int dash = value.indexOf('-'), slash = value.indexOf('/');
+      int bsp = value.indexOf(' ');
+      if (bsp > 0 && dash > bsp) rs.rangeStart = value.substring(bsp + 1, dash).toInt();
+      if (slash > 0 && value[slash + 1] != '*') rs.total = value.substring(slash + 1).toInt();
+    }
+  }
+  if (rs.chunked) rs.length = -1;
+  return rs.status > 0;
+}
+
+enum class BodyEnd { Complete, Stalled, Closed, WriteError, Cancelled };
+
+static const char* bodyEndName(BodyEnd e) {
+  switch (e) {
+    case BodyEnd::Complete: return "complete";
+    case BodyEnd::Stalled: return "stalled";
+    case BodyEnd::Closed: return "connection closed";
+    case BodyEnd::WriteError: return "write error";
+    default: return "cancelled";
+  }
+}
+
+// Appends the response body to f. `reusable` is set when the body ended on a message
+// boundary and the server keeps the connection open.
+static BodyEnd readBody(WiFiClient& c, const Response& rs, File& f, size_t& saved, const CancelToken* cancel, bool& reusable) {
+  reusable = false;
+  const size_t CH = 2048;
+  uint8_t buf[CH];
+  long left = rs.chunked ? 0 : rs.length; // -1: until the server closes
+  bool crlfPending = false;               // CRLF after a chunk's data
+  unsigned long last_rx = millis();
+  String line;
+  for (;;) {
+    if (CancelToken::isCancelled(cancel)) return BodyEnd::Cancelled;
+    if (rs.chunked && left == 0) {
+      if (crlfPending && !readLine(c, line, sys::kHttpInactivityMs, cancel)) break;
+      crlfPending = false;
+      if (!readLine(c, line, sys::kHttpInactivityMs, cancel)) break;
+      long sz = strtol(line.c_str(), nullptr, 16); // chunk extensions after ';' are ignored
+      if (sz < 0) return BodyEnd::Closed;
+      if (sz == 0) {
+        do { if (!readLine(c, line, sys::kHttpInactivityMs, cancel)) break; } while (line.length()); // trailers
+        reusable = !rs.close && !line.length();
+        return BodyEnd::Complete;
+      }
+      left = sz; crlfPending = true;
+      last_rx = millis();
+    }
+    if (!rs.chunked && left == 0) { reusable = !rs.close; return BodyEnd::Complete; }
+    int avail = c.available();
+    if (avail > 0) {
+      size_t want = (size_t)avail < CH ? (size_t)avail : CH;
+      if (left > 0 && (long)want > left) want = (size_t)left;
+      int n = c.read(buf, want);
+      if (n > 0) {
+        if (f.write(buf, (size_t)n) != (size_t)n) return BodyEnd::WriteError;
+        saved += (size_t)n;
+        if (left > 0) left -= n;
+        last_rx = millis();
+        continue;
+      }
+    }
+    if (!c.connected() && c.available() <= 0) {
+      if (!rs.chunked && left < 0) return BodyEnd::Complete; // length given by close
+      return BodyEnd::Closed;
+    }
+    if (millis() - last_rx > sys::kHttpInactivityMs) return BodyEnd::Stalled;
+    delay(5);
+  }
+  if (CancelToken::isCancelled(cancel)) return BodyEnd::Cancelled;
+  return c.connected() ? BodyEnd::Stalled : BodyEnd::Closed;
+}
+
+// Caching headers of rs; a 304 may omit unchanged fields, so start from what we had
+static void recordMeta(const String& url, const Response& rs, HttpCacheMeta& meta) {
+  meta.url = url;
+  if (rs.etag.length()) meta.etag = rs.etag;
+  if (rs.lastModified.length()) meta.lastModified = rs.lastModified;
+  if (rs.maxAgeS >= 0 || rs.status != 304) meta.maxAgeS = rs.maxAgeS;
+  meta.noStore = rs.noStore;
+}
+
+} // namespace
+
+bool Downloader::downloadToFile(const String& url, const char* path, const CancelToken* cancel) {
+  ArtFetch fetch;
+  fetch.cancel = cancel;
+  return downloadToFile(url, path, fetch);
+}
+
+bool Downloader::downloadToFile(const String& url, const char* path, ArtFetch& fetch) {
+  using namespace sys;
+  const CancelToken* cancel = fetch.cancel;
+  unsigned long t0 = millis();
+  ++s_stats.downloads;
+  fetch.notModified = false;
+  File f; // opened on the first body, so a 304 leaves the file untouched
+
+  String cur = url;
+  String validator;          // ETag or Last-Modified of the partial body, for If-Range
+  size_t saved = 0;
+  long total = -1;
+  int attempts = 0, redirects = 0, resumes = 0;
+  bool ok = false, fatal = false;
+  while (!ok && !fatal && attempts < (int)kHttpMaxAttempts) {
+    if (CancelToken::isCancelled(cancel)) break;
+    Url u;
+    if (!parseUrl(cur, u)) { LOGE("DL","bad URL %s", cur.c_str()); break; }
+    bool reused = false;
+    Conn* cn = acquireConn(u, reused);
+    if (!cn) { ++attempts; ++s_stats.retries; delay(250 * attempts); continue; }
+    WiFiClient& c = *cn->client;
+
+    String req = "GET " + u.path + " HTTP/1.1\r\nHost: " + u.host;
+    if (u.port != (u.https ? 443 : 80)) req += ":" + String(u.port);
+    req += "\r\nUser-Agent: ESP32-Sonos/1.0\r\nAccept-Encoding: identity\r\nConnection: keep-alive\r\n";
+    const HttpCacheMeta& cond = fetch.ifCached;
+    const bool conditional = saved == 0 && cond.hasValidator() && cond.url == cur;
+    if (saved > 0) {
+      req += "Range: bytes=" + String((unsigned long)saved) + "-\r\n";
+      if (validator.length()) req += "If-Range: " + validator + "\r\n";
+    } else if (conditional) {
+      if (cond.etag.length()) req += "If-None-Match: " + cond.etag + "\r\n";
+      if (cond.lastModified.length()) req += "If-Modified-Since: " + cond.lastModified + "\r\n";
+      ++s_stats.conditional;
+    }
+    req += "\r\n";
+    ++s_stats.requests;
+    if (reused) ++s_stats.reused;
+    Response rs;
+    unsigned long sent = millis();
+    if (c.print(req) != req.length() || !readHeaders(c, rs, cancel)) {
+      dropConn(*cn);
+      if (CancelToken::isCancelled(cancel)) break;
+      if (reused) continue; // server dropped the idle connection: retry on a fresh one
+      LOGW("DL","no response from %s", u.host.c_str());
+      ++attempts; ++s_stats.retries; delay(250 * attempts);
+      continue;
+    }
+    s_stats.ttfbMs += millis() - sent;
+    ++s_stats.responses;
+
+    if (rs.status == 301 || rs.status == 302 || rs.status == 303 || rs.status == 307 || rs.status == 308) {
+      dropConn(*cn);
+      if (!rs.location.length() || ++redirects > 5) { LOGE("DL","redirect without target or loop"); break; }
+      cur = resolveLocation(u, rs.location);
+      LOGI("DL","redirect %d -> %s", rs.status, cur.c_str());
+      if (saved) { f.close(); saved = 0; validator = ""; total = -1; }
+      continue;
+    }
+    if (rs.status == 304 && conditional) {
+      // Bodiless by definition; the connection stays usable
+      if (rs.close) dropConn(*cn); else cn->lastUse = millis();
+      fetch.meta = cond;
+      recordMeta(cur, rs, fetch.meta);
+      fetch.notModified = true;
+      ++s_stats.notModified;
+      ok = true;
+      break;
+    }
+    if (rs.status == 416 && saved > 0 && total >= 0 && (long)saved >= total) { dropConn(*cn); ok = true; break; }
+    if (rs.status == 206 && saved > 0 && rs.rangeStart == (long)saved) {
+      ++s_stats.resumed; ++resumes;
+      LOGI("DL","resuming at %u/%ld", (unsigned)saved, total);
+    } else if (rs.status == 200 || (rs.status == 206 && rs.rangeStart <= 0)) {
+      if (saved) { // representation changed or ranges unsupported: start over
+        LOGW("DL","server ignored Range (HTTP %d), restarting", rs.status);
+        f.close();
+        saved = 0;
+      }
+    } else {
+      LOGE("DL","HTTP %d from %s", rs.status, u.host.c_str());
+      dropConn(*cn);
+      if (rs.status >= 500) { ++attempts; ++s_stats.retries; delay(250 * attempts); continue; }
+      break; // client errors do not improve on retry
+    }
+    if (!f) {
+      f = SPIFFS.open(path, FILE_WRITE);
+      if (!f) { LOGE("DL","SPIFFS open %s failed", path); dropConn(*cn); break; }
+    }
+    if (rs.total >= 0) total = rs.total;
+    else if (rs.length >= 0) total = (long)saved + rs.length;
+    if (rs.etag.length()) validator = rs.etag;
+    else if (rs.lastModified.length()) validator = rs.lastModified;
+    if (saved == 0) { fetch.meta = HttpCacheMeta(); recordMeta(cur, rs, fetch.meta); }
+
+    bool reusable = false;
+    size_t before = saved;
+    BodyEnd end = readBody(c, rs, f, saved, cancel, reusable);
+    s_stats.bytes += saved - before;
+    if (end == BodyEnd::Complete && reusable) cn->lastUse = millis();
+    else dropConn(*cn);
+
+    if (end == BodyEnd::Complete) {
+      ok = total < 0 || (long)saved == total;
+      if (!ok) { LOGW("DL","short body %u/%ld", (unsigned)saved, total); ++attempts; ++s_stats.retries; }
+      continue;
+    }
+    if (end == BodyEnd::Cancelled) break;
+    if (end == BodyEnd::WriteError) { LOGE("DL","SPIFFS write failed (full?)"); fatal = true; continue; }
+    LOGW("DL","%s after %u/%ld bytes, will resume", bodyEndName(end), (unsigned)saved, total);
+    ++attempts; ++s_stats.retries;
+  }
+  if (f) f.close();
+
+  unsigned long dt = millis() - t0;
+  s_stats.ms += dt;
+  if (CancelToken::isCancelled(cancel)) { LOGI("DL","cancelled after %u/%ld bytes", (unsigned)saved, total); return false; }
+  if (ok && fetch.notModified) {
+    LOGI("DL","304 not modified in %lu ms: %s | total cond=%u hit=%u", dt, fetch.meta.url.c_str(),
+         (unsigned)s_stats.conditional, (unsigned)s_stats.notModified);
+    return true;
+  }
+  ok = ok && saved > 0;
+  if (!ok) { ++s_stats.failures; LOGE("DL","failed after %d attempts (%u/%ld bytes)", attempts, (unsigned)saved, total); return false; }
+  LOGI("DL","saved %u bytes to %s in %lu ms (%lu KB/s, %d resumes) | total req=%u reused=%u resumed=%u retries=%u fail=%u",
+       (unsigned)saved, path, dt, dt ? (unsigned long)(saved / dt) : 0UL, resumes,
+       (unsigned)s_stats.requests, (unsigned)s_stats.reused, (unsigned)s_stats.resumed, (unsigned)s_stats.retries, (unsigned)s_stats.failures);
+  LOGI("DL","connects=%u tls=%u (avg %lu ms) avg ttfb=%lu ms",
+       (unsigned)s_stats.connects, (unsigned)s_stats.handshakes,
+       s_stats.handshakes ? (unsigned long)(s_stats.handshakeMs / s_stats.handshakes) : 0UL,
+       s_stats.responses ? (unsigned long)(s_stats.ttfbMs / s_stats.responses) : 0UL);
+  return true;
+}
+
+bool Downloader::downloadArtToFile(const String& url, const char* path, const CancelToken* cancel) {
+  ArtFetch fetch;
+  fetch.cancel = cancel;
+  return downloadArtToFile(url, path, fetch);
+}
+
+bool Downloader::downloadArtToFile(const String& url, const char* path, ArtFetch& fetch) {
+  String eff = UrlRewriter::rewrite(url);
+  unsigned long t0 = millis();
+  if (eff != url) {
+    LOGI("DL","rewrite %s -> %s", url.c_str(), eff.c_str());
+    if (downloadToFile(eff, path, fetch)) { if (!fetch.notModified) logResult(path, t0, "rewritten"); return true; }
+    if (CancelToken::isCancelled(fetch.cancel)) return false;
+    LOGW("DL","rewritten URL failed, retrying original");
+    if (SPIFFS.exists(path)) SPIFFS.remove(path);
+  }
+  bool ok = downloadToFile(url, path, fetch);
+  if (ok && !fetch.notModified) logResult(path, t0, "original");
+  return ok;
+}
+
+const DownloadStats& Downloader::stats() { return s_stats; }
+
+void Downloader::closeIdle() {
+  s_dropAll = true;
+}
+
+void Downloader::logResult(const char* path, unsigned long t0, const char* which) {
+  File f = SPIFFS.open(path, FILE_READ);
+  int sz = f ? (int)f.size() : -1; if (f) f.close();
+  LOGI("DL","%s: %d bytes in %lu ms", which, sz, millis() - t0);
+}
+
+} // namespace albumart
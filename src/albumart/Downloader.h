@@ -1,72 +1,77 @@
 #pragma once
 #include <Arduino.h>
-#include <HTTPClient.h>
-#include <WiFiClient.h>
-#include <WiFiClientSecure.h>
-#include <FS.h>
-#include <SPIFFS.h>
-#include <memory>
-#include "base/Config.h"
-#include "base/Log.h"
+#include "albumart/CancelToken.h"
 
 namespace albumart {
 
+// Caching headers of a response, kept with a cached cover to revalidate it later
+struct HttpCacheMeta {
+  String url;               // URL the validators belong to (after rewriting/redirects)
+  String etag;
+  String lastModified;
+  int32_t maxAgeS = -1;     // Cache-Control max-age; -1 absent, 0 for no-cache
+  bool noStore = false;     // Cache-Control no-store: do not keep the cover
+
+  bool hasValidator() const { return etag.length() || lastModified.length(); }
+};
+
+// One album-art fetch. With `ifCached` validators set the request is conditional; a
+// 304 answer sets notModified and leaves the target file alone.
+struct ArtFetch {
+  const CancelToken* cancel = nullptr;
+  HttpCacheMeta ifCached;
+  HttpCacheMeta meta;       // filled from the final response
+  bool notModified = false;
+};
+
+// Counters since boot
+struct DownloadStats {
+  uint32_t downloads = 0;   // downloadToFile calls
+  uint32_t failures = 0;    // downloads given up
+  uint32_t requests = 0;    // HTTP requests sent (redirects and resumes included)
+  uint32_t reused = 0;      // requests sent on a kept-alive connection
+  uint32_t resumed = 0;     // Range requests continuing a partial body
+  uint32_t retries = 0;     // attempts after a stall, reset or short body
+  uint32_t conditional = 0; // requests carrying If-None-Match/If-Modified-Since
+  uint32_t notModified = 0; // 304 answers (cached cover still current)
+  uint32_t connects = 0;    // new connections (TCP, plus TLS for https)
+  uint32_t handshakes = 0;  // TLS handshakes completed
+  uint32_t handshakeMs = 0; // time spent connecting https hosts, DNS + TCP + TLS
+  uint32_t dnsHits = 0;     // plain-HTTP connects served from the address cache
+  uint32_t responses = 0;   // response heads received
+  uint32_t ttfbMs = 0;      // request sent -> response head read, summed over responses
+  uint64_t bytes = 0;       // body bytes stored
+  uint32_t ms = 0;          // wall time spent downloading
+};
+
+// Minimal HTTP/1.1 GET client for album art. Keeps one connection per host alive
+// between downloads (covers from the speaker's /getaa come from the same host every
+// track; a kept TLS connection saves the handshake for https CDNs), understands
+// chunked bodies and follows redirects. A stalled or reset
+// transfer is resumed with a Range request (If-Range guarded) instead of starting over.
+// Used by the album-art download worker only; not thread-safe.
 class Downloader {
 public:
-  // Returns true on success; saves to SPIFFS path
-  static bool downloadToFile(const String& url, const char* path) {
-    using namespace sys;
-    HTTPClient http;
-    bool begun = false;
-    std::unique_ptr<WiFiClientSecure> httpsCli;
-    if (url.startsWith("https://")) {
-      httpsCli.reset(new WiFiClientSecure());
-      httpsCli->setInsecure();
-      begun = http.begin(*httpsCli, url);
-    } else {
-      begun = http.begin(url);
-    }
-    if (!begun) { LOGE("DL","begin failed"); return false; }
-    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-    http.setReuse(false);
-    // Align with foreground downloader: force HTTP/1.0 for reliable Content-Length
-    http.useHTTP10(true);
-    // Be explicit about closing and a UA some CDNs like
-    http.addHeader("Connection", "close");
-    http.setUserAgent("ESP32-Sonos/1.0");
-    http.setTimeout(kHttpTimeoutMs);
-    int code = http.GET();
-    if (code != HTTP_CODE_OK) { LOGE("DL","HTTP %d %s", code, http.errorToString(code).c_str()); http.end(); return false; }
-    int total = http.getSize();
-    File f = SPIFFS.open(path, FILE_WRITE);
-    if (!f) { LOGE("DL","SPIFFS open %s failed", path); http.end(); return false; }
+  // Returns true on success; saves to SPIFFS path. A cancelled token stops the
+  // transfer at the next read and returns false.
+  static bool downloadToFile(const String& url, const char* path, const CancelToken* cancel = nullptr);
+
+  // Same, recording caching headers and sending validators from fetch.ifCached
+  static bool downloadToFile(const String& url, const char* path, ArtFetch& fetch);
+
+  // Album art: fetch the right-sized variant of known sources first, then fall back
+  // to the original URL if the rewritten one fails
+  static bool downloadArtToFile(const String& url, const char* path, const CancelToken* cancel = nullptr);
+  static bool downloadArtToFile(const String& url, const char* path, ArtFetch& fetch);
 
-    // Read like the foreground path (robust on i.scdn.co)
-    const size_t CH = 2048;
-    uint8_t buf[CH];
-    WiFiClient* stream = http.getStreamPtr();
-    size_t saved = 0;
-    unsigned long last_rx = millis();
-    while (true) {
-      int avail = stream ? stream->available() : 0;
-      if (avail > 0) {
-        size_t to_read = (avail > (int)CH) ? CH : (size_t)avail;
-        int n = stream->readBytes((char*)buf, to_read);
-        if (n > 0) { f.write(buf, n); saved += (size_t)n; last_rx = millis(); }
-      } else {
-        // No data pending, check end conditions
-        if (total >= 0 && (int)saved >= total) break; // read expected bytes
-        if ((!http.connected()) && (!avail)) break;   // connection closed
-        if (millis() - last_rx > kHttpInactivityMs) break; // inactivity timeout
-        delay(10);
-      }
-    }
-    f.close();
-    LOGI("DL","saved %u/%d to %s", (unsigned)saved, total, path);
-    http.end();
-    return saved > 0 && (total < 0 || (int)saved == total);
-  }
+  static const DownloadStats& stats();
+
+  // Kept-alive connections are dropped before the next request instead of being
+  // reused (their sockets died with the WiFi link). Safe from any task.
+  static void closeIdle();
+
+private:
+  static void logResult(const char* path, unsigned long t0, const char* which);
 };
 
 } // namespace albumart
-
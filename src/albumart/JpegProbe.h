@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+namespace albumart {
+
+struct JpegInfo {
+  bool ok = false;
+  bool progressive = false;   // SOF2 (progressive, Huffman)
+  int sof = 0;                // SOF marker byte (0xC0, 0xC1, 0xC2, ...)
+  int w = 0, h = 0;
+  int components = 0;
+  int mcuW = 8, mcuH = 8;     // MCU size from the largest sampling factors
+  int restartInterval = 0;    // DRI in MCUs, 0 when absent
+  int orientation = 1;        // EXIF orientation 1..8
+  size_t sosOffset = 0;       // offset of the first SOS marker
+};
+
+// One pass over the JPEG marker segments up to the first scan. Reads the frame header,
+// DRI and the EXIF orientation tag so the caller can pick a backend up front without
+// opening a decoder.
+inline JpegInfo probeJpeg(const uint8_t* d, size_t n) {
+  JpegInfo info;
+  if (!d || n < 4 || d[0] != 0xFF || d[1] != 0xD8) return info;
+  size_t i = 2;
+  while (i + 4 <= n) {
+    if (d[i] != 0xFF) break;
+    uint8_t m = d[i + 1];
+    if (m == 0xFF) { ++i; continue; }                       // fill byte
+    if (m == 0xD8 || (m >= 0xD0 && m <= 0xD7)) { i += 2; continue; }
+    if (m == 0xD9) break;
+    size_t len = (size_t)((d[i + 2] << 8) | d[i + 3]);
+    const uint8_t* s = d + i + 4;
+    if (len < 2 || i + 2 + len > n) break;
+    size_t sl = len - 2;
+    if (m == 0xDA) { info.sosOffset = i; break; }
+    if (m >= 0xC0 && m <= 0xCF && m != 0xC4 && m != 0xC8 && m != 0xCC) {
+      if (sl < 6) break;
+      info.sof = m;
+      info.progressive = (m == 0xC2);
+      info.h = (s[1] << 8) | s[2];
+      info.w = (s[3] << 8) | s[4];
+      info.components = s[5];
+      int hmax = 1, vmax = 1;
+      for (int c = 0; c < info.components && 6 + 3 * (size_t)c + 2 < sl; ++c) {
+        int hs = s[7 + 3 * c] >> 4, vs = s[7 + 3 * c] & 15;
+        if (hs > hmax) hmax = hs;
+        if (vs > vmax) vmax = vs;
+      }
+      if (info.components == 1) hmax = vmax = 1; // single component: MCU is one block
+      info.mcuW = 8 * hmax; info.mcuH = 8 * vmax;
+    } else if (m == 0xDD && sl >= 2) {
+      info.restartInterval = (s[0] << 8) | s[1];
+    } else if (m == 0xE1 && sl >= 14 && s[0] == 'E' && s[1] == 'x' && s[2] == 'i' && s[3] == 'f' && s[4] == 0 && s[5] == 0) {
+      // TIFF header, IFD0 entries; orientation is tag 0x0112 (SHORT)
+      const uint8_t* t = s + 6; size_t tl = sl - 6;
+      bool le = (t[0] == 'I');
+      auto u16 = [&](size_t o) -> uint32_t { return le ? (t[o] | (t[o+1] << 8)) : ((t[o] << 8) | t[o+1]); };
+      auto u32 = [&](size_t o) -> uint32_t { return le ? (u16(o) | (u16(o+2) << 16)) : ((u16(o) << 16) | u16(o+2)); };
+      if ((t[0] == 'I' || t[0] == 'M') && t[0] == t[1]) {
+        size_t ifd = u32(4);
+        if (ifd + 2 <= tl) {
+          size_t cnt = u16(ifd);
+          for (size_t e = 0; e < cnt && ifd + 2 + e * 12 + 12 <= tl; ++e) {
+            size_t o = ifd + 2 + e * 12;
+            if (u16(o) == 0x0112) {
+              int v = (int)u16(o + 8);
+              if (v >= 1 && v <= 8) info.orientation = v;
+              break;
+            }
+          }
+        }
+      }
+    }
+    i += 2 + len;
+  }
+  info.ok = info.sof != 0 && info.w > 0 && info.h > 0;
+  return info;
+}
+
+} // namespace albumart
@@ -0,0 +1,98 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "albumart/JpegProbe.h"
+
+namespace albumart {
+
+// Rows of a baseline JPEG with restart markers, rebuilt as a standalone JPEG that
+// starts at an MCU row boundary. Used to skip intervals above the visible window and
+// to hand the lower half of an image to a second decoder.
+struct JpegBand {
+  int startY = 0;              // first source row covered by `data`
+  std::vector<uint8_t> data;   // headers (SOF height patched) + tail of the scan
+};
+
+// True when the file can be cut at restart-interval boundaries
+inline bool jpegSplittable(const JpegInfo& info) {
+  return info.ok && !info.progressive && info.restartInterval > 0 && info.sosOffset;
+}
+
+inline int jpegMcuCols(const JpegInfo& info) { return (info.w + info.mcuW - 1) / info.mcuW; }
+inline int jpegMcuRows(const JpegInfo& info) { return (info.h + info.mcuH - 1) / info.mcuH; }
+
+// MCU row r starts a restart interval
+inline bool jpegRowCuttable(const JpegInfo& info, int r) {
+  return r >= 0 && r < jpegMcuRows(info) && ((long)r * jpegMcuCols(info)) % info.restartInterval == 0;
+}
+
+// Last cuttable MCU row at or before r (row 0 always qualifies)
+inline int jpegCutAtOrBefore(const JpegInfo& info, int r) {
+  if (!jpegSplittable(info)) return 0;
+  for (; r > 0; --r) if (jpegRowCuttable(info, r)) return r;
+  return 0;
+}
+
+// Cuttable MCU row nearest `target` strictly inside (lo, hi), -1 if none
+inline int jpegCutNear(const JpegInfo& info, int target, int lo, int hi) {
+  if (!jpegSplittable(info)) return -1;
+  for (int delta = 0; delta < hi - lo; ++delta) {
+    for (int r : { target - delta, target + delta }) {
+      if (r > lo && r < hi && jpegRowCuttable(info, r)) return r;
+    }
+  }
+  return -1;
+}
+
+// Copies the headers plus the scan from MCU row `row` (a cuttable row > 0), patching
+// the frame height and renumbering RST markers from RST0 so the band decodes alone.
+inline bool buildJpegBand(const uint8_t* d, size_t n, const JpegInfo& info, int row, JpegBand& band) {
+  if (!jpegSplittable(info) || row <= 0 || !jpegRowCuttable(info, row)) return false;
+  const long interval = (long)row * jpegMcuCols(info) / info.restartInterval;
+
+  // Find the RST marker that ends interval-1
+  size_t sos = info.sosOffset;
+  if (sos + 4 > n) return false;
+  size_t scan = sos + 2 + (size_t)((d[sos + 2] << 8) | d[sos + 3]);
+  long seen = 0; size_t cut = 0;
+  for (size_t i = scan; i + 1 < n; ++i) {
+    if (d[i] != 0xFF) continue;
+    uint8_t m = d[i + 1];
+    if (m >= 0xD0 && m <= 0xD7) { if (++seen == interval) { cut = i + 2; break; } ++i; }
+    else if (m != 0x00 && m != 0xFF) return false; // EOI or another scan before the cut
+  }
+  if (!cut) return false;
+
+  band.startY = row * info.mcuH;
+  band.data.clear();
+  band.data.reserve(scan + (n - cut) + 2);
+  band.data.insert(band.data.end(), d, d + scan);
+
+  // Patch the frame height in the copied SOF
+  for (size_t i = 2; i + 9 < scan; ) {
+    if (band.data[i] != 0xFF) return false;
+    uint8_t m = band.data[i + 1];
+    if (m == 0xFF) { ++i; continue; }
+    size_t len = (size_t)((band.data[i + 2] << 8) | band.data[i + 3]);
+    if (m >= 0xC0 && m <= 0xC3) {
+      int bh = info.h - band.startY;
+      band.data[i + 5] = (uint8_t)(bh >> 8); band.data[i + 6] = (uint8_t)(bh & 0xFF);
+      break;
+    }
+    i += 2 + len;
+  }
+
+  uint8_t next = 0;
+  for (size_t i = cut; i < n; ++i) {
+    uint8_t b = d[i];
+    band.data.push_back(b);
+    if (b == 0xFF && i + 1 < n) {
+      uint8_t m = d[i + 1];
+      if (m >= 0xD0 && m <= 0xD7) { band.data.push_back((uint8_t)(0xD0 | (next++ & 7))); ++i; }
+    }
+  }
+  return true;
+}
+
+} // namespace albumart
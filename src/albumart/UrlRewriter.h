@@ -0,0 +1,148 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#include "base/Config.h"
+
+namespace albumart {
+
+// Rewrites album-art URLs of known sources so they deliver the smallest variant that
+// still covers the screen (>= minPx). Rules are tried in order, the first match wins;
+// an unmatched URL is returned unchanged. Callers fall back to the original URL when
+// the rewritten one fails to download.
+class UrlRewriter {
+public:
+  // Returns true and sets out when the rule recognizes and rewrites the URL
+  using Rule = bool (*)(const String& in, int minPx, String& out);
+
+  // Register additional rules (call from setup(), not thread-safe)
+  static void addRule(Rule r) { if (r) rules().push_back(r); }
+
+  static String rewrite(const String& url, int minPx = sys::kScreenW) {
+    String out;
+    for (Rule r : rules()) {
+      if (r(url, minPx, out) && out.length() && out != url) return out;
+    }
+    return url;
+  }
+
+  // --- Built-in rules ---------------------------------------------------------
+
+  // Spotify: i.scdn.co/image/ab67616d0000<size><id>, mosaic.scdn.co/<size>/...
+  static bool spotify(const String& in, int minPx, String& out) {
+    static const SizeCode kCodes[] = { {"4851", 64}, {"1e02", 300}, {"b273", 640}, {"82c1", 1000} };
+    int p = in.indexOf("i.scdn.co/image/ab67616d0000");
+    if (p >= 0) {
+      int c = p + 28; // strlen("i.scdn.co/image/ab67616d0000")
+      if ((int)in.length() < c + 4) return false;
+      const char* want = pickCode(kCodes, sizeof(kCodes)/sizeof(kCodes[0]), minPx);
+      if (!want || in.substring(c, c + 4) == want) return false;
+      out = in.substring(0, c) + want + in.substring(c + 4);
+      return true;
+    }
+    p = in.indexOf("mosaic.scdn.co/");
+    if (p >= 0) {
+      int a = p + 15; int b = in.indexOf('/', a);
+      if (b < 0) return false;
+      const char* want = (minPx <= 300) ? "300" : "640";
+      if (in.substring(a, b) == want) return false;
+      out = in.substring(0, a) + want + in.substring(b);
+      return true;
+    }
+    return false;
+  }
+
+  // SoundCloud: ...-<variant>.jpg (large=100, t300x300, crop=400, t500x500, original)
+  static bool soundcloud(const String& in, int minPx, String& out) {
+    static const SizeCode kVariants[] = { {"large", 100}, {"t300x300", 300}, {"crop", 400}, {"t500x500", 500} };
+    if (in.indexOf("sndcdn.com/") < 0) return false;
+    int dot = in.lastIndexOf('.');
+    int dash = in.lastIndexOf('-');
+    if (dot < 0 || dash < 0 || dash > dot || dash < in.lastIndexOf('/')) return false;
+    const char* want = pickCode(kVariants, sizeof(kVariants)/sizeof(kVariants[0]), minPx);
+    if (!want) want = "original";
+    if (in.substring(dash + 1, dot) == want) return false;
+    out = in.substring(0, dash + 1) + want + in.substring(dot);
+    return true;
+  }
+
+  // Apple Music: is<N>-ssl.mzstatic.com/.../<w>x<h>bb.<ext> (server scales to any size)
+  static bool mzstatic(const String& in, int minPx, String& out) {
+    if (in.indexOf("mzstatic.com/") < 0) return false;
+    int slash = in.lastIndexOf('/');
+    int x = in.indexOf('x', slash + 1);
+    if (slash < 0 || x < 0 || !isDigits(in, slash + 1, x)) return false;
+    char seg[24]; snprintf(seg, sizeof(seg), "%dx%dbb.jpg", minPx, minPx);
+    if (in.substring(slash + 1) == seg) return false;
+    out = in.substring(0, slash + 1) + seg;
+    return true;
+  }
+
+  // Deezer: e-cdns-images.dzcdn.net/images/cover/<md5>/<w>x<h>-000000-80-0-0.jpg
+  static bool deezer(const String& in, int minPx, String& out) {
+    static const SizeCode kSizes[] = { {"250x250", 250}, {"500x500", 500}, {"1000x1000", 1000} };
+    if (in.indexOf("dzcdn.net/images/") < 0) return false;
+    int slash = in.lastIndexOf('/');
+    int dash = in.indexOf('-', slash + 1);
+    if (slash < 0 || dash < 0) return false;
+    const char* want = pickCode(kSizes, sizeof(kSizes)/sizeof(kSizes[0]), minPx);
+    if (!want || in.substring(slash + 1, dash) == want) return false;
+    out = in.substring(0, slash + 1) + want + in.substring(dash);
+    return true;
+  }
+
+  // Sonos /getaa?s=1&u=<encoded>: the speaker proxies the original asset and has no
+  // size parameter. When the wrapped URI is a plain http(s) URL of a known CDN, fetch
+  // the right-sized variant directly; service URIs (x-sonos-...) stay on the proxy.
+  static bool sonosGetaa(const String& in, int minPx, String& out) {
+    int p = in.indexOf("/getaa?");
+    if (p < 0) return false;
+    int u = in.indexOf("u=", p);
+    if (u < 0) return false;
+    int e = in.indexOf('&', u);
+    String inner = urlDecode(in.substring(u + 2, e < 0 ? in.length() : e));
+    if (!inner.startsWith("http://") && !inner.startsWith("https://")) return false;
+    for (Rule r : rules()) {
+      if (r == &sonosGetaa) continue;
+      if (r(inner, minPx, out)) return true;
+    }
+    return false;
+  }
+
+private:
+  struct SizeCode { const char* code; int px; };
+
+  static std::vector<Rule>& rules() {
+    static std::vector<Rule> r = { &spotify, &soundcloud, &mzstatic, &deezer, &sonosGetaa };
+    return r;
+  }
+
+  // Smallest variant with px >= minPx (table sorted ascending), nullptr if none
+  static const char* pickCode(const SizeCode* t, size_t n, int minPx) {
+    for (size_t i = 0; i < n; ++i) if (t[i].px >= minPx) return t[i].code;
+    return nullptr;
+  }
+
+  static bool isDigits(const String& s, int a, int b) {
+    if (a >= b) return false;
+    for (int i = a; i < b; ++i) if (s[i] < '0' || s[i] > '9') return false;
+    return true;
+  }
+
+  static String urlDecode(const String& s) {
+    String o; o.reserve(s.length());
+    for (int i = 0; i < (int)s.length(); ++i) {
+      char c = s[i];
+      if (c == '%' && i + 2 < (int)s.length()) {
+        char hex[3] = { s[i+1], s[i+2], 0 };
+        o += (char)strtol(hex, nullptr, 16); i += 2;
+      } else if (c == '+') {
+        o += ' ';
+      } else {
+        o += c;
+      }
+    }
+    return o;
+  }
+};
+
+} // namespace albumart
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <cstddef>
+#include "albumart/CancelToken.h"
 
 struct DecodeResult {
   int w = 0;
@@ -8,10 +9,27 @@ struct DecodeResult {
   bool ok = false;
 };
 
+// Source rectangle that lands inside a w x h target when the image is centered unscaled
+struct SourceRect {
+  int x = 0, y = 0, w = 0, h = 0;
+};
+
+inline SourceRect centeredSourceRect(int srcw, int srch, int w, int h) {
+  SourceRect r;
+  r.x = srcw > w ? (srcw - w) / 2 : 0;  r.w = srcw > w ? w : srcw;
+  r.y = srch > h ? (srch - h) / 2 : 0;  r.h = srch > h ? h : srch;
+  return r;
+}
+
 struct IImageDecoder {
   virtual ~IImageDecoder() {}
   virtual DecodeResult sizeOf(const uint8_t* d, size_t n) = 0;
   // Decode entire image into provided buffer (RGB565). Buffer size must be w*h.
   virtual bool decodeToRGB565(const uint8_t* d, size_t n, uint16_t* out, int w, int h) = 0;
+  // Optional: decoding stops early (and fails) once the token is cancelled
+  void setCancel(const albumart::CancelToken* t) { cancel_ = t; }
+protected:
+  bool cancelled() const { return albumart::CancelToken::isCancelled(cancel_); }
+  const albumart::CancelToken* cancel_ = nullptr;
 };
 
@@ -1,17 +1,32 @@
 #include <Arduino.h>
 #include <JPEGDEC.h>
+#include <memory>
+#include <new>
 #include "IImageDecoder.h"
 
+// JPEGDEC instance and output context are per call (heap, reached via pUser), so
+// decodes on both cores do not share state. Oversized images set a crop area so MCUs
+// outside the visible window are not color-converted or drawn.
 namespace {
-static uint16_t* g_fb = nullptr;
-static int g_fb_w = 0, g_fb_h = 0;
-static int g_off_x = 0, g_off_y = 0;
+
+struct JpegdecCtx {
+  uint16_t* fb = nullptr;
+  int fb_w = 0, fb_h = 0;
+  int off_x = 0, off_y = 0;
+  int crop_x = 0, crop_y = 0; // MCU-aligned crop origin reported by JPEGDEC
+  int rel = -1;               // draw coords crop-relative (1) or image (0), -1 unknown
+  const albumart::CancelToken* cancel = nullptr;
+};
 
 static int draw_cb(JPEGDRAW* p) {
-  if (!g_fb) return 0;
+  JpegdecCtx* c = (JpegdecCtx*)p->pUser;
+  if (!c || !c->fb) return 0;
+  if (albumart::CancelToken::isCancelled(c->cancel)) return 0; // stops JPEGDEC after this MCU row
+  // JPEGDEC versions differ in the origin of cropped draws; the first draw tells
+  if (c->rel < 0) c->rel = (p->x < c->crop_x || p->y < c->crop_y) ? 1 : 0;
   int src_stride = (int)((p->iWidth > 0) ? p->iWidth : p->iWidthUsed);
-  int dx = p->x + g_off_x;
-  int dy = p->y + g_off_y;
+  int dx = p->x + c->off_x + (c->rel ? c->crop_x : 0);
+  int dy = p->y + c->off_y + (c->rel ? c->crop_y : 0);
   int sx_off = 0;
   int sy_off = 0;
   int copy_w = (p->iWidthUsed > 0) ? p->iWidthUsed : p->iWidth;
@@ -21,16 +36,16 @@ static int draw_cb(JPEGDRAW* p) {
   if (dy < 0) { sy_off = -dy; dy = 0; copy_h -= sy_off; }
   if (copy_w <= 0 || copy_h <= 0) return 1;
   // Clip to framebuffer bounds
-  if (dx >= g_fb_w || dy >= g_fb_h) return 1;
-  if (dx + copy_w > g_fb_w) copy_w = g_fb_w - dx;
-  if (dy + copy_h > g_fb_h) copy_h = g_fb_h - dy;
+  if (dx >= c->fb_w || dy >= c->fb_h) return 1;
+  if (dx + copy_w > c->fb_w) copy_w = c->fb_w - dx;
+  if (dy + copy_h > c->fb_h) copy_h = c->fb_h - dy;
   if (copy_w <= 0 || copy_h <= 0) return 1;
   // Source start
   const uint16_t* src = (const uint16_t*)p->pPixels;
   src += sy_off * src_stride + sx_off;
   for (int row = 0; row < copy_h; ++row) {
     const uint16_t* s = src + row * src_stride;
-    uint16_t* d = &g_fb[(dy + row) * g_fb_w + dx];
+    uint16_t* d = &c->fb[(dy + row) * c->fb_w + dx];
     memcpy(d, s, (size_t)copy_w * sizeof(uint16_t));
   }
   return 1;
@@ -41,32 +56,43 @@ class JpegdecBackend : public IImageDecoder {
 public:
   DecodeResult sizeOf(const uint8_t* d, size_t n) override {
     DecodeResult r; if (!d || n < 4) return r;
-    JPEGDEC j; if (j.openRAM((uint8_t*)d, (int)n, nullptr) != JPEG_SUCCESS) return r;
-    r.w = j.getWidth(); r.h = j.getHeight(); r.ok = (r.w > 0 && r.h > 0);
-    j.close(); return r;
+    std::unique_ptr<JPEGDEC> j(new (std::nothrow) JPEGDEC());
+    if (!j || !j->openRAM((uint8_t*)d, (int)n, nullptr)) return r; // open/decode return 1 on success
+    r.w = j->getWidth(); r.h = j->getHeight(); r.ok = (r.w > 0 && r.h > 0);
+    j->close(); return r;
   }
   bool decodeToRGB565(const uint8_t* d, size_t n, uint16_t* out, int w, int h) override {
     if (!d || !out || w <= 0 || h <= 0) return false;
-    JPEGDEC j; if (j.openRAM((uint8_t*)d, (int)n, draw_cb) != JPEG_SUCCESS) return false;
-    j.setPixelType(RGB565_LITTLE_ENDIAN);
+    std::unique_ptr<JPEGDEC> j(new (std::nothrow) JPEGDEC());
+    if (!j) { Serial.println("Jpegdec: alloc failed"); return false; }
+    if (!j->openRAM((uint8_t*)d, (int)n, draw_cb)) { Serial.printf("Jpegdec: open failed err=%d\n", j->getLastError()); return false; }
+    j->setPixelType(RGB565_LITTLE_ENDIAN);
     // Center the image without scaling
-    int srcw = j.getWidth();
-    int srch = j.getHeight();
-    g_off_x = (int)w/2 - srcw/2;
-    g_off_y = (int)h/2 - srch/2;
-    Serial.printf("Jpegdec: decode into %dx%d (src %dx%d, off %d,%d) ...\n", w, h, srcw, srch, g_off_x, g_off_y);
-    g_fb = out; g_fb_w = w; g_fb_h = h;
-    int rc = j.decode(0, 0, 0);
-    int err = j.getLastError();
-    j.close();
-    bool ok = (rc == JPEG_SUCCESS && err == JPEG_SUCCESS);
-    if (!ok) Serial.printf("Jpegdec: decode failed rc=%d err=%d\n", rc, err);
+    JpegdecCtx c;
+    int srcw = j->getWidth();
+    int srch = j->getHeight();
+    c.fb = out; c.fb_w = w; c.fb_h = h;
+    c.cancel = cancel_;
+    c.off_x = (int)w/2 - srcw/2;
+    c.off_y = (int)h/2 - srch/2;
+    SourceRect vis = centeredSourceRect(srcw, srch, w, h);
+    if (vis.w < srcw || vis.h < srch) {
+      j->setCropArea(vis.x, vis.y, vis.w, vis.h);
+      int cw = 0, ch = 0;
+      j->getCropArea(&c.crop_x, &c.crop_y, &cw, &ch);
+    }
+    j->setUserPointer(&c);
+    Serial.printf("Jpegdec: decode into %dx%d (src %dx%d, off %d,%d, crop %d,%d) ...\n", w, h, srcw, srch, c.off_x, c.off_y, c.crop_x, c.crop_y);
+    int rc = j->decode(0, 0, 0);
+    int err = j->getLastError();
+    j->close();
+    bool ok = (rc == 1 && err == JPEG_SUCCESS);
+    if (!ok && cancelled()) Serial.println("Jpegdec: cancelled");
+    else if (!ok) Serial.printf("Jpegdec: decode failed rc=%d err=%d\n", rc, err);
     else Serial.println("Jpegdec: decode OK");
-    g_fb = nullptr; g_fb_w = g_fb_h = 0; g_off_x = g_off_y = 0;
     return ok;
   }
 };
 
 // Factory helper
 extern "C" IImageDecoder* createJpegdecDecoder() { return new JpegdecBackend(); }
-
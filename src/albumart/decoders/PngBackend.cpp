@@ -0,0 +1,75 @@
+#include <Arduino.h>
+#include <PNGdec.h>
+#include <memory>
+#include <new>
+#include "IImageDecoder.h"
+#include "albumart/CoverScaler.h"
+
+// Streaming PNG decode into a w x h RGB565 target via CoverScaler (box-filtered
+// cover fit). Per-line state lives in the instance and reaches the callback via pUser.
+namespace {
+
+struct PngCtx {
+  PNG* png = nullptr;
+  albumart::CoverScaler scaler;
+  std::unique_ptr<uint16_t[]> line; // one source line (RGB565)
+  const albumart::CancelToken* cancel = nullptr;
+};
+
+static int png_line_cb(PNGDRAW* p) {
+  PngCtx* c = (PngCtx*)p->pUser;
+  if (!c) return 0;
+  if (albumart::CancelToken::isCancelled(c->cancel)) return 0; // aborts png->decode
+  if (!c->scaler.wantsRow(p->y)) return 1; // outside visible window
+  c->png->getLineAsRGB565(p, c->line.get(), PNG_RGB565_LITTLE_ENDIAN, 0x00000000); // alpha over black
+  c->scaler.pushRow(p->y, c->line.get(), p->iWidth);
+  return 1;
+}
+
+// IHDR fields straight from the header (PNGdec needs a full open for this)
+static bool png_ihdr(const uint8_t* d, size_t n, int& w, int& h, bool& interlaced) {
+  static const uint8_t kSig[8] = {0x89,0x50,0x4E,0x47,0x0D,0x0A,0x1A,0x0A};
+  if (!d || n < 29 || memcmp(d, kSig, 8) != 0 || memcmp(d + 12, "IHDR", 4) != 0) return false;
+  w = (int)((d[16] << 24) | (d[17] << 16) | (d[18] << 8) | d[19]);
+  h = (int)((d[20] << 24) | (d[21] << 16) | (d[22] << 8) | d[23]);
+  interlaced = d[28] != 0;
+  return w > 0 && h > 0;
+}
+}
+
+class PngBackend : public IImageDecoder {
+public:
+  DecodeResult sizeOf(const uint8_t* d, size_t n) override {
+    DecodeResult r; bool il = false;
+    r.ok = png_ihdr(d, n, r.w, r.h, il);
+    return r;
+  }
+  bool decodeToRGB565(const uint8_t* d, size_t n, uint16_t* out, int w, int h) override {
+    if (!d || !out || w <= 0 || h <= 0) return false;
+    int sw = 0, sh = 0; bool interlaced = false;
+    if (!png_ihdr(d, n, sw, sh, interlaced)) { Serial.println("Png: not a PNG"); return false; }
+    // Adam7 is out of scope: PNGdec cannot decode it, and de-interlacing needs every
+    // pass of the full-size source in RAM (a 1400 px RGBA cover is 7.8 MB) before
+    // the first output row is final. Such covers keep the fallback gradient.
+    if (interlaced) { Serial.println("Png: interlaced (Adam7) PNG not supported, showing fallback"); return false; }
+
+    PngCtx c;
+    std::unique_ptr<PNG> png(new (std::nothrow) PNG());
+    c.line.reset(new (std::nothrow) uint16_t[sw]);
+    if (!png || !c.line || !c.scaler.begin(out, w, h, sw, sh)) { Serial.println("Png: alloc failed"); return false; }
+    c.png = png.get();
+    c.cancel = cancel_;
+
+    if (png->openRAM((uint8_t*)d, (int)n, png_line_cb) != PNG_SUCCESS) { Serial.println("Png: open failed"); return false; }
+    Serial.printf("Png: decode %dx%d (bpp=%d alpha=%d) -> %dx%d window at (%d,%d)\n",
+                  sw, sh, png->getBpp(), png->hasAlpha(), c.scaler.visW(), c.scaler.visH(), c.scaler.dstX(), c.scaler.dstY());
+    int rc = png->decode(&c, 0);
+    png->close();
+    c.scaler.finish();
+    if (cancelled()) { Serial.println("Png: cancelled"); return false; }
+    if (rc != PNG_SUCCESS) { Serial.printf("Png: decode failed rc=%d\n", rc); return false; }
+    return true;
+  }
+};
+
+extern "C" IImageDecoder* createPngDecoder() { return new PngBackend(); }
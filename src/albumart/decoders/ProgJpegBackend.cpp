@@ -0,0 +1,543 @@
+#include <Arduino.h>
+#include <cmath>
+#include <memory>
+#include <new>
+#include "esp_heap_caps.h"
+#include "IImageDecoder.h"
+#include "base/Config.h"
+#include "albumart/CoverScaler.h"
+#include "albumart/JpegProbe.h"
+
+// Progressive (SOF2) JPEG decode at reduced scale. TJpgDec cannot decode progressive
+// files and JPEGDEC only renders their first (DC) scan, so this backend runs all scans
+// itself. Only the top-left k x k coefficients of every block are stored (k = 8, 4, 2
+// or 1) plus a 64-bit nonzero mask that successive-approximation refinement needs for
+// the dropped ones. k is the smallest size whose output still covers the target and is
+// lowered further until the store fits sys::kProgJpegBudget and the largest free PSRAM
+// block (less sys::kProgJpegHeadroom); an allocation that still fails is retried at
+// the next lower k. The reduced image is then box-filtered into the target by
+// CoverScaler, or enlarged when memory forced it below the target size.
+namespace {
+
+// Zigzag index -> natural (row-major) index, padded for malformed run lengths
+static const uint8_t kNatural[64 + 16] = {
+   0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63 };
+
+struct BitReader {
+  const uint8_t* p = nullptr; const uint8_t* end = nullptr;
+  uint32_t acc = 0; int bits = 0; bool marker = false;
+
+  void reset(const uint8_t* at, const uint8_t* e) { p = at; end = e; acc = 0; bits = 0; marker = false; }
+  // Keeps >= 25 bits MSB-aligned in acc; feeds zeros once a marker is reached
+  void fill() {
+    while (bits <= 24) {
+      uint32_t b = 0;
+      if (!marker && p < end) {
+        b = *p;
+        if (b == 0xFF) {
+          uint8_t nx = (p + 1 < end) ? p[1] : 0xD9;
+          if (nx == 0x00) p += 2; else { marker = true; b = 0; }
+        } else {
+          ++p;
+        }
+      }
+      acc |= b << (24 - bits); bits += 8;
+    }
+  }
+  uint32_t get(int n) { if (!n) return 0; fill(); uint32_t v = acc >> (32 - n); acc <<= n; bits -= n; return v; }
+  // Position of the next marker (0xFF followed by a non-zero byte)
+  const uint8_t* nextMarker() const {
+    const uint8_t* q = p;
+    while (q + 1 < end && !(q[0] == 0xFF && q[1] != 0x00)) ++q;
+    return q;
+  }
+};
+
+static inline int extend(int v, int s) { return (v < (1 << (s - 1))) ? v - (1 << s) + 1 : v; }
+
+struct Huff {
+  uint8_t fast_len[512]; uint8_t fast_sym[512]; // 9-bit lookahead
+  int32_t maxcode[17]; int32_t mincode[17]; int valptr[17];
+  uint8_t syms[256];
+  bool ok = false;
+
+  bool build(const uint8_t* counts, const uint8_t* s, int nsyms) {
+    if (nsyms > 256) return false;
+    memcpy(syms, s, (size_t)nsyms);
+    memset(fast_len, 0, sizeof(fast_len));
+    int code = 0, k = 0;
+    for (int l = 1; l <= 16; ++l) {
+      int c = counts[l - 1];
+      valptr[l] = k; mincode[l] = code;
+      maxcode[l] = c ? code + c - 1 : -1;
+      if (l <= 9) {
+        for (int i = 0; i < c; ++i) {
+          int shift = 9 - l, base = (code + i) << shift;
+          for (int j = 0; j < (1 << shift); ++j) { fast_len[base | j] = (uint8_t)l; fast_sym[base | j] = syms[k + i]; }
+        }
+      }
+      code += c; k += c;
+      if (code > (1 << l)) return false;
+      code <<= 1;
+    }
+    ok = true;
+    return true;
+  }
+
+  int decode(BitReader& br) const {
+    br.fill();
+    uint32_t look = br.acc >> 23;
+    int l = fast_len[look];
+    if (l) { br.acc <<= l; br.bits -= l; return fast_sym[look]; }
+    for (l = 10; l <= 16; ++l) {
+      int32_t code = (int32_t)(br.acc >> (32 - l));
+      if (maxcode[l] >= 0 && code <= maxcode[l]) {
+        br.acc <<= l; br.bits -= l;
+        return syms[valptr[l] + code - mincode[l]];
+      }
+    }
+    return -1;
+  }
+};
+
+struct Comp {
+  int id = 0, h = 1, v = 1, tq = 0;
+  int bw = 0, bh = 0;    // block grid padded to whole MCUs
+  int cbw = 0, cbh = 0;  // blocks actually covered by the component
+  int16_t* coef = nullptr;
+  uint64_t* nz = nullptr;
+  int dc_pred = 0, td = 0, ta = 0;
+};
+
+// No fallback to internal RAM: a store that does not fit PSRAM would starve WiFi there
+static void* psram_alloc(size_t n) {
+  void* p = heap_caps_malloc(n, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (p) memset(p, 0, n);
+  return p;
+}
+
+// Store size the PSRAM can take right now: the slab pool, the cover cache and the
+// downloaded body already live there
+static size_t store_cap() {
+  size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  size_t cap = largest > sys::kProgJpegHeadroom ? largest - sys::kProgJpegHeadroom : 0;
+  return cap < sys::kProgJpegBudget ? cap : sys::kProgJpegBudget;
+}
+
+class ProgDecoder {
+public:
+  ~ProgDecoder() { freeStore(); }
+
+  bool decode(const uint8_t* d, size_t n, albumart::CoverScaler& scaler, uint16_t* out, int ow, int oh,
+              const albumart::CancelToken* cancel = nullptr) {
+    cancel_ = cancel;
+    if (!d || n < 4 || d[0] != 0xFF || d[1] != 0xD8) return false;
+    const uint8_t* p = d + 2; const uint8_t* end = d + n;
+    while (p < end) {
+      if (*p != 0xFF) { ++p; continue; }
+      while (p < end && *p == 0xFF) ++p;
+      if (p >= end) break;
+      uint8_t m = *p++;
+      if (m == 0xD9) break;
+      if (m == 0xD8 || (m >= 0xD0 && m <= 0xD7)) continue;
+      if (p + 2 > end) break;
+      int len = (p[0] << 8) | p[1];
+      const uint8_t* seg = p + 2; int seglen = len - 2;
+      if (len < 2 || p + len > end) { err_ = "truncated segment"; break; }
+      bool ok = true;
+      switch (m) {
+        case 0xC2: ok = parseSOF(seg, seglen, ow, oh); break;
+        case 0xC4: ok = parseDHT(seg, seglen); break;
+        case 0xDB: ok = parseDQT(seg, seglen); break;
+        case 0xDD: ri_ = (seglen >= 2) ? ((seg[0] << 8) | seg[1]) : 0; break;
+        case 0xDA: {
+          if (!coefReady_ || !parseSOS(seg, seglen)) { ok = false; break; }
+          br_.reset(p + len, end);
+          bool scan_ok = decodeScan();
+          if (cancelled()) { err_ = "cancelled"; return false; }
+          if (scan_ok) ++scans_;
+          p = br_.nextMarker();
+          if (!scan_ok) { err_ = "corrupt scan"; goto done; }
+          continue;
+        }
+        default:
+          if (m >= 0xC0 && m <= 0xCF && m != 0xC4 && m != 0xC8 && m != 0xCC) { err_ = "not progressive"; ok = false; }
+          break;
+      }
+      if (!ok) { if (!err_) err_ = "bad segment"; return false; }
+      p += len;
+    }
+done:
+    // A truncated or damaged tail still renders the scans decoded so far
+    if (!scans_) { if (!err_) err_ = "no scans"; return false; }
+    return render(scaler, out, ow, oh);
+  }
+
+  const char* error() const { return err_ ? err_ : "ok"; }
+  int scale() const { return k_; }
+  int width() const { return w_; }
+  int height() const { return h_; }
+  int scans() const { return scans_; }
+  size_t storeBytes() const { return store_; }
+
+private:
+  bool parseSOF(const uint8_t* s, int n, int ow, int oh) {
+    if (n < 6 || coefReady_) return false;
+    if (s[0] != 8) { err_ = "12-bit precision"; return false; }
+    h_ = (s[1] << 8) | s[2]; w_ = (s[3] << 8) | s[4]; ncomp_ = s[5];
+    if (w_ <= 0 || h_ <= 0 || (ncomp_ != 1 && ncomp_ != 3) || n < 6 + 3 * ncomp_) { err_ = "unsupported components"; return false; }
+    hmax_ = vmax_ = 1;
+    for (int i = 0; i < ncomp_; ++i) {
+      Comp& c = comp_[i];
+      c.id = s[6 + i*3]; c.h = s[7 + i*3] >> 4; c.v = s[7 + i*3] & 15; c.tq = s[8 + i*3] & 3;
+      if (c.h < 1 || c.h > 2 || c.v < 1 || c.v > 2) { err_ = "unsupported sampling"; return false; }
+      if (ncomp_ == 1) c.h = c.v = 1;
+      if (c.h > hmax_) hmax_ = c.h;
+      if (c.v > vmax_) vmax_ = c.v;
+    }
+    mcux_ = (w_ + 8 * hmax_ - 1) / (8 * hmax_);
+    mcuy_ = (h_ + 8 * vmax_ - 1) / (8 * vmax_);
+    size_t blocks = 0;
+    for (int i = 0; i < ncomp_; ++i) {
+      Comp& c = comp_[i];
+      c.bw = mcux_ * c.h; c.bh = mcuy_ * c.v;
+      c.cbw = ((w_ * c.h + hmax_ - 1) / hmax_ + 7) / 8;
+      c.cbh = ((h_ * c.v + vmax_ - 1) / vmax_ + 7) / 8;
+      blocks += (size_t)c.bw * c.bh;
+    }
+    // Smallest k whose output still covers the target, then shrink to what PSRAM takes
+    int shortSrc = w_ < h_ ? w_ : h_, shortDst = ow < oh ? ow : oh;
+    const size_t cap = store_cap();
+    k_ = 8;
+    while (k_ > 1 && shortSrc * (k_ / 2) / 8 >= shortDst) k_ /= 2;
+    while (k_ > 1 && blocks * (8 + 2 * k_ * k_) > cap) k_ /= 2;
+    for (;;) {
+      store_ = blocks * (8 + 2 * k_ * k_);
+      if (store_ > cap) { err_ = "coefficient store over budget"; return false; }
+      if (allocStore()) break;
+      freeStore();
+      if (k_ == 1) { err_ = "coefficient alloc failed"; return false; }
+      k_ /= 2; // fragmented PSRAM: a quarter of the store may still fit
+    }
+    for (int z = 0; z < 64; ++z) {
+      int nat = kNatural[z], r = nat >> 3, c = nat & 7;
+      keep_[z] = (r < k_ && c < k_) ? (int8_t)(r * k_ + c) : (int8_t)-1;
+    }
+    coefReady_ = true;
+    return true;
+  }
+
+  bool allocStore() {
+    for (int i = 0; i < ncomp_; ++i) {
+      Comp& c = comp_[i];
+      size_t nb = (size_t)c.bw * c.bh;
+      c.coef = (int16_t*)psram_alloc(nb * k_ * k_ * sizeof(int16_t));
+      c.nz = (uint64_t*)psram_alloc(nb * sizeof(uint64_t));
+      if (!c.coef || !c.nz) return false;
+    }
+    return true;
+  }
+
+  void freeStore() {
+    for (int i = 0; i < ncomp_; ++i) {
+      heap_caps_free(comp_[i].coef); comp_[i].coef = nullptr;
+      heap_caps_free(comp_[i].nz); comp_[i].nz = nullptr;
+    }
+  }
+
+  bool parseDHT(const uint8_t* s, int n) {
+    while (n >= 17) {
+      int tc = s[0] >> 4, th = s[0] & 3;
+      int total = 0; for (int i = 0; i < 16; ++i) total += s[1 + i];
+      if (tc > 1 || n < 17 + total) return false;
+      Huff& hf = tc ? ac_[th] : dc_[th];
+      if (!hf.build(s + 1, s + 17, total)) return false;
+      s += 17 + total; n -= 17 + total;
+    }
+    return true;
+  }
+
+  bool parseDQT(const uint8_t* s, int n) {
+    while (n >= 65) {
+      int pq = s[0] >> 4, tq = s[0] & 3;
+      int need = pq ? 129 : 65;
+      if (n < need) return false;
+      for (int z = 0; z < 64; ++z) q_[tq][kNatural[z]] = pq ? (uint16_t)((s[1 + 2*z] << 8) | s[2 + 2*z]) : s[1 + z];
+      s += need; n -= need;
+    }
+    return true;
+  }
+
+  bool parseSOS(const uint8_t* s, int n) {
+    if (n < 1) return false;
+    ns_ = s[0];
+    if (ns_ < 1 || ns_ > ncomp_ || n < 4 + 2 * ns_) return false;
+    for (int i = 0; i < ns_; ++i) {
+      int cid = s[1 + 2*i], t = s[2 + 2*i];
+      sc_[i] = -1;
+      for (int j = 0; j < ncomp_; ++j) if (comp_[j].id == cid) sc_[i] = j;
+      if (sc_[i] < 0) return false;
+      comp_[sc_[i]].td = t >> 4; comp_[sc_[i]].ta = t & 3;
+    }
+    const uint8_t* t = s + 1 + 2 * ns_;
+    ss_ = t[0]; se_ = t[1]; ah_ = t[2] >> 4; al_ = t[2] & 15;
+    if (ss_ == 0 ? se_ != 0 : (ns_ != 1 || se_ < ss_ || se_ > 63)) return false;
+    for (int i = 0; i < ns_; ++i) {
+      const Comp& c = comp_[sc_[i]];
+      if (ss_ == 0 && ah_ == 0 && !dc_[c.td].ok) return false;
+      if (ss_ > 0 && !ac_[c.ta].ok) return false;
+    }
+    return true;
+  }
+
+  void restart() {
+    const uint8_t* q = br_.nextMarker();
+    if (q + 1 < br_.end && q[1] >= 0xD0 && q[1] <= 0xD7) q += 2;
+    br_.reset(q, br_.end);
+    for (int i = 0; i < ncomp_; ++i) comp_[i].dc_pred = 0;
+    eobrun_ = 0;
+  }
+
+  bool decodeScan() {
+    eobrun_ = 0;
+    for (int i = 0; i < ncomp_; ++i) comp_[i].dc_pred = 0;
+    int mcu = 0;
+    if (ns_ > 1) {
+      for (int my = 0; my < mcuy_; ++my) {
+        if (cancelled()) return false;
+        for (int mx = 0; mx < mcux_; ++mx, ++mcu) {
+          if (ri_ && mcu && (mcu % ri_) == 0) restart();
+          for (int i = 0; i < ns_; ++i) {
+            Comp& c = comp_[sc_[i]];
+            for (int v = 0; v < c.v; ++v)
+              for (int h = 0; h < c.h; ++h)
+                if (!decodeBlock(c, (my * c.v + v) * c.bw + mx * c.h + h)) return false;
+          }
+        }
+      }
+      return true;
+    }
+    Comp& c = comp_[sc_[0]];
+    for (int by = 0; by < c.cbh; ++by) {
+      if (cancelled()) return false;
+      for (int bx = 0; bx < c.cbw; ++bx, ++mcu) {
+        if (ri_ && mcu && (mcu % ri_) == 0) restart();
+        if (!decodeBlock(c, by * c.bw + bx)) return false;
+      }
+    }
+    return true;
+  }
+
+  bool decodeBlock(Comp& c, int b) {
+    int16_t* coef = c.coef + (size_t)b * k_ * k_;
+    uint64_t& nz = c.nz[b];
+    if (ss_ == 0) {
+      if (ah_ == 0) {
+        int s = dc_[c.td].decode(br_);
+        if (s < 0 || s > 11) return false;
+        c.dc_pred += s ? extend((int)br_.get(s), s) : 0;
+        coef[0] = (int16_t)(c.dc_pred * (1 << al_));
+      } else if (br_.get(1)) {
+        coef[0] |= (int16_t)(1 << al_);
+      }
+      return true;
+    }
+    const Huff& hf = ac_[c.ta];
+    if (ah_ == 0) {
+      if (eobrun_) { --eobrun_; return true; }
+      for (int z = ss_; z <= se_; ++z) {
+        int rs = hf.decode(br_);
+        if (rs < 0) return false;
+        int r = rs >> 4, s = rs & 15;
+        if (!s) {
+          if (r < 15) { eobrun_ = (1u << r) - 1; if (r) eobrun_ += br_.get(r); break; }
+          z += 15; continue;
+        }
+        z += r;
+        if (z > 63) return false;
+        nz |= 1ull << z;
+        if (keep_[z] >= 0) coef[keep_[z]] = (int16_t)(extend((int)br_.get(s), s) * (1 << al_));
+        else br_.get(s);
+      }
+      return true;
+    }
+    // AC refinement (successive approximation), mirrors libjpeg decode_mcu_AC_refine
+    int p1 = 1 << al_, m1 = -1 * (1 << al_);
+    int z = ss_;
+    if (!eobrun_) {
+      for (; z <= se_; ++z) {
+        int rs = hf.decode(br_);
+        if (rs < 0) return false;
+        int r = rs >> 4, s = rs & 15;
+        if (s) {
+          s = br_.get(1) ? p1 : m1;
+        } else if (r != 15) {
+          eobrun_ = 1u << r; if (r) eobrun_ += br_.get(r);
+          break;
+        }
+        while (z <= se_) {
+          if (nz & (1ull << z)) {
+            if (br_.get(1)) refine(coef, z, p1, m1);
+          } else if (--r < 0) {
+            break;
+          }
+          ++z;
+        }
+        if (s && z <= 63) {
+          nz |= 1ull << z;
+          if (keep_[z] >= 0) coef[keep_[z]] = (int16_t)s;
+        }
+      }
+    }
+    if (eobrun_) {
+      for (; z <= se_; ++z)
+        if ((nz & (1ull << z)) && br_.get(1)) refine(coef, z, p1, m1);
+      --eobrun_;
+    }
+    return true;
+  }
+
+  inline void refine(int16_t* coef, int z, int p1, int m1) {
+    if (keep_[z] < 0) return; // dropped coefficient: only the bit had to be consumed
+    int16_t& v = coef[keep_[z]];
+    if ((v & p1) == 0) v = (int16_t)(v >= 0 ? v + p1 : v + m1);
+  }
+
+  // Reduced IDCT of one block into k x k samples (point-sampled at sub-block centers)
+  void idct(const Comp& c, const int16_t* coef, uint8_t* dst, int stride) const {
+    const int k = k_;
+    float f[64], tmp[64];
+    for (int v = 0; v < k; ++v)
+      for (int u = 0; u < k; ++u) {
+        int q = q_[c.tq][v * 8 + u];
+        f[v * k + u] = (float)coef[v * k + u] * (float)(q ? q : 1);
+      }
+    for (int v = 0; v < k; ++v) {
+      const float* row = &f[v * k];
+      for (int x = 0; x < k; ++x) {
+        float s = 0; for (int u = 0; u < k; ++u) s += cos_[x * 8 + u] * row[u];
+        tmp[v * k + x] = s;
+      }
+    }
+    for (int y = 0; y < k; ++y) {
+      for (int x = 0; x < k; ++x) {
+        float s = 0; for (int v = 0; v < k; ++v) s += cos_[y * 8 + v] * tmp[v * k + x];
+        int px = (int)lrintf(s * 0.25f) + 128;
+        dst[y * stride + x] = (uint8_t)(px < 0 ? 0 : (px > 255 ? 255 : px));
+      }
+    }
+  }
+
+  bool render(albumart::CoverScaler& scaler, uint16_t* out, int ow, int oh) {
+    const int k = k_;
+    for (int x = 0; x < 8; ++x)
+      for (int u = 0; u < 8; ++u)
+        cos_[x * 8 + u] = (x < k && u < k) ? (float)((u ? 1.0 : M_SQRT1_2) * cos((2 * x + 1) * u * M_PI / (2.0 * k))) : 0.0f;
+    int sw = (w_ * k + 7) / 8, sh = (h_ * k + 7) / 8;
+    // A source that covers the target, reduced below it to fit PSRAM, is enlarged again
+    const bool fill = (w_ < h_ ? w_ : h_) >= (ow < oh ? ow : oh);
+    if (!scaler.begin(out, ow, oh, sw, sh, fill)) { err_ = "scaler alloc failed"; return false; }
+    // One MCU row of component planes plus one RGB565 output row
+    int pw[3], ph[3];
+    std::unique_ptr<uint8_t[]> plane[3];
+    for (int i = 0; i < ncomp_; ++i) {
+      pw[i] = comp_[i].bw * k; ph[i] = comp_[i].v * k;
+      plane[i].reset(new (std::nothrow) uint8_t[(size_t)pw[i] * ph[i]]);
+      if (!plane[i]) { err_ = "plane alloc failed"; return false; }
+    }
+    std::unique_ptr<uint16_t[]> line(new (std::nothrow) uint16_t[sw]);
+    if (!line) { err_ = "line alloc failed"; return false; }
+    const int rowsPerMcu = vmax_ * k;
+    // Columns outside the visible window skip IDCT and color conversion
+    const int x0 = scaler.srcColBegin(), x1 = scaler.srcColEnd();
+    int bx0[3], bx1[3];
+    for (int i = 0; i < ncomp_; ++i) {
+      bx0[i] = (x0 * comp_[i].h / hmax_) / k;
+      bx1[i] = x1 > x0 ? ((x1 - 1) * comp_[i].h / hmax_) / k + 1 : bx0[i];
+    }
+    for (int my = 0; my < mcuy_; ++my) {
+      int y0 = my * rowsPerMcu;
+      if (y0 >= sh) break;
+      bool any = false;
+      for (int r = 0; r < rowsPerMcu && y0 + r < sh; ++r) if (scaler.wantsRow(y0 + r)) { any = true; break; }
+      if (!any) continue; // nothing visible: skip IDCT and color conversion
+      if (cancelled()) { err_ = "cancelled"; return false; }
+      for (int i = 0; i < ncomp_; ++i) {
+        const Comp& c = comp_[i];
+        for (int v = 0; v < c.v; ++v)
+          for (int bx = bx0[i]; bx < bx1[i]; ++bx) {
+            int b = (my * c.v + v) * c.bw + bx;
+            idct(c, c.coef + (size_t)b * k * k, &plane[i][(size_t)v * k * pw[i] + bx * k], pw[i]);
+          }
+      }
+      for (int r = 0; r < rowsPerMcu && y0 + r < sh; ++r) {
+        if (!scaler.wantsRow(y0 + r)) continue;
+        const uint8_t* Y = &plane[0][(size_t)(r * comp_[0].v / vmax_) * pw[0]];
+        if (ncomp_ == 1) {
+          for (int x = x0; x < x1; ++x) { int g = Y[x]; line[x] = (uint16_t)(((g >> 3) << 11) | ((g >> 2) << 5) | (g >> 3)); }
+        } else {
+          const uint8_t* Cb = &plane[1][(size_t)(r * comp_[1].v / vmax_) * pw[1]];
+          const uint8_t* Cr = &plane[2][(size_t)(r * comp_[2].v / vmax_) * pw[2]];
+          for (int x = x0; x < x1; ++x) {
+            int yy = Y[x * comp_[0].h / hmax_] << 10;
+            int cb = Cb[x * comp_[1].h / hmax_] - 128, cr = Cr[x * comp_[2].h / hmax_] - 128;
+            int R = (yy + 1436 * cr + 512) >> 10;
+            int G = (yy - 352 * cb - 731 * cr + 512) >> 10;
+            int B = (yy + 1815 * cb + 512) >> 10;
+            R = R < 0 ? 0 : (R > 255 ? 255 : R); G = G < 0 ? 0 : (G > 255 ? 255 : G); B = B < 0 ? 0 : (B > 255 ? 255 : B);
+            line[x] = (uint16_t)(((R >> 3) << 11) | ((G >> 2) << 5) | (B >> 3));
+          }
+        }
+        scaler.pushRow(y0 + r, line.get(), sw);
+      }
+    }
+    scaler.finish();
+    return true;
+  }
+
+  Comp comp_[3];
+  int ncomp_ = 0, w_ = 0, h_ = 0, hmax_ = 1, vmax_ = 1, mcux_ = 0, mcuy_ = 0;
+  int k_ = 8; size_t store_ = 0;
+  int8_t keep_[64];                   // zigzag index -> stored slot, -1 if dropped
+  uint16_t q_[4][64] = {};            // natural order
+  Huff dc_[4], ac_[4];
+  int ri_ = 0;
+  int ns_ = 0, sc_[3] = {0, 0, 0}, ss_ = 0, se_ = 0, ah_ = 0, al_ = 0;
+  uint32_t eobrun_ = 0;
+  BitReader br_;
+  bool coefReady_ = false;
+  int scans_ = 0;
+  float cos_[64];
+  const char* err_ = nullptr;
+  const albumart::CancelToken* cancel_ = nullptr;
+
+  bool cancelled() const { return albumart::CancelToken::isCancelled(cancel_); }
+};
+}
+
+class ProgJpegBackend : public IImageDecoder {
+public:
+  DecodeResult sizeOf(const uint8_t* d, size_t n) override {
+    DecodeResult r;
+    albumart::JpegInfo info = albumart::probeJpeg(d, n);
+    if (info.ok && info.progressive) { r.w = info.w; r.h = info.h; r.ok = true; }
+    return r;
+  }
+  bool decodeToRGB565(const uint8_t* d, size_t n, uint16_t* out, int w, int h) override {
+    if (!d || !out || w <= 0 || h <= 0) return false;
+    std::unique_ptr<ProgDecoder> dec(new (std::nothrow) ProgDecoder());
+    albumart::CoverScaler scaler;
+    if (!dec) { Serial.println("ProgJpeg: decoder alloc failed"); return false; }
+    bool ok = dec->decode(d, n, scaler, out, w, h, cancel_);
+    if (ok) Serial.printf("ProgJpeg: %dx%d decoded at 1/%d (%d scans, %u KB coefficients)\n",
+                          dec->width(), dec->height(), 8 / dec->scale(), dec->scans(), (unsigned)(dec->storeBytes() / 1024));
+    else Serial.printf("ProgJpeg: decode failed (%s)\n", dec->error());
+    return ok;
+  }
+};
+
+extern "C" IImageDecoder* createProgJpegDecoder() { return new ProgJpegBackend(); }
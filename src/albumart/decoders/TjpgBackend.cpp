@@ -1,74 +1,176 @@
 #include <Arduino.h>
 #include <TJpg_Decoder.h>
+#include <memory>
+#include <new>
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "IImageDecoder.h"
+#include "base/Config.h"
+#include "albumart/JpegProbe.h"
+#include "albumart/JpegSplit.h"
 
+// Baseline JPEG via the tjpgd core directly (jd_prepare/jd_decomp) instead of the
+// global TJpgDec wrapper: the JDEC, its work pool and the output context belong to the
+// call, so several decodes can run at once. Decoding stops below the visible window.
+// Baseline files with restart markers additionally skip whole intervals above the
+// window and split the rest into two bands; the lower one is decoded by a helper task
+// on core 0.
 namespace {
-static uint16_t* g_fb = nullptr; static int g_w=0, g_h=0; static int g_off_x=0, g_off_y=0;
-static bool cb(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t* bmp) {
-  if (!g_fb) return true;
-  int src_stride = (int)w; // original block width
-  // Start positions in destination and offsets into source
-  int dx = x + g_off_x;
-  int dy = y + g_off_y;
-  int sx_off = 0;
-  int sy_off = 0;
-  int copy_w = (int)w;
-  int copy_h = (int)h;
+
+static constexpr size_t kPoolSize = 10 * 1024; // covers JD_FASTDECODE 2 tables
+
+struct TjpgCtx {
+  const uint8_t* src = nullptr; size_t len = 0, pos = 0;
+  uint16_t* fb = nullptr; int w = 0, h = 0;
+  int off_x = 0, off_y = 0;
+  int stop_y = 0x7FFF;  // band-local source row where decoding may stop
+  bool stopped = false;
+  const albumart::CancelToken* cancel = nullptr; // shared by both bands
+};
+
+static size_t in_cb(JDEC* jd, uint8_t* buf, size_t n) {
+  TjpgCtx* c = (TjpgCtx*)jd->device;
+  if (c->pos + n > c->len) n = c->len - c->pos;
+  if (buf) memcpy(buf, c->src + c->pos, n);
+  c->pos += n;
+  return n;
+}
+
+static int out_cb(JDEC* jd, void* bitmap, JRECT* rect) {
+  TjpgCtx* c = (TjpgCtx*)jd->device;
+  if (rect->top >= c->stop_y) { c->stopped = true; return 0; } // past the window: interrupt jd_decomp
+  if (albumart::CancelToken::isCancelled(c->cancel)) return 0;   // superseded: interrupt jd_decomp
+  const uint16_t* bmp = (const uint16_t*)bitmap;
+  int src_stride = rect->right - rect->left + 1;
+  int dx = rect->left + c->off_x;
+  int dy = rect->top + c->off_y;
+  int sx_off = 0, sy_off = 0;
+  int copy_w = src_stride;
+  int copy_h = rect->bottom - rect->top + 1;
   // Handle negative dest coords by skipping pixels/rows from source
   if (dx < 0) { sx_off = -dx; dx = 0; copy_w -= sx_off; }
   if (dy < 0) { sy_off = -dy; dy = 0; copy_h -= sy_off; }
-  if (copy_w <= 0 || copy_h <= 0) return true;
+  if (copy_w <= 0 || copy_h <= 0) return 1;
   // Clip to framebuffer bounds
-  if (dx >= g_w || dy >= g_h) return true;
-  if (dx + copy_w > g_w) copy_w = g_w - dx;
-  if (dy + copy_h > g_h) copy_h = g_h - dy;
-  if (copy_w <= 0 || copy_h <= 0) return true;
-  // Source start pointer after skips
+  if (dx >= c->w || dy >= c->h) return 1;
+  if (dx + copy_w > c->w) copy_w = c->w - dx;
+  if (dy + copy_h > c->h) copy_h = c->h - dy;
+  if (copy_w <= 0 || copy_h <= 0) return 1;
   const uint16_t* src = bmp + sy_off * src_stride + sx_off;
   for (int row = 0; row < copy_h; ++row) {
-    const uint16_t* s = src + row * src_stride;
-    uint16_t* d = &g_fb[(dy + row) * g_w + dx];
-    memcpy(d, s, (size_t)copy_w * sizeof(uint16_t));
+    memcpy(&c->fb[(dy + row) * c->w + dx], src + row * src_stride, (size_t)copy_w * sizeof(uint16_t));
   }
+  return 1;
+}
+
+struct PoolFree { void operator()(void* p) const { heap_caps_free(p); } };
+
+// Decodes src[0..len) into c.fb at the offsets already set in c
+static bool decode_band(TjpgCtx& c) {
+  std::unique_ptr<void, PoolFree> pool(heap_caps_malloc(kPoolSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+  if (!pool) pool.reset(heap_caps_malloc(kPoolSize, MALLOC_CAP_8BIT));
+  if (!pool) { Serial.println("Tjpg: work pool alloc failed"); return false; }
+  JDEC jd;
+  c.pos = 0;
+  JRESULT rc = jd_prepare(&jd, in_cb, pool.get(), kPoolSize, &c);
+  if (rc != JDR_OK) { Serial.printf("Tjpg: jd_prepare failed rc=%d\n", (int)rc); return false; }
+  rc = jd_decomp(&jd, out_cb, 0);
+  if (rc == JDR_INTR && c.stopped) return true; // stopped at the band/window end
+  if (rc == JDR_INTR) { Serial.println("Tjpg: cancelled"); return false; }
+  if (rc != JDR_OK) { Serial.printf("Tjpg: jd_decomp failed rc=%d\n", (int)rc); return false; }
   return true;
 }
+
+// Long-lived core-0 helper for lower bands (one job at a time)
+struct BandJob { TjpgCtx* ctx; bool ok; SemaphoreHandle_t done; };
+
+static void band_task(void* arg) {
+  QueueHandle_t q = (QueueHandle_t)arg;
+  for (;;) {
+    BandJob* job = nullptr;
+    if (xQueueReceive(q, &job, portMAX_DELAY) != pdTRUE || !job) continue;
+    job->ok = decode_band(*job->ctx);
+    xSemaphoreGive(job->done);
+  }
+}
+
+static QueueHandle_t band_queue() {
+  static QueueHandle_t q = []() -> QueueHandle_t {
+    QueueHandle_t h = xQueueCreate(1, sizeof(BandJob*));
+    if (h && xTaskCreatePinnedToCore(band_task, "aa_band", 4096, h, tskIDLE_PRIORITY + 1, nullptr, 0) != pdPASS) {
+      vQueueDelete(h); h = nullptr;
+    }
+    return h;
+  }();
+  return q;
+}
 }
 
 class TjpgBackend : public IImageDecoder {
 public:
   DecodeResult sizeOf(const uint8_t* d, size_t n) override {
-    DecodeResult r; if (!d || n < 4) return r;
-    uint16_t w=0,h=0;
-    auto rc = TJpgDec.getJpgSize(&w,&h,d,n);
-    if (rc == JDR_OK) { r.w=w; r.h=h; r.ok=true; }
-    else Serial.printf("Tjpg: getJpgSize failed rc=%d\n", (int)rc);
+    DecodeResult r;
+    albumart::JpegInfo info = albumart::probeJpeg(d, n);
+    if (info.ok) { r.w = info.w; r.h = info.h; r.ok = true; }
+    else Serial.println("Tjpg: no frame header");
     return r;
   }
   bool decodeToRGB565(const uint8_t* d, size_t n, uint16_t* out, int w, int h) override {
     if (!d || !out) { Serial.println("Tjpg: invalid args to decode"); return false; }
-    // Determine source dimensions to center without scaling
-    uint16_t srcw=0, srch=0;
-    auto szrc = TJpgDec.getJpgSize(&srcw, &srch, d, n);
-    if (szrc != JDR_OK) { Serial.printf("Tjpg: getJpgSize in decode failed rc=%d\n", (int)szrc); return false; }
-    g_off_x = (int)w/2 - (int)srcw/2;
-    g_off_y = (int)h/2 - (int)srch/2;
-
-    g_fb = out; g_w=w; g_h=h;
-    TJpgDec.setSwapBytes(false);
-    TJpgDec.setJpgScale(0); // 0 = full resolution
-    TJpgDec.setCallback(cb);
-    Serial.printf("Tjpg: drawJpg into %dx%d (src %ux%u, off %d,%d) ...\n", w, h, srcw, srch, g_off_x, g_off_y);
-    JRESULT rc = TJpgDec.drawJpg(0,0,d,n);
-    bool ok = (rc == JDR_OK);
-    if (!ok) {
-      Serial.printf("Tjpg: drawJpg failed rc=%d\n", (int)rc);
+    albumart::JpegInfo info = albumart::probeJpeg(d, n);
+    if (!info.ok) { Serial.println("Tjpg: no frame header"); return false; }
+
+    // Center without scaling; only source rows [y0, y1) are visible
+    SourceRect vis = centeredSourceRect(info.w, info.h, w, h);
+    const int y0 = vis.y, y1 = vis.y + vis.h;
+    TjpgCtx c; c.src = d; c.len = n; c.fb = out; c.w = w; c.h = h;
+    c.off_x = (int)w/2 - info.w/2;
+    c.off_y = (int)h/2 - info.h/2;
+    c.stop_y = y1;
+    c.cancel = cancel_;
+    Serial.printf("Tjpg: decode into %dx%d (src %dx%d, off %d,%d, rows %d..%d) ...\n", w, h, info.w, info.h, c.off_x, c.off_y, y0, y1);
+
+    // Restart markers let us start at the last interval boundary above the window
+    albumart::JpegBand upper;
+    int startRow = albumart::jpegCutAtOrBefore(info, y0 / info.mcuH);
+    if (startRow > 0 && albumart::buildJpegBand(d, n, info, startRow, upper)) {
+      c.src = upper.data.data(); c.len = upper.data.size();
+      c.off_y += upper.startY; c.stop_y -= upper.startY;
     } else {
-      Serial.println("Tjpg: drawJpg OK");
+      startRow = 0;
+    }
+
+    // Split the remaining visible rows across both cores
+    QueueHandle_t q = sys::kDualCoreDecode ? band_queue() : nullptr;
+    int endRow = (y1 + info.mcuH - 1) / info.mcuH;
+    int splitRow = q ? albumart::jpegCutNear(info, (startRow + endRow) / 2, startRow, endRow) : -1;
+    albumart::JpegBand lower;
+    if (splitRow < 0 || !albumart::buildJpegBand(d, n, info, splitRow, lower)) {
+      bool ok = decode_band(c);
+      if (ok) Serial.printf("Tjpg: decode OK (from row %d)\n", startRow * info.mcuH);
+      return ok;
     }
-    g_fb=nullptr; g_w=g_h=0; g_off_x=g_off_y=0;
+
+    // Lower band on core 0, upper band here; both write disjoint rows of out
+    TjpgCtx lc = c;
+    lc.src = lower.data.data(); lc.len = lower.data.size();
+    lc.off_y = (int)h/2 - info.h/2 + lower.startY;
+    lc.stop_y = y1 - lower.startY;
+    c.stop_y = lower.startY - startRow * info.mcuH;
+    BandJob job{ &lc, false, xSemaphoreCreateBinary() };
+    BandJob* jp = &job;
+    bool queued = job.done && xQueueSend(q, &jp, 0) == pdTRUE;
+    bool ok = decode_band(c);
+    if (queued) xSemaphoreTake(job.done, portMAX_DELAY);
+    else job.ok = decode_band(lc); // helper busy with another decode
+    if (job.done) vSemaphoreDelete(job.done);
+    ok = ok && job.ok;
+    Serial.printf("Tjpg: %s rows %d..%d split at %d (%s)\n", ok ? "decode OK," : "decode failed,",
+                  startRow * info.mcuH, y1, lower.startY, queued ? "dual-core" : "helper busy");
     return ok;
   }
 };
 
 extern "C" IImageDecoder* createTjpgDecoder() { return new TjpgBackend(); }
-
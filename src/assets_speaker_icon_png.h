@@ -1,89 +0,0 @@
-#pragma once
-// Speaker icon PNG stored in PROGMEM.
-// Replace this placeholder with the REAL bytes of your icon for exact rendering.
-// To update:
-//  - Convert the PNG to a C array (e.g., xxd -i) and assign to speaker_png[]
-//  - Set speaker_png_len accordingly
-//  - Keep this header name/path; code includes it.
-
-#include <Arduino.h>
-
-// Placeholder 1-byte array (length 0 effectively). Replace with real PNG bytes.
-static const uint8_t speaker_png[] PROGMEM = {     0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0x8c, 0xfe, 0xb8, 0x6d, 0x00, 0x00, 0x00,
-  0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x12, 0x74, 0x00, 0x00, 0x12,
-  0x74, 0x01, 0xde, 0x66, 0x1f, 0x78, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45,
-  0x58, 0x74, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x00, 0x77,
-  0x77, 0x77, 0x2e, 0x69, 0x6e, 0x6b, 0x73, 0x63, 0x61, 0x70, 0x65, 0x2e,
-  0x6f, 0x72, 0x67, 0x9b, 0xee, 0x3c, 0x1a, 0x00, 0x00, 0x03, 0x06, 0x49,
-  0x44, 0x41, 0x54, 0x58, 0x85, 0xe5, 0x98, 0x4f, 0x88, 0x4d, 0x71, 0x14,
-  0xc7, 0x3f, 0x33, 0xd8, 0xc9, 0xbf, 0xc5, 0x24, 0x1a, 0x2f, 0x23, 0x8c,
-  0x12, 0x52, 0x66, 0x94, 0xd5, 0xf8, 0x93, 0x42, 0x56, 0x63, 0x2f, 0x5b,
-  0x0b, 0x6c, 0xb0, 0x92, 0xb0, 0x30, 0x93, 0xb0, 0x55, 0x0a, 0xbb, 0x09,
-  0x51, 0x16, 0x2c, 0xc8, 0x94, 0x52, 0x4c, 0x86, 0x18, 0x31, 0x31, 0xbd,
-  0xe6, 0x21, 0x99, 0x85, 0x84, 0x85, 0x3f, 0xd3, 0xcc, 0xd7, 0xe2, 0x9d,
-  0x67, 0x8e, 0x3b, 0xf7, 0x77, 0xef, 0x9d, 0x99, 0xfb, 0x78, 0xe5, 0xd4,
-  0xeb, 0x77, 0x7e, 0xdf, 0x7b, 0x7e, 0xe7, 0x7e, 0xde, 0xef, 0xdd, 0x77,
-  0x7e, 0xa7, 0x5b, 0x27, 0x89, 0x5a, 0xb6, 0xfa, 0x7f, 0x0d, 0x90, 0x66,
-  0xff, 0x25, 0xe0, 0x6c, 0x60, 0x65, 0x5e, 0xc9, 0xf2, 0x06, 0x6c, 0x02,
-  0x9e, 0x02, 0x7d, 0x40, 0x7b, 0x1e, 0x09, 0xf3, 0x04, 0x6c, 0x02, 0xba,
-  0x81, 0x82, 0xcd, 0x73, 0xd9, 0xc5, 0xbc, 0x00, 0x0b, 0xc0, 0x1d, 0x60,
-  0x51, 0xc6, 0xf8, 0x59, 0xc0, 0xf2, 0x2c, 0x81, 0x79, 0x00, 0x36, 0x01,
-  0xf7, 0x80, 0xc5, 0x19, 0xe3, 0xe7, 0x00, 0x8f, 0x81, 0x7e, 0xe0, 0x34,
-  0x30, 0x2d, 0x29, 0x78, 0xaa, 0x80, 0xd1, 0x9d, 0xeb, 0x4c, 0x89, 0xaf,
-  0x03, 0x2e, 0x00, 0x4b, 0x6c, 0x7e, 0x00, 0xe8, 0x22, 0x09, 0x52, 0xd2,
-  0x64, 0x3f, 0x05, 0x49, 0x45, 0x8d, 0x59, 0x87, 0xe9, 0x15, 0x3b, 0x1a,
-  0xb3, 0x66, 0xbf, 0xbb, 0xfe, 0xcd, 0xf9, 0xe7, 0x43, 0xf7, 0xc9, 0x1b,
-  0x2e, 0x09, 0xb0, 0x4d, 0xd2, 0x4f, 0xbb, 0x56, 0xb4, 0x1c, 0xbd, 0x2e,
-  0x7e, 0x4f, 0x5e, 0x80, 0x49, 0x70, 0x21, 0xc0, 0xb9, 0x0e, 0x6e, 0x54,
-  0x52, 0x8b, 0xe9, 0x0d, 0x92, 0xde, 0x99, 0xfe, 0x55, 0xd2, 0xc2, 0xa9,
-  0x02, 0xa6, 0xc1, 0xc5, 0x01, 0xd6, 0x49, 0xba, 0xae, 0x3f, 0xad, 0xd7,
-  0xc5, 0x6f, 0x74, 0xfa, 0xa5, 0x34, 0xc0, 0x55, 0x92, 0x36, 0x07, 0x3e,
-  0x3b, 0x24, 0x95, 0x5c, 0xb2, 0xe3, 0x81, 0x2f, 0x11, 0x05, 0xdc, 0xe7,
-  0xb4, 0x51, 0xe7, 0x9f, 0x75, 0x6b, 0x2e, 0x9b, 0x36, 0x2c, 0x69, 0x51,
-  0x08, 0xb0, 0x5d, 0xd9, 0x2d, 0x04, 0x17, 0x05, 0x5c, 0x27, 0xe9, 0x87,
-  0xcd, 0x8b, 0x2a, 0x3f, 0x87, 0x23, 0x36, 0x1f, 0x91, 0xd4, 0x6c, 0x6b,
-  0x56, 0x87, 0x72, 0xfb, 0xc4, 0x47, 0x33, 0x80, 0x8d, 0x4a, 0x3a, 0x96,
-  0x00, 0x17, 0x05, 0x7c, 0xe1, 0x60, 0x2a, 0xcf, 0xdd, 0x49, 0x17, 0xd3,
-  0xed, 0xd6, 0x3d, 0x30, 0xad, 0xcf, 0xe7, 0x9b, 0x1e, 0xa8, 0x3e, 0x5b,
-  0x02, 0xfa, 0x20, 0x30, 0x90, 0x52, 0xeb, 0xe2, 0xac, 0x1e, 0x58, 0x01,
-  0xf4, 0x00, 0x87, 0x81, 0xbd, 0xc0, 0x4c, 0x60, 0x83, 0x5d, 0x1b, 0x05,
-  0x6e, 0x00, 0xad, 0x94, 0x8f, 0xc8, 0xf9, 0xc0, 0x87, 0x68, 0x1d, 0xf4,
-  0x3b, 0x38, 0xd9, 0xf2, 0x13, 0xdd, 0xc1, 0x82, 0xa4, 0xb7, 0x36, 0x1f,
-  0x92, 0x34, 0xc3, 0x62, 0xba, 0x5c, 0x5c, 0xbb, 0xc6, 0xff, 0x59, 0xb6,
-  0x56, 0xf2, 0x55, 0xbb, 0x1f, 0x2c, 0x01, 0x87, 0xcc, 0x6f, 0x00, 0x36,
-  0x99, 0x7f, 0xd5, 0xc5, 0xb4, 0xd8, 0xd8, 0xef, 0xb4, 0xdf, 0xc7, 0xe6,
-  0xdf, 0x68, 0x58, 0x6f, 0x3a, 0xbf, 0xd9, 0xc6, 0x87, 0x4e, 0x5b, 0x6a,
-  0xe3, 0x47, 0xa7, 0xcd, 0xa9, 0x38, 0xb5, 0xd4, 0x51, 0x7b, 0x16, 0xc5,
-  0x89, 0xd5, 0xb2, 0xed, 0xce, 0x7f, 0x69, 0x63, 0xab, 0xd3, 0x5e, 0xdb,
-  0x38, 0xcf, 0x69, 0x9f, 0x2b, 0x4e, 0xb5, 0x01, 0x0b, 0x40, 0x87, 0xf9,
-  0x43, 0xc0, 0x5d, 0xf3, 0x77, 0xb9, 0x98, 0x1e, 0x1b, 0x9b, 0x9d, 0x56,
-  0xac, 0x38, 0xa1, 0x32, 0xb3, 0x39, 0xa0, 0x0f, 0x32, 0xb1, 0x32, 0x73,
-  0x0b, 0x58, 0x68, 0xfe, 0x41, 0x60, 0xd8, 0xfc, 0x6d, 0x36, 0x0e, 0x03,
-  0xd7, 0xcc, 0x5f, 0xef, 0xd6, 0x3d, 0x4b, 0x03, 0xbc, 0x1d, 0xd0, 0x05,
-  0x9c, 0x00, 0x8e, 0x4c, 0x00, 0x12, 0x60, 0x84, 0xb1, 0x9f, 0xb7, 0x93,
-  0x72, 0x0d, 0x04, 0xb8, 0x4f, 0xb9, 0x06, 0x02, 0xec, 0xb4, 0xb1, 0x8f,
-  0x4a, 0x0d, 0x84, 0xaa, 0x1f, 0x75, 0x2d, 0x4a, 0x3e, 0xea, 0x96, 0xd9,
-  0x9a, 0x35, 0x6e, 0xdd, 0x1f, 0x27, 0xd5, 0xdf, 0x68, 0x16, 0x7c, 0x93,
-  0xea, 0xed, 0x8c, 0x5b, 0x73, 0xc5, 0xb4, 0x61, 0x49, 0x8d, 0x49, 0x80,
-  0x13, 0x6d, 0xb7, 0x3a, 0x33, 0x00, 0xc6, 0xb5, 0x5b, 0x8f, 0x5c, 0xfc,
-  0x16, 0xa7, 0x5f, 0x8c, 0xe6, 0x9b, 0xcc, 0x51, 0x96, 0x06, 0x19, 0x05,
-  0x44, 0xe1, 0x86, 0x75, 0xbe, 0xa4, 0xf7, 0xa6, 0x7f, 0x91, 0xb4, 0x20,
-  0x0f, 0xc0, 0x34, 0xc8, 0x38, 0x40, 0x34, 0xbe, 0xe5, 0x5f, 0x2c, 0xe9,
-  0x89, 0x8b, 0xdf, 0x1d, 0x77, 0xaf, 0xa9, 0x34, 0x05, 0x21, 0xc8, 0x10,
-  0x60, 0xf4, 0x79, 0xfc, 0xee, 0xfc, 0x73, 0xa1, 0xfb, 0x4c, 0x05, 0x10,
-  0x49, 0x4d, 0x1a, 0xff, 0xc7, 0x49, 0x02, 0x8c, 0x7b, 0x1e, 0xbb, 0x24,
-  0x4d, 0xab, 0x16, 0x60, 0xdc, 0x4e, 0x26, 0x01, 0x56, 0x9e, 0xc7, 0x01,
-  0x8b, 0x39, 0x25, 0xa9, 0x3e, 0x29, 0x7f, 0xa8, 0x50, 0x4f, 0xc4, 0x4a,
-  0x40, 0x1b, 0xe5, 0xf7, 0x32, 0x59, 0xde, 0x2e, 0x7c, 0x02, 0xd6, 0x52,
-  0x6e, 0x4a, 0x5f, 0xa5, 0x05, 0xe7, 0x75, 0x16, 0x97, 0x28, 0x1f, 0x8f,
-  0x6f, 0x32, 0xc6, 0x7f, 0x21, 0x03, 0x1c, 0xe4, 0xdb, 0x2c, 0x14, 0x29,
-  0xef, 0x64, 0xc9, 0xe6, 0xcf, 0xf3, 0x48, 0x5a, 0x27, 0xe5, 0xfe, 0x8e,
-  0x7a, 0x36, 0xd0, 0x48, 0x0d, 0x03, 0xe6, 0x6a, 0xb5, 0xd4, 0x51, 0xc7,
-  0x5a, 0xcd, 0x03, 0xfe, 0x02, 0xbc, 0x3c, 0xa7, 0x03, 0xc9, 0x49, 0xbe,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
-  0x82
- };
-static const size_t  speaker_png_len = sizeof(speaker_png);
-
@@ -1,13 +1,59 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 
 namespace sys {
 
 static constexpr int kScreenW = 480;
 static constexpr int kScreenH = 480;
+// The panel is round: only pixels inside the inscribed circle are visible, and
+// full-screen pushes and fills skip the corners (ui_gfx::RoundMask)
+static constexpr bool kRoundPanel = true;
 
 // Add shared timeouts here as needed
 static constexpr unsigned kHttpTimeoutMs = 15000;
 static constexpr unsigned kHttpInactivityMs = 5000;
 
+// Album-art downloader: attempts per download (stalls resume via Range), hosts
+// kept alive, and how long an unused connection is trusted (TLS ones longer, a
+// reconnect costs a full handshake)
+static constexpr unsigned kHttpMaxAttempts = 3;
+static constexpr int kHttpKeepAliveHosts = 2;
+static constexpr unsigned kHttpKeepAliveIdleMs = 30000;
+static constexpr unsigned kHttpsKeepAliveIdleMs = 120000;
+// Plain-HTTP host addresses are reused this long without a new lookup
+static constexpr unsigned kHttpDnsCacheMs = 300000;
+
+// Upper bound for the progressive JPEG coefficient store (PSRAM). It has to fit next
+// to the slab pool (5 x 450 KB), the cover cache and the downloaded file: 2.5 MB holds
+// a 3000 px 4:2:0 cover at 1/8 (2.1 MB). The decoder also leaves kProgJpegHeadroom of
+// the largest free block to everything else and lowers the scale to stay inside it.
+static constexpr size_t kProgJpegBudget = 2560 * 1024;
+static constexpr size_t kProgJpegHeadroom = 256 * 1024;
+
+// Cover change: the new cover fades in over kCoverFadeMs in up to kCoverFadeFrames
+// frames (0 ms shows it at once). A fade keeps the old cover's slab until it ends
+// (counted in kFramebufferSlabs).
+static constexpr unsigned kCoverFadeMs = 450;
+static constexpr int kCoverFadeFrames = 12;
+
+// Player screen paint time per loop pass; a bigger frame (cover change, fade step)
+// is finished over several passes and pushed only once complete
+static constexpr unsigned kUiFrameBudgetUs = 8000;
+
+// Full-screen RGB565 slabs reserved at boot: shown cover, the old one while it fades
+// out, the next one handed over to the UI, the one being decoded, plus the player
+// screen's compositor surface
+static constexpr int kFramebufferSlabs = 5;
+
+// PSRAM budget for compressed covers kept by albumart::CoverCache (0 disables it)
+static constexpr size_t kCoverCacheBytes = 1536 * 1024;
+
+// Freshness of cached covers whose server sent no Cache-Control max-age
+static constexpr uint32_t kArtHeuristicFreshS = 3600;
+
+// Decode the lower half of restart-marked baseline JPEGs on core 0
+static constexpr bool kDualCoreDecode = true;
+
 } // namespace sys
 
@@ -0,0 +1,200 @@
+#include "gfx/AaFont.h"
+#include "base/Config.h"
+#include "gfx/Rgb565.h"
+
+namespace ui_gfx {
+
+namespace {
+
+// Base letters for U+00C0..U+017F, used when the atlas lacks the accented form
+const char kBaseLatin1[] = "AAAAAAACEEEEIIIIDNOOOOOxOUUUUYTsaaaaaaaceeeeiiiidnooooo/ouuuuyty";
+const char kBaseLatinExtA[] =
+  "AaAaAaCcCcCcCcDdDdEeEeEeEeEeGgGgGgGgHhHhIiIiIiIiIiIiJjKkkLlLlLlLlLlNnNnNnnNnOoOoOoOoRrRrRrSsSsSsSsTtTtTtUuUuUuUuUuUuWwYyYZzZzZzs";
+static_assert(sizeof(kBaseLatin1) == 0x40 + 1 && sizeof(kBaseLatinExtA) == 0x80 + 1, "one letter per code point");
+
+char baseLetter(uint32_t cp) {
+  if (cp >= 0xC0 && cp < 0x100) return kBaseLatin1[cp - 0xC0];
+  if (cp >= 0x100 && cp < 0x180) return kBaseLatinExtA[cp - 0x100];
+  switch (cp) {
+    case 0xA0: return ' ';
+    case 0x2013: case 0x2014: return '-';
+    case 0x2018: case 0x2019: case 0x201A: case 0x2039: case 0x203A: return '\'';
+    case 0x201C: case 0x201D: case 0x201E: return '"';
+    case 0x2022: case 0x2026: return '.';
+    default: return 0;
+  }
+}
+
+const AaGlyph* findGlyph(const AaFont& f, uint32_t cp) {
+  // Every atlas starts with the full printable ASCII range
+  if (cp >= 0x20 && cp < 0x7F && cp - 0x20 < f.glyphCount && f.glyphs[cp - 0x20].code == cp) return &f.glyphs[cp - 0x20];
+  int lo = 0, hi = (int)f.glyphCount - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) >> 1;
+    uint32_t c = f.glyphs[mid].code;
+    if (c == cp) return &f.glyphs[mid];
+    if (c < cp) lo = mid + 1; else hi = mid - 1;
+  }
+  return nullptr;
+}
+
+// Calls fn(glyph, x) for every glyph with ink, pen kept in 1/16 px; returns the pen
+// x after the text
+template <typename Fn>
+int16_t layout(const AaFont& f, const char* s, size_t n, int16_t x, Fn&& fn) {
+  int32_t pen = (int32_t)x << 4;
+  const AaGlyph* prev = nullptr;
+  const char* end = (s && n != SIZE_MAX) ? s + n : nullptr;
+  while (s && *s && (!end || s < end)) {
+    uint32_t cp = AaText::nextCodepoint(s);
+    if (cp < 0x20) { prev = nullptr; continue; }
+    const AaGlyph* g = AaText::glyph(f, cp);
+    if (!g) continue;
+    // Class 0 rows and columns are zero: no branch for unkerned glyphs
+    if (prev) pen += f.kerning[prev->kernLeft * f.kernStride + g->kernRight];
+    if (g->w) fn(*g, (int16_t)((pen + 8) >> 4));
+    pen += g->advance;
+    prev = g;
+  }
+  return (int16_t)((pen + 8) >> 4);
+}
+
+inline uint8_t nibble(const uint8_t* row, int i) { return (row[i >> 1] >> ((~i & 1) << 2)) & 0x0F; }
+
+} // namespace
+
+const uint8_t AaText::kAlpha[16] = {0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32};
+
+uint32_t AaText::nextCodepoint(const char*& p) {
+  const uint8_t* s = (const uint8_t*)p;
+  const uint8_t c = s[0];
+  if (c < 0x80) { p += 1; return c; }
+  int n = c >= 0xF5 ? 0 : c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC2 ? 1 : 0;
+  uint32_t cp = c & (0x3F >> n);
+  for (int i = 1; i <= n; ++i) {
+    if ((s[i] & 0xC0) != 0x80) { n = 0; break; }
+    cp = (cp << 6) | (s[i] & 0x3F);
+  }
+  if (!n) { p += 1; return c; }
+  p += n + 1;
+  return cp;
+}
+
+const AaGlyph* AaText::glyph(const AaFont& font, uint32_t cp) {
+  if (const AaGlyph* g = findGlyph(font, cp)) return g;
+  if (char base = baseLetter(cp)) {
+    if (const AaGlyph* g = findGlyph(font, (uint8_t)base)) return g;
+  }
+  return findGlyph(font, '?');
+}
+
+int16_t AaText::width(const AaFont& font, const char* s, size_t n) {
+  return layout(font, s, n, 0, [](const AaGlyph&, int16_t) {});
+}
+
+Rect AaText::bounds(const AaFont& font, const char* s, int16_t x, int16_t y, size_t n) {
+  Rect b;
+  layout(font, s, n, x, [&](const AaGlyph& g, int16_t gx) {
+    b = b.united(Rect{(int16_t)(gx + g.dx), (int16_t)(y + g.dy), g.w, g.h});
+  });
+  return b;
+}
+
+int16_t AaText::draw(uint16_t* dst, int stride, const Rect& clip, const AaFont& font,
+                     int16_t x, int16_t y, const char* s, uint16_t color, size_t n) {
+  if (!dst) return x + width(font, s, n);
+  const Rect c = clip.intersected(Rect{0, 0, (int16_t)sys::kScreenW, (int16_t)sys::kScreenH});
+  return layout(font, s, n, x, [&](const AaGlyph& g, int16_t gx) {
+    const Rect box{(int16_t)(gx + g.dx), (int16_t)(y + g.dy), g.w, g.h};
+    const Rect r = box.intersected(c);
+    if (r.empty()) return;
+    const int pitch = (g.w + 1) >> 1;
+    const uint8_t* src = font.bitmap + g.offset + (size_t)(r.y - box.y) * pitch;
+    uint16_t* d = dst + (size_t)r.y * stride;
+    for (int row = 0; row < r.h; ++row, src += pitch, d += stride) {
+      for (int px = r.x; px < r.x + r.w; ++px) {
+        const uint8_t a = nibble(src, px - box.x);
+        if (a == 0x0F) d[px] = color;
+        else if (a) d[px] = blend565(color, d[px], kAlpha[a]);
+      }
+    }
+  });
+}
+
+void AaText::coverage(uint8_t* mask, int stride, int16_t w, int16_t h, const AaFont& font,
+                      int16_t x, int16_t y, const char* s) {
+  const Rect c{0, 0, w, h};
+  layout(font, s, SIZE_MAX, x, [&](const AaGlyph& g, int16_t gx) {
+    const Rect box{(int16_t)(gx + g.dx), (int16_t)(y + g.dy), g.w, g.h};
+    const Rect r = box.intersected(c);
+    if (r.empty()) return;
+    const int pitch = (g.w + 1) >> 1;
+    const uint8_t* src = font.bitmap + g.offset + (size_t)(r.y - box.y) * pitch;
+    uint8_t* m = mask + (size_t)r.y * stride;
+    for (int row = 0; row < r.h; ++row, src += pitch, m += stride) {
+      for (int px = r.x; px < r.x + r.w; ++px) {
+        const uint8_t a = nibble(src, px - box.x);
+        if (a > m[px]) m[px] = a;
+      }
+    }
+  });
+}
+
+int16_t AaText::draw(Arduino_GFX* g, const AaFont& font, int16_t x, int16_t y, const char* s,
+                     uint16_t color, uint16_t bg, bool opaque, size_t n) {
+  if (!g) return x + width(font, s, n);
+  const Rect screen{0, 0, (int16_t)g->width(), (int16_t)g->height()};
+  uint16_t run[256];  // glyph boxes are at most 255 wide
+  uint16_t ramp[16];
+  for (int a = 0; a < 16; ++a) ramp[a] = opaque ? blend565(color, bg, kAlpha[a]) : color;
+  return layout(font, s, n, x, [&](const AaGlyph& gl, int16_t gx) {
+    const Rect box{(int16_t)(gx + gl.dx), (int16_t)(y + gl.dy), gl.w, gl.h};
+    const Rect r = box.intersected(screen);
+    if (r.empty()) return;
+    const int pitch = (gl.w + 1) >> 1;
+    const uint8_t* src = font.bitmap + gl.offset + (size_t)(r.y - box.y) * pitch;
+    const uint8_t minA = opaque ? 1 : 8;
+    for (int16_t yy = r.y; yy < r.y + r.h; ++yy, src += pitch) {
+      int n = 0, x0 = 0;
+      for (int px = r.x; px <= r.x + r.w; ++px) {
+        const uint8_t a = px < r.x + r.w ? nibble(src, px - box.x) : 0;
+        if (a >= minA) {
+          if (!n) x0 = px;
+          run[n++] = ramp[a];
+        } else if (n) {
+          g->draw16bitRGBBitmap(x0, yy, run, n, 1);
+          n = 0;
+        }
+      }
+    }
+  });
+}
+
+void TextPen::getTextBounds(const char* s, int16_t x, int16_t y, int16_t* bx, int16_t* by, uint16_t* bw, uint16_t* bh) const {
+  const Rect b = font_ ? AaText::bounds(*font_, s, x, y) : Rect{};
+  *bx = b.empty() ? x : b.x; *by = b.empty() ? y : b.y;
+  *bw = b.empty() ? 0 : (uint16_t)b.w; *bh = b.empty() ? 0 : (uint16_t)b.h;
+}
+
+size_t TextPen::print(const char* s) {
+  if (!font_ || !s) return 0;
+  Arduino_GFX* g = target_ ? *target_ : nullptr;
+  size_t n = 0;
+  for (const char* line = s; ; ) {
+    const char* nl = strchr(line, '\n');
+    if (!nl) { x_ = AaText::draw(g, *font_, x_, y_, line, fg_, bg_, opaque_); n += strlen(line); break; }
+    AaText::draw(g, *font_, x_, y_, line, fg_, bg_, opaque_, nl - line);
+    x_ = 0; y_ += font_->lineHeight;
+    n += nl - line + 1;
+    line = nl + 1;
+  }
+  return n;
+}
+
+size_t TextPen::print(const char* s, size_t n) {
+  if (!font_ || !s) return 0;
+  x_ = AaText::draw(target_ ? *target_ : nullptr, *font_, x_, y_, s, fg_, bg_, opaque_, n);
+  return n;
+}
+
+} // namespace ui_gfx
@@ -0,0 +1,101 @@
+#pragma once
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <stdint.h>
+#include "gfx/Compositor.h"
+
+namespace ui_gfx {
+
+// One glyph of an atlas: 4-bit coverage, two pixels per byte (high nibble first),
+// rows padded to whole bytes
+struct AaGlyph {
+  uint16_t code;      // Unicode code point; the table is sorted by it
+  uint32_t offset;    // first byte in AaFont::bitmap
+  uint8_t w, h;       // coverage box
+  int8_t dx, dy;      // box origin relative to the pen on the baseline
+  uint16_t advance;   // 1/16 px
+  uint8_t kernLeft;   // row in AaFont::kerning when this glyph is on the left of a pair
+  uint8_t kernRight;  // column when it is on the right
+};
+
+// Anti-aliased bitmap font as generated by tools/make_font_atlas.py (see gfx/fonts/)
+struct AaFont {
+  const uint8_t* bitmap;
+  const AaGlyph* glyphs;
+  uint16_t glyphCount;
+  const int8_t* kerning;     // [kernLeft * kernStride + kernRight], 1/16 px
+  uint16_t kernStride;
+  uint8_t lineHeight, ascent, descent;
+};
+
+// UTF-8 text in an AaFont. Measuring only walks the advance and kerning tables;
+// drawing blends the glyph coverage into the target. Code points missing from
+// the atlas fall back to their base letter (é -> e) and then to '?'.
+class AaText {
+public:
+  // Next code point; advances p. Bytes that are not valid UTF-8 are taken as
+  // Latin-1, as older Sonos metadata sometimes is.
+  static uint32_t nextCodepoint(const char*& p);
+  static const AaGlyph* glyph(const AaFont& font, uint32_t cp);
+
+  // Text arguments end at the NUL or after n bytes, whichever comes first
+
+  // Pen advance in pixels
+  static int16_t width(const AaFont& font, const char* s, size_t n = SIZE_MAX);
+  // Ink box of the text with its pen origin at (x, y) on the baseline; empty for blank text
+  static Rect bounds(const AaFont& font, const char* s, int16_t x, int16_t y, size_t n = SIZE_MAX);
+
+  // Blends the text into an RGB565 frame (row pitch stride, sys::kScreenW x
+  // sys::kScreenH) within clip. Returns the pen x after the text.
+  static int16_t draw(uint16_t* dst, int stride, const Rect& clip, const AaFont& font,
+                      int16_t x, int16_t y, const char* s, uint16_t color, size_t n = SIZE_MAX);
+  // Through a display that cannot be read back: coverage is blended against bg when
+  // opaque, otherwise pixels of at least half coverage are set. One bitmap call per
+  // run of covered pixels.
+  static int16_t draw(Arduino_GFX* g, const AaFont& font, int16_t x, int16_t y, const char* s,
+                      uint16_t color, uint16_t bg, bool opaque, size_t n = SIZE_MAX);
+
+  // Coverage (0..15, maximum where glyphs overlap) into a w x h byte mask
+  static void coverage(uint8_t* mask, int stride, int16_t w, int16_t h, const AaFont& font,
+                       int16_t x, int16_t y, const char* s);
+
+  // Alpha of 4-bit coverage for blend565
+  static const uint8_t kAlpha[16];
+};
+
+// Cursor-style text output with the Arduino_GFX text API (setFont/setTextColor/
+// setCursor/getTextBounds/print), so screen code keeps its shape. Draws through
+// *target, which the UI benchmark may repoint.
+class TextPen {
+public:
+  explicit TextPen(Arduino_GFX* const* target) : target_(target) {}
+
+  void setFont(const AaFont* font) { font_ = font; }
+  const AaFont* font() const { return font_; }
+  // fg only: transparent; fg and bg: anti-aliased against bg
+  void setTextColor(uint16_t fg) { fg_ = fg; opaque_ = false; }
+  void setTextColor(uint16_t fg, uint16_t bg) { fg_ = fg; bg_ = bg; opaque_ = true; }
+  void setCursor(int16_t x, int16_t y) { x_ = x; y_ = y; }
+  int16_t getCursorX() const { return x_; }
+  int16_t getCursorY() const { return y_; }
+
+  void getTextBounds(const char* s, int16_t x, int16_t y, int16_t* bx, int16_t* by, uint16_t* bw, uint16_t* bh) const;
+  void getTextBounds(const String& s, int16_t x, int16_t y, int16_t* bx, int16_t* by, uint16_t* bw, uint16_t* bh) const {
+    getTextBounds(s.c_str(), x, y, bx, by, bw, bh);
+  }
+
+  // Advances the cursor; '\n' starts a new line at x = 0
+  size_t print(const char* s);
+  size_t print(const String& s) { return print(s.c_str()); }
+  // The first n bytes of s, on the current line
+  size_t print(const char* s, size_t n);
+
+private:
+  Arduino_GFX* const* target_;
+  const AaFont* font_ = nullptr;
+  uint16_t fg_ = 0xFFFF, bg_ = 0;
+  bool opaque_ = false;
+  int16_t x_ = 0, y_ = 0;
+};
+
+} // namespace ui_gfx
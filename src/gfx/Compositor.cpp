@@ -0,0 +1,108 @@
+#include "gfx/Compositor.h"
+#include "base/Log.h"
+#include "gfx/RoundMask.h"
+
+namespace ui_gfx {
+
+Rect Rect::united(const Rect& o) const {
+  if (empty()) return o;
+  if (o.empty()) return *this;
+  int16_t x0 = x < o.x ? x : o.x, y0 = y < o.y ? y : o.y;
+  int16_t x1 = x + w > o.x + o.w ? x + w : o.x + o.w;
+  int16_t y1 = y + h > o.y + o.h ? y + h : o.y + o.h;
+  return Rect{x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+Rect Rect::intersected(const Rect& o) const {
+  int16_t x0 = x > o.x ? x : o.x, y0 = y > o.y ? y : o.y;
+  int16_t x1 = x + w < o.x + o.w ? x + w : o.x + o.w;
+  int16_t y1 = y + h < o.y + o.h ? y + h : o.y + o.h;
+  if (x1 <= x0 || y1 <= y0) return Rect{};
+  return Rect{x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+SlabCanvas::SlabCanvas(FbLease&& slab, Arduino_G* output)
+  : Arduino_Canvas(sys::kScreenW, sys::kScreenH, output), slab_(std::move(slab)) {
+  _framebuffer = slab_.data(); // begin() allocates only when this is null
+}
+
+bool Compositor::begin(Arduino_GFX* panel) {
+  panel_ = panel;
+  if (canvas_) return true;
+  FbLease slab = FramebufferPool::instance().acquire();
+  if (!slab) { LOGW("COMP", "no free slab, painting directly"); return false; }
+  canvas_.reset(new SlabCanvas(std::move(slab), panel));
+  if (!canvas_->begin(GFX_SKIP_OUTPUT_BEGIN)) { LOGE("COMP", "canvas init failed"); canvas_.reset(); return false; }
+  return true;
+}
+
+Arduino_GFX* Compositor::target() const {
+  if (canvas_) return canvas_.get();
+  return panel_;
+}
+
+void Compositor::invalidate(const Rect& r) {
+  Rect c = r.intersected(Rect{0, 0, (int16_t)sys::kScreenW, (int16_t)sys::kScreenH});
+  if (c.empty()) return;
+  // Absorb every rectangle the new one touches; repeat since the union may grow into others
+  for (bool merged = true; merged; ) {
+    merged = false;
+    for (size_t i = 0; i < dirty_.size(); ++i) {
+      if (!dirty_[i].touches(c)) continue;
+      c = c.united(dirty_[i]);
+      dirty_.erase(dirty_.begin() + i);
+      merged = true;
+      break;
+    }
+  }
+  if ((int)dirty_.size() < kMaxDirty) { dirty_.push_back(c); return; }
+  // Full: merge into the rectangle that grows least
+  size_t best = 0; int32_t bestGrowth = INT32_MAX;
+  for (size_t i = 0; i < dirty_.size(); ++i) {
+    int32_t g = dirty_[i].united(c).area() - dirty_[i].area();
+    if (g < bestGrowth) { bestGrowth = g; best = i; }
+  }
+  dirty_[best] = dirty_[best].united(c);
+}
+
+void Compositor::flush(uint32_t budgetUs) {
+  if (!panel_) return;
+  if (frame_.empty()) {
+    if (dirty_.empty()) return;
+    frame_.swap(dirty_);
+    frameRect_ = 0; frameRow_ = 0; frameUs_ = 0; framePasses_ = 0;
+  }
+  Arduino_GFX* g = target();
+  const unsigned long t0 = micros();
+  framePasses_++;
+  // Band by band, at least one per call
+  for (bool first = true; frameRect_ < frame_.size(); first = false) {
+    const Rect& r = frame_[frameRect_];
+    if (budgetUs && !first && micros() - t0 >= budgetUs) break;
+    const int16_t h = r.h - frameRow_ < kBandRows ? r.h - frameRow_ : kBandRows;
+    const Rect band{r.x, (int16_t)(r.y + frameRow_), r.w, h};
+    for (Paint& p : layers_) p(*g, band);
+    frameRow_ += h;
+    if (frameRow_ >= r.h) { ++frameRect_; frameRow_ = 0; }
+  }
+  if (frameRect_ < frame_.size()) { frameUs_ += micros() - t0; return; }
+
+  uint32_t px = 0;
+  for (const Rect& r : frame_) px += canvas_ ? RoundMask::visiblePixels(r.x, r.y, r.w, r.h) : (uint32_t)r.area();
+  if (canvas_) {
+    // One push per rectangle after all of them are painted, corners outside the
+    // round panel left out
+    Display disp(panel_);
+    const uint16_t* s = canvas_->pixels();
+    for (const Rect& r : frame_) disp.drawRectVisible(r.x, r.y, s + (size_t)r.y * sys::kScreenW + r.x, sys::kScreenW, r.w, r.h);
+  }
+  stats_.flushes++;
+  stats_.rects += frame_.size();
+  stats_.pixels += px;
+  stats_.lastPixels = px;
+  stats_.lastUs = frameUs_ + (micros() - t0);
+  stats_.lastPasses = framePasses_;
+  frame_.clear();
+}
+
+} // namespace ui_gfx
@@ -0,0 +1,103 @@
+#pragma once
+#include <Arduino_GFX_Library.h>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "base/Config.h"
+#include "gfx/Display.h"
+#include "gfx/FramebufferPool.h"
+
+namespace ui_gfx {
+
+struct Rect {
+  int16_t x = 0, y = 0, w = 0, h = 0;
+
+  bool empty() const { return w <= 0 || h <= 0; }
+  int32_t area() const { return empty() ? 0 : (int32_t)w * h; }
+  bool intersects(const Rect& o) const {
+    return !empty() && !o.empty() && x < o.x + o.w && o.x < x + w && y < o.y + o.h && o.y < y + h;
+  }
+  // Overlapping or sharing an edge: merging costs no extra pixels along that edge
+  bool touches(const Rect& o) const {
+    return !empty() && !o.empty() && x <= o.x + o.w && o.x <= x + w && y <= o.y + o.h && o.y <= y + h;
+  }
+  Rect united(const Rect& o) const;
+  Rect intersected(const Rect& o) const;
+};
+
+// Arduino_Canvas drawing into a FramebufferPool slab instead of its own allocation.
+// Never flush()ed: the Compositor pushes only dirty rectangles.
+class SlabCanvas : public Arduino_Canvas {
+public:
+  SlabCanvas(FbLease&& slab, Arduino_G* output);
+  ~SlabCanvas() { _framebuffer = nullptr; } // the slab is returned by slab_, not freed
+
+  uint16_t* pixels() { return slab_.data(); }
+
+private:
+  FbLease slab_;
+};
+
+// Retained off-screen compositor for a full-screen view. Layers paint bottom to top
+// into a PSRAM surface for every dirty rectangle; flush() then pushes exactly those
+// rectangles to the panel, so the panel never shows a half-drawn state and unchanged
+// pixels are not pushed again. A layer may paint beyond the rectangle it is given:
+// the surface outside dirty rectangles is scratch and never pushed as is.
+// Without a free slab the layers paint straight to the panel (same order, same
+// rectangles), trading the flicker-free update for memory.
+class Compositor {
+public:
+  using Paint = std::function<void(Arduino_GFX& g, const Rect& clip)>;
+  static constexpr int kMaxDirty = 6;
+  static constexpr int kBandRows = 32;  // rows painted between budget checks
+
+  struct Stats {
+    uint32_t flushes = 0;
+    uint32_t rects = 0;
+    uint64_t pixels = 0;       // pixels pushed to the panel (visible ones; painted, without surface)
+    uint32_t lastPixels = 0;   // of the most recent flush
+    uint32_t lastUs = 0;       // paint + push time of the most recent flush
+    uint32_t lastPasses = 0;   // flush() calls it took
+  };
+
+  // Takes one slab for the surface; false means direct painting
+  bool begin(Arduino_GFX* panel);
+  bool offscreen() const { return canvas_ != nullptr; }
+
+  // Where layers paint: the surface, or the panel without one
+  Arduino_GFX* target() const;
+  // Surface pixels (stride sys::kScreenW), nullptr when painting directly
+  uint16_t* surface() const { return canvas_ ? canvas_->pixels() : nullptr; }
+
+  // Bottom to top, in call order
+  void addLayer(Paint paint) { layers_.push_back(std::move(paint)); }
+
+  void invalidate(const Rect& r);
+  // Also drops a partly painted frame
+  void invalidateAll() { dirty_.clear(); frame_.clear(); invalidate(Rect{0, 0, (int16_t)sys::kScreenW, (int16_t)sys::kScreenH}); }
+  bool dirty() const { return !dirty_.empty(); }
+
+  // Paints the layer stack into every dirty rectangle and pushes them to the panel.
+  // With a budget, painting stops at the next band of kBandRows rows once budgetUs
+  // has passed, and later calls carry on with the same rectangles; they are pushed
+  // together when all of them are painted. Rectangles invalidated meanwhile wait for
+  // the next frame.
+  void flush(uint32_t budgetUs = 0);
+  // A frame is partly painted: its state must stay as it is until flush() is done
+  bool painting() const { return !frame_.empty(); }
+
+  const Stats& stats() const { return stats_; }
+
+private:
+  Arduino_GFX* panel_ = nullptr;
+  std::unique_ptr<SlabCanvas> canvas_;
+  std::vector<Paint> layers_;
+  std::vector<Rect> dirty_;
+  std::vector<Rect> frame_;   // being painted, up to row frameRow_ of frame_[frameRect_]
+  size_t frameRect_ = 0;
+  int16_t frameRow_ = 0;
+  uint32_t frameUs_ = 0, framePasses_ = 0;
+  Stats stats_;
+};
+
+} // namespace ui_gfx
@@ -1,15 +1,26 @@
 #pragma once
 #include <Arduino_GFX_Library.h>
 #include "base/Config.h"
+#include "gfx/RoundMask.h"
+#include "gfx/SurfaceCodec.h"
 
 namespace ui_gfx {
 
 class Display {
 public:
-  // Wrap an existing Arduino_RGB_Display*
-  explicit Display(Arduino_RGB_Display* g) : g_(g) {}
+  // Wrap the panel (Arduino_RGB_Display) or any other Arduino_GFX target
+  explicit Display(Arduino_GFX* g) : g_(g) {}
 
   void fill(uint16_t color) { if (g_) g_->fillScreen(color); }
+  // fill() of only what the round panel shows: one span per row
+  void fillVisible(uint16_t color) {
+    if (!g_) return;
+    if (!sys::kRoundPanel) { g_->fillScreen(color); return; }
+    for (int y = 0; y < sys::kScreenH; ++y) {
+      const int x0 = RoundMask::rowStart(y);
+      g_->drawFastHLine(x0, y, RoundMask::rowEnd(y) - x0, color);
+    }
+  }
 
   // Draw a single RGB565 row
   void drawRow(int x, int y, const uint16_t* data, int w) {
@@ -17,10 +28,42 @@ public:
     g_->draw16bitRGBBitmap(x, y, (uint16_t*)data, (uint16_t)w, 1);
   }
 
-  Arduino_RGB_Display* raw() const { return g_; }
+  // Copy a w x h block from src (row pitch `stride` pixels) to (x,y); one call when rows are contiguous
+  void drawRect(int x, int y, const uint16_t* src, int stride, int w, int h) {
+    if (!g_ || w <= 0 || h <= 0) return;
+    if (w == stride) { g_->draw16bitRGBBitmap(x, y, (uint16_t*)src, (uint16_t)w, (uint16_t)h); return; }
+    for (int r = 0; r < h; ++r) g_->draw16bitRGBBitmap(x, y + r, (uint16_t*)(src + (size_t)r * stride), (uint16_t)w, 1);
+  }
+
+  // drawRect() without the pixels outside the round panel's circle: a block the circle
+  // contains goes as before, otherwise one call per row with its visible span
+  void drawRectVisible(int x, int y, const uint16_t* src, int stride, int w, int h) {
+    if (!g_ || w <= 0 || h <= 0) return;
+    if (RoundMask::contains(x, y, w, h)) { drawRect(x, y, src, stride, w, h); return; }
+    for (int r = 0; r < h; ++r) {
+      int cx = x, cw = w;
+      if (!RoundMask::clipRow(y + r, cx, cw)) continue;
+      g_->draw16bitRGBBitmap(cx, y + r, (uint16_t*)(src + (size_t)r * stride + (cx - x)), (uint16_t)cw, 1);
+    }
+  }
+
+  // Stream a compressed surface to (x,y) in strips of stripRows rows through scratch
+  // (s.w * stripRows pixels); no full-size buffer is needed
+  bool drawSurface(int x, int y, const Surface& s, uint16_t* scratch, int stripRows) {
+    if (!g_ || !scratch || stripRows <= 0) return false;
+    SurfaceDecoder dec(s);
+    for (int row = 0; row < s.h; row += stripRows) {
+      int h = (row + stripRows <= s.h) ? stripRows : s.h - row;
+      if (!dec.readRows(scratch, h)) return false;
+      g_->draw16bitRGBBitmap(x, y + row, scratch, s.w, h);
+    }
+    return true;
+  }
+
+  Arduino_GFX* raw() const { return g_; }
 
 private:
-  Arduino_RGB_Display* g_ = nullptr;
+  Arduino_GFX* g_ = nullptr;
 };
 
 } // namespace ui_gfx
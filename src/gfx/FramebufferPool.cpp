@@ -0,0 +1,90 @@
+#include "gfx/FramebufferPool.h"
+#include "base/Log.h"
+#include "esp_heap_caps.h"
+
+namespace ui_gfx {
+
+static constexpr uint32_t kGenMask = 0xFFFFFF; // generation bits kept by a detached handle
+
+void FbLease::reset() {
+  if (!px_) return;
+  FramebufferPool::instance().release(slot_, gen_);
+  px_ = nullptr;
+}
+
+uint32_t FbLease::detach() {
+  if (!px_) return 0;
+  uint32_t h = (gen_ << 8) | slot_;
+  px_ = nullptr; // ownership moves into the handle
+  return h;
+}
+
+FbLease FbLease::adopt(uint32_t handle) {
+  FbLease l;
+  if (!handle) return l;
+  uint8_t slot = (uint8_t)(handle & 0xFF);
+  uint32_t gen = handle >> 8;
+  if (FramebufferPool::instance().claim(slot, gen, &l.px_)) { l.slot_ = slot; l.gen_ = gen; }
+  else LOGE("FBPOOL", "stale handle slot=%u gen=%u", (unsigned)slot, (unsigned)gen);
+  return l;
+}
+
+bool FramebufferPool::begin(int slabs) {
+  if (block_) return true;
+  if (slabs < 1) slabs = 1;
+  if (slabs > kMaxSlabs) slabs = kMaxSlabs;
+  // One block for all slabs: a single early allocation, each slab stays 64-byte aligned
+  block_ = (uint8_t*)heap_caps_aligned_alloc(64, kSlabBytes * slabs, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!block_) {
+    LOGE("FBPOOL", "cannot reserve %d x %u bytes in PSRAM", slabs, (unsigned)kSlabBytes);
+    return false;
+  }
+  memset(block_, 0, kSlabBytes * slabs);
+  count_ = slabs;
+  LOGI("FBPOOL", "reserved %d slabs (%u KB)", slabs, (unsigned)(kSlabBytes * slabs / 1024));
+  return true;
+}
+
+FbLease FramebufferPool::acquire() {
+  FbLease l;
+  portENTER_CRITICAL(&mux_);
+  for (int i = 0; i < count_; ++i) {
+    if (inUse_[i]) continue;
+    inUse_[i] = true;
+    gen_[i] = (gen_[i] + 1) & kGenMask;
+    if (!gen_[i]) gen_[i] = 1;
+    l.px_ = (uint16_t*)(block_ + kSlabBytes * i);
+    l.slot_ = (uint8_t)i;
+    l.gen_ = gen_[i];
+    break;
+  }
+  portEXIT_CRITICAL(&mux_);
+  if (!l) LOGW("FBPOOL", "all %d slabs in use", count_);
+  return l;
+}
+
+int FramebufferPool::available() const {
+  int n = 0;
+  portENTER_CRITICAL(&mux_);
+  for (int i = 0; i < count_; ++i) if (!inUse_[i]) ++n;
+  portEXIT_CRITICAL(&mux_);
+  return n;
+}
+
+void FramebufferPool::release(uint8_t slot, uint32_t gen) {
+  bool stale = true;
+  portENTER_CRITICAL(&mux_);
+  if (slot < count_ && inUse_[slot] && gen_[slot] == gen) { inUse_[slot] = false; stale = false; }
+  portEXIT_CRITICAL(&mux_);
+  if (stale) LOGE("FBPOOL", "release of stale lease slot=%u gen=%u", (unsigned)slot, (unsigned)gen);
+}
+
+bool FramebufferPool::claim(uint8_t slot, uint32_t gen, uint16_t** px) {
+  bool ok = false;
+  portENTER_CRITICAL(&mux_);
+  if (slot < count_ && inUse_[slot] && gen_[slot] == gen) { *px = (uint16_t*)(block_ + kSlabBytes * slot); ok = true; }
+  portEXIT_CRITICAL(&mux_);
+  return ok;
+}
+
+} // namespace ui_gfx
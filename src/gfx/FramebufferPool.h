@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+#include <cstddef>
+#include <cstdint>
+#include "freertos/FreeRTOS.h"
+#include "base/Config.h"
+
+namespace ui_gfx {
+
+class FramebufferPool;
+
+// Move-only lease on one full-screen RGB565 slab; returns the slab on destruction.
+// The generation tag catches a lease that outlived its slab (released twice, or
+// adopted from a stale handle).
+class FbLease {
+public:
+  FbLease() = default;
+  ~FbLease() { reset(); }
+  FbLease(FbLease&& o) noexcept { take(o); }
+  FbLease& operator=(FbLease&& o) noexcept { if (this != &o) { reset(); take(o); } return *this; }
+  FbLease(const FbLease&) = delete;
+  FbLease& operator=(const FbLease&) = delete;
+
+  uint16_t* data() const { return px_; }
+  explicit operator bool() const { return px_ != nullptr; }
+  void reset();
+
+  // Hand the slab across a lock-free boundary (e.g. std::atomic<uint32_t>) and back.
+  // 0 means "no slab"; a detached handle must be adopted exactly once.
+  uint32_t detach();
+  static FbLease adopt(uint32_t handle);
+
+private:
+  friend class FramebufferPool;
+  void take(FbLease& o) { px_ = o.px_; slot_ = o.slot_; gen_ = o.gen_; o.px_ = nullptr; }
+  uint16_t* px_ = nullptr;
+  uint8_t slot_ = 0;
+  uint32_t gen_ = 0;
+};
+
+// Fixed set of 64-byte aligned kScreenW x kScreenH slabs reserved once in PSRAM at
+// boot. Acquire/release never touch the heap, so track changes cannot fail because
+// the largest free PSRAM block shrank.
+class FramebufferPool {
+public:
+  static constexpr size_t kSlabBytes = (size_t)sys::kScreenW * sys::kScreenH * sizeof(uint16_t);
+  static constexpr int kMaxSlabs = 8;
+
+  static FramebufferPool& instance() { static FramebufferPool p; return p; }
+
+  // Reserve `slabs` buffers in one block; call early in setup() while PSRAM is unfragmented
+  bool begin(int slabs = sys::kFramebufferSlabs);
+
+  // Empty lease when every slab is taken (or begin() failed)
+  FbLease acquire();
+
+  int capacity() const { return count_; }
+  int available() const;
+
+private:
+  friend class FbLease;
+  FramebufferPool() = default;
+  void release(uint8_t slot, uint32_t gen);
+  bool claim(uint8_t slot, uint32_t gen, uint16_t** px);
+
+  uint8_t* block_ = nullptr;
+  int count_ = 0;
+  bool inUse_[kMaxSlabs] = {};
+  uint32_t gen_[kMaxSlabs] = {};  // bumped on every acquire; 24 bits survive detach()
+  mutable portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+};
+
+} // namespace ui_gfx
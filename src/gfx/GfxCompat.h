@@ -0,0 +1,24 @@
+#pragma once
+#include <Arduino_GFX_Library.h>
+#include <type_traits>
+
+namespace ui_gfx {
+
+// Arduino_GFX changed its coordinate type between releases (int16_t -> int32_t).
+// Overrides of its virtual primitives take the types the installed library declares.
+namespace detail {
+template <class M> struct FirstArg;
+template <class C, class R, class A, class... Rest> struct FirstArg<R (C::*)(A, Rest...)> { typedef A type; };
+
+template <class T> struct BitmapFn { typedef void (Arduino_Canvas::*type)(T, T, uint16_t*, T, T); };
+template <class T, class = void> struct HasBitmap : std::false_type {};
+template <class T>
+struct HasBitmap<T, decltype((void)static_cast<typename BitmapFn<T>::type>(&Arduino_Canvas::draw16bitRGBBitmap))> : std::true_type {};
+} // namespace detail
+
+// x/y of writePixelPreclipped and friends
+typedef detail::FirstArg<decltype(&Arduino_GFX::writePixelPreclipped)>::type GfxCoord;
+// x/y/w/h of draw16bitRGBBitmap(x, y, uint16_t*, w, h)
+typedef std::conditional<detail::HasBitmap<int32_t>::value, int32_t, int16_t>::type GfxBitmapCoord;
+
+} // namespace ui_gfx
@@ -0,0 +1,64 @@
+#include "gfx/Icon.h"
+#include "base/Config.h"
+#include "gfx/AaFont.h"
+#include "gfx/Rgb565.h"
+
+namespace ui_gfx {
+
+namespace {
+
+inline uint8_t nibble(const uint8_t* row, int i) { return (row[i >> 1] >> ((~i & 1) << 2)) & 0x0F; }
+
+} // namespace
+
+void IconBlit::draw(uint16_t* dst, int stride, const Rect& clip, const Icon& icon, int16_t x, int16_t y) {
+  if (!dst) return;
+  const Rect box{(int16_t)(x + icon.bx), (int16_t)(y + icon.by), icon.bw, icon.bh};
+  const Rect r = box.intersected(clip).intersected(Rect{0, 0, (int16_t)sys::kScreenW, (int16_t)sys::kScreenH});
+  if (r.empty()) return;
+  const int pitch = (icon.bw + 1) >> 1;
+  const int sx = r.x - box.x, sy = r.y - box.y;
+  const uint8_t* a = icon.alpha + (size_t)sy * pitch;
+  const uint16_t* c = icon.rgb ? icon.rgb + (size_t)sy * icon.bw : nullptr;
+  uint16_t* d = dst + (size_t)r.y * stride + r.x;
+  for (int row = 0; row < r.h; ++row, a += pitch, d += stride) {
+    for (int i = 0; i < r.w; ++i) {
+      const uint8_t v = nibble(a, sx + i);
+      if (!v) continue;
+      const uint16_t col = c ? c[sx + i] : icon.color;
+      d[i] = v == 0x0F ? col : blend565(col, d[i], AaText::kAlpha[v]);
+    }
+    if (c) c += icon.bw;
+  }
+}
+
+void IconBlit::draw(Arduino_GFX* g, const Icon& icon, int16_t x, int16_t y, uint16_t bg, bool opaque) {
+  if (!g) return;
+  const Rect box{(int16_t)(x + icon.bx), (int16_t)(y + icon.by), icon.bw, icon.bh};
+  const Rect r = box.intersected(Rect{0, 0, (int16_t)g->width(), (int16_t)g->height()});
+  if (r.empty()) return;
+  uint16_t run[256];  // ink boxes are at most 255 wide
+  uint16_t ramp[16];  // single-colour icons: the 16 blends, once
+  for (int v = 0; v < 16; ++v) ramp[v] = opaque ? blend565(icon.color, bg, AaText::kAlpha[v]) : icon.color;
+  const uint8_t minA = opaque ? 1 : 8;
+  const int pitch = (icon.bw + 1) >> 1;
+  const uint8_t* a = icon.alpha + (size_t)(r.y - box.y) * pitch;
+  const uint16_t* c = icon.rgb ? icon.rgb + (size_t)(r.y - box.y) * icon.bw : nullptr;
+  for (int16_t yy = r.y; yy < r.y + r.h; ++yy, a += pitch) {
+    int n = 0, x0 = 0;
+    for (int px = r.x; px <= r.x + r.w; ++px) {
+      const int i = px - box.x;
+      const uint8_t v = px < r.x + r.w ? nibble(a, i) : 0;
+      if (v >= minA) {
+        if (!n) x0 = px;
+        run[n++] = !c ? ramp[v] : (opaque && v != 0x0F) ? blend565(c[i], bg, AaText::kAlpha[v]) : c[i];
+      } else if (n) {
+        g->draw16bitRGBBitmap(x0, yy, run, n, 1);
+        n = 0;
+      }
+    }
+    if (c) c += icon.bw;
+  }
+}
+
+} // namespace ui_gfx
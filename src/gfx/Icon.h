@@ -0,0 +1,33 @@
+#pragma once
+#include <Arduino_GFX_Library.h>
+#include <stdint.h>
+#include "gfx/Compositor.h"
+
+namespace ui_gfx {
+
+// Pre-converted icon as generated by tools/make_icon_assets.py (see gfx/icons/).
+// Only the ink box is stored: 4-bit alpha, two pixels per byte (high nibble first),
+// rows padded to whole bytes, and RGB565 colours unless every pixel shares one.
+struct Icon {
+  const uint16_t* rgb;  // bw x bh, or nullptr for a single-colour icon
+  const uint8_t* alpha;
+  uint16_t color;       // of every pixel when rgb is nullptr
+  uint8_t w, h;         // full size, for layout
+  uint8_t bx, by;       // ink box inside it
+  uint8_t bw, bh;
+};
+
+// Draws icons straight from flash: no decode, no line buffers in the caller.
+// (x, y) is the top-left corner of the full w x h icon.
+class IconBlit {
+public:
+  // Blends the icon into an RGB565 frame (row pitch stride, sys::kScreenW x
+  // sys::kScreenH) within clip
+  static void draw(uint16_t* dst, int stride, const Rect& clip, const Icon& icon, int16_t x, int16_t y);
+  // Through a display that cannot be read back: alpha is blended against bg when
+  // opaque, otherwise pixels of at least half alpha are set. One bitmap call per
+  // run of drawn pixels.
+  static void draw(Arduino_GFX* g, const Icon& icon, int16_t x, int16_t y, uint16_t bg, bool opaque);
+};
+
+} // namespace ui_gfx
@@ -0,0 +1,72 @@
+#pragma once
+#include <Arduino_GFX_Library.h>
+#include "base/Config.h"
+#include "gfx/Compositor.h"
+#include "gfx/GfxCompat.h"
+#include "gfx/FramebufferPool.h"
+
+namespace ui_gfx {
+
+// Headless display: an RGB565 frame in a FramebufferPool slab with no panel behind it.
+// Screens draw into it exactly as into the panel (the full Arduino_GFX API: fonts,
+// triangles, circles, bitmaps) while every primitive that reaches the frame is counted,
+// so a render can be timed and sized without the bus. Used by the UI benchmark.
+class MemDisplay : public SlabCanvas {
+public:
+  typedef GfxCoord Coord;
+  typedef GfxBitmapCoord BitmapCoord;
+
+  struct Counters {
+    uint32_t calls = 0;   // primitives written to the frame (pixel, span, rect, bitmap)
+    uint32_t pixels = 0;  // pixels they covered, clipped to the screen
+  };
+
+  // begin(GFX_SKIP_OUTPUT_BEGIN) before drawing, as for any canvas
+  explicit MemDisplay(FbLease&& slab) : SlabCanvas(std::move(slab), nullptr) {}
+
+  const Counters& counters() const { return counters_; }
+  void resetCounters() { counters_ = Counters{}; }
+
+  void writePixelPreclipped(Coord x, Coord y, uint16_t color) override {
+    Count c(*this, 1, 1);
+    SlabCanvas::writePixelPreclipped(x, y, color);
+  }
+  void writeFastVLine(Coord x, Coord y, Coord h, uint16_t color) override {
+    Count c(*this, x, y, 1, h);
+    SlabCanvas::writeFastVLine(x, y, h, color);
+  }
+  void writeFastHLine(Coord x, Coord y, Coord w, uint16_t color) override {
+    Count c(*this, x, y, w, 1);
+    SlabCanvas::writeFastHLine(x, y, w, color);
+  }
+  void writeFillRectPreclipped(Coord x, Coord y, Coord w, Coord h, uint16_t color) override {
+    Count c(*this, x, y, w, h);
+    SlabCanvas::writeFillRectPreclipped(x, y, w, h, color);
+  }
+  using SlabCanvas::draw16bitRGBBitmap;
+  void draw16bitRGBBitmap(BitmapCoord x, BitmapCoord y, uint16_t* bitmap, BitmapCoord w, BitmapCoord h) override {
+    Count c(*this, x, y, w, h);
+    SlabCanvas::draw16bitRGBBitmap(x, y, bitmap, w, h);
+  }
+
+private:
+  // Counts only the outermost primitive: a canvas implementation that builds one
+  // primitive from another is still one call
+  struct Count {
+    MemDisplay& d;
+    Count(MemDisplay& disp, int32_t calls, uint32_t px) : d(disp) {
+      if (d.depth_++) return;
+      d.counters_.calls += calls;
+      d.counters_.pixels += px;
+    }
+    Count(MemDisplay& disp, int32_t x, int32_t y, int32_t w, int32_t h)
+      : Count(disp, 1, (uint32_t)Rect{(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h}
+                         .intersected(Rect{0, 0, (int16_t)sys::kScreenW, (int16_t)sys::kScreenH}).area()) {}
+    ~Count() { --d.depth_; }
+  };
+
+  Counters counters_;
+  int depth_ = 0;
+};
+
+} // namespace ui_gfx
@@ -0,0 +1,43 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ui_gfx {
+
+// fg over bg with alpha 0..32, all three channels in one 32-bit multiply: green moves
+// to the upper half-word so every channel has headroom for the product
+inline uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha32) {
+  uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81Fu;
+  uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81Fu;
+  b += ((f - b) * alpha32) >> 5;
+  b &= 0x07E0F81Fu;
+  return (uint16_t)(b | (b >> 16));
+}
+
+// Two pixels of a 32-bit word at once: the even fields (B0, R0, G1) stay in place and
+// the odd ones (G0, B1, R1) move down five bits, which leaves every channel the same
+// headroom as in blend565. Same result as blend565 on each half.
+inline uint32_t blend565x2(uint32_t fg, uint32_t bg, uint8_t alpha32) {
+  const uint32_t even = 0x07E0F81Fu, odd = 0x07C0F83Fu;
+  uint32_t fe = fg & even, be = bg & even;
+  uint32_t fo = (fg >> 5) & odd, bo = (bg >> 5) & odd;
+  be += ((fe - be) * alpha32) >> 5;
+  bo += ((fo - bo) * alpha32) >> 5;
+  return (be & even) | ((bo & odd) << 5);
+}
+
+// dst[i] = fg[i] over bg[i] for n pixels, word by word when the three rows share their
+// alignment (rows of full-screen slabs do); dst may be fg or bg
+inline void blend565Row(uint16_t* dst, const uint16_t* fg, const uint16_t* bg, int n, uint8_t alpha32) {
+  if (n > 0 && ((uintptr_t)dst & 2)) { *dst++ = blend565(*fg++, *bg++, alpha32); --n; }
+  if ((((uintptr_t)fg | (uintptr_t)bg) & 2) == 0) {
+    uint32_t* d = (uint32_t*)dst;
+    const uint32_t* f = (const uint32_t*)fg;
+    const uint32_t* b = (const uint32_t*)bg;
+    for (int i = 0; i < n / 2; ++i) d[i] = blend565x2(f[i], b[i], alpha32);
+    dst += n & ~1; fg += n & ~1; bg += n & ~1; n &= 1;
+  }
+  for (int i = 0; i < n; ++i) dst[i] = blend565(fg[i], bg[i], alpha32);
+}
+
+} // namespace ui_gfx
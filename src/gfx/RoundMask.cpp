@@ -0,0 +1,59 @@
+#include "gfx/RoundMask.h"
+#include <cmath>
+
+namespace ui_gfx {
+
+namespace {
+
+static_assert(sys::kScreenW == sys::kScreenH && sys::kScreenW / 2 <= 255, "square panel, starts fit a byte");
+
+// First visible column of the upper half's rows; the lower half mirrors it
+struct SpanTable {
+  uint8_t start[sys::kScreenH / 2];
+  SpanTable() {
+    // Pixel x of row y is visible when it overlaps the circle's chord along the
+    // row's pixel edge nearer the centre
+    const double r = sys::kScreenW / 2.0;
+    for (int y = 0; y < sys::kScreenH / 2; ++y) {
+      const double dy = r - (y + 1);
+      const int x0 = (int)floor(r - sqrt(r * r - dy * dy));
+      start[y] = sys::kRoundPanel ? (uint8_t)x0 : 0;
+    }
+  }
+};
+
+const SpanTable& table() {
+  static const SpanTable t;
+  return t;
+}
+
+} // namespace
+
+int16_t RoundMask::rowStart(int y) {
+  if (y < 0 || y >= sys::kScreenH) return sys::kScreenW / 2;
+  return table().start[y < sys::kScreenH / 2 ? y : sys::kScreenH - 1 - y];
+}
+
+bool RoundMask::clipRow(int y, int& x, int& w) {
+  const int x0 = rowStart(y), x1 = sys::kScreenW - x0;
+  if (x < x0) { w -= x0 - x; x = x0; }
+  if (x + w > x1) w = x1 - x;
+  return w > 0;
+}
+
+bool RoundMask::contains(int x, int y, int w, int h) {
+  if (w <= 0 || h <= 0) return true;
+  const int x0 = rowStart(y) > rowStart(y + h - 1) ? rowStart(y) : rowStart(y + h - 1);
+  return x >= x0 && x + w <= sys::kScreenW - x0;
+}
+
+uint32_t RoundMask::visiblePixels(int x, int y, int w, int h) {
+  uint32_t n = 0;
+  for (int row = y; row < y + h; ++row) {
+    int cx = x, cw = w;
+    if (clipRow(row, cx, cw)) n += (uint32_t)cw;
+  }
+  return n;
+}
+
+} // namespace ui_gfx
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+#include "base/Config.h"
+
+namespace ui_gfx {
+
+// Visible area of the round panel as a per-row span table: row y shows the columns
+// [rowStart(y), sys::kScreenW - rowStart(y)), every pixel the inscribed circle touches.
+// About a fifth of the square lies outside it. With sys::kRoundPanel off every row is
+// fully visible.
+class RoundMask {
+public:
+  static int16_t rowStart(int y);
+  static int16_t rowEnd(int y) { return (int16_t)(sys::kScreenW - rowStart(y)); }
+
+  // Clips the span [x, x + w) of row y to the visible columns; false when none is left
+  static bool clipRow(int y, int& x, int& w);
+  // Whether all of the rectangle is visible (its corners are inside the circle)
+  static bool contains(int x, int y, int w, int h);
+  // Visible pixels of a rectangle
+  static uint32_t visiblePixels(int x, int y, int w, int h);
+};
+
+} // namespace ui_gfx
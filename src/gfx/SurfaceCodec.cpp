@@ -0,0 +1,114 @@
+#include "gfx/SurfaceCodec.h"
+
+namespace ui_gfx {
+
+namespace {
+enum : uint8_t { kOpIndex = 0x00, kOpDiff = 0x40, kOpLuma = 0x80, kOpRun = 0xC0, kOpRaw = 0xFE };
+static constexpr int kMaxRun = 62;
+
+inline int hash565(uint16_t p) { return ((p >> 11) * 3 + ((p >> 5) & 63) * 5 + (p & 31) * 7) & 63; }
+}
+
+bool SurfaceEncoder::encode(const uint16_t* px, int w, int h, Surface& out, size_t maxBytes) {
+  out.w = 0; out.h = 0; out.data.clear();
+  if (!px || w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF) return false;
+  const size_t n = (size_t)w * h;
+  if (!maxBytes) maxBytes = n * sizeof(uint16_t);
+  std::vector<uint8_t>& o = out.data;
+  o.reserve(maxBytes / 2);
+
+  uint16_t index[64] = {};
+  uint16_t prev = 0;
+  int run = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const uint16_t p = px[i];
+    if (p == prev) {
+      if (++run == kMaxRun) { o.push_back((uint8_t)(kOpRun | (run - 1))); run = 0; }
+      continue;
+    }
+    if (run) { o.push_back((uint8_t)(kOpRun | (run - 1))); run = 0; }
+    if (o.size() + 3 > maxBytes) { o.clear(); return false; }
+
+    const int hi = hash565(p);
+    if (index[hi] == p) {
+      o.push_back((uint8_t)(kOpIndex | hi));
+    } else {
+      index[hi] = p;
+      // Channel deltas wrap within their bit width, as the decoder reconstructs modulo
+      int dr = (((p >> 11) - (prev >> 11) + 16) & 31) - 16;
+      int dg = ((((p >> 5) & 63) - ((prev >> 5) & 63) + 32) & 63) - 32;
+      int db = (((p & 31) - (prev & 31) + 16) & 31) - 16;
+      int drg = dr - (dg >> 1), dbg = db - (dg >> 1);
+      if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+        o.push_back((uint8_t)(kOpDiff | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+      } else if (drg >= -8 && drg <= 7 && dbg >= -8 && dbg <= 7) {
+        o.push_back((uint8_t)(kOpLuma | (dg + 32)));
+        o.push_back((uint8_t)(((drg + 8) << 4) | (dbg + 8)));
+      } else {
+        o.push_back(kOpRaw);
+        o.push_back((uint8_t)(p >> 8));
+        o.push_back((uint8_t)p);
+      }
+    }
+    prev = p;
+  }
+  if (run) o.push_back((uint8_t)(kOpRun | (run - 1)));
+  if (o.size() > maxBytes) { o.clear(); return false; }
+  o.shrink_to_fit();
+  out.w = (uint16_t)w; out.h = (uint16_t)h;
+  return true;
+}
+
+bool SurfaceDecoder::readRows(uint16_t* dst, int rows) {
+  if (!dst || rows < 0 || row_ + rows > s_.h) return false;
+  const uint8_t* d = s_.data.data();
+  const size_t len = s_.data.size();
+  size_t left = (size_t)rows * s_.w;
+  uint16_t* o = dst;
+  // A run may span rows (and calls)
+  while (left && run_) { *o++ = prev_; --run_; --left; }
+  while (left) {
+    if (pos_ >= len) return false;
+    const uint8_t b = d[pos_++];
+    uint16_t p;
+    if (b == kOpRaw) {
+      if (pos_ + 2 > len) return false;
+      p = (uint16_t)((d[pos_] << 8) | d[pos_ + 1]);
+      pos_ += 2;
+      index_[hash565(p)] = p;
+    } else if ((b & 0xC0) == kOpRun) {
+      if (b == 0xFF) return false; // reserved
+      int n = (b & 0x3F) + 1;
+      int now = (size_t)n < left ? n : (int)left;
+      for (int i = 0; i < now; ++i) *o++ = prev_;
+      left -= now;
+      run_ = n - now;
+      continue;
+    } else if ((b & 0xC0) == kOpIndex) {
+      p = index_[b & 0x3F];
+    } else {
+      int dr, dg, db;
+      if ((b & 0xC0) == kOpDiff) {
+        dr = ((b >> 4) & 3) - 2; dg = ((b >> 2) & 3) - 2; db = (b & 3) - 2;
+      } else {
+        if (pos_ >= len) return false;
+        const uint8_t b2 = d[pos_++];
+        dg = (b & 0x3F) - 32;
+        dr = (dg >> 1) + (b2 >> 4) - 8;
+        db = (dg >> 1) + (b2 & 15) - 8;
+      }
+      int r = ((prev_ >> 11) + dr) & 31;
+      int g = (((prev_ >> 5) & 63) + dg) & 63;
+      int bl = ((prev_ & 31) + db) & 31;
+      p = (uint16_t)((r << 11) | (g << 5) | bl);
+      index_[hash565(p)] = p;
+    }
+    *o++ = p;
+    prev_ = p;
+    --left;
+  }
+  row_ += rows;
+  return true;
+}
+
+} // namespace ui_gfx
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ui_gfx {
+
+// Compressed RGB565 surface: a QOI-style byte stream adapted to 5/6/5 channels.
+//   00iiiiii          pixel from the 64-entry recent-colour table
+//   01rrggbb          small delta to the previous pixel (each -2..1)
+//   10gggggg rrrrbbbb green delta -32..31, red/blue delta relative to green/2 (-8..7)
+//   11llllll          repeat previous pixel 1..62 times (0xC0..0xFD)
+//   0xFE hi lo        literal pixel
+// Rows are not byte aligned; the decoder streams them in order.
+struct Surface {
+  uint16_t w = 0, h = 0;
+  std::vector<uint8_t> data;
+
+  size_t rawBytes() const { return (size_t)w * h * sizeof(uint16_t); }
+  size_t packedBytes() const { return data.size(); }
+};
+
+class SurfaceEncoder {
+public:
+  // Gives up (returns false) once the stream would exceed maxBytes; 0 means raw size
+  static bool encode(const uint16_t* px, int w, int h, Surface& out, size_t maxBytes = 0);
+};
+
+class SurfaceDecoder {
+public:
+  explicit SurfaceDecoder(const Surface& s) : s_(s) {}
+
+  // Decodes the next `rows` rows into dst (stride w). False on a corrupt or short stream.
+  bool readRows(uint16_t* dst, int rows);
+  bool readAll(uint16_t* dst) { return readRows(dst, s_.h - row_); }
+
+  int row() const { return row_; }
+
+private:
+  const Surface& s_;
+  size_t pos_ = 0;
+  int row_ = 0;
+  int run_ = 0;
+  uint16_t prev_ = 0;
+  uint16_t index_[64] = {};
+};
+
+} // namespace ui_gfx
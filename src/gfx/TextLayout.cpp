@@ -0,0 +1,104 @@
+#include "gfx/TextLayout.h"
+
+namespace ui_gfx {
+
+namespace {
+
+uint32_t fnv1a(const char* s, size_t n) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < n; ++i) { h ^= (uint8_t)s[i]; h *= 16777619u; }
+  return h;
+}
+
+} // namespace
+
+void TextLayout::wrap(const AaFont& font, const char* text, size_t n, int16_t maxW, int maxLines, WrappedText& out) {
+  out.lines.clear();
+  out.complete = true;
+  if (!text) return;
+  const char* const end = text + n;
+  const int32_t limit = (int32_t)maxW << 4;
+  const char* line = text;       // first byte of the current line
+  const char* brk = nullptr;     // first byte after the last run of spaces on it
+  int32_t pen = 0, ink = 0;      // advance of the line, and up to its last non-space glyph (1/16 px)
+  int32_t brkPen = 0, brkInk = 0;
+  const AaGlyph* prev = nullptr;
+  bool newline = false;          // the text so far ends with '\n'
+
+  // false once maxLines is reached; complete then says whether anything but
+  // white space was left
+  auto emit = [&](const char* from, const char* to, int32_t w, const char* rest) {
+    out.lines.push_back(LineBreak{(uint16_t)(from - text), (uint16_t)(to - from), (int16_t)((w + 8) >> 4)});
+    if (maxLines <= 0 || (int)out.lines.size() < maxLines) return true;
+    for (const char* r = rest; r < end && *r; ++r) {
+      if (*r != ' ' && *r != '\n' && *r != '\r') { out.complete = false; break; }
+    }
+    return false;
+  };
+
+  const char* p = text;
+  while (p < end && *p) {
+    const char* at = p;
+    const uint32_t cp = AaText::nextCodepoint(p);
+    newline = cp == '\n';
+    if (newline) {
+      if (!emit(line, at, ink, p)) return;
+      line = p; brk = nullptr; pen = ink = 0; prev = nullptr;
+      continue;
+    }
+    if (cp < 0x20) continue;
+    const AaGlyph* g = AaText::glyph(font, cp);
+    if (!g) continue;
+    int32_t step = (prev ? font.kerning[prev->kernLeft * font.kernStride + g->kernRight] : 0) + g->advance;
+    prev = g;
+    if (cp == ' ') {
+      // Spaces never overflow a line: trailing ones hang past the margin
+      pen += step;
+      brk = p; brkPen = pen; brkInk = ink;
+      continue;
+    }
+    if (pen + step > limit && at > line) {
+      if (brk && brkInk > 0) {
+        if (!emit(line, brk, brkInk, brk)) return;
+        // The word in progress moves to the new line
+        pen -= brkPen; ink = pen;
+        line = brk; brk = nullptr;
+      }
+      if (pen + step > limit && at > line) {
+        // A word wider than the line: break before this glyph
+        if (!emit(line, at, ink, at)) return;
+        line = at; pen = ink = 0;
+        step = g->advance;
+      }
+    }
+    pen += step;
+    ink = pen;
+  }
+  if (p > line || newline) emit(line, p, ink, p);
+}
+
+const WrappedText& LayoutCache::get(const char* text, size_t n, const AaFont& font, int16_t maxW, int maxLines) {
+  const uint32_t h = fnv1a(text, n);
+  ++clock_;
+  Slot* victim = &slots_[0];  // first empty slot, else the least recently used
+  for (Slot& s : slots_) {
+    if (s.used && s.hash == h && s.len == n && s.font == &font && s.maxW == maxW && s.maxLines == maxLines) {
+      s.used = clock_;
+      stats_.hits++;
+      return s.layout;
+    }
+    if (victim->used && (!s.used || s.used < victim->used)) victim = &s;
+  }
+  stats_.misses++;
+  victim->hash = h; victim->len = n; victim->font = &font;
+  victim->maxW = maxW; victim->maxLines = (int16_t)maxLines;
+  victim->used = clock_;
+  TextLayout::wrap(font, text, n, maxW, maxLines, victim->layout);
+  return victim->layout;
+}
+
+void LayoutCache::clear() {
+  for (Slot& s : slots_) { s.used = 0; s.layout = WrappedText{}; }
+}
+
+} // namespace ui_gfx
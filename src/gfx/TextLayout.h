@@ -0,0 +1,64 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#include "gfx/AaFont.h"
+
+namespace ui_gfx {
+
+// One wrapped line: bytes [start, start + len) of the laid-out text. len includes
+// the spaces the line was broken after; width (advance in pixels) does not.
+struct LineBreak {
+  uint16_t start;
+  uint16_t len;
+  int16_t width;
+};
+
+struct WrappedText {
+  std::vector<LineBreak> lines;
+  bool complete = true;  // false when maxLines cut off part of the text
+};
+
+// Word wrap from the font's advance and kerning tables, one pass over the text
+// with no drawing and no temporary strings.
+class TextLayout {
+public:
+  // Greedy: lines break after spaces, at '\n' (an empty line stays a line) and
+  // inside words wider than maxW. maxLines 0 means unlimited.
+  static void wrap(const AaFont& font, const char* text, size_t n, int16_t maxW, int maxLines, WrappedText& out);
+};
+
+// Small LRU of wrapped layouts keyed by text hash and length, font, width and line
+// limit. A title change wraps once; redraws and reopened pages only hash the text.
+class LayoutCache {
+public:
+  static constexpr int kSlots = 6;
+
+  struct Stats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+  };
+
+  // The reference stays valid until a later get() evicts it
+  const WrappedText& get(const char* text, size_t n, const AaFont& font, int16_t maxW, int maxLines = 0);
+  const WrappedText& get(const String& text, const AaFont& font, int16_t maxW, int maxLines = 0) {
+    return get(text.c_str(), text.length(), font, maxW, maxLines);
+  }
+  void clear();
+  const Stats& stats() const { return stats_; }
+
+private:
+  struct Slot {
+    uint32_t hash = 0;
+    uint32_t len = 0;
+    const AaFont* font = nullptr;
+    int16_t maxW = 0;
+    int16_t maxLines = 0;
+    uint32_t used = 0;  // 0: empty
+    WrappedText layout;
+  };
+  Slot slots_[kSlots];
+  uint32_t clock_ = 0;
+  Stats stats_;
+};
+
+} // namespace ui_gfx
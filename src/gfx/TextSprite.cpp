@@ -0,0 +1,159 @@
+#include "gfx/TextSprite.h"
+#include "base/Config.h"
+#include "esp_heap_caps.h"
+#include "gfx/Rgb565.h"
+
+namespace ui_gfx {
+
+bool TextSprite::render(const char* text, const AaFont& font) {
+  release();
+  if (!text || !*text) return false;
+  const Rect ink = AaText::bounds(font, text, 0, 0);
+  if (ink.empty()) return false;
+  w_ = (int16_t)(ink.w + 2); h_ = (int16_t)(ink.h + 2);
+  ox_ = (int16_t)(ink.x - 1); oy_ = (int16_t)(ink.y - 1);
+  mask_ = (uint8_t*)heap_caps_malloc(bytes(), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!mask_) mask_ = (uint8_t*)heap_caps_malloc(bytes(), MALLOC_CAP_8BIT);
+  if (!mask_) return false;
+  memset(mask_, 0, bytes());
+  AaText::coverage(mask_, w_, w_, h_, font, -ox_, -oy_, text);
+
+  // Outline: the strongest coverage among the eight neighbours, read from the low
+  // nibbles only so the pass can run in place
+  for (int y = 0; y < h_; ++y) {
+    uint8_t* row = mask_ + (size_t)y * w_;
+    for (int x = 0; x < w_; ++x) {
+      uint8_t o = 0;
+      for (int dy = -1; dy <= 1; ++dy) {
+        if (y + dy < 0 || y + dy >= h_) continue;
+        const uint8_t* n = row + dy * w_;
+        for (int dx = -1; dx <= 1; ++dx) {
+          if ((!dx && !dy) || x + dx < 0 || x + dx >= w_) continue;
+          uint8_t a = n[x + dx] & 0x0F;
+          if (a > o) o = a;
+        }
+      }
+      row[x] |= (uint8_t)(o << 4);
+    }
+  }
+  return true;
+}
+
+void TextSprite::release() {
+  if (mask_) heap_caps_free(mask_);
+  mask_ = nullptr;
+  w_ = h_ = 0;
+}
+
+void TextSprite::blit(uint16_t* dst, int stride, int16_t x, int16_t y, const Rect& clip, uint16_t ink, bool outline) const {
+  if (!mask_ || !dst) return;
+  const Rect b = box(x, y);
+  const Rect r = b.intersected(clip).intersected(Rect{0, 0, (int16_t)sys::kScreenW, (int16_t)sys::kScreenH});
+  if (r.empty()) return;
+  const uint8_t* m = mask_ + (size_t)(r.y - b.y) * w_ + (r.x - b.x);
+  uint16_t* d = dst + (size_t)r.y * stride + r.x;
+  for (int row = 0; row < r.h; ++row, m += w_, d += stride) {
+    for (int i = 0; i < r.w; ++i) {
+      const uint8_t v = m[i];
+      if (!v) continue;
+      const uint8_t a = v & 0x0F, o = v >> 4;
+      if (a == 0x0F) { d[i] = ink; continue; }
+      uint16_t px = d[i];
+      if (outline && o) px = blend565(BLACK, px, AaText::kAlpha[o]);
+      d[i] = a ? blend565(ink, px, AaText::kAlpha[a]) : px;
+    }
+  }
+}
+
+bool GlyphStrip::render(const AaFont& font, const char* chars) {
+  release();
+  // Cells: the glyph's advance, digits widened to the widest digit; the strip is as
+  // tall as the ink of all of them together
+  Rect ink;
+  int16_t digitW = 0;
+  for (const char* p = chars; *p && count_ < kMaxChars; ++p) {
+    const char s[2] = {*p, 0};
+    const int16_t adv = AaText::width(font, s);
+    if (*p >= '0' && *p <= '9' && adv > digitW) digitW = adv;
+    ink = ink.united(AaText::bounds(font, s, 0, 0));
+    cells_[count_++] = Cell{*p, 0, adv, 0};
+  }
+  if (!count_ || ink.empty()) { count_ = 0; return false; }
+  for (int i = 0; i < count_; ++i) {
+    Cell& k = cells_[i];
+    if (k.c >= '0' && k.c <= '9') { k.pen = (int16_t)((digitW - k.w) / 2); k.w = digitW; }
+    k.x = w_;
+    w_ += k.w;
+  }
+  h_ = ink.h; oy_ = ink.y;
+  mask_ = (uint8_t*)heap_caps_malloc((size_t)w_ * h_, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!mask_) mask_ = (uint8_t*)heap_caps_malloc((size_t)w_ * h_, MALLOC_CAP_8BIT);
+  if (!mask_) { count_ = 0; w_ = h_ = 0; return false; }
+  memset(mask_, 0, (size_t)w_ * h_);
+  for (int i = 0; i < count_; ++i) {
+    const Cell& k = cells_[i];
+    const char s[2] = {k.c, 0};
+    // Clipped to the cell: ink past the advance would show up in the neighbour
+    AaText::coverage(mask_ + k.x, w_, k.w, h_, font, k.pen, -oy_, s);
+  }
+  return true;
+}
+
+void GlyphStrip::release() {
+  if (mask_) heap_caps_free(mask_);
+  mask_ = nullptr;
+  w_ = h_ = oy_ = 0;
+  count_ = 0;
+}
+
+int16_t GlyphStrip::width(const char* s) const {
+  int16_t w = 0;
+  for (; *s; ++s) w += advance(*s);
+  return w;
+}
+
+void GlyphStrip::blit(uint16_t* dst, int stride, char c, int16_t x, int16_t y, const Rect& clip, uint16_t color) const {
+  const Cell* k = cell(c);
+  if (!mask_ || !dst || !k) return;
+  const Rect b = box(c, x, y);
+  const Rect r = b.intersected(clip).intersected(Rect{0, 0, (int16_t)sys::kScreenW, (int16_t)sys::kScreenH});
+  if (r.empty()) return;
+  const uint8_t* m = mask_ + (size_t)(r.y - b.y) * w_ + k->x + (r.x - b.x);
+  uint16_t* d = dst + (size_t)r.y * stride + r.x;
+  for (int row = 0; row < r.h; ++row, m += w_, d += stride) {
+    for (int i = 0; i < r.w; ++i) {
+      const uint8_t a = m[i];
+      if (a == 0x0F) d[i] = color;
+      else if (a) d[i] = blend565(color, d[i], AaText::kAlpha[a]);
+    }
+  }
+}
+
+const TextSprite* TextCache::get(const String& text, const AaFont* font) {
+  ++clock_;
+  Slot* victim = nullptr; // first empty slot, else the least recently used
+  for (Slot& s : slots_) {
+    if (s.sprite.valid() && s.font == font && s.text == text) {
+      s.used = clock_;
+      stats_.hits++;
+      return &s.sprite;
+    }
+    if (!victim || (victim->sprite.valid() && (!s.sprite.valid() || s.used < victim->used))) victim = &s;
+  }
+  stats_.misses++;
+  stats_.bytes -= victim->sprite.bytes();
+  victim->sprite.release();
+  victim->text = text;
+  victim->font = font;
+  victim->used = clock_;
+  if (!font || !victim->sprite.render(text.c_str(), *font)) { victim->text = ""; return nullptr; }
+  stats_.bytes += victim->sprite.bytes();
+  return &victim->sprite;
+}
+
+void TextCache::clear() {
+  for (Slot& s : slots_) { s.sprite.release(); s.text = ""; s.font = nullptr; }
+  stats_.bytes = 0;
+}
+
+} // namespace ui_gfx
@@ -0,0 +1,119 @@
+#pragma once
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include "gfx/AaFont.h"
+#include "gfx/Compositor.h"
+
+namespace ui_gfx {
+
+// One line of text rasterised once into a byte mask with a baked 1 px outline:
+// glyph coverage in the low nibble, the coverage dilated by one pixel (the outline)
+// in the high nibble. Painting it is a single blended pass over an RGB565 surface
+// instead of nine passes through the font renderer (eight outline offsets plus the fill).
+class TextSprite {
+public:
+  TextSprite() = default;
+  ~TextSprite() { release(); }
+  TextSprite(TextSprite&& o) noexcept { take(o); }
+  TextSprite& operator=(TextSprite&& o) noexcept { if (this != &o) { release(); take(o); } return *this; }
+  TextSprite(const TextSprite&) = delete;
+  TextSprite& operator=(const TextSprite&) = delete;
+
+  // Rasterises text in font; false when it is blank or memory ran out
+  bool render(const char* text, const AaFont& font);
+  void release();
+  bool valid() const { return mask_ != nullptr; }
+
+  // Mask box relative to the text origin (cursor/baseline), outline included
+  Rect box(int16_t x, int16_t y) const { return Rect{(int16_t)(x + ox_), (int16_t)(y + oy_), w_, h_}; }
+  size_t bytes() const { return (size_t)w_ * h_; }
+
+  // Composites the text with its origin at (x,y) into dst (row pitch stride pixels,
+  // sys::kScreenW x sys::kScreenH) within clip: ink blended by glyph coverage over
+  // a black outline when outline is set, the surface untouched elsewhere
+  void blit(uint16_t* dst, int stride, int16_t x, int16_t y, const Rect& clip, uint16_t ink, bool outline) const;
+
+private:
+  void take(TextSprite& o) { mask_ = o.mask_; w_ = o.w_; h_ = o.h_; ox_ = o.ox_; oy_ = o.oy_; o.mask_ = nullptr; }
+
+  uint8_t* mask_ = nullptr;
+  int16_t w_ = 0, h_ = 0;
+  int16_t ox_ = 0, oy_ = 0;
+};
+
+// A fixed set of characters (time labels: "0123456789:") rasterised once into one
+// coverage strip, each in its own cell. Digits share the width of the widest one, so
+// a label keeps its layout while its value changes and a changed character repaints
+// only its cell, copied from the strip instead of going through the font renderer.
+class GlyphStrip {
+public:
+  GlyphStrip() = default;
+  ~GlyphStrip() { release(); }
+  GlyphStrip(const GlyphStrip&) = delete;
+  GlyphStrip& operator=(const GlyphStrip&) = delete;
+
+  static constexpr int kMaxChars = 16;
+
+  // ASCII characters only; false when memory ran out
+  bool render(const AaFont& font, const char* chars);
+  void release();
+  bool valid() const { return mask_ != nullptr; }
+
+  bool has(char c) const { return cell(c) != nullptr; }
+  // Cell width; the pen moves by it. 0 for characters not in the strip.
+  int16_t advance(char c) const { const Cell* k = cell(c); return k ? k->w : 0; }
+  // Where the font renderer would put the glyph's pen inside its cell
+  int16_t penOffset(char c) const { const Cell* k = cell(c); return k ? k->pen : 0; }
+  // Pen advance of a string made of strip characters
+  int16_t width(const char* s) const;
+  // Cell box of c with the pen at (x, y) on the baseline
+  Rect box(char c, int16_t x, int16_t y) const { return Rect{x, (int16_t)(y + oy_), advance(c), h_}; }
+
+  // Blends the cell of c with the pen at (x,y) into dst (row pitch stride pixels,
+  // sys::kScreenW x sys::kScreenH) within clip
+  void blit(uint16_t* dst, int stride, char c, int16_t x, int16_t y, const Rect& clip, uint16_t color) const;
+
+private:
+  struct Cell { char c; int16_t x, w, pen; };
+  const Cell* cell(char c) const {
+    for (int i = 0; i < count_; ++i) if (cells_[i].c == c) return &cells_[i];
+    return nullptr;
+  }
+
+  uint8_t* mask_ = nullptr;  // coverage 0..15, w_ x h_
+  int16_t w_ = 0, h_ = 0, oy_ = 0;
+  Cell cells_[kMaxChars];
+  int count_ = 0;
+};
+
+// Small LRU of text sprites keyed by string and font. Title and artist lines are
+// rasterised when they change; every later repaint (cover change, overlapping
+// header or progress update) reuses the mask.
+class TextCache {
+public:
+  static constexpr int kSlots = 8;
+
+  struct Stats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    size_t bytes = 0;   // mask memory held by all slots
+  };
+
+  // nullptr when the text cannot be rasterised
+  const TextSprite* get(const String& text, const AaFont* font);
+  void clear();
+  const Stats& stats() const { return stats_; }
+
+private:
+  struct Slot {
+    String text;
+    const AaFont* font = nullptr;
+    TextSprite sprite;
+    uint32_t used = 0;
+  };
+  Slot slots_[kSlots];
+  uint32_t clock_ = 0;
+  Stats stats_;
+};
+
+} // namespace ui_gfx
@@ -0,0 +1,12 @@
+#pragma once
+#include "gfx/AaFont.h"
+
+namespace ui_gfx {
+
+// Atlases generated by tools/make_font_atlas.py. Sizes match the cap height of the
+// Adafruit FreeSansBold fonts they replace (12/18/24 pt).
+extern const AaFont kAaSans12;  // Latin-1, Latin Extended-A (as far as the font has it), punctuation
+extern const AaFont kAaSans18;  // same charset
+extern const AaFont kAaSans24;  // ASCII only: clock and status messages
+
+} // namespace ui_gfx
@@ -0,0 +1,1226 @@
+// Generated by tools/make_font_atlas.py - do not edit
+// Lato Regular (SIL OFL 1.1), 24 px em, charset latin: 232 glyphs, 4523 kerning pairs in 28x28 classes, 22602 bitmap bytes
+#include "gfx/fonts/AaFonts.h"
+
+namespace ui_gfx {
+
+namespace {
+
+const uint8_t kBitmap[] = {
+  0x0d,0xf2,0x0d,0xf2,0x0d,0xf2,0x0d,0xf2,0x0d,0xf2,0x0d,0xf2,0x0d,0xf2,0x0d,0xf2,0x0c,0xf1,0x0b,0xf0,0x0a,0xe0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xe5,0x3d,0xe5,0x3f,0xa0,0x3f,0xa0,0x3f,0xa0,0x3f,0xa0,0x3f,0xa0,0x3f,0xa0,0x2f,0xa0,
+  0x2f,0xa0,0x1f,0x80,0x1f,0x80,0x0c,0x50,0x0c,0x50,0x00,0x00,0x0a,0xd0,0x02,0xf7,0x00,0x00,0x00,0x1f,0xa0,0x05,0xf7,0x00,
+  0x00,0x00,0x4f,0x70,0x08,0xf4,0x00,0x00,0x00,0x7f,0x40,0x0b,0xf1,0x00,0x00,0x00,0xaf,0x10,0x0e,0xc0,0x00,0x06,0xff,0xff,
+  0xff,0xff,0xff,0xf3,0x0b,0xff,0xff,0xff,0xff,0xff,0xd0,0x00,0x02,0xfa,0x00,0x6f,0x50,0x00,0x00,0x06,0xf6,0x00,0xaf,0x10,
+  0x00,0x00,0x0a,0xf2,0x00,0xed,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0xff,0x50,0x4f,0xff,0xff,0xff,0xff,0xff,0x60,0x00,0x2f,
+  0xa0,0x06,0xf6,0x00,0x00,0x00,0x5f,0x70,0x09,0xf3,0x00,0x00,0x00,0x8f,0x40,0x0c,0xe0,0x00,0x00,0x00,0xbf,0x10,0x0f,0xc0,
+  0x00,0x00,0x00,0xea,0x00,0x1e,0x90,0x00,0x00,0x00,0x00,0x00,0x9a,0x00,0x00,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,0x05,0xbe,
+  0xfe,0xb6,0x00,0x00,0xaf,0xfe,0xfe,0xff,0xb1,0x06,0xfd,0x30,0xf5,0x29,0xc1,0x0c,0xf4,0x01,0xf4,0x00,0x00,0x0e,0xf1,0x02,
+  0xf3,0x00,0x00,0x0d,0xf6,0x03,0xf2,0x00,0x00,0x08,0xff,0x75,0xf1,0x00,0x00,0x00,0xaf,0xff,0xf6,0x10,0x00,0x00,0x04,0xbf,
+  0xff,0xf8,0x10,0x00,0x00,0x07,0xea,0xff,0xd1,0x00,0x00,0x08,0xc0,0x3e,0xf7,0x00,0x00,0x0a,0xb0,0x07,0xfa,0x00,0x00,0x0b,
+  0xa0,0x06,0xfa,0x04,0x00,0x0c,0x90,0x0a,0xf7,0x7f,0xc3,0x0d,0x80,0x8f,0xe1,0x2c,0xff,0xdf,0xde,0xfe,0x40,0x00,0x6b,0xef,
+  0xfd,0x92,0x00,0x00,0x00,0x1f,0x40,0x00,0x00,0x00,0x00,0x2f,0x40,0x00,0x00,0x00,0x00,0x3e,0x20,0x00,0x00,0x00,0x4c,0xfd,
+  0x70,0x00,0x00,0x00,0x8f,0x70,0x04,0xff,0xff,0xf9,0x00,0x00,0x05,0xfa,0x00,0x0c,0xf6,0x13,0xdf,0x20,0x00,0x2e,0xd1,0x00,
+  0x1f,0xb0,0x00,0x6f,0x60,0x00,0xcf,0x30,0x00,0x2f,0x90,0x00,0x3f,0x70,0x09,0xf6,0x00,0x00,0x1f,0xb0,0x00,0x5f,0x60,0x5f,
+  0xa0,0x00,0x00,0x0c,0xf5,0x13,0xdf,0x22,0xed,0x10,0x00,0x00,0x04,0xff,0xff,0xf8,0x0c,0xf3,0x00,0x00,0x00,0x00,0x4c,0xfd,
+  0x60,0x9f,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xfa,0x01,0x9e,0xfb,0x30,0x00,0x00,0x00,0x2e,0xd1,0x0c,0xff,0xff,0xf3,
+  0x00,0x00,0x01,0xcf,0x30,0x6f,0xa2,0x16,0xfb,0x00,0x00,0x09,0xf6,0x00,0x9f,0x20,0x00,0xce,0x00,0x00,0x6f,0xa0,0x00,0x9f,
+  0x20,0x00,0xbe,0x00,0x03,0xed,0x10,0x00,0x6f,0xa1,0x16,0xfb,0x00,0x1d,0xe3,0x00,0x00,0x0c,0xff,0xff,0xf3,0x00,0xaf,0x50,
+  0x00,0x00,0x01,0x9e,0xfb,0x30,0x00,0x00,0x6c,0xfe,0xb3,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xff,0x40,0x00,0x00,0x00,0x6f,
+  0xe6,0x11,0x8f,0xe0,0x00,0x00,0x00,0xaf,0x80,0x00,0x0a,0xd3,0x00,0x00,0x00,0xaf,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,
+  0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x50,0x00,0x00,0x00,0x00,0x02,0xdf,
+  0x9e,0xf6,0x00,0x00,0xec,0x00,0x1e,0xf4,0x03,0xef,0x70,0x02,0xfa,0x00,0x9f,0x80,0x00,0x3e,0xf8,0x07,0xf6,0x00,0xef,0x30,
+  0x00,0x02,0xef,0xad,0xe1,0x00,0xff,0x30,0x00,0x00,0x2d,0xff,0x80,0x00,0xdf,0xa0,0x00,0x00,0x09,0xff,0xa0,0x00,0x6f,0xfa,
+  0x30,0x15,0xcf,0xcd,0xf8,0x00,0x09,0xff,0xff,0xff,0xf9,0x13,0xef,0x70,0x00,0x5b,0xee,0xd9,0x30,0x00,0x4e,0xf5,0x3f,0xa0,
+  0x3f,0xa0,0x3f,0xa0,0x2f,0xa0,0x1f,0x80,0x0c,0x50,0x00,0x02,0x40,0x00,0x0b,0xf1,0x00,0x4f,0xb0,0x00,0xbf,0x30,0x02,0xfc,
+  0x00,0x08,0xf7,0x00,0x0c,0xf2,0x00,0x0f,0xe0,0x00,0x3f,0xb0,0x00,0x4f,0x90,0x00,0x5f,0x80,0x00,0x6f,0x70,0x00,0x5f,0x80,
+  0x00,0x4f,0x90,0x00,0x3f,0xb0,0x00,0x0e,0xe0,0x00,0x0b,0xf2,0x00,0x07,0xf7,0x00,0x02,0xfc,0x00,0x00,0xbf,0x40,0x00,0x3f,
+  0xb0,0x00,0x0a,0xf1,0x00,0x02,0x30,0x03,0x30,0x00,0x1f,0xc0,0x00,0x0a,0xf5,0x00,0x03,0xfc,0x00,0x00,0xbf,0x30,0x00,0x6f,
+  0x80,0x00,0x1f,0xc0,0x00,0x0d,0xf1,0x00,0x0a,0xf3,0x00,0x08,0xf5,0x00,0x07,0xf6,0x00,0x07,0xf6,0x00,0x07,0xf6,0x00,0x08,
+  0xf5,0x00,0x0b,0xf3,0x00,0x0e,0xf0,0x00,0x2f,0xc0,0x00,0x7f,0x80,0x00,0xcf,0x20,0x03,0xfb,0x00,0x0b,0xf4,0x00,0x1f,0xb0,
+  0x00,0x02,0x20,0x00,0x00,0x0b,0x40,0x00,0x31,0x0b,0x40,0x30,0x8e,0x5b,0x5a,0xe2,0x04,0xde,0xe9,0x10,0x04,0xbe,0xe8,0x10,
+  0x8e,0x6b,0x6a,0xe3,0x31,0x0b,0x40,0x40,0x00,0x0b,0x40,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,
+  0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0xcf,0xff,0xff,0xff,0xff,0xfb,
+  0xcf,0xff,0xff,0xff,0xff,0xfb,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,
+  0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x9e,0x90,0x9f,0xf0,0x07,0xc0,0x2e,0x50,0x98,0x00,0x00,0x00,
+  0xcf,0xff,0xff,0x20,0xcf,0xff,0xff,0x20,0x9f,0xa0,0x9f,0xb0,0x00,0x00,0x00,0x00,0xad,0x00,0x00,0x00,0x00,0x04,0xf7,0x00,
+  0x00,0x00,0x00,0x0a,0xf1,0x00,0x00,0x00,0x00,0x1f,0xa0,0x00,0x00,0x00,0x00,0x8f,0x30,0x00,0x00,0x00,0x00,0xdc,0x00,0x00,
+  0x00,0x00,0x05,0xf6,0x00,0x00,0x00,0x00,0x0b,0xe1,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x9f,0x20,0x00,0x00,
+  0x00,0x01,0xeb,0x00,0x00,0x00,0x00,0x06,0xf5,0x00,0x00,0x00,0x00,0x0d,0xd0,0x00,0x00,0x00,0x00,0x4f,0x70,0x00,0x00,0x00,
+  0x00,0xaf,0x10,0x00,0x00,0x00,0x02,0xfa,0x00,0x00,0x00,0x00,0x08,0xf3,0x00,0x00,0x00,0x00,0x0e,0xa0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x7c,0xee,0xc6,0x00,0x00,0x00,0x1c,0xff,0xff,0xff,0xb1,0x00,0x00,0xbf,0xd5,0x11,0x6e,0xfa,0x00,0x05,0xff,0x20,
+  0x00,0x04,0xff,0x30,0x0b,0xf9,0x00,0x00,0x00,0xaf,0x90,0x0e,0xf4,0x00,0x00,0x00,0x5f,0xd0,0x2f,0xf1,0x00,0x00,0x00,0x2f,
+  0xf1,0x3f,0xf0,0x00,0x00,0x00,0x1f,0xf2,0x4f,0xe0,0x00,0x00,0x00,0x0f,0xf3,0x3f,0xf0,0x00,0x00,0x00,0x1f,0xf2,0x2f,0xf1,
+  0x00,0x00,0x00,0x2f,0xf1,0x0e,0xf4,0x00,0x00,0x00,0x5f,0xd0,0x0b,0xf9,0x00,0x00,0x00,0xaf,0x90,0x05,0xff,0x20,0x00,0x04,
+  0xff,0x40,0x00,0xbf,0xd5,0x11,0x6e,0xfa,0x00,0x00,0x1c,0xff,0xff,0xff,0xb1,0x00,0x00,0x00,0x7c,0xee,0xc6,0x00,0x00,0x00,
+  0x00,0x3d,0xf4,0x00,0x00,0x00,0x05,0xef,0xf4,0x00,0x00,0x00,0x7f,0xff,0xf4,0x00,0x00,0x09,0xfe,0x4d,0xf4,0x00,0x00,0x5f,
+  0xd2,0x0d,0xf4,0x00,0x00,0x05,0x10,0x0d,0xf4,0x00,0x00,0x00,0x00,0x0d,0xf4,0x00,0x00,0x00,0x00,0x0d,0xf4,0x00,0x00,0x00,
+  0x00,0x0d,0xf4,0x00,0x00,0x00,0x00,0x0d,0xf4,0x00,0x00,0x00,0x00,0x0d,0xf4,0x00,0x00,0x00,0x00,0x0d,0xf4,0x00,0x00,0x00,
+  0x00,0x0d,0xf4,0x00,0x00,0x00,0x00,0x0d,0xf4,0x00,0x00,0x00,0x00,0x0d,0xf4,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xa0,0x08,
+  0xff,0xff,0xff,0xff,0xa0,0x00,0x06,0xbe,0xfd,0x81,0x00,0x01,0xbf,0xff,0xff,0xfe,0x30,0x09,0xfe,0x61,0x15,0xdf,0xc0,0x1f,
+  0xf3,0x00,0x00,0x3f,0xf3,0x4f,0xb0,0x00,0x00,0x0d,0xf5,0x00,0x00,0x00,0x00,0x0e,0xf4,0x00,0x00,0x00,0x00,0x2f,0xe1,0x00,
+  0x00,0x00,0x00,0xaf,0x80,0x00,0x00,0x00,0x06,0xfc,0x10,0x00,0x00,0x00,0x5f,0xe2,0x00,0x00,0x00,0x05,0xfe,0x20,0x00,0x00,
+  0x00,0x5f,0xe3,0x00,0x00,0x00,0x06,0xfe,0x30,0x00,0x00,0x00,0x6f,0xe3,0x00,0x00,0x00,0x06,0xfe,0x30,0x00,0x00,0x00,0x6f,
+  0xfd,0xef,0xff,0xff,0xf9,0xbf,0xff,0xff,0xff,0xff,0xfb,0x00,0x05,0xbe,0xfe,0xa3,0x00,0x00,0xaf,0xff,0xff,0xff,0x60,0x07,
+  0xfe,0x72,0x13,0xaf,0xf2,0x0e,0xf5,0x00,0x00,0x0d,0xf6,0x19,0x80,0x00,0x00,0x0a,0xf6,0x00,0x00,0x00,0x00,0x0d,0xf2,0x00,
+  0x00,0x00,0x15,0xcf,0x80,0x00,0x00,0x0b,0xff,0xd5,0x00,0x00,0x00,0x0b,0xff,0xfd,0x30,0x00,0x00,0x00,0x14,0xaf,0xe2,0x00,
+  0x00,0x00,0x00,0x0a,0xf9,0x00,0x00,0x00,0x00,0x06,0xfc,0x6d,0x60,0x00,0x00,0x06,0xfc,0x5f,0xe2,0x00,0x00,0x0c,0xf8,0x0c,
+  0xfd,0x51,0x04,0xcf,0xe2,0x02,0xef,0xff,0xff,0xfe,0x40,0x00,0x18,0xce,0xfd,0x92,0x00,0x00,0x00,0x00,0x00,0x8f,0xd0,0x00,
+  0x00,0x00,0x00,0x04,0xff,0xd0,0x00,0x00,0x00,0x00,0x1e,0xef,0xd0,0x00,0x00,0x00,0x00,0xbf,0x6f,0xd0,0x00,0x00,0x00,0x07,
+  0xf9,0x1f,0xd0,0x00,0x00,0x00,0x3f,0xd1,0x1f,0xd0,0x00,0x00,0x01,0xdf,0x30,0x1f,0xd0,0x00,0x00,0x0a,0xf6,0x00,0x1f,0xd0,
+  0x00,0x00,0x6f,0xa0,0x00,0x1f,0xd0,0x00,0x02,0xed,0x10,0x00,0x1f,0xd0,0x00,0x1c,0xf3,0x00,0x00,0x1f,0xd0,0x00,0x6f,0xff,
+  0xff,0xff,0xff,0xff,0xf7,0x4f,0xff,0xff,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x1f,0xd0,0x00,0x00,0x00,0x00,0x00,0x1f,
+  0xd0,0x00,0x00,0x00,0x00,0x00,0x1f,0xd0,0x00,0x00,0x00,0x00,0x00,0x1f,0xd0,0x00,0x00,0x7f,0xff,0xff,0xff,0xb0,0x00,0xaf,
+  0xff,0xff,0xff,0x70,0x00,0xdf,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x03,0xf9,0x00,0x00,0x00,0x00,0x05,0xf7,
+  0x00,0x00,0x00,0x00,0x08,0xfc,0xdf,0xec,0x60,0x00,0x0a,0xff,0xff,0xff,0xfc,0x10,0x03,0x64,0x11,0x38,0xff,0x90,0x00,0x00,
+  0x00,0x00,0x6f,0xf1,0x00,0x00,0x00,0x00,0x0f,0xf3,0x00,0x00,0x00,0x00,0x0e,0xf3,0x00,0x00,0x00,0x00,0x1f,0xf1,0x01,0x00,
+  0x00,0x00,0xaf,0xc0,0x5f,0xb4,0x10,0x3a,0xff,0x30,0x3d,0xff,0xff,0xff,0xe5,0x00,0x01,0x7c,0xef,0xd9,0x20,0x00,0x00,0x00,
+  0x00,0x4d,0xf6,0x00,0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x0b,0xfa,0x00,0x00,0x00,0x00,0x8f,0xc1,0x00,0x00,0x00,0x04,
+  0xfe,0x20,0x00,0x00,0x00,0x2e,0xf3,0x00,0x00,0x00,0x00,0xcf,0xac,0xfe,0xb4,0x00,0x07,0xff,0xff,0xff,0xff,0x70,0x1e,0xfd,
+  0x51,0x14,0xcf,0xf3,0x6f,0xe2,0x00,0x00,0x1d,0xf9,0x9f,0x80,0x00,0x00,0x06,0xfc,0xaf,0x60,0x00,0x00,0x04,0xfd,0x9f,0x80,
+  0x00,0x00,0x06,0xfb,0x5f,0xe1,0x00,0x00,0x1d,0xf6,0x0d,0xfc,0x41,0x15,0xdf,0xd1,0x02,0xdf,0xff,0xff,0xfd,0x20,0x00,0x18,
+  0xce,0xec,0x71,0x00,0xaf,0xff,0xff,0xff,0xff,0xff,0x00,0x9f,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x08,0xf8,
+  0x00,0x00,0x00,0x00,0x00,0x2f,0xe1,0x00,0x00,0x00,0x00,0x00,0x9f,0x80,0x00,0x00,0x00,0x00,0x02,0xfe,0x10,0x00,0x00,0x00,
+  0x00,0x0a,0xf7,0x00,0x00,0x00,0x00,0x00,0x3f,0xe1,0x00,0x00,0x00,0x00,0x00,0xaf,0x70,0x00,0x00,0x00,0x00,0x03,0xfe,0x10,
+  0x00,0x00,0x00,0x00,0x0b,0xf7,0x00,0x00,0x00,0x00,0x00,0x4f,0xe1,0x00,0x00,0x00,0x00,0x00,0xbf,0x70,0x00,0x00,0x00,0x00,
+  0x04,0xfe,0x10,0x00,0x00,0x00,0x00,0x0c,0xf7,0x00,0x00,0x00,0x00,0x00,0x5f,0xe1,0x00,0x00,0x00,0x00,0x00,0xce,0x60,0x00,
+  0x00,0x00,0x00,0x00,0x18,0xdf,0xec,0x71,0x00,0x02,0xef,0xff,0xff,0xfd,0x20,0x0c,0xfc,0x41,0x15,0xdf,0xa0,0x2f,0xf2,0x00,
+  0x00,0x3f,0xf1,0x3f,0xd0,0x00,0x00,0x0f,0xf1,0x1f,0xf2,0x00,0x00,0x3f,0xe0,0x08,0xfc,0x41,0x15,0xdf,0x60,0x00,0x6e,0xff,
+  0xff,0xd5,0x00,0x01,0xaf,0xff,0xff,0xe9,0x10,0x1d,0xfb,0x41,0x14,0xcf,0xc0,0x8f,0xc0,0x00,0x00,0x1d,0xf6,0xbf,0x60,0x00,
+  0x00,0x08,0xfa,0xcf,0x70,0x00,0x00,0x08,0xfb,0xaf,0xc0,0x00,0x00,0x1d,0xf8,0x4f,0xfb,0x31,0x14,0xcf,0xf2,0x07,0xff,0xff,
+  0xff,0xff,0x50,0x00,0x39,0xdf,0xfd,0x92,0x00,0x00,0x04,0xae,0xfd,0xa3,0x00,0x00,0x8f,0xff,0xff,0xff,0x60,0x06,0xff,0x82,
+  0x13,0x9f,0xf3,0x0d,0xf6,0x00,0x00,0x09,0xf9,0x2f,0xf0,0x00,0x00,0x03,0xfd,0x3f,0xf0,0x00,0x00,0x03,0xfe,0x1f,0xf5,0x00,
+  0x00,0x09,0xfc,0x0a,0xfe,0x62,0x13,0xaf,0xf9,0x02,0xdf,0xff,0xff,0xff,0xf3,0x00,0x19,0xdf,0xd9,0xcf,0xa0,0x00,0x00,0x00,
+  0x07,0xfe,0x10,0x00,0x00,0x00,0x3f,0xf4,0x00,0x00,0x00,0x01,0xdf,0x90,0x00,0x00,0x00,0x0b,0xfd,0x10,0x00,0x00,0x00,0x7f,
+  0xf3,0x00,0x00,0x00,0x03,0xff,0x70,0x00,0x00,0x00,0x1d,0xfa,0x00,0x00,0x00,0x3d,0xe4,0x3e,0xe4,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xe4,0x3e,0xe4,0x3d,0xe4,0x3e,0xe4,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xd3,0x3d,0xf7,0x01,0xe4,0x08,0xc0,0x2d,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x01,0x8e,0x10,0x00,0x00,0x01,0x7e,0xfd,0x00,0x00,0x00,0x7e,0xfd,0x60,0x00,0x00,
+  0x6d,0xfd,0x60,0x00,0x00,0x2d,0xfd,0x60,0x00,0x00,0x00,0x1b,0xfe,0x81,0x00,0x00,0x00,0x00,0x4c,0xfe,0x81,0x00,0x00,0x00,
+  0x00,0x5c,0xfe,0x81,0x00,0x00,0x00,0x00,0x5d,0xfe,0x00,0x00,0x00,0x00,0x00,0x6d,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+  0xff,0xff,0xff,0xff,0xf2,0x3f,0xff,0xff,0xff,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+  0xff,0xff,0xff,0xff,0xf2,0x3f,0xff,0xff,0xff,0xff,0xf2,0x11,0x00,0x00,0x00,0x00,0x00,0x2e,0x71,0x00,0x00,0x00,0x00,0x1d,
+  0xfe,0x70,0x00,0x00,0x00,0x00,0x7e,0xfd,0x60,0x00,0x00,0x00,0x01,0x7e,0xfd,0x50,0x00,0x00,0x00,0x01,0x7d,0xfc,0x10,0x00,
+  0x00,0x02,0x9e,0xfb,0x10,0x00,0x02,0x9f,0xfb,0x30,0x00,0x02,0x9f,0xfc,0x40,0x00,0x00,0x1e,0xfc,0x40,0x00,0x00,0x00,0x2d,
+  0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8d,0xfe,0xa2,0x00,0x3d,0xff,0xff,0xff,0x40,0x4f,0x82,0x13,
+  0xcf,0xc0,0x01,0x00,0x00,0x2f,0xf1,0x00,0x00,0x00,0x0e,0xf1,0x00,0x00,0x00,0x2f,0xd0,0x00,0x00,0x01,0xcf,0x50,0x00,0x00,
+  0x2d,0xf7,0x00,0x00,0x02,0xef,0x50,0x00,0x00,0x08,0xf6,0x00,0x00,0x00,0x08,0xf3,0x00,0x00,0x00,0x05,0xc1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x00,0x00,0x00,0x1c,0xe7,0x00,0x00,
+  0x00,0x00,0x02,0x8c,0xef,0xdb,0x61,0x00,0x00,0x00,0x00,0x9f,0xff,0xff,0xff,0xfe,0x50,0x00,0x00,0x2c,0xfe,0x83,0x10,0x14,
+  0x8e,0xf8,0x00,0x00,0xcf,0x91,0x00,0x00,0x00,0x01,0xbf,0x60,0x09,0xf8,0x00,0x00,0x00,0x00,0x00,0x0c,0xe1,0x2f,0xb0,0x00,
+  0x02,0x9d,0xfe,0xa1,0x04,0xf6,0x8f,0x30,0x00,0x6f,0xff,0xff,0xf1,0x00,0xe9,0xbd,0x00,0x04,0xfe,0x72,0x0b,0xc0,0x00,0xcb,
+  0xea,0x00,0x0d,0xf3,0x00,0x1f,0x70,0x00,0xdb,0xe9,0x00,0x3f,0x80,0x00,0x5f,0x30,0x01,0xf9,0xdb,0x00,0x5f,0x50,0x00,0xcf,
+  0x00,0x07,0xf5,0xbd,0x00,0x4f,0xa1,0x19,0xef,0x41,0x6f,0xd0,0x8f,0x30,0x1e,0xff,0xfe,0x4f,0xff,0xfe,0x30,0x3f,0xb0,0x03,
+  0xce,0xc3,0x06,0xee,0xa2,0x00,0x0a,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0x91,0x00,0x00,0x00,0x00,0x02,0x00,
+  0x00,0x3d,0xfe,0x84,0x10,0x01,0x37,0xbf,0x40,0x00,0x01,0xaf,0xff,0xff,0xff,0xff,0xd5,0x00,0x00,0x00,0x02,0x7b,0xdf,0xed,
+  0xa5,0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0xef,0xdf,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xfd,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xf7,0x2f,0xf3,0x00,0x00,0x00,
+  0x00,0x00,0x3f,0xf2,0x0b,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x05,0xfe,0x10,0x00,0x00,0x00,0x01,0xef,0x50,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x9f,0xc0,0x00,0x00,0x00,0x0d,0xf8,0x00,0x00,0x3f,0xf3,0x00,0x00,0x00,0x4f,0xf2,
+  0x00,0x00,0x0c,0xf9,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xfe,0x10,0x00,0x01,0xff,0xff,0xff,0xff,0xff,0xff,0x60,0x00,
+  0x07,0xff,0x20,0x00,0x00,0x00,0xbf,0xc0,0x00,0x0d,0xfa,0x00,0x00,0x00,0x00,0x4f,0xf3,0x00,0x4f,0xf3,0x00,0x00,0x00,0x00,
+  0x0c,0xf9,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0x05,0xfe,0x10,0xef,0xff,0xff,0xec,0x93,0x00,0x00,0xef,0xff,0xff,0xff,0xff,
+  0x60,0x00,0xef,0x60,0x00,0x25,0xdf,0xf2,0x00,0xef,0x60,0x00,0x00,0x2e,0xf7,0x00,0xef,0x60,0x00,0x00,0x0c,0xf9,0x00,0xef,
+  0x60,0x00,0x00,0x0c,0xf8,0x00,0xef,0x60,0x00,0x00,0x2f,0xf3,0x00,0xef,0x60,0x00,0x16,0xdf,0x70,0x00,0xef,0xff,0xff,0xff,
+  0xd4,0x00,0x00,0xef,0xff,0xff,0xff,0xfd,0x70,0x00,0xef,0x60,0x00,0x12,0x7e,0xf8,0x00,0xef,0x60,0x00,0x00,0x05,0xff,0x10,
+  0xef,0x60,0x00,0x00,0x02,0xff,0x30,0xef,0x60,0x00,0x00,0x06,0xff,0x10,0xef,0x60,0x00,0x02,0x7e,0xfa,0x00,0xef,0xff,0xff,
+  0xff,0xff,0xc1,0x00,0xef,0xff,0xff,0xfe,0xb6,0x00,0x00,0x00,0x00,0x17,0xbd,0xfe,0xc8,0x20,0x00,0x00,0x06,0xef,0xff,0xff,
+  0xff,0xf8,0x00,0x00,0x9f,0xfc,0x52,0x01,0x38,0xff,0x30,0x06,0xff,0x80,0x00,0x00,0x00,0x24,0x00,0x1e,0xf9,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x6f,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xef,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xb0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x7f,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,0x00,
+  0x00,0x47,0x00,0x00,0xbf,0xfb,0x51,0x01,0x4a,0xff,0x30,0x00,0x09,0xff,0xff,0xff,0xff,0xe5,0x00,0x00,0x00,0x38,0xce,0xfe,
+  0xb7,0x10,0x00,0xef,0xff,0xff,0xfe,0xc8,0x20,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0xef,0x60,0x00,0x01,0x5a,
+  0xff,0xb0,0x00,0xef,0x60,0x00,0x00,0x00,0x5f,0xf8,0x00,0xef,0x60,0x00,0x00,0x00,0x07,0xff,0x20,0xef,0x60,0x00,0x00,0x00,
+  0x01,0xef,0x80,0xef,0x60,0x00,0x00,0x00,0x00,0xaf,0xc0,0xef,0x60,0x00,0x00,0x00,0x00,0x7f,0xe0,0xef,0x60,0x00,0x00,0x00,
+  0x00,0x6f,0xe0,0xef,0x60,0x00,0x00,0x00,0x00,0x7f,0xe0,0xef,0x60,0x00,0x00,0x00,0x00,0xaf,0xc0,0xef,0x60,0x00,0x00,0x00,
+  0x01,0xef,0x80,0xef,0x60,0x00,0x00,0x00,0x07,0xff,0x20,0xef,0x60,0x00,0x00,0x00,0x5f,0xf8,0x00,0xef,0x60,0x00,0x01,0x4a,
+  0xff,0xb0,0x00,0xef,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0xef,0xff,0xff,0xfe,0xc8,0x20,0x00,0x00,0xef,0xff,0xff,0xff,0xff,
+  0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,
+  0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xf2,
+  0x00,0xef,0xff,0xff,0xff,0xf2,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,
+  0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,
+  0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,
+  0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,
+  0x00,0xef,0xff,0xff,0xff,0xf7,0x00,0xef,0xff,0xff,0xff,0xf7,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,
+  0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,
+  0x00,0xef,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbd,0xfe,0xda,0x50,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xfd,0x30,0x00,
+  0x9f,0xfc,0x62,0x00,0x37,0xdf,0xb0,0x07,0xff,0x70,0x00,0x00,0x00,0x06,0x20,0x1e,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,
+  0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0x70,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0x02,0xff,0xff,0xf2,0xbf,0xb0,0x00,0x00,0x02,0xff,0xff,0xf2,0x6f,
+  0xe1,0x00,0x00,0x00,0x00,0x0f,0xf2,0x1e,0xf9,0x00,0x00,0x00,0x00,0x0f,0xf2,0x07,0xff,0x80,0x00,0x00,0x00,0x0f,0xf2,0x00,
+  0x9f,0xfc,0x52,0x00,0x25,0xaf,0xf2,0x00,0x07,0xef,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x17,0xbe,0xfe,0xda,0x61,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x05,0xff,0x00,0xef,0x60,0x00,0x00,0x00,0x05,0xff,0x00,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,
+  0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,0xd0,0x7f,
+  0xd0,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,
+  0xcf,0x80,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,
+  0x00,0xcf,0x80,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x04,0xff,0x30,0x00,
+  0x01,0x6e,0xfb,0x00,0x2f,0xff,0xff,0xd2,0x00,0x3d,0xef,0xd8,0x10,0x00,0xaf,0xa0,0x00,0x00,0x00,0x7e,0xe3,0xaf,0xa0,0x00,
+  0x00,0x07,0xfe,0x30,0xaf,0xa0,0x00,0x00,0x6f,0xf4,0x00,0xaf,0xa0,0x00,0x06,0xff,0x50,0x00,0xaf,0xa0,0x00,0x5f,0xf6,0x00,
+  0x00,0xaf,0xa0,0x04,0xff,0x70,0x00,0x00,0xaf,0xa0,0x5f,0xf8,0x00,0x00,0x00,0xaf,0xff,0xff,0x80,0x00,0x00,0x00,0xaf,0xff,
+  0xff,0xe2,0x00,0x00,0x00,0xaf,0xa0,0x3d,0xfd,0x10,0x00,0x00,0xaf,0xa0,0x03,0xef,0xb0,0x00,0x00,0xaf,0xa0,0x00,0x5f,0xf9,
+  0x00,0x00,0xaf,0xa0,0x00,0x07,0xff,0x60,0x00,0xaf,0xa0,0x00,0x00,0x9f,0xf3,0x00,0xaf,0xa0,0x00,0x00,0x0b,0xfe,0x20,0xaf,
+  0xa0,0x00,0x00,0x01,0xcf,0xc1,0xaf,0xa0,0x00,0x00,0x00,0x2d,0xfa,0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,
+  0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,
+  0x00,0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xfd,0xef,0xff,0xff,
+  0xff,0xfd,0xef,0x90,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xef,0xf4,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xef,0xfc,0x00,0x00,
+  0x00,0x00,0x00,0xbf,0xff,0xef,0xdf,0x60,0x00,0x00,0x00,0x04,0xfd,0xff,0xef,0x5f,0xd1,0x00,0x00,0x00,0x0c,0xf5,0xff,0xef,
+  0x2a,0xf8,0x00,0x00,0x00,0x6f,0xb1,0xff,0xef,0x22,0xfe,0x20,0x00,0x01,0xef,0x31,0xff,0xef,0x20,0x8f,0xa0,0x00,0x08,0xfa,
+  0x01,0xff,0xef,0x20,0x1e,0xf3,0x00,0x1e,0xf2,0x01,0xff,0xef,0x20,0x07,0xfc,0x00,0x9f,0x90,0x01,0xff,0xef,0x20,0x00,0xdf,
+  0x53,0xfe,0x10,0x01,0xff,0xef,0x20,0x00,0x5f,0xda,0xf7,0x00,0x01,0xff,0xef,0x20,0x00,0x0c,0xff,0xd1,0x00,0x01,0xff,0xef,
+  0x20,0x00,0x03,0xff,0x60,0x00,0x01,0xff,0xef,0x20,0x00,0x00,0x57,0x00,0x00,0x01,0xff,0xef,0x20,0x00,0x00,0x00,0x00,0x00,
+  0x01,0xff,0xef,0x20,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xee,0x30,0x00,0x00,0x00,0x00,0xff,0x00,0xef,0xd1,0x00,0x00,0x00,
+  0x00,0xff,0x00,0xef,0xfa,0x00,0x00,0x00,0x00,0xff,0x00,0xef,0xef,0x70,0x00,0x00,0x00,0xff,0x00,0xef,0x6f,0xf4,0x00,0x00,
+  0x00,0xff,0x00,0xef,0x27,0xfe,0x10,0x00,0x00,0xff,0x00,0xef,0x20,0xbf,0xb0,0x00,0x00,0xff,0x00,0xef,0x20,0x1d,0xf8,0x00,
+  0x00,0xff,0x00,0xef,0x20,0x03,0xff,0x50,0x00,0xff,0x00,0xef,0x20,0x00,0x6f,0xe2,0x00,0xff,0x00,0xef,0x20,0x00,0x0a,0xfc,
+  0x00,0xff,0x00,0xef,0x20,0x00,0x01,0xcf,0x90,0xff,0x00,0xef,0x20,0x00,0x00,0x2e,0xf6,0xff,0x00,0xef,0x20,0x00,0x00,0x05,
+  0xff,0xff,0x00,0xef,0x20,0x00,0x00,0x00,0x9f,0xff,0x00,0xef,0x20,0x00,0x00,0x00,0x0c,0xff,0x00,0xef,0x20,0x00,0x00,0x00,
+  0x02,0xdf,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc8,0x20,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x9f,0xfb,
+  0x51,0x01,0x4a,0xff,0xb0,0x00,0x06,0xff,0x70,0x00,0x00,0x00,0x5f,0xf9,0x00,0x1e,0xf9,0x00,0x00,0x00,0x00,0x06,0xff,0x20,
+  0x6f,0xe1,0x00,0x00,0x00,0x00,0x00,0xdf,0x90,0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0xcf,0x80,0x00,0x00,0x00,0x00,
+  0x00,0x6f,0xf0,0xdf,0x80,0x00,0x00,0x00,0x00,0x00,0x5f,0xf1,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xaf,0xb0,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xd0,0x6f,0xe1,0x00,0x00,0x00,0x00,0x00,0xdf,0x90,0x1e,0xf8,0x00,0x00,0x00,0x00,0x06,0xff,0x30,
+  0x07,0xff,0x60,0x00,0x00,0x00,0x4f,0xf9,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,0x00,0x07,0xef,0xff,0xff,0xff,
+  0xf9,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc8,0x20,0x00,0x00,0xaf,0xff,0xff,0xec,0x71,0x00,0xaf,0xff,0xff,0xff,0xfe,0x40,
+  0xaf,0xa0,0x00,0x15,0xdf,0xe1,0xaf,0xa0,0x00,0x00,0x2e,0xf7,0xaf,0xa0,0x00,0x00,0x0a,0xfb,0xaf,0xa0,0x00,0x00,0x08,0xfc,
+  0xaf,0xa0,0x00,0x00,0x0a,0xfb,0xaf,0xa0,0x00,0x00,0x3f,0xf7,0xaf,0xa0,0x00,0x27,0xef,0xd1,0xaf,0xff,0xff,0xff,0xfd,0x20,
+  0xaf,0xff,0xff,0xeb,0x71,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,
+  0xaf,0xa0,0x00,0x00,0x00,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc8,
+  0x20,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,0x06,0xff,0x70,
+  0x00,0x00,0x00,0x5f,0xf9,0x00,0x1e,0xf9,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x6f,0xe1,0x00,0x00,0x00,0x00,0x00,0xdf,0x90,
+  0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xdf,0x80,0x00,0x00,0x00,0x00,
+  0x00,0x5f,0xf1,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xe0,0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xc0,0x6f,0xe1,0x00,
+  0x00,0x00,0x00,0x00,0xdf,0x80,0x1e,0xf8,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x07,0xff,0x60,0x00,0x00,0x00,0x4f,0xf8,0x00,
+  0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xfb,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xca,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xe3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xfe,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0xcf,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x85,0xaf,0xff,0xff,0xeb,0x71,0x00,0x00,0xaf,0xff,
+  0xff,0xff,0xfe,0x40,0x00,0xaf,0xa0,0x00,0x26,0xdf,0xe1,0x00,0xaf,0xa0,0x00,0x00,0x2f,0xf5,0x00,0xaf,0xa0,0x00,0x00,0x0c,
+  0xf7,0x00,0xaf,0xa0,0x00,0x00,0x0d,0xf6,0x00,0xaf,0xa0,0x00,0x00,0x4f,0xf2,0x00,0xaf,0xa0,0x01,0x37,0xef,0x90,0x00,0xaf,
+  0xff,0xff,0xff,0xf8,0x00,0x00,0xaf,0xff,0xff,0xfa,0x10,0x00,0x00,0xaf,0xa0,0x08,0xff,0x30,0x00,0x00,0xaf,0xa0,0x00,0xbf,
+  0xd1,0x00,0x00,0xaf,0xa0,0x00,0x1d,0xfa,0x00,0x00,0xaf,0xa0,0x00,0x03,0xff,0x60,0x00,0xaf,0xa0,0x00,0x00,0x7f,0xf3,0x00,
+  0xaf,0xa0,0x00,0x00,0x0b,0xfd,0x10,0xaf,0xa0,0x00,0x00,0x01,0xdf,0xa0,0x00,0x02,0x9d,0xfe,0xc7,0x10,0x00,0x4e,0xff,0xff,
+  0xff,0xd2,0x01,0xef,0xb3,0x12,0x5c,0xf2,0x06,0xfd,0x00,0x00,0x00,0x20,0x08,0xfa,0x00,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,
+  0x00,0x00,0x02,0xef,0xc4,0x00,0x00,0x00,0x00,0x5e,0xff,0xd8,0x30,0x00,0x00,0x02,0x9e,0xff,0xfb,0x20,0x00,0x00,0x00,0x49,
+  0xef,0xe2,0x00,0x00,0x00,0x00,0x2d,0xf9,0x00,0x00,0x00,0x00,0x06,0xfc,0x00,0x00,0x00,0x00,0x07,0xfc,0x06,0x60,0x00,0x00,
+  0x0c,0xf8,0x2f,0xfb,0x41,0x13,0xbf,0xf2,0x06,0xef,0xff,0xff,0xfe,0x50,0x00,0x28,0xce,0xfd,0x92,0x00,0xaf,0xff,0xff,0xff,
+  0xff,0xff,0xfc,0xaf,0xff,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,
+  0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,
+  0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,
+  0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x01,0xff,0x40,0x00,0x00,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x0e,0xf6,0x00,0x00,0x00,0x00,0xdf,0x70,0x0b,0xfb,0x00,0x00,0x00,
+  0x03,0xff,0x40,0x05,0xff,0x50,0x00,0x00,0x0c,0xfd,0x00,0x00,0xaf,0xf8,0x30,0x15,0xcf,0xf4,0x00,0x00,0x1a,0xff,0xff,0xff,
+  0xfe,0x50,0x00,0x00,0x00,0x4a,0xdf,0xec,0x81,0x00,0x00,0xbf,0xa0,0x00,0x00,0x00,0x00,0x06,0xfe,0x10,0x4f,0xf2,0x00,0x00,
+  0x00,0x00,0x0d,0xf9,0x00,0x0d,0xf8,0x00,0x00,0x00,0x00,0x4f,0xf3,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0xaf,0xc0,0x00,0x01,
+  0xff,0x50,0x00,0x00,0x01,0xff,0x50,0x00,0x00,0xaf,0xb0,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x3f,0xf2,0x00,0x00,0x0d,0xf8,
+  0x00,0x00,0x00,0x0c,0xf9,0x00,0x00,0x4f,0xf2,0x00,0x00,0x00,0x06,0xfe,0x10,0x00,0xaf,0xb0,0x00,0x00,0x00,0x01,0xef,0x60,
+  0x01,0xff,0x40,0x00,0x00,0x00,0x00,0x9f,0xc0,0x07,0xfd,0x00,0x00,0x00,0x00,0x00,0x2f,0xf3,0x0d,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x0b,0xf9,0x4f,0xf1,0x00,0x00,0x00,0x00,0x00,0x05,0xfe,0x9f,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xef,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x8f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xf6,0x00,0x00,0x00,0x00,0xaf,0xc0,0x00,0x00,
+  0x00,0x0b,0xf5,0x00,0x00,0x00,0x04,0xef,0x20,0x5f,0xf3,0x00,0x00,0x00,0x2f,0xfb,0x00,0x00,0x00,0x09,0xfc,0x00,0x1f,0xf7,
+  0x00,0x00,0x00,0x8f,0xff,0x10,0x00,0x00,0x0d,0xf7,0x00,0x0b,0xfc,0x00,0x00,0x00,0xdf,0xcf,0x60,0x00,0x00,0x3f,0xf3,0x00,
+  0x06,0xff,0x10,0x00,0x03,0xfd,0x6f,0xc0,0x00,0x00,0x8f,0xd0,0x00,0x02,0xff,0x60,0x00,0x08,0xf8,0x1f,0xf2,0x00,0x00,0xcf,
+  0x80,0x00,0x00,0xcf,0xa0,0x00,0x0d,0xf2,0x0b,0xf7,0x00,0x02,0xff,0x30,0x00,0x00,0x7f,0xe0,0x00,0x3f,0xc0,0x06,0xfc,0x00,
+  0x06,0xfe,0x00,0x00,0x00,0x2f,0xf4,0x00,0x8f,0x70,0x01,0xff,0x20,0x0b,0xf9,0x00,0x00,0x00,0x0d,0xf9,0x00,0xdf,0x20,0x00,
+  0xaf,0x70,0x1f,0xf4,0x00,0x00,0x00,0x08,0xfd,0x04,0xfc,0x00,0x00,0x5f,0xc0,0x5f,0xe0,0x00,0x00,0x00,0x03,0xff,0x39,0xf7,
+  0x00,0x00,0x1f,0xf2,0x9f,0xa0,0x00,0x00,0x00,0x00,0xdf,0x7e,0xf2,0x00,0x00,0x0a,0xf7,0xef,0x50,0x00,0x00,0x00,0x00,0x9f,
+  0xdf,0xc0,0x00,0x00,0x05,0xfd,0xff,0x10,0x00,0x00,0x00,0x00,0x4f,0xff,0x70,0x00,0x00,0x01,0xff,0xfa,0x00,0x00,0x00,0x00,
+  0x00,0x0e,0xff,0x20,0x00,0x00,0x00,0xaf,0xf6,0x00,0x00,0x00,0x00,0x00,0x09,0xfc,0x00,0x00,0x00,0x00,0x5f,0xf1,0x00,0x00,
+  0x00,0x4f,0xf6,0x00,0x00,0x00,0x00,0xbf,0xa0,0x09,0xfe,0x20,0x00,0x00,0x07,0xfe,0x10,0x01,0xdf,0xb0,0x00,0x00,0x3f,0xf4,
+  0x00,0x00,0x3f,0xf6,0x00,0x00,0xcf,0x90,0x00,0x00,0x08,0xfe,0x10,0x07,0xfd,0x10,0x00,0x00,0x00,0xcf,0xa0,0x3f,0xf3,0x00,
+  0x00,0x00,0x00,0x2f,0xf5,0xcf,0x70,0x00,0x00,0x00,0x00,0x07,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf9,0x00,0x00,
+  0x00,0x00,0x00,0x0b,0xfc,0xff,0x40,0x00,0x00,0x00,0x00,0x7f,0xe1,0x9f,0xd1,0x00,0x00,0x00,0x02,0xef,0x50,0x1d,0xf9,0x00,
+  0x00,0x00,0x0c,0xfa,0x00,0x05,0xff,0x40,0x00,0x00,0x7f,0xe1,0x00,0x00,0xaf,0xd1,0x00,0x02,0xff,0x50,0x00,0x00,0x1e,0xf9,
+  0x00,0x0c,0xfa,0x00,0x00,0x00,0x06,0xff,0x40,0x7f,0xd1,0x00,0x00,0x00,0x00,0xbf,0xd1,0x9f,0xc1,0x00,0x00,0x00,0x00,0xbf,
+  0xb0,0x1e,0xf8,0x00,0x00,0x00,0x06,0xff,0x20,0x06,0xff,0x20,0x00,0x00,0x1e,0xf7,0x00,0x00,0xbf,0xb0,0x00,0x00,0x9f,0xd0,
+  0x00,0x00,0x2f,0xf5,0x00,0x03,0xff,0x40,0x00,0x00,0x08,0xfd,0x00,0x0c,0xfa,0x00,0x00,0x00,0x01,0xdf,0x70,0x6f,0xe1,0x00,
+  0x00,0x00,0x00,0x4f,0xe2,0xdf,0x60,0x00,0x00,0x00,0x00,0x0a,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf3,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xf1,0x8f,0xff,0xff,0xff,0xff,0xff,0xc0,0x00,
+  0x00,0x00,0x00,0x05,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xf6,0x00,0x00,0x00,0x00,0x00,0xcf,0xa0,0x00,0x00,0x00,0x00,0x08,
+  0xfd,0x10,0x00,0x00,0x00,0x00,0x4f,0xf4,0x00,0x00,0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x00,0x0b,0xfc,0x00,0x00,0x00,
+  0x00,0x00,0x7f,0xe2,0x00,0x00,0x00,0x00,0x03,0xff,0x50,0x00,0x00,0x00,0x00,0x1d,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xd1,
+  0x00,0x00,0x00,0x00,0x05,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xf7,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,
+  0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0x4f,0xff,0xf2,0x4f,0xff,0xe1,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,
+  0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,
+  0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0xff,0xe1,0x4f,
+  0xff,0xf2,0x1e,0x80,0x00,0x00,0x00,0x09,0xf2,0x00,0x00,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0xce,0x00,0x00,0x00,0x00,0x5f,
+  0x50,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x08,0xf3,0x00,0x00,0x00,0x02,0xf9,0x00,0x00,0x00,0x00,0xae,0x10,0x00,0x00,
+  0x00,0x4f,0x70,0x00,0x00,0x00,0x0d,0xd0,0x00,0x00,0x00,0x07,0xf4,0x00,0x00,0x00,0x01,0xeb,0x00,0x00,0x00,0x00,0x9f,0x20,
+  0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x0c,0xe1,0x00,0x00,0x00,0x05,0xf6,0x00,0x00,0x00,0x00,0xbc,0xef,0xff,0x80,0xcf,
+  0xff,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,
+  0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0x00,
+  0x4f,0x80,0x00,0x4f,0x80,0x00,0x4f,0x80,0xcf,0xff,0x80,0xef,0xff,0x80,0x00,0x00,0x2f,0xd0,0x00,0x00,0x00,0x00,0xaf,0xf7,
+  0x00,0x00,0x00,0x04,0xfb,0xde,0x10,0x00,0x00,0x0c,0xf3,0x6f,0x90,0x00,0x00,0x6f,0xa0,0x0c,0xf3,0x00,0x01,0xee,0x20,0x03,
+  0xfb,0x00,0x08,0xf7,0x00,0x00,0x9f,0x40,0x07,0x70,0x00,0x00,0x17,0x50,0xff,0xff,0xff,0xff,0xf7,0xff,0xff,0xff,0xff,0xf7,
+  0x3e,0xf6,0x00,0x04,0xfe,0x10,0x00,0x5f,0x90,0x00,0x04,0x71,0x00,0x4a,0xef,0xd8,0x10,0x08,0xff,0xff,0xff,0xb0,0x2e,0xb4,
+  0x11,0x5e,0xf5,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x06,0xfa,0x00,0x28,0xbd,0xef,0xfa,0x09,0xff,0xff,0xff,0xfa,0x8f,
+  0xd7,0x42,0x06,0xfa,0xdf,0x40,0x00,0x07,0xfa,0xcf,0x91,0x02,0x8e,0xfa,0x6f,0xff,0xff,0xd4,0xfa,0x07,0xdf,0xd8,0x10,0xea,
+  0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,
+  0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3b,0xee,0xb3,0x00,0x3f,0xf5,0xff,0xff,0xff,0x40,0x3f,0xfe,0x61,0x14,0xdf,0xd0,
+  0x3f,0xf3,0x00,0x00,0x2f,0xf3,0x3f,0xf0,0x00,0x00,0x0c,0xf7,0x3f,0xf0,0x00,0x00,0x0a,0xf8,0x3f,0xf0,0x00,0x00,0x0b,0xf8,
+  0x3f,0xf0,0x00,0x00,0x0d,0xf6,0x3f,0xf0,0x00,0x00,0x5f,0xf2,0x3f,0xfb,0x30,0x16,0xef,0xa0,0x3f,0xca,0xff,0xff,0xfc,0x10,
+  0x3f,0xa0,0x8d,0xfd,0x71,0x00,0x00,0x03,0xad,0xfe,0x92,0x00,0x00,0x6f,0xff,0xff,0xfe,0x40,0x03,0xff,0xa3,0x01,0x6b,0x20,
+  0x0a,0xfc,0x00,0x00,0x00,0x00,0x0e,0xf5,0x00,0x00,0x00,0x00,0x1f,0xf2,0x00,0x00,0x00,0x00,0x1f,0xf2,0x00,0x00,0x00,0x00,
+  0x0e,0xf5,0x00,0x00,0x00,0x00,0x0a,0xfc,0x00,0x00,0x00,0x00,0x03,0xff,0xb3,0x01,0x6e,0x60,0x00,0x7f,0xff,0xff,0xfe,0x30,
+  0x00,0x04,0xbe,0xfd,0x81,0x00,0x00,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x00,0x08,0xf9,
+  0x00,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x00,0x08,0xf9,0x00,0x04,0xbe,0xeb,0x38,0xf9,0x00,0x7f,0xff,0xff,0xfc,0xf9,
+  0x04,0xff,0x92,0x02,0x8f,0xf9,0x0b,0xfb,0x00,0x00,0x09,0xf9,0x0e,0xf5,0x00,0x00,0x08,0xf9,0x2f,0xf2,0x00,0x00,0x08,0xf9,
+  0x2f,0xf1,0x00,0x00,0x08,0xf9,0x1f,0xf3,0x00,0x00,0x08,0xf9,0x0c,0xf9,0x00,0x00,0x0b,0xf9,0x07,0xff,0x72,0x13,0xbe,0xf9,
+  0x00,0xcf,0xff,0xff,0xb6,0xf9,0x00,0x18,0xdf,0xd7,0x03,0xf9,0x00,0x03,0xad,0xfe,0xa3,0x00,0x00,0x6f,0xff,0xff,0xff,0x40,
+  0x03,0xfe,0x62,0x02,0x6e,0xe1,0x0a,0xf5,0x00,0x00,0x07,0xf5,0x0e,0xff,0xff,0xff,0xff,0xf8,0x1f,0xff,0xff,0xff,0xff,0xf8,
+  0x1f,0xf1,0x00,0x00,0x00,0x00,0x0e,0xf4,0x00,0x00,0x00,0x00,0x0a,0xfc,0x00,0x00,0x00,0x00,0x03,0xff,0xb4,0x11,0x4a,0xe3,
+  0x00,0x5f,0xff,0xff,0xff,0xb1,0x00,0x02,0x9d,0xfe,0xb5,0x00,0x00,0x02,0xae,0xfb,0x00,0x1d,0xff,0xfc,0x00,0x8f,0xd4,0x00,
+  0x00,0xbf,0x60,0x00,0x00,0xcf,0x50,0x00,0xaf,0xff,0xff,0xfc,0x7f,0xff,0xff,0xfc,0x00,0xcf,0x60,0x00,0x00,0xcf,0x60,0x00,
+  0x00,0xcf,0x60,0x00,0x00,0xcf,0x60,0x00,0x00,0xcf,0x60,0x00,0x00,0xcf,0x60,0x00,0x00,0xcf,0x60,0x00,0x00,0xcf,0x60,0x00,
+  0x00,0xcf,0x60,0x00,0x00,0xcf,0x60,0x00,0x00,0x17,0xdf,0xff,0xff,0xfd,0x01,0xcf,0xff,0xff,0xff,0xfc,0x07,0xfd,0x41,0x16,
+  0xff,0x72,0x0b,0xf5,0x00,0x00,0x9f,0x40,0x0a,0xf5,0x00,0x00,0x9f,0x60,0x06,0xfd,0x41,0x16,0xff,0x20,0x00,0x9f,0xff,0xff,
+  0xf8,0x00,0x00,0x7e,0xcf,0xeb,0x50,0x00,0x04,0xfa,0x20,0x00,0x00,0x00,0x04,0xff,0xff,0xff,0xea,0x40,0x01,0xbf,0xdf,0xff,
+  0xff,0xf4,0x1d,0xd2,0x00,0x01,0x3b,0xf9,0x5f,0x80,0x00,0x00,0x07,0xf8,0x4f,0xe6,0x21,0x12,0x7f,0xf2,0x0a,0xff,0xff,0xff,
+  0xfe,0x50,0x00,0x5b,0xef,0xed,0x82,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,
+  0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x4c,0xee,0xa2,0x00,0x4f,0xd7,0xff,0xff,
+  0xfe,0x10,0x4f,0xfe,0x71,0x15,0xef,0x80,0x4f,0xe3,0x00,0x00,0x8f,0xc0,0x4f,0xd0,0x00,0x00,0x5f,0xd0,0x4f,0xd0,0x00,0x00,
+  0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,
+  0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x3d,0xe5,0x3d,0xe5,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,
+  0x00,0x3d,0xe5,0x00,0x3d,0xe5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,
+  0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,
+  0x00,0x0f,0xf2,0x00,0x1f,0xf2,0x00,0x7f,0xf0,0x9f,0xff,0x90,0x8f,0xd9,0x10,0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,
+  0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,
+  0x01,0xcf,0x70,0x3f,0xf0,0x00,0x1c,0xf8,0x00,0x3f,0xf0,0x00,0xbf,0xa0,0x00,0x3f,0xf0,0x0a,0xfb,0x00,0x00,0x3f,0xf0,0x9f,
+  0xd1,0x00,0x00,0x3f,0xff,0xfe,0x20,0x00,0x00,0x3f,0xff,0xff,0x80,0x00,0x00,0x3f,0xf0,0x6f,0xf5,0x00,0x00,0x3f,0xf0,0x07,
+  0xff,0x40,0x00,0x3f,0xf0,0x00,0x8f,0xe2,0x00,0x3f,0xf0,0x00,0x09,0xfd,0x10,0x3f,0xf0,0x00,0x00,0x9f,0xb0,0x0f,0xf2,0x0f,
+  0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,
+  0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x4f,0x70,0x7d,0xea,0x10,0x19,0xef,0xc5,0x00,0x4f,0xa9,0xff,0xff,0xa1,0xdf,0xff,0xff,
+  0x60,0x4f,0xed,0x41,0x3d,0xfa,0xe4,0x12,0xbf,0xd0,0x4f,0xe1,0x00,0x05,0xff,0x50,0x00,0x2f,0xf2,0x4f,0xd0,0x00,0x02,0xff,
+  0x10,0x00,0x0e,0xf3,0x4f,0xd0,0x00,0x01,0xff,0x10,0x00,0x0e,0xf4,0x4f,0xd0,0x00,0x01,0xff,0x10,0x00,0x0e,0xf4,0x4f,0xd0,
+  0x00,0x01,0xff,0x10,0x00,0x0e,0xf4,0x4f,0xd0,0x00,0x01,0xff,0x10,0x00,0x0e,0xf4,0x4f,0xd0,0x00,0x01,0xff,0x10,0x00,0x0e,
+  0xf4,0x4f,0xd0,0x00,0x01,0xff,0x10,0x00,0x0e,0xf4,0x4f,0xd0,0x00,0x01,0xff,0x10,0x00,0x0e,0xf4,0x4f,0x80,0x4b,0xee,0xa2,
+  0x00,0x4f,0xa7,0xff,0xff,0xfe,0x10,0x4f,0xee,0x71,0x15,0xef,0x80,0x4f,0xe3,0x00,0x00,0x8f,0xc0,0x4f,0xd0,0x00,0x00,0x5f,
+  0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,
+  0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x00,0x03,0xad,0xfe,0xb5,
+  0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xa0,0x00,0x03,0xff,0xa3,0x01,0x6e,0xf8,0x00,0x0a,0xfb,0x00,0x00,0x06,0xfe,0x10,0x0e,
+  0xf4,0x00,0x00,0x00,0xef,0x40,0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x0f,0xf4,0x00,0x00,
+  0x00,0xef,0x40,0x0b,0xfb,0x00,0x00,0x06,0xfe,0x10,0x03,0xff,0xa2,0x01,0x6e,0xf8,0x00,0x00,0x6f,0xff,0xff,0xff,0xb0,0x00,
+  0x00,0x03,0xad,0xfe,0xb5,0x00,0x00,0x4f,0x80,0x4b,0xee,0xa3,0x00,0x4f,0xa6,0xff,0xff,0xfe,0x30,0x4f,0xee,0x61,0x14,0xdf,
+  0xc0,0x4f,0xe2,0x00,0x00,0x3f,0xf2,0x4f,0xd0,0x00,0x00,0x0d,0xf5,0x4f,0xd0,0x00,0x00,0x0b,0xf7,0x4f,0xd0,0x00,0x00,0x0c,
+  0xf6,0x4f,0xd0,0x00,0x00,0x0e,0xf5,0x4f,0xe0,0x00,0x00,0x6f,0xf1,0x4f,0xfa,0x30,0x16,0xef,0x90,0x4f,0xed,0xff,0xff,0xfc,
+  0x10,0x4f,0xd1,0x9e,0xfc,0x70,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,
+  0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x00,0x04,0xbe,0xeb,0x33,0xf9,0x00,0x7f,0xff,0xff,0xf9,0xf9,0x04,0xff,0x92,0x02,0x8f,
+  0xf9,0x0b,0xfb,0x00,0x00,0x09,0xf9,0x0e,0xf5,0x00,0x00,0x08,0xf9,0x2f,0xf2,0x00,0x00,0x08,0xf9,0x2f,0xf1,0x00,0x00,0x08,
+  0xf9,0x1f,0xf3,0x00,0x00,0x08,0xf9,0x0c,0xf9,0x00,0x00,0x0b,0xf9,0x07,0xff,0x72,0x13,0xbf,0xf9,0x00,0xcf,0xff,0xff,0xb9,
+  0xf9,0x00,0x18,0xdf,0xd7,0x08,0xf9,0x00,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x00,0x08,
+  0xf9,0x00,0x00,0x00,0x00,0x08,0xf9,0x4f,0x80,0x6d,0xfe,0x10,0x4f,0xb8,0xff,0xfd,0x00,0x4f,0xef,0x61,0x00,0x00,0x4f,0xf6,
+  0x00,0x00,0x00,0x4f,0xe0,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x4f,
+  0xd0,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x3a,0xef,0xd8,0x10,
+  0x04,0xff,0xff,0xff,0xc1,0x0c,0xfb,0x20,0x27,0x80,0x0e,0xf2,0x00,0x00,0x00,0x08,0xf9,0x10,0x00,0x00,0x00,0x8e,0xfa,0x61,
+  0x00,0x00,0x00,0x49,0xee,0x60,0x00,0x00,0x00,0x1d,0xf3,0x00,0x00,0x00,0x0a,0xf5,0x0b,0xa3,0x11,0x6f,0xf3,0x1b,0xff,0xff,
+  0xff,0xa0,0x00,0x7c,0xee,0xc6,0x00,0x00,0x0e,0x90,0x00,0x00,0x00,0x2f,0x90,0x00,0x00,0x00,0x4f,0x90,0x00,0x00,0x00,0x6f,
+  0x90,0x00,0x00,0x5c,0xef,0xff,0xff,0x10,0x6f,0xff,0xff,0xff,0x10,0x00,0x8f,0x90,0x00,0x00,0x00,0x8f,0x90,0x00,0x00,0x00,
+  0x8f,0x90,0x00,0x00,0x00,0x8f,0x90,0x00,0x00,0x00,0x8f,0x90,0x00,0x00,0x00,0x8f,0x90,0x00,0x00,0x00,0x8f,0x90,0x00,0x00,
+  0x00,0x7f,0xd1,0x25,0x00,0x00,0x3f,0xff,0xff,0x20,0x00,0x06,0xdf,0xd5,0x00,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,
+  0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,
+  0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x6f,0xc0,0x00,0x00,0xbf,0x90,0x3f,0xf8,0x21,
+  0x4b,0xff,0x90,0x0a,0xff,0xff,0xfc,0x7f,0x90,0x00,0x7d,0xfd,0x81,0x3f,0x90,0x9f,0x90,0x00,0x00,0x04,0xfd,0x00,0x2f,0xf1,
+  0x00,0x00,0x0a,0xf7,0x00,0x0b,0xf7,0x00,0x00,0x1f,0xe1,0x00,0x05,0xfd,0x00,0x00,0x7f,0x90,0x00,0x00,0xef,0x40,0x00,0xdf,
+  0x30,0x00,0x00,0x8f,0xa0,0x04,0xfc,0x00,0x00,0x00,0x2f,0xf1,0x0a,0xf6,0x00,0x00,0x00,0x0a,0xf7,0x2f,0xe1,0x00,0x00,0x00,
+  0x04,0xfc,0x7f,0x80,0x00,0x00,0x00,0x00,0xdf,0xcf,0x20,0x00,0x00,0x00,0x00,0x7f,0xfb,0x00,0x00,0x00,0x00,0x00,0x1e,0xf5,
+  0x00,0x00,0x00,0xaf,0x70,0x00,0x00,0xcf,0x40,0x00,0x01,0xef,0x10,0x5f,0xd0,0x00,0x02,0xff,0xa0,0x00,0x05,0xfb,0x00,0x1e,
+  0xf2,0x00,0x07,0xfe,0xe0,0x00,0x0a,0xf6,0x00,0x0a,0xf7,0x00,0x0c,0xe8,0xf5,0x00,0x0e,0xf1,0x00,0x05,0xfb,0x00,0x2f,0x93,
+  0xf9,0x00,0x4f,0xb0,0x00,0x01,0xff,0x10,0x7f,0x40,0xde,0x00,0x8f,0x60,0x00,0x00,0xbf,0x50,0xce,0x00,0x8f,0x40,0xdf,0x20,
+  0x00,0x00,0x6f,0xa2,0xf9,0x00,0x3f,0x92,0xfc,0x00,0x00,0x00,0x1f,0xe7,0xf4,0x00,0x0d,0xe7,0xf7,0x00,0x00,0x00,0x0b,0xfd,
+  0xe0,0x00,0x08,0xfd,0xf2,0x00,0x00,0x00,0x06,0xff,0x90,0x00,0x03,0xff,0xc0,0x00,0x00,0x00,0x01,0xff,0x30,0x00,0x00,0xdf,
+  0x70,0x00,0x00,0x3f,0xf4,0x00,0x00,0x1e,0xf3,0x07,0xfd,0x10,0x00,0xaf,0x80,0x00,0xcf,0x80,0x06,0xfc,0x00,0x00,0x2e,0xf3,
+  0x2e,0xe2,0x00,0x00,0x06,0xfc,0xaf,0x60,0x00,0x00,0x00,0xbf,0xfb,0x00,0x00,0x00,0x00,0xcf,0xfd,0x10,0x00,0x00,0x08,0xfb,
+  0xaf,0x90,0x00,0x00,0x3f,0xe2,0x1e,0xf5,0x00,0x01,0xdf,0x50,0x05,0xfe,0x10,0x09,0xf9,0x00,0x00,0xaf,0xa0,0x5f,0xd1,0x00,
+  0x00,0x1d,0xf6,0x9f,0xa0,0x00,0x00,0x03,0xfd,0x00,0x3f,0xf2,0x00,0x00,0x0a,0xf7,0x00,0x0b,0xf8,0x00,0x00,0x2f,0xe1,0x00,
+  0x04,0xfe,0x10,0x00,0x8f,0x80,0x00,0x00,0xcf,0x60,0x00,0xef,0x20,0x00,0x00,0x6f,0xd0,0x05,0xfa,0x00,0x00,0x00,0x0e,0xf4,
+  0x0b,0xf4,0x00,0x00,0x00,0x08,0xfa,0x3f,0xc0,0x00,0x00,0x00,0x01,0xff,0xaf,0x60,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,
+  0x00,0x00,0x00,0x3f,0xf7,0x00,0x00,0x00,0x00,0x00,0x0e,0xf1,0x00,0x00,0x00,0x00,0x00,0x6f,0x90,0x00,0x00,0x00,0x00,0x00,
+  0xdf,0x30,0x00,0x00,0x00,0x00,0x05,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xf4,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,
+  0x30,0x0c,0xff,0xff,0xff,0xfe,0x10,0x00,0x00,0x00,0x0a,0xf4,0x00,0x00,0x00,0x00,0x6f,0x70,0x00,0x00,0x00,0x03,0xfa,0x00,
+  0x00,0x00,0x00,0x1e,0xd1,0x00,0x00,0x00,0x00,0xbe,0x20,0x00,0x00,0x00,0x09,0xf5,0x00,0x00,0x00,0x00,0x5f,0x80,0x00,0x00,
+  0x00,0x03,0xeb,0x00,0x00,0x00,0x00,0x0d,0xff,0xff,0xff,0xff,0x00,0x2f,0xff,0xff,0xff,0xff,0x00,0x00,0x18,0xdf,0x20,0x00,
+  0xbf,0xff,0x10,0x04,0xfe,0x40,0x00,0x06,0xf8,0x00,0x00,0x06,0xf7,0x00,0x00,0x04,0xf8,0x00,0x00,0x01,0xfb,0x00,0x00,0x00,
+  0xdd,0x00,0x00,0x00,0xde,0x00,0x00,0x05,0xfc,0x00,0x00,0x7f,0xd3,0x00,0x00,0x7f,0xd3,0x00,0x00,0x05,0xfc,0x00,0x00,0x00,
+  0xde,0x00,0x00,0x00,0xdd,0x00,0x00,0x01,0xfb,0x00,0x00,0x03,0xf8,0x00,0x00,0x06,0xf7,0x00,0x00,0x06,0xf8,0x00,0x00,0x04,
+  0xfe,0x40,0x00,0x00,0xbf,0xff,0x10,0x00,0x18,0xdf,0x20,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,
+  0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,
+  0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0xee,0xa2,0x00,0xdf,0xfd,0x10,0x02,0xcf,0x60,0x00,0x5f,0x90,0x00,0x4f,0x90,0x00,0x5f,
+  0x60,0x00,0x8f,0x40,0x00,0xaf,0x10,0x00,0xbf,0x10,0x00,0x9f,0x81,0x00,0x2b,0xfa,0x00,0x1b,0xfa,0x00,0x9f,0x81,0x00,0xbf,
+  0x10,0x00,0xaf,0x10,0x00,0x8f,0x40,0x00,0x5f,0x60,0x00,0x4f,0x90,0x00,0x5f,0x90,0x02,0xcf,0x60,0xdf,0xfd,0x10,0xee,0xa2,
+  0x00,0x00,0x00,0x00,0x00,0x02,0x83,0x03,0xcf,0xda,0x51,0x1a,0xf5,0x1e,0xff,0xff,0xff,0xff,0xe1,0x7f,0x91,0x26,0xbe,0xeb,
+  0x20,0x48,0x10,0x00,0x00,0x00,0x00,0x3d,0xe5,0x3d,0xe5,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xe0,0x0b,0xf0,0x0c,0xf2,0x0d,
+  0xf2,0x0d,0xf3,0x0d,0xf3,0x0d,0xf3,0x0d,0xf3,0x0d,0xf3,0x0d,0xf3,0x0d,0xf3,0x00,0x00,0x00,0x17,0x10,0x00,0x00,0x00,0x00,
+  0x4f,0x10,0x00,0x00,0x00,0x00,0x6f,0x00,0x00,0x00,0x03,0xad,0xff,0xc7,0x10,0x00,0x7f,0xfb,0xce,0xbf,0xd0,0x05,0xfd,0x30,
+  0x9b,0x02,0x30,0x0d,0xf5,0x00,0xaa,0x00,0x00,0x3f,0xe0,0x00,0xb9,0x00,0x00,0x5f,0xc0,0x00,0xc8,0x00,0x00,0x5f,0xd0,0x00,
+  0xd7,0x00,0x00,0x3f,0xf1,0x00,0xf6,0x00,0x00,0x0e,0xf8,0x01,0xf5,0x00,0x00,0x07,0xff,0x94,0xf4,0x3a,0xe1,0x00,0xaf,0xff,
+  0xff,0xff,0xb0,0x00,0x06,0xcf,0xfe,0xc6,0x00,0x00,0x00,0x05,0xf1,0x00,0x00,0x00,0x00,0x05,0xf0,0x00,0x00,0x00,0x00,0x06,
+  0xc0,0x00,0x00,0x00,0x00,0x06,0xbe,0xec,0x70,0x00,0x00,0x00,0xaf,0xff,0xff,0xfb,0x10,0x00,0x06,0xff,0x72,0x14,0xdf,0x80,
+  0x00,0x0c,0xf8,0x00,0x00,0x29,0x30,0x00,0x0f,0xf4,0x00,0x00,0x00,0x00,0x00,0x0f,0xf2,0x00,0x00,0x00,0x00,0x00,0x0f,0xf2,
+  0x00,0x00,0x00,0x00,0x00,0x0f,0xf2,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0xff,0x70,0x00,0x6f,0xff,0xff,0xff,0xff,0x50,
+  0x00,0x00,0x0f,0xf2,0x00,0x00,0x00,0x00,0x00,0x0f,0xf2,0x00,0x00,0x00,0x00,0x00,0x0f,0xf2,0x00,0x00,0x00,0x00,0x00,0x1f,
+  0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0x70,0x00,0x00,0x00,0x00,0x1b,0xff,0xef,0xff,0xff,0xff,0xf6,0x2f,0xff,0xff,0xff,0xff,
+  0xff,0xe3,0x1b,0x30,0x00,0x00,0x05,0xb1,0x2e,0xe3,0x9e,0xd9,0x4e,0xd1,0x04,0xff,0xff,0xff,0xfe,0x20,0x00,0xbf,0x71,0x28,
+  0xfa,0x00,0x02,0xf8,0x00,0x00,0x9f,0x10,0x04,0xf5,0x00,0x00,0x6f,0x30,0x02,0xf8,0x00,0x00,0x9f,0x10,0x00,0xbf,0x71,0x28,
+  0xfa,0x00,0x03,0xef,0xff,0xff,0xfe,0x30,0x1d,0xe4,0xae,0xd9,0x4e,0xd1,0x1c,0x40,0x00,0x00,0x04,0xb1,0x3f,0xe2,0x00,0x00,
+  0x00,0x4e,0xe1,0x0a,0xfa,0x00,0x00,0x00,0xcf,0x70,0x02,0xff,0x30,0x00,0x05,0xfd,0x00,0x00,0x9f,0xb0,0x00,0x0d,0xf6,0x00,
+  0x00,0x1e,0xf3,0x00,0x6f,0xc0,0x00,0x00,0x07,0xfb,0x01,0xdf,0x40,0x00,0x00,0x01,0xdf,0x47,0xfb,0x00,0x00,0x00,0x00,0x6f,
+  0xbd,0xf3,0x00,0x00,0x00,0x00,0x0d,0xff,0xa0,0x00,0x00,0x04,0xff,0xff,0xff,0xff,0xff,0x10,0x04,0xff,0xff,0xff,0xff,0xff,
+  0x10,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0x04,0xff,0xff,0xff,0xff,0xff,0x10,0x04,0xff,0xff,0xff,0xff,0xff,0x10,0x00,0x00,
+  0x03,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0x4f,0x60,0x4f,0x60,0x4f,
+  0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x60,0x4f,
+  0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x4f,0x60,0x00,0x19,0xdf,0xd8,0x10,0x01,0xef,0xff,0xff,
+  0xd1,0x09,0xfb,0x30,0x27,0xa0,0x0c,0xf2,0x00,0x00,0x00,0x0b,0xf6,0x00,0x00,0x00,0x04,0xff,0xa4,0x00,0x00,0x01,0xcf,0xff,
+  0xc5,0x00,0x2d,0xd3,0x6d,0xff,0xb0,0x8f,0x50,0x00,0x5d,0xf8,0x9f,0x80,0x00,0x03,0xfc,0x3f,0xfa,0x30,0x02,0xfa,0x05,0xdf,
+  0xfb,0x5b,0xe3,0x00,0x05,0xcf,0xff,0x30,0x00,0x00,0x03,0xbf,0xc0,0x00,0x00,0x00,0x0c,0xf2,0x00,0x00,0x00,0x0b,0xf2,0x2e,
+  0xa3,0x11,0x7f,0xe0,0x2d,0xff,0xff,0xff,0x50,0x01,0x8d,0xfe,0xa3,0x00,0x8e,0x80,0x4e,0xc1,0x8e,0x90,0x4e,0xc1,0x00,0x00,
+  0x01,0x7b,0xef,0xec,0x72,0x00,0x00,0x00,0x00,0x00,0x5e,0xff,0xff,0xff,0xff,0x70,0x00,0x00,0x00,0x08,0xfe,0x94,0x10,0x24,
+  0x8e,0xfa,0x00,0x00,0x00,0x6f,0xa1,0x17,0xcf,0xea,0x31,0x9f,0x80,0x00,0x02,0xfa,0x02,0xdf,0xff,0xff,0xf5,0x08,0xf4,0x00,
+  0x08,0xd1,0x0c,0xfc,0x41,0x14,0xa3,0x00,0xbb,0x00,0x0e,0x60,0x4f,0xd1,0x00,0x00,0x00,0x00,0x4f,0x10,0x2f,0x20,0x8f,0x70,
+  0x00,0x00,0x00,0x00,0x0e,0x40,0x3f,0x10,0x9f,0x50,0x00,0x00,0x00,0x00,0x0d,0x50,0x2f,0x20,0x8f,0x70,0x00,0x00,0x00,0x00,
+  0x0e,0x40,0x0e,0x60,0x4f,0xc0,0x00,0x00,0x00,0x00,0x3f,0x10,0x08,0xd0,0x0d,0xfb,0x31,0x15,0xb4,0x00,0xbb,0x00,0x02,0xfa,
+  0x03,0xef,0xff,0xff,0xe4,0x07,0xf4,0x00,0x00,0x7f,0xa1,0x19,0xdf,0xea,0x21,0x9f,0x90,0x00,0x00,0x09,0xfe,0x94,0x20,0x13,
+  0x8e,0xfa,0x00,0x00,0x00,0x00,0x5e,0xff,0xff,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x01,0x6b,0xef,0xec,0x71,0x00,0x00,0x00,
+  0x05,0xce,0xb2,0x00,0x4f,0xff,0xfc,0x00,0x14,0x10,0x8f,0x10,0x05,0xbe,0xff,0x20,0x7f,0xff,0xff,0x20,0xcc,0x32,0x8f,0x20,
+  0xbf,0xff,0xaf,0x20,0x3d,0xe8,0x1e,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x80,0x3e,0x20,0x00,0x6f,0x50,0xdc,0x00,0x02,
+  0xea,0x08,0xf4,0x00,0x0a,0xe2,0x3f,0x90,0x00,0x4f,0x80,0xaf,0x10,0x00,0x0d,0xd0,0x5f,0x70,0x00,0x04,0xf8,0x0a,0xe2,0x00,
+  0x00,0x9f,0x22,0xea,0x00,0x00,0x1e,0x90,0x6f,0x20,0x00,0x03,0x10,0x04,0x00,0x3f,0xff,0xff,0xff,0xff,0xf1,0x3f,0xff,0xff,
+  0xff,0xff,0xf1,0x00,0x00,0x00,0x00,0x0b,0xf1,0x00,0x00,0x00,0x00,0x0b,0xf1,0x00,0x00,0x00,0x00,0x0b,0xf1,0x00,0x00,0x00,
+  0x00,0x05,0x81,0xcf,0xff,0xff,0x20,0xcf,0xff,0xff,0x20,0x00,0x00,0x01,0x7b,0xef,0xec,0x72,0x00,0x00,0x00,0x00,0x00,0x5e,
+  0xff,0xff,0xff,0xff,0x70,0x00,0x00,0x00,0x08,0xfe,0x94,0x10,0x24,0x8e,0xfa,0x00,0x00,0x00,0x6f,0xa2,0xff,0xff,0xea,0x31,
+  0x9f,0x80,0x00,0x02,0xfa,0x00,0xff,0xff,0xff,0xe1,0x08,0xf4,0x00,0x08,0xd1,0x00,0xfd,0x00,0x2b,0xf6,0x00,0xbb,0x00,0x0e,
+  0x60,0x00,0xfd,0x00,0x06,0xf6,0x00,0x4f,0x10,0x2f,0x20,0x00,0xfd,0x00,0x3c,0xf3,0x00,0x0e,0x40,0x3f,0x10,0x00,0xff,0xff,
+  0xff,0x70,0x00,0x0d,0x50,0x2f,0x20,0x00,0xff,0xff,0xf5,0x00,0x00,0x0e,0x40,0x0e,0x60,0x00,0xfd,0x04,0xfe,0x20,0x00,0x3f,
+  0x10,0x08,0xd0,0x00,0xfd,0x00,0x6f,0xc1,0x00,0xbb,0x00,0x02,0xfa,0x00,0xfd,0x00,0x07,0xfb,0x07,0xf4,0x00,0x00,0x7f,0xa1,
+  0x33,0x00,0x00,0x24,0x9f,0x90,0x00,0x00,0x09,0xfe,0x94,0x20,0x13,0x8e,0xfa,0x00,0x00,0x00,0x00,0x5e,0xff,0xff,0xff,0xff,
+  0x70,0x00,0x00,0x00,0x00,0x01,0x6b,0xef,0xec,0x71,0x00,0x00,0x00,0xcf,0xff,0xff,0xf2,0xcf,0xff,0xff,0xf2,0x00,0x3c,0xfe,
+  0x80,0x00,0x04,0xff,0xff,0xfb,0x00,0x0d,0xe5,0x12,0xbf,0x50,0x2f,0x70,0x00,0x1f,0x90,0x2f,0x70,0x00,0x1f,0x90,0x0d,0xe5,
+  0x12,0xaf,0x50,0x04,0xff,0xff,0xfb,0x00,0x00,0x3c,0xfe,0x80,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,
+  0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0xcf,0xff,0xff,0xff,0xff,0xfb,0xcf,0xff,0xff,0xff,0xff,
+  0xfb,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xff,0xff,0xff,0xfb,0xcf,0xff,0xff,0xff,0xff,0xfb,0x00,0x7d,0xea,0x20,0x06,
+  0xff,0xff,0xa0,0x0c,0xd3,0x2d,0xd0,0x01,0x10,0x0b,0x90,0x00,0x00,0x3d,0x10,0x00,0x03,0xb2,0x00,0x00,0x4c,0x10,0x00,0x05,
+  0xfe,0xff,0xe1,0x0f,0xff,0xff,0xf2,0x06,0xde,0xa1,0x00,0x4f,0xff,0xfa,0x00,0x9e,0x31,0xbd,0x00,0x00,0x02,0xcb,0x00,0x00,
+  0x7f,0xd3,0x00,0x00,0x7f,0xf9,0x00,0x66,0x11,0xaf,0x10,0x9f,0xff,0xfd,0x00,0x19,0xee,0xb2,0x00,0x00,0xbf,0xb0,0x07,0xfc,
+  0x10,0x1e,0xd1,0x00,0x47,0x20,0x00,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0xc0,0x00,0x00,0xbf,0x90,0x8f,0xf8,0x11,0x4b,0xff,0x90,0x8f,0xdf,0xff,0xfd,0x7f,
+  0x90,0x8f,0x78,0xee,0xa1,0x3f,0x90,0x8f,0x70,0x00,0x00,0x00,0x00,0x8f,0x70,0x00,0x00,0x00,0x00,0x8f,0x70,0x00,0x00,0x00,
+  0x00,0x5f,0x70,0x00,0x00,0x00,0x00,0x00,0x29,0xdf,0xff,0xff,0xff,0xff,0xf9,0x04,0xef,0xff,0xff,0xff,0xff,0xff,0xf9,0x1e,
+  0xff,0xff,0xfc,0x00,0x0d,0xf0,0x00,0x5f,0xff,0xff,0xfc,0x00,0x0d,0xf0,0x00,0x7f,0xff,0xff,0xfc,0x00,0x0d,0xf0,0x00,0x6f,
+  0xff,0xff,0xfc,0x00,0x0d,0xf0,0x00,0x2f,0xff,0xff,0xfc,0x00,0x0d,0xf0,0x00,0x07,0xff,0xff,0xfc,0x00,0x0d,0xf0,0x00,0x00,
+  0x5d,0xff,0xfc,0x00,0x0d,0xf0,0x00,0x00,0x00,0x35,0xfc,0x00,0x0d,0xf0,0x00,0x00,0x00,0x01,0xfc,0x00,0x0d,0xf0,0x00,0x00,
+  0x00,0x01,0xfc,0x00,0x0d,0xf0,0x00,0x00,0x00,0x01,0xfc,0x00,0x0d,0xf0,0x00,0x00,0x00,0x01,0xfc,0x00,0x0d,0xf0,0x00,0x00,
+  0x00,0x01,0xfc,0x00,0x0d,0xf0,0x00,0x00,0x00,0x01,0xfc,0x00,0x0d,0xf0,0x00,0x00,0x00,0x01,0xfc,0x00,0x0d,0xf0,0x00,0x00,
+  0x00,0x01,0xfc,0x00,0x0d,0xf0,0x00,0x00,0x00,0x01,0xfc,0x00,0x0d,0xf0,0x00,0x00,0x00,0x01,0x86,0x00,0x07,0x80,0x00,0x2c,
+  0xe8,0x00,0x7f,0xff,0x00,0x2c,0xe8,0x00,0x06,0xf3,0x00,0x02,0x5e,0x80,0x4f,0xff,0xd0,0x2c,0xfc,0x40,0x00,0x27,0x30,0x03,
+  0xdf,0x60,0x4f,0xcf,0x60,0x15,0x2f,0x60,0x00,0x2f,0x60,0x00,0x2f,0x60,0x00,0x2f,0x60,0x0e,0xff,0xfe,0x0e,0xff,0xfe,0x00,
+  0x5d,0xfd,0x70,0x00,0x06,0xff,0xff,0xf8,0x00,0x0d,0xe4,0x13,0xdf,0x10,0x2f,0x90,0x00,0x7f,0x30,0x1f,0x90,0x00,0x7f,0x30,
+  0x0d,0xe4,0x13,0xdf,0x10,0x06,0xff,0xff,0xf8,0x00,0x00,0x5d,0xfd,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x40,0x7c,0x00,
+  0x00,0x0c,0xd0,0x4f,0x70,0x00,0x03,0xf8,0x0a,0xe2,0x00,0x00,0x9f,0x32,0xeb,0x00,0x00,0x1f,0xb0,0x7f,0x40,0x00,0x6f,0x50,
+  0xdd,0x10,0x01,0xeb,0x07,0xf4,0x00,0x0a,0xe2,0x2e,0xa0,0x00,0x2f,0x70,0x8e,0x10,0x00,0x04,0x00,0x13,0x00,0x00,0x01,0xaf,
+  0x30,0x00,0x00,0x00,0xbc,0x00,0x3d,0xff,0x30,0x00,0x00,0x07,0xf3,0x00,0x69,0x6f,0x30,0x00,0x00,0x2e,0x90,0x00,0x00,0x6f,
+  0x30,0x00,0x00,0xae,0x10,0x00,0x00,0x6f,0x30,0x00,0x04,0xf5,0x00,0x00,0x00,0x6f,0x30,0x00,0x0d,0xb0,0x00,0x00,0x00,0x6f,
+  0x30,0x00,0x7f,0x30,0x00,0x00,0x2f,0xff,0xfb,0x02,0xe8,0x00,0x00,0x00,0x2f,0xff,0xfb,0x0a,0xd1,0x00,0x4f,0x80,0x00,0x00,
+  0x00,0x4f,0x50,0x01,0xef,0x80,0x00,0x00,0x00,0xdb,0x00,0x0a,0xcc,0x80,0x00,0x00,0x07,0xf2,0x00,0x6c,0x1c,0x80,0x00,0x00,
+  0x2f,0x80,0x02,0xb1,0x0c,0x80,0x00,0x00,0xbd,0x10,0x0b,0xff,0xff,0xfd,0x00,0x05,0xf5,0x00,0x0e,0xff,0xff,0xfc,0x00,0x1d,
+  0xb0,0x00,0x00,0x00,0x0c,0x80,0x00,0x8d,0x20,0x00,0x00,0x00,0x0c,0x80,0x01,0xaf,0x30,0x00,0x00,0x05,0xe4,0x00,0x3d,0xff,
+  0x30,0x00,0x00,0x1e,0xa0,0x00,0x69,0x6f,0x30,0x00,0x00,0x9e,0x20,0x00,0x00,0x6f,0x30,0x00,0x03,0xf7,0x00,0x00,0x00,0x6f,
+  0x30,0x00,0x0c,0xc0,0x00,0x00,0x00,0x6f,0x30,0x00,0x6f,0x40,0x00,0x00,0x00,0x6f,0x30,0x01,0xea,0x00,0x00,0x00,0x2f,0xff,
+  0xfb,0x09,0xe1,0x00,0x00,0x00,0x2f,0xff,0xfb,0x3f,0x70,0x4c,0xec,0x40,0x00,0x00,0x00,0xcc,0x02,0xef,0xff,0xe1,0x00,0x00,
+  0x06,0xf4,0x06,0xf6,0x19,0xf3,0x00,0x00,0x1e,0x90,0x01,0x20,0x06,0xe1,0x00,0x00,0x9e,0x10,0x00,0x00,0x0c,0x40,0x00,0x04,
+  0xf6,0x00,0x00,0x01,0xa5,0x00,0x00,0x0c,0xc0,0x00,0x00,0x1b,0x40,0x00,0x00,0x7f,0x30,0x00,0x01,0xce,0xff,0xf6,0x01,0xe8,
+  0x00,0x00,0x09,0xff,0xff,0xf7,0x01,0x9e,0xea,0x10,0x00,0x00,0x0a,0xc0,0x00,0x09,0xff,0xff,0x90,0x00,0x00,0x6f,0x40,0x00,
+  0x07,0x61,0x3e,0xa0,0x00,0x01,0xe9,0x00,0x00,0x00,0x0a,0xfc,0x20,0x00,0x09,0xe1,0x00,0x00,0x00,0x0a,0xfe,0x50,0x00,0x3f,
+  0x60,0x00,0x00,0x00,0x00,0x2d,0xd0,0x00,0xcc,0x00,0x00,0x00,0x1e,0x91,0x2d,0xd0,0x06,0xf3,0x00,0x00,0x00,0x0a,0xff,0xff,
+  0x80,0x1e,0x90,0x00,0x00,0x00,0x01,0xae,0xe8,0x00,0x9e,0x10,0x04,0xf8,0x00,0x00,0x00,0x00,0x03,0xf6,0x00,0x1e,0xf8,0x00,
+  0x00,0x00,0x00,0x0c,0xc0,0x00,0xab,0xc8,0x00,0x00,0x00,0x00,0x7f,0x30,0x06,0xc1,0xb8,0x00,0x00,0x00,0x01,0xe9,0x00,0x2b,
+  0x10,0xb8,0x00,0x00,0x00,0x0a,0xe1,0x00,0xbf,0xff,0xff,0xd0,0x00,0x00,0x4f,0x60,0x00,0xef,0xff,0xff,0xc0,0x00,0x00,0xcc,
+  0x00,0x00,0x00,0x00,0xb8,0x00,0x00,0x07,0xe3,0x00,0x00,0x00,0x00,0xb8,0x00,0x00,0x00,0xbe,0x80,0x00,0x00,0x00,0xbe,0x80,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,0x7f,0x20,0x00,0x00,0x00,0x9f,
+  0x30,0x00,0x00,0x04,0xee,0x10,0x00,0x00,0x8f,0xe4,0x00,0x00,0x09,0xfb,0x10,0x00,0x00,0x3f,0xd1,0x00,0x00,0x00,0x6f,0x90,
+  0x00,0x00,0x00,0x6f,0xb0,0x00,0x00,0x10,0x3f,0xf8,0x11,0x4b,0xd0,0x08,0xff,0xff,0xff,0xa1,0x00,0x5c,0xfe,0xb5,0x00,0x00,
+  0x00,0x8f,0xe5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xef,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0xf5,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xfd,0x7f,0xc0,0x00,0x00,0x00,0x00,
+  0x00,0x0c,0xf7,0x2f,0xf3,0x00,0x00,0x00,0x00,0x00,0x3f,0xf2,0x0b,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x05,0xfe,0x10,
+  0x00,0x00,0x00,0x01,0xef,0x50,0x00,0xef,0x60,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x9f,0xc0,0x00,0x00,0x00,0x0d,0xf8,0x00,
+  0x00,0x3f,0xf3,0x00,0x00,0x00,0x4f,0xf2,0x00,0x00,0x0c,0xf9,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xfe,0x10,0x00,0x01,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x60,0x00,0x07,0xff,0x20,0x00,0x00,0x00,0xbf,0xc0,0x00,0x0d,0xfa,0x00,0x00,0x00,0x00,0x4f,
+  0xf3,0x00,0x4f,0xf3,0x00,0x00,0x00,0x00,0x0c,0xf9,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0x05,0xfe,0x10,0x00,0x00,0x00,0x00,
+  0x4e,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0xd3,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xfd,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xf7,
+  0x2f,0xf3,0x00,0x00,0x00,0x00,0x00,0x3f,0xf2,0x0b,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x05,0xfe,0x10,0x00,0x00,0x00,
+  0x01,0xef,0x50,0x00,0xef,0x60,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x9f,0xc0,0x00,0x00,0x00,0x0d,0xf8,0x00,0x00,0x3f,0xf3,
+  0x00,0x00,0x00,0x4f,0xf2,0x00,0x00,0x0c,0xf9,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xfe,0x10,0x00,0x01,0xff,0xff,0xff,
+  0xff,0xff,0xff,0x60,0x00,0x07,0xff,0x20,0x00,0x00,0x00,0xbf,0xc0,0x00,0x0d,0xfa,0x00,0x00,0x00,0x00,0x4f,0xf3,0x00,0x4f,
+  0xf3,0x00,0x00,0x00,0x00,0x0c,0xf9,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0x05,0xfe,0x10,0x00,0x00,0x00,0x17,0x84,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0xde,0xdf,0x60,0x00,0x00,0x00,0x00,0x00,0x4e,0xc2,0x19,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0xef,0xdf,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xfd,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xf7,0x2f,0xf3,0x00,
+  0x00,0x00,0x00,0x00,0x3f,0xf2,0x0b,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x05,0xfe,0x10,0x00,0x00,0x00,0x01,0xef,0x50,
+  0x00,0xef,0x60,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x9f,0xc0,0x00,0x00,0x00,0x0d,0xf8,0x00,0x00,0x3f,0xf3,0x00,0x00,0x00,
+  0x4f,0xf2,0x00,0x00,0x0c,0xf9,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xfe,0x10,0x00,0x01,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x60,0x00,0x07,0xff,0x20,0x00,0x00,0x00,0xbf,0xc0,0x00,0x0d,0xfa,0x00,0x00,0x00,0x00,0x4f,0xf3,0x00,0x4f,0xf3,0x00,0x00,
+  0x00,0x00,0x0c,0xf9,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0x05,0xfe,0x10,0x00,0x00,0x05,0xed,0x61,0xb9,0x00,0x00,0x00,0x00,
+  0x00,0x0e,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x2f,0x33,0xae,0xb1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,
+  0xdf,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xfd,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xf7,0x2f,0xf3,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xf2,0x0b,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x05,0xfe,0x10,0x00,0x00,0x00,0x01,0xef,0x50,0x00,0xef,0x60,
+  0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x9f,0xc0,0x00,0x00,0x00,0x0d,0xf8,0x00,0x00,0x3f,0xf3,0x00,0x00,0x00,0x4f,0xf2,0x00,
+  0x00,0x0c,0xf9,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xfe,0x10,0x00,0x01,0xff,0xff,0xff,0xff,0xff,0xff,0x60,0x00,0x07,
+  0xff,0x20,0x00,0x00,0x00,0xbf,0xc0,0x00,0x0d,0xfa,0x00,0x00,0x00,0x00,0x4f,0xf3,0x00,0x4f,0xf3,0x00,0x00,0x00,0x00,0x0c,
+  0xf9,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0x05,0xfe,0x10,0x00,0x00,0x6e,0x90,0x05,0xeb,0x00,0x00,0x00,0x00,0x00,0x6e,0xa0,
+  0x05,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xfd,0x7f,0xc0,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xf7,0x2f,0xf3,0x00,0x00,0x00,0x00,0x00,0x3f,0xf2,0x0b,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,
+  0x05,0xfe,0x10,0x00,0x00,0x00,0x01,0xef,0x50,0x00,0xef,0x60,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x9f,0xc0,0x00,0x00,0x00,
+  0x0d,0xf8,0x00,0x00,0x3f,0xf3,0x00,0x00,0x00,0x4f,0xf2,0x00,0x00,0x0c,0xf9,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xfe,
+  0x10,0x00,0x01,0xff,0xff,0xff,0xff,0xff,0xff,0x60,0x00,0x07,0xff,0x20,0x00,0x00,0x00,0xbf,0xc0,0x00,0x0d,0xfa,0x00,0x00,
+  0x00,0x00,0x4f,0xf3,0x00,0x4f,0xf3,0x00,0x00,0x00,0x00,0x0c,0xf9,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0x05,0xfe,0x10,0x00,
+  0x00,0x00,0x4d,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x01,0xf4,0x2d,0x60,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+  0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x60,0x00,0x00,0x00,0x00,
+  0x00,0x06,0xfd,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xf7,0x2f,0xf3,0x00,0x00,0x00,0x00,0x00,0x3f,0xf2,0x0b,0xf9,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xb0,0x05,0xfe,0x10,0x00,0x00,0x00,0x01,0xef,0x50,0x00,0xef,0x60,0x00,0x00,0x00,0x07,0xfe,0x00,
+  0x00,0x9f,0xc0,0x00,0x00,0x00,0x0d,0xf8,0x00,0x00,0x3f,0xf3,0x00,0x00,0x00,0x4f,0xf2,0x00,0x00,0x0c,0xf9,0x00,0x00,0x00,
+  0xaf,0xff,0xff,0xff,0xff,0xfe,0x10,0x00,0x01,0xff,0xff,0xff,0xff,0xff,0xff,0x60,0x00,0x07,0xff,0x20,0x00,0x00,0x00,0xbf,
+  0xc0,0x00,0x0d,0xfa,0x00,0x00,0x00,0x00,0x4f,0xf3,0x00,0x4f,0xf3,0x00,0x00,0x00,0x00,0x0c,0xf9,0x00,0xaf,0xa0,0x00,0x00,
+  0x00,0x00,0x05,0xfe,0x10,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x1e,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x8f,0xaf,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x3e,0xf4,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xfb,0x0c,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xf3,0x0a,0xf7,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xa0,0x09,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x30,0x07,0xfb,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xfa,0x00,0x05,0xff,0xff,0xff,0xff,0x70,0x00,0x00,0x00,0x4f,0xf3,0x00,0x03,0xff,
+  0xff,0xff,0xff,0x70,0x00,0x00,0x00,0xcf,0xa0,0x00,0x01,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xff,0xff,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xff,0xff,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x6f,0xf3,0x00,0x00,0x00,0xbf,
+  0x80,0x00,0x00,0x00,0x00,0x01,0xef,0x90,0x00,0x00,0x00,0x9f,0xa0,0x00,0x00,0x00,0x00,0x07,0xfe,0x10,0x00,0x00,0x00,0x7f,
+  0xff,0xff,0xff,0xff,0x10,0x1e,0xf5,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0x10,0x00,0x00,0x17,0xbd,0xfe,0xc8,0x20,
+  0x00,0x00,0x06,0xef,0xff,0xff,0xff,0xf8,0x00,0x00,0x9f,0xfc,0x52,0x01,0x38,0xff,0x30,0x06,0xff,0x80,0x00,0x00,0x00,0x24,
+  0x00,0x1e,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xdf,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xbf,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xf9,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x09,0xff,0x70,0x00,0x00,0x00,0x47,0x00,0x01,0xcf,0xfb,0x51,0x01,0x4a,0xff,0x30,0x00,0x1a,0xff,0xff,0xff,0xff,0xe5,
+  0x00,0x00,0x00,0x39,0xdf,0xfe,0xc8,0x10,0x00,0x00,0x00,0x00,0x0c,0xc3,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x6f,0x50,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x6d,0xea,0x10,0x00,0x00,0x04,0xef,0xa0,0x00,0x00,0x00,0x00,
+  0x2c,0xfa,0x00,0x00,0x00,0x00,0x00,0x8f,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,
+  0xff,0xff,0xff,0xff,0xa0,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xf2,0x00,0xef,
+  0xff,0xff,0xff,0xf2,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0x00,
+  0x00,0x01,0xcf,0xd2,0x00,0x00,0x00,0x1c,0xfa,0x10,0x00,0x00,0x01,0xce,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xff,0xff,0xf2,0x00,0xef,0xff,0xff,0xff,0xf2,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,
+  0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x68,0x60,0x00,0x00,0x00,0x0a,0xfc,0xfa,0x10,0x00,0x01,0xbe,0x60,0x5e,0xc1,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xf2,0x00,0xef,0xff,0xff,0xff,0xf2,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0x02,0xdd,0x20,0x1d,0xe3,0x00,0x02,0xdd,0x20,0x1d,0xe3,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xf2,0x00,0xef,0xff,0xff,0xff,0xf2,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0x2d,0xfb,0x10,0x00,0x01,0xaf,0xc1,0x00,0x00,0x07,0xec,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,
+  0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,
+  0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,
+  0x0a,0xfe,0x40,0x00,0xaf,0xc2,0x00,0x0a,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,
+  0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,
+  0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,
+  0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x05,0x87,0x10,0x00,0x00,0x7f,0xcf,0xc1,0x00,0x09,0xf7,0x03,
+  0xdd,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,
+  0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,
+  0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,
+  0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x1c,0xe4,0x00,0xbe,
+  0x50,0x1c,0xe4,0x00,0xbe,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,
+  0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,
+  0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,
+  0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,
+  0x00,0x0f,0xff,0xff,0xff,0xeb,0x71,0x00,0x00,0x00,0x0f,0xff,0xff,0xff,0xff,0xfe,0x70,0x00,0x00,0x0f,0xf4,0x00,0x00,0x25,
+  0xbf,0xf9,0x00,0x00,0x0f,0xf4,0x00,0x00,0x00,0x07,0xff,0x60,0x00,0x0f,0xf4,0x00,0x00,0x00,0x00,0x9f,0xe1,0x00,0x0f,0xf4,
+  0x00,0x00,0x00,0x00,0x2f,0xf6,0x00,0x0f,0xf4,0x00,0x00,0x00,0x00,0x0c,0xfa,0x00,0x0f,0xf4,0x00,0x00,0x00,0x00,0x09,0xfc,
+  0x6f,0xff,0xff,0xff,0xfd,0x00,0x00,0x08,0xfd,0x6f,0xff,0xff,0xff,0xfd,0x00,0x00,0x09,0xfc,0x00,0x0f,0xf4,0x00,0x00,0x00,
+  0x00,0x0b,0xfa,0x00,0x0f,0xf4,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x0f,0xf4,0x00,0x00,0x00,0x00,0x9f,0xe1,0x00,0x0f,0xf4,
+  0x00,0x00,0x00,0x07,0xff,0x60,0x00,0x0f,0xf4,0x00,0x00,0x15,0xbf,0xf9,0x00,0x00,0x0f,0xff,0xff,0xff,0xff,0xfe,0x70,0x00,
+  0x00,0x0f,0xff,0xff,0xff,0xeb,0x71,0x00,0x00,0x00,0x00,0x3d,0xe8,0x18,0xc0,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0x90,0x00,
+  0x00,0x00,0x00,0xe6,0x29,0xec,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xee,0x30,0x00,0x00,0x00,0x00,0xff,
+  0x00,0xef,0xd1,0x00,0x00,0x00,0x00,0xff,0x00,0xef,0xfa,0x00,0x00,0x00,0x00,0xff,0x00,0xef,0xef,0x70,0x00,0x00,0x00,0xff,
+  0x00,0xef,0x6f,0xf4,0x00,0x00,0x00,0xff,0x00,0xef,0x27,0xfe,0x10,0x00,0x00,0xff,0x00,0xef,0x20,0xbf,0xb0,0x00,0x00,0xff,
+  0x00,0xef,0x20,0x1d,0xf8,0x00,0x00,0xff,0x00,0xef,0x20,0x03,0xff,0x50,0x00,0xff,0x00,0xef,0x20,0x00,0x6f,0xe2,0x00,0xff,
+  0x00,0xef,0x20,0x00,0x0a,0xfc,0x00,0xff,0x00,0xef,0x20,0x00,0x01,0xcf,0x90,0xff,0x00,0xef,0x20,0x00,0x00,0x2e,0xf6,0xff,
+  0x00,0xef,0x20,0x00,0x00,0x05,0xff,0xff,0x00,0xef,0x20,0x00,0x00,0x00,0x9f,0xff,0x00,0xef,0x20,0x00,0x00,0x00,0x0c,0xff,
+  0x00,0xef,0x20,0x00,0x00,0x00,0x02,0xdf,0x00,0x00,0x00,0x3d,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xb0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,
+  0xbe,0xfe,0xc8,0x20,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,
+  0x06,0xff,0x70,0x00,0x00,0x00,0x5f,0xf9,0x00,0x1e,0xf9,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x6f,0xe1,0x00,0x00,0x00,0x00,
+  0x00,0xdf,0x90,0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xdf,0x80,0x00,
+  0x00,0x00,0x00,0x00,0x5f,0xf1,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,
+  0x6f,0xe1,0x00,0x00,0x00,0x00,0x00,0xdf,0x90,0x1e,0xf8,0x00,0x00,0x00,0x00,0x06,0xff,0x30,0x07,0xff,0x60,0x00,0x00,0x00,
+  0x4f,0xf9,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x17,
+  0xbe,0xfe,0xc8,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xfd,0x30,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xb1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1b,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc8,
+  0x20,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,0x06,0xff,0x70,
+  0x00,0x00,0x00,0x5f,0xf9,0x00,0x1e,0xf9,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x6f,0xe1,0x00,0x00,0x00,0x00,0x00,0xdf,0x90,
+  0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xdf,0x80,0x00,0x00,0x00,0x00,
+  0x00,0x5f,0xf1,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0x6f,0xe1,0x00,
+  0x00,0x00,0x00,0x00,0xdf,0x90,0x1e,0xf8,0x00,0x00,0x00,0x00,0x06,0xff,0x30,0x07,0xff,0x60,0x00,0x00,0x00,0x4f,0xf9,0x00,
+  0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc8,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x06,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xcf,0xb1,0x00,0x00,0x00,0x00,0x00,0x1b,
+  0xe6,0x04,0xdc,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc8,0x20,0x00,0x00,
+  0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,0x06,0xff,0x70,0x00,0x00,0x00,
+  0x5f,0xf9,0x00,0x1e,0xf9,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x6f,0xe1,0x00,0x00,0x00,0x00,0x00,0xdf,0x90,0xaf,0xb0,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xd0,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xdf,0x80,0x00,0x00,0x00,0x00,0x00,0x5f,0xf1,
+  0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0x6f,0xe1,0x00,0x00,0x00,0x00,
+  0x00,0xdf,0x90,0x1e,0xf8,0x00,0x00,0x00,0x00,0x06,0xff,0x30,0x07,0xff,0x60,0x00,0x00,0x00,0x4f,0xf9,0x00,0x00,0x9f,0xfb,
+  0x51,0x01,0x4a,0xff,0xb0,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc8,0x20,0x00,0x00,
+  0x00,0x00,0x01,0xbe,0x93,0x4f,0x10,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x0b,0xa1,0x7d,0xd4,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc8,0x20,0x00,0x00,0x00,0x07,0xef,
+  0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,0x06,0xff,0x70,0x00,0x00,0x00,0x5f,0xf9,0x00,
+  0x1e,0xf9,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x6f,0xe1,0x00,0x00,0x00,0x00,0x00,0xdf,0x90,0xaf,0xb0,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xd0,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xdf,0x80,0x00,0x00,0x00,0x00,0x00,0x5f,0xf1,0xcf,0x80,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xf0,0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0x6f,0xe1,0x00,0x00,0x00,0x00,0x00,0xdf,0x90,
+  0x1e,0xf8,0x00,0x00,0x00,0x00,0x06,0xff,0x30,0x07,0xff,0x60,0x00,0x00,0x00,0x4f,0xf9,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,
+  0xff,0xb0,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc8,0x20,0x00,0x00,0x00,0x00,0x1d,
+  0xd2,0x01,0xce,0x40,0x00,0x00,0x00,0x00,0x1d,0xd3,0x01,0xce,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x17,0xbe,0xfe,0xc8,0x20,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,
+  0xff,0xb0,0x00,0x06,0xff,0x70,0x00,0x00,0x00,0x5f,0xf9,0x00,0x1e,0xf9,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x6f,0xe1,0x00,
+  0x00,0x00,0x00,0x00,0xdf,0x90,0xaf,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,
+  0xdf,0x80,0x00,0x00,0x00,0x00,0x00,0x5f,0xf1,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x6f,0xf0,0xaf,0xb0,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xd0,0x6f,0xe1,0x00,0x00,0x00,0x00,0x00,0xdf,0x90,0x1e,0xf8,0x00,0x00,0x00,0x00,0x06,0xff,0x30,0x07,0xff,0x60,
+  0x00,0x00,0x00,0x4f,0xf9,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4a,0xff,0xb0,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xf9,0x00,0x00,
+  0x00,0x00,0x17,0xbe,0xfe,0xc8,0x20,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x10,0x2e,0x90,0x00,0x00,0x1b,0xc1,0x0a,0xf9,0x00,
+  0x01,0xbf,0x80,0x00,0xaf,0x90,0x1b,0xf8,0x00,0x00,0x0a,0xf9,0xbf,0x80,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x01,0xbf,
+  0xf9,0x00,0x00,0x00,0x1b,0xf8,0xaf,0x90,0x00,0x01,0xbf,0x80,0x0a,0xf9,0x00,0x1b,0xf8,0x00,0x00,0xaf,0x90,0x3e,0x80,0x00,
+  0x00,0x0a,0xd1,0x02,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x17,0xbe,0xfe,0xc8,0x21,0xae,0x20,0x00,0x07,0xef,0xff,0xff,0xff,
+  0xfd,0xe3,0x00,0x00,0x9f,0xfb,0x51,0x01,0x4b,0xff,0xb0,0x00,0x06,0xff,0x70,0x00,0x00,0x04,0xff,0xf8,0x00,0x1e,0xf9,0x00,
+  0x00,0x00,0x2e,0xb7,0xff,0x20,0x6f,0xf1,0x00,0x00,0x00,0xcd,0x10,0xdf,0x80,0xaf,0xb0,0x00,0x00,0x08,0xf4,0x00,0x9f,0xc0,
+  0xcf,0x80,0x00,0x00,0x5f,0x70,0x00,0x6f,0xf0,0xdf,0x80,0x00,0x02,0xea,0x00,0x00,0x5f,0xf1,0xcf,0x80,0x00,0x0c,0xd1,0x00,
+  0x00,0x6f,0xf0,0xaf,0xb0,0x00,0x9e,0x30,0x00,0x00,0x9f,0xd0,0x6f,0xe1,0x06,0xf6,0x00,0x00,0x00,0xdf,0x90,0x1e,0xf8,0x3e,
+  0x90,0x00,0x00,0x06,0xff,0x30,0x06,0xff,0xec,0x10,0x00,0x00,0x4f,0xf9,0x00,0x00,0x9f,0xfc,0x52,0x01,0x4a,0xff,0xc1,0x00,
+  0x00,0x6f,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x03,0xf8,0x17,0xce,0xfe,0xc8,0x20,0x00,0x00,0x1d,0xa0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0xcf,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0xc1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x0e,0xf6,0x00,0x00,0x00,0x00,0xdf,0x70,0x0b,0xfb,0x00,0x00,0x00,0x03,0xff,0x40,0x05,0xff,0x50,0x00,0x00,
+  0x0c,0xfd,0x00,0x00,0xaf,0xf8,0x30,0x15,0xcf,0xf4,0x00,0x00,0x1a,0xff,0xff,0xff,0xfe,0x50,0x00,0x00,0x00,0x4a,0xdf,0xec,
+  0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xe4,0x00,0x00,0x00,0x00,0x00,0x09,0xfc,0x20,0x00,0x00,0x00,0x00,0x00,0x9f,0x90,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x0e,0xf6,0x00,0x00,0x00,0x00,0xdf,0x70,0x0b,0xfb,0x00,0x00,0x00,0x03,0xff,0x40,0x05,0xff,0x50,0x00,0x00,
+  0x0c,0xfd,0x00,0x00,0xaf,0xf8,0x30,0x15,0xcf,0xf4,0x00,0x00,0x1a,0xff,0xff,0xff,0xfe,0x50,0x00,0x00,0x00,0x4a,0xdf,0xec,
+  0x81,0x00,0x00,0x00,0x00,0x00,0x48,0x71,0x00,0x00,0x00,0x00,0x00,0x07,0xfd,0xfd,0x20,0x00,0x00,0x00,0x00,0x8f,0x80,0x3c,
+  0xe3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x0e,0xf6,0x00,0x00,0x00,0x00,0xdf,0x70,0x0b,0xfb,0x00,0x00,0x00,0x03,0xff,0x40,0x05,0xff,0x50,0x00,0x00,
+  0x0c,0xfd,0x00,0x00,0xaf,0xf8,0x30,0x15,0xcf,0xf4,0x00,0x00,0x1a,0xff,0xff,0xff,0xfe,0x50,0x00,0x00,0x00,0x4a,0xdf,0xec,
+  0x81,0x00,0x00,0x00,0x00,0xbe,0x40,0x0a,0xe6,0x00,0x00,0x00,0x00,0xce,0x40,0x0b,0xe6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,
+  0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x1f,0xf4,0x00,0x00,0x00,0x00,0xbf,0x90,0x0e,0xf6,0x00,0x00,0x00,
+  0x00,0xdf,0x70,0x0b,0xfb,0x00,0x00,0x00,0x03,0xff,0x40,0x05,0xff,0x50,0x00,0x00,0x0c,0xfd,0x00,0x00,0xaf,0xf8,0x30,0x15,
+  0xcf,0xf4,0x00,0x00,0x1a,0xff,0xff,0xff,0xfe,0x50,0x00,0x00,0x00,0x4a,0xdf,0xec,0x81,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,
+  0xd2,0x00,0x00,0x00,0x00,0x00,0x1c,0xfa,0x10,0x00,0x00,0x00,0x00,0x01,0xce,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x9f,0xc1,0x00,0x00,0x00,0x00,0xbf,0xb0,0x1e,0xf8,0x00,0x00,0x00,0x06,0xff,0x20,0x06,0xff,0x20,0x00,0x00,
+  0x1e,0xf7,0x00,0x00,0xbf,0xb0,0x00,0x00,0x9f,0xd0,0x00,0x00,0x2f,0xf5,0x00,0x03,0xff,0x40,0x00,0x00,0x08,0xfd,0x00,0x0c,
+  0xfa,0x00,0x00,0x00,0x01,0xdf,0x70,0x6f,0xe1,0x00,0x00,0x00,0x00,0x4f,0xe2,0xdf,0x60,0x00,0x00,0x00,0x00,0x0a,0xfc,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0xaf,0xa0,0x00,0x00,0x00,
+  0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0xaf,0xff,0xff,0xec,0x71,0x00,0xaf,0xff,0xff,0xff,0xfe,
+  0x40,0xaf,0xa0,0x00,0x15,0xdf,0xe1,0xaf,0xa0,0x00,0x00,0x2e,0xf7,0xaf,0xa0,0x00,0x00,0x0a,0xfb,0xaf,0xa0,0x00,0x00,0x08,
+  0xfc,0xaf,0xa0,0x00,0x00,0x0a,0xfb,0xaf,0xa0,0x00,0x00,0x3f,0xf7,0xaf,0xa0,0x00,0x27,0xef,0xd1,0xaf,0xff,0xff,0xff,0xfd,
+  0x20,0xaf,0xff,0xff,0xeb,0x71,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0xaf,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x18,0xce,0xfd,0x81,0x00,0x03,0xef,0xff,0xff,0xfd,0x10,0x1e,0xfd,0x51,0x15,0xdf,0x90,0x7f,0xe1,0x00,0x00,0x5f,
+  0xc0,0xaf,0x90,0x00,0x00,0x5f,0xa0,0xbf,0x60,0x00,0x03,0xee,0x20,0xcf,0x60,0x00,0x7f,0xc2,0x00,0xcf,0x60,0x07,0xfb,0x00,
+  0x00,0xcf,0x60,0x0c,0xf8,0x00,0x00,0xcf,0x60,0x09,0xff,0x81,0x00,0xcf,0x60,0x00,0x8e,0xfe,0x50,0xcf,0x60,0x00,0x01,0x8f,
+  0xf3,0xcf,0x60,0x00,0x00,0x07,0xf9,0xcf,0x60,0x00,0x00,0x06,0xfa,0xcf,0x63,0xd8,0x20,0x4d,0xf7,0xcf,0x63,0xef,0xff,0xff,
+  0xc1,0xcf,0x60,0x29,0xee,0xc7,0x10,0x00,0x7f,0xd2,0x00,0x00,0x00,0x08,0xfa,0x00,0x00,0x00,0x00,0xaf,0x40,0x00,0x00,0x00,
+  0x07,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0xef,0xd8,0x10,0x08,0xff,0xff,0xff,0xb0,0x2e,0xb4,0x11,0x5e,0xf5,0x00,
+  0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x06,0xfa,0x00,0x28,0xbd,0xef,0xfa,0x09,0xff,0xff,0xff,0xfa,0x8f,0xd7,0x42,0x06,0xfa,
+  0xdf,0x40,0x00,0x07,0xfa,0xcf,0x91,0x02,0x8e,0xfa,0x6f,0xff,0xff,0xd4,0xfa,0x07,0xdf,0xd8,0x10,0xea,0x00,0x00,0x03,0xef,
+  0x60,0x00,0x00,0x0c,0xf7,0x00,0x00,0x00,0x6f,0x90,0x00,0x00,0x00,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0xef,
+  0xd8,0x10,0x08,0xff,0xff,0xff,0xb0,0x2e,0xb4,0x11,0x5e,0xf5,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x06,0xfa,0x00,0x28,
+  0xbd,0xef,0xfa,0x09,0xff,0xff,0xff,0xfa,0x8f,0xd7,0x42,0x06,0xfa,0xdf,0x40,0x00,0x07,0xfa,0xcf,0x91,0x02,0x8e,0xfa,0x6f,
+  0xff,0xff,0xd4,0xfa,0x07,0xdf,0xd8,0x10,0xea,0x00,0x03,0xef,0xb0,0x00,0x00,0x2d,0xd7,0xfa,0x00,0x01,0xdd,0x20,0x5e,0x80,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0xef,0xd8,0x10,0x08,0xff,0xff,0xff,0xb0,0x2e,0xb4,0x11,0x5e,
+  0xf5,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x06,0xfa,0x00,0x28,0xbd,0xef,0xfa,0x09,0xff,0xff,0xff,0xfa,0x8f,0xd7,0x42,
+  0x06,0xfa,0xdf,0x40,0x00,0x07,0xfa,0xcf,0x91,0x02,0x8e,0xfa,0x6f,0xff,0xff,0xd4,0xfa,0x07,0xdf,0xd8,0x10,0xea,0x00,0x3d,
+  0xd7,0x19,0xc0,0x00,0xcf,0xff,0xff,0x90,0x01,0xf6,0x29,0xeb,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x4a,0xef,0xd8,0x10,0x08,0xff,0xff,0xff,0xb0,0x2e,0xb4,0x11,0x5e,0xf5,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x06,0xfa,
+  0x00,0x28,0xbd,0xef,0xfa,0x09,0xff,0xff,0xff,0xfa,0x8f,0xd7,0x42,0x06,0xfa,0xdf,0x40,0x00,0x07,0xfa,0xcf,0x91,0x02,0x8e,
+  0xfa,0x6f,0xff,0xff,0xd4,0xfa,0x07,0xdf,0xd8,0x10,0xea,0x01,0xce,0x40,0x9e,0x80,0x01,0xce,0x40,0x9e,0x80,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0xef,0xd8,0x10,0x08,0xff,0xff,0xff,0xb0,0x2e,0xb4,
+  0x11,0x5e,0xf5,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,0x06,0xfa,0x00,0x28,0xbd,0xef,0xfa,0x09,0xff,0xff,0xff,0xfa,0x8f,
+  0xd7,0x42,0x06,0xfa,0xdf,0x40,0x00,0x07,0xfa,0xcf,0x91,0x02,0x8e,0xfa,0x6f,0xff,0xff,0xd4,0xfa,0x07,0xdf,0xd8,0x10,0xea,
+  0x00,0x02,0xbe,0x80,0x00,0x00,0x0b,0xff,0xf6,0x00,0x00,0x0f,0x61,0xaa,0x00,0x00,0x0f,0x61,0xaa,0x00,0x00,0x0b,0xff,0xf6,
+  0x00,0x00,0x4c,0xff,0xf8,0x10,0x08,0xff,0xff,0xff,0xb0,0x2e,0xb4,0x11,0x5e,0xf5,0x00,0x00,0x00,0x08,0xf9,0x00,0x00,0x00,
+  0x06,0xfa,0x00,0x28,0xbd,0xef,0xfa,0x09,0xff,0xff,0xff,0xfa,0x8f,0xd7,0x42,0x06,0xfa,0xdf,0x40,0x00,0x07,0xfa,0xcf,0x91,
+  0x02,0x8e,0xfa,0x6f,0xff,0xff,0xd4,0xfa,0x07,0xdf,0xd8,0x10,0xea,0x00,0x4a,0xee,0xc5,0x00,0x4b,0xee,0xa2,0x00,0x08,0xff,
+  0xff,0xff,0x46,0xff,0xff,0xfe,0x30,0x2e,0xc5,0x11,0x5f,0xdf,0xd4,0x12,0x8f,0xc0,0x01,0x00,0x00,0x09,0xff,0x20,0x00,0x0a,
+  0xf3,0x00,0x00,0x00,0x07,0xfb,0x00,0x00,0x05,0xf7,0x00,0x27,0xbd,0xef,0xff,0xff,0xff,0xff,0xf9,0x09,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xf8,0x8f,0xe7,0x42,0x07,0xfb,0x00,0x00,0x00,0x00,0xdf,0x40,0x00,0x0a,0xfe,0x20,0x00,0x00,0x00,0xcf,0x91,
+  0x02,0x8f,0xaf,0xd5,0x10,0x26,0xb2,0x6f,0xff,0xff,0xfa,0x08,0xff,0xff,0xff,0xc1,0x06,0xce,0xeb,0x60,0x00,0x5b,0xee,0xc6,
+  0x00,0x00,0x04,0xae,0xfe,0x92,0x00,0x00,0x7f,0xff,0xff,0xfe,0x40,0x04,0xff,0xb3,0x01,0x5b,0x20,0x0b,0xfb,0x00,0x00,0x00,
+  0x00,0x0f,0xf5,0x00,0x00,0x00,0x00,0x1f,0xf2,0x00,0x00,0x00,0x00,0x1f,0xf2,0x00,0x00,0x00,0x00,0x0d,0xf5,0x00,0x00,0x00,
+  0x00,0x08,0xfc,0x00,0x00,0x01,0x00,0x01,0xcf,0xc4,0x23,0x8e,0x70,0x00,0x1a,0xff,0xff,0xf9,0x10,0x00,0x00,0x2b,0xc4,0x10,
+  0x00,0x00,0x00,0x08,0xdb,0x10,0x00,0x00,0x00,0x11,0x3f,0x80,0x00,0x00,0x00,0x8f,0xff,0x80,0x00,0x00,0x00,0x5d,0xea,0x10,
+  0x00,0x00,0x03,0xee,0x50,0x00,0x00,0x00,0x00,0x5f,0xd1,0x00,0x00,0x00,0x00,0x06,0xf8,0x00,0x00,0x00,0x00,0x00,0x57,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xad,0xfe,0xa3,0x00,0x00,0x6f,0xff,0xff,0xff,0x40,0x03,0xfe,0x62,0x02,0x6e,
+  0xe1,0x0a,0xf5,0x00,0x00,0x07,0xf5,0x0e,0xff,0xff,0xff,0xff,0xf8,0x1f,0xff,0xff,0xff,0xff,0xf8,0x1f,0xf1,0x00,0x00,0x00,
+  0x00,0x0e,0xf4,0x00,0x00,0x00,0x00,0x0a,0xfc,0x00,0x00,0x00,0x00,0x03,0xff,0xb4,0x11,0x4a,0xe3,0x00,0x5f,0xff,0xff,0xff,
+  0xb1,0x00,0x02,0x9d,0xfe,0xb5,0x00,0x00,0x00,0x00,0x1c,0xfa,0x00,0x00,0x00,0x00,0x8f,0xb0,0x00,0x00,0x00,0x02,0xfc,0x10,
+  0x00,0x00,0x00,0x04,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xad,0xfe,0xa3,0x00,0x00,0x6f,0xff,0xff,0xff,
+  0x40,0x03,0xfe,0x62,0x02,0x6e,0xe1,0x0a,0xf5,0x00,0x00,0x07,0xf5,0x0e,0xff,0xff,0xff,0xff,0xf8,0x1f,0xff,0xff,0xff,0xff,
+  0xf8,0x1f,0xf1,0x00,0x00,0x00,0x00,0x0e,0xf4,0x00,0x00,0x00,0x00,0x0a,0xfc,0x00,0x00,0x00,0x00,0x03,0xff,0xb4,0x11,0x4a,
+  0xe3,0x00,0x5f,0xff,0xff,0xff,0xb1,0x00,0x02,0x9d,0xfe,0xb5,0x00,0x00,0x00,0x1c,0xfe,0x20,0x00,0x00,0x00,0xbf,0x7e,0xd1,
+  0x00,0x00,0x09,0xe4,0x02,0xdc,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xad,0xfe,0xa3,
+  0x00,0x00,0x6f,0xff,0xff,0xff,0x40,0x03,0xfe,0x62,0x02,0x6e,0xe1,0x0a,0xf5,0x00,0x00,0x07,0xf5,0x0e,0xff,0xff,0xff,0xff,
+  0xf8,0x1f,0xff,0xff,0xff,0xff,0xf8,0x1f,0xf1,0x00,0x00,0x00,0x00,0x0e,0xf4,0x00,0x00,0x00,0x00,0x0a,0xfc,0x00,0x00,0x00,
+  0x00,0x03,0xff,0xb4,0x11,0x4a,0xe3,0x00,0x5f,0xff,0xff,0xff,0xb1,0x00,0x02,0x9d,0xfe,0xb5,0x00,0x00,0x09,0xe7,0x05,0xeb,
+  0x00,0x00,0x09,0xe8,0x05,0xec,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xad,0xfe,0xa3,0x00,0x00,0x6f,0xff,0xff,0xff,0x40,0x03,0xfe,0x62,0x02,0x6e,0xe1,0x0a,0xf5,0x00,0x00,0x07,
+  0xf5,0x0e,0xff,0xff,0xff,0xff,0xf8,0x1f,0xff,0xff,0xff,0xff,0xf8,0x1f,0xf1,0x00,0x00,0x00,0x00,0x0e,0xf4,0x00,0x00,0x00,
+  0x00,0x0a,0xfc,0x00,0x00,0x00,0x00,0x03,0xff,0xb4,0x11,0x4a,0xe3,0x00,0x5f,0xff,0xff,0xff,0xb1,0x00,0x02,0x9d,0xfe,0xb5,
+  0x00,0x0a,0xfc,0x00,0x00,0xbf,0x70,0x00,0x1c,0xe2,0x00,0x01,0x74,0x00,0x00,0x00,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,
+  0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,
+  0xf2,0x00,0x0f,0xf2,0x00,0x5f,0xe3,0x01,0xef,0x50,0x09,0xf6,0x00,0x07,0x50,0x00,0x00,0x00,0x00,0x0f,0xf2,0x00,0x0f,0xf2,
+  0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x0f,0xf2,
+  0x00,0x0f,0xf2,0x00,0x0f,0xf2,0x00,0x00,0x5f,0xf9,0x00,0x04,0xfc,0x9f,0x70,0x2e,0xb1,0x07,0xf5,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,
+  0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,
+  0x0f,0xf2,0x00,0x2d,0xd2,0x0b,0xe5,0x3e,0xd2,0x0b,0xe5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,
+  0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,0x0f,0xf2,0x00,0x00,
+  0x04,0x74,0x00,0x04,0x20,0x00,0x00,0x07,0xff,0xd7,0x8f,0x60,0x00,0x00,0x00,0x37,0xef,0xf7,0x00,0x00,0x00,0x00,0x08,0xfa,
+  0xfe,0x30,0x00,0x00,0x00,0x0c,0x40,0x5f,0xd0,0x00,0x00,0x00,0x00,0x00,0x09,0xf7,0x00,0x00,0x04,0xbe,0xec,0x52,0xfc,0x00,
+  0x00,0x8f,0xff,0xff,0xf9,0xdf,0x10,0x04,0xff,0xa2,0x02,0x7e,0xef,0x30,0x0b,0xfa,0x00,0x00,0x04,0xff,0x50,0x0f,0xf3,0x00,
+  0x00,0x00,0xbf,0x40,0x1f,0xf1,0x00,0x00,0x00,0xcf,0x30,0x0f,0xf3,0x00,0x00,0x01,0xff,0x10,0x0b,0xfa,0x00,0x00,0x08,0xfb,
+  0x00,0x04,0xff,0xa3,0x02,0x8f,0xf3,0x00,0x00,0x7f,0xff,0xff,0xff,0x60,0x00,0x00,0x03,0xae,0xfe,0xa3,0x00,0x00,0x00,0x0a,
+  0xeb,0x33,0xf4,0x00,0x00,0x6f,0xff,0xff,0xe1,0x00,0x00,0x9c,0x16,0xde,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x4f,0x80,0x4b,0xee,0xa2,0x00,0x4f,0xa7,0xff,0xff,0xfe,0x10,0x4f,0xee,0x71,0x15,0xef,0x80,0x4f,0xe3,
+  0x00,0x00,0x8f,0xc0,0x4f,0xd0,0x00,0x00,0x5f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,
+  0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,
+  0x00,0x00,0x4f,0xd0,0x00,0x02,0xef,0x60,0x00,0x00,0x00,0x00,0x00,0x3f,0xe1,0x00,0x00,0x00,0x00,0x00,0x05,0xfa,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x47,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xad,0xfe,0xb5,0x00,0x00,0x00,0x6f,
+  0xff,0xff,0xff,0xa0,0x00,0x03,0xff,0xa3,0x01,0x6e,0xf8,0x00,0x0a,0xfb,0x00,0x00,0x06,0xfe,0x10,0x0e,0xf4,0x00,0x00,0x00,
+  0xef,0x40,0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x0f,0xf4,0x00,0x00,0x00,0xef,0x40,0x0b,
+  0xfb,0x00,0x00,0x06,0xfe,0x10,0x03,0xff,0xa2,0x01,0x6e,0xf8,0x00,0x00,0x6f,0xff,0xff,0xff,0xb0,0x00,0x00,0x03,0xad,0xfe,
+  0xb5,0x00,0x00,0x00,0x00,0x00,0x0b,0xfb,0x00,0x00,0x00,0x00,0x00,0x7f,0xc1,0x00,0x00,0x00,0x00,0x01,0xed,0x10,0x00,0x00,
+  0x00,0x00,0x04,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xad,0xfe,0xb5,0x00,0x00,0x00,0x6f,0xff,
+  0xff,0xff,0xa0,0x00,0x03,0xff,0xa3,0x01,0x6e,0xf8,0x00,0x0a,0xfb,0x00,0x00,0x06,0xfe,0x10,0x0e,0xf4,0x00,0x00,0x00,0xef,
+  0x40,0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x0f,0xf4,0x00,0x00,0x00,0xef,0x40,0x0b,0xfb,
+  0x00,0x00,0x06,0xfe,0x10,0x03,0xff,0xa2,0x01,0x6e,0xf8,0x00,0x00,0x6f,0xff,0xff,0xff,0xb0,0x00,0x00,0x03,0xad,0xfe,0xb5,
+  0x00,0x00,0x00,0x00,0x0b,0xfe,0x30,0x00,0x00,0x00,0x00,0xaf,0x8d,0xe2,0x00,0x00,0x00,0x08,0xf5,0x01,0xcd,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xad,0xfe,0xb5,0x00,0x00,0x00,0x6f,0xff,0xff,
+  0xff,0xa0,0x00,0x03,0xff,0xa3,0x01,0x6e,0xf8,0x00,0x0a,0xfb,0x00,0x00,0x06,0xfe,0x10,0x0e,0xf4,0x00,0x00,0x00,0xef,0x40,
+  0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x0f,0xf4,0x00,0x00,0x00,0xef,0x40,0x0b,0xfb,0x00,
+  0x00,0x06,0xfe,0x10,0x03,0xff,0xa2,0x01,0x6e,0xf8,0x00,0x00,0x6f,0xff,0xff,0xff,0xb0,0x00,0x00,0x03,0xad,0xfe,0xb5,0x00,
+  0x00,0x00,0x01,0xae,0xa3,0x4f,0x30,0x00,0x00,0x07,0xff,0xff,0xfe,0x00,0x00,0x00,0x0b,0xb1,0x6d,0xd5,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xad,0xfe,0xb5,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,
+  0xa0,0x00,0x03,0xff,0xa3,0x01,0x6e,0xf8,0x00,0x0a,0xfb,0x00,0x00,0x06,0xfe,0x10,0x0e,0xf4,0x00,0x00,0x00,0xef,0x40,0x2f,
+  0xf2,0x00,0x00,0x00,0xcf,0x60,0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x0f,0xf4,0x00,0x00,0x00,0xef,0x40,0x0b,0xfb,0x00,0x00,
+  0x06,0xfe,0x10,0x03,0xff,0xa2,0x01,0x6e,0xf8,0x00,0x00,0x6f,0xff,0xff,0xff,0xb0,0x00,0x00,0x03,0xad,0xfe,0xb5,0x00,0x00,
+  0x00,0x08,0xe9,0x04,0xec,0x10,0x00,0x00,0x08,0xe9,0x04,0xec,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xad,0xfe,0xb5,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xa0,
+  0x00,0x03,0xff,0xa3,0x01,0x6e,0xf8,0x00,0x0a,0xfb,0x00,0x00,0x06,0xfe,0x10,0x0e,0xf4,0x00,0x00,0x00,0xef,0x40,0x2f,0xf2,
+  0x00,0x00,0x00,0xcf,0x60,0x2f,0xf2,0x00,0x00,0x00,0xcf,0x60,0x0f,0xf4,0x00,0x00,0x00,0xef,0x40,0x0b,0xfb,0x00,0x00,0x06,
+  0xfe,0x10,0x03,0xff,0xa2,0x01,0x6e,0xf8,0x00,0x00,0x6f,0xff,0xff,0xff,0xb0,0x00,0x00,0x03,0xad,0xfe,0xb5,0x00,0x00,0x00,
+  0x00,0x4e,0xd3,0x00,0x00,0x00,0x00,0x4e,0xd3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,
+  0xff,0xff,0xff,0xff,0xfb,0xcf,0xff,0xff,0xff,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0xd3,0x00,0x00,0x00,0x00,0x4e,0xd3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x80,
+  0x00,0x03,0xad,0xfe,0xa2,0xbd,0x10,0x00,0x7f,0xff,0xff,0xff,0xf5,0x00,0x04,0xff,0xa2,0x02,0x8f,0xf3,0x00,0x0b,0xfa,0x00,
+  0x01,0xcd,0xfc,0x00,0x0f,0xf3,0x00,0x0a,0xd1,0xdf,0x30,0x1f,0xf0,0x00,0x9e,0x20,0xaf,0x60,0x1f,0xf0,0x07,0xf3,0x00,0xaf,
+  0x70,0x0d,0xf2,0x5f,0x50,0x00,0xdf,0x50,0x08,0xfb,0xe7,0x00,0x05,0xff,0x20,0x01,0xdf,0xd2,0x01,0x7e,0xfa,0x00,0x00,0xcf,
+  0xff,0xff,0xff,0xc1,0x00,0x08,0xf4,0x8c,0xee,0xb6,0x00,0x00,0x17,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xe5,0x00,0x00,
+  0x00,0x00,0x04,0xfe,0x10,0x00,0x00,0x00,0x00,0x6f,0x80,0x00,0x00,0x00,0x00,0x05,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x6f,0xc0,0x00,0x00,0xbf,0x90,0x3f,0xf8,0x21,0x4b,0xff,0x90,0x0a,0xff,0xff,0xfc,0x7f,0x90,0x00,0x7d,0xfd,0x81,0x3f,
+  0x90,0x00,0x00,0x01,0xcf,0xa0,0x00,0x00,0x00,0x08,0xfb,0x00,0x00,0x00,0x00,0x2f,0xc1,0x00,0x00,0x00,0x00,0x47,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x6f,0xc0,0x00,0x00,0xbf,0x90,0x3f,0xf8,0x21,0x4b,0xff,0x90,0x0a,0xff,0xff,0xfc,0x7f,
+  0x90,0x00,0x7d,0xfd,0x81,0x3f,0x90,0x00,0x01,0xcf,0xe2,0x00,0x00,0x00,0x0b,0xf7,0xed,0x10,0x00,0x00,0x9e,0x40,0x2d,0xc1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x6f,0xc0,0x00,0x00,0xbf,0x90,0x3f,0xf8,0x21,0x4b,0xff,
+  0x90,0x0a,0xff,0xff,0xfc,0x7f,0x90,0x00,0x7d,0xfd,0x81,0x3f,0x90,0x00,0x9e,0x70,0x5e,0xc0,0x00,0x00,0x9e,0x80,0x5e,0xc0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,
+  0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x8f,0x90,0x00,0x00,0x8f,0x90,0x6f,0xc0,0x00,0x00,0xbf,
+  0x90,0x3f,0xf8,0x21,0x4b,0xff,0x90,0x0a,0xff,0xff,0xfc,0x7f,0x90,0x00,0x7d,0xfd,0x81,0x3f,0x90,0x00,0x00,0x00,0x2e,0xf7,
+  0x00,0x00,0x00,0x00,0x00,0xbf,0x90,0x00,0x00,0x00,0x00,0x05,0xfa,0x00,0x00,0x00,0x00,0x00,0x06,0x70,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xa0,0x00,0x00,0x03,0xfd,0x00,0x3f,0xf2,0x00,0x00,0x0a,0xf7,0x00,0x0b,0xf8,0x00,0x00,
+  0x2f,0xe1,0x00,0x04,0xfe,0x10,0x00,0x8f,0x80,0x00,0x00,0xcf,0x60,0x00,0xef,0x20,0x00,0x00,0x6f,0xd0,0x05,0xfa,0x00,0x00,
+  0x00,0x0e,0xf4,0x0b,0xf4,0x00,0x00,0x00,0x08,0xfa,0x3f,0xc0,0x00,0x00,0x00,0x01,0xff,0xaf,0x60,0x00,0x00,0x00,0x00,0x9f,
+  0xfe,0x00,0x00,0x00,0x00,0x00,0x3f,0xf7,0x00,0x00,0x00,0x00,0x00,0x0e,0xf1,0x00,0x00,0x00,0x00,0x00,0x6f,0x90,0x00,0x00,
+  0x00,0x00,0x00,0xdf,0x30,0x00,0x00,0x00,0x00,0x05,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xf4,0x00,0x00,0x00,0x00,0x4f,0xd0,
+  0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,
+  0x00,0x00,0x00,0x00,0x4f,0xd0,0x4b,0xee,0xa3,0x00,0x4f,0xd6,0xff,0xff,0xfe,0x30,0x4f,0xfe,0x61,0x14,0xdf,0xc0,0x4f,0xe2,
+  0x00,0x00,0x3f,0xf2,0x4f,0xd0,0x00,0x00,0x0d,0xf5,0x4f,0xd0,0x00,0x00,0x0b,0xf7,0x4f,0xd0,0x00,0x00,0x0c,0xf6,0x4f,0xd0,
+  0x00,0x00,0x0e,0xf5,0x4f,0xe0,0x00,0x00,0x6f,0xf1,0x4f,0xfa,0x30,0x16,0xef,0x90,0x4f,0xeb,0xff,0xff,0xfc,0x10,0x4f,0xd1,
+  0x9e,0xfc,0x70,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4f,0xd0,
+  0x00,0x00,0x00,0x00,0x00,0x0b,0xe5,0x07,0xe9,0x00,0x00,0x00,0x0c,0xe5,0x08,0xe9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xa0,0x00,0x00,0x03,0xfd,0x00,0x3f,0xf2,
+  0x00,0x00,0x0a,0xf7,0x00,0x0b,0xf8,0x00,0x00,0x2f,0xe1,0x00,0x04,0xfe,0x10,0x00,0x8f,0x80,0x00,0x00,0xcf,0x60,0x00,0xef,
+  0x20,0x00,0x00,0x6f,0xd0,0x05,0xfa,0x00,0x00,0x00,0x0e,0xf4,0x0b,0xf4,0x00,0x00,0x00,0x08,0xfa,0x3f,0xc0,0x00,0x00,0x00,
+  0x01,0xff,0xaf,0x60,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,0x00,0x00,0x3f,0xf7,0x00,0x00,0x00,0x00,0x00,0x0e,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x6f,0x90,0x00,0x00,0x00,0x00,0x00,0xdf,0x30,0x00,0x00,0x00,0x00,0x05,0xfb,0x00,0x00,0x00,0x00,
+  0x00,0x0c,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0xef,0xdf,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xfd,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xf7,0x2f,
+  0xf3,0x00,0x00,0x00,0x00,0x00,0x3f,0xf2,0x0b,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x05,0xfe,0x10,0x00,0x00,0x00,0x01,
+  0xef,0x50,0x00,0xef,0x60,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x9f,0xc0,0x00,0x00,0x00,0x0d,0xf8,0x00,0x00,0x3f,0xf3,0x00,
+  0x00,0x00,0x4f,0xf2,0x00,0x00,0x0c,0xf9,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xfe,0x10,0x00,0x01,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x60,0x00,0x07,0xff,0x20,0x00,0x00,0x00,0xbf,0xc0,0x00,0x0d,0xfa,0x00,0x00,0x00,0x00,0x4f,0xf3,0x00,0x4f,0xf3,
+  0x00,0x00,0x00,0x00,0x0c,0xf9,0x00,0xaf,0xa0,0x00,0x00,0x00,0x00,0x05,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xb2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x09,0xee,0x70,0x00,0x4a,0xef,0xd8,0x10,0x00,0x08,0xff,0xff,0xff,0xb0,0x00,0x2d,0xb4,0x11,0x5e,0xf5,0x00,0x00,0x00,
+  0x00,0x08,0xf9,0x00,0x00,0x00,0x00,0x06,0xfa,0x00,0x00,0x28,0xbd,0xef,0xfa,0x00,0x09,0xff,0xff,0xff,0xfa,0x00,0x8f,0xd7,
+  0x42,0x06,0xfa,0x00,0xdf,0x40,0x00,0x07,0xfa,0x00,0xcf,0x91,0x02,0x8e,0xfa,0x00,0x6f,0xff,0xff,0xd4,0xfa,0x00,0x07,0xdf,
+  0xd8,0x10,0xd9,0x00,0x00,0x00,0x00,0x08,0xa0,0x00,0x00,0x00,0x00,0x3f,0x70,0x10,0x00,0x00,0x00,0x4f,0xff,0xd0,0x00,0x00,
+  0x00,0x09,0xee,0x60,0x00,0x00,0x00,0x00,0x0a,0xfd,0x30,0x00,0x00,0x00,0x00,0x00,0xaf,0xb1,0x00,0x00,0x00,0x00,0x00,0x0a,
+  0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbd,0xfe,0xc8,0x20,0x00,0x00,0x06,0xef,0xff,
+  0xff,0xff,0xf8,0x00,0x00,0x9f,0xfc,0x52,0x01,0x38,0xff,0x30,0x06,0xff,0x80,0x00,0x00,0x00,0x24,0x00,0x1e,0xf9,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xef,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xb0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,
+  0x00,0x00,0x47,0x00,0x00,0xbf,0xfb,0x51,0x01,0x4a,0xff,0x30,0x00,0x09,0xff,0xff,0xff,0xff,0xe5,0x00,0x00,0x00,0x38,0xce,
+  0xfe,0xb7,0x10,0x00,0x00,0x00,0x00,0x1c,0xfa,0x00,0x00,0x00,0x00,0x8f,0xb0,0x00,0x00,0x00,0x02,0xfc,0x10,0x00,0x00,0x00,
+  0x04,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xad,0xfe,0x92,0x00,0x00,0x6f,0xff,0xff,0xfe,0x40,0x03,0xff,
+  0xa3,0x01,0x6b,0x20,0x0a,0xfc,0x00,0x00,0x00,0x00,0x0e,0xf5,0x00,0x00,0x00,0x00,0x1f,0xf2,0x00,0x00,0x00,0x00,0x1f,0xf2,
+  0x00,0x00,0x00,0x00,0x0e,0xf5,0x00,0x00,0x00,0x00,0x0a,0xfc,0x00,0x00,0x00,0x00,0x03,0xff,0xb3,0x01,0x6e,0x60,0x00,0x7f,
+  0xff,0xff,0xfe,0x30,0x00,0x04,0xbe,0xfd,0x81,0x00,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0x60,
+  0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,
+  0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xf2,0x00,0xef,0xff,0xff,0xff,0xf2,0x00,0xef,0x60,
+  0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,0x00,0x00,0x00,0x00,0xef,0x60,
+  0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xa0,0xef,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x00,0x06,0xa1,0x00,0x00,0x00,
+  0x00,0x3f,0x50,0x10,0x00,0x00,0x00,0x6f,0xff,0xb0,0x00,0x00,0x00,0x1a,0xed,0x50,0x00,0x03,0xad,0xfe,0xa3,0x00,0x00,0x6f,
+  0xff,0xff,0xff,0x40,0x03,0xfe,0x62,0x02,0x6e,0xe1,0x0a,0xf5,0x00,0x00,0x07,0xf5,0x0e,0xff,0xff,0xff,0xff,0xf8,0x1f,0xff,
+  0xff,0xff,0xff,0xf8,0x1f,0xf1,0x00,0x00,0x00,0x00,0x0e,0xf4,0x00,0x00,0x00,0x00,0x0a,0xfc,0x00,0x00,0x00,0x00,0x03,0xff,
+  0xb4,0x11,0x4a,0xe3,0x00,0x5f,0xff,0xff,0xff,0x90,0x00,0x03,0xae,0xfc,0x51,0x00,0x00,0x00,0x02,0xb1,0x00,0x00,0x00,0x00,
+  0x0a,0xd2,0x10,0x00,0x00,0x00,0x0c,0xff,0xf5,0x00,0x00,0x00,0x04,0xdf,0xb2,0x00,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,
+  0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x0f,0xf2,0x00,0x4f,0xf1,0x00,0x00,0x00,0x00,0x00,
+  0x4f,0xf1,0x00,0x00,0x00,0x00,0x00,0x4f,0xf1,0x00,0x00,0x00,0x00,0x00,0x4f,0xf1,0x00,0x00,0x00,0x00,0x00,0x4f,0xf1,0x00,
+  0x00,0x00,0x00,0x00,0x4f,0xf1,0x00,0x36,0x00,0x00,0x00,0x4f,0xf1,0x3a,0xfa,0x00,0x00,0x00,0x4f,0xfb,0xff,0xa2,0x00,0x00,
+  0x00,0x7f,0xff,0xb3,0x00,0x00,0x00,0x3c,0xff,0xf4,0x00,0x00,0x00,0x00,0x7e,0xbf,0xf1,0x00,0x00,0x00,0x00,0x31,0x4f,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x4f,0xf1,0x00,0x00,0x00,0x00,0x00,0x4f,0xf1,0x00,0x00,0x00,0x00,0x00,0x4f,0xf1,0x00,0x00,0x00,
+  0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0x80,0x00,0x4f,0xff,0xff,0xff,0xff,0x80,0x00,0x4f,0xe0,0x00,0x00,0x4f,0xe0,0x00,0x00,
+  0x4f,0xe0,0x00,0x00,0x4f,0xe0,0x00,0x00,0x4f,0xe0,0x00,0x00,0x4f,0xe0,0x10,0x00,0x4f,0xe9,0xe1,0x01,0x8f,0xfe,0x80,0x4f,
+  0xff,0xe1,0x00,0x48,0x5f,0xe0,0x00,0x00,0x4f,0xe0,0x00,0x00,0x4f,0xe0,0x00,0x00,0x4f,0xe0,0x00,0x00,0x4f,0xe0,0x00,0x00,
+  0x4f,0xe0,0x00,0x00,0x4f,0xe0,0x00,0x00,0x4f,0xe0,0x00,0x00,0x00,0x00,0x02,0xdf,0xb1,0x00,0x00,0x00,0x00,0x00,0x2d,0xf8,
+  0x00,0x00,0x00,0x00,0x00,0x02,0xde,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xee,0x30,0x00,0x00,0x00,
+  0x00,0xff,0x00,0xef,0xd1,0x00,0x00,0x00,0x00,0xff,0x00,0xef,0xfa,0x00,0x00,0x00,0x00,0xff,0x00,0xef,0xef,0x70,0x00,0x00,
+  0x00,0xff,0x00,0xef,0x6f,0xf4,0x00,0x00,0x00,0xff,0x00,0xef,0x27,0xfe,0x10,0x00,0x00,0xff,0x00,0xef,0x20,0xbf,0xb0,0x00,
+  0x00,0xff,0x00,0xef,0x20,0x1d,0xf8,0x00,0x00,0xff,0x00,0xef,0x20,0x03,0xff,0x50,0x00,0xff,0x00,0xef,0x20,0x00,0x6f,0xe2,
+  0x00,0xff,0x00,0xef,0x20,0x00,0x0a,0xfc,0x00,0xff,0x00,0xef,0x20,0x00,0x01,0xcf,0x90,0xff,0x00,0xef,0x20,0x00,0x00,0x2e,
+  0xf6,0xff,0x00,0xef,0x20,0x00,0x00,0x05,0xff,0xff,0x00,0xef,0x20,0x00,0x00,0x00,0x9f,0xff,0x00,0xef,0x20,0x00,0x00,0x00,
+  0x0c,0xff,0x00,0xef,0x20,0x00,0x00,0x00,0x02,0xdf,0x00,0x00,0x00,0x00,0xaf,0xc1,0x00,0x00,0x00,0x05,0xfd,0x10,0x00,0x00,
+  0x00,0x0d,0xe2,0x00,0x00,0x00,0x00,0x37,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x80,0x4b,0xee,0xa2,0x00,0x4f,
+  0xa7,0xff,0xff,0xfe,0x10,0x4f,0xee,0x71,0x15,0xef,0x80,0x4f,0xe3,0x00,0x00,0x8f,0xc0,0x4f,0xd0,0x00,0x00,0x5f,0xd0,0x4f,
+  0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,
+  0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x4f,0xd0,0x00,0x00,0x4f,0xd0,0x00,0x00,0x4a,0xdf,0xec,0x71,0x04,
+  0xff,0xff,0xff,0xff,0xff,0x10,0x00,0x1b,0xff,0xff,0xff,0xfe,0x44,0xff,0xff,0xff,0xff,0xff,0x10,0x01,0xcf,0xf9,0x31,0x13,
+  0x9f,0xf8,0xfc,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x40,0x00,0x00,0x05,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x2f,0xf7,0x00,
+  0x00,0x00,0x00,0x8f,0xfc,0x00,0x00,0x00,0x00,0x00,0x7f,0xe1,0x00,0x00,0x00,0x00,0x1f,0xfc,0x00,0x00,0x00,0x00,0x00,0xaf,
+  0xb0,0x00,0x00,0x00,0x00,0x0c,0xfc,0x00,0x00,0x00,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0x00,0x09,0xfc,0x00,0x00,0x00,0x00,
+  0x00,0xdf,0x80,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0x70,0x00,0xcf,0x80,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0xff,
+  0xff,0x70,0x00,0xbf,0xb0,0x00,0x00,0x00,0x00,0x0c,0xfc,0x00,0x00,0x00,0x00,0x00,0x7f,0xe1,0x00,0x00,0x00,0x00,0x1f,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,0x00,0x00,0x8f,0xfc,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x40,0x00,0x00,0x05,
+  0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xcf,0xf9,0x31,0x13,0x9f,0xfa,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xff,0xff,
+  0xff,0xfe,0x64,0xff,0xff,0xff,0xff,0xff,0x10,0x00,0x00,0x4a,0xdf,0xec,0x82,0x04,0xff,0xff,0xff,0xff,0xff,0x10,0x00,0x04,
+  0xbe,0xec,0x70,0x00,0x3a,0xee,0xc4,0x00,0x00,0x7f,0xff,0xff,0xfb,0x04,0xef,0xff,0xff,0x60,0x04,0xff,0x92,0x03,0xbf,0x8d,
+  0xe6,0x21,0x6e,0xe1,0x0b,0xfa,0x00,0x00,0x0d,0xff,0x50,0x00,0x07,0xf7,0x0f,0xf4,0x00,0x00,0x08,0xfe,0x00,0x00,0x02,0xfa,
+  0x2f,0xf2,0x00,0x00,0x05,0xff,0xff,0xff,0xff,0xfc,0x2f,0xf2,0x00,0x00,0x05,0xff,0xff,0xff,0xff,0xfb,0x0f,0xf4,0x00,0x00,
+  0x07,0xfe,0x00,0x00,0x00,0x00,0x0b,0xfa,0x00,0x00,0x0d,0xff,0x50,0x00,0x00,0x00,0x04,0xff,0x82,0x02,0xaf,0xae,0xe6,0x20,
+  0x26,0xb5,0x00,0x8f,0xff,0xff,0xfc,0x15,0xff,0xff,0xff,0xe3,0x00,0x04,0xbe,0xed,0x71,0x00,0x3a,0xef,0xd8,0x10,0x00,0x00,
+  0x00,0x07,0xff,0x60,0x00,0x00,0x00,0x7f,0xd3,0x00,0x00,0x00,0x06,0xfb,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+  0x9d,0xfe,0xc7,0x10,0x00,0x4e,0xff,0xff,0xff,0xd2,0x01,0xef,0xb3,0x12,0x5c,0xf2,0x06,0xfd,0x00,0x00,0x00,0x20,0x08,0xfa,
+  0x00,0x00,0x00,0x00,0x07,0xfd,0x00,0x00,0x00,0x00,0x02,0xef,0xc4,0x00,0x00,0x00,0x00,0x5e,0xff,0xd8,0x30,0x00,0x00,0x02,
+  0x9e,0xff,0xfb,0x20,0x00,0x00,0x00,0x49,0xef,0xe2,0x00,0x00,0x00,0x00,0x2d,0xf9,0x00,0x00,0x00,0x00,0x06,0xfc,0x00,0x00,
+  0x00,0x00,0x07,0xfc,0x06,0x60,0x00,0x00,0x0c,0xf8,0x2f,0xfb,0x41,0x13,0xbf,0xf2,0x06,0xef,0xff,0xff,0xfe,0x50,0x00,0x28,
+  0xce,0xfd,0x92,0x00,0x00,0x00,0x00,0xbf,0xb0,0x00,0x00,0x07,0xfc,0x10,0x00,0x00,0x1e,0xd1,0x00,0x00,0x00,0x47,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0xef,0xd8,0x10,0x04,0xff,0xff,0xff,0xc1,0x0c,0xfb,0x20,0x27,0x80,0x0e,0xf2,0x00,0x00,
+  0x00,0x08,0xf9,0x10,0x00,0x00,0x00,0x8e,0xfa,0x61,0x00,0x00,0x00,0x49,0xee,0x60,0x00,0x00,0x00,0x1d,0xf3,0x00,0x00,0x00,
+  0x0a,0xf5,0x0b,0xa3,0x11,0x6f,0xf3,0x1b,0xff,0xff,0xff,0xa0,0x00,0x7c,0xee,0xc6,0x00,0x00,0x05,0x73,0x00,0x37,0x40,0x00,
+  0x01,0xbf,0x68,0xfa,0x00,0x00,0x00,0x0a,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x9d,0xfe,0xc7,0x10,0x00,
+  0x4e,0xff,0xff,0xff,0xd2,0x01,0xef,0xb3,0x12,0x5c,0xf2,0x06,0xfd,0x00,0x00,0x00,0x20,0x08,0xfa,0x00,0x00,0x00,0x00,0x07,
+  0xfd,0x00,0x00,0x00,0x00,0x02,0xef,0xc4,0x00,0x00,0x00,0x00,0x5e,0xff,0xd8,0x30,0x00,0x00,0x02,0x9e,0xff,0xfb,0x20,0x00,
+  0x00,0x00,0x49,0xef,0xe2,0x00,0x00,0x00,0x00,0x2d,0xf9,0x00,0x00,0x00,0x00,0x06,0xfc,0x00,0x00,0x00,0x00,0x07,0xfc,0x06,
+  0x60,0x00,0x00,0x0c,0xf8,0x2f,0xfb,0x41,0x13,0xbf,0xf2,0x06,0xef,0xff,0xff,0xfe,0x50,0x00,0x28,0xce,0xfd,0x92,0x00,0x00,
+  0xbe,0x30,0x3d,0xa0,0x00,0x1c,0xe7,0xec,0x10,0x00,0x01,0xdf,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3a,0xef,0xd8,0x10,0x04,0xff,0xff,0xff,0xc1,0x0c,0xfb,0x20,0x27,0x80,0x0e,0xf2,0x00,0x00,0x00,0x08,0xf9,0x10,0x00,
+  0x00,0x00,0x8e,0xfa,0x61,0x00,0x00,0x00,0x49,0xee,0x60,0x00,0x00,0x00,0x1d,0xf3,0x00,0x00,0x00,0x0a,0xf5,0x0b,0xa3,0x11,
+  0x6f,0xf3,0x1b,0xff,0xff,0xff,0xa0,0x00,0x7c,0xee,0xc6,0x00,0x00,0x02,0xdd,0x20,0x1c,0xe3,0x00,0x00,0x00,0x02,0xdd,0x20,
+  0x1d,0xe3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xc1,0x00,0x00,0x00,0x00,0xbf,0xb0,0x1e,0xf8,0x00,0x00,
+  0x00,0x06,0xff,0x20,0x06,0xff,0x20,0x00,0x00,0x1e,0xf7,0x00,0x00,0xbf,0xb0,0x00,0x00,0x9f,0xd0,0x00,0x00,0x2f,0xf5,0x00,
+  0x03,0xff,0x40,0x00,0x00,0x08,0xfd,0x00,0x0c,0xfa,0x00,0x00,0x00,0x01,0xdf,0x70,0x6f,0xe1,0x00,0x00,0x00,0x00,0x4f,0xe2,
+  0xdf,0x60,0x00,0x00,0x00,0x00,0x0a,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xfe,0x50,0x00,0x00,0x00,0x00,0x9f,0xd2,0x00,0x00,0x00,0x00,0x08,0xfa,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xf1,0x8f,0xff,0xff,0xff,0xff,0xff,0xc0,0x00,0x00,
+  0x00,0x00,0x05,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xf6,0x00,0x00,0x00,0x00,0x00,0xcf,0xa0,0x00,0x00,0x00,0x00,0x08,0xfd,
+  0x10,0x00,0x00,0x00,0x00,0x4f,0xf4,0x00,0x00,0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x00,0x0b,0xfc,0x00,0x00,0x00,0x00,
+  0x00,0x7f,0xe2,0x00,0x00,0x00,0x00,0x03,0xff,0x50,0x00,0x00,0x00,0x00,0x1d,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xd1,0x00,
+  0x00,0x00,0x00,0x05,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xf7,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xd0,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0x00,0x00,0x00,0xaf,0xc1,0x00,0x00,0x00,0x04,0xfd,0x20,0x00,0x00,0x00,0x0d,0xe3,0x00,
+  0x00,0x00,0x00,0x37,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0x30,0x0c,0xff,0xff,0xff,0xfe,
+  0x10,0x00,0x00,0x00,0x0a,0xf4,0x00,0x00,0x00,0x00,0x6f,0x70,0x00,0x00,0x00,0x03,0xfa,0x00,0x00,0x00,0x00,0x1e,0xd1,0x00,
+  0x00,0x00,0x00,0xbe,0x20,0x00,0x00,0x00,0x09,0xf5,0x00,0x00,0x00,0x00,0x5f,0x80,0x00,0x00,0x00,0x03,0xeb,0x00,0x00,0x00,
+  0x00,0x0d,0xff,0xff,0xff,0xff,0x00,0x2f,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x06,0xec,0x10,0x00,0x00,0x00,0x00,0x06,0xec,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xf1,0x8f,0xff,0xff,0xff,0xff,0xff,0xc0,
+  0x00,0x00,0x00,0x00,0x05,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xf6,0x00,0x00,0x00,0x00,0x00,0xcf,0xa0,0x00,0x00,0x00,0x00,
+  0x08,0xfd,0x10,0x00,0x00,0x00,0x00,0x4f,0xf4,0x00,0x00,0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x00,0x0b,0xfc,0x00,0x00,
+  0x00,0x00,0x00,0x7f,0xe2,0x00,0x00,0x00,0x00,0x03,0xff,0x50,0x00,0x00,0x00,0x00,0x1d,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xd1,0x00,0x00,0x00,0x00,0x05,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xf7,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,
+  0xff,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0x00,0x00,0x5e,0xd2,0x00,0x00,0x00,0x00,0x6e,0xd2,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0x30,0x0c,0xff,0xff,
+  0xff,0xfe,0x10,0x00,0x00,0x00,0x0a,0xf4,0x00,0x00,0x00,0x00,0x6f,0x70,0x00,0x00,0x00,0x03,0xfa,0x00,0x00,0x00,0x00,0x1e,
+  0xd1,0x00,0x00,0x00,0x00,0xbe,0x20,0x00,0x00,0x00,0x09,0xf5,0x00,0x00,0x00,0x00,0x5f,0x80,0x00,0x00,0x00,0x03,0xeb,0x00,
+  0x00,0x00,0x00,0x0d,0xff,0xff,0xff,0xff,0x00,0x2f,0xff,0xff,0xff,0xff,0x00,0x00,0x06,0x72,0x00,0x47,0x30,0x00,0x00,0x02,
+  0xde,0x59,0xf8,0x00,0x00,0x00,0x00,0x1b,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,
+  0xff,0xf1,0x8f,0xff,0xff,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x05,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xf6,0x00,0x00,
+  0x00,0x00,0x00,0xcf,0xa0,0x00,0x00,0x00,0x00,0x08,0xfd,0x10,0x00,0x00,0x00,0x00,0x4f,0xf4,0x00,0x00,0x00,0x00,0x01,0xef,
+  0x80,0x00,0x00,0x00,0x00,0x0b,0xfc,0x00,0x00,0x00,0x00,0x00,0x7f,0xe2,0x00,0x00,0x00,0x00,0x03,0xff,0x50,0x00,0x00,0x00,
+  0x00,0x1d,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xd1,0x00,0x00,0x00,0x00,0x05,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xd0,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0x00,0x6f,0x70,0x1b,0xe2,0x00,
+  0x00,0x08,0xf8,0xce,0x30,0x00,0x00,0x00,0x9f,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0c,0xff,0xff,0xff,0xff,0x30,0x0c,0xff,0xff,0xff,0xfe,0x10,0x00,0x00,0x00,0x0a,0xf4,0x00,0x00,0x00,0x00,0x6f,0x70,0x00,
+  0x00,0x00,0x03,0xfa,0x00,0x00,0x00,0x00,0x1e,0xd1,0x00,0x00,0x00,0x00,0xbe,0x20,0x00,0x00,0x00,0x09,0xf5,0x00,0x00,0x00,
+  0x00,0x5f,0x80,0x00,0x00,0x00,0x03,0xeb,0x00,0x00,0x00,0x00,0x0d,0xff,0xff,0xff,0xff,0x00,0x2f,0xff,0xff,0xff,0xff,0x00,
+  0x2f,0xff,0xff,0xff,0xff,0x70,0x2f,0xff,0xff,0xff,0xff,0x70,0x2f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0x2f,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xc0,0x00,0x20,0x02,0xe6,0x0b,0xc0,0x2f,0x70,0x4f,0x70,0x2f,0xd0,0x09,0x60,0x00,0x00,0x2c,0x80,
+  0x2f,0xc0,0x0d,0xd0,0x0e,0xa0,0x5f,0x30,0xb7,0x00,0x00,0x00,0x19,0x60,0x3f,0xc0,0x0d,0xd0,0x0d,0xb0,0x4f,0x50,0xca,0x00,
+  0x20,0x00,0x00,0x20,0x00,0x20,0x02,0xe6,0x06,0xf1,0x0b,0xc0,0x2f,0x70,0x2f,0x70,0x7f,0x20,0x4f,0x70,0x9f,0x20,0x2f,0xd0,
+  0x8f,0x70,0x09,0x60,0x2a,0x30,0x00,0x00,0x00,0x00,0x2c,0x80,0x6e,0x20,0x2f,0xc0,0x7f,0x70,0x0d,0xd0,0x3f,0x80,0x0e,0xa0,
+  0x4f,0x50,0x5f,0x30,0xbd,0x00,0xb7,0x02,0xd3,0x00,0x00,0x00,0x00,0x00,0x19,0x60,0x4b,0x10,0x3f,0xc0,0x8f,0x60,0x0d,0xd0,
+  0x3f,0x80,0x0d,0xb0,0x3f,0x60,0x4f,0x50,0x9e,0x10,0xca,0x02,0xf5,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x2e,0xe1,0x00,0x00,
+  0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x0e,0xd0,0x00,0x00,
+  0x5f,0xeb,0x9e,0xe9,0xbd,0xe4,0x9f,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,0x0d,0xc0,0x00,0x00,0x00,0x00,0x0d,0xc0,0x00,0x00,
+  0x00,0x00,0x0d,0xc0,0x00,0x00,0x00,0x00,0x0d,0xc0,0x00,0x00,0x00,0x00,0x0d,0xc0,0x00,0x00,0x00,0x00,0x0e,0xc0,0x00,0x00,
+  0x00,0x00,0x0e,0xd0,0x00,0x00,0x00,0x00,0x0e,0xd0,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,
+  0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x00,0x2f,0xf1,0x00,0x00,0x00,0x00,0x2e,0xe1,0x00,0x00,
+  0x00,0x00,0x2e,0xe1,0x00,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,
+  0x00,0x00,0x0e,0xd0,0x00,0x00,0x5f,0xeb,0x9e,0xe9,0xbd,0xe4,0x9f,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,0x0d,0xc0,0x00,0x00,
+  0x00,0x00,0x0d,0xc0,0x00,0x00,0x00,0x00,0x0d,0xc0,0x00,0x00,0x00,0x00,0x0d,0xc0,0x00,0x00,0x00,0x00,0x0d,0xc0,0x00,0x00,
+  0x00,0x00,0x0d,0xc0,0x00,0x00,0x00,0x00,0x0d,0xc0,0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xf7,0x5f,0xec,0x9e,0xea,0xce,0xe4,
+  0x00,0x00,0x0e,0xd0,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,
+  0x00,0x00,0x2e,0xd1,0x00,0x00,0x00,0x3b,0xee,0xa2,0x00,0x05,0xff,0xff,0xfe,0x40,0x1e,0xff,0xff,0xff,0xd0,0x5f,0xff,0xff,
+  0xff,0xf4,0x7f,0xff,0xff,0xff,0xf6,0x6f,0xff,0xff,0xff,0xf4,0x1e,0xff,0xff,0xff,0xd0,0x05,0xff,0xff,0xfe,0x40,0x00,0x3b,
+  0xee,0xa2,0x00,0x9f,0xa0,0x00,0x7e,0xc1,0x00,0x5e,0xd2,0x9f,0xb0,0x00,0x7e,0xc1,0x00,0x5e,0xd3,0x00,0x4c,0xfd,0x70,0x00,
+  0x00,0x00,0x8f,0x70,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xf9,0x00,0x00,0x05,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,
+  0xf6,0x13,0xdf,0x20,0x00,0x2e,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xb0,0x00,0x6f,0x60,0x00,0xcf,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x2f,0x90,0x00,0x3f,0x70,0x09,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xb0,0x00,0x5f,0x60,0x5f,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xf5,0x13,0xdf,0x22,0xed,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,
+  0xf8,0x0c,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xfd,0x60,0x9f,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x05,0xfa,0x01,0x9e,0xfb,0x30,0x00,0x2b,0xee,0xa2,0x00,0x00,0x00,0x00,0x2e,0xd1,0x0c,0xff,0xff,0xf3,
+  0x01,0xef,0xff,0xfe,0x10,0x00,0x00,0x01,0xcf,0x30,0x6f,0xa2,0x16,0xfb,0x09,0xf8,0x11,0x9f,0x80,0x00,0x00,0x09,0xf6,0x00,
+  0x9f,0x20,0x00,0xce,0x0c,0xe0,0x00,0x0e,0xb0,0x00,0x00,0x6f,0xa0,0x00,0x9f,0x20,0x00,0xbe,0x0c,0xe0,0x00,0x0e,0xb0,0x00,
+  0x02,0xed,0x10,0x00,0x6f,0xa1,0x16,0xfb,0x09,0xf8,0x11,0x8f,0x80,0x00,0x1d,0xe3,0x00,0x00,0x0c,0xff,0xff,0xf3,0x02,0xef,
+  0xff,0xfd,0x10,0x00,0xaf,0x50,0x00,0x00,0x01,0x9e,0xfb,0x30,0x00,0x2b,0xee,0xa2,0x00,0x00,0x00,0x00,0x00,0x0c,0x80,0x00,
+  0x6f,0x50,0x02,0xea,0x00,0x0a,0xe2,0x00,0x4f,0x80,0x00,0x0d,0xd0,0x00,0x04,0xf8,0x00,0x00,0x9f,0x20,0x00,0x1e,0x90,0x00,
+  0x03,0x10,0x00,0x00,0x00,0x2e,0x40,0x00,0x0c,0xd0,0x00,0x03,0xf8,0x00,0x00,0x9f,0x30,0x00,0x1f,0xb0,0x00,0x6f,0x50,0x01,
+  0xeb,0x00,0x0a,0xe2,0x00,0x2f,0x70,0x00,0x04,0x00,0x00,0x00,0x00,0x03,0x9d,0xfe,0xb5,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,
+  0xa0,0x00,0x06,0xff,0xa3,0x01,0x4c,0xf3,0x00,0x1e,0xf8,0x00,0x00,0x00,0x20,0x00,0x6f,0xd0,0x00,0x00,0x00,0x00,0x00,0xbf,
+  0x80,0x00,0x00,0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xe0,0x00,0x9f,0xff,0xff,0xff,0xff,0xc0,0x00,0x00,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x9f,0xff,0xff,0xff,0xfc,0x00,0x00,0x9f,0xff,0xff,0xff,0xfa,0x00,0x00,0x00,0xcf,0x70,0x00,0x00,0x00,0x00,0x00,
+  0x8f,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0xf7,0x00,0x00,0x00,0x40,0x00,0x09,0xff,0x93,0x11,0x4c,0xf6,0x00,0x00,0xaf,0xff,
+  0xff,0xff,0xa0,0x00,0x00,0x05,0xae,0xfe,0xb5,0x00,0x4f,0xff,0xff,0x94,0xf9,0x00,0x01,0xed,0x4f,0xff,0xff,0x94,0xff,0x30,
+  0x08,0xfd,0x00,0x1f,0x70,0x04,0xfe,0xb0,0x2f,0xed,0x00,0x1f,0x70,0x04,0xf7,0xf3,0x9e,0x8d,0x00,0x1f,0x70,0x04,0xf1,0xbc,
+  0xf5,0x7d,0x00,0x1f,0x70,0x04,0xf1,0x2e,0xb0,0x7d,0x00,0x1f,0x70,0x04,0xf1,0x02,0x10,0x7d,
+};
+
+// code, offset, w, h, dx, dy, advance (1/16 px), left/right kerning class
+const AaGlyph kGlyphs[] = {
+  {0x0020, 0, 0, 0, 0, 0, 80, 0, 0},
+  {0x0021, 0, 4, 17, 2, -17, 128, 0, 0},
+  {0x0022, 34, 7, 6, 1, -17, 160, 1, 1},
+  {0x0023, 58, 14, 17, 0, -17, 224, 0, 0},
+  {0x0024, 177, 12, 22, 1, -19, 224, 0, 0},
+  {0x0025, 309, 18, 17, 0, -17, 304, 0, 0},
+  {0x0026, 462, 16, 17, 1, -17, 272, 0, 2},
+  {0x0027, 598, 3, 6, 1, -17, 96, 1, 1},
+  {0x0028, 610, 6, 23, 1, -19, 112, 2, 0},
+  {0x0029, 679, 6, 23, 0, -19, 112, 0, 3},
+  {0x002a, 748, 8, 8, 1, -17, 160, 1, 1},
+  {0x002b, 780, 12, 12, 1, -14, 224, 0, 0},
+  {0x002c, 852, 4, 6, 1, -2, 80, 3, 4},
+  {0x002d, 864, 7, 2, 1, -8, 128, 4, 5},
+  {0x002e, 872, 3, 2, 1, -2, 80, 3, 4},
+  {0x002f, 876, 11, 18, -1, -17, 144, 5, 2},
+  {0x0030, 984, 14, 17, 0, -17, 224, 0, 0},
+  {0x0031, 1103, 11, 17, 2, -17, 224, 0, 0},
+  {0x0032, 1205, 12, 17, 1, -17, 224, 0, 0},
+  {0x0033, 1307, 12, 17, 1, -17, 224, 0, 0},
+  {0x0034, 1409, 14, 17, 0, -17, 224, 0, 0},
+  {0x0035, 1528, 12, 17, 1, -17, 224, 0, 0},
+  {0x0036, 1630, 12, 17, 1, -17, 224, 0, 0},
+  {0x0037, 1732, 13, 17, 1, -17, 224, 0, 0},
+  {0x0038, 1851, 12, 17, 1, -17, 224, 0, 0},
+  {0x0039, 1953, 12, 17, 1, -17, 224, 0, 0},
+  {0x003a, 2055, 4, 12, 1, -12, 96, 0, 6},
+  {0x003b, 2079, 4, 16, 1, -12, 96, 0, 6},
+  {0x003c, 2111, 11, 12, 1, -14, 224, 0, 0},
+  {0x003d, 2183, 12, 6, 1, -11, 224, 0, 0},
+  {0x003e, 2219, 11, 12, 2, -14, 224, 0, 0},
+  {0x003f, 2291, 10, 17, 0, -17, 160, 0, 7},
+  {0x0040, 2376, 18, 19, 1, -16, 320, 6, 8},
+  {0x0041, 2547, 17, 17, 0, -17, 256, 7, 2},
+  {0x0042, 2700, 13, 17, 2, -17, 256, 0, 0},
+  {0x0043, 2819, 15, 17, 1, -17, 256, 8, 8},
+  {0x0044, 2955, 15, 17, 2, -17, 288, 6, 0},
+  {0x0045, 3091, 11, 17, 2, -17, 224, 0, 0},
+  {0x0046, 3193, 11, 17, 2, -17, 224, 9, 0},
+  {0x0047, 3295, 16, 17, 1, -17, 288, 0, 8},
+  {0x0048, 3431, 15, 17, 2, -17, 288, 0, 0},
+  {0x0049, 3567, 3, 17, 2, -17, 112, 0, 0},
+  {0x004a, 3601, 9, 17, 0, -17, 176, 10, 9},
+  {0x004b, 3686, 14, 17, 2, -17, 256, 11, 0},
+  {0x004c, 3805, 10, 17, 2, -17, 192, 12, 0},
+  {0x004d, 3890, 18, 17, 2, -17, 352, 0, 0},
+  {0x004e, 4043, 15, 17, 2, -17, 288, 0, 0},
+  {0x004f, 4179, 18, 17, 1, -17, 304, 6, 8},
+  {0x0050, 4332, 12, 17, 2, -17, 240, 13, 0},
+  {0x0051, 4434, 18, 21, 1, -17, 304, 6, 8},
+  {0x0052, 4623, 13, 17, 2, -17, 240, 14, 0},
+  {0x0053, 4742, 12, 17, 0, -17, 208, 0, 0},
+  {0x0054, 4844, 14, 17, 0, -17, 224, 15, 10},
+  {0x0055, 4963, 15, 17, 1, -17, 288, 10, 11},
+  {0x0056, 5099, 17, 17, 0, -17, 256, 5, 12},
+  {0x0057, 5252, 25, 17, 0, -17, 384, 16, 13},
+  {0x0058, 5473, 16, 17, 0, -17, 240, 11, 14},
+  {0x0059, 5609, 15, 17, 0, -17, 240, 17, 15},
+  {0x005a, 5745, 14, 17, 1, -17, 240, 18, 16},
+  {0x005b, 5864, 6, 22, 1, -19, 112, 2, 0},
+  {0x005c, 5930, 10, 18, -1, -17, 144, 7, 12},
+  {0x005d, 6020, 5, 22, 1, -19, 112, 0, 3},
+  {0x005e, 6086, 11, 8, 1, -17, 224, 0, 0},
+  {0x005f, 6134, 10, 2, 0, 1, 144, 0, 0},
+  {0x0060, 6144, 6, 4, 0, -17, 112, 0, 0},
+  {0x0061, 6156, 10, 12, 1, -12, 192, 19, 17},
+  {0x0062, 6216, 12, 17, 1, -17, 208, 20, 0},
+  {0x0063, 6318, 11, 12, 0, -12, 176, 0, 18},
+  {0x0064, 6390, 12, 17, 0, -17, 208, 0, 18},
+  {0x0065, 6492, 12, 12, 0, -12, 208, 20, 18},
+  {0x0066, 6564, 8, 17, 0, -17, 128, 21, 19},
+  {0x0067, 6632, 12, 16, 0, -12, 192, 0, 20},
+  {0x0068, 6728, 11, 17, 1, -17, 208, 19, 0},
+  {0x0069, 6830, 4, 17, 1, -17, 96, 0, 0},
+  {0x006a, 6864, 6, 21, -1, -17, 96, 0, 0},
+  {0x006b, 6927, 12, 17, 1, -17, 208, 22, 0},
+  {0x006c, 7029, 4, 17, 1, -17, 96, 0, 0},
+  {0x006d, 7063, 18, 12, 1, -12, 320, 19, 6},
+  {0x006e, 7171, 11, 12, 1, -12, 208, 19, 6},
+  {0x006f, 7243, 13, 12, 0, -12, 208, 20, 18},
+  {0x0070, 7327, 12, 16, 1, -12, 208, 20, 6},
+  {0x0071, 7423, 12, 16, 0, -12, 208, 0, 18},
+  {0x0072, 7519, 9, 12, 1, -12, 160, 23, 6},
+  {0x0073, 7579, 10, 12, 0, -12, 160, 0, 21},
+  {0x0074, 7639, 9, 16, 0, -16, 144, 0, 22},
+  {0x0075, 7719, 11, 12, 1, -12, 208, 0, 6},
+  {0x0076, 7791, 13, 12, 0, -12, 192, 24, 23},
+  {0x0077, 7875, 19, 12, 0, -12, 288, 25, 24},
+  {0x0078, 7995, 12, 12, 0, -12, 192, 22, 25},
+  {0x0079, 8067, 13, 16, 0, -12, 192, 24, 23},
+  {0x007a, 8179, 11, 12, 0, -12, 176, 0, 26},
+  {0x007b, 8251, 7, 22, 0, -19, 112, 2, 0},
+  {0x007c, 8339, 3, 22, 2, -18, 112, 0, 0},
+  {0x007d, 8383, 6, 22, 1, -19, 112, 0, 3},
+  {0x007e, 8449, 12, 5, 1, -9, 224, 0, 0},
+  {0x00a0, 8479, 0, 0, 0, 0, 80, 0, 0},
+  {0x00a1, 8479, 4, 16, 2, -12, 128, 0, 0},
+  {0x00a2, 8511, 12, 18, 1, -15, 224, 0, 0},
+  {0x00a3, 8619, 14, 17, 0, -17, 224, 0, 0},
+  {0x00a4, 8738, 12, 11, 1, -13, 224, 0, 0},
+  {0x00a5, 8804, 14, 17, 0, -17, 224, 0, 0},
+  {0x00a6, 8923, 3, 22, 2, -18, 112, 0, 0},
+  {0x00a7, 8967, 10, 19, 1, -17, 192, 0, 0},
+  {0x00a8, 9062, 8, 2, 0, -17, 112, 0, 0},
+  {0x00a9, 9070, 19, 17, 0, -17, 304, 0, 0},
+  {0x00aa, 9240, 7, 8, 1, -17, 128, 1, 1},
+  {0x00ab, 9272, 9, 11, 1, -12, 176, 4, 5},
+  {0x00ac, 9327, 12, 6, 1, -9, 224, 0, 0},
+  {0x00ad, 9363, 7, 2, 1, -8, 128, 4, 5},
+  {0x00ae, 9371, 19, 17, 0, -17, 304, 6, 0},
+  {0x00af, 9541, 8, 2, 0, -16, 112, 0, 0},
+  {0x00b0, 9549, 9, 8, 0, -17, 160, 1, 1},
+  {0x00b1, 9589, 12, 13, 1, -14, 224, 0, 0},
+  {0x00b2, 9667, 8, 9, 0, -19, 128, 26, 27},
+  {0x00b3, 9703, 7, 9, 1, -19, 128, 26, 27},
+  {0x00b4, 9739, 6, 4, 2, -17, 112, 0, 0},
+  {0x00b5, 9751, 11, 16, 1, -12, 208, 0, 6},
+  {0x00b6, 9847, 16, 20, 0, -17, 256, 0, 0},
+  {0x00b7, 10007, 5, 3, 1, -8, 112, 4, 5},
+  {0x00b8, 10016, 5, 4, 1, 0, 112, 0, 0},
+  {0x00b9, 10028, 6, 9, 1, -19, 128, 26, 27},
+  {0x00ba, 10055, 9, 8, 0, -17, 144, 1, 1},
+  {0x00bb, 10095, 9, 11, 1, -12, 176, 4, 5},
+  {0x00bc, 10150, 16, 17, 1, -17, 272, 0, 0},
+  {0x00bd, 10286, 16, 17, 1, -17, 272, 0, 0},
+  {0x00be, 10422, 17, 17, 0, -17, 272, 0, 0},
+  {0x00bf, 10575, 10, 16, 0, -12, 160, 0, 0},
+  {0x00c0, 10655, 17, 21, 0, -21, 256, 7, 2},
+  {0x00c1, 10844, 17, 21, 0, -21, 256, 7, 2},
+  {0x00c2, 11033, 17, 21, 0, -21, 256, 7, 2},
+  {0x00c3, 11222, 17, 21, 0, -21, 256, 7, 2},
+  {0x00c4, 11411, 17, 20, 0, -20, 256, 7, 2},
+  {0x00c5, 11591, 17, 22, 0, -22, 256, 7, 2},
+  {0x00c6, 11789, 23, 17, -1, -17, 352, 0, 2},
+  {0x00c7, 11993, 15, 21, 1, -17, 256, 8, 8},
+  {0x00c8, 12161, 11, 21, 2, -21, 224, 0, 0},
+  {0x00c9, 12287, 11, 21, 2, -21, 224, 0, 0},
+  {0x00ca, 12413, 11, 21, 2, -21, 224, 0, 0},
+  {0x00cb, 12539, 11, 20, 2, -20, 224, 0, 0},
+  {0x00cc, 12659, 7, 21, -1, -21, 112, 0, 0},
+  {0x00cd, 12743, 7, 21, 1, -21, 112, 0, 0},
+  {0x00ce, 12827, 9, 21, -1, -21, 112, 0, 0},
+  {0x00cf, 12932, 9, 20, -1, -20, 112, 0, 0},
+  {0x00d0, 13032, 18, 17, 0, -17, 304, 6, 0},
+  {0x00d1, 13185, 15, 21, 2, -21, 288, 0, 0},
+  {0x00d2, 13353, 18, 21, 1, -21, 304, 6, 8},
+  {0x00d3, 13542, 18, 21, 1, -21, 304, 6, 8},
+  {0x00d4, 13731, 18, 21, 1, -21, 304, 6, 8},
+  {0x00d5, 13920, 18, 21, 1, -21, 304, 6, 8},
+  {0x00d6, 14109, 18, 20, 1, -20, 304, 6, 8},
+  {0x00d7, 14289, 12, 12, 1, -14, 224, 0, 0},
+  {0x00d8, 14361, 18, 18, 1, -17, 304, 0, 8},
+  {0x00d9, 14523, 15, 21, 1, -21, 288, 10, 11},
+  {0x00da, 14691, 15, 21, 1, -21, 288, 10, 11},
+  {0x00db, 14859, 15, 21, 1, -21, 288, 10, 11},
+  {0x00dc, 15027, 15, 20, 1, -20, 288, 10, 11},
+  {0x00dd, 15187, 15, 21, 0, -21, 240, 17, 15},
+  {0x00de, 15355, 12, 17, 2, -17, 240, 6, 0},
+  {0x00df, 15457, 12, 17, 2, -17, 240, 0, 0},
+  {0x00e0, 15559, 10, 17, 1, -17, 192, 19, 17},
+  {0x00e1, 15644, 10, 17, 1, -17, 192, 19, 17},
+  {0x00e2, 15729, 10, 17, 1, -17, 192, 19, 17},
+  {0x00e3, 15814, 10, 17, 1, -17, 192, 19, 17},
+  {0x00e4, 15899, 10, 17, 1, -17, 192, 19, 17},
+  {0x00e5, 15984, 10, 17, 1, -17, 192, 19, 17},
+  {0x00e6, 16069, 18, 12, 1, -12, 320, 20, 17},
+  {0x00e7, 16177, 11, 16, 0, -12, 176, 0, 18},
+  {0x00e8, 16273, 12, 17, 0, -17, 208, 20, 18},
+  {0x00e9, 16375, 12, 17, 0, -17, 208, 20, 18},
+  {0x00ea, 16477, 12, 17, 0, -17, 208, 20, 18},
+  {0x00eb, 16579, 12, 17, 0, -17, 208, 20, 18},
+  {0x00ec, 16681, 6, 17, -1, -17, 96, 0, 0},
+  {0x00ed, 16732, 6, 17, 1, -17, 96, 0, 0},
+  {0x00ee, 16783, 8, 17, -1, -17, 96, 0, 0},
+  {0x00ef, 16851, 8, 17, -1, -17, 96, 0, 0},
+  {0x00f0, 16919, 13, 17, 0, -17, 208, 0, 18},
+  {0x00f1, 17038, 11, 17, 1, -17, 208, 19, 6},
+  {0x00f2, 17140, 13, 17, 0, -17, 208, 20, 18},
+  {0x00f3, 17259, 13, 17, 0, -17, 208, 20, 18},
+  {0x00f4, 17378, 13, 17, 0, -17, 208, 20, 18},
+  {0x00f5, 17497, 13, 17, 0, -17, 208, 20, 18},
+  {0x00f6, 17616, 13, 17, 0, -17, 208, 20, 18},
+  {0x00f7, 17735, 12, 11, 1, -13, 224, 0, 0},
+  {0x00f8, 17801, 13, 14, 0, -13, 208, 20, 18},
+  {0x00f9, 17899, 11, 17, 1, -17, 208, 0, 6},
+  {0x00fa, 18001, 11, 17, 1, -17, 208, 0, 6},
+  {0x00fb, 18103, 11, 17, 1, -17, 208, 0, 6},
+  {0x00fc, 18205, 11, 17, 1, -17, 208, 0, 6},
+  {0x00fd, 18307, 13, 21, 0, -17, 192, 0, 0},
+  {0x00fe, 18454, 12, 21, 1, -17, 208, 20, 0},
+  {0x00ff, 18580, 13, 21, 0, -17, 192, 0, 0},
+  {0x0104, 18727, 18, 21, 0, -17, 256, 7, 2},
+  {0x0105, 18916, 11, 16, 1, -12, 192, 19, 17},
+  {0x0106, 19012, 15, 21, 1, -21, 256, 8, 8},
+  {0x0107, 19180, 11, 17, 0, -17, 176, 0, 18},
+  {0x0118, 19282, 11, 21, 2, -17, 224, 0, 0},
+  {0x0119, 19408, 12, 16, 0, -12, 208, 20, 18},
+  {0x0131, 19504, 4, 12, 1, -12, 96, 0, 0},
+  {0x0141, 19528, 13, 17, 0, -17, 208, 27, 0},
+  {0x0142, 19647, 8, 17, 0, -17, 128, 0, 0},
+  {0x0143, 19715, 15, 21, 2, -21, 288, 0, 0},
+  {0x0144, 19883, 11, 17, 1, -17, 208, 19, 6},
+  {0x0152, 19985, 25, 17, 1, -17, 416, 0, 8},
+  {0x0153, 20206, 20, 12, 0, -12, 336, 20, 18},
+  {0x015a, 20326, 12, 21, 0, -21, 208, 0, 0},
+  {0x015b, 20452, 10, 17, 0, -17, 160, 0, 0},
+  {0x0160, 20537, 12, 21, 0, -21, 208, 0, 0},
+  {0x0161, 20663, 10, 17, 0, -17, 160, 0, 0},
+  {0x0178, 20748, 15, 20, 0, -20, 240, 17, 15},
+  {0x0179, 20908, 14, 21, 1, -21, 240, 18, 16},
+  {0x017a, 21055, 11, 17, 0, -17, 176, 0, 0},
+  {0x017b, 21157, 14, 20, 1, -20, 240, 18, 16},
+  {0x017c, 21297, 11, 17, 0, -17, 176, 0, 0},
+  {0x017d, 21399, 14, 21, 1, -21, 240, 18, 16},
+  {0x017e, 21546, 11, 17, 0, -17, 176, 0, 0},
+  {0x2013, 21648, 11, 2, 1, -8, 208, 4, 5},
+  {0x2014, 21660, 17, 2, 1, -8, 320, 4, 5},
+  {0x2018, 21678, 4, 7, 0, -19, 80, 1, 1},
+  {0x2019, 21692, 3, 8, 1, -19, 80, 1, 1},
+  {0x201a, 21708, 3, 7, 1, -3, 80, 3, 4},
+  {0x201c, 21722, 8, 7, 0, -19, 144, 1, 1},
+  {0x201d, 21750, 7, 8, 1, -19, 144, 1, 1},
+  {0x201e, 21782, 7, 7, 1, -3, 144, 3, 4},
+  {0x2020, 21810, 12, 21, 1, -17, 224, 0, 0},
+  {0x2021, 21936, 12, 21, 1, -17, 224, 0, 0},
+  {0x2022, 22062, 10, 9, 2, -12, 224, 4, 5},
+  {0x2026, 22107, 16, 2, 1, -2, 272, 0, 0},
+  {0x2030, 22123, 27, 17, 0, -17, 448, 0, 0},
+  {0x2039, 22361, 5, 11, 1, -12, 128, 4, 5},
+  {0x203a, 22394, 5, 11, 1, -12, 128, 4, 5},
+  {0x20ac, 22427, 14, 17, 0, -17, 224, 0, 0},
+  {0x2122, 22546, 16, 7, 0, -17, 272, 1, 1},
+};
+
+// [left class][right class], 1/16 px
+const int8_t kKerning[28 * 28] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-35,0,-44,-34,0,0,-9,0,0,0,9,9,0,6,0,-12,-18,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,-8,0,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,0,0,
+  0,-44,0,0,0,-26,0,0,-11,0,-35,0,-35,-23,0,-29,0,0,0,0,0,0,0,-25,-12,0,0,0,
+  0,-34,-10,0,-26,0,0,0,0,0,-35,0,-22,-6,-12,-31,-9,0,0,0,0,0,0,0,0,0,0,0,
+  0,9,-26,0,-37,-22,-17,9,-10,-29,0,0,0,0,0,0,0,-22,-22,-6,-26,-20,-8,-9,0,-10,-16,11,
+  0,-9,-8,-8,-11,0,0,0,0,0,-19,0,-10,0,-6,-15,-13,0,0,0,0,0,0,0,0,0,0,0,
+  0,-35,0,0,0,-10,0,-11,-8,10,-25,-11,-26,-16,0,-31,0,0,0,0,0,0,0,-16,0,0,0,-35,
+  0,0,0,0,0,-29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-25,0,-35,0,-12,6,0,-38,0,0,0,0,0,0,0,0,-13,0,0,0,0,0,0,0,0,0,
+  0,0,-11,0,-10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,-12,0,0,-6,0,0,0,0,0,0,0,0,0,-7,-10,0,0,-16,-13,-11,0,0,0,
+  0,-56,0,0,10,-38,0,-10,-15,0,-33,0,-35,-29,0,-41,0,0,-7,0,0,0,0,-21,-15,0,0,-39,
+  0,0,-26,0,-48,0,0,0,0,-35,0,0,0,0,0,0,0,-10,-6,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,-9,0,-10,-8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-25,0,-35,-35,-31,0,-19,-38,0,0,0,0,0,0,0,-48,-40,0,-36,-31,0,-35,-27,-28,-23,0,
+  0,9,-18,0,-23,-6,0,7,0,-20,0,0,0,0,0,0,0,-17,-6,0,-19,-9,0,0,0,0,0,9,
+  0,6,-31,0,-29,-31,-23,7,-15,-38,0,0,0,0,0,0,0,-25,-31,0,-33,-25,0,-19,-18,-25,0,10,
+  0,0,0,0,0,-13,0,7,-11,0,0,0,0,0,0,0,0,0,-7,0,0,-5,0,-8,0,0,0,0,
+  0,-14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-6,0,0,0,-14,
+  0,-18,0,-6,0,0,0,0,0,0,0,0,-22,-6,0,0,0,0,0,0,0,0,0,-5,0,-12,0,0,
+  0,13,0,0,-25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-12,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,-25,0,0,0,0,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,0,0,
+  0,0,-16,0,-25,0,0,0,0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,-12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-35,0,0,0,0,0,0,0,0,0,11,11,0,8,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,-27,0,0,0,-25,0,0,0,0,0,0,-31,-23,0,-29,0,0,0,0,0,0,0,-11,0,0,0,-25,
+};
+
+} // namespace
+
+extern const AaFont kAaSans12 = {kBitmap, kGlyphs, 232, kKerning, 28, 30, 24, 6};
+
+} // namespace ui_gfx
@@ -0,0 +1,2216 @@
+// Generated by tools/make_font_atlas.py - do not edit
+// Lato Regular (SIL OFL 1.1), 35 px em, charset latin: 232 glyphs, 4536 kerning pairs in 28x28 classes, 46350 bitmap bytes
+#include "gfx/fonts/AaFonts.h"
+
+namespace ui_gfx {
+
+namespace {
+
+const uint8_t kBitmap[] = {
+  0x07,0xff,0x80,0x07,0xff,0x80,0x07,0xff,0x80,0x07,0xff,0x80,0x07,0xff,0x80,0x07,0xff,0x80,0x07,0xff,0x80,0x07,0xff,0x80,
+  0x07,0xff,0x80,0x07,0xff,0x80,0x06,0xff,0x80,0x06,0xff,0x70,0x05,0xff,0x70,0x04,0xff,0x50,0x03,0xff,0x40,0x01,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xee,0x60,0x1f,0xff,0xf1,0x1f,0xff,0xf1,
+  0x06,0xee,0x60,0x5f,0xf6,0x00,0x8f,0xf3,0x5f,0xf6,0x00,0x8f,0xf3,0x5f,0xf6,0x00,0x8f,0xf3,0x5f,0xf6,0x00,0x8f,0xf3,0x5f,
+  0xf6,0x00,0x8f,0xf3,0x5f,0xf5,0x00,0x7f,0xf2,0x3f,0xf3,0x00,0x6f,0xf1,0x1f,0xf2,0x00,0x4f,0xe0,0x0b,0xc0,0x00,0x0d,0xa0,
+  0x00,0x00,0x00,0x04,0xef,0x10,0x00,0x9f,0xa0,0x00,0x00,0x00,0x00,0x0a,0xfd,0x00,0x00,0xcf,0xc0,0x00,0x00,0x00,0x00,0x0d,
+  0xfa,0x00,0x00,0xff,0x90,0x00,0x00,0x00,0x00,0x1f,0xf7,0x00,0x03,0xff,0x60,0x00,0x00,0x00,0x00,0x5f,0xf4,0x00,0x06,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x8f,0xf1,0x00,0x09,0xfe,0x00,0x00,0x00,0x00,0x00,0xbf,0xd0,0x00,0x0d,0xfb,0x00,0x00,0x00,0xbf,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0x02,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0x00,0x00,0x04,0xff,0x50,0x00,
+  0x6f,0xf3,0x00,0x00,0x00,0x00,0x07,0xff,0x20,0x00,0x9f,0xf0,0x00,0x00,0x00,0x00,0x0a,0xfe,0x00,0x00,0xbf,0xc0,0x00,0x00,
+  0x00,0x00,0x0d,0xfb,0x00,0x00,0xef,0x90,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x02,0xff,0x70,0x00,0x00,0x00,0x00,0x3f,0xf5,
+  0x00,0x05,0xff,0x40,0x00,0x00,0x0e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x10,0x0d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0x10,0x00,0x00,0xbf,0xd0,0x00,0x0d,0xfb,0x00,0x00,0x00,0x00,0x00,0xef,0xa0,0x00,0x1f,0xf8,0x00,0x00,0x00,0x00,0x02,
+  0xff,0x70,0x00,0x3f,0xf5,0x00,0x00,0x00,0x00,0x04,0xff,0x40,0x00,0x6f,0xf3,0x00,0x00,0x00,0x00,0x07,0xff,0x10,0x00,0x9f,
+  0xf0,0x00,0x00,0x00,0x00,0x0a,0xfe,0x00,0x00,0xcf,0xc0,0x00,0x00,0x00,0x00,0x0d,0xfb,0x00,0x00,0xef,0x90,0x00,0x00,0x00,
+  0x00,0x1f,0xe4,0x00,0x00,0xcf,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xea,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,
+  0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x01,0x7b,0xef,0xfe,0xa6,0x10,0x00,0x00,0x00,0x5e,0xff,0xff,0xff,0xff,0xe7,0x00,0x00,0x06,0xff,0xfe,0xbe,0xfc,0xef,0xff,
+  0xa0,0x00,0x2f,0xff,0x81,0x0c,0xf3,0x06,0xdf,0x60,0x00,0x9f,0xf8,0x00,0x0d,0xf2,0x00,0x13,0x00,0x00,0xef,0xf1,0x00,0x0e,
+  0xf1,0x00,0x00,0x00,0x00,0xff,0xd0,0x00,0x0f,0xf0,0x00,0x00,0x00,0x00,0xff,0xf1,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0xdf,
+  0xf9,0x00,0x2f,0xd0,0x00,0x00,0x00,0x00,0x7f,0xff,0xa1,0x3f,0xc0,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xbf,0xb0,0x00,0x00,
+  0x00,0x00,0x01,0xbf,0xff,0xff,0xea,0x50,0x00,0x00,0x00,0x00,0x05,0xbf,0xff,0xff,0xfe,0x70,0x00,0x00,0x00,0x00,0x01,0xaf,
+  0xff,0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x8f,0x75,0xcf,0xff,0xb0,0x00,0x00,0x00,0x00,0x9f,0x50,0x08,0xff,0xf3,0x00,0x00,
+  0x00,0x00,0xaf,0x40,0x00,0xbf,0xf7,0x00,0x00,0x00,0x00,0xbf,0x30,0x00,0x7f,0xf8,0x00,0x00,0x00,0x00,0xcf,0x20,0x00,0x7f,
+  0xf7,0x00,0x00,0x00,0x00,0xef,0x10,0x00,0xbf,0xf4,0x04,0xd8,0x00,0x00,0xff,0x00,0x04,0xff,0xd0,0x0d,0xff,0xc4,0x01,0xfe,
+  0x00,0x5e,0xff,0x60,0x06,0xff,0xff,0xda,0xfe,0xad,0xff,0xf9,0x00,0x00,0x3c,0xff,0xff,0xff,0xff,0xff,0x70,0x00,0x00,0x00,
+  0x49,0xcf,0xff,0xec,0x82,0x00,0x00,0x00,0x00,0x00,0x05,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xf9,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x07,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xf4,0x00,0x00,0x00,0x00,0x00,0x18,0xdf,0xeb,0x50,
+  0x00,0x00,0x00,0x00,0x00,0xaf,0xf3,0x00,0x02,0xdf,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x08,0xff,0x60,0x00,0x0c,0xfd,0x41,
+  0x28,0xff,0x70,0x00,0x00,0x00,0x4f,0xfa,0x00,0x00,0x5f,0xf4,0x00,0x00,0x9f,0xe0,0x00,0x00,0x01,0xef,0xd1,0x00,0x00,0x9f,
+  0xd0,0x00,0x00,0x4f,0xf3,0x00,0x00,0x0b,0xff,0x30,0x00,0x00,0xaf,0xb0,0x00,0x00,0x1f,0xf5,0x00,0x00,0x8f,0xf6,0x00,0x00,
+  0x00,0xbf,0xb0,0x00,0x00,0x1f,0xf5,0x00,0x04,0xff,0xa0,0x00,0x00,0x00,0x9f,0xd0,0x00,0x00,0x3f,0xf3,0x00,0x1e,0xfd,0x10,
+  0x00,0x00,0x00,0x5f,0xf3,0x00,0x00,0x9f,0xe0,0x00,0xbf,0xf3,0x00,0x00,0x00,0x00,0x0c,0xfd,0x51,0x28,0xff,0x60,0x08,0xff,
+  0x60,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0xff,0xf9,0x00,0x4f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xdf,0xeb,0x50,0x01,
+  0xef,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x30,0x18,0xdf,0xea,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x7f,0xf7,0x02,0xdf,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xa0,0x0c,0xfd,0x41,0x3a,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x1e,0xfd,0x10,0x5f,0xf3,0x00,0x00,0xcf,0xa0,0x00,0x00,0x00,0x00,0xbf,0xf3,0x00,0x9f,0xd0,0x00,0x00,0x7f,0xe0,
+  0x00,0x00,0x00,0x07,0xff,0x70,0x00,0xcf,0xa0,0x00,0x00,0x4f,0xf2,0x00,0x00,0x00,0x4f,0xfb,0x00,0x00,0xdf,0x90,0x00,0x00,
+  0x3f,0xf3,0x00,0x00,0x01,0xdf,0xd1,0x00,0x00,0xcf,0xa0,0x00,0x00,0x4f,0xf2,0x00,0x00,0x0b,0xff,0x30,0x00,0x00,0x9f,0xc0,
+  0x00,0x00,0x6f,0xe0,0x00,0x00,0x7f,0xf7,0x00,0x00,0x00,0x5f,0xf3,0x00,0x00,0xcf,0xa0,0x00,0x04,0xff,0xb0,0x00,0x00,0x00,
+  0x0c,0xfd,0x41,0x2a,0xff,0x30,0x00,0x1d,0xfd,0x10,0x00,0x00,0x00,0x02,0xdf,0xff,0xff,0xf5,0x00,0x00,0xbf,0xe3,0x00,0x00,
+  0x00,0x00,0x00,0x18,0xdf,0xea,0x30,0x00,0x00,0x00,0x00,0x16,0xbe,0xfe,0xb6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xdf,
+  0xff,0xff,0xff,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0x92,0x02,0x9f,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,
+  0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0xff,0xe0,0x00,0x00,0x01,0xef,0xc0,0x00,0x00,0x00,0x00,0x02,0xff,0xb0,
+  0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,
+  0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xe3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xff,
+  0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xfe,0xff,0xe3,0x00,0x00,0x00,0xcf,0x90,0x00,0x00,0xaf,0xfe,0x51,
+  0xdf,0xfe,0x20,0x00,0x01,0xff,0x80,0x00,0x07,0xff,0xe3,0x00,0x1d,0xff,0xe2,0x00,0x04,0xff,0x60,0x00,0x1e,0xff,0x60,0x00,
+  0x02,0xdf,0xfd,0x20,0x08,0xff,0x20,0x00,0x5f,0xfe,0x00,0x00,0x00,0x2d,0xff,0xd2,0x0d,0xfd,0x00,0x00,0x8f,0xfb,0x00,0x00,
+  0x00,0x02,0xdf,0xfd,0x6f,0xf7,0x00,0x00,0x8f,0xfa,0x00,0x00,0x00,0x00,0x2e,0xff,0xff,0xe1,0x00,0x00,0x6f,0xfc,0x00,0x00,
+  0x00,0x00,0x02,0xef,0xff,0x70,0x00,0x00,0x2f,0xff,0x20,0x00,0x00,0x00,0x00,0x9f,0xff,0xc1,0x00,0x00,0x09,0xff,0xc1,0x00,
+  0x00,0x00,0x1a,0xff,0xff,0xfc,0x10,0x00,0x01,0xcf,0xfd,0x62,0x01,0x48,0xef,0xfb,0x4e,0xff,0xd1,0x00,0x00,0x1a,0xff,0xff,
+  0xff,0xff,0xfc,0x50,0x02,0xdf,0xfd,0x20,0x00,0x00,0x39,0xde,0xed,0xc8,0x40,0x00,0x00,0x2b,0xff,0xd2,0x5f,0xf6,0x5f,0xf6,
+  0x5f,0xf6,0x5f,0xf6,0x5f,0xf6,0x5f,0xf5,0x3f,0xf3,0x1f,0xf2,0x0b,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x40,0x00,0x00,
+  0xcf,0xe0,0x00,0x06,0xff,0x80,0x00,0x0d,0xfe,0x10,0x00,0x5f,0xf8,0x00,0x00,0xbf,0xf2,0x00,0x02,0xff,0xc0,0x00,0x07,0xff,
+  0x60,0x00,0x0b,0xff,0x10,0x00,0x0e,0xfd,0x00,0x00,0x2f,0xfa,0x00,0x00,0x5f,0xf7,0x00,0x00,0x7f,0xf4,0x00,0x00,0x8f,0xf3,
+  0x00,0x00,0x9f,0xf2,0x00,0x00,0xaf,0xf1,0x00,0x00,0xaf,0xf1,0x00,0x00,0x9f,0xf2,0x00,0x00,0x8f,0xf3,0x00,0x00,0x7f,0xf4,
+  0x00,0x00,0x5f,0xf7,0x00,0x00,0x2f,0xfa,0x00,0x00,0x0e,0xfd,0x00,0x00,0x0b,0xff,0x20,0x00,0x07,0xff,0x70,0x00,0x02,0xff,
+  0xc0,0x00,0x00,0xcf,0xf2,0x00,0x00,0x5f,0xf9,0x00,0x00,0x0d,0xff,0x10,0x00,0x06,0xff,0x80,0x00,0x00,0xcf,0xe0,0x00,0x00,
+  0x3d,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x70,0x00,0x00,0x9f,0xe2,0x00,0x00,0x4f,0xfa,0x00,0x00,0x0c,0xff,
+  0x20,0x00,0x04,0xff,0x90,0x00,0x00,0xdf,0xe1,0x00,0x00,0x7f,0xf6,0x00,0x00,0x2f,0xfb,0x00,0x00,0x0c,0xff,0x00,0x00,0x09,
+  0xff,0x40,0x00,0x06,0xff,0x70,0x00,0x03,0xff,0x90,0x00,0x00,0xff,0xb0,0x00,0x00,0xef,0xc0,0x00,0x00,0xdf,0xd0,0x00,0x00,
+  0xcf,0xe0,0x00,0x00,0xcf,0xe0,0x00,0x00,0xdf,0xd0,0x00,0x00,0xef,0xc0,0x00,0x00,0xff,0xb0,0x00,0x03,0xff,0x90,0x00,0x06,
+  0xff,0x70,0x00,0x09,0xff,0x40,0x00,0x0d,0xff,0x00,0x00,0x3f,0xfb,0x00,0x00,0x8f,0xf6,0x00,0x00,0xdf,0xe1,0x00,0x05,0xff,
+  0x90,0x00,0x0c,0xff,0x20,0x00,0x4f,0xfa,0x00,0x00,0xaf,0xe2,0x00,0x00,0x2b,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0c,0xb0,0x00,0x00,0x00,0x00,0x0c,0xb0,0x00,0x00,0x09,0x40,0x0c,0xb0,0x04,0x80,0x2d,0xfa,0x2c,0xb3,0xbf,0xd1,0x00,0x7e,
+  0xed,0xcf,0xe6,0x00,0x00,0x02,0xcf,0xfb,0x10,0x00,0x00,0x5d,0xfe,0xdf,0xd5,0x00,0x1c,0xfc,0x4c,0xb4,0xcf,0xb1,0x0a,0x60,
+  0x0c,0xb0,0x06,0xa0,0x00,0x00,0x0c,0xb0,0x00,0x00,0x00,0x00,0x0c,0xb0,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,
+  0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xf8,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,
+  0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,
+  0x00,0x09,0xec,0x20,0x4f,0xff,0xa0,0x4f,0xff,0xd0,0x09,0xef,0xb0,0x00,0x4f,0x70,0x00,0xaf,0x20,0x05,0xf7,0x00,0x1e,0xb0,
+  0x00,0x07,0x10,0x00,0x4f,0xff,0xff,0xff,0xf6,0x4f,0xff,0xff,0xff,0xf6,0x09,0xec,0x30,0x5f,0xff,0xb0,0x5f,0xff,0xc0,0x0a,
+  0xec,0x30,0x00,0x00,0x00,0x00,0x00,0x04,0xef,0x10,0x00,0x00,0x00,0x00,0x00,0x0c,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+  0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x70,0x00,0x00,0x00,0x00,0x00,0x06,0xff,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x0c,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,
+  0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x70,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x0c,0xfa,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x70,0x00,
+  0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf5,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xd0,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xe0,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x0c,0xfa,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x18,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8c,0xee,0xda,0x50,0x00,0x00,0x00,0x00,0x01,0x9f,0xff,
+  0xff,0xff,0xfb,0x20,0x00,0x00,0x00,0x1b,0xff,0xc5,0x11,0x3a,0xff,0xe2,0x00,0x00,0x00,0x9f,0xfa,0x00,0x00,0x00,0x7f,0xfd,
+  0x00,0x00,0x03,0xff,0xd1,0x00,0x00,0x00,0x0a,0xff,0x80,0x00,0x0a,0xff,0x60,0x00,0x00,0x00,0x02,0xff,0xe0,0x00,0x1f,0xff,
+  0x10,0x00,0x00,0x00,0x00,0xcf,0xf5,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x9f,0xf9,0x00,0x00,0x00,0x00,
+  0x00,0x5f,0xfd,0x00,0xbf,0xf7,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x10,0xdf,0xf5,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x20,
+  0xdf,0xf5,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x30,0xef,0xf4,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x40,0xdf,0xf5,0x00,0x00,
+  0x00,0x00,0x00,0x0f,0xff,0x30,0xdf,0xf5,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x20,0xbf,0xf6,0x00,0x00,0x00,0x00,0x00,0x2f,
+  0xff,0x10,0x9f,0xf9,0x00,0x00,0x00,0x00,0x00,0x5f,0xfd,0x00,0x6f,0xfc,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x1f,0xff,
+  0x10,0x00,0x00,0x00,0x00,0xcf,0xf5,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x02,0xff,0xe1,0x00,0x04,0xff,0xd1,0x00,0x00,0x00,
+  0x0a,0xff,0x80,0x00,0x00,0x9f,0xfa,0x00,0x00,0x00,0x7f,0xfd,0x00,0x00,0x00,0x1b,0xff,0xc5,0x11,0x3a,0xff,0xe2,0x00,0x00,
+  0x00,0x01,0x9f,0xff,0xff,0xff,0xfb,0x20,0x00,0x00,0x00,0x00,0x03,0x8c,0xee,0xda,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x01,0xaf,0xff,0x80,0x00,0x00,0x00,0x00,0x1c,0xff,0xff,0x80,0x00,0x00,0x00,0x02,0xdf,0xff,
+  0xff,0x80,0x00,0x00,0x00,0x3e,0xff,0xeb,0xff,0x80,0x00,0x00,0x05,0xef,0xfc,0x29,0xff,0x80,0x00,0x00,0x3f,0xff,0xb1,0x09,
+  0xff,0x80,0x00,0x00,0x0b,0xf9,0x00,0x09,0xff,0x80,0x00,0x00,0x01,0x30,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xf7,0x00,0x00,0x02,0x8c,0xef,0xeb,0x71,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x0b,
+  0xff,0xd6,0x10,0x27,0xef,0xf6,0x00,0x00,0x8f,0xfc,0x10,0x00,0x00,0x3e,0xff,0x20,0x01,0xef,0xf2,0x00,0x00,0x00,0x08,0xff,
+  0x90,0x06,0xff,0xb0,0x00,0x00,0x00,0x04,0xff,0xd0,0x07,0xee,0x40,0x00,0x00,0x00,0x02,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x03,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xa0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xf3,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,
+  0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xb1,0x00,0x00,0x00,0x00,0x00,
+  0x09,0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xfd,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x9f,0xff,0xd2,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfd,0x20,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xfd,0xdf,0xff,
+  0xff,0xff,0xff,0xe6,0x3f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x01,0x6b,0xdf,0xed,0x94,0x00,0x00,0x00,0x00,
+  0x6e,0xff,0xff,0xff,0xff,0xb1,0x00,0x00,0x07,0xff,0xf8,0x20,0x15,0xcf,0xfc,0x10,0x00,0x3f,0xfe,0x30,0x00,0x00,0x0c,0xff,
+  0x80,0x00,0xbf,0xf6,0x00,0x00,0x00,0x04,0xff,0xe0,0x01,0xff,0xe1,0x00,0x00,0x00,0x00,0xef,0xf1,0x02,0xbd,0x70,0x00,0x00,
+  0x00,0x00,0xdf,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xb0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2e,0xff,0x30,0x00,0x00,0x00,0x00,0x01,0x49,0xff,0xe4,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xf8,0x10,
+  0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xff,0x91,0x00,0x00,0x00,0x00,0x00,0x01,0x37,0xcf,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x09,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xf9,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x6f,0xfa,0x06,0xca,0x00,0x00,0x00,0x00,0x00,0x7f,0xf9,0x0c,0xff,0x50,0x00,0x00,0x00,0x00,0xaf,
+  0xf7,0x06,0xff,0xd1,0x00,0x00,0x00,0x02,0xff,0xf2,0x01,0xdf,0xfa,0x00,0x00,0x00,0x1c,0xff,0x90,0x00,0x3e,0xff,0xc4,0x10,
+  0x26,0xef,0xfb,0x00,0x00,0x03,0xdf,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0x00,0x05,0xad,0xef,0xec,0x82,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,
+  0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xad,0xfc,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x5f,0xfd,0x1e,0xfc,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xf3,0x0e,0xfc,0x00,0x00,0x00,0x00,0x00,0x1d,
+  0xff,0x60,0x0e,0xfc,0x00,0x00,0x00,0x00,0x00,0xaf,0xfa,0x00,0x0e,0xfc,0x00,0x00,0x00,0x00,0x07,0xff,0xd1,0x00,0x0e,0xfc,
+  0x00,0x00,0x00,0x00,0x4f,0xff,0x30,0x00,0x0e,0xfc,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x0e,0xfc,0x00,0x00,0x00,0x0b,
+  0xff,0xa0,0x00,0x00,0x0e,0xfc,0x00,0x00,0x00,0x8f,0xfd,0x10,0x00,0x00,0x0e,0xfc,0x00,0x00,0x05,0xff,0xf3,0x00,0x00,0x00,
+  0x0e,0xfc,0x00,0x00,0x2e,0xff,0x70,0x00,0x00,0x00,0x0e,0xfc,0x00,0x00,0x2f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,
+  0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0e,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xfc,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0e,0xfc,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0x20,0x00,0x01,0xff,0xff,0xff,0xff,0xff,
+  0xfb,0x00,0x00,0x03,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x2f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,0xce,0xfe,0xda,0x50,
+  0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xfc,0x30,0x00,0x00,0x49,0xa6,0x31,0x02,0x6d,0xff,0xe3,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xa0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x05,
+  0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x50,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x4f,0xfd,0x00,0x02,0xc8,0x10,0x00,0x00,0x03,0xef,0xf4,0x00,0x0b,0xff,0xe8,0x30,0x13,0x8e,0xff,0x60,0x00,0x06,
+  0xdf,0xff,0xff,0xff,0xff,0xd4,0x00,0x00,0x00,0x04,0x8c,0xef,0xed,0xa5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0xff,
+  0x50,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xbf,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x70,0x00,0x00,0x00,0x00,
+  0x00,0x02,0xef,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfe,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x04,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0x97,0xce,0xfe,0xb6,0x00,0x00,0x00,0x9f,0xff,0xff,
+  0xff,0xff,0xff,0xd3,0x00,0x02,0xff,0xff,0xc5,0x10,0x26,0xdf,0xfe,0x30,0x07,0xff,0xf8,0x00,0x00,0x00,0x1c,0xff,0xc0,0x0c,
+  0xff,0xb0,0x00,0x00,0x00,0x02,0xff,0xf5,0x0f,0xff,0x40,0x00,0x00,0x00,0x00,0xaf,0xf9,0x1f,0xff,0x00,0x00,0x00,0x00,0x00,
+  0x6f,0xfb,0x1f,0xfe,0x00,0x00,0x00,0x00,0x00,0x5f,0xfb,0x0e,0xff,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x0a,0xff,0x30,0x00,
+  0x00,0x00,0x00,0xaf,0xf6,0x05,0xff,0x90,0x00,0x00,0x00,0x03,0xff,0xe1,0x00,0xcf,0xf5,0x00,0x00,0x00,0x2d,0xff,0x60,0x00,
+  0x2e,0xff,0xa4,0x10,0x27,0xef,0xf9,0x00,0x00,0x02,0xbf,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x00,0x04,0x9d,0xef,0xdb,0x71,
+  0x00,0x00,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x9f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xc0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,
+  0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xd0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x2f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf5,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,
+  0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1e,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x08,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x9d,0xef,0xda,0x60,0x00,0x00,0x00,0x02,0xbf,0xff,
+  0xff,0xff,0xfd,0x30,0x00,0x00,0x1d,0xff,0xb4,0x10,0x38,0xff,0xf4,0x00,0x00,0xaf,0xf9,0x00,0x00,0x00,0x5f,0xfd,0x10,0x02,
+  0xff,0xe1,0x00,0x00,0x00,0x0b,0xff,0x50,0x05,0xff,0xa0,0x00,0x00,0x00,0x06,0xff,0x90,0x06,0xff,0x90,0x00,0x00,0x00,0x05,
+  0xff,0xa0,0x04,0xff,0xb0,0x00,0x00,0x00,0x07,0xff,0x90,0x01,0xff,0xe1,0x00,0x00,0x00,0x0b,0xff,0x50,0x00,0x9f,0xf9,0x00,
+  0x00,0x00,0x5f,0xfd,0x00,0x00,0x0b,0xff,0xb4,0x10,0x38,0xff,0xd2,0x00,0x00,0x00,0x6d,0xff,0xff,0xff,0xf8,0x10,0x00,0x00,
+  0x03,0xaf,0xff,0xff,0xff,0xfc,0x50,0x00,0x00,0x6f,0xff,0x83,0x10,0x27,0xef,0xfa,0x00,0x05,0xff,0xe3,0x00,0x00,0x00,0x1d,
+  0xff,0x80,0x0d,0xff,0x70,0x00,0x00,0x00,0x03,0xff,0xf2,0x2f,0xff,0x20,0x00,0x00,0x00,0x00,0xdf,0xf6,0x4f,0xfe,0x00,0x00,
+  0x00,0x00,0x00,0xaf,0xf8,0x4f,0xfe,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x2f,0xff,0x20,0x00,0x00,0x00,0x00,0xdf,0xf6,0x0d,
+  0xff,0x70,0x00,0x00,0x00,0x03,0xff,0xf2,0x05,0xff,0xf4,0x00,0x00,0x00,0x1d,0xff,0x90,0x00,0x9f,0xff,0x93,0x10,0x27,0xef,
+  0xfc,0x10,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0x91,0x00,0x00,0x00,0x16,0xad,0xef,0xeb,0x82,0x00,0x00,0x00,0x00,0x05,0xad,
+  0xee,0xd9,0x30,0x00,0x00,0x00,0x03,0xdf,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x4f,0xff,0x83,0x11,0x4b,0xff,0xc1,0x00,0x02,
+  0xef,0xf4,0x00,0x00,0x00,0x9f,0xfa,0x00,0x0a,0xff,0x70,0x00,0x00,0x00,0x0d,0xff,0x30,0x1f,0xff,0x10,0x00,0x00,0x00,0x07,
+  0xff,0x80,0x4f,0xfc,0x00,0x00,0x00,0x00,0x03,0xff,0xb0,0x6f,0xfb,0x00,0x00,0x00,0x00,0x02,0xff,0xc0,0x5f,0xfc,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xc0,0x4f,0xfe,0x00,0x00,0x00,0x00,0x07,0xff,0xb0,0x0e,0xff,0x50,0x00,0x00,0x00,0x1d,0xff,0x80,0x08,
+  0xff,0xe2,0x00,0x00,0x00,0xaf,0xff,0x30,0x01,0xcf,0xfe,0x62,0x01,0x5c,0xff,0xfc,0x00,0x00,0x1b,0xff,0xff,0xff,0xff,0xef,
+  0xf4,0x00,0x00,0x00,0x5a,0xef,0xec,0x86,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xcf,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfd,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x04,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xfc,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0a,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xe8,
+  0x00,0x00,0x00,0x00,0x00,0x2c,0xea,0x10,0xaf,0xff,0x70,0xaf,0xff,0x70,0x2c,0xeb,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,
+  0xea,0x10,0xaf,0xff,0x70,0xaf,0xff,0x70,0x2c,0xeb,0x10,0x2c,0xea,0x10,0xaf,0xff,0x70,0xaf,0xff,0x70,0x2c,0xeb,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2b,0xea,0x00,0x8f,0xff,0x60,0x8f,0xff,0x80,0x1b,0xff,0x60,0x00,0x8f,0x30,0x01,0xec,0x00,0x09,
+  0xf3,0x00,0x5f,0x70,0x00,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0x9f,0x20,
+  0x00,0x00,0x00,0x00,0x01,0x8f,0xff,0x20,0x00,0x00,0x00,0x01,0x8e,0xff,0xfa,0x00,0x00,0x00,0x01,0x7e,0xff,0xfb,0x30,0x00,
+  0x00,0x00,0x7e,0xff,0xfb,0x30,0x00,0x00,0x00,0x6d,0xff,0xfb,0x30,0x00,0x00,0x00,0x3d,0xff,0xfb,0x40,0x00,0x00,0x00,0x00,
+  0x6f,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x05,0xdf,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x06,0xdf,0xff,0xc4,0x00,0x00,0x00,
+  0x00,0x00,0x06,0xef,0xff,0xb4,0x00,0x00,0x00,0x00,0x00,0x17,0xef,0xff,0xb3,0x00,0x00,0x00,0x00,0x00,0x17,0xef,0xff,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x18,0xef,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x20,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,
+  0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,
+  0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0x30,0x00,0x00,0x00,0x00,0x00,0xcf,0xfb,
+  0x30,0x00,0x00,0x00,0x00,0x6e,0xff,0xfa,0x20,0x00,0x00,0x00,0x01,0x8f,0xff,0xf9,0x20,0x00,0x00,0x00,0x01,0x9f,0xff,0xf9,
+  0x20,0x00,0x00,0x00,0x02,0x9f,0xff,0xf8,0x10,0x00,0x00,0x00,0x02,0x9f,0xff,0xe6,0x00,0x00,0x00,0x00,0x29,0xff,0xfa,0x00,
+  0x00,0x00,0x2a,0xff,0xfe,0x71,0x00,0x00,0x29,0xff,0xfe,0x81,0x00,0x00,0x29,0xff,0xff,0x91,0x00,0x00,0x19,0xff,0xff,0x92,
+  0x00,0x00,0x00,0xbf,0xff,0xa2,0x00,0x00,0x00,0x00,0xcf,0xa3,0x00,0x00,0x00,0x00,0x00,0x93,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x27,0xbd,0xfe,0xc8,0x20,0x00,0x19,0xff,0xff,0xff,0xff,0xf6,0x00,0x2e,0xfd,0x62,0x02,0x7e,0xff,0x50,0x05,0x70,0x00,
+  0x00,0x04,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0xbf,0xf3,0x00,0x00,0x00,0x00,0x00,0xaf,0xf4,0x00,0x00,0x00,0x00,0x00,0xcf,
+  0xf3,0x00,0x00,0x00,0x00,0x04,0xff,0xe1,0x00,0x00,0x00,0x00,0x1d,0xff,0x80,0x00,0x00,0x00,0x03,0xdf,0xfc,0x10,0x00,0x00,
+  0x00,0x5e,0xff,0xc1,0x00,0x00,0x00,0x05,0xff,0xf8,0x00,0x00,0x00,0x00,0x0d,0xff,0x60,0x00,0x00,0x00,0x00,0x0f,0xfb,0x00,
+  0x00,0x00,0x00,0x00,0x0e,0xf9,0x00,0x00,0x00,0x00,0x00,0x0d,0xf7,0x00,0x00,0x00,0x00,0x00,0x04,0x42,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x4d,0xe8,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0x40,0x00,0x00,0x00,0x00,0xdf,0xff,0x40,0x00,0x00,
+  0x00,0x00,0x4d,0xe8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8b,0xde,0xfe,0xb8,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x04,0xcf,0xff,0xff,0xff,0xff,0xfc,0x50,0x00,0x00,0x00,0x00,0x00,0x01,0x9f,0xfe,0xa5,0x21,0x12,0x48,0xdf,0xfb,0x10,0x00,
+  0x00,0x00,0x00,0x2c,0xff,0x81,0x00,0x00,0x00,0x00,0x05,0xdf,0xd2,0x00,0x00,0x00,0x01,0xdf,0xe3,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0xfc,0x10,0x00,0x00,0x0b,0xfd,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0x90,0x00,0x00,0x6f,0xf3,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xf2,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x49,0xde,0xfe,0xb5,0x00,0x0b,0xf8,0x00,0x06,
+  0xfe,0x10,0x00,0x00,0x2b,0xff,0xff,0xff,0xfa,0x00,0x06,0xfd,0x00,0x0c,0xf9,0x00,0x00,0x02,0xdf,0xe8,0x20,0x2f,0xf6,0x00,
+  0x02,0xff,0x20,0x1f,0xf4,0x00,0x00,0x1d,0xfd,0x20,0x00,0x3f,0xf3,0x00,0x00,0xff,0x40,0x4f,0xf0,0x00,0x00,0x9f,0xf2,0x00,
+  0x00,0x6f,0xe0,0x00,0x00,0xef,0x50,0x6f,0xe0,0x00,0x01,0xff,0x80,0x00,0x00,0xaf,0xb0,0x00,0x00,0xef,0x50,0x7f,0xc0,0x00,
+  0x06,0xff,0x20,0x00,0x00,0xdf,0x70,0x00,0x00,0xff,0x40,0x7f,0xd0,0x00,0x0a,0xfd,0x00,0x00,0x02,0xff,0x30,0x00,0x02,0xff,
+  0x10,0x6f,0xe0,0x00,0x0b,0xfb,0x00,0x00,0x06,0xff,0x10,0x00,0x06,0xfd,0x00,0x4f,0xf0,0x00,0x0b,0xfb,0x00,0x00,0x0c,0xfe,
+  0x00,0x00,0x0c,0xf7,0x00,0x2f,0xf4,0x00,0x09,0xfe,0x00,0x00,0x5f,0xff,0x00,0x00,0x7f,0xd1,0x00,0x0d,0xf8,0x00,0x04,0xff,
+  0x91,0x16,0xed,0xdf,0x81,0x28,0xff,0x40,0x00,0x08,0xfd,0x10,0x00,0xbf,0xff,0xff,0xd2,0x6f,0xff,0xff,0xe5,0x00,0x00,0x01,
+  0xef,0x70,0x00,0x19,0xef,0xd8,0x10,0x07,0xdf,0xd9,0x20,0x00,0x00,0x00,0x8f,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1d,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xd3,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xfe,0x81,0x00,0x00,0x00,0x00,0x00,0x04,0xbe,0x10,0x00,0x00,0x00,0x01,
+  0xbf,0xfe,0xa6,0x31,0x01,0x13,0x69,0xdf,0xfd,0x30,0x00,0x00,0x00,0x00,0x04,0xbf,0xff,0xff,0xff,0xff,0xff,0xfd,0x70,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0x6a,0xce,0xfe,0xec,0xa7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xfd,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xa0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xfe,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0xcf,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf4,0x7f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe0,0x1f,0xff,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x80,0x0a,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x20,0x04,0xff,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfb,0x00,0x00,0xdf,0xf7,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x8f,0xfd,
+  0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe1,0x00,0x00,0x2f,0xff,0x40,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x0b,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x06,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0x40,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x3f,0xff,0x20,0x00,0x00,0x00,0x00,0x04,
+  0xff,0xf1,0x00,0x00,0x9f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf7,0x00,0x01,0xef,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x8f,0xfd,0x00,0x06,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x40,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0b,0xff,0xa0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x9f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xcf,0xf7,0xef,0xff,0xff,0xff,0xfe,0xca,0x61,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xfe,0x70,0x00,0xef,0xf7,0x00,
+  0x00,0x02,0x5a,0xff,0xf8,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x7f,0xff,0x30,0xef,0xf7,0x00,0x00,0x00,0x00,0x0d,0xff,0x90,
+  0xef,0xf7,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0xef,0xf7,0x00,0x00,0x00,0x00,0x08,0xff,0xd0,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x09,0xff,0xb0,0xef,0xf7,0x00,0x00,0x00,0x00,0x1e,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfb,0x00,0xef,0xf7,0x00,
+  0x00,0x02,0x6c,0xff,0xa1,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xfc,0x60,0x00,
+  0xef,0xf7,0x00,0x00,0x01,0x26,0xdf,0xfc,0x20,0xef,0xf7,0x00,0x00,0x00,0x00,0x1c,0xff,0xc0,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x02,0xff,0xf5,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0xcf,0xf9,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0xaf,0xfa,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0xaf,0xfa,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0xdf,0xf7,0xef,0xf7,0x00,0x00,0x00,0x00,0x03,0xff,0xf3,
+  0xef,0xf7,0x00,0x00,0x00,0x00,0x1d,0xff,0xa0,0xef,0xf7,0x00,0x00,0x01,0x27,0xef,0xfc,0x10,0xef,0xff,0xff,0xff,0xff,0xff,
+  0xff,0x91,0x00,0xef,0xff,0xff,0xff,0xfe,0xdb,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xbd,0xef,0xed,0xa7,0x30,0x00,0x00,
+  0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0x00,0x1a,0xff,0xfb,0x62,0x10,0x14,0x9e,0xff,0xf4,0x00,0x01,0xcf,
+  0xfd,0x40,0x00,0x00,0x00,0x01,0xaf,0xa0,0x00,0x0b,0xff,0xd2,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x00,0x7f,0xfe,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xe1,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf6,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xc1,0x00,0x00,0x00,0x00,
+  0x00,0x19,0x30,0x00,0x03,0xef,0xfc,0x30,0x00,0x00,0x00,0x03,0xcf,0xe2,0x00,0x00,0x2d,0xff,0xfa,0x52,0x01,0x25,0xaf,0xff,
+  0xc2,0x00,0x00,0x01,0x7e,0xff,0xff,0xff,0xff,0xff,0xe7,0x00,0x00,0x00,0x00,0x01,0x5a,0xce,0xfe,0xdc,0x85,0x00,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xec,0xa5,0x10,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x10,0x00,0x00,0xef,0xf7,0x00,
+  0x00,0x00,0x24,0x8e,0xff,0xe4,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x01,0x8f,0xff,0x60,0x00,0xef,0xf7,0x00,0x00,0x00,
+  0x00,0x00,0x07,0xff,0xf3,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfd,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1e,0xff,0x70,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xd0,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+  0xff,0xf3,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf7,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf9,
+  0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xfa,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xfb,0xef,0xf7,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xfa,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf9,0xef,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xff,0xf7,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x09,0xff,0xe0,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x70,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x9f,0xfd,0x10,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf4,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x01,0x8f,0xff,0x60,
+  0x00,0xef,0xf7,0x00,0x00,0x00,0x14,0x8e,0xff,0xe4,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x10,0x00,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xec,0xa6,0x10,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xf8,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,
+  0xfb,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xfb,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xbd,0xef,0xed,0xc9,0x61,0x00,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xa3,0x00,0x00,0x00,0x1a,0xff,0xfb,0x63,0x10,0x13,0x7c,0xff,0xff,0x10,0x00,0x01,0xdf,0xfd,0x40,0x00,0x00,0x00,0x00,0x4d,
+  0xf8,0x00,0x00,0x0c,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x8f,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0d,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,
+  0xff,0x80,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xff,0xff,0xff,0x80,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x08,
+  0xff,0x80,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x80,0x08,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x08,
+  0xff,0x80,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x80,0x00,0x8f,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x08,
+  0xff,0x80,0x00,0x0b,0xff,0xd2,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x80,0x00,0x01,0xdf,0xfd,0x40,0x00,0x00,0x00,0x00,0x3c,
+  0xff,0x80,0x00,0x00,0x1a,0xff,0xfb,0x63,0x10,0x13,0x6b,0xff,0xff,0x80,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xd7,0x10,0x00,0x00,0x00,0x00,0x48,0xcd,0xef,0xee,0xca,0x73,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,
+  0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0x60,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,
+  0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x60,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,
+  0x60,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,
+  0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,
+  0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,0x10,0x5f,0xff,
+  0x10,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,
+  0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0xef,0xf6,0x00,0x00,0x00,0x01,0xff,0xf4,0x00,0x00,
+  0x00,0x03,0xff,0xf1,0x00,0x00,0x00,0x09,0xff,0xa0,0x00,0x00,0x00,0x3f,0xff,0x40,0x23,0x10,0x27,0xef,0xf8,0x00,0xcf,0xff,
+  0xff,0xff,0x70,0x00,0xad,0xef,0xec,0x82,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x07,0xef,0xf5,0x00,0x9f,0xfc,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xff,0x60,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x05,0xff,0xf7,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,
+  0x00,0x3e,0xff,0x90,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x02,0xef,0xfa,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x1d,0xff,
+  0xb0,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x01,0xcf,0xfc,0x10,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x0a,0xff,0xd2,0x00,0x00,
+  0x00,0x00,0x9f,0xfc,0x00,0x00,0x9f,0xfe,0x20,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x07,0xff,0xe3,0x00,0x00,0x00,0x00,0x00,
+  0x9f,0xfc,0x01,0x7f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xff,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,
+  0xff,0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x4e,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x03,
+  0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x5f,0xff,0x80,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x08,0xff,
+  0xf5,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0xaf,0xff,0x30,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x1c,0xff,0xe2,
+  0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x02,0xef,0xfc,0x10,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x3f,0xff,0xa0,0x00,
+  0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x05,0xff,0xf8,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x50,0x00,0x9f,
+  0xfc,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xe3,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xfd,0x20,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0xef,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x40,0xef,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0x20,0xef,0xff,0x40,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x20,0xef,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0x20,0xef,
+  0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xff,0x20,0xef,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,
+  0xff,0xff,0x20,0xef,0xeb,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xdd,0xff,0x20,0xef,0xf3,0xff,0xe1,0x00,0x00,0x00,
+  0x00,0x00,0x0c,0xff,0x6d,0xff,0x20,0xef,0xf0,0x9f,0xf9,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x0d,0xff,0x20,0xef,0xf0,0x1e,
+  0xff,0x30,0x00,0x00,0x00,0x00,0xdf,0xf4,0x0d,0xff,0x20,0xef,0xf0,0x07,0xff,0xb0,0x00,0x00,0x00,0x07,0xff,0xb0,0x0d,0xff,
+  0x20,0xef,0xf0,0x01,0xdf,0xf4,0x00,0x00,0x00,0x1e,0xff,0x30,0x0d,0xff,0x20,0xef,0xf0,0x00,0x6f,0xfd,0x00,0x00,0x00,0x8f,
+  0xf9,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,0x0c,0xff,0x60,0x00,0x02,0xff,0xf2,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,0x04,0xff,
+  0xe1,0x00,0x0a,0xff,0x80,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,0x00,0xbf,0xf8,0x00,0x3f,0xfe,0x10,0x00,0x0d,0xff,0x20,0xef,
+  0xf0,0x00,0x00,0x2f,0xff,0x20,0xbf,0xf7,0x00,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,0x00,0x09,0xff,0x94,0xff,0xd0,0x00,0x00,
+  0x0d,0xff,0x20,0xef,0xf0,0x00,0x00,0x01,0xef,0xfc,0xff,0x50,0x00,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,0x00,0x00,0x7f,0xff,
+  0xfc,0x00,0x00,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,0x00,0x00,0x0d,0xff,0xf4,0x00,0x00,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,
+  0x00,0x00,0x05,0xff,0xa0,0x00,0x00,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,0x00,0x00,0x00,0x45,0x10,0x00,0x00,0x00,0x0d,0xff,
+  0x20,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0d,0xff,0x20,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x20,0xef,0xc1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xff,0x70,0x00,0x00,0x00,0x00,
+  0x00,0x09,0xff,0x60,0xef,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x09,
+  0xff,0x60,0xef,0xfe,0xff,0xb0,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf4,0xff,0xf8,0x00,0x00,0x00,0x00,0x09,0xff,0x60,
+  0xef,0xf0,0x8f,0xff,0x40,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x0b,0xff,0xe2,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,
+  0x01,0xdf,0xfc,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x3f,0xff,0x90,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x07,
+  0xff,0xf5,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0xaf,0xfe,0x30,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x1d,0xff,
+  0xd1,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x03,0xef,0xfa,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x6f,0xff,0x70,
+  0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x09,0xff,0xf3,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0xcf,0xfd,0x19,0xff,
+  0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x2e,0xff,0xb9,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x05,0xff,0xfe,0xff,0x60,0xef,
+  0xf0,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0x60,0xef,0xf0,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x06,0xef,0x60,0x00,0x00,0x00,0x00,0x48,0xcd,0xee,0xdb,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,
+  0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x26,0xbf,0xff,0xa1,0x00,0x00,0x00,0x01,0xcf,
+  0xfc,0x30,0x00,0x00,0x00,0x04,0xdf,0xfc,0x10,0x00,0x00,0x0b,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xa0,0x00,0x00,
+  0x7f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf6,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfe,
+  0x10,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x60,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0a,0xff,0xb0,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf1,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x04,0xff,0xf3,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf4,0x6f,0xff,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0xff,0xf5,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf4,0x3f,0xff,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf1,0x0c,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x60,
+  0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfe,0x10,0x00,0x8f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,
+  0xf7,0x00,0x00,0x0c,0xff,0xb1,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xb0,0x00,0x00,0x01,0xdf,0xfc,0x30,0x00,0x00,0x00,0x03,
+  0xdf,0xfc,0x10,0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x25,0xaf,0xff,0xa1,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,
+  0xff,0xff,0xc5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,0xee,0xdc,0x84,0x00,0x00,0x00,0x00,0x9f,0xff,0xff,0xff,0xed,
+  0xb8,0x40,0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xff,0xfc,0x30,0x00,0x9f,0xfc,0x00,0x00,0x12,0x6d,0xff,0xf5,0x00,0x9f,0xfc,
+  0x00,0x00,0x00,0x01,0xaf,0xfe,0x20,0x9f,0xfc,0x00,0x00,0x00,0x00,0x1e,0xff,0x90,0x9f,0xfc,0x00,0x00,0x00,0x00,0x08,0xff,
+  0xd0,0x9f,0xfc,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x9f,0xfc,0x00,0x00,0x00,0x00,0x04,0xff,0xf2,0x9f,0xfc,0x00,0x00,0x00,
+  0x00,0x05,0xff,0xf1,0x9f,0xfc,0x00,0x00,0x00,0x00,0x09,0xff,0xd0,0x9f,0xfc,0x00,0x00,0x00,0x00,0x2e,0xff,0x70,0x9f,0xfc,
+  0x00,0x00,0x00,0x01,0xcf,0xfd,0x10,0x9f,0xfc,0x00,0x00,0x13,0x7e,0xff,0xe3,0x00,0x9f,0xff,0xff,0xff,0xff,0xff,0xfa,0x20,
+  0x00,0x9f,0xff,0xff,0xff,0xed,0xb8,0x20,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,0xee,0xdb,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,
+  0xff,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x26,0xbf,0xff,0x90,0x00,0x00,0x00,0x00,0x01,
+  0xcf,0xfc,0x30,0x00,0x00,0x00,0x04,0xdf,0xfb,0x00,0x00,0x00,0x00,0x0b,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0x90,
+  0x00,0x00,0x00,0x7f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf5,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x7f,0xfd,0x00,0x00,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x50,0x00,0x0c,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xa0,0x00,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xe0,0x00,
+  0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf2,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x03,0xff,0xf3,0x00,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf5,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x03,0xff,0xf5,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf4,0x00,0x1f,0xff,
+  0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf2,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,
+  0xe0,0x00,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x90,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x7f,0xff,0x30,0x00,0x00,0x8f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xfb,0x00,0x00,0x00,0x0c,0xff,0xb1,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xf3,0x00,0x00,0x00,0x01,0xdf,0xfc,0x30,0x00,0x00,0x00,0x03,0xdf,0xff,0x60,0x00,0x00,
+  0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x25,0xaf,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,0xef,0xed,0xac,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xcf,0xfd,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xd2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xfd,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,
+  0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xbe,0xfd,0x20,0x9f,0xff,0xff,0xff,0xed,0xb8,0x30,0x00,
+  0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xff,0xfb,0x20,0x00,0x00,0x9f,0xfc,0x00,0x00,0x13,0x7e,0xff,0xe3,0x00,0x00,0x9f,0xfc,
+  0x00,0x00,0x00,0x01,0xcf,0xfd,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x2f,0xff,0x50,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,
+  0x0c,0xff,0x80,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x0a,0xff,0xa0,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x0b,0xff,0x90,0x00,
+  0x9f,0xfc,0x00,0x00,0x00,0x00,0x0e,0xff,0x60,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x5f,0xfe,0x10,0x00,0x9f,0xfc,0x00,0x00,
+  0x00,0x04,0xef,0xf7,0x00,0x00,0x9f,0xfc,0x00,0x00,0x14,0x9f,0xff,0x90,0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xff,0xd5,0x00,
+  0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xd4,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x05,0xff,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfc,
+  0x00,0x00,0x7f,0xff,0x30,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x0c,0xff,0xd1,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x02,0xef,
+  0xf9,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x6f,0xff,0x50,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x0b,0xff,0xe2,0x00,0x00,
+  0x9f,0xfc,0x00,0x00,0x00,0x02,0xef,0xfb,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x5f,0xff,0x70,0x00,0x9f,0xfc,0x00,0x00,
+  0x00,0x00,0x0a,0xff,0xf3,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x01,0xef,0xfc,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x4d,
+  0xff,0x90,0x00,0x00,0x05,0xad,0xfe,0xeb,0x83,0x00,0x00,0x00,0x03,0xdf,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x3f,0xfe,0x72,
+  0x01,0x38,0xef,0xf6,0x00,0x01,0xdf,0xe3,0x00,0x00,0x00,0x2b,0xc0,0x00,0x06,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0b,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xe8,0x20,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0xff,
+  0xfc,0x61,0x00,0x00,0x00,0x00,0x3e,0xff,0xff,0xff,0xfe,0x92,0x00,0x00,0x00,0x02,0xaf,0xff,0xff,0xff,0xfe,0x40,0x00,0x00,
+  0x00,0x02,0x8d,0xff,0xff,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x38,0xef,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xff,
+  0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0e,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xfd,0x00,0x08,0x40,0x00,0x00,0x00,0x00,0x6f,0xf8,0x00,0x6f,
+  0xf8,0x00,0x00,0x00,0x03,0xef,0xe1,0x00,0xbf,0xff,0xd7,0x21,0x13,0x8e,0xfe,0x40,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0xd3,
+  0x00,0x00,0x00,0x05,0x9c,0xef,0xed,0xa5,0x00,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x20,0x8f,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,
+  0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,
+  0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,
+  0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x2f,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xff,0xb0,0x1f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xa0,0x0e,0xff,0x50,0x00,0x00,0x00,0x00,
+  0x00,0x0c,0xff,0x70,0x0a,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x30,0x04,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x7f,
+  0xfc,0x00,0x00,0xbf,0xf9,0x00,0x00,0x00,0x00,0x02,0xef,0xf5,0x00,0x00,0x2e,0xff,0x80,0x00,0x00,0x00,0x2d,0xff,0x90,0x00,
+  0x00,0x03,0xef,0xfc,0x62,0x01,0x38,0xef,0xfa,0x00,0x00,0x00,0x00,0x2a,0xff,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x00,0x00,
+  0x00,0x38,0xcd,0xfe,0xda,0x61,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xf7,0x4f,0xff,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xe1,0x0d,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0x90,0x06,0xff,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x30,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xfc,0x00,0x00,0x9f,0xfd,
+  0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf6,0x00,0x00,0x3f,0xff,0x40,0x00,0x00,0x00,0x00,0x08,0xff,0xe1,0x00,0x00,0x0c,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x0e,0xff,0x90,0x00,0x00,0x06,0xff,0xf2,0x00,0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x01,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0xbf,0xfb,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x02,0xff,0xf5,0x00,0x00,0x00,0x00,0x2f,
+  0xff,0x40,0x00,0x00,0x08,0xff,0xe0,0x00,0x00,0x00,0x00,0x0b,0xff,0xa0,0x00,0x00,0x0d,0xff,0x80,0x00,0x00,0x00,0x00,0x05,
+  0xff,0xf2,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0xbf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x8f,0xfd,0x00,0x02,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x40,0x08,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0b,0xff,0xa0,0x0d,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf2,0x4f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xdf,0xf7,0xaf,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfb,0xdf,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1f,0xff,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf9,0x00,0x00,0x00,0x00,0x00,0x9f,0xfd,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x7f,0xe5,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xf4,0x4f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xfc,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xe0,0x0e,0xff,0xb0,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x20,0x00,0x00,0x00,0x00,
+  0x0d,0xff,0x90,0x0a,0xff,0xf1,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x3f,0xff,0x50,0x05,0xff,0xf5,
+  0x00,0x00,0x00,0x00,0x0e,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x7f,0xfe,0x10,0x01,0xff,0xf9,0x00,0x00,0x00,0x00,0x4f,0xfb,
+  0xff,0xf2,0x00,0x00,0x00,0x00,0xcf,0xfa,0x00,0x00,0xbf,0xfe,0x00,0x00,0x00,0x00,0xaf,0xf6,0xaf,0xf7,0x00,0x00,0x00,0x01,
+  0xff,0xf6,0x00,0x00,0x6f,0xff,0x30,0x00,0x00,0x00,0xef,0xf1,0x5f,0xfc,0x00,0x00,0x00,0x06,0xff,0xf1,0x00,0x00,0x2f,0xff,
+  0x80,0x00,0x00,0x05,0xff,0xb0,0x1f,0xff,0x20,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0a,0xff,0x50,
+  0x0a,0xff,0x70,0x00,0x00,0x0e,0xff,0x60,0x00,0x00,0x07,0xff,0xf1,0x00,0x00,0x1e,0xff,0x10,0x05,0xff,0xd0,0x00,0x00,0x4f,
+  0xff,0x20,0x00,0x00,0x02,0xff,0xf6,0x00,0x00,0x5f,0xfa,0x00,0x01,0xff,0xf3,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0xdf,
+  0xfa,0x00,0x00,0xaf,0xf5,0x00,0x00,0xaf,0xf8,0x00,0x00,0xdf,0xf7,0x00,0x00,0x00,0x00,0x8f,0xfe,0x00,0x01,0xef,0xe1,0x00,
+  0x00,0x5f,0xfd,0x00,0x02,0xff,0xf3,0x00,0x00,0x00,0x00,0x3f,0xff,0x40,0x05,0xff,0xa0,0x00,0x00,0x1e,0xff,0x30,0x07,0xff,
+  0xd0,0x00,0x00,0x00,0x00,0x0e,0xff,0x90,0x0a,0xff,0x50,0x00,0x00,0x0a,0xff,0x80,0x0b,0xff,0x80,0x00,0x00,0x00,0x00,0x09,
+  0xff,0xd0,0x1f,0xfe,0x10,0x00,0x00,0x05,0xff,0xd0,0x1f,0xff,0x40,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x5f,0xfa,0x00,0x00,
+  0x00,0x01,0xef,0xf3,0x5f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0xaf,0xf5,0x00,0x00,0x00,0x00,0xaf,0xf8,0xaf,0xf9,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfa,0xef,0xe0,0x00,0x00,0x00,0x00,0x5f,0xfc,0xdf,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x5f,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x0e,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0x40,0x00,0x00,
+  0x00,0x00,0x0a,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x50,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x2e,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x02,
+  0xdf,0xf9,0x00,0x06,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xd1,0x00,0x00,0xbf,0xff,0x30,0x00,0x00,0x00,0x00,0x6f,
+  0xff,0x40,0x00,0x00,0x2e,0xff,0xc0,0x00,0x00,0x00,0x02,0xef,0xf8,0x00,0x00,0x00,0x06,0xff,0xf7,0x00,0x00,0x00,0x0b,0xff,
+  0xd0,0x00,0x00,0x00,0x00,0xbf,0xfe,0x20,0x00,0x00,0x6f,0xff,0x30,0x00,0x00,0x00,0x00,0x2e,0xff,0xb0,0x00,0x02,0xef,0xf7,
+  0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf6,0x00,0x0b,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfe,0x20,0x6f,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xb2,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xfd,0xff,0xb0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xfd,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xd6,0xff,0xf3,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x40,0xbf,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xf8,0x00,0x2f,0xff,0x80,
+  0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xd1,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x40,0x00,0x00,0xcf,0xfd,
+  0x00,0x00,0x00,0x00,0x01,0xef,0xf8,0x00,0x00,0x00,0x3f,0xff,0x80,0x00,0x00,0x00,0x0a,0xff,0xd1,0x00,0x00,0x00,0x08,0xff,
+  0xf3,0x00,0x00,0x00,0x6f,0xff,0x40,0x00,0x00,0x00,0x01,0xdf,0xfd,0x00,0x00,0x02,0xef,0xf8,0x00,0x00,0x00,0x00,0x00,0x4f,
+  0xff,0x80,0x00,0x0b,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf3,0x00,0x6f,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x01,
+  0xdf,0xfd,0x10,0x8f,0xfd,0x20,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xf9,0x1e,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,
+  0xe1,0x05,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x60,0x00,0xbf,0xfd,0x00,0x00,0x00,0x00,0x00,0xcf,0xfc,0x00,0x00,
+  0x2f,0xff,0x70,0x00,0x00,0x00,0x06,0xff,0xf3,0x00,0x00,0x08,0xff,0xe1,0x00,0x00,0x00,0x1e,0xff,0x90,0x00,0x00,0x01,0xdf,
+  0xf9,0x00,0x00,0x00,0x8f,0xfe,0x10,0x00,0x00,0x00,0x5f,0xff,0x30,0x00,0x02,0xff,0xf5,0x00,0x00,0x00,0x00,0x0b,0xff,0xc0,
+  0x00,0x0b,0xff,0xb0,0x00,0x00,0x00,0x00,0x02,0xff,0xf6,0x00,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x8f,0xfe,0x10,0xdf,
+  0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0x76,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xdc,0xff,0x50,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xf2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,
+  0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,
+  0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xe2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xef,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,
+  0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfa,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x7f,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,
+  0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1d,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,
+  0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xb0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x05,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,
+  0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,
+  0x8f,0xff,0xff,0xe0,0x8f,0xff,0xff,0xb0,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,
+  0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,
+  0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,
+  0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,
+  0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,0x8f,0xf2,0x00,0x00,
+  0x8f,0xff,0xff,0xb0,0x8f,0xff,0xff,0xe0,0x2f,0xd3,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x05,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xe0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x2f,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf5,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x9f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x06,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xe0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3f,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf5,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0b,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x67,0x00,0x6f,0xff,0xff,0xf0,0x4f,0xff,0xff,0xf0,
+  0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,
+  0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,
+  0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,
+  0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,
+  0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x00,0x00,0x9f,0xf0,0x4e,0xff,0xff,0xf0,0x6f,0xff,0xff,0xf0,
+  0x00,0x00,0x00,0x4f,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xfd,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x60,0x00,0x00,
+  0x00,0x00,0x0d,0xfd,0xcf,0xe1,0x00,0x00,0x00,0x00,0x6f,0xf7,0x5f,0xf7,0x00,0x00,0x00,0x01,0xef,0xe1,0x0b,0xfe,0x10,0x00,
+  0x00,0x08,0xff,0x60,0x03,0xff,0x90,0x00,0x00,0x1e,0xfd,0x00,0x00,0xaf,0xf2,0x00,0x00,0x9f,0xf5,0x00,0x00,0x2f,0xfa,0x00,
+  0x02,0xff,0xc0,0x00,0x00,0x09,0xff,0x30,0x0a,0xff,0x40,0x00,0x00,0x01,0xef,0xb0,0x17,0x85,0x00,0x00,0x00,0x00,0x37,0x81,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x1c,0xff,0xb0,0x00,0x01,0xdf,0xf7,0x00,0x00,0x2e,
+  0xfe,0x20,0x00,0x03,0xef,0xa0,0x00,0x00,0x4e,0xf5,0x00,0x00,0x59,0xde,0xfd,0xa4,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,
+  0x80,0x00,0x05,0xff,0xf9,0x31,0x15,0xdf,0xf6,0x00,0x00,0xcc,0x30,0x00,0x00,0x3f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x0b,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x07,
+  0xff,0x90,0x00,0x00,0x04,0x8a,0xde,0xef,0xff,0x90,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0x90,0x02,0xdf,0xfe,0x95,0x31,0x17,
+  0xff,0x90,0x0c,0xff,0x91,0x00,0x00,0x07,0xff,0x90,0x4f,0xfc,0x00,0x00,0x00,0x07,0xff,0x90,0x5f,0xfa,0x00,0x00,0x00,0x08,
+  0xff,0x90,0x4f,0xfd,0x00,0x00,0x00,0x7f,0xff,0x90,0x0e,0xff,0xa2,0x02,0x5c,0xfd,0xff,0x90,0x04,0xff,0xff,0xff,0xfe,0x71,
+  0xff,0x90,0x00,0x3a,0xef,0xec,0x82,0x00,0xbf,0x90,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x6b,0xdf,0xeb,0x50,0x00,0x00,0x5f,0xfc,0x3d,0xff,0xff,
+  0xff,0xfa,0x00,0x00,0x5f,0xfe,0xfe,0x72,0x02,0x7e,0xff,0x90,0x00,0x5f,0xff,0xd2,0x00,0x00,0x04,0xff,0xf3,0x00,0x5f,0xfe,
+  0x20,0x00,0x00,0x00,0xaf,0xf9,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x5f,0xfe,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x2f,0xff,
+  0x20,0x5f,0xfc,0x00,0x00,0x00,0x00,0x0f,0xff,0x30,0x5f,0xfc,0x00,0x00,0x00,0x00,0x0e,0xff,0x40,0x5f,0xfc,0x00,0x00,0x00,
+  0x00,0x0e,0xff,0x40,0x5f,0xfc,0x00,0x00,0x00,0x00,0x0f,0xff,0x30,0x5f,0xfc,0x00,0x00,0x00,0x00,0x3f,0xff,0x10,0x5f,0xfc,
+  0x00,0x00,0x00,0x00,0x7f,0xfb,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0xdf,0xf6,0x00,0x5f,0xff,0x60,0x00,0x00,0x09,0xff,0xc0,
+  0x00,0x5f,0xff,0xf9,0x31,0x14,0xbf,0xfe,0x30,0x00,0x5f,0xf9,0xaf,0xff,0xff,0xff,0xd3,0x00,0x00,0x5f,0xf5,0x05,0xae,0xfe,
+  0xb6,0x10,0x00,0x00,0x00,0x00,0x17,0xbd,0xfe,0xd9,0x40,0x00,0x00,0x06,0xef,0xff,0xff,0xff,0xfb,0x20,0x00,0x7f,0xff,0x83,
+  0x01,0x4b,0xfe,0x20,0x03,0xff,0xf4,0x00,0x00,0x00,0x43,0x00,0x0b,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfb,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xe3,0x00,
+  0x00,0x00,0x7a,0x00,0x00,0x8f,0xff,0x82,0x01,0x5c,0xff,0x60,0x00,0x07,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x28,0xce,
+  0xfd,0xb7,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x00,0x39,0xde,
+  0xed,0x92,0x4f,0xfd,0x00,0x08,0xff,0xff,0xff,0xff,0xaf,0xfd,0x00,0x8f,0xfe,0x72,0x01,0x5d,0xff,0xfd,0x04,0xff,0xe3,0x00,
+  0x00,0x01,0xcf,0xfd,0x0c,0xff,0x70,0x00,0x00,0x00,0x4f,0xfd,0x3f,0xff,0x10,0x00,0x00,0x00,0x4f,0xfd,0x7f,0xfb,0x00,0x00,
+  0x00,0x00,0x4f,0xfd,0x9f,0xf9,0x00,0x00,0x00,0x00,0x4f,0xfd,0xaf,0xf8,0x00,0x00,0x00,0x00,0x4f,0xfd,0xbf,0xf7,0x00,0x00,
+  0x00,0x00,0x4f,0xfd,0xaf,0xf8,0x00,0x00,0x00,0x00,0x4f,0xfd,0x8f,0xfa,0x00,0x00,0x00,0x00,0x4f,0xfd,0x5f,0xfd,0x00,0x00,
+  0x00,0x00,0x4f,0xfd,0x1f,0xff,0x30,0x00,0x00,0x00,0x8f,0xfd,0x0a,0xff,0xb0,0x00,0x00,0x06,0xff,0xfd,0x02,0xef,0xfb,0x41,
+  0x14,0xaf,0xcf,0xfd,0x00,0x3e,0xff,0xff,0xff,0xf9,0x0e,0xfd,0x00,0x01,0x8c,0xee,0xd9,0x30,0x0a,0xfd,0x00,0x00,0x17,0xbe,
+  0xfe,0xb7,0x10,0x00,0x00,0x06,0xef,0xff,0xff,0xff,0xe4,0x00,0x00,0x7f,0xfe,0x62,0x01,0x6d,0xff,0x30,0x04,0xff,0xd2,0x00,
+  0x00,0x02,0xef,0xd0,0x0c,0xff,0x40,0x00,0x00,0x00,0x6f,0xf5,0x3f,0xfd,0x00,0x00,0x00,0x00,0x1f,0xfa,0x7f,0xf9,0x00,0x00,
+  0x00,0x00,0x0e,0xfc,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xaf,0xf6,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x8f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xfe,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x0a,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xf4,0x00,0x00,0x00,0x07,0xa0,0x00,0x5f,0xff,0x93,
+  0x10,0x27,0xdf,0xf7,0x00,0x04,0xef,0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x16,0xbd,0xfe,0xda,0x71,0x00,0x00,0x00,0x01,0x7c,
+  0xef,0xe6,0x00,0x00,0x3e,0xff,0xff,0xf7,0x00,0x01,0xdf,0xfa,0x31,0x00,0x00,0x06,0xff,0xb0,0x00,0x00,0x00,0x0a,0xff,0x60,
+  0x00,0x00,0x00,0x0b,0xff,0x40,0x00,0x00,0x00,0x0b,0xff,0x40,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xf6,0x6f,0xff,0xff,0xff,
+  0xff,0xf6,0x01,0x2c,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,
+  0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,
+  0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,
+  0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,0x00,0x00,0x00,0x0b,0xff,0x60,
+  0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xc7,0x32,0x22,0x21,0x00,0x05,0xef,0xff,0xff,0xff,0xff,0xff,0xf5,0x00,0x4f,0xfe,0x72,
+  0x12,0x7e,0xff,0xfd,0xb2,0x00,0xcf,0xf4,0x00,0x00,0x04,0xff,0xc0,0x00,0x01,0xff,0xd0,0x00,0x00,0x00,0xcf,0xf1,0x00,0x03,
+  0xff,0xb0,0x00,0x00,0x00,0xaf,0xf2,0x00,0x01,0xff,0xd0,0x00,0x00,0x00,0xcf,0xf1,0x00,0x00,0xcf,0xf5,0x00,0x00,0x03,0xff,
+  0xb0,0x00,0x00,0x3f,0xfe,0x72,0x12,0x7e,0xff,0x30,0x00,0x00,0x04,0xef,0xff,0xff,0xff,0xe4,0x00,0x00,0x00,0x03,0xcf,0xce,
+  0xfe,0xc7,0x10,0x00,0x00,0x00,0x2e,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x9f,0xfb,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xff,0xff,0xff,0xfe,0xda,0x50,0x00,0x00,0x08,0xfe,0xdf,0xff,0xff,0xff,
+  0xfc,0x10,0x01,0xbf,0xc1,0x00,0x00,0x13,0x7e,0xff,0x90,0x0a,0xfe,0x10,0x00,0x00,0x00,0x03,0xff,0xd0,0x0f,0xfa,0x00,0x00,
+  0x00,0x00,0x00,0xff,0xd0,0x1f,0xfb,0x00,0x00,0x00,0x00,0x03,0xff,0xa0,0x0d,0xff,0x30,0x00,0x00,0x00,0x1c,0xff,0x30,0x04,
+  0xff,0xf9,0x41,0x01,0x37,0xdf,0xf6,0x00,0x00,0x4d,0xff,0xff,0xff,0xff,0xfd,0x50,0x00,0x00,0x01,0x5a,0xde,0xfe,0xda,0x50,
+  0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x01,0x6b,0xef,0xda,
+  0x30,0x00,0x7f,0xfa,0x4d,0xff,0xff,0xff,0xf6,0x00,0x7f,0xfe,0xfe,0x72,0x02,0x8f,0xff,0x30,0x7f,0xff,0xc2,0x00,0x00,0x09,
+  0xff,0xb0,0x7f,0xfd,0x10,0x00,0x00,0x01,0xff,0xf1,0x7f,0xfa,0x00,0x00,0x00,0x00,0xef,0xf3,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0xcf,0xf4,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x1b,0xeb,0x10,0x9f,0xff,0x90,
+  0x9f,0xff,0x90,0x1b,0xeb,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,
+  0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,
+  0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,
+  0x00,0x01,0xbe,0xb1,0x00,0x09,0xff,0xf9,0x00,0x09,0xff,0xf9,0x00,0x01,0xbe,0xb1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,
+  0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,
+  0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,
+  0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x02,0xff,0xf0,0x00,0x04,0xff,0xd0,0x00,0x3c,0xff,0x70,
+  0xcf,0xff,0xfc,0x10,0xcf,0xec,0x71,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x5f,0xfc,0x00,0x00,0x00,0x08,0xff,0xc1,0x5f,0xfc,0x00,0x00,0x00,0x8f,0xfc,0x10,0x5f,0xfc,0x00,0x00,0x08,0xff,0xd1,0x00,
+  0x5f,0xfc,0x00,0x00,0x7f,0xfd,0x20,0x00,0x5f,0xfc,0x00,0x06,0xff,0xd2,0x00,0x00,0x5f,0xfc,0x00,0x5f,0xfe,0x20,0x00,0x00,
+  0x5f,0xfc,0x05,0xff,0xe3,0x00,0x00,0x00,0x5f,0xff,0xff,0xff,0x30,0x00,0x00,0x00,0x5f,0xff,0xff,0xff,0x80,0x00,0x00,0x00,
+  0x5f,0xfc,0x03,0xef,0xf5,0x00,0x00,0x00,0x5f,0xfc,0x00,0x5f,0xfe,0x20,0x00,0x00,0x5f,0xfc,0x00,0x09,0xff,0xc0,0x00,0x00,
+  0x5f,0xfc,0x00,0x00,0xcf,0xf9,0x00,0x00,0x5f,0xfc,0x00,0x00,0x2e,0xff,0x50,0x00,0x5f,0xfc,0x00,0x00,0x05,0xff,0xe2,0x00,
+  0x5f,0xfc,0x00,0x00,0x00,0x9f,0xfd,0x10,0x5f,0xfc,0x00,0x00,0x00,0x0c,0xff,0xa0,0x5f,0xfc,0x00,0x00,0x00,0x02,0xdf,0xf6,
+  0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,
+  0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,
+  0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,
+  0x1f,0xff,0x00,0x1f,0xff,0x00,0x7f,0xe2,0x03,0x9d,0xfd,0x81,0x00,0x03,0x9d,0xfe,0xb5,0x00,0x00,0x7f,0xf5,0x7f,0xff,0xff,
+  0xfd,0x10,0x8f,0xff,0xff,0xff,0xa0,0x00,0x7f,0xfd,0xfb,0x31,0x28,0xff,0x96,0xfd,0x41,0x15,0xef,0xf8,0x00,0x7f,0xff,0x90,
+  0x00,0x00,0xaf,0xee,0xd1,0x00,0x00,0x3f,0xfe,0x10,0x7f,0xfc,0x00,0x00,0x00,0x4f,0xff,0x60,0x00,0x00,0x0c,0xff,0x50,0x7f,
+  0xfa,0x00,0x00,0x00,0x1f,0xff,0x30,0x00,0x00,0x09,0xff,0x70,0x7f,0xfa,0x00,0x00,0x00,0x0f,0xff,0x10,0x00,0x00,0x08,0xff,
+  0x80,0x7f,0xfa,0x00,0x00,0x00,0x0f,0xff,0x10,0x00,0x00,0x08,0xff,0x90,0x7f,0xfa,0x00,0x00,0x00,0x0f,0xff,0x10,0x00,0x00,
+  0x08,0xff,0x90,0x7f,0xfa,0x00,0x00,0x00,0x0f,0xff,0x10,0x00,0x00,0x08,0xff,0x90,0x7f,0xfa,0x00,0x00,0x00,0x0f,0xff,0x10,
+  0x00,0x00,0x08,0xff,0x90,0x7f,0xfa,0x00,0x00,0x00,0x0f,0xff,0x10,0x00,0x00,0x08,0xff,0x90,0x7f,0xfa,0x00,0x00,0x00,0x0f,
+  0xff,0x10,0x00,0x00,0x08,0xff,0x90,0x7f,0xfa,0x00,0x00,0x00,0x0f,0xff,0x10,0x00,0x00,0x08,0xff,0x90,0x7f,0xfa,0x00,0x00,
+  0x00,0x0f,0xff,0x10,0x00,0x00,0x08,0xff,0x90,0x7f,0xfa,0x00,0x00,0x00,0x0f,0xff,0x10,0x00,0x00,0x08,0xff,0x90,0x7f,0xfa,
+  0x00,0x00,0x00,0x0f,0xff,0x10,0x00,0x00,0x08,0xff,0x90,0x7f,0xfa,0x00,0x00,0x00,0x0f,0xff,0x10,0x00,0x00,0x08,0xff,0x90,
+  0x7f,0xe2,0x01,0x6b,0xef,0xda,0x30,0x00,0x7f,0xf5,0x4d,0xff,0xff,0xff,0xf6,0x00,0x7f,0xfc,0xfe,0x72,0x02,0x8f,0xff,0x30,
+  0x7f,0xff,0xc2,0x00,0x00,0x09,0xff,0xb0,0x7f,0xfd,0x10,0x00,0x00,0x01,0xff,0xf1,0x7f,0xfa,0x00,0x00,0x00,0x00,0xef,0xf3,
+  0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf4,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,
+  0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,
+  0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,
+  0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,
+  0x00,0x00,0x16,0xbd,0xfe,0xc9,0x30,0x00,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x7f,0xfe,0x72,0x01,0x4c,
+  0xff,0xc1,0x00,0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x0c,0xff,0x60,0x00,0x00,0x00,0x1e,0xff,0x30,0x3f,0xfe,0x10,
+  0x00,0x00,0x00,0x09,0xff,0x90,0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x9f,0xf9,0x00,0x00,0x00,0x00,0x02,0xff,0xf1,
+  0xaf,0xf8,0x00,0x00,0x00,0x00,0x01,0xff,0xf2,0xaf,0xf8,0x00,0x00,0x00,0x00,0x01,0xff,0xf2,0x9f,0xf9,0x00,0x00,0x00,0x00,
+  0x02,0xff,0xf1,0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x3f,0xfe,0x00,0x00,0x00,0x00,0x09,0xff,0x90,0x0c,0xff,0x60,
+  0x00,0x00,0x00,0x1e,0xff,0x30,0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x00,0x7f,0xfe,0x72,0x01,0x4b,0xff,0xd1,0x00,
+  0x00,0x05,0xef,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x00,0x17,0xbe,0xfe,0xd9,0x30,0x00,0x00,0x7f,0xe2,0x01,0x6b,0xef,0xda,
+  0x40,0x00,0x00,0x7f,0xf6,0x4d,0xff,0xff,0xff,0xf8,0x00,0x00,0x7f,0xfc,0xfd,0x62,0x02,0x8f,0xff,0x70,0x00,0x7f,0xff,0xc1,
+  0x00,0x00,0x05,0xff,0xf2,0x00,0x7f,0xfd,0x10,0x00,0x00,0x00,0xcf,0xf7,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x6f,0xfc,0x00,
+  0x7f,0xfa,0x00,0x00,0x00,0x00,0x3f,0xff,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x1f,0xff,0x20,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0x1f,0xff,0x20,0x7f,0xfa,0x00,0x00,0x00,0x00,0x1f,0xff,0x20,0x7f,0xfa,0x00,0x00,0x00,0x00,0x2f,0xff,0x10,0x7f,0xfa,0x00,
+  0x00,0x00,0x00,0x4f,0xfd,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x9f,0xfa,0x00,0x7f,0xfa,0x00,0x00,0x00,0x01,0xef,0xf4,0x00,
+  0x7f,0xff,0x40,0x00,0x00,0x0a,0xff,0xb0,0x00,0x7f,0xff,0xf8,0x31,0x14,0xcf,0xfd,0x20,0x00,0x7f,0xfc,0xdf,0xff,0xff,0xff,
+  0xc2,0x00,0x00,0x7f,0xfa,0x17,0xbe,0xfe,0xb6,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xde,0xed,0x92,
+  0x0a,0xfd,0x00,0x08,0xff,0xff,0xff,0xff,0x7e,0xfd,0x00,0x8f,0xfe,0x72,0x01,0x6d,0xff,0xfd,0x04,0xff,0xe3,0x00,0x00,0x01,
+  0xcf,0xfd,0x0c,0xff,0x70,0x00,0x00,0x00,0x4f,0xfd,0x3f,0xff,0x10,0x00,0x00,0x00,0x4f,0xfd,0x7f,0xfb,0x00,0x00,0x00,0x00,
+  0x4f,0xfd,0x9f,0xf9,0x00,0x00,0x00,0x00,0x4f,0xfd,0xaf,0xf8,0x00,0x00,0x00,0x00,0x4f,0xfd,0xbf,0xf7,0x00,0x00,0x00,0x00,
+  0x4f,0xfd,0xaf,0xf8,0x00,0x00,0x00,0x00,0x4f,0xfd,0x8f,0xfa,0x00,0x00,0x00,0x00,0x4f,0xfd,0x5f,0xfd,0x00,0x00,0x00,0x00,
+  0x4f,0xfd,0x1f,0xff,0x30,0x00,0x00,0x00,0x8f,0xfd,0x0a,0xff,0xb0,0x00,0x00,0x06,0xff,0xfd,0x02,0xef,0xfb,0x41,0x14,0xaf,
+  0xef,0xfd,0x00,0x3e,0xff,0xff,0xff,0xf9,0x4f,0xfd,0x00,0x01,0x8c,0xee,0xd9,0x30,0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xfd,0x7f,0xf3,0x01,0x8c,0xee,0xd3,
+  0x7f,0xf6,0x3e,0xff,0xff,0xf1,0x7f,0xf9,0xee,0x61,0x02,0x40,0x7f,0xff,0xe3,0x00,0x00,0x00,0x7f,0xff,0x60,0x00,0x00,0x00,
+  0x7f,0xfd,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0x7f,0xfa,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0x7f,0xfa,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x04,0xad,0xfe,0xda,0x40,0x00,0x00,0xaf,0xff,0xff,0xff,0xfc,0x20,0x09,0xff,0xb4,0x11,
+  0x49,0xfd,0x10,0x2f,0xfd,0x00,0x00,0x00,0x22,0x00,0x6f,0xf9,0x00,0x00,0x00,0x00,0x00,0x6f,0xfc,0x00,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0xc4,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xd8,0x30,0x00,0x00,0x01,0xbf,0xff,0xff,0xfc,0x40,0x00,0x00,0x04,0xaf,
+  0xff,0xff,0xf9,0x00,0x00,0x00,0x01,0x5b,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x3d,0xff,0x90,0x00,0x00,0x00,0x00,0x05,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x05,0xff,0x80,0x18,0x30,0x00,0x00,0x0a,0xff,0x40,0x9f,0xfa,0x41,0x13,0xaf,0xfa,0x00,0x5e,0xff,
+  0xff,0xff,0xff,0xa1,0x00,0x01,0x6a,0xde,0xfd,0xa4,0x00,0x00,0x00,0x00,0x7f,0xa0,0x00,0x00,0x00,0x00,0x00,0xbf,0xa0,0x00,
+  0x00,0x00,0x00,0x00,0xdf,0xa0,0x00,0x00,0x00,0x00,0x00,0xff,0xa0,0x00,0x00,0x00,0x00,0x02,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x04,0xff,0xa0,0x00,0x00,0x00,0x2c,0xef,0xff,0xff,0xff,0xfc,0x00,0x2f,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0x07,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x07,0xff,0xa0,0x00,0x00,0x00,0x00,0x07,0xff,0xa0,0x00,0x00,0x00,0x00,0x07,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x07,0xff,0xa0,0x00,0x00,0x00,0x00,0x07,0xff,0xa0,0x00,0x00,0x00,0x00,0x07,0xff,0xa0,0x00,0x00,0x00,0x00,0x07,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x07,0xff,0xa0,0x00,0x00,0x00,0x00,0x07,0xff,0xa0,0x00,0x00,0x00,0x00,0x07,0xff,0xa0,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xa0,0x00,0x00,0x00,0x00,0x05,0xff,0xc0,0x00,0x00,0x00,0x00,0x01,0xff,0xf6,0x13,0xa5,0x00,0x00,0x00,
+  0x8f,0xff,0xff,0xfe,0x10,0x00,0x00,0x06,0xcf,0xed,0x93,0x00,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,
+  0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,
+  0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,
+  0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,
+  0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xcf,0xf5,0x00,0x00,0x00,0x04,0xff,0xd0,0x9f,0xf8,0x00,0x00,
+  0x00,0x05,0xff,0xd0,0x4f,0xfe,0x10,0x00,0x00,0x5e,0xff,0xd0,0x0c,0xff,0xc4,0x11,0x4a,0xfe,0xff,0xd0,0x02,0xdf,0xff,0xff,
+  0xff,0xb1,0xef,0xd0,0x00,0x17,0xce,0xed,0x94,0x00,0xaf,0xd0,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x9f,0xf6,0x2f,0xff,0x20,
+  0x00,0x00,0x00,0x02,0xff,0xe1,0x0a,0xff,0x80,0x00,0x00,0x00,0x07,0xff,0x90,0x04,0xff,0xe0,0x00,0x00,0x00,0x0d,0xff,0x30,
+  0x00,0xdf,0xf5,0x00,0x00,0x00,0x4f,0xfc,0x00,0x00,0x7f,0xfb,0x00,0x00,0x00,0xaf,0xf6,0x00,0x00,0x1f,0xff,0x20,0x00,0x01,
+  0xff,0xe1,0x00,0x00,0x0a,0xff,0x70,0x00,0x07,0xff,0x90,0x00,0x00,0x04,0xff,0xd0,0x00,0x0d,0xff,0x30,0x00,0x00,0x00,0xdf,
+  0xf4,0x00,0x4f,0xfc,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x9f,0xf6,0x00,0x00,0x00,0x00,0x1f,0xfe,0x11,0xef,0xe1,0x00,0x00,
+  0x00,0x00,0x0a,0xff,0x66,0xff,0x90,0x00,0x00,0x00,0x00,0x04,0xff,0xaa,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0xdf,0xee,0xfb,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0a,0xff,0x80,0x00,0x00,0x00,0x9f,0xf7,0x00,0x00,0x00,0x01,0xdf,0xd1,0x00,0x00,0x00,0x08,0xff,0x60,0x4f,0xfd,0x00,0x00,
+  0x00,0x05,0xff,0xf5,0x00,0x00,0x00,0x0e,0xff,0x20,0x0e,0xff,0x30,0x00,0x00,0x0a,0xff,0xfa,0x00,0x00,0x00,0x3f,0xfc,0x00,
+  0x0a,0xff,0x70,0x00,0x00,0x0e,0xff,0xfe,0x00,0x00,0x00,0x8f,0xf7,0x00,0x05,0xff,0xc0,0x00,0x00,0x4f,0xfa,0xff,0x40,0x00,
+  0x00,0xcf,0xf2,0x00,0x01,0xef,0xf1,0x00,0x00,0x9f,0xe2,0xff,0x90,0x00,0x02,0xff,0xc0,0x00,0x00,0xaf,0xf5,0x00,0x00,0xef,
+  0xa0,0xcf,0xd0,0x00,0x06,0xff,0x80,0x00,0x00,0x5f,0xfa,0x00,0x04,0xff,0x50,0x7f,0xf3,0x00,0x0b,0xff,0x30,0x00,0x00,0x1f,
+  0xfe,0x00,0x09,0xfe,0x10,0x2f,0xf8,0x00,0x1f,0xfd,0x00,0x00,0x00,0x0b,0xff,0x30,0x0d,0xfa,0x00,0x0c,0xfc,0x00,0x5f,0xf8,
+  0x00,0x00,0x00,0x06,0xff,0x80,0x3f,0xf5,0x00,0x08,0xff,0x20,0x9f,0xf3,0x00,0x00,0x00,0x01,0xff,0xc0,0x8f,0xe1,0x00,0x03,
+  0xff,0x70,0xef,0xe0,0x00,0x00,0x00,0x00,0xcf,0xf1,0xdf,0xa0,0x00,0x00,0xdf,0xb3,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xf7,
+  0xff,0x50,0x00,0x00,0x8f,0xf7,0xff,0x40,0x00,0x00,0x00,0x00,0x2f,0xfd,0xfe,0x10,0x00,0x00,0x3f,0xfd,0xfe,0x00,0x00,0x00,
+  0x00,0x00,0x0c,0xff,0xfa,0x00,0x00,0x00,0x0d,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf5,0x00,0x00,0x00,0x08,0xff,
+  0xf5,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xd1,0x00,0x00,0x00,0x03,0xff,0xe1,0x00,0x00,0x00,0x1d,0xff,0x80,0x00,0x00,0x00,
+  0x0a,0xff,0x80,0x04,0xff,0xf4,0x00,0x00,0x00,0x6f,0xfc,0x00,0x00,0x9f,0xfd,0x00,0x00,0x02,0xef,0xf3,0x00,0x00,0x1d,0xff,
+  0x70,0x00,0x0b,0xff,0x70,0x00,0x00,0x04,0xff,0xf2,0x00,0x6f,0xfc,0x00,0x00,0x00,0x00,0x9f,0xfb,0x01,0xef,0xf2,0x00,0x00,
+  0x00,0x00,0x1d,0xff,0x6a,0xff,0x70,0x00,0x00,0x00,0x00,0x04,0xff,0xef,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xf2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xcf,0xfe,0x20,0x00,0x00,0x00,0x00,0x2e,
+  0xff,0x39,0xff,0xb0,0x00,0x00,0x00,0x00,0xbf,0xf8,0x01,0xdf,0xf6,0x00,0x00,0x00,0x07,0xff,0xc0,0x00,0x5f,0xfe,0x20,0x00,
+  0x00,0x2e,0xff,0x30,0x00,0x0a,0xff,0xb0,0x00,0x00,0xcf,0xf7,0x00,0x00,0x01,0xef,0xf6,0x00,0x07,0xff,0xc0,0x00,0x00,0x00,
+  0x6f,0xfe,0x20,0x3f,0xfd,0x20,0x00,0x00,0x00,0x0a,0xff,0xb0,0x8f,0xfb,0x00,0x00,0x00,0x00,0x00,0x9f,0xf6,0x2f,0xff,0x40,
+  0x00,0x00,0x00,0x02,0xff,0xe1,0x0a,0xff,0xa0,0x00,0x00,0x00,0x08,0xff,0x90,0x04,0xff,0xf2,0x00,0x00,0x00,0x0d,0xff,0x20,
+  0x00,0xcf,0xf8,0x00,0x00,0x00,0x5f,0xfb,0x00,0x00,0x6f,0xfe,0x00,0x00,0x00,0xbf,0xf4,0x00,0x00,0x0e,0xff,0x50,0x00,0x02,
+  0xff,0xd0,0x00,0x00,0x08,0xff,0xb0,0x00,0x08,0xff,0x70,0x00,0x00,0x02,0xff,0xf2,0x00,0x0e,0xfe,0x10,0x00,0x00,0x00,0xaf,
+  0xf9,0x00,0x5f,0xf9,0x00,0x00,0x00,0x00,0x3f,0xfe,0x10,0xbf,0xf3,0x00,0x00,0x00,0x00,0x0c,0xff,0x62,0xff,0xb0,0x00,0x00,
+  0x00,0x00,0x05,0xff,0xc8,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0xef,0xfd,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf7,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0a,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf5,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x7f,0xf8,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0xff,0xfe,0x4f,0xff,0xff,0xff,0xff,
+  0xff,0xfd,0x00,0x00,0x00,0x00,0x02,0xef,0xf8,0x00,0x00,0x00,0x00,0x0b,0xff,0xc1,0x00,0x00,0x00,0x00,0x7f,0xff,0x30,0x00,
+  0x00,0x00,0x03,0xff,0xf6,0x00,0x00,0x00,0x00,0x1d,0xff,0xb0,0x00,0x00,0x00,0x00,0xaf,0xfe,0x10,0x00,0x00,0x00,0x05,0xff,
+  0xf4,0x00,0x00,0x00,0x00,0x2e,0xff,0x80,0x00,0x00,0x00,0x00,0xcf,0xfc,0x00,0x00,0x00,0x00,0x08,0xff,0xe2,0x00,0x00,0x00,
+  0x00,0x3f,0xff,0x60,0x00,0x00,0x00,0x01,0xdf,0xfa,0x00,0x00,0x00,0x00,0x0a,0xff,0xe1,0x00,0x00,0x00,0x00,0x5f,0xff,0x40,
+  0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xf9,0xcf,0xff,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x28,0xde,0xe0,0x00,
+  0x04,0xef,0xff,0xc0,0x00,0x1e,0xfe,0x61,0x00,0x00,0x6f,0xf7,0x00,0x00,0x00,0x9f,0xf2,0x00,0x00,0x00,0xbf,0xf0,0x00,0x00,
+  0x00,0xaf,0xf1,0x00,0x00,0x00,0x8f,0xf3,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0x00,0x3f,0xf7,0x00,0x00,0x00,0x0f,0xfa,0x00,
+  0x00,0x00,0x0e,0xfb,0x00,0x00,0x00,0x0d,0xfc,0x00,0x00,0x00,0x1f,0xf9,0x00,0x00,0x02,0xbf,0xf3,0x00,0x00,0x4f,0xfd,0x40,
+  0x00,0x00,0x4f,0xfd,0x40,0x00,0x00,0x02,0xbf,0xf3,0x00,0x00,0x00,0x1f,0xf9,0x00,0x00,0x00,0x0d,0xfc,0x00,0x00,0x00,0x0e,
+  0xfb,0x00,0x00,0x00,0x0f,0xfa,0x00,0x00,0x00,0x3f,0xf7,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0x00,0x8f,0xf3,0x00,0x00,0x00,
+  0xaf,0xf1,0x00,0x00,0x00,0xbf,0xf0,0x00,0x00,0x00,0x9f,0xf2,0x00,0x00,0x00,0x6f,0xf6,0x00,0x00,0x00,0x1e,0xfe,0x61,0x00,
+  0x00,0x03,0xef,0xff,0xc0,0x00,0x00,0x28,0xde,0xe0,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,
+  0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,
+  0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,
+  0xff,0x70,0xff,0x70,0x7f,0xeb,0x50,0x00,0x00,0x5f,0xff,0xfa,0x00,0x00,0x00,0x3b,0xff,0x70,0x00,0x00,0x01,0xdf,0xd0,0x00,
+  0x00,0x00,0x9f,0xf2,0x00,0x00,0x00,0x8f,0xf3,0x00,0x00,0x00,0x9f,0xf2,0x00,0x00,0x00,0xaf,0xf1,0x00,0x00,0x00,0xcf,0xd0,
+  0x00,0x00,0x00,0xff,0xa0,0x00,0x00,0x02,0xff,0x80,0x00,0x00,0x04,0xff,0x60,0x00,0x00,0x04,0xff,0x50,0x00,0x00,0x02,0xff,
+  0x80,0x00,0x00,0x00,0xaf,0xe5,0x10,0x00,0x00,0x19,0xff,0xb0,0x00,0x00,0x19,0xff,0xb0,0x00,0x00,0xaf,0xe5,0x10,0x00,0x02,
+  0xff,0x80,0x00,0x00,0x04,0xff,0x50,0x00,0x00,0x04,0xff,0x60,0x00,0x00,0x02,0xff,0x80,0x00,0x00,0x00,0xff,0xa0,0x00,0x00,
+  0x00,0xcf,0xd0,0x00,0x00,0x00,0xaf,0xf1,0x00,0x00,0x00,0x9f,0xf2,0x00,0x00,0x00,0x8f,0xf3,0x00,0x00,0x00,0x9f,0xf2,0x00,
+  0x00,0x01,0xdf,0xd0,0x00,0x00,0x3b,0xff,0x70,0x00,0x5f,0xff,0xfa,0x00,0x00,0x7f,0xeb,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x02,0x88,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0x20,0x00,0x7d,0xfe,0xb5,0x00,0x00,0x0b,0xfe,0x00,0x0b,
+  0xff,0xff,0xff,0xd7,0x21,0x7f,0xf9,0x00,0x6f,0xf9,0x11,0x6c,0xff,0xff,0xff,0xd1,0x00,0xcf,0xd0,0x00,0x00,0x49,0xdf,0xd9,
+  0x10,0x00,0xef,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xee,0x60,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x06,0xee,0x60,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x30,0x02,0xff,0x40,0x04,0xff,0x60,0x05,0xff,0x70,0x06,
+  0xff,0x70,0x06,0xff,0x80,0x06,0xff,0x80,0x06,0xff,0x80,0x06,0xff,0x80,0x06,0xff,0x80,0x06,0xff,0x80,0x06,0xff,0x80,0x06,
+  0xff,0x80,0x06,0xff,0x80,0x06,0xff,0x80,0x06,0xff,0x80,0x00,0x00,0x00,0x00,0x08,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,
+  0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xf1,0x00,0x00,0x00,0x00,0x04,0x9d,0xef,
+  0xfd,0x93,0x00,0x00,0x02,0xcf,0xff,0xff,0xff,0xff,0xa1,0x00,0x3e,0xff,0xfb,0x8f,0xea,0xef,0xf7,0x01,0xdf,0xfb,0x20,0x3f,
+  0xc0,0x17,0xa0,0x09,0xff,0xc1,0x00,0x4f,0xb0,0x00,0x00,0x1e,0xff,0x40,0x00,0x5f,0xa0,0x00,0x00,0x4f,0xfd,0x00,0x00,0x6f,
+  0x90,0x00,0x00,0x7f,0xfa,0x00,0x00,0x7f,0x80,0x00,0x00,0x8f,0xf8,0x00,0x00,0x8f,0x70,0x00,0x00,0x8f,0xf8,0x00,0x00,0x9f,
+  0x60,0x00,0x00,0x7f,0xf9,0x00,0x00,0xaf,0x50,0x00,0x00,0x5f,0xfb,0x00,0x00,0xbf,0x40,0x00,0x00,0x1f,0xff,0x10,0x00,0xcf,
+  0x30,0x00,0x00,0x0a,0xff,0x80,0x00,0xdf,0x20,0x00,0x00,0x02,0xef,0xf5,0x00,0xef,0x10,0x03,0x92,0x00,0x5f,0xff,0x93,0xff,
+  0x13,0x9f,0xfb,0x00,0x05,0xef,0xff,0xff,0xff,0xff,0xc2,0x00,0x00,0x17,0xcf,0xff,0xed,0x95,0x00,0x00,0x00,0x00,0x03,0xfb,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xf6,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5a,0xde,0xfd,0xa4,0x00,0x00,0x00,0x00,0x00,0x2c,0xff,0xff,0xff,0xff,0xb1,0x00,0x00,
+  0x00,0x01,0xdf,0xfb,0x41,0x14,0xcf,0xfc,0x10,0x00,0x00,0x0a,0xff,0xa0,0x00,0x00,0x1b,0xff,0x80,0x00,0x00,0x2f,0xff,0x10,
+  0x00,0x00,0x01,0xa7,0x00,0x00,0x00,0x6f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,
+  0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0d,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0x00,0x00,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xe2,0x00,0x00,0x00,
+  0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xaf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,
+  0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xef,0xfe,0xef,0xff,0xff,0xff,
+  0xff,0xff,0xf8,0x0b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x40,0x3e,0xd2,0x00,
+  0x00,0x00,0x00,0x1b,0xf6,0x4e,0xfd,0x36,0xce,0xec,0x83,0xbf,0xf6,0x03,0xdf,0xff,0xff,0xff,0xff,0xfe,0x50,0x00,0x3f,0xfe,
+  0x61,0x14,0xdf,0xf7,0x00,0x00,0x8f,0xf3,0x00,0x00,0x0c,0xfc,0x00,0x00,0xdf,0x80,0x00,0x00,0x03,0xff,0x30,0x01,0xff,0x40,
+  0x00,0x00,0x00,0xef,0x60,0x01,0xff,0x40,0x00,0x00,0x00,0xef,0x60,0x00,0xef,0x80,0x00,0x00,0x03,0xff,0x30,0x00,0x8f,0xf3,
+  0x00,0x00,0x0c,0xfd,0x00,0x00,0x2f,0xfe,0x61,0x14,0xdf,0xf8,0x00,0x02,0xcf,0xff,0xff,0xff,0xff,0xff,0x50,0x3d,0xfe,0x47,
+  0xce,0xec,0x83,0xbf,0xf7,0x3e,0xe3,0x00,0x00,0x00,0x00,0x0a,0xf7,0x03,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x1e,0xfe,0x50,
+  0x00,0x00,0x00,0x00,0x03,0xef,0xf2,0x07,0xff,0xd0,0x00,0x00,0x00,0x00,0x0b,0xff,0x90,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,
+  0x4f,0xff,0x20,0x00,0x7f,0xfd,0x00,0x00,0x00,0x00,0xbf,0xf9,0x00,0x00,0x1e,0xff,0x60,0x00,0x00,0x03,0xff,0xf2,0x00,0x00,
+  0x06,0xff,0xd0,0x00,0x00,0x0b,0xff,0x80,0x00,0x00,0x00,0xdf,0xf5,0x00,0x00,0x3f,0xfe,0x10,0x00,0x00,0x00,0x6f,0xfd,0x00,
+  0x00,0xbf,0xf8,0x00,0x00,0x00,0x00,0x0d,0xff,0x50,0x03,0xff,0xe1,0x00,0x00,0x00,0x00,0x06,0xff,0xc0,0x0a,0xff,0x80,0x00,
+  0x00,0x00,0x00,0x00,0xdf,0xf5,0x3f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x6f,0xfb,0x8f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0d,0xff,0xdf,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xf9,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x8f,0xfa,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x8f,0xfa,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x7f,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x8f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfa,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x8f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xfa,0x00,0x00,0x00,0x00,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,
+  0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x70,0xff,
+  0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x70,0xff,
+  0x70,0x00,0x01,0x7c,0xef,0xec,0x82,0x00,0x00,0x4e,0xff,0xff,0xff,0xff,0x80,0x02,0xef,0xe7,0x20,0x15,0xcf,0x80,0x09,0xff,
+  0x50,0x00,0x00,0x03,0x00,0x0c,0xff,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x20,0x00,0x00,0x00,0x00,0x08,0xff,0xd3,0x00,0x00,
+  0x00,0x00,0x01,0xef,0xff,0xb4,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xc5,0x00,0x00,0x06,0xef,0xde,0xff,0xff,0xc3,0x00,0x4f,
+  0xf9,0x01,0x7d,0xff,0xff,0x60,0xbf,0xe0,0x00,0x00,0x5d,0xff,0xf3,0xef,0xc0,0x00,0x00,0x01,0xbf,0xf9,0xef,0xf3,0x00,0x00,
+  0x00,0x2f,0xfb,0xaf,0xfe,0x50,0x00,0x00,0x0e,0xfa,0x2e,0xff,0xfc,0x50,0x00,0x3f,0xf6,0x02,0xcf,0xff,0xfd,0x64,0xdf,0xc0,
+  0x00,0x06,0xcf,0xff,0xff,0xf9,0x10,0x00,0x00,0x04,0xaf,0xff,0xf9,0x00,0x00,0x00,0x00,0x02,0x9f,0xff,0x60,0x00,0x00,0x00,
+  0x00,0x06,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0xef,0xd0,0x00,0x00,0x00,0x00,0x00,0xef,0xc0,0x07,0x50,0x00,0x00,0x04,0xff,
+  0x70,0x5f,0xfb,0x51,0x02,0x7e,0xfd,0x10,0x3c,0xff,0xff,0xff,0xff,0xd2,0x00,0x00,0x59,0xde,0xfe,0xb6,0x00,0x00,0x6e,0xeb,
+  0x10,0x3c,0xfc,0x30,0x6e,0xeb,0x10,0x3d,0xfc,0x30,0x00,0x00,0x00,0x00,0x38,0xbe,0xfe,0xdb,0x72,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xb3,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xd9,0x42,0x11,0x24,0x9e,0xff,0x80,0x00,
+  0x00,0x00,0x01,0xcf,0xe6,0x00,0x00,0x00,0x00,0x00,0x6e,0xfb,0x10,0x00,0x00,0x1c,0xfc,0x20,0x01,0x7c,0xef,0xec,0x71,0x01,
+  0xcf,0xb0,0x00,0x00,0x9f,0xb0,0x00,0x7e,0xff,0xff,0xff,0xfe,0x60,0x1b,0xf8,0x00,0x03,0xfd,0x10,0x08,0xff,0xd6,0x20,0x15,
+  0xcf,0x70,0x01,0xdf,0x30,0x0b,0xf5,0x00,0x5f,0xfb,0x10,0x00,0x00,0x04,0x00,0x00,0x5f,0xa0,0x2f,0xc0,0x00,0xdf,0xe1,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0c,0xf1,0x6f,0x70,0x03,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf5,0x9f,0x20,0x07,0xff,
+  0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0xbf,0x10,0x09,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xce,0x00,
+  0x09,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xbf,0x00,0x07,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfa,
+  0xaf,0x20,0x04,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf9,0x6f,0x60,0x00,0xef,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x07,0xf5,0x2f,0xb0,0x00,0x6f,0xfa,0x00,0x00,0x00,0x16,0x00,0x00,0x0c,0xf1,0x0b,0xf4,0x00,0x0a,0xff,0xc4,0x10,0x26,0xdf,
+  0x90,0x00,0x5f,0xa0,0x04,0xfd,0x10,0x00,0x9f,0xff,0xff,0xff,0xfe,0x40,0x01,0xdf,0x30,0x00,0x9f,0xa0,0x00,0x03,0x9d,0xef,
+  0xdb,0x61,0x00,0x0b,0xf8,0x00,0x00,0x1c,0xfb,0x20,0x00,0x00,0x00,0x00,0x00,0x02,0xcf,0xb0,0x00,0x00,0x01,0xcf,0xe5,0x00,
+  0x00,0x00,0x00,0x00,0x6e,0xfb,0x10,0x00,0x00,0x00,0x09,0xff,0xd8,0x41,0x01,0x24,0x9d,0xff,0x90,0x00,0x00,0x00,0x00,0x00,
+  0x4c,0xff,0xff,0xff,0xff,0xff,0xb4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xbe,0xff,0xdb,0x83,0x00,0x00,0x00,0x00,0x00,
+  0x3a,0xef,0xd7,0x00,0x07,0xff,0xff,0xff,0x90,0x07,0xe7,0x21,0x7f,0xf2,0x00,0x00,0x00,0x0d,0xf6,0x00,0x00,0x00,0x0c,0xf7,
+  0x00,0x38,0xce,0xff,0xf7,0x08,0xff,0xff,0xff,0xf7,0x3f,0xf7,0x31,0x0c,0xf7,0x5f,0xe2,0x12,0x7e,0xf7,0x2e,0xff,0xff,0xda,
+  0xf7,0x04,0xce,0xe9,0x14,0xf7,0x00,0x00,0x10,0x00,0x01,0x10,0x00,0x00,0xbd,0x20,0x08,0xe3,0x00,0x06,0xff,0x20,0x3f,0xf4,
+  0x00,0x1e,0xf8,0x00,0xcf,0xa0,0x00,0xaf,0xd1,0x07,0xfe,0x20,0x04,0xff,0x40,0x2e,0xf7,0x00,0x1d,0xfa,0x00,0xbf,0xd0,0x00,
+  0x7f,0xe1,0x05,0xff,0x40,0x00,0x3f,0xf6,0x02,0xef,0x80,0x00,0x09,0xfe,0x10,0x6f,0xf3,0x00,0x01,0xdf,0x90,0x0b,0xfc,0x00,
+  0x00,0x5f,0xf3,0x02,0xff,0x60,0x00,0x0a,0xfc,0x00,0x7f,0xe1,0x00,0x01,0xef,0x30,0x0c,0xf6,0x00,0x00,0x56,0x00,0x03,0x70,
+  0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfa,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfa,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfa,0x4f,0xff,0xff,0xff,0xf6,0x4f,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x38,0xbe,
+  0xfe,0xdb,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xb3,0x00,0x00,0x00,0x00,0x00,0x09,0xff,
+  0xd9,0x42,0x11,0x24,0x9e,0xff,0x80,0x00,0x00,0x00,0x01,0xcf,0xe6,0x00,0x00,0x00,0x00,0x00,0x6e,0xfb,0x10,0x00,0x00,0x1c,
+  0xfc,0x24,0xff,0xff,0xfe,0xda,0x40,0x01,0xcf,0xb0,0x00,0x00,0x9f,0xb0,0x04,0xff,0xff,0xff,0xff,0xf8,0x00,0x1b,0xf8,0x00,
+  0x03,0xfd,0x10,0x04,0xff,0x70,0x01,0x5d,0xff,0x30,0x01,0xdf,0x30,0x0b,0xf5,0x00,0x04,0xff,0x70,0x00,0x05,0xff,0x80,0x00,
+  0x5f,0xa0,0x2f,0xc0,0x00,0x04,0xff,0x70,0x00,0x01,0xff,0xa0,0x00,0x0c,0xf1,0x6f,0x70,0x00,0x04,0xff,0x70,0x00,0x02,0xff,
+  0x80,0x00,0x07,0xf5,0x9f,0x20,0x00,0x04,0xff,0x70,0x00,0x06,0xff,0x40,0x00,0x03,0xf8,0xbf,0x10,0x00,0x04,0xff,0x70,0x01,
+  0x6e,0xfb,0x00,0x00,0x00,0xfa,0xce,0x00,0x00,0x04,0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x00,0xfb,0xbf,0x00,0x00,0x04,0xff,
+  0xff,0xff,0xf5,0x00,0x00,0x00,0x01,0xfa,0xaf,0x20,0x00,0x04,0xff,0x70,0x3e,0xfe,0x20,0x00,0x00,0x03,0xf9,0x6f,0x60,0x00,
+  0x04,0xff,0x70,0x05,0xff,0xb0,0x00,0x00,0x07,0xf5,0x2f,0xb0,0x00,0x04,0xff,0x70,0x00,0xaf,0xf7,0x00,0x00,0x0c,0xf1,0x0b,
+  0xf4,0x00,0x04,0xff,0x70,0x00,0x1d,0xff,0x30,0x00,0x5f,0xa0,0x04,0xfd,0x10,0x04,0xff,0x70,0x00,0x03,0xff,0xd1,0x01,0xdf,
+  0x30,0x00,0x9f,0xa0,0x03,0xcc,0x50,0x00,0x00,0x6c,0xc7,0x0b,0xf8,0x00,0x00,0x1c,0xfb,0x20,0x00,0x00,0x00,0x00,0x00,0x02,
+  0xcf,0xb0,0x00,0x00,0x01,0xcf,0xe5,0x00,0x00,0x00,0x00,0x00,0x6e,0xfb,0x10,0x00,0x00,0x00,0x09,0xff,0xd8,0x41,0x01,0x24,
+  0x9d,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xb4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xbe,
+  0xff,0xdb,0x83,0x00,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0x60,0xaf,0xff,0xff,0xff,0xff,0x60,0x00,0x17,0xce,0xec,0x60,
+  0x00,0x02,0xdf,0xff,0xff,0xfb,0x10,0x0c,0xfe,0x51,0x17,0xef,0xb0,0x6f,0xf2,0x00,0x00,0x4f,0xf3,0xaf,0xa0,0x00,0x00,0x0c,
+  0xf8,0xbf,0x70,0x00,0x00,0x0a,0xf9,0xaf,0xa0,0x00,0x00,0x0b,0xf8,0x6f,0xe2,0x00,0x00,0x4f,0xf3,0x0c,0xfe,0x51,0x16,0xef,
+  0xa0,0x02,0xdf,0xff,0xff,0xfb,0x10,0x00,0x17,0xce,0xec,0x60,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xf8,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,
+  0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x4b,0xef,0xc4,0x00,0x06,0xff,0xff,
+  0xff,0x50,0x1e,0xf9,0x12,0xbf,0xd0,0x4f,0xd0,0x00,0x4f,0xf1,0x01,0x10,0x00,0x5f,0xe0,0x00,0x00,0x00,0xbf,0x90,0x00,0x00,
+  0x06,0xfe,0x20,0x00,0x00,0x5f,0xe4,0x00,0x00,0x05,0xff,0x40,0x00,0x00,0x5f,0xf5,0x00,0x00,0x05,0xff,0x50,0x00,0x00,0x4f,
+  0xfe,0xef,0xff,0xf4,0x8f,0xff,0xff,0xff,0xf6,0x00,0x3a,0xee,0xc6,0x00,0x04,0xff,0xff,0xff,0x80,0x0d,0xf9,0x11,0x8f,0xf1,
+  0x18,0x80,0x00,0x2f,0xf1,0x00,0x00,0x02,0xaf,0xb0,0x00,0x00,0xdf,0xfa,0x10,0x00,0x00,0xdf,0xfd,0x40,0x00,0x00,0x02,0x9f,
+  0xe2,0x00,0x00,0x00,0x0f,0xf5,0x4e,0xa0,0x00,0x0f,0xf5,0x2f,0xf7,0x12,0xaf,0xe1,0x07,0xff,0xff,0xff,0x60,0x00,0x5c,0xfe,
+  0xb5,0x00,0x00,0x0a,0xff,0xd2,0x00,0x7f,0xfe,0x20,0x01,0xef,0xe3,0x00,0x0a,0xff,0x50,0x00,0x4f,0xe6,0x00,0x00,0xdf,0xf4,
+  0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,
+  0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,
+  0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,
+  0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf5,
+  0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf7,0x00,0x00,0x00,0x05,0xff,0xd0,0xdf,0xfe,0x10,0x00,0x00,0x5e,0xff,0xd0,0xdf,0xff,
+  0xc4,0x11,0x4a,0xfe,0xff,0xd0,0xdf,0xed,0xff,0xff,0xff,0xc2,0xef,0xd0,0xdf,0xf1,0x8d,0xfe,0xc6,0x00,0xaf,0xd0,0xdf,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x38,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0x00,0x1a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0x01,0xcf,
+  0xff,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x0e,0xff,
+  0xff,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x3f,0xff,0xff,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x4f,0xff,
+  0xff,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x2f,0xff,0xff,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x0d,0xff,
+  0xff,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x06,0xff,0xff,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x9f,
+  0xff,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,
+  0x16,0xac,0xef,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xf5,0x00,0x00,0xcf,0xe0,0x00,0x00,0x19,0xed,
+  0x50,0x8f,0xff,0xf2,0xcf,0xff,0xf5,0x8f,0xff,0xf2,0x19,0xed,0x50,0x00,0x77,0x00,0x00,0x03,0xfc,0x00,0x00,0x07,0xff,0xd6,
+  0x00,0x00,0x26,0xff,0x50,0x00,0x02,0xef,0x90,0x6f,0xff,0xff,0x50,0x4b,0xee,0xb5,0x00,0x00,0x09,0xfd,0x00,0x00,0x01,0xbf,
+  0xfd,0x00,0x00,0x2d,0xff,0xfd,0x00,0x00,0xaf,0xb7,0xfd,0x00,0x00,0x16,0x06,0xfd,0x00,0x00,0x00,0x06,0xfd,0x00,0x00,0x00,
+  0x06,0xfd,0x00,0x00,0x00,0x06,0xfd,0x00,0x00,0x00,0x06,0xfd,0x00,0x00,0x00,0x06,0xfd,0x00,0x00,0x00,0x06,0xfd,0x00,0x00,
+  0x0f,0xff,0xff,0xff,0x20,0x0f,0xff,0xff,0xff,0x20,0x00,0x29,0xdf,0xeb,0x50,0x00,0x04,0xef,0xff,0xff,0xf8,0x00,0x1e,0xfc,
+  0x41,0x29,0xff,0x50,0x6f,0xf2,0x00,0x00,0xcf,0xb0,0xaf,0xc0,0x00,0x00,0x8f,0xf0,0xbf,0xb0,0x00,0x00,0x6f,0xf1,0xaf,0xc0,
+  0x00,0x00,0x8f,0xf0,0x6f,0xf2,0x00,0x00,0xcf,0xb0,0x1e,0xfc,0x31,0x29,0xff,0x50,0x04,0xef,0xff,0xff,0xf8,0x00,0x00,0x29,
+  0xdf,0xeb,0x50,0x00,0x01,0x10,0x00,0x01,0x00,0x00,0x3e,0x90,0x01,0xdc,0x00,0x00,0x3f,0xf4,0x01,0xef,0x70,0x00,0x09,0xfd,
+  0x10,0x6f,0xe2,0x00,0x01,0xef,0x80,0x0c,0xfb,0x00,0x00,0x6f,0xf3,0x03,0xff,0x60,0x00,0x0c,0xfc,0x00,0x9f,0xe1,0x00,0x03,
+  0xff,0x60,0x1e,0xf9,0x00,0x07,0xff,0x20,0x5f,0xf5,0x00,0x2f,0xf7,0x01,0xdf,0xa0,0x00,0xbf,0xc0,0x08,0xfe,0x10,0x05,0xff,
+  0x30,0x2f,0xf6,0x00,0x1d,0xf8,0x00,0xbf,0xb0,0x00,0x5f,0xd1,0x02,0xff,0x20,0x00,0x07,0x40,0x00,0x56,0x00,0x00,0x00,0x02,
+  0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x7f,0xa0,0x00,0x00,0x3e,0xff,0x80,0x00,0x00,0x00,0x00,0x04,0xff,0x20,0x00,0x05,0xff,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x0d,0xf8,0x00,0x00,0x1e,0xf7,0xbf,0x80,0x00,0x00,0x00,0x00,0x7f,0xd0,0x00,0x00,0x03,0x30,
+  0xbf,0x80,0x00,0x00,0x00,0x02,0xef,0x50,0x00,0x00,0x00,0x00,0xbf,0x80,0x00,0x00,0x00,0x0a,0xfb,0x00,0x00,0x00,0x00,0x00,
+  0xbf,0x80,0x00,0x00,0x00,0x4f,0xf2,0x00,0x00,0x00,0x00,0x00,0xbf,0x80,0x00,0x00,0x00,0xdf,0x80,0x00,0x00,0x00,0x00,0x00,
+  0xbf,0x80,0x00,0x00,0x07,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0xbf,0x80,0x00,0x00,0x2e,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xbf,0x80,0x00,0x00,0xaf,0xb0,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xff,0xc0,0x04,0xff,0x20,0x00,0x00,0x00,0x00,0x04,0xff,
+  0xff,0xff,0xc0,0x0d,0xf8,0x00,0x00,0x0c,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xd1,0x00,0x00,0x8f,0xfa,0x00,0x00,0x00,
+  0x00,0x00,0x02,0xef,0x50,0x00,0x04,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x0a,0xfb,0x00,0x00,0x1e,0xf8,0xfa,0x00,0x00,0x00,
+  0x00,0x00,0x4f,0xf2,0x00,0x00,0xaf,0x74,0xfa,0x00,0x00,0x00,0x00,0x00,0xdf,0x80,0x00,0x06,0xfa,0x04,0xfa,0x00,0x00,0x00,
+  0x00,0x07,0xfd,0x10,0x00,0x2e,0xc1,0x04,0xfa,0x00,0x00,0x00,0x00,0x2e,0xf5,0x00,0x00,0xce,0x20,0x04,0xfa,0x00,0x00,0x00,
+  0x00,0xaf,0xb0,0x00,0x06,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x04,0xff,0x20,0x00,0x04,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,
+  0x0c,0xf8,0x00,0x00,0x00,0x00,0x00,0x04,0xfa,0x00,0x00,0x00,0x7f,0xd1,0x00,0x00,0x00,0x00,0x00,0x04,0xfa,0x00,0x00,0x01,
+  0xed,0x40,0x00,0x00,0x00,0x00,0x00,0x04,0xfa,0x00,0x00,0x02,0xcf,0x80,0x00,0x00,0x00,0x00,0x05,0xed,0x10,0x00,0x00,0x3e,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x2e,0xf5,0x00,0x00,0x05,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0xaf,0xb0,0x00,0x00,0x1e,0xf7,
+  0xbf,0x80,0x00,0x00,0x00,0x04,0xff,0x20,0x00,0x00,0x03,0x30,0xbf,0x80,0x00,0x00,0x00,0x0d,0xf8,0x00,0x00,0x00,0x00,0x00,
+  0xbf,0x80,0x00,0x00,0x00,0x7f,0xd1,0x00,0x00,0x00,0x00,0x00,0xbf,0x80,0x00,0x00,0x01,0xef,0x50,0x00,0x00,0x00,0x00,0x00,
+  0xbf,0x80,0x00,0x00,0x0a,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0x80,0x00,0x00,0x4f,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xbf,0x80,0x00,0x00,0xcf,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0x80,0x00,0x07,0xfe,0x10,0x00,0x00,0x00,0x00,0x04,0xff,
+  0xff,0xff,0xc0,0x1e,0xf5,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xff,0xc0,0xaf,0xb0,0x01,0x7c,0xee,0x92,0x00,0x00,0x00,
+  0x00,0x00,0x04,0xff,0x30,0x0b,0xff,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x0c,0xf8,0x00,0x6f,0xf5,0x14,0xef,0x80,0x00,0x00,
+  0x00,0x00,0x6f,0xe1,0x00,0x9f,0x80,0x00,0x9f,0xb0,0x00,0x00,0x00,0x01,0xef,0x50,0x00,0x01,0x00,0x00,0xaf,0x90,0x00,0x00,
+  0x00,0x09,0xfb,0x00,0x00,0x00,0x00,0x02,0xff,0x40,0x00,0x00,0x00,0x3f,0xf3,0x00,0x00,0x00,0x00,0x0b,0xfa,0x00,0x00,0x00,
+  0x00,0xcf,0x80,0x00,0x00,0x00,0x00,0xaf,0xc1,0x00,0x00,0x00,0x06,0xfe,0x10,0x00,0x00,0x00,0x0a,0xfc,0x10,0x00,0x00,0x00,
+  0x1e,0xf6,0x00,0x00,0x00,0x00,0xaf,0xd1,0x00,0x00,0x00,0x00,0x9f,0xc0,0x00,0x00,0x00,0x0a,0xfd,0x20,0x00,0x00,0x00,0x03,
+  0xff,0x30,0x00,0x00,0x00,0x9f,0xfe,0xef,0xff,0xd0,0x00,0x0c,0xe7,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xf0,0x00,0x5c,
+  0xee,0xb4,0x00,0x00,0x00,0x00,0x00,0x6e,0xc0,0x00,0x08,0xff,0xff,0xff,0x40,0x00,0x00,0x00,0x03,0xff,0x30,0x00,0x2f,0xf5,
+  0x12,0xbf,0xb0,0x00,0x00,0x00,0x0c,0xf9,0x00,0x00,0x39,0x60,0x00,0x6f,0xc0,0x00,0x00,0x00,0x6f,0xe1,0x00,0x00,0x00,0x00,
+  0x13,0xdf,0x70,0x00,0x00,0x01,0xef,0x60,0x00,0x00,0x00,0x02,0xff,0xf7,0x00,0x00,0x00,0x09,0xfc,0x00,0x00,0x00,0x00,0x02,
+  0xff,0xfb,0x20,0x00,0x00,0x3f,0xf3,0x00,0x00,0x00,0x00,0x00,0x03,0xcf,0xc0,0x00,0x00,0xcf,0x90,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x4f,0xf1,0x00,0x06,0xfe,0x10,0x00,0x00,0x00,0x7e,0x60,0x00,0x4f,0xf1,0x00,0x1e,0xf6,0x00,0x00,0x00,0x00,0x6f,0xe5,
+  0x13,0xcf,0xb0,0x00,0x9f,0xc0,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xfe,0x20,0x03,0xff,0x30,0x00,0x00,0x00,0x00,0x01,0x8d,
+  0xee,0xa2,0x00,0x0c,0xf9,0x00,0x00,0x0c,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xe1,0x00,0x00,0x8f,0xfa,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xef,0x60,0x00,0x04,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x09,0xfc,0x00,0x00,0x1d,0xf7,0xfa,0x00,0x00,0x00,
+  0x00,0x00,0x3f,0xf3,0x00,0x00,0xaf,0x74,0xfa,0x00,0x00,0x00,0x00,0x00,0xbf,0x90,0x00,0x06,0xfa,0x04,0xfa,0x00,0x00,0x00,
+  0x00,0x05,0xfe,0x10,0x00,0x2e,0xc1,0x04,0xfa,0x00,0x00,0x00,0x00,0x1e,0xf6,0x00,0x00,0xce,0x20,0x04,0xfa,0x00,0x00,0x00,
+  0x00,0x8f,0xc0,0x00,0x06,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x03,0xff,0x30,0x00,0x04,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,
+  0x0b,0xf9,0x00,0x00,0x00,0x00,0x00,0x04,0xfa,0x00,0x00,0x00,0x5f,0xe1,0x00,0x00,0x00,0x00,0x00,0x04,0xfa,0x00,0x00,0x01,
+  0xee,0x50,0x00,0x00,0x00,0x00,0x00,0x04,0xfa,0x00,0x00,0x00,0x00,0x8e,0xd4,0x00,0x00,0x00,0x00,0x03,0xff,0xfe,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x8e,0xd4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xd0,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x00,0x9f,0xf0,0x00,0x00,0x00,0x00,0x02,0xef,0xf1,0x00,0x00,0x00,0x00,
+  0x4e,0xff,0xb0,0x00,0x00,0x00,0x08,0xff,0xfc,0x10,0x00,0x00,0x00,0xaf,0xff,0x80,0x00,0x00,0x00,0x07,0xff,0xe4,0x00,0x00,
+  0x00,0x00,0x0e,0xff,0x50,0x00,0x00,0x00,0x00,0x2f,0xfd,0x00,0x00,0x00,0x00,0x00,0x3f,0xfb,0x00,0x00,0x00,0x00,0x00,0x2f,
+  0xfc,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x50,0x00,0x00,0x07,0x60,0x04,0xff,0xe8,0x20,0x16,0xcf,0xf2,0x00,0x6f,0xff,0xff,
+  0xff,0xff,0xa1,0x00,0x02,0x8c,0xef,0xeb,0x82,0x00,0x00,0x00,0x01,0xaf,0xfe,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x05,0xef,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x7e,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3f,0xfe,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0xef,0xf4,0x7f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe0,0x1f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0c,0xff,0x80,0x0a,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x20,0x04,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xfb,0x00,0x00,0xdf,0xf7,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x8f,0xfd,0x00,0x00,0x00,0x00,0x00,
+  0x06,0xff,0xe1,0x00,0x00,0x2f,0xff,0x40,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x0b,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0x30,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x01,
+  0xef,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x06,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x00,0x0c,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x3f,0xff,0x20,0x00,0x00,0x00,0x00,0x04,0xff,0xf1,0x00,0x00,0x9f,
+  0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf7,0x00,0x01,0xef,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x00,0x06,0xff,
+  0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x40,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xa0,0x3f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x9f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2c,0xff,0xe4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xfa,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x4e,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xef,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0c,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xfe,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x9f,0xf9,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf4,0x7f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x06,0xff,0xe0,0x1f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x80,0x0a,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xff,0x20,0x04,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfb,0x00,0x00,0xdf,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x01,0xef,0xf6,0x00,0x00,0x8f,0xfd,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe1,0x00,0x00,0x2f,0xff,0x40,0x00,0x00,0x00,0x00,
+  0x0c,0xff,0x90,0x00,0x00,0x0b,0xff,0xa0,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x00,0x00,
+  0x9f,0xfc,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x06,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x3f,
+  0xff,0x20,0x00,0x00,0x00,0x00,0x04,0xff,0xf1,0x00,0x00,0x9f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf7,0x00,0x01,0xef,
+  0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x00,0x06,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x40,0x0c,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xa0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x9f,0xfa,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x78,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1b,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xe5,0x7f,0xfb,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x4e,0xfb,0x20,0x03,0xcf,0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3f,0xfe,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0xef,0xf4,0x7f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe0,0x1f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0c,0xff,0x80,0x0a,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x20,0x04,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xfb,0x00,0x00,0xdf,0xf7,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x8f,0xfd,0x00,0x00,0x00,0x00,0x00,
+  0x06,0xff,0xe1,0x00,0x00,0x2f,0xff,0x40,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x0b,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0x30,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x01,
+  0xef,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x06,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x00,0x0c,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x3f,0xff,0x20,0x00,0x00,0x00,0x00,0x04,0xff,0xf1,0x00,0x00,0x9f,
+  0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf7,0x00,0x01,0xef,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x00,0x06,0xff,
+  0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x40,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xa0,0x3f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x9f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xf7,0x00,0x00,
+  0x00,0x01,0x9e,0xeb,0x61,0x1d,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0e,0xe2,0x16,0xbe,0xea,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3f,0xfe,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0xef,0xf4,0x7f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe0,0x1f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0c,0xff,0x80,0x0a,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x20,0x04,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xfb,0x00,0x00,0xdf,0xf7,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x8f,0xfd,0x00,0x00,0x00,0x00,0x00,
+  0x06,0xff,0xe1,0x00,0x00,0x2f,0xff,0x40,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x0b,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0x30,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x01,
+  0xef,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x06,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x00,0x0c,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x3f,0xff,0x20,0x00,0x00,0x00,0x00,0x04,0xff,0xf1,0x00,0x00,0x9f,
+  0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf7,0x00,0x01,0xef,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x00,0x06,0xff,
+  0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x40,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xa0,0x3f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x9f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xf7,0x00,0x00,
+  0x00,0x6e,0xea,0x00,0x01,0xbf,0xd4,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0xea,0x00,0x01,0xcf,0xd4,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xef,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0c,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xfe,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x9f,0xf9,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf4,0x7f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x06,0xff,0xe0,0x1f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x80,0x0a,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xff,0x20,0x04,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfb,0x00,0x00,0xdf,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x01,0xef,0xf6,0x00,0x00,0x8f,0xfd,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe1,0x00,0x00,0x2f,0xff,0x40,0x00,0x00,0x00,0x00,
+  0x0c,0xff,0x90,0x00,0x00,0x0b,0xff,0xa0,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x00,0x00,
+  0x9f,0xfc,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x06,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x3f,
+  0xff,0x20,0x00,0x00,0x00,0x00,0x04,0xff,0xf1,0x00,0x00,0x9f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf7,0x00,0x01,0xef,
+  0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x00,0x06,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x40,0x0c,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xa0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x9f,0xfa,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xf7,0x00,0x00,0x00,0x00,0x02,0xae,0xd8,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1d,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0x71,0x1a,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0x71,0x1a,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x02,0xae,0xd9,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xef,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0c,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xfe,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x9f,0xf9,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf4,0x7f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x06,0xff,0xe0,0x1f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x80,0x0a,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xff,0x20,0x04,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfb,0x00,0x00,0xdf,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x01,0xef,0xf6,0x00,0x00,0x8f,0xfd,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe1,0x00,0x00,0x2f,0xff,0x40,0x00,0x00,0x00,0x00,
+  0x0c,0xff,0x90,0x00,0x00,0x0b,0xff,0xa0,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x00,0x00,
+  0x9f,0xfc,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x06,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x3f,
+  0xff,0x20,0x00,0x00,0x00,0x00,0x04,0xff,0xf1,0x00,0x00,0x9f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf7,0x00,0x01,0xef,
+  0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x00,0x06,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x40,0x0c,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xa0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x9f,0xfa,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x8f,0xfb,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xc7,0xff,0xc0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x65,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,
+  0xfe,0x03,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf7,0x01,0xff,0xf2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xe1,0x00,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,
+  0x70,0x00,0xdf,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xfe,0x10,0x00,0xbf,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xf8,0x00,0x00,0x9f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xe1,
+  0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x0c,0xff,0x80,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xff,
+  0xf6,0x00,0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x4f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf9,0x00,
+  0x00,0x00,0x2f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf2,0x00,0x00,0x00,0x1f,0xff,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf5,0x00,0x00,0x00,0x00,0x09,0xff,0x80,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x08,0xff,0xc0,0x00,0x00,0x00,0x00,0x07,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x50,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xd0,0x00,0x00,0x00,
+  0x00,0x00,0x02,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x2f,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,
+  0xff,0xfa,0x00,0x00,0x00,0x00,0x37,0xbd,0xef,0xed,0xa7,0x30,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xfc,0x40,
+  0x00,0x00,0x1a,0xff,0xfb,0x62,0x10,0x14,0x9e,0xff,0xf4,0x00,0x01,0xcf,0xfd,0x40,0x00,0x00,0x00,0x01,0xaf,0xa0,0x00,0x0b,
+  0xff,0xd2,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x00,0x7f,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,
+  0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xe1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfe,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x19,0x30,0x00,0x04,0xef,0xfc,0x30,0x00,0x00,
+  0x00,0x03,0xcf,0xe2,0x00,0x00,0x4e,0xff,0xfa,0x52,0x01,0x25,0xaf,0xff,0xd3,0x00,0x00,0x01,0xaf,0xff,0xff,0xff,0xff,0xff,
+  0xe8,0x10,0x00,0x00,0x00,0x02,0x7b,0xef,0xff,0xec,0x96,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xf1,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xfd,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xf9,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x41,0x1b,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x02,0xae,0xec,0x70,0x00,0x00,0x00,0x01,0x9f,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x05,0xef,0xfa,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1b,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0xfb,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x2c,0xff,0xe5,0x00,0x00,
+  0x00,0x00,0x02,0xdf,0xfb,0x20,0x00,0x00,0x00,0x00,0x3e,0xff,0x70,0x00,0x00,0x00,0x00,0x04,0xef,0xc3,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,
+  0x00,0x00,0x68,0x86,0x00,0x00,0x00,0x00,0x00,0x1a,0xff,0xff,0xa1,0x00,0x00,0x00,0x02,0xcf,0xe6,0x6e,0xfc,0x20,0x00,0x00,
+  0x3e,0xfb,0x20,0x02,0xbf,0xe3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x4d,0xfb,0x10,0x01,0xbf,0xd5,0x00,0x00,0x5d,0xfb,0x10,0x01,0xbf,0xd5,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x4e,
+  0xff,0xc2,0x00,0x00,0x01,0xbf,0xfe,0x30,0x00,0x00,0x06,0xff,0xe3,0x00,0x00,0x00,0x3c,0xfe,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,
+  0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,
+  0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,
+  0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,
+  0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,
+  0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x8e,0xff,0x91,0x00,0x09,0xff,0xe5,0x00,0x00,0xaf,0xfb,0x20,
+  0x00,0x1b,0xfe,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,
+  0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,
+  0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,
+  0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,
+  0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,
+  0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x00,0x00,0x38,
+  0x87,0x20,0x00,0x00,0x00,0x05,0xff,0xff,0xe3,0x00,0x00,0x00,0x8f,0xfa,0x4c,0xff,0x50,0x00,0x1a,0xfe,0x60,0x00,0x8e,0xf8,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,
+  0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,
+  0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,
+  0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,
+  0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,
+  0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,
+  0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,
+  0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x1b,0xfd,
+  0x40,0x00,0x6e,0xe9,0x00,0x1b,0xfd,0x40,0x00,0x7e,0xea,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,
+  0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,
+  0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,
+  0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,
+  0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,
+  0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,
+  0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0x5f,0xff,0x10,
+  0x00,0x00,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xed,0xb7,0x20,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x30,0x00,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x13,0x7c,0xff,0xf7,
+  0x00,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x6e,0xff,0x90,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xef,0xf7,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x30,0x00,0x00,0x00,0xaf,
+  0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xb0,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf2,
+  0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xbf,0xfb,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x00,0x2f,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x60,0x00,0x00,0x00,0x7f,0xff,0x00,0x2f,0xff,0xff,0xff,0xff,0xff,0xff,0x60,0x00,0x00,0x00,0x7f,0xff,0x10,0x00,
+  0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x8f,0xfd,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xfb,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf3,0x00,0x00,0x00,0xaf,
+  0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xb0,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x30,
+  0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xf7,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,
+  0x5e,0xff,0xa0,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x13,0x7c,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xfb,0x30,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xed,0xb7,0x20,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x2b,0xed,0xa4,0x13,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x02,
+  0xfb,0x12,0x7c,0xed,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xfa,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x09,0xff,0x60,0xef,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0x60,0xef,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xfe,0xff,0xb0,0x00,0x00,0x00,0x00,0x09,0xff,0x60,
+  0xef,0xf4,0xff,0xf8,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x8f,0xff,0x40,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,
+  0x0b,0xff,0xe2,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x01,0xdf,0xfc,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x3f,
+  0xff,0x90,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x07,0xff,0xf5,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0xaf,0xfe,
+  0x30,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x1d,0xff,0xd1,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x03,0xef,0xfa,0x00,
+  0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x6f,0xff,0x70,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x09,0xff,0xf3,0x09,0xff,
+  0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0xcf,0xfd,0x19,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x2e,0xff,0xb9,0xff,0x60,0xef,
+  0xf0,0x00,0x00,0x00,0x00,0x05,0xff,0xfe,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0x60,0xef,0xf0,0x00,
+  0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x4f,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xef,0x60,0x00,0x00,0x00,0x19,0xff,0xf8,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0xbf,0xfb,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xef,0xb1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x48,0xcd,0xee,0xdb,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,
+  0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x26,0xbf,0xff,0xa1,0x00,0x00,0x00,0x01,0xcf,0xfc,0x30,0x00,0x00,0x00,0x04,0xdf,
+  0xfc,0x10,0x00,0x00,0x0b,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xa0,0x00,0x00,0x7f,0xfe,0x10,0x00,0x00,0x00,0x00,
+  0x00,0x02,0xef,0xf6,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfe,0x10,0x07,0xff,0xe0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1e,0xff,0x60,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x1f,0xff,0x60,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf1,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x5f,0xff,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf4,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf5,
+  0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf4,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+  0xff,0xf3,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf1,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0a,0xff,0xb0,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x60,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x7f,0xfe,0x10,0x00,0x8f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf7,0x00,0x00,0x0c,0xff,0xb1,0x00,
+  0x00,0x00,0x00,0x00,0x1c,0xff,0xb0,0x00,0x00,0x01,0xdf,0xfc,0x30,0x00,0x00,0x00,0x03,0xdf,0xfc,0x10,0x00,0x00,0x00,0x1b,
+  0xff,0xfa,0x52,0x11,0x25,0xaf,0xff,0xa1,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc5,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x48,0xcd,0xee,0xdc,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xcf,0xfe,0x50,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0xfc,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,
+  0xee,0xdb,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x1b,0xff,
+  0xfa,0x52,0x11,0x26,0xbf,0xff,0xa1,0x00,0x00,0x00,0x01,0xcf,0xfc,0x30,0x00,0x00,0x00,0x04,0xdf,0xfc,0x10,0x00,0x00,0x0b,
+  0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xa0,0x00,0x00,0x7f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf6,0x00,
+  0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfe,0x10,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,
+  0xff,0x60,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x07,0xff,0xf1,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x03,0xff,0xf4,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf5,0x5f,0xff,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf4,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x1f,0xff,0x60,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf1,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x07,
+  0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x60,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfe,
+  0x10,0x00,0x8f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf7,0x00,0x00,0x0c,0xff,0xb1,0x00,0x00,0x00,0x00,0x00,0x1c,
+  0xff,0xb0,0x00,0x00,0x01,0xdf,0xfc,0x30,0x00,0x00,0x00,0x03,0xdf,0xfc,0x10,0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x25,
+  0xaf,0xff,0xa1,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,
+  0xee,0xdc,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x88,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0xaf,0xff,0xfa,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0xfe,0x66,0xef,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x03,0xef,0xb2,0x00,0x2b,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,0xee,0xdb,0x83,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x26,0xbf,
+  0xff,0xa1,0x00,0x00,0x00,0x01,0xcf,0xfc,0x30,0x00,0x00,0x00,0x04,0xdf,0xfc,0x10,0x00,0x00,0x0b,0xff,0xc1,0x00,0x00,0x00,
+  0x00,0x00,0x1c,0xff,0xa0,0x00,0x00,0x7f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf6,0x00,0x01,0xef,0xf6,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x7f,0xfe,0x10,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x60,0x0c,0xff,0x90,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf1,0x3f,
+  0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,
+  0xf4,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf5,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x03,0xff,0xf4,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x07,0xff,0xf1,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x07,0xff,0xe0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1e,0xff,0x60,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfe,0x10,0x00,0x8f,0xfe,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf7,0x00,0x00,0x0c,0xff,0xb1,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xb0,0x00,0x00,0x01,
+  0xdf,0xfc,0x30,0x00,0x00,0x00,0x03,0xdf,0xfc,0x10,0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x25,0xaf,0xff,0xa1,0x00,0x00,
+  0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,0xee,0xdc,0x84,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xde,0xb6,0x21,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0xff,0xfb,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xce,0x21,0x5a,0xee,0xa2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,
+  0xcd,0xee,0xdb,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x1b,
+  0xff,0xfa,0x52,0x11,0x26,0xbf,0xff,0xa1,0x00,0x00,0x00,0x01,0xcf,0xfc,0x30,0x00,0x00,0x00,0x04,0xdf,0xfc,0x10,0x00,0x00,
+  0x0b,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xa0,0x00,0x00,0x7f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf6,
+  0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfe,0x10,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x1e,0xff,0x60,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x07,0xff,0xf1,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x5f,0xff,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x03,0xff,0xf4,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf5,0x5f,0xff,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf4,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x1f,0xff,
+  0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf1,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,
+  0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x60,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,
+  0xfe,0x10,0x00,0x8f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf7,0x00,0x00,0x0c,0xff,0xb1,0x00,0x00,0x00,0x00,0x00,
+  0x1c,0xff,0xb0,0x00,0x00,0x01,0xdf,0xfc,0x30,0x00,0x00,0x00,0x03,0xdf,0xfc,0x10,0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,
+  0x25,0xaf,0xff,0xa1,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,
+  0xcd,0xee,0xdc,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xdf,0xb1,0x00,0x1b,0xfd,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x05,0xdf,0xb1,0x00,0x1b,0xfd,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,0xee,0xdb,0x83,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x26,0xbf,0xff,
+  0xa1,0x00,0x00,0x00,0x01,0xcf,0xfc,0x30,0x00,0x00,0x00,0x04,0xdf,0xfc,0x10,0x00,0x00,0x0b,0xff,0xc1,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0xff,0xa0,0x00,0x00,0x7f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xf6,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xfe,0x10,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x60,0x0c,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf1,0x3f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf4,
+  0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf5,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+  0xff,0xf4,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x07,0xff,0xf1,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1e,0xff,0x60,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfe,0x10,0x00,0x8f,0xfe,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x02,0xef,0xf7,0x00,0x00,0x0c,0xff,0xb1,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xb0,0x00,0x00,0x01,0xdf,
+  0xfc,0x30,0x00,0x00,0x00,0x03,0xdf,0xfc,0x10,0x00,0x00,0x00,0x1b,0xff,0xfa,0x52,0x11,0x25,0xaf,0xff,0xa1,0x00,0x00,0x00,
+  0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0xff,0xc5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,0xee,0xdc,0x84,0x00,0x00,0x00,
+  0x00,0x01,0x20,0x00,0x00,0x00,0x00,0x01,0x20,0x1c,0xd2,0x00,0x00,0x00,0x00,0x1b,0xd2,0x4f,0xfd,0x20,0x00,0x00,0x01,0xbf,
+  0xf7,0x05,0xff,0xd2,0x00,0x00,0x1b,0xff,0x80,0x00,0x5f,0xfd,0x20,0x01,0xbf,0xf8,0x00,0x00,0x05,0xff,0xd2,0x1b,0xff,0x80,
+  0x00,0x00,0x00,0x5f,0xfd,0xcf,0xf8,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x01,0xcf,0xfe,0x20,0x00,
+  0x00,0x00,0x00,0x1b,0xff,0xff,0xd2,0x00,0x00,0x00,0x01,0xbf,0xf8,0x5f,0xfd,0x20,0x00,0x00,0x1b,0xff,0x80,0x05,0xff,0xd2,
+  0x00,0x01,0xbf,0xf8,0x00,0x00,0x5f,0xfd,0x20,0x1b,0xff,0x80,0x00,0x00,0x05,0xff,0xd2,0x8f,0xf8,0x00,0x00,0x00,0x00,0x5f,
+  0xfb,0x1b,0x80,0x00,0x00,0x00,0x00,0x05,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x78,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xfc,0x00,0x00,0x00,0x00,0x00,0x38,
+  0xbd,0xef,0xec,0xa7,0x30,0x7f,0xe2,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xfc,0xff,0x40,0x00,0x00,0x00,0x09,
+  0xff,0xfa,0x52,0x11,0x25,0xbf,0xff,0xfc,0x00,0x00,0x00,0x01,0xbf,0xfc,0x30,0x00,0x00,0x00,0x04,0xff,0xff,0x80,0x00,0x00,
+  0x09,0xff,0xc1,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xf4,0x00,0x00,0x5f,0xfe,0x10,0x00,0x00,0x00,0x00,0x3f,0xf8,0xef,0xfc,
+  0x00,0x00,0xdf,0xf6,0x00,0x00,0x00,0x00,0x01,0xdf,0xb0,0x7f,0xff,0x50,0x05,0xff,0xe0,0x00,0x00,0x00,0x00,0x09,0xfe,0x10,
+  0x1f,0xff,0x90,0x0a,0xff,0x90,0x00,0x00,0x00,0x00,0x4f,0xf5,0x00,0x0a,0xff,0xe0,0x0e,0xff,0x60,0x00,0x00,0x00,0x01,0xdf,
+  0x90,0x00,0x07,0xff,0xf2,0x3f,0xff,0x30,0x00,0x00,0x00,0x0a,0xfd,0x10,0x00,0x04,0xff,0xf3,0x4f,0xff,0x20,0x00,0x00,0x00,
+  0x5f,0xf4,0x00,0x00,0x03,0xff,0xf4,0x5f,0xff,0x10,0x00,0x00,0x01,0xef,0x80,0x00,0x00,0x02,0xff,0xf5,0x6f,0xff,0x20,0x00,
+  0x00,0x0b,0xfd,0x00,0x00,0x00,0x03,0xff,0xf3,0x5f,0xff,0x30,0x00,0x00,0x6f,0xf3,0x00,0x00,0x00,0x04,0xff,0xf2,0x3f,0xff,
+  0x60,0x00,0x02,0xef,0x70,0x00,0x00,0x00,0x07,0xff,0xe0,0x0f,0xff,0x90,0x00,0x0c,0xfc,0x00,0x00,0x00,0x00,0x0a,0xff,0xa0,
+  0x0b,0xff,0xe0,0x00,0x7f,0xe2,0x00,0x00,0x00,0x00,0x1e,0xff,0x50,0x06,0xff,0xf6,0x03,0xff,0x60,0x00,0x00,0x00,0x00,0x7f,
+  0xfd,0x00,0x00,0xdf,0xfe,0x2c,0xfb,0x00,0x00,0x00,0x00,0x02,0xef,0xf5,0x00,0x00,0x5f,0xff,0xef,0xe1,0x00,0x00,0x00,0x00,
+  0x1c,0xff,0x90,0x00,0x00,0x0a,0xff,0xff,0x70,0x00,0x00,0x00,0x03,0xdf,0xfb,0x00,0x00,0x00,0x00,0xbf,0xff,0xfa,0x52,0x01,
+  0x25,0xaf,0xff,0x90,0x00,0x00,0x00,0x00,0xaf,0xef,0xff,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x0a,0xfc,0x14,0x8b,
+  0xde,0xfe,0xdb,0x83,0x00,0x00,0x00,0x00,0x00,0xaf,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x75,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xff,0xe6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xdf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,
+  0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,
+  0xc0,0x2f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xb0,0x1f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xa0,0x0e,
+  0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x70,0x0a,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x30,0x04,0xff,0xe1,
+  0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0xbf,0xf9,0x00,0x00,0x00,0x00,0x02,0xef,0xf5,0x00,0x00,0x2e,0xff,0x80,0x00,
+  0x00,0x00,0x2d,0xff,0x90,0x00,0x00,0x03,0xef,0xfc,0x62,0x01,0x38,0xef,0xfa,0x00,0x00,0x00,0x00,0x2a,0xff,0xff,0xff,0xff,
+  0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x38,0xcd,0xfe,0xda,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xdf,0xfd,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0xff,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xe5,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xfb,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,
+  0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,
+  0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xff,0xc0,0x2f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xb0,0x1f,0xff,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x0a,0xff,0xa0,0x0e,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x70,0x0a,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x1f,
+  0xff,0x30,0x04,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0xbf,0xf9,0x00,0x00,0x00,0x00,0x02,0xef,0xf5,0x00,
+  0x00,0x2e,0xff,0x80,0x00,0x00,0x00,0x2d,0xff,0x90,0x00,0x00,0x03,0xef,0xfc,0x62,0x01,0x38,0xef,0xfa,0x00,0x00,0x00,0x00,
+  0x2a,0xff,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x38,0xcd,0xfe,0xda,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x17,0x88,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xcf,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xfd,0x48,
+  0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0x91,0x00,0x4d,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,
+  0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,
+  0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,
+  0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x2f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xb0,0x1f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xa0,0x0e,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x70,0x0a,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x00,0x1f,0xff,0x30,0x04,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0xbf,0xf9,0x00,0x00,0x00,
+  0x00,0x02,0xef,0xf5,0x00,0x00,0x2e,0xff,0x80,0x00,0x00,0x00,0x2d,0xff,0x90,0x00,0x00,0x03,0xef,0xfc,0x62,0x01,0x38,0xef,
+  0xfa,0x00,0x00,0x00,0x00,0x2a,0xff,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x38,0xcd,0xfe,0xda,0x61,0x00,0x00,
+  0x00,0x00,0x00,0x07,0xee,0x90,0x00,0x2c,0xfc,0x20,0x00,0x00,0x00,0x00,0x07,0xee,0x90,0x00,0x2c,0xfc,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,
+  0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xc0,0x2f,0xff,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x09,0xff,0xb0,0x1f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xa0,0x0e,0xff,0x50,0x00,0x00,0x00,0x00,0x00,
+  0x0c,0xff,0x70,0x0a,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x30,0x04,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,
+  0x00,0x00,0xbf,0xf9,0x00,0x00,0x00,0x00,0x02,0xef,0xf5,0x00,0x00,0x2e,0xff,0x80,0x00,0x00,0x00,0x2d,0xff,0x90,0x00,0x00,
+  0x03,0xef,0xfc,0x62,0x01,0x38,0xef,0xfa,0x00,0x00,0x00,0x00,0x2a,0xff,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,
+  0x38,0xcd,0xfe,0xda,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xfe,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x2d,0xff,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xfc,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x8f,0xfd,0x20,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xf9,0x1e,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xe1,
+  0x05,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x60,0x00,0xbf,0xfd,0x00,0x00,0x00,0x00,0x00,0xcf,0xfc,0x00,0x00,0x2f,
+  0xff,0x70,0x00,0x00,0x00,0x06,0xff,0xf3,0x00,0x00,0x08,0xff,0xe1,0x00,0x00,0x00,0x1e,0xff,0x90,0x00,0x00,0x01,0xdf,0xf9,
+  0x00,0x00,0x00,0x8f,0xfe,0x10,0x00,0x00,0x00,0x5f,0xff,0x30,0x00,0x02,0xff,0xf5,0x00,0x00,0x00,0x00,0x0b,0xff,0xc0,0x00,
+  0x0b,0xff,0xb0,0x00,0x00,0x00,0x00,0x02,0xff,0xf6,0x00,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x8f,0xfe,0x10,0xdf,0xf8,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0x76,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xdc,0xff,0x50,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,
+  0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xff,0xff,0xed,0xb8,0x40,0x00,0x00,0x9f,0xff,0xff,0xff,0xff,
+  0xff,0xfc,0x30,0x00,0x9f,0xfc,0x00,0x00,0x12,0x6d,0xff,0xf5,0x00,0x9f,0xfc,0x00,0x00,0x00,0x01,0xaf,0xfe,0x20,0x9f,0xfc,
+  0x00,0x00,0x00,0x00,0x1e,0xff,0x90,0x9f,0xfc,0x00,0x00,0x00,0x00,0x08,0xff,0xd0,0x9f,0xfc,0x00,0x00,0x00,0x00,0x05,0xff,
+  0xf1,0x9f,0xfc,0x00,0x00,0x00,0x00,0x04,0xff,0xf2,0x9f,0xfc,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,0x9f,0xfc,0x00,0x00,0x00,
+  0x00,0x09,0xff,0xd0,0x9f,0xfc,0x00,0x00,0x00,0x00,0x2e,0xff,0x70,0x9f,0xfc,0x00,0x00,0x00,0x01,0xcf,0xfd,0x10,0x9f,0xfc,
+  0x00,0x00,0x13,0x7e,0xff,0xe3,0x00,0x9f,0xff,0xff,0xff,0xff,0xff,0xfa,0x20,0x00,0x9f,0xff,0xff,0xff,0xed,0xb8,0x20,0x00,
+  0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x17,0xbe,0xfe,0xd9,0x30,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0xaf,0xfd,0x62,0x01,0x5c,0xff,0xa0,
+  0x00,0x07,0xff,0xc1,0x00,0x00,0x00,0xcf,0xf4,0x00,0x1e,0xff,0x20,0x00,0x00,0x00,0x6f,0xfa,0x00,0x6f,0xfb,0x00,0x00,0x00,
+  0x00,0x5f,0xfb,0x00,0x9f,0xf8,0x00,0x00,0x00,0x00,0xaf,0xf9,0x00,0xbf,0xf6,0x00,0x00,0x00,0x07,0xff,0xe2,0x00,0xbf,0xf6,
+  0x00,0x00,0x00,0x9f,0xfe,0x50,0x00,0xbf,0xf6,0x00,0x00,0x1c,0xff,0xd3,0x00,0x00,0xbf,0xf6,0x00,0x00,0xbf,0xfa,0x00,0x00,
+  0x00,0xbf,0xf6,0x00,0x05,0xff,0xd0,0x00,0x00,0x00,0xbf,0xf6,0x00,0x08,0xff,0xc0,0x00,0x00,0x00,0xbf,0xf6,0x00,0x06,0xff,
+  0xf9,0x10,0x00,0x00,0xbf,0xf6,0x00,0x01,0xdf,0xff,0xe6,0x00,0x00,0xbf,0xf6,0x00,0x00,0x2d,0xff,0xff,0xc3,0x00,0xbf,0xf6,
+  0x00,0x00,0x00,0x6d,0xff,0xfe,0x20,0xbf,0xf6,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0xbf,0xf6,0x00,0x00,0x00,0x00,0x07,0xff,
+  0xd0,0xbf,0xf6,0x00,0x00,0x00,0x00,0x00,0xff,0xe0,0xbf,0xf6,0x00,0x00,0x00,0x00,0x01,0xff,0xd0,0xbf,0xf6,0x01,0x82,0x00,
+  0x00,0x06,0xff,0x80,0xbf,0xf6,0x0a,0xff,0x82,0x02,0x7e,0xfe,0x10,0xbf,0xf6,0x07,0xef,0xff,0xff,0xff,0xd3,0x00,0xbf,0xf6,
+  0x00,0x17,0xbe,0xfe,0xb6,0x10,0x00,0x00,0x02,0xdf,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0x50,0x00,0x00,0x00,0x00,
+  0x00,0x03,0xef,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xef,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xde,0xfd,0xa4,0x00,0x00,0x00,
+  0x5d,0xff,0xff,0xff,0xff,0x80,0x00,0x05,0xff,0xf9,0x31,0x15,0xdf,0xf6,0x00,0x00,0xcc,0x30,0x00,0x00,0x3f,0xfe,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x0b,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x80,0x00,
+  0x00,0x00,0x00,0x00,0x07,0xff,0x90,0x00,0x00,0x04,0x8a,0xde,0xef,0xff,0x90,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0x90,0x02,
+  0xdf,0xfe,0x95,0x31,0x17,0xff,0x90,0x0c,0xff,0x91,0x00,0x00,0x07,0xff,0x90,0x4f,0xfc,0x00,0x00,0x00,0x07,0xff,0x90,0x5f,
+  0xfa,0x00,0x00,0x00,0x08,0xff,0x90,0x4f,0xfd,0x00,0x00,0x00,0x7f,0xff,0x90,0x0e,0xff,0xa2,0x02,0x5c,0xfd,0xff,0x90,0x04,
+  0xff,0xff,0xff,0xfe,0x71,0xff,0x90,0x00,0x3a,0xef,0xec,0x82,0x00,0xbf,0x90,0x00,0x00,0x00,0x00,0x1c,0xff,0xc1,0x00,0x00,
+  0x00,0x00,0x00,0x8f,0xfd,0x10,0x00,0x00,0x00,0x00,0x03,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x0c,0xfe,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xe4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x59,0xde,0xfd,0xa4,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0x80,0x00,0x05,0xff,0xf9,0x31,0x15,0xdf,0xf6,0x00,0x00,
+  0xcc,0x30,0x00,0x00,0x3f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,
+  0x00,0x00,0x00,0x00,0x07,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x90,0x00,0x00,0x04,0x8a,0xde,0xef,0xff,0x90,0x00,
+  0x18,0xef,0xff,0xff,0xff,0xff,0x90,0x02,0xdf,0xfe,0x95,0x31,0x17,0xff,0x90,0x0c,0xff,0x91,0x00,0x00,0x07,0xff,0x90,0x4f,
+  0xfc,0x00,0x00,0x00,0x07,0xff,0x90,0x5f,0xfa,0x00,0x00,0x00,0x08,0xff,0x90,0x4f,0xfd,0x00,0x00,0x00,0x7f,0xff,0x90,0x0e,
+  0xff,0xa2,0x02,0x5c,0xfd,0xff,0x90,0x04,0xff,0xff,0xff,0xfe,0x71,0xff,0x90,0x00,0x3a,0xef,0xec,0x82,0x00,0xbf,0x90,0x00,
+  0x00,0x00,0xaf,0xfe,0x30,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xd1,0x00,0x00,0x00,0x00,0x6f,0xf9,0x2d,0xfc,0x10,0x00,0x00,
+  0x04,0xff,0x80,0x02,0xdf,0xb0,0x00,0x00,0x07,0x85,0x00,0x00,0x17,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xde,0xfd,0xa4,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0x80,0x00,0x05,
+  0xff,0xf9,0x31,0x15,0xdf,0xf6,0x00,0x00,0xcc,0x30,0x00,0x00,0x3f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x90,0x00,
+  0x00,0x04,0x8a,0xde,0xef,0xff,0x90,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0x90,0x02,0xdf,0xfe,0x95,0x31,0x17,0xff,0x90,0x0c,
+  0xff,0x91,0x00,0x00,0x07,0xff,0x90,0x4f,0xfc,0x00,0x00,0x00,0x07,0xff,0x90,0x5f,0xfa,0x00,0x00,0x00,0x08,0xff,0x90,0x4f,
+  0xfd,0x00,0x00,0x00,0x7f,0xff,0x90,0x0e,0xff,0xa2,0x02,0x5c,0xfd,0xff,0x90,0x04,0xff,0xff,0xff,0xfe,0x71,0xff,0x90,0x00,
+  0x3a,0xef,0xec,0x82,0x00,0xbf,0x90,0x00,0x00,0x6d,0xec,0x72,0x1b,0xf4,0x00,0x00,0x06,0xff,0xff,0xff,0xff,0xe1,0x00,0x00,
+  0x0b,0xf6,0x14,0x9d,0xeb,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xde,0xfd,0xa4,0x00,0x00,0x00,
+  0x5d,0xff,0xff,0xff,0xff,0x80,0x00,0x05,0xff,0xf9,0x31,0x15,0xdf,0xf6,0x00,0x00,0xcc,0x30,0x00,0x00,0x3f,0xfe,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x0b,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x80,0x00,
+  0x00,0x00,0x00,0x00,0x07,0xff,0x90,0x00,0x00,0x04,0x8a,0xde,0xef,0xff,0x90,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0x90,0x02,
+  0xdf,0xfe,0x95,0x31,0x17,0xff,0x90,0x0c,0xff,0x91,0x00,0x00,0x07,0xff,0x90,0x4f,0xfc,0x00,0x00,0x00,0x07,0xff,0x90,0x5f,
+  0xfa,0x00,0x00,0x00,0x08,0xff,0x90,0x4f,0xfd,0x00,0x00,0x00,0x7f,0xff,0x90,0x0e,0xff,0xa2,0x02,0x5c,0xfd,0xff,0x90,0x04,
+  0xff,0xff,0xff,0xfe,0x71,0xff,0x90,0x00,0x3a,0xef,0xec,0x82,0x00,0xbf,0x90,0x00,0x07,0xee,0x90,0x04,0xdf,0xc2,0x00,0x00,
+  0x07,0xee,0xa0,0x04,0xdf,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xde,0xfd,0xa4,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0x80,0x00,0x05,
+  0xff,0xf9,0x31,0x15,0xdf,0xf6,0x00,0x00,0xcc,0x30,0x00,0x00,0x3f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x90,0x00,
+  0x00,0x04,0x8a,0xde,0xef,0xff,0x90,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0x90,0x02,0xdf,0xfe,0x95,0x31,0x17,0xff,0x90,0x0c,
+  0xff,0x91,0x00,0x00,0x07,0xff,0x90,0x4f,0xfc,0x00,0x00,0x00,0x07,0xff,0x90,0x5f,0xfa,0x00,0x00,0x00,0x08,0xff,0x90,0x4f,
+  0xfd,0x00,0x00,0x00,0x7f,0xff,0x90,0x0e,0xff,0xa2,0x02,0x5c,0xfd,0xff,0x90,0x04,0xff,0xff,0xff,0xfe,0x71,0xff,0x90,0x00,
+  0x3a,0xef,0xec,0x82,0x00,0xbf,0x90,0x00,0x00,0x00,0x7d,0xfb,0x20,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0xe2,0x00,0x00,0x00,
+  0x00,0x1f,0xd3,0x17,0xf9,0x00,0x00,0x00,0x00,0x3f,0x80,0x01,0xfb,0x00,0x00,0x00,0x00,0x2f,0xd2,0x17,0xf9,0x00,0x00,0x00,
+  0x00,0x09,0xff,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x7d,0xeb,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xde,0xfd,0xa4,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0x80,0x00,0x05,
+  0xff,0xf9,0x31,0x15,0xdf,0xf6,0x00,0x00,0xcc,0x30,0x00,0x00,0x3f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x08,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x90,0x00,
+  0x00,0x04,0x8a,0xde,0xef,0xff,0x90,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0x90,0x02,0xdf,0xfe,0x95,0x31,0x17,0xff,0x90,0x0c,
+  0xff,0x91,0x00,0x00,0x07,0xff,0x90,0x4f,0xfc,0x00,0x00,0x00,0x07,0xff,0x90,0x5f,0xfa,0x00,0x00,0x00,0x08,0xff,0x90,0x4f,
+  0xfd,0x00,0x00,0x00,0x7f,0xff,0x90,0x0e,0xff,0xa2,0x02,0x5c,0xfd,0xff,0x90,0x04,0xff,0xff,0xff,0xfe,0x71,0xff,0x90,0x00,
+  0x3a,0xef,0xec,0x82,0x00,0xbf,0x90,0x00,0x00,0x6a,0xde,0xed,0x93,0x00,0x01,0x7c,0xef,0xda,0x30,0x00,0x00,0x00,0x5d,0xff,
+  0xff,0xff,0xff,0x50,0x5e,0xff,0xff,0xff,0xf8,0x00,0x00,0x05,0xff,0xf9,0x31,0x14,0xdf,0xe6,0xff,0xc5,0x10,0x3a,0xff,0x80,
+  0x00,0x00,0xab,0x20,0x00,0x00,0x3f,0xff,0xfc,0x10,0x00,0x00,0xaf,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xf3,0x00,
+  0x00,0x00,0x2f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xd0,0x00,0x00,0x00,0x0c,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x07,0xff,0x90,0x00,0x00,0x00,0x0a,0xff,0x10,0x00,0x00,0x03,0x7a,0xce,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x20,0x00,
+  0x05,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x10,0x00,0xaf,0xff,0xb6,0x41,0x17,0xff,0x70,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xff,0xc2,0x00,0x00,0x07,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xfe,0x10,0x00,0x00,0x08,0xff,
+  0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfa,0x00,0x00,0x00,0x0b,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfb,0x00,
+  0x00,0x00,0x2f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xfe,0x10,0x00,0x00,0xbf,0xdc,0xff,0x40,0x00,0x00,0x04,0xb2,
+  0x00,0x0c,0xff,0xc4,0x11,0x5c,0xff,0x43,0xff,0xf8,0x20,0x14,0xaf,0xfb,0x00,0x03,0xef,0xff,0xff,0xff,0xd3,0x00,0x3d,0xff,
+  0xff,0xff,0xff,0xb2,0x00,0x00,0x18,0xdf,0xed,0xa5,0x00,0x00,0x01,0x6b,0xef,0xec,0x83,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,
+  0xd9,0x40,0x00,0x00,0x06,0xef,0xff,0xff,0xff,0xfb,0x20,0x00,0x8f,0xfe,0x72,0x01,0x4a,0xfe,0x10,0x04,0xff,0xe3,0x00,0x00,
+  0x00,0x32,0x00,0x0c,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x3f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x7f,0xfb,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x9f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x9f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x50,0x00,0x00,
+  0x00,0x00,0x00,0x0a,0xff,0xd1,0x00,0x00,0x00,0x36,0x00,0x02,0xef,0xfd,0x40,0x00,0x18,0xff,0x50,0x00,0x4e,0xff,0xfe,0xcd,
+  0xff,0xfd,0x20,0x00,0x02,0xbf,0xff,0xff,0xfe,0x81,0x00,0x00,0x00,0x02,0x7f,0xe7,0x40,0x00,0x00,0x00,0x00,0x00,0x4f,0xd2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xf7,0x00,0x00,0x00,0x00,0x02,0x30,0x3e,
+  0xf9,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xf4,0x00,0x00,0x00,0x00,0x04,0xbe,0xeb,0x40,0x00,0x00,0x00,0x00,0x9f,0xfd,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xfd,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xcf,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xb7,0x10,0x00,0x00,0x06,0xef,0xff,0xff,0xff,0xe4,0x00,0x00,0x7f,0xfe,0x62,0x01,
+  0x6d,0xff,0x30,0x04,0xff,0xd2,0x00,0x00,0x02,0xef,0xd0,0x0c,0xff,0x40,0x00,0x00,0x00,0x6f,0xf5,0x3f,0xfd,0x00,0x00,0x00,
+  0x00,0x1f,0xfa,0x7f,0xf9,0x00,0x00,0x00,0x00,0x0e,0xfc,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xaf,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xfc,0xaf,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xfa,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x2f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xf4,0x00,0x00,
+  0x00,0x07,0xa0,0x00,0x5f,0xff,0x93,0x10,0x27,0xdf,0xf7,0x00,0x04,0xef,0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x16,0xbd,0xfe,
+  0xda,0x71,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0xcf,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x1e,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xb7,0x10,0x00,0x00,0x06,0xef,0xff,0xff,
+  0xff,0xe4,0x00,0x00,0x7f,0xfe,0x62,0x01,0x6d,0xff,0x30,0x04,0xff,0xd2,0x00,0x00,0x02,0xef,0xd0,0x0c,0xff,0x40,0x00,0x00,
+  0x00,0x6f,0xf5,0x3f,0xfd,0x00,0x00,0x00,0x00,0x1f,0xfa,0x7f,0xf9,0x00,0x00,0x00,0x00,0x0e,0xfc,0x9f,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xfd,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xaf,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xf7,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x6f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0x70,0x00,0x00,
+  0x00,0x00,0x00,0x03,0xef,0xf4,0x00,0x00,0x00,0x07,0xa0,0x00,0x5f,0xff,0x93,0x10,0x27,0xdf,0xf7,0x00,0x04,0xef,0xff,0xff,
+  0xff,0xff,0x90,0x00,0x00,0x16,0xbd,0xfe,0xda,0x71,0x00,0x00,0x00,0x00,0x4f,0xff,0x80,0x00,0x00,0x00,0x00,0x03,0xef,0xff,
+  0xf6,0x00,0x00,0x00,0x00,0x2d,0xfd,0x2a,0xff,0x40,0x00,0x00,0x01,0xcf,0xc1,0x00,0x9f,0xe2,0x00,0x00,0x04,0x87,0x10,0x00,
+  0x05,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,
+  0xb7,0x10,0x00,0x00,0x06,0xef,0xff,0xff,0xff,0xe4,0x00,0x00,0x7f,0xfe,0x62,0x01,0x6d,0xff,0x30,0x04,0xff,0xd2,0x00,0x00,
+  0x02,0xef,0xd0,0x0c,0xff,0x40,0x00,0x00,0x00,0x6f,0xf5,0x3f,0xfd,0x00,0x00,0x00,0x00,0x1f,0xfa,0x7f,0xf9,0x00,0x00,0x00,
+  0x00,0x0e,0xfc,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xaf,0xf6,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x8f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xfe,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x0a,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xf4,0x00,0x00,0x00,0x07,0xa0,0x00,0x5f,0xff,0x93,0x10,
+  0x27,0xdf,0xf7,0x00,0x04,0xef,0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x16,0xbd,0xfe,0xda,0x71,0x00,0x00,0x03,0xdf,0xc3,0x01,
+  0xbf,0xd5,0x00,0x00,0x03,0xdf,0xc3,0x01,0xbf,0xd6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbe,0xfe,0xb7,0x10,0x00,0x00,0x06,0xef,0xff,0xff,
+  0xff,0xe4,0x00,0x00,0x7f,0xfe,0x62,0x01,0x6d,0xff,0x30,0x04,0xff,0xd2,0x00,0x00,0x02,0xef,0xd0,0x0c,0xff,0x40,0x00,0x00,
+  0x00,0x6f,0xf5,0x3f,0xfd,0x00,0x00,0x00,0x00,0x1f,0xfa,0x7f,0xf9,0x00,0x00,0x00,0x00,0x0e,0xfc,0x9f,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xfd,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xaf,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xf7,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x6f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0x70,0x00,0x00,
+  0x00,0x00,0x00,0x03,0xef,0xf4,0x00,0x00,0x00,0x07,0xa0,0x00,0x5f,0xff,0x93,0x10,0x27,0xdf,0xf7,0x00,0x04,0xef,0xff,0xff,
+  0xff,0xff,0x90,0x00,0x00,0x16,0xbd,0xfe,0xda,0x71,0x00,0x0a,0xff,0xd1,0x00,0x00,0xbf,0xfa,0x00,0x00,0x1c,0xff,0x40,0x00,
+  0x01,0xdf,0xd1,0x00,0x00,0x2d,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,
+  0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,
+  0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,
+  0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x01,0xff,0xf0,0x00,0x07,0xff,0xf4,0x00,0x3f,0xff,0x50,0x00,
+  0xcf,0xf6,0x00,0x07,0xff,0x80,0x00,0x1e,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,
+  0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,
+  0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,
+  0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0x00,0x00,0x00,0x05,0xff,0xf6,0x00,
+  0x00,0x00,0x4f,0xff,0xff,0x50,0x00,0x02,0xef,0xc2,0xbf,0xe3,0x00,0x1d,0xfc,0x10,0x0a,0xfe,0x20,0x48,0x71,0x00,0x00,0x68,
+  0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,
+  0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,
+  0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,
+  0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,
+  0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,
+  0x00,0x3d,0xfc,0x20,0x1b,0xfd,0x50,0x4d,0xfc,0x20,0x1b,0xfd,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,
+  0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,
+  0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,
+  0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,
+  0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x00,0x44,0x10,0x00,
+  0x00,0x03,0x00,0x00,0x00,0x00,0xdf,0xfc,0x61,0x01,0xaf,0x30,0x00,0x00,0x00,0xbf,0xff,0xfe,0x8d,0xfd,0x20,0x00,0x00,0x00,
+  0x04,0x8d,0xff,0xff,0xa1,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x6f,0xfa,0x8f,0xfe,0x20,
+  0x00,0x00,0x00,0x00,0xbe,0x60,0x06,0xff,0xc0,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x8f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0d,0xfd,0x00,0x00,0x00,0x28,0xce,0xed,0x94,0x07,0xff,0x40,0x00,0x08,0xff,0xff,0xff,0xff,0xb4,0xff,0x80,0x00,0xaf,
+  0xfe,0x72,0x01,0x5c,0xfd,0xff,0xb0,0x07,0xff,0xd2,0x00,0x00,0x00,0x9f,0xff,0xd0,0x1e,0xff,0x40,0x00,0x00,0x00,0x0b,0xff,
+  0xe0,0x5f,0xfc,0x00,0x00,0x00,0x00,0x03,0xff,0xf0,0x8f,0xf9,0x00,0x00,0x00,0x00,0x00,0xff,0xe0,0xaf,0xf7,0x00,0x00,0x00,
+  0x00,0x01,0xff,0xd0,0x9f,0xf7,0x00,0x00,0x00,0x00,0x03,0xff,0xb0,0x8f,0xf9,0x00,0x00,0x00,0x00,0x06,0xff,0x80,0x4f,0xfd,
+  0x00,0x00,0x00,0x00,0x0b,0xff,0x30,0x0d,0xff,0x50,0x00,0x00,0x00,0x3f,0xfc,0x00,0x05,0xff,0xe2,0x00,0x00,0x01,0xdf,0xf4,
+  0x00,0x00,0x9f,0xfe,0x72,0x02,0x6d,0xff,0x70,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xe6,0x00,0x00,0x00,0x00,0x17,0xce,0xfe,
+  0xc7,0x20,0x00,0x00,0x00,0x01,0xae,0xeb,0x51,0x2e,0xe0,0x00,0x00,0x0b,0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x1f,0xe2,0x16,
+  0xbe,0xe9,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe2,0x01,0x6b,0xef,0xda,0x30,0x00,0x7f,0xf5,0x4d,0xff,
+  0xff,0xff,0xf6,0x00,0x7f,0xfc,0xfe,0x72,0x02,0x8f,0xff,0x30,0x7f,0xff,0xc2,0x00,0x00,0x09,0xff,0xb0,0x7f,0xfd,0x10,0x00,
+  0x00,0x01,0xff,0xf1,0x7f,0xfa,0x00,0x00,0x00,0x00,0xef,0xf3,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf4,0x7f,0xfa,0x00,0x00,
+  0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,
+  0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,
+  0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,
+  0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x00,0x00,0x7f,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xfe,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0xbf,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x16,0xbd,0xfe,0xc9,0x30,0x00,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x7f,0xfe,
+  0x72,0x01,0x4c,0xff,0xc1,0x00,0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x0c,0xff,0x60,0x00,0x00,0x00,0x1e,0xff,0x30,
+  0x3f,0xfe,0x10,0x00,0x00,0x00,0x09,0xff,0x90,0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x9f,0xf9,0x00,0x00,0x00,0x00,
+  0x02,0xff,0xf1,0xaf,0xf8,0x00,0x00,0x00,0x00,0x01,0xff,0xf2,0xaf,0xf8,0x00,0x00,0x00,0x00,0x01,0xff,0xf2,0x9f,0xf9,0x00,
+  0x00,0x00,0x00,0x02,0xff,0xf1,0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x3f,0xfe,0x00,0x00,0x00,0x00,0x09,0xff,0x90,
+  0x0c,0xff,0x60,0x00,0x00,0x00,0x1e,0xff,0x30,0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x00,0x7f,0xfe,0x72,0x01,0x4b,
+  0xff,0xd1,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x00,0x17,0xbe,0xfe,0xd9,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x05,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf9,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x04,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0xbd,0xfe,0xc9,0x30,0x00,0x00,0x00,0x05,0xef,
+  0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x7f,0xfe,0x72,0x01,0x4c,0xff,0xc1,0x00,0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,
+  0x0c,0xff,0x60,0x00,0x00,0x00,0x1e,0xff,0x30,0x3f,0xfe,0x10,0x00,0x00,0x00,0x09,0xff,0x90,0x7f,0xfb,0x00,0x00,0x00,0x00,
+  0x05,0xff,0xd0,0x9f,0xf9,0x00,0x00,0x00,0x00,0x02,0xff,0xf1,0xaf,0xf8,0x00,0x00,0x00,0x00,0x01,0xff,0xf2,0xaf,0xf8,0x00,
+  0x00,0x00,0x00,0x01,0xff,0xf2,0x9f,0xf9,0x00,0x00,0x00,0x00,0x02,0xff,0xf1,0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,
+  0x3f,0xfe,0x00,0x00,0x00,0x00,0x09,0xff,0x90,0x0c,0xff,0x60,0x00,0x00,0x00,0x1e,0xff,0x30,0x04,0xff,0xe3,0x00,0x00,0x00,
+  0xaf,0xfa,0x00,0x00,0x7f,0xfe,0x72,0x01,0x4b,0xff,0xd1,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x00,0x17,
+  0xbe,0xfe,0xd9,0x30,0x00,0x00,0x00,0x00,0x00,0x3e,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0xf7,0x00,0x00,0x00,
+  0x00,0x00,0x1c,0xfe,0x38,0xff,0x50,0x00,0x00,0x00,0x00,0xbf,0xd2,0x00,0x7f,0xf4,0x00,0x00,0x00,0x03,0x87,0x20,0x00,0x04,
+  0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,
+  0xbd,0xfe,0xc9,0x30,0x00,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x7f,0xfe,0x72,0x01,0x4c,0xff,0xc1,0x00,
+  0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x0c,0xff,0x60,0x00,0x00,0x00,0x1e,0xff,0x30,0x3f,0xfe,0x10,0x00,0x00,0x00,
+  0x09,0xff,0x90,0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x9f,0xf9,0x00,0x00,0x00,0x00,0x02,0xff,0xf1,0xaf,0xf8,0x00,
+  0x00,0x00,0x00,0x01,0xff,0xf2,0xaf,0xf8,0x00,0x00,0x00,0x00,0x01,0xff,0xf2,0x9f,0xf9,0x00,0x00,0x00,0x00,0x02,0xff,0xf1,
+  0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x3f,0xfe,0x00,0x00,0x00,0x00,0x09,0xff,0x90,0x0c,0xff,0x60,0x00,0x00,0x00,
+  0x1e,0xff,0x30,0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x00,0x7f,0xfe,0x72,0x01,0x4b,0xff,0xd1,0x00,0x00,0x05,0xef,
+  0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x00,0x17,0xbe,0xfe,0xd9,0x30,0x00,0x00,0x00,0x00,0x2a,0xee,0xa5,0x14,0xfc,0x00,0x00,
+  0x00,0x00,0xdf,0xff,0xff,0xff,0xf7,0x00,0x00,0x00,0x03,0xfc,0x12,0x7c,0xed,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0xbd,0xfe,0xc9,0x30,0x00,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfa,0x10,0x00,
+  0x00,0x7f,0xfe,0x72,0x01,0x4c,0xff,0xc1,0x00,0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x0c,0xff,0x60,0x00,0x00,0x00,
+  0x1e,0xff,0x30,0x3f,0xfe,0x10,0x00,0x00,0x00,0x09,0xff,0x90,0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x9f,0xf9,0x00,
+  0x00,0x00,0x00,0x02,0xff,0xf1,0xaf,0xf8,0x00,0x00,0x00,0x00,0x01,0xff,0xf2,0xaf,0xf8,0x00,0x00,0x00,0x00,0x01,0xff,0xf2,
+  0x9f,0xf9,0x00,0x00,0x00,0x00,0x02,0xff,0xf1,0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x3f,0xfe,0x00,0x00,0x00,0x00,
+  0x09,0xff,0x90,0x0c,0xff,0x60,0x00,0x00,0x00,0x1e,0xff,0x30,0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x00,0x7f,0xfe,
+  0x72,0x01,0x4b,0xff,0xd1,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x00,0x17,0xbe,0xfe,0xd9,0x30,0x00,0x00,
+  0x00,0x02,0xcf,0xd4,0x00,0xae,0xe7,0x00,0x00,0x00,0x02,0xcf,0xd4,0x00,0xae,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,
+  0xbd,0xfe,0xc9,0x30,0x00,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x7f,0xfe,0x72,0x01,0x4c,0xff,0xc1,0x00,
+  0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x0c,0xff,0x60,0x00,0x00,0x00,0x1e,0xff,0x30,0x3f,0xfe,0x10,0x00,0x00,0x00,
+  0x09,0xff,0x90,0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x9f,0xf9,0x00,0x00,0x00,0x00,0x02,0xff,0xf1,0xaf,0xf8,0x00,
+  0x00,0x00,0x00,0x01,0xff,0xf2,0xaf,0xf8,0x00,0x00,0x00,0x00,0x01,0xff,0xf2,0x9f,0xf9,0x00,0x00,0x00,0x00,0x02,0xff,0xf1,
+  0x7f,0xfb,0x00,0x00,0x00,0x00,0x05,0xff,0xd0,0x3f,0xfe,0x00,0x00,0x00,0x00,0x09,0xff,0x90,0x0c,0xff,0x60,0x00,0x00,0x00,
+  0x1e,0xff,0x30,0x04,0xff,0xe3,0x00,0x00,0x00,0xaf,0xfa,0x00,0x00,0x7f,0xfe,0x72,0x01,0x4b,0xff,0xd1,0x00,0x00,0x05,0xef,
+  0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x00,0x17,0xbe,0xfe,0xd9,0x30,0x00,0x00,0x00,0x00,0x00,0x04,0xde,0x70,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0e,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xde,0x70,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,
+  0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xde,0x70,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0e,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xde,0x70,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xd1,0x00,0x00,0x16,0xbd,0xfe,0xda,
+  0x42,0xef,0x30,0x00,0x05,0xef,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,0x6f,0xfe,0x72,0x01,0x4b,0xff,0xf3,0x00,0x03,0xff,0xe2,
+  0x00,0x00,0x06,0xff,0xfd,0x00,0x0b,0xff,0x50,0x00,0x00,0x2e,0xfe,0xff,0x50,0x2f,0xfd,0x00,0x00,0x00,0xcf,0x97,0xff,0xb0,
+  0x6f,0xf9,0x00,0x00,0x08,0xfd,0x12,0xff,0xe0,0x9f,0xf6,0x00,0x00,0x4f,0xf3,0x00,0xff,0xf1,0xaf,0xf5,0x00,0x01,0xdf,0x60,
+  0x00,0xdf,0xf2,0xaf,0xf5,0x00,0x0a,0xfb,0x00,0x00,0xdf,0xf2,0x9f,0xf6,0x00,0x6f,0xe1,0x00,0x00,0xef,0xf1,0x8f,0xf8,0x02,
+  0xef,0x40,0x00,0x02,0xff,0xd0,0x4f,0xfd,0x0c,0xf8,0x00,0x00,0x06,0xff,0x90,0x0d,0xff,0xbf,0xc0,0x00,0x00,0x0d,0xff,0x30,
+  0x06,0xff,0xfe,0x20,0x00,0x00,0x9f,0xfa,0x00,0x00,0xbf,0xfe,0x72,0x11,0x4b,0xff,0xc1,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,
+  0xfa,0x10,0x00,0x09,0xfb,0x27,0xbd,0xfe,0xd9,0x30,0x00,0x00,0x7e,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,
+  0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x01,
+  0xcf,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xcf,0xf5,0x00,0x00,0x00,0x04,0xff,0xd0,0x9f,0xf8,0x00,0x00,0x00,0x05,0xff,0xd0,0x4f,0xfe,0x10,
+  0x00,0x00,0x5e,0xff,0xd0,0x0c,0xff,0xc4,0x11,0x4a,0xfe,0xff,0xd0,0x02,0xdf,0xff,0xff,0xff,0xb1,0xef,0xd0,0x00,0x17,0xce,
+  0xed,0x94,0x00,0xaf,0xd0,0x00,0x00,0x00,0x00,0x7f,0xff,0x40,0x00,0x00,0x00,0x00,0x03,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,
+  0x0b,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x6f,0xf9,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xcf,0xf5,0x00,0x00,0x00,0x04,0xff,0xd0,0x9f,0xf8,0x00,
+  0x00,0x00,0x05,0xff,0xd0,0x4f,0xfe,0x10,0x00,0x00,0x5e,0xff,0xd0,0x0c,0xff,0xc4,0x11,0x4a,0xfe,0xff,0xd0,0x02,0xdf,0xff,
+  0xff,0xff,0xb1,0xef,0xd0,0x00,0x17,0xce,0xed,0x94,0x00,0xaf,0xd0,0x00,0x00,0x04,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x3e,
+  0xff,0xff,0x60,0x00,0x00,0x00,0x01,0xdf,0xd2,0x9f,0xf4,0x00,0x00,0x00,0x1c,0xfd,0x20,0x09,0xfe,0x30,0x00,0x00,0x48,0x71,
+  0x00,0x00,0x58,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xcf,0xf5,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0x9f,0xf8,0x00,0x00,0x00,0x05,0xff,0xd0,0x4f,0xfe,0x10,0x00,0x00,0x5e,0xff,0xd0,0x0c,0xff,0xc4,
+  0x11,0x4a,0xfe,0xff,0xd0,0x02,0xdf,0xff,0xff,0xff,0xb1,0xef,0xd0,0x00,0x17,0xce,0xed,0x94,0x00,0xaf,0xd0,0x00,0x3c,0xfc,
+  0x30,0x1b,0xfd,0x60,0x00,0x00,0x3d,0xfc,0x30,0x1b,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,
+  0x00,0x00,0x04,0xff,0xd0,0xdf,0xf4,0x00,0x00,0x00,0x04,0xff,0xd0,0xcf,0xf5,0x00,0x00,0x00,0x04,0xff,0xd0,0x9f,0xf8,0x00,
+  0x00,0x00,0x05,0xff,0xd0,0x4f,0xfe,0x10,0x00,0x00,0x5e,0xff,0xd0,0x0c,0xff,0xc4,0x11,0x4a,0xfe,0xff,0xd0,0x02,0xdf,0xff,
+  0xff,0xff,0xb1,0xef,0xd0,0x00,0x17,0xce,0xed,0x94,0x00,0xaf,0xd0,0x00,0x00,0x00,0x00,0x00,0xbf,0xfd,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x07,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf4,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x04,0xfe,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x8f,0xfb,0x00,0x00,0x00,0x00,0x00,0x9f,0xf6,0x2f,0xff,0x40,0x00,0x00,0x00,0x02,0xff,0xe1,0x0a,0xff,
+  0xa0,0x00,0x00,0x00,0x08,0xff,0x90,0x04,0xff,0xf2,0x00,0x00,0x00,0x0d,0xff,0x20,0x00,0xcf,0xf8,0x00,0x00,0x00,0x5f,0xfb,
+  0x00,0x00,0x6f,0xfe,0x00,0x00,0x00,0xbf,0xf4,0x00,0x00,0x0e,0xff,0x50,0x00,0x02,0xff,0xd0,0x00,0x00,0x08,0xff,0xb0,0x00,
+  0x08,0xff,0x70,0x00,0x00,0x02,0xff,0xf2,0x00,0x0e,0xfe,0x10,0x00,0x00,0x00,0xaf,0xf9,0x00,0x5f,0xf9,0x00,0x00,0x00,0x00,
+  0x3f,0xfe,0x10,0xbf,0xf3,0x00,0x00,0x00,0x00,0x0c,0xff,0x62,0xff,0xb0,0x00,0x00,0x00,0x00,0x05,0xff,0xc8,0xff,0x50,0x00,
+  0x00,0x00,0x00,0x00,0xef,0xfd,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,
+  0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x2f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xd0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x08,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xf8,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xfa,0x01,0x6b,0xef,0xda,0x40,0x00,0x00,0x7f,0xfa,0x4e,0xff,0xff,0xff,0xf9,0x00,0x00,0x7f,0xfe,
+  0xfd,0x62,0x02,0x8f,0xff,0x70,0x00,0x7f,0xff,0xc1,0x00,0x00,0x05,0xff,0xf2,0x00,0x7f,0xfd,0x10,0x00,0x00,0x00,0xcf,0xf7,
+  0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x6f,0xfc,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x3f,0xff,0x00,0x7f,0xfa,0x00,0x00,0x00,
+  0x00,0x1f,0xff,0x20,0x7f,0xfa,0x00,0x00,0x00,0x00,0x1f,0xff,0x20,0x7f,0xfa,0x00,0x00,0x00,0x00,0x1f,0xff,0x20,0x7f,0xfa,
+  0x00,0x00,0x00,0x00,0x2f,0xff,0x10,0x7f,0xfa,0x00,0x00,0x00,0x00,0x4f,0xfd,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x9f,0xfa,
+  0x00,0x7f,0xfa,0x00,0x00,0x00,0x01,0xef,0xf4,0x00,0x7f,0xff,0x40,0x00,0x00,0x0a,0xff,0xb0,0x00,0x7f,0xff,0xf8,0x31,0x14,
+  0xcf,0xfd,0x20,0x00,0x7f,0xfb,0xcf,0xff,0xff,0xff,0xc2,0x00,0x00,0x7f,0xfa,0x06,0xbe,0xfe,0xb6,0x00,0x00,0x00,0x7f,0xfa,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfa,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0xea,0x00,0x3d,0xfc,0x30,0x00,0x00,0x00,0x6e,0xeb,0x10,0x3d,0xfc,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xfb,0x00,0x00,0x00,0x00,0x00,0x9f,0xf6,0x2f,0xff,0x40,0x00,0x00,0x00,0x02,0xff,0xe1,0x0a,0xff,0xa0,0x00,0x00,
+  0x00,0x08,0xff,0x90,0x04,0xff,0xf2,0x00,0x00,0x00,0x0d,0xff,0x20,0x00,0xcf,0xf8,0x00,0x00,0x00,0x5f,0xfb,0x00,0x00,0x6f,
+  0xfe,0x00,0x00,0x00,0xbf,0xf4,0x00,0x00,0x0e,0xff,0x50,0x00,0x02,0xff,0xd0,0x00,0x00,0x08,0xff,0xb0,0x00,0x08,0xff,0x70,
+  0x00,0x00,0x02,0xff,0xf2,0x00,0x0e,0xfe,0x10,0x00,0x00,0x00,0xaf,0xf9,0x00,0x5f,0xf9,0x00,0x00,0x00,0x00,0x3f,0xfe,0x10,
+  0xbf,0xf3,0x00,0x00,0x00,0x00,0x0c,0xff,0x62,0xff,0xb0,0x00,0x00,0x00,0x00,0x05,0xff,0xc8,0xff,0x50,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xfd,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xe1,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0a,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xfb,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x08,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xf8,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x40,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xfe,0xff,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf4,
+  0x7f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe0,0x1f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,
+  0xff,0x80,0x0a,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x20,0x04,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xfb,0x00,0x00,0xdf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x8f,0xfd,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xe1,0x00,0x00,0x2f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x0b,0xff,0xa0,0x00,
+  0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x05,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0x40,0x00,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x00,0x3f,0xff,0x20,0x00,
+  0x00,0x00,0x00,0x04,0xff,0xf1,0x00,0x00,0x00,0x9f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf7,0x00,0x00,0x01,0xef,0xf5,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x00,0x00,0x06,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x40,0x00,0x0c,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xa0,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf1,
+  0x00,0x9f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x9e,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xf6,0x03,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x2f,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xce,0xeb,0x50,0x00,0x00,0x59,0xde,
+  0xfe,0xa4,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x05,0xff,0xf9,0x31,0x15,0xdf,0xf7,0x00,0x00,0x00,
+  0xcc,0x30,0x00,0x00,0x3f,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,
+  0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x90,0x00,0x00,0x00,0x04,0x8a,
+  0xde,0xef,0xff,0x90,0x00,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0x90,0x00,0x02,0xdf,0xfe,0x95,0x31,0x17,0xff,0x90,0x00,0x0c,
+  0xff,0x91,0x00,0x00,0x07,0xff,0x90,0x00,0x4f,0xfc,0x00,0x00,0x00,0x07,0xff,0x90,0x00,0x5f,0xfa,0x00,0x00,0x00,0x08,0xff,
+  0x90,0x00,0x4f,0xfd,0x00,0x00,0x00,0x7f,0xff,0x90,0x00,0x0e,0xff,0xa2,0x02,0x5c,0xfc,0xff,0x90,0x00,0x04,0xff,0xff,0xff,
+  0xfe,0x71,0xff,0x90,0x00,0x00,0x3a,0xef,0xec,0x82,0x00,0xaf,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xf9,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xd2,
+  0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x08,0xdf,0xd9,0x10,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xbf,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+  0xdf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xfd,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xbd,0xef,0xed,0xa7,0x30,
+  0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0x00,0x1a,0xff,0xfb,0x62,0x10,0x14,0x9e,0xff,0xf4,0x00,
+  0x01,0xcf,0xfd,0x40,0x00,0x00,0x00,0x01,0xaf,0xa0,0x00,0x0b,0xff,0xd2,0x00,0x00,0x00,0x00,0x00,0x04,0x10,0x00,0x7f,0xfe,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xe1,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x60,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x4f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf6,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xc1,0x00,0x00,
+  0x00,0x00,0x00,0x19,0x30,0x00,0x03,0xef,0xfc,0x30,0x00,0x00,0x00,0x03,0xcf,0xe2,0x00,0x00,0x2d,0xff,0xfa,0x52,0x01,0x25,
+  0xaf,0xff,0xc2,0x00,0x00,0x01,0x7e,0xff,0xff,0xff,0xff,0xff,0xe7,0x00,0x00,0x00,0x00,0x01,0x5a,0xce,0xfe,0xdc,0x85,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0xcf,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x06,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x1e,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xbd,0xfe,0xd9,0x40,0x00,0x00,0x06,0xef,0xff,0xff,0xff,0xfb,
+  0x20,0x00,0x7f,0xff,0x83,0x01,0x4b,0xfe,0x20,0x03,0xff,0xf4,0x00,0x00,0x00,0x43,0x00,0x0b,0xff,0x80,0x00,0x00,0x00,0x00,
+  0x00,0x2f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x6f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xf9,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x7f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x70,0x00,0x00,0x00,0x00,
+  0x00,0x04,0xff,0xe3,0x00,0x00,0x00,0x7a,0x00,0x00,0x8f,0xff,0x82,0x01,0x5c,0xff,0x60,0x00,0x07,0xff,0xff,0xff,0xff,0xf9,
+  0x00,0x00,0x00,0x28,0xce,0xfd,0xb7,0x20,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xf8,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x1a,0xe4,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0x30,0x00,0x00,0x00,0x00,0x00,0x05,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x40,
+  0x32,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x5c,0xee,0xb4,0x00,0x00,0x17,0xbe,0xfe,0xb7,0x10,
+  0x00,0x00,0x06,0xef,0xff,0xff,0xff,0xe4,0x00,0x00,0x7f,0xfe,0x62,0x01,0x6d,0xff,0x30,0x04,0xff,0xd2,0x00,0x00,0x02,0xef,
+  0xd0,0x0c,0xff,0x40,0x00,0x00,0x00,0x6f,0xf5,0x3f,0xfd,0x00,0x00,0x00,0x00,0x1f,0xfa,0x7f,0xf9,0x00,0x00,0x00,0x00,0x0e,
+  0xfc,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xaf,0xf6,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x9f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xfe,0x10,0x00,0x00,0x00,0x00,
+  0x00,0x0b,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf4,0x00,0x00,0x00,0x07,0xa0,0x00,0x6f,0xff,0x93,0x10,0x27,0xdf,
+  0xf7,0x00,0x05,0xef,0xff,0xff,0xff,0xff,0xb1,0x00,0x00,0x17,0xbe,0xff,0xfe,0xa4,0x00,0x00,0x00,0x00,0x02,0xde,0x50,0x00,
+  0x00,0x00,0x00,0x00,0x0d,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xf4,0x03,0x20,
+  0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x05,0xce,0xeb,0x40,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,
+  0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,
+  0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x1f,0xff,0x00,0x00,
+  0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x4b,0x20,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x3b,0xff,
+  0x20,0x00,0x00,0x00,0x00,0xef,0xf7,0x2a,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0xef,0xfd,0xff,0xff,0x92,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xff,0xff,0xb3,0x00,0x00,0x00,0x00,0x00,0x2a,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0xf8,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xb4,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x24,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,
+  0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,
+  0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,
+  0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x5b,0x40,0x00,0x00,0xef,
+  0xfe,0xff,0x40,0x00,0x05,0xff,0xff,0xe9,0x10,0x06,0xdf,0xff,0xf8,0x10,0x00,0x1f,0xfe,0xff,0xf2,0x00,0x00,0x1d,0x71,0xef,
+  0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,
+  0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,
+  0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0xef,0xf2,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x05,0xef,0xfc,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+  0xff,0xd4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfa,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0x60,0xef,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x60,
+  0xef,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xfe,
+  0xff,0xb0,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf4,0xff,0xf8,0x00,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x8f,0xff,
+  0x40,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x0b,0xff,0xe2,0x00,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x01,0xdf,0xfc,0x00,
+  0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x3f,0xff,0x90,0x00,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x07,0xff,0xf5,0x00,0x00,
+  0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0xaf,0xfe,0x30,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x1d,0xff,0xd1,0x00,0x09,0xff,
+  0x60,0xef,0xf0,0x00,0x00,0x03,0xef,0xfa,0x00,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x6f,0xff,0x70,0x09,0xff,0x60,0xef,
+  0xf0,0x00,0x00,0x00,0x09,0xff,0xf3,0x09,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0xcf,0xfd,0x19,0xff,0x60,0xef,0xf0,0x00,
+  0x00,0x00,0x00,0x2e,0xff,0xb9,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x05,0xff,0xfe,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,
+  0x00,0x00,0x8f,0xff,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,
+  0x01,0xef,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x60,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x06,
+  0xef,0x60,0x00,0x00,0x00,0x00,0x3e,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xdf,0xfa,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xb0,
+  0x00,0x00,0x00,0x00,0x00,0x2e,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0xaf,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe2,0x01,0x6b,0xef,0xda,0x30,0x00,0x7f,0xf5,0x4d,0xff,0xff,0xff,
+  0xf6,0x00,0x7f,0xfc,0xfe,0x72,0x02,0x8f,0xff,0x30,0x7f,0xff,0xc2,0x00,0x00,0x09,0xff,0xb0,0x7f,0xfd,0x10,0x00,0x00,0x01,
+  0xff,0xf1,0x7f,0xfa,0x00,0x00,0x00,0x00,0xef,0xf3,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf4,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,
+  0xcf,0xf5,0x7f,0xfa,0x00,0x00,0x00,0x00,0xcf,0xf5,0x00,0x00,0x00,0x03,0x7c,0xdf,0xed,0xb6,0x20,0x00,0x8f,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xf8,0x00,0x00,0x02,0xaf,0xff,0xff,0xff,0xff,0xfa,0x20,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,
+  0x4e,0xff,0xd7,0x31,0x12,0x6c,0xff,0xe5,0x8f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf9,0x10,0x00,0x00,0x00,
+  0x7f,0xff,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0x90,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xaf,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,
+  0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0b,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0x00,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,
+  0xff,0xff,0xf4,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x03,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x09,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,
+  0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xfc,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xaf,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0x80,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf9,0x10,0x00,0x00,0x00,0x7f,0xff,0xcf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x4e,0xff,0xd7,0x31,0x12,0x6c,0xff,0xe4,0x8f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xaf,0xff,0xff,0xff,0xff,
+  0xfa,0x20,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x03,0x8c,0xdf,0xed,0xb7,0x20,0x00,0x8f,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xf8,0x00,0x00,0x28,0xce,0xed,0xa5,0x00,0x00,0x02,0x8c,0xef,0xd9,0x20,0x00,0x00,0x07,0xff,0xff,0xff,0xff,
+  0xb1,0x00,0x7f,0xff,0xff,0xff,0xf6,0x00,0x00,0x9f,0xfd,0x61,0x02,0x8f,0xfd,0x17,0xff,0xb4,0x11,0x4c,0xff,0x40,0x05,0xff,
+  0xd1,0x00,0x00,0x05,0xff,0xbf,0xf9,0x00,0x00,0x01,0xdf,0xe0,0x0d,0xff,0x50,0x00,0x00,0x00,0xbf,0xff,0xe1,0x00,0x00,0x00,
+  0x5f,0xf6,0x3f,0xfe,0x00,0x00,0x00,0x00,0x5f,0xff,0x90,0x00,0x00,0x00,0x0f,0xfa,0x7f,0xfb,0x00,0x00,0x00,0x00,0x1f,0xff,
+  0x60,0x00,0x00,0x00,0x0d,0xfc,0x9f,0xf9,0x00,0x00,0x00,0x00,0x0e,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xbf,0xf8,0x00,0x00,
+  0x00,0x00,0x0d,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xbf,0xf8,0x00,0x00,0x00,0x00,0x0d,0xff,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x9f,0xf8,0x00,0x00,0x00,0x00,0x0e,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x7f,0xfb,0x00,0x00,0x00,0x00,0x1f,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x00,0x4f,0xfe,0x00,0x00,0x00,0x00,0x5f,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x50,0x00,0x00,0x00,
+  0xaf,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xd1,0x00,0x00,0x05,0xff,0x9e,0xfd,0x20,0x00,0x00,0x08,0xc1,0x00,0x9f,
+  0xfd,0x51,0x02,0x8f,0xfc,0x05,0xff,0xe6,0x20,0x26,0xdf,0xf8,0x00,0x08,0xff,0xff,0xff,0xff,0xb1,0x00,0x5e,0xff,0xff,0xff,
+  0xff,0x91,0x00,0x00,0x39,0xde,0xed,0xa4,0x00,0x00,0x02,0x8c,0xef,0xdb,0x72,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xff,0x60,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xc3,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xfd,
+  0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x05,0xad,0xfe,0xeb,0x83,0x00,0x00,0x00,0x03,0xdf,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x3f,0xfe,0x72,0x01,0x38,0xef,0xf6,
+  0x00,0x01,0xdf,0xe3,0x00,0x00,0x00,0x2b,0xc0,0x00,0x06,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x40,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0d,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,
+  0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xe8,0x20,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0xff,0xfc,0x61,0x00,0x00,
+  0x00,0x00,0x3e,0xff,0xff,0xff,0xfe,0x92,0x00,0x00,0x00,0x02,0xaf,0xff,0xff,0xff,0xfe,0x40,0x00,0x00,0x00,0x02,0x8d,0xff,
+  0xff,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x38,0xef,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xff,0xff,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xfd,0x00,0x08,0x40,0x00,0x00,0x00,0x00,0x6f,0xf8,0x00,0x6f,0xf8,0x00,0x00,0x00,
+  0x03,0xef,0xe1,0x00,0xbf,0xff,0xd7,0x21,0x13,0x8e,0xfe,0x40,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0xd3,0x00,0x00,0x00,0x05,
+  0x9c,0xef,0xed,0xa5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xfd,0x10,0x00,0x00,0x00,0x08,0xff,0xd2,0x00,0x00,0x00,0x00,
+  0x2f,0xfe,0x30,0x00,0x00,0x00,0x00,0xbf,0xf4,0x00,0x00,0x00,0x00,0x05,0xfe,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xad,0xfe,0xda,0x40,0x00,0x00,0xaf,0xff,0xff,0xff,0xfc,0x20,0x09,0xff,
+  0xb4,0x11,0x49,0xfd,0x10,0x2f,0xfd,0x00,0x00,0x00,0x22,0x00,0x6f,0xf9,0x00,0x00,0x00,0x00,0x00,0x6f,0xfc,0x00,0x00,0x00,
+  0x00,0x00,0x3f,0xff,0xc4,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xd8,0x30,0x00,0x00,0x01,0xbf,0xff,0xff,0xfc,0x40,0x00,0x00,
+  0x04,0xaf,0xff,0xff,0xf9,0x00,0x00,0x00,0x01,0x5b,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x3d,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x05,0xff,0xa0,0x00,0x00,0x00,0x00,0x05,0xff,0x80,0x18,0x30,0x00,0x00,0x0a,0xff,0x40,0x9f,0xfa,0x41,0x13,0xaf,0xfa,0x00,
+  0x5e,0xff,0xff,0xff,0xff,0xa1,0x00,0x01,0x6a,0xde,0xfd,0xa4,0x00,0x00,0x00,0x02,0x77,0x50,0x00,0x03,0x78,0x40,0x00,0x00,
+  0x00,0x6f,0xfa,0x10,0x8f,0xf9,0x00,0x00,0x00,0x00,0x04,0xef,0xec,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0xe5,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xad,
+  0xfe,0xeb,0x83,0x00,0x00,0x00,0x03,0xdf,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x3f,0xfe,0x72,0x01,0x38,0xef,0xf6,0x00,0x01,
+  0xdf,0xe3,0x00,0x00,0x00,0x2b,0xc0,0x00,0x06,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x40,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0d,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xf9,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xe8,0x20,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0xff,0xfc,0x61,0x00,0x00,0x00,0x00,
+  0x3e,0xff,0xff,0xff,0xfe,0x92,0x00,0x00,0x00,0x02,0xaf,0xff,0xff,0xff,0xfe,0x40,0x00,0x00,0x00,0x02,0x8d,0xff,0xff,0xff,
+  0xf3,0x00,0x00,0x00,0x00,0x00,0x38,0xef,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xff,0xff,0x10,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x7f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1f,0xfd,0x00,0x08,0x40,0x00,0x00,0x00,0x00,0x6f,0xf8,0x00,0x6f,0xf8,0x00,0x00,0x00,0x03,0xef,
+  0xe1,0x00,0xbf,0xff,0xd7,0x21,0x13,0x8e,0xfe,0x40,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0xd3,0x00,0x00,0x00,0x05,0x9c,0xef,
+  0xed,0xa5,0x00,0x00,0x00,0x01,0xdf,0xa1,0x00,0x0a,0xfd,0x10,0x00,0x2e,0xfb,0x10,0xbf,0xe2,0x00,0x00,0x03,0xff,0xcb,0xfe,
+  0x30,0x00,0x00,0x00,0x5f,0xff,0xf5,0x00,0x00,0x00,0x00,0x05,0x88,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xad,0xfe,0xda,0x40,0x00,0x00,0xaf,0xff,0xff,0xff,0xfc,0x20,0x09,0xff,0xb4,0x11,
+  0x49,0xfd,0x10,0x2f,0xfd,0x00,0x00,0x00,0x22,0x00,0x6f,0xf9,0x00,0x00,0x00,0x00,0x00,0x6f,0xfc,0x00,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0xc4,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xd8,0x30,0x00,0x00,0x01,0xbf,0xff,0xff,0xfc,0x40,0x00,0x00,0x04,0xaf,
+  0xff,0xff,0xf9,0x00,0x00,0x00,0x01,0x5b,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x3d,0xff,0x90,0x00,0x00,0x00,0x00,0x05,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x05,0xff,0x80,0x18,0x30,0x00,0x00,0x0a,0xff,0x40,0x9f,0xfa,0x41,0x13,0xaf,0xfa,0x00,0x5e,0xff,
+  0xff,0xff,0xff,0xa1,0x00,0x01,0x6a,0xde,0xfd,0xa4,0x00,0x00,0x00,0x00,0x04,0xdf,0xb1,0x00,0x0b,0xfd,0x50,0x00,0x00,0x00,
+  0x00,0x04,0xdf,0xb1,0x00,0x1b,0xfd,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfd,0x20,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xf9,0x1e,0xff,0xa0,0x00,0x00,
+  0x00,0x00,0x00,0x0a,0xff,0xe1,0x05,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x60,0x00,0xbf,0xfd,0x00,0x00,0x00,0x00,
+  0x00,0xcf,0xfc,0x00,0x00,0x2f,0xff,0x70,0x00,0x00,0x00,0x06,0xff,0xf3,0x00,0x00,0x08,0xff,0xe1,0x00,0x00,0x00,0x1e,0xff,
+  0x90,0x00,0x00,0x01,0xdf,0xf9,0x00,0x00,0x00,0x8f,0xfe,0x10,0x00,0x00,0x00,0x5f,0xff,0x30,0x00,0x02,0xff,0xf5,0x00,0x00,
+  0x00,0x00,0x0b,0xff,0xc0,0x00,0x0b,0xff,0xb0,0x00,0x00,0x00,0x00,0x02,0xff,0xf6,0x00,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xfe,0x10,0xdf,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0x76,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+  0xff,0xdc,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,
+  0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x08,0xff,0xf9,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfe,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xb2,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xbf,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x60,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x02,0xef,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xd1,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xf8,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1d,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xfe,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x06,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0x00,0x00,0x00,0x00,0x8f,0xfe,0x30,
+  0x00,0x00,0x00,0x04,0xff,0xf4,0x00,0x00,0x00,0x00,0x0d,0xff,0x50,0x00,0x00,0x00,0x00,0x7f,0xf7,0x00,0x00,0x00,0x00,0x02,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0xff,
+  0xfe,0x4f,0xff,0xff,0xff,0xff,0xff,0xfd,0x00,0x00,0x00,0x00,0x02,0xef,0xf8,0x00,0x00,0x00,0x00,0x0b,0xff,0xc1,0x00,0x00,
+  0x00,0x00,0x7f,0xff,0x30,0x00,0x00,0x00,0x03,0xff,0xf6,0x00,0x00,0x00,0x00,0x1d,0xff,0xb0,0x00,0x00,0x00,0x00,0xaf,0xfe,
+  0x10,0x00,0x00,0x00,0x05,0xff,0xf4,0x00,0x00,0x00,0x00,0x2e,0xff,0x80,0x00,0x00,0x00,0x00,0xcf,0xfc,0x00,0x00,0x00,0x00,
+  0x08,0xff,0xe2,0x00,0x00,0x00,0x00,0x3f,0xff,0x60,0x00,0x00,0x00,0x01,0xdf,0xfa,0x00,0x00,0x00,0x00,0x0a,0xff,0xe1,0x00,
+  0x00,0x00,0x00,0x5f,0xff,0x40,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xf9,0xcf,0xff,0xff,0xff,0xff,0xff,0xf9,
+  0x00,0x00,0x00,0x00,0x2b,0xe9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xaf,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0xe9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x0c,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0xef,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xe2,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x7f,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xf9,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1d,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x05,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0x00,0x00,
+  0x01,0xbe,0xb1,0x00,0x00,0x00,0x00,0x08,0xff,0xf9,0x00,0x00,0x00,0x00,0x08,0xff,0xf9,0x00,0x00,0x00,0x00,0x01,0xbe,0xb1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0xff,0xfe,0x4f,0xff,0xff,0xff,0xff,0xff,0xfd,0x00,0x00,0x00,0x00,
+  0x02,0xef,0xf8,0x00,0x00,0x00,0x00,0x0b,0xff,0xc1,0x00,0x00,0x00,0x00,0x7f,0xff,0x30,0x00,0x00,0x00,0x03,0xff,0xf6,0x00,
+  0x00,0x00,0x00,0x1d,0xff,0xb0,0x00,0x00,0x00,0x00,0xaf,0xfe,0x10,0x00,0x00,0x00,0x05,0xff,0xf4,0x00,0x00,0x00,0x00,0x2e,
+  0xff,0x80,0x00,0x00,0x00,0x00,0xcf,0xfc,0x00,0x00,0x00,0x00,0x08,0xff,0xe2,0x00,0x00,0x00,0x00,0x3f,0xff,0x60,0x00,0x00,
+  0x00,0x01,0xdf,0xfa,0x00,0x00,0x00,0x00,0x0a,0xff,0xe1,0x00,0x00,0x00,0x00,0x5f,0xff,0x40,0x00,0x00,0x00,0x00,0xbf,0xff,
+  0xff,0xff,0xff,0xff,0xf9,0xcf,0xff,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x17,0x86,0x00,0x00,0x27,0x86,0x00,0x00,0x00,0x00,
+  0x03,0xef,0xc3,0x05,0xef,0xc1,0x00,0x00,0x00,0x00,0x00,0x2c,0xff,0xbf,0xfa,0x10,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xff,
+  0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x0c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x4f,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,
+  0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0x50,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0b,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xd1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x03,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xf7,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xaf,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,
+  0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xfe,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2e,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,
+  0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf4,0x00,0x6f,0xe5,0x00,0x04,0xef,0x60,0x00,0x08,0xff,0x50,0x4e,0xf8,0x00,
+  0x00,0x00,0xaf,0xf8,0xff,0xa0,0x00,0x00,0x00,0x0c,0xff,0xfc,0x10,0x00,0x00,0x00,0x01,0x78,0x71,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0xff,0xfe,0x4f,0xff,0xff,0xff,0xff,0xff,
+  0xfd,0x00,0x00,0x00,0x00,0x02,0xef,0xf8,0x00,0x00,0x00,0x00,0x0b,0xff,0xc1,0x00,0x00,0x00,0x00,0x7f,0xff,0x30,0x00,0x00,
+  0x00,0x03,0xff,0xf6,0x00,0x00,0x00,0x00,0x1d,0xff,0xb0,0x00,0x00,0x00,0x00,0xaf,0xfe,0x10,0x00,0x00,0x00,0x05,0xff,0xf4,
+  0x00,0x00,0x00,0x00,0x2e,0xff,0x80,0x00,0x00,0x00,0x00,0xcf,0xfc,0x00,0x00,0x00,0x00,0x08,0xff,0xe2,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0x60,0x00,0x00,0x00,0x01,0xdf,0xfa,0x00,0x00,0x00,0x00,0x0a,0xff,0xe1,0x00,0x00,0x00,0x00,0x5f,0xff,0x40,0x00,
+  0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xf9,0xcf,0xff,0xff,0xff,0xff,0xff,0xf9,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xb0,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xb0,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x4f,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x46,0x00,0x04,0xfe,0x10,0x1d,0xf6,0x00,0x7f,0xd0,0x00,0xcf,0x90,0x00,
+  0xef,0x90,0x00,0xef,0xc0,0x00,0xbf,0xf3,0x00,0x6f,0xa2,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x05,0xdf,0x30,0x07,0xff,0x70,
+  0x01,0xff,0xa0,0x00,0xdf,0xa0,0x00,0xdf,0x70,0x03,0xff,0x20,0x0b,0xf9,0x00,0x5f,0xc1,0x00,0x07,0x10,0x00,0x00,0x01,0x00,
+  0x03,0xbf,0x20,0x08,0xff,0x70,0x02,0xff,0x90,0x00,0xdf,0xa0,0x00,0xdf,0x80,0x02,0xff,0x30,0x09,0xfb,0x00,0x4f,0xe2,0x00,
+  0x19,0x30,0x00,0x00,0x46,0x00,0x01,0x81,0x04,0xfe,0x10,0x1d,0xf5,0x1d,0xf6,0x00,0x9f,0xb0,0x7f,0xd0,0x02,0xff,0x30,0xcf,
+  0x90,0x07,0xfe,0x00,0xef,0x90,0x09,0xfd,0x00,0xef,0xc0,0x09,0xff,0x20,0xbf,0xf3,0x06,0xff,0x80,0x6f,0xa2,0x01,0xec,0x40,
+  0x02,0x00,0x00,0x20,0x00,0x00,0x03,0x00,0x00,0x21,0x00,0x05,0xdf,0x30,0x2b,0xf7,0x00,0x07,0xff,0x70,0x2f,0xfc,0x00,0x01,
+  0xff,0xa0,0x0b,0xfe,0x00,0x00,0xdf,0xa0,0x08,0xfe,0x00,0x00,0xdf,0x70,0x08,0xfc,0x00,0x03,0xff,0x20,0x0d,0xf7,0x00,0x0b,
+  0xf9,0x00,0x6f,0xd1,0x00,0x5f,0xc1,0x01,0xee,0x30,0x00,0x07,0x10,0x00,0x44,0x00,0x00,0x00,0x01,0x00,0x00,0x10,0x00,0x03,
+  0xbf,0x20,0x19,0xe6,0x00,0x08,0xff,0x70,0x3f,0xfc,0x00,0x02,0xff,0x90,0x0c,0xfe,0x00,0x00,0xdf,0xa0,0x08,0xff,0x00,0x00,
+  0xdf,0x80,0x08,0xfd,0x00,0x02,0xff,0x30,0x0c,0xf8,0x00,0x09,0xfb,0x00,0x4f,0xe1,0x00,0x4f,0xe2,0x00,0xef,0x50,0x00,0x19,
+  0x30,0x00,0x76,0x00,0x00,0x00,0x00,0x00,0x5e,0xe8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xfb,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xf9,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,
+  0xf6,0x00,0x00,0x00,0x00,0x9f,0xed,0xba,0x9f,0xfb,0x9b,0xce,0xfc,0x10,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x30,0x00,
+  0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,
+  0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,
+  0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xf9,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x5f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xfa,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x6f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5e,
+  0xe9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5e,0xe8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xfb,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xf9,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,
+  0xf6,0x00,0x00,0x00,0x00,0x9f,0xed,0xba,0x9f,0xfb,0x9b,0xce,0xfc,0x10,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x30,0x00,
+  0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,
+  0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf6,0x00,0x00,
+  0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x30,0x9f,0xed,0xca,0x9f,0xfb,0xab,0xde,0xfc,0x10,0x00,0x00,0x00,0x2f,
+  0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x4f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xfa,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x6f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5e,
+  0xe9,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0xee,0xc8,0x10,0x00,0x00,0x2c,0xff,0xff,0xff,0xe4,0x00,0x01,0xdf,0xff,0xff,0xff,
+  0xff,0x30,0x09,0xff,0xff,0xff,0xff,0xff,0xd0,0x1e,0xff,0xff,0xff,0xff,0xff,0xf4,0x4f,0xff,0xff,0xff,0xff,0xff,0xf8,0x5f,
+  0xff,0xff,0xff,0xff,0xff,0xf9,0x4f,0xff,0xff,0xff,0xff,0xff,0xf8,0x1f,0xff,0xff,0xff,0xff,0xff,0xf4,0x09,0xff,0xff,0xff,
+  0xff,0xff,0xd0,0x01,0xdf,0xff,0xff,0xff,0xff,0x40,0x00,0x2c,0xff,0xff,0xff,0xe4,0x00,0x00,0x00,0x6c,0xee,0xc8,0x10,0x00,
+  0x09,0xec,0x30,0x00,0x00,0x9e,0xc3,0x00,0x00,0x09,0xec,0x30,0x5f,0xff,0xb0,0x00,0x05,0xff,0xfb,0x00,0x00,0x5f,0xff,0xc0,
+  0x5f,0xff,0xc0,0x00,0x05,0xff,0xfc,0x00,0x00,0x5f,0xff,0xc0,0x0a,0xec,0x30,0x00,0x00,0xae,0xc3,0x00,0x00,0x09,0xed,0x30,
+  0x00,0x18,0xdf,0xeb,0x50,0x00,0x00,0x00,0x00,0x00,0xaf,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0xff,
+  0xf9,0x00,0x00,0x00,0x00,0x07,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xfd,0x41,0x28,0xff,0x70,0x00,0x00,
+  0x00,0x4f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xf4,0x00,0x00,0x9f,0xe0,0x00,0x00,0x01,0xef,0xd1,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0x00,0x00,0x4f,0xf3,0x00,0x00,0x0b,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xaf,0xb0,0x00,0x00,0x1f,0xf5,0x00,0x00,0x7f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xbf,0xb0,0x00,0x00,0x1f,0xf5,0x00,0x04,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xd0,0x00,0x00,
+  0x3f,0xf3,0x00,0x1e,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xf3,0x00,0x00,0x9f,0xe0,0x00,0xbf,
+  0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xfd,0x51,0x28,0xff,0x60,0x07,0xff,0x60,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0xff,0xf9,0x00,0x4f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x18,0xdf,0xeb,0x50,0x01,0xdf,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x30,0x18,0xdf,0xea,0x30,0x00,0x00,0x02,0x9d,0xfd,0x92,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x7f,0xf7,0x02,0xdf,0xff,0xff,0xf6,0x00,0x00,0x4e,0xff,0xff,0xfe,0x40,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xa0,0x0c,
+  0xfd,0x41,0x3a,0xff,0x30,0x01,0xef,0xc3,0x13,0xcf,0xe1,0x00,0x00,0x00,0x00,0x00,0x1d,0xfd,0x10,0x5f,0xf3,0x00,0x00,0xcf,
+  0xa0,0x07,0xfe,0x10,0x00,0x1e,0xf8,0x00,0x00,0x00,0x00,0x00,0xbf,0xf3,0x00,0x9f,0xd0,0x00,0x00,0x7f,0xe0,0x0c,0xfa,0x00,
+  0x00,0x09,0xfc,0x00,0x00,0x00,0x00,0x07,0xff,0x70,0x00,0xcf,0xa0,0x00,0x00,0x4f,0xf2,0x0e,0xf7,0x00,0x00,0x06,0xff,0x00,
+  0x00,0x00,0x00,0x4f,0xfb,0x00,0x00,0xdf,0x90,0x00,0x00,0x3f,0xf3,0x0f,0xf7,0x00,0x00,0x06,0xff,0x10,0x00,0x00,0x01,0xdf,
+  0xd1,0x00,0x00,0xcf,0xa0,0x00,0x00,0x4f,0xf2,0x0e,0xf7,0x00,0x00,0x06,0xff,0x00,0x00,0x00,0x0b,0xff,0x30,0x00,0x00,0x9f,
+  0xc0,0x00,0x00,0x6f,0xe0,0x0c,0xfa,0x00,0x00,0x09,0xfc,0x00,0x00,0x00,0x7f,0xf7,0x00,0x00,0x00,0x5f,0xf3,0x00,0x00,0xcf,
+  0xa0,0x08,0xfe,0x10,0x00,0x1e,0xf8,0x00,0x00,0x04,0xff,0xb0,0x00,0x00,0x00,0x0c,0xfd,0x41,0x2a,0xff,0x30,0x01,0xef,0xc3,
+  0x13,0xbf,0xe1,0x00,0x00,0x1d,0xfd,0x10,0x00,0x00,0x00,0x02,0xdf,0xff,0xff,0xf5,0x00,0x00,0x4e,0xff,0xff,0xfe,0x30,0x00,
+  0x00,0xbf,0xe3,0x00,0x00,0x00,0x00,0x00,0x18,0xdf,0xea,0x30,0x00,0x00,0x02,0x9d,0xfd,0x92,0x00,0x00,0x00,0x00,0x10,0x00,
+  0x00,0x00,0xbd,0x20,0x00,0x06,0xff,0x20,0x00,0x1e,0xf8,0x00,0x00,0xaf,0xd1,0x00,0x04,0xff,0x40,0x00,0x1d,0xfa,0x00,0x00,
+  0x7f,0xe1,0x00,0x00,0x3f,0xf6,0x00,0x00,0x09,0xfe,0x10,0x00,0x01,0xdf,0x90,0x00,0x00,0x5f,0xf3,0x00,0x00,0x0a,0xfc,0x00,
+  0x00,0x01,0xef,0x30,0x00,0x00,0x56,0x00,0x01,0x10,0x00,0x00,0x3e,0x90,0x00,0x00,0x3f,0xf4,0x00,0x00,0x09,0xfd,0x10,0x00,
+  0x01,0xef,0x80,0x00,0x00,0x6f,0xf3,0x00,0x00,0x0c,0xfc,0x00,0x00,0x03,0xff,0x60,0x00,0x07,0xff,0x20,0x00,0x2f,0xf7,0x00,
+  0x00,0xbf,0xc0,0x00,0x05,0xff,0x30,0x00,0x1d,0xf8,0x00,0x00,0x5f,0xd1,0x00,0x00,0x07,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x17,0xbd,0xfe,0xda,0x60,0x00,0x00,0x00,0x00,0x06,0xef,0xff,0xff,0xff,0xfd,0x50,0x00,0x00,0x00,0x9f,0xfe,0x83,0x11,0x38,
+  0xff,0xf6,0x00,0x00,0x08,0xff,0xd2,0x00,0x00,0x00,0x3e,0xc1,0x00,0x00,0x3f,0xfe,0x20,0x00,0x00,0x00,0x01,0x10,0x00,0x00,
+  0xbf,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xb0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,
+  0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x00,0x00,0x00,0x1f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0x50,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xff,0xfe,0x20,
+  0x00,0x00,0x00,0x0d,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,
+  0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xf8,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x05,0x80,0x00,0x00,0x08,0xff,0xd2,0x00,0x00,0x00,0x6f,0xf8,
+  0x00,0x00,0x00,0xaf,0xfe,0x72,0x01,0x4a,0xff,0xf4,0x00,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xfc,0x30,0x00,0x00,0x00,0x00,
+  0x27,0xce,0xfe,0xc9,0x40,0x00,0xdf,0xff,0xff,0xff,0x90,0xaf,0xd1,0x00,0x00,0x07,0xff,0x20,0xdf,0xff,0xff,0xff,0x90,0xaf,
+  0xf8,0x00,0x00,0x2f,0xff,0x20,0x00,0x0b,0xf7,0x00,0x00,0xaf,0xff,0x20,0x00,0xaf,0xff,0x20,0x00,0x0b,0xf7,0x00,0x00,0xaf,
+  0xaf,0xa0,0x04,0xfd,0xcf,0x20,0x00,0x0b,0xf7,0x00,0x00,0xaf,0x4d,0xf4,0x0c,0xf5,0xcf,0x20,0x00,0x0b,0xf7,0x00,0x00,0xaf,
+  0x45,0xfc,0x5f,0xb0,0xcf,0x20,0x00,0x0b,0xf7,0x00,0x00,0xaf,0x40,0xbf,0xef,0x30,0xcf,0x20,0x00,0x0b,0xf7,0x00,0x00,0xaf,
+  0x40,0x3f,0xf9,0x00,0xcf,0x20,0x00,0x0b,0xf7,0x00,0x00,0xaf,0x40,0x07,0xa1,0x00,0xcf,0x20,0x00,0x0b,0xf7,0x00,0x00,0xaf,
+  0x40,0x00,0x00,0x00,0xcf,0x20,
+};
+
+// code, offset, w, h, dx, dy, advance (1/16 px), left/right kerning class
+const AaGlyph kGlyphs[] = {
+  {0x0020, 0, 0, 0, 0, 0, 112, 0, 0},
+  {0x0021, 0, 6, 25, 3, -25, 192, 0, 0},
+  {0x0022, 75, 10, 9, 2, -25, 224, 1, 1},
+  {0x0023, 120, 20, 25, 0, -25, 320, 0, 0},
+  {0x0024, 370, 18, 33, 1, -29, 320, 0, 0},
+  {0x0025, 667, 26, 25, 1, -25, 448, 0, 0},
+  {0x0026, 992, 24, 25, 1, -25, 400, 0, 2},
+  {0x0027, 1292, 4, 9, 2, -25, 128, 1, 1},
+  {0x0028, 1310, 7, 34, 2, -28, 176, 2, 0},
+  {0x0029, 1446, 7, 34, 1, -28, 176, 0, 3},
+  {0x002a, 1582, 12, 11, 1, -26, 224, 1, 1},
+  {0x002b, 1648, 18, 17, 1, -20, 320, 0, 0},
+  {0x002c, 1801, 5, 9, 1, -4, 112, 3, 4},
+  {0x002d, 1828, 10, 2, 1, -11, 192, 4, 5},
+  {0x002e, 1838, 5, 4, 1, -4, 112, 3, 4},
+  {0x002f, 1850, 15, 28, -1, -26, 208, 5, 2},
+  {0x0030, 2074, 19, 25, 1, -25, 320, 0, 0},
+  {0x0031, 2324, 16, 25, 3, -25, 320, 0, 0},
+  {0x0032, 2524, 18, 25, 1, -25, 320, 0, 0},
+  {0x0033, 2749, 18, 25, 1, -25, 320, 0, 0},
+  {0x0034, 2974, 20, 25, 0, -25, 320, 0, 0},
+  {0x0035, 3224, 17, 25, 1, -25, 320, 0, 0},
+  {0x0036, 3449, 18, 25, 1, -25, 320, 0, 0},
+  {0x0037, 3674, 18, 25, 1, -25, 320, 0, 0},
+  {0x0038, 3899, 18, 25, 1, -25, 320, 0, 0},
+  {0x0039, 4124, 17, 25, 2, -25, 320, 0, 0},
+  {0x003a, 4349, 5, 18, 2, -18, 144, 0, 6},
+  {0x003b, 4403, 5, 23, 2, -18, 144, 0, 6},
+  {0x003c, 4472, 15, 16, 2, -20, 320, 0, 0},
+  {0x003d, 4600, 16, 8, 2, -16, 320, 0, 0},
+  {0x003e, 4664, 14, 16, 4, -20, 320, 0, 0},
+  {0x003f, 4776, 14, 25, 0, -25, 224, 0, 7},
+  {0x0040, 4951, 27, 28, 1, -24, 464, 6, 8},
+  {0x0041, 5343, 24, 25, 0, -25, 384, 7, 2},
+  {0x0042, 5643, 18, 25, 3, -25, 368, 0, 0},
+  {0x0043, 5868, 22, 25, 1, -25, 384, 8, 8},
+  {0x0044, 6143, 22, 25, 3, -25, 416, 6, 0},
+  {0x0045, 6418, 16, 25, 3, -25, 320, 0, 0},
+  {0x0046, 6618, 16, 25, 3, -25, 320, 9, 0},
+  {0x0047, 6818, 23, 25, 1, -25, 416, 0, 8},
+  {0x0048, 7118, 21, 25, 3, -25, 416, 0, 0},
+  {0x0049, 7393, 5, 25, 3, -25, 176, 0, 0},
+  {0x004a, 7468, 12, 25, 1, -25, 256, 10, 9},
+  {0x004b, 7618, 21, 25, 3, -25, 384, 11, 0},
+  {0x004c, 7893, 15, 25, 3, -25, 288, 12, 0},
+  {0x004d, 8093, 27, 25, 3, -25, 512, 0, 0},
+  {0x004e, 8443, 21, 25, 3, -25, 416, 0, 0},
+  {0x004f, 8718, 26, 25, 1, -25, 448, 6, 8},
+  {0x0050, 9043, 18, 25, 3, -25, 336, 13, 0},
+  {0x0051, 9268, 27, 30, 1, -25, 448, 6, 8},
+  {0x0052, 9688, 19, 25, 3, -25, 368, 14, 0},
+  {0x0053, 9938, 17, 25, 1, -25, 304, 0, 0},
+  {0x0054, 10163, 21, 25, 0, -25, 336, 15, 10},
+  {0x0055, 10438, 21, 25, 2, -25, 416, 10, 11},
+  {0x0056, 10713, 24, 25, 0, -25, 384, 5, 12},
+  {0x0057, 11013, 36, 25, 0, -25, 576, 16, 13},
+  {0x0058, 11463, 23, 25, 0, -25, 368, 11, 14},
+  {0x0059, 11763, 22, 25, 0, -25, 352, 17, 15},
+  {0x005a, 12038, 20, 25, 1, -25, 352, 18, 16},
+  {0x005b, 12288, 7, 32, 2, -27, 176, 2, 0},
+  {0x005c, 12416, 15, 28, -1, -26, 208, 7, 12},
+  {0x005d, 12640, 8, 32, 1, -27, 176, 0, 3},
+  {0x005e, 12768, 16, 12, 2, -25, 320, 0, 0},
+  {0x005f, 12864, 14, 2, 0, 3, 224, 0, 0},
+  {0x0060, 12878, 8, 5, 0, -25, 176, 0, 0},
+  {0x0061, 12898, 15, 18, 1, -18, 288, 19, 17},
+  {0x0062, 13042, 17, 26, 2, -26, 320, 20, 0},
+  {0x0063, 13276, 15, 18, 1, -18, 256, 0, 18},
+  {0x0064, 13420, 16, 26, 1, -26, 320, 0, 18},
+  {0x0065, 13628, 16, 18, 1, -18, 288, 20, 18},
+  {0x0066, 13772, 12, 25, 0, -25, 192, 21, 19},
+  {0x0067, 13922, 18, 24, 0, -18, 288, 0, 20},
+  {0x0068, 14138, 16, 26, 2, -26, 304, 19, 0},
+  {0x0069, 14346, 5, 26, 2, -26, 144, 0, 0},
+  {0x006a, 14424, 8, 32, -1, -26, 144, 0, 0},
+  {0x006b, 14552, 16, 26, 2, -26, 288, 22, 0},
+  {0x006c, 14760, 5, 26, 2, -26, 144, 0, 0},
+  {0x006d, 14838, 25, 18, 2, -18, 464, 19, 6},
+  {0x006e, 15072, 16, 18, 2, -18, 304, 19, 6},
+  {0x006f, 15216, 18, 18, 1, -18, 304, 20, 18},
+  {0x0070, 15378, 17, 24, 2, -18, 304, 20, 6},
+  {0x0071, 15594, 16, 24, 1, -18, 320, 0, 18},
+  {0x0072, 15786, 12, 18, 2, -18, 224, 23, 6},
+  {0x0073, 15894, 13, 18, 1, -18, 240, 0, 21},
+  {0x0074, 16020, 13, 24, 0, -24, 208, 0, 22},
+  {0x0075, 16188, 15, 18, 2, -18, 304, 0, 6},
+  {0x0076, 16332, 18, 18, 0, -18, 288, 24, 23},
+  {0x0077, 16494, 27, 18, 0, -18, 432, 25, 24},
+  {0x0078, 16746, 18, 18, 0, -18, 288, 22, 25},
+  {0x0079, 16908, 18, 24, 0, -18, 288, 24, 23},
+  {0x007a, 17124, 14, 18, 1, -18, 256, 0, 26},
+  {0x007b, 17250, 9, 32, 0, -27, 176, 2, 0},
+  {0x007c, 17410, 3, 33, 4, -27, 176, 0, 0},
+  {0x007d, 17476, 9, 32, 1, -27, 176, 0, 3},
+  {0x007e, 17636, 17, 7, 2, -14, 320, 0, 0},
+  {0x00a0, 17699, 0, 0, 0, 0, 112, 0, 0},
+  {0x00a1, 17699, 6, 24, 3, -18, 192, 0, 0},
+  {0x00a2, 17771, 16, 26, 2, -22, 320, 0, 0},
+  {0x00a3, 17979, 20, 25, 0, -25, 320, 0, 0},
+  {0x00a4, 18229, 16, 16, 2, -20, 320, 0, 0},
+  {0x00a5, 18357, 20, 25, 0, -25, 320, 0, 0},
+  {0x00a6, 18607, 3, 33, 4, -27, 176, 0, 0},
+  {0x00a7, 18673, 14, 27, 2, -25, 288, 0, 0},
+  {0x00a8, 18862, 11, 2, 0, -23, 176, 0, 0},
+  {0x00a9, 18874, 26, 25, 1, -25, 448, 0, 0},
+  {0x00aa, 19199, 10, 11, 1, -25, 192, 1, 1},
+  {0x00ab, 19254, 12, 15, 2, -17, 256, 4, 5},
+  {0x00ac, 19344, 16, 7, 2, -13, 320, 0, 0},
+  {0x00ad, 19400, 10, 2, 1, -11, 192, 4, 5},
+  {0x00ae, 19410, 26, 25, 1, -25, 448, 6, 0},
+  {0x00af, 19735, 11, 2, 0, -24, 176, 0, 0},
+  {0x00b0, 19747, 12, 11, 1, -25, 224, 1, 1},
+  {0x00b1, 19813, 18, 19, 1, -20, 320, 0, 0},
+  {0x00b2, 19984, 10, 13, 1, -29, 192, 26, 27},
+  {0x00b3, 20049, 10, 13, 1, -29, 192, 26, 27},
+  {0x00b4, 20114, 8, 5, 3, -25, 176, 0, 0},
+  {0x00b5, 20134, 15, 24, 2, -18, 304, 0, 6},
+  {0x00b6, 20326, 23, 28, 0, -25, 368, 0, 0},
+  {0x00b7, 20662, 6, 5, 2, -13, 160, 4, 5},
+  {0x00b8, 20677, 7, 7, 2, -1, 176, 0, 0},
+  {0x00b9, 20705, 9, 13, 2, -29, 192, 26, 27},
+  {0x00ba, 20770, 12, 11, 1, -25, 208, 1, 1},
+  {0x00bb, 20836, 12, 15, 2, -17, 256, 4, 5},
+  {0x00bc, 20926, 24, 25, 1, -25, 400, 0, 0},
+  {0x00bd, 21226, 24, 25, 1, -25, 400, 0, 0},
+  {0x00be, 21526, 24, 25, 1, -25, 400, 0, 0},
+  {0x00bf, 21826, 14, 24, 0, -18, 224, 0, 0},
+  {0x00c0, 21994, 24, 31, 0, -31, 384, 7, 2},
+  {0x00c1, 22366, 24, 31, 0, -31, 384, 7, 2},
+  {0x00c2, 22738, 24, 31, 0, -31, 384, 7, 2},
+  {0x00c3, 23110, 24, 30, 0, -30, 384, 7, 2},
+  {0x00c4, 23470, 24, 29, 0, -29, 384, 7, 2},
+  {0x00c5, 23818, 24, 32, 0, -32, 384, 7, 2},
+  {0x00c6, 24202, 32, 25, -1, -25, 528, 0, 2},
+  {0x00c7, 24602, 22, 31, 1, -25, 384, 8, 8},
+  {0x00c8, 24943, 16, 31, 3, -31, 320, 0, 0},
+  {0x00c9, 25191, 16, 31, 3, -31, 320, 0, 0},
+  {0x00ca, 25439, 16, 31, 3, -31, 320, 0, 0},
+  {0x00cb, 25687, 16, 29, 3, -29, 320, 0, 0},
+  {0x00cc, 25919, 9, 31, -1, -31, 176, 0, 0},
+  {0x00cd, 26074, 10, 31, 2, -31, 176, 0, 0},
+  {0x00ce, 26229, 13, 31, -1, -31, 176, 0, 0},
+  {0x00cf, 26446, 13, 29, -1, -29, 176, 0, 0},
+  {0x00d0, 26649, 27, 25, 0, -25, 448, 6, 0},
+  {0x00d1, 26999, 21, 30, 3, -30, 416, 0, 0},
+  {0x00d2, 27329, 26, 31, 1, -31, 448, 6, 8},
+  {0x00d3, 27732, 26, 31, 1, -31, 448, 6, 8},
+  {0x00d4, 28135, 26, 31, 1, -31, 448, 6, 8},
+  {0x00d5, 28538, 26, 30, 1, -30, 448, 6, 8},
+  {0x00d6, 28928, 26, 29, 1, -29, 448, 6, 8},
+  {0x00d7, 29305, 16, 17, 2, -20, 320, 0, 0},
+  {0x00d8, 29441, 26, 29, 1, -27, 448, 0, 8},
+  {0x00d9, 29818, 21, 31, 2, -31, 416, 10, 11},
+  {0x00da, 30159, 21, 31, 2, -31, 416, 10, 11},
+  {0x00db, 30500, 21, 31, 2, -31, 416, 10, 11},
+  {0x00dc, 30841, 21, 29, 2, -29, 416, 10, 11},
+  {0x00dd, 31160, 22, 31, 0, -31, 352, 17, 15},
+  {0x00de, 31501, 18, 25, 3, -25, 336, 6, 0},
+  {0x00df, 31726, 17, 25, 3, -25, 336, 0, 0},
+  {0x00e0, 31951, 15, 25, 1, -25, 288, 19, 17},
+  {0x00e1, 32151, 15, 25, 1, -25, 288, 19, 17},
+  {0x00e2, 32351, 15, 25, 1, -25, 288, 19, 17},
+  {0x00e3, 32551, 15, 25, 1, -25, 288, 19, 17},
+  {0x00e4, 32751, 15, 23, 1, -23, 288, 19, 17},
+  {0x00e5, 32935, 15, 27, 1, -27, 288, 19, 17},
+  {0x00e6, 33151, 27, 18, 1, -18, 464, 20, 17},
+  {0x00e7, 33403, 15, 24, 1, -18, 256, 0, 18},
+  {0x00e8, 33595, 16, 25, 1, -25, 288, 20, 18},
+  {0x00e9, 33795, 16, 25, 1, -25, 288, 20, 18},
+  {0x00ea, 33995, 16, 25, 1, -25, 288, 20, 18},
+  {0x00eb, 34195, 16, 23, 1, -23, 288, 20, 18},
+  {0x00ec, 34379, 8, 25, -1, -25, 144, 0, 0},
+  {0x00ed, 34479, 8, 25, 2, -25, 144, 0, 0},
+  {0x00ee, 34579, 11, 25, -1, -25, 144, 0, 0},
+  {0x00ef, 34729, 11, 23, -1, -23, 144, 0, 0},
+  {0x00f0, 34867, 17, 25, 1, -25, 304, 0, 18},
+  {0x00f1, 35092, 16, 25, 2, -25, 304, 19, 6},
+  {0x00f2, 35292, 18, 25, 1, -25, 304, 20, 18},
+  {0x00f3, 35517, 18, 25, 1, -25, 304, 20, 18},
+  {0x00f4, 35742, 18, 25, 1, -25, 304, 20, 18},
+  {0x00f5, 35967, 18, 25, 1, -25, 304, 20, 18},
+  {0x00f6, 36192, 18, 23, 1, -23, 304, 20, 18},
+  {0x00f7, 36399, 18, 17, 1, -20, 320, 0, 0},
+  {0x00f8, 36552, 18, 21, 1, -20, 304, 20, 18},
+  {0x00f9, 36741, 15, 25, 2, -25, 304, 0, 6},
+  {0x00fa, 36941, 15, 25, 2, -25, 304, 0, 6},
+  {0x00fb, 37141, 15, 25, 2, -25, 304, 0, 6},
+  {0x00fc, 37341, 15, 23, 2, -23, 304, 0, 6},
+  {0x00fd, 37525, 18, 31, 0, -25, 288, 0, 0},
+  {0x00fe, 37804, 17, 32, 2, -26, 304, 20, 0},
+  {0x00ff, 38092, 18, 29, 0, -23, 288, 0, 0},
+  {0x0104, 38353, 25, 31, 0, -25, 384, 7, 2},
+  {0x0105, 38756, 17, 24, 1, -18, 288, 19, 17},
+  {0x0106, 38972, 22, 31, 1, -31, 384, 8, 8},
+  {0x0107, 39313, 15, 25, 1, -25, 256, 0, 18},
+  {0x0118, 39513, 16, 31, 3, -25, 336, 0, 0},
+  {0x0119, 39761, 16, 24, 1, -18, 288, 20, 18},
+  {0x0131, 39953, 5, 18, 2, -18, 144, 0, 0},
+  {0x0141, 40007, 19, 25, 0, -25, 304, 27, 0},
+  {0x0142, 40257, 11, 26, 0, -26, 176, 0, 0},
+  {0x0143, 40413, 21, 31, 3, -31, 416, 0, 0},
+  {0x0144, 40754, 16, 25, 2, -25, 304, 19, 6},
+  {0x0152, 40954, 36, 25, 1, -25, 608, 0, 8},
+  {0x0153, 41404, 28, 18, 1, -18, 480, 20, 18},
+  {0x015a, 41656, 17, 31, 1, -31, 304, 0, 0},
+  {0x015b, 41935, 13, 25, 1, -25, 240, 0, 0},
+  {0x0160, 42110, 17, 31, 1, -31, 304, 0, 0},
+  {0x0161, 42389, 13, 25, 1, -25, 240, 0, 0},
+  {0x0178, 42564, 22, 29, 0, -29, 352, 17, 15},
+  {0x0179, 42883, 20, 31, 1, -31, 352, 18, 16},
+  {0x017a, 43193, 14, 25, 1, -25, 256, 0, 0},
+  {0x017b, 43368, 20, 31, 1, -31, 352, 18, 16},
+  {0x017c, 43678, 14, 26, 1, -26, 256, 0, 0},
+  {0x017d, 43860, 20, 31, 1, -31, 352, 18, 16},
+  {0x017e, 44170, 14, 25, 1, -25, 256, 0, 0},
+  {0x2013, 44345, 15, 2, 2, -11, 304, 4, 5},
+  {0x2014, 44361, 24, 2, 2, -11, 464, 4, 5},
+  {0x2018, 44385, 5, 10, 1, -27, 112, 1, 1},
+  {0x2019, 44415, 5, 10, 1, -27, 112, 1, 1},
+  {0x201a, 44445, 5, 10, 1, -5, 112, 3, 4},
+  {0x201c, 44475, 10, 10, 1, -27, 208, 1, 1},
+  {0x201d, 44525, 11, 10, 1, -27, 208, 1, 1},
+  {0x201e, 44585, 11, 10, 1, -5, 208, 3, 4},
+  {0x2020, 44645, 17, 32, 2, -26, 320, 0, 0},
+  {0x2021, 44933, 17, 32, 2, -26, 320, 0, 0},
+  {0x2022, 45221, 14, 13, 3, -17, 320, 4, 5},
+  {0x2026, 45312, 23, 4, 1, -4, 400, 0, 0},
+  {0x2030, 45360, 39, 25, 1, -25, 640, 0, 0},
+  {0x2039, 45860, 7, 15, 2, -17, 176, 4, 5},
+  {0x203a, 45920, 7, 15, 2, -17, 176, 4, 5},
+  {0x20ac, 45980, 20, 25, 0, -25, 320, 0, 0},
+  {0x2122, 46230, 23, 10, 1, -25, 400, 1, 1},
+};
+
+// [left class][right class], 1/16 px
+const int8_t kKerning[28 * 28] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-51,0,-64,-50,0,0,-13,0,0,0,13,13,0,8,0,-18,-26,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,-11,0,0,0,0,0,0,0,0,0,-9,0,0,0,0,0,0,0,0,0,
+  0,-64,0,0,0,-38,0,0,-16,0,-50,0,-50,-34,0,-43,0,0,0,0,0,0,0,-37,-17,0,0,0,
+  0,-50,-15,0,-38,0,0,0,0,0,-50,0,-31,-9,-17,-45,-13,0,0,0,0,0,0,0,0,0,0,0,
+  0,13,-38,0,-54,-31,-25,13,-15,-43,0,0,0,0,0,0,0,-32,-32,-8,-38,-30,-12,-13,0,-15,-23,16,
+  0,-13,-12,-11,-16,0,0,0,0,0,-27,0,-15,0,-8,-22,-20,0,0,0,0,0,0,0,0,0,0,0,
+  0,-51,0,0,0,-15,0,-16,-12,14,-37,-16,-38,-24,0,-46,0,0,0,0,0,0,0,-23,0,0,0,-52,
+  0,0,0,0,0,-42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-37,0,-50,0,-17,8,0,-55,0,0,0,0,0,0,0,0,-20,0,0,0,0,0,0,0,0,0,
+  0,0,-16,0,-14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,-17,0,0,-8,0,0,0,0,0,0,0,0,0,-10,-15,0,0,-23,-18,-16,0,0,0,
+  0,-81,0,0,15,-55,0,-14,-22,0,-48,0,-51,-43,0,-59,0,0,-10,0,0,0,0,-30,-22,0,0,-57,
+  0,0,-39,0,-69,0,0,0,0,-51,0,0,0,0,0,0,0,-14,-8,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,-13,0,-15,-12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-37,0,-50,-50,-45,0,-27,-56,0,0,0,0,0,0,0,-70,-59,0,-53,-45,0,-50,-39,-40,-34,0,
+  0,13,-26,0,-34,-9,0,10,0,-29,0,0,0,0,0,0,0,-25,-9,0,-27,-13,0,0,0,0,0,13,
+  0,8,-46,0,-43,-45,-34,10,-22,-56,0,0,0,0,0,0,0,-36,-45,0,-48,-36,0,-28,-26,-37,0,14,
+  0,0,0,0,0,-20,0,10,-16,0,0,0,0,0,0,0,0,0,-11,0,0,-8,0,-11,0,0,0,0,
+  0,-20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,-4,0,0,-20,
+  0,-26,0,-9,0,0,0,0,0,0,0,0,-32,-9,0,0,0,0,0,0,0,0,0,-7,0,-17,0,0,
+  0,19,0,0,-36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-17,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,-37,0,0,0,0,0,0,0,0,0,0,0,0,-11,0,0,0,0,0,0,0,0,0,0,
+  0,0,-23,0,-37,0,0,0,0,0,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,-17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-52,0,0,0,0,0,0,0,0,0,16,16,0,11,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,-39,0,0,0,-36,0,0,0,0,0,0,-45,-34,0,-43,0,0,0,0,0,0,0,-16,0,0,0,-37,
+};
+
+} // namespace
+
+extern const AaFont kAaSans18 = {kBitmap, kGlyphs, 232, kKerning, 28, 43, 35, 8};
+
+} // namespace ui_gfx
@@ -0,0 +1,1418 @@
+// Generated by tools/make_font_atlas.py - do not edit
+// Lato Regular (SIL OFL 1.1), 47 px em, charset ascii: 95 glyphs, 641 kerning pairs in 26x27 classes, 30533 bitmap bytes
+#include "gfx/fonts/AaFonts.h"
+
+namespace ui_gfx {
+
+namespace {
+
+const uint8_t kBitmap[] = {
+  0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,
+  0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf2,0x0d,0xff,0xf1,0x0c,0xff,0xf1,
+  0x0c,0xff,0xf0,0x0b,0xff,0xe0,0x0a,0xff,0xd0,0x08,0xff,0xc0,0x07,0xff,0xb0,0x05,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xdd,0x80,0x6f,0xff,0xf8,0xcf,0xff,0xfd,0xcf,0xff,0xfd,0x7f,0xff,0xf8,
+  0x08,0xee,0x80,0x6f,0xff,0x30,0x00,0x9f,0xff,0x10,0x6f,0xff,0x30,0x00,0x9f,0xff,0x10,0x6f,0xff,0x30,0x00,0x9f,0xff,0x10,
+  0x6f,0xff,0x30,0x00,0x9f,0xff,0x10,0x6f,0xff,0x30,0x00,0x9f,0xff,0x10,0x6f,0xff,0x30,0x00,0x9f,0xff,0x10,0x6f,0xff,0x30,
+  0x00,0x9f,0xff,0x10,0x5f,0xff,0x20,0x00,0x8f,0xff,0x00,0x4f,0xff,0x10,0x00,0x6f,0xfd,0x00,0x2f,0xfe,0x00,0x00,0x5f,0xfb,
+  0x00,0x0f,0xfc,0x00,0x00,0x3f,0xfa,0x00,0x08,0xe6,0x00,0x00,0x0b,0xe4,0x00,0x00,0x00,0x00,0x00,0x07,0xef,0x90,0x00,0x00,
+  0x9f,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x60,0x00,0x00,0xdf,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x20,
+  0x00,0x01,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfe,0x00,0x00,0x04,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,
+  0xfb,0x00,0x00,0x07,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf7,0x00,0x00,0x0b,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,
+  0x03,0xff,0xf4,0x00,0x00,0x0e,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf1,0x00,0x00,0x2f,0xff,0x50,0x00,0x00,0x00,
+  0x00,0x00,0x09,0xff,0xc0,0x00,0x00,0x5f,0xff,0x10,0x00,0x00,0x01,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xd0,0x05,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x08,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xfd,0x40,0x00,0x00,0x00,0x4f,0xff,0x30,0x00,0x00,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0x00,0x00,0x03,
+  0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfc,0x00,0x00,0x06,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf9,0x00,
+  0x00,0x09,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf6,0x00,0x00,0x0c,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x03,0xff,
+  0xf3,0x00,0x00,0x0e,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf1,0x00,0x00,0x2f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x09,0xff,0xd0,0x00,0x00,0x5f,0xff,0x20,0x00,0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,0x00,
+  0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xf3,0x00,0x00,0x00,0x4f,0xff,0x30,0x00,0x00,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0x00,0x00,0x03,0xff,0xf4,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfc,0x00,0x00,0x06,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xf9,0x00,0x00,0x09,
+  0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf6,0x00,0x00,0x0c,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf3,0x00,
+  0x00,0x0f,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf0,0x00,0x00,0x3f,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,
+  0xc0,0x00,0x00,0x6f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x90,0x00,0x00,0x9f,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x1f,0xfc,0x20,0x00,0x00,0x4e,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xf0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xd0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xb0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0x7b,0xde,0xff,0xeb,0x84,0x00,0x00,0x00,0x00,0x00,0x01,0x9f,0xff,0xff,0xff,0xff,0xff,0xd5,0x00,0x00,
+  0x00,0x00,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb1,0x00,0x00,0x02,0xef,0xff,0xfe,0xa9,0xff,0xcc,0xff,0xff,0xfd,0x00,
+  0x00,0x0c,0xff,0xfe,0x50,0x04,0xff,0x60,0x18,0xef,0xf7,0x00,0x00,0x5f,0xff,0xe2,0x00,0x05,0xff,0x50,0x00,0x18,0x80,0x00,
+  0x00,0xaf,0xff,0x50,0x00,0x06,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x10,0x00,0x07,0xff,0x30,0x00,0x00,0x00,0x00,
+  0x00,0xff,0xfe,0x00,0x00,0x08,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x09,0xff,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xdf,0xff,0x60,0x00,0x0a,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xe3,0x00,0x0b,0xfd,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x4f,0xff,0xff,0x70,0x0c,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xff,0xfe,0x8e,0xfb,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0xbf,0xff,0xff,0xff,0xfc,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xfd,0x83,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x17,0xdf,0xff,0xff,0xff,0xff,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x9f,0xff,0xff,0xff,0xff,0x60,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x4f,0xfa,0xcf,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xf5,0x03,0xaf,0xff,0xfe,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x6f,0xf4,0x00,0x06,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x7f,0xf3,0x00,0x00,0x9f,0xff,0xb0,
+  0x00,0x00,0x00,0x00,0x00,0x8f,0xf1,0x00,0x00,0x3f,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x9f,0xf0,0x00,0x00,0x1f,0xff,0xd0,
+  0x00,0x00,0x00,0x00,0x00,0xaf,0xe0,0x00,0x00,0x2f,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0xbf,0xd0,0x00,0x00,0x6f,0xff,0x80,
+  0x00,0x75,0x00,0x00,0x00,0xdf,0xc0,0x00,0x00,0xcf,0xff,0x40,0x09,0xff,0xa1,0x00,0x00,0xef,0xb0,0x00,0x08,0xff,0xfc,0x00,
+  0x4f,0xff,0xfe,0x60,0x00,0xff,0xa0,0x02,0xaf,0xff,0xf4,0x00,0x1b,0xff,0xff,0xfe,0x97,0xff,0xb7,0xbf,0xff,0xff,0x70,0x00,
+  0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,0x00,0x02,0xaf,0xff,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0x00,
+  0x00,0x00,0x01,0x6a,0xdf,0xff,0xfe,0xc8,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0x50,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x06,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x08,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x09,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xce,0xfd,0x94,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0xdf,0xf9,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xc0,0x00,0x00,
+  0x00,0x7f,0xff,0xff,0xff,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xfe,0x20,0x00,0x00,0x03,0xff,0xfd,0x51,0x03,0xaf,
+  0xff,0x70,0x00,0x00,0x00,0x00,0x0a,0xff,0xf4,0x00,0x00,0x00,0x0a,0xff,0xd1,0x00,0x00,0x0a,0xff,0xe0,0x00,0x00,0x00,0x00,
+  0x6f,0xff,0x80,0x00,0x00,0x00,0x0e,0xff,0x60,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x03,0xff,0xfb,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0x20,0x00,0x00,0x00,0xcf,0xf7,0x00,0x00,0x00,0x1d,0xff,0xe1,0x00,0x00,0x00,0x00,0x4f,0xff,0x00,0x00,0x00,0x00,
+  0xaf,0xf8,0x00,0x00,0x00,0xaf,0xff,0x40,0x00,0x00,0x00,0x00,0x4f,0xff,0x00,0x00,0x00,0x00,0xaf,0xf9,0x00,0x00,0x07,0xff,
+  0xf7,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x20,0x00,0x00,0x00,0xcf,0xf7,0x00,0x00,0x3f,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,
+  0x0e,0xff,0x60,0x00,0x00,0x01,0xff,0xf4,0x00,0x01,0xdf,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xd1,0x00,0x00,0x09,
+  0xff,0xe0,0x00,0x0b,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xfc,0x41,0x13,0xaf,0xff,0x60,0x00,0x7f,0xff,0x70,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xfa,0x00,0x04,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x07,0xff,0xff,0xff,0xff,0x90,0x00,0x2e,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xce,0xfd,0x93,
+  0x00,0x00,0xbf,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf6,0x00,0x04,
+  0x9d,0xfe,0xc7,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0x90,0x00,0xaf,0xff,0xff,0xff,0xe4,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xfc,0x10,0x0b,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0c,0xff,0xe2,0x00,0x6f,0xff,0xa3,0x01,0x6e,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x50,0x00,0xdf,0xfa,
+  0x00,0x00,0x02,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf9,0x00,0x04,0xff,0xf2,0x00,0x00,0x00,0x8f,0xfc,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xc0,0x00,0x07,0xff,0xd0,0x00,0x00,0x00,0x4f,0xff,0x10,0x00,0x00,0x00,0x00,0x01,0xcf,
+  0xfe,0x20,0x00,0x09,0xff,0xa0,0x00,0x00,0x00,0x1f,0xff,0x20,0x00,0x00,0x00,0x00,0x09,0xff,0xf5,0x00,0x00,0x0a,0xff,0xa0,
+  0x00,0x00,0x00,0x0f,0xff,0x30,0x00,0x00,0x00,0x00,0x6f,0xff,0x80,0x00,0x00,0x09,0xff,0xa0,0x00,0x00,0x00,0x1f,0xff,0x20,
+  0x00,0x00,0x00,0x03,0xef,0xfb,0x00,0x00,0x00,0x08,0xff,0xc0,0x00,0x00,0x00,0x3f,0xff,0x10,0x00,0x00,0x00,0x1d,0xff,0xe2,
+  0x00,0x00,0x00,0x04,0xff,0xf2,0x00,0x00,0x00,0x8f,0xfc,0x00,0x00,0x00,0x00,0xaf,0xff,0x40,0x00,0x00,0x00,0x00,0xef,0xfa,
+  0x00,0x00,0x02,0xef,0xf6,0x00,0x00,0x00,0x06,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xa3,0x01,0x5d,0xff,0xd0,0x00,
+  0x00,0x00,0x3f,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xff,0xff,0xfe,0x30,0x00,0x00,0x01,0xdf,0xfd,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xaf,0xff,0xff,0xff,0xd3,0x00,0x00,0x00,0x0b,0xff,0xd3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+  0xad,0xfe,0xc7,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0xce,0xfe,0xc8,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3c,0xff,0xff,0xff,0xff,0xfa,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xff,0xfc,0x52,0x02,0x6e,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xbf,0xff,0xa0,0x00,0x00,0x02,0xdf,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xfe,0x10,0x00,0x00,0x00,0x4f,
+  0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf9,0x00,0x00,0x00,0x00,0x0c,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x07,0xff,0xf6,0x00,0x00,0x00,0x00,0x01,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x02,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x09,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0xe4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0xff,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x2c,0xff,0xff,0xef,0xff,0xf4,0x00,0x00,0x00,0x00,0x4e,0xff,0x10,0x00,0x00,0x03,0xef,0xff,0xc3,0x2e,0xff,0xff,0x40,0x00,
+  0x00,0x00,0x8f,0xfe,0x00,0x00,0x00,0x2e,0xff,0xfa,0x00,0x02,0xdf,0xff,0xf5,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xbf,
+  0xff,0xb0,0x00,0x00,0x2d,0xff,0xff,0x50,0x00,0x00,0xef,0xfa,0x00,0x00,0x04,0xff,0xfe,0x20,0x00,0x00,0x02,0xdf,0xff,0xf5,
+  0x00,0x03,0xff,0xf6,0x00,0x00,0x0a,0xff,0xf9,0x00,0x00,0x00,0x00,0x2d,0xff,0xff,0x50,0x09,0xff,0xf2,0x00,0x00,0x0e,0xff,
+  0xf5,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0xf5,0x1e,0xff,0xa0,0x00,0x00,0x0f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,
+  0xff,0xbf,0xff,0x40,0x00,0x00,0x0f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0xff,0xfb,0x00,0x00,0x00,0x0e,0xff,
+  0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xff,0xf2,0x00,0x00,0x00,0x0a,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+  0xff,0xff,0xf6,0x00,0x00,0x00,0x05,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x3d,0xff,0xff,0xff,0x60,0x00,0x00,0x00,0xbf,
+  0xff,0xf6,0x00,0x00,0x00,0x00,0x18,0xff,0xff,0xef,0xff,0xf6,0x00,0x00,0x00,0x2d,0xff,0xff,0xb5,0x20,0x12,0x5a,0xef,0xff,
+  0xf7,0x1c,0xff,0xff,0x60,0x00,0x00,0x02,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x30,0x01,0xcf,0xff,0xf6,0x00,0x00,0x00,
+  0x18,0xef,0xff,0xff,0xff,0xff,0xfc,0x50,0x00,0x00,0x1c,0xff,0xff,0x60,0x00,0x00,0x00,0x16,0xad,0xef,0xec,0xa7,0x20,0x00,
+  0x00,0x00,0x01,0xaf,0xff,0xf6,0x6f,0xff,0x30,0x6f,0xff,0x30,0x6f,0xff,0x30,0x6f,0xff,0x30,0x6f,0xff,0x30,0x6f,0xff,0x30,
+  0x6f,0xff,0x30,0x5f,0xff,0x20,0x4f,0xff,0x10,0x2f,0xfe,0x00,0x0f,0xfc,0x00,0x08,0xe6,0x00,0x00,0x00,0x00,0x30,0x00,0x00,
+  0x00,0x01,0xed,0x40,0x00,0x00,0x09,0xff,0xe0,0x00,0x00,0x2f,0xff,0xb0,0x00,0x00,0xaf,0xff,0x40,0x00,0x03,0xff,0xfb,0x00,
+  0x00,0x09,0xff,0xf4,0x00,0x00,0x1f,0xff,0xc0,0x00,0x00,0x7f,0xff,0x60,0x00,0x00,0xcf,0xfe,0x10,0x00,0x02,0xff,0xfa,0x00,
+  0x00,0x07,0xff,0xf6,0x00,0x00,0x0a,0xff,0xf1,0x00,0x00,0x0e,0xff,0xc0,0x00,0x00,0x2f,0xff,0x90,0x00,0x00,0x5f,0xff,0x60,
+  0x00,0x00,0x7f,0xff,0x40,0x00,0x00,0x9f,0xff,0x10,0x00,0x00,0xaf,0xff,0x00,0x00,0x00,0xbf,0xfe,0x00,0x00,0x00,0xcf,0xfd,
+  0x00,0x00,0x00,0xcf,0xfc,0x00,0x00,0x00,0xdf,0xfc,0x00,0x00,0x00,0xcf,0xfd,0x00,0x00,0x00,0xcf,0xfd,0x00,0x00,0x00,0xbf,
+  0xfe,0x00,0x00,0x00,0x9f,0xff,0x10,0x00,0x00,0x8f,0xff,0x30,0x00,0x00,0x6f,0xff,0x50,0x00,0x00,0x3f,0xff,0x80,0x00,0x00,
+  0x1f,0xff,0xb0,0x00,0x00,0x0c,0xff,0xe0,0x00,0x00,0x08,0xff,0xf4,0x00,0x00,0x04,0xff,0xf8,0x00,0x00,0x00,0xef,0xfd,0x00,
+  0x00,0x00,0x9f,0xff,0x40,0x00,0x00,0x4f,0xff,0x90,0x00,0x00,0x0c,0xff,0xf1,0x00,0x00,0x06,0xff,0xf8,0x00,0x00,0x00,0xdf,
+  0xfe,0x10,0x00,0x00,0x6f,0xff,0x80,0x00,0x00,0x0c,0xff,0xe0,0x00,0x00,0x04,0xff,0xa0,0x00,0x00,0x00,0x85,0x00,0x00,0x12,
+  0x00,0x00,0x00,0x06,0xeb,0x00,0x00,0x00,0x3f,0xff,0x50,0x00,0x00,0x1e,0xff,0xd1,0x00,0x00,0x07,0xff,0xf7,0x00,0x00,0x00,
+  0xdf,0xfe,0x10,0x00,0x00,0x7f,0xff,0x60,0x00,0x00,0x1e,0xff,0xc0,0x00,0x00,0x09,0xff,0xf4,0x00,0x00,0x03,0xff,0xf9,0x00,
+  0x00,0x00,0xdf,0xfe,0x00,0x00,0x00,0x9f,0xff,0x30,0x00,0x00,0x4f,0xff,0x70,0x00,0x00,0x1f,0xff,0xb0,0x00,0x00,0x0c,0xff,
+  0xe0,0x00,0x00,0x09,0xff,0xf1,0x00,0x00,0x07,0xff,0xf4,0x00,0x00,0x04,0xff,0xf5,0x00,0x00,0x03,0xff,0xf7,0x00,0x00,0x02,
+  0xff,0xf8,0x00,0x00,0x01,0xff,0xf9,0x00,0x00,0x00,0xff,0xf9,0x00,0x00,0x00,0xff,0xf9,0x00,0x00,0x01,0xff,0xf9,0x00,0x00,
+  0x01,0xff,0xf9,0x00,0x00,0x02,0xff,0xf8,0x00,0x00,0x04,0xff,0xf6,0x00,0x00,0x06,0xff,0xf5,0x00,0x00,0x08,0xff,0xf2,0x00,
+  0x00,0x0b,0xff,0xf0,0x00,0x00,0x0e,0xff,0xc0,0x00,0x00,0x3f,0xff,0x90,0x00,0x00,0x7f,0xff,0x50,0x00,0x00,0xbf,0xff,0x10,
+  0x00,0x01,0xff,0xfb,0x00,0x00,0x07,0xff,0xf6,0x00,0x00,0x0d,0xff,0xe1,0x00,0x00,0x4f,0xff,0x90,0x00,0x00,0xbf,0xff,0x30,
+  0x00,0x03,0xff,0xfa,0x00,0x00,0x0b,0xff,0xf3,0x00,0x00,0x3f,0xff,0x90,0x00,0x00,0x1c,0xfe,0x10,0x00,0x00,0x00,0x76,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xaf,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0x60,0x00,
+  0x00,0x00,0x2e,0x70,0x00,0xaf,0x60,0x02,0xac,0x00,0x7f,0xfd,0x50,0xaf,0x61,0x8e,0xff,0x30,0x04,0xdf,0xfb,0xaf,0x7d,0xff,
+  0xb2,0x00,0x00,0x07,0xef,0xef,0xff,0xd4,0x00,0x00,0x00,0x00,0x2c,0xff,0xfa,0x00,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xd4,
+  0x00,0x00,0x04,0xdf,0xfb,0xaf,0x8d,0xff,0xb2,0x00,0x7f,0xfd,0x50,0xaf,0x61,0x8e,0xff,0x30,0x2e,0x70,0x00,0xaf,0x60,0x02,
+  0xac,0x00,0x00,0x00,0x00,0xaf,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0x60,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xd0,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x08,0xee,0x80,0x6f,0xff,0xf6,0xbf,0xff,0xfb,0xaf,
+  0xff,0xfd,0x6f,0xff,0xfc,0x08,0xef,0xf9,0x00,0x0e,0xf5,0x00,0x4f,0xe0,0x00,0xcf,0x70,0x08,0xfd,0x00,0x5f,0xe3,0x00,0x5e,
+  0x40,0x00,0x02,0x00,0x00,0xaf,0xff,0xff,0xff,0xff,0xfe,0xaf,0xff,0xff,0xff,0xff,0xfe,0xaf,0xff,0xff,0xff,0xff,0xfe,0x08,
+  0xdd,0x70,0x7f,0xff,0xf7,0xdf,0xff,0xfc,0xdf,0xff,0xfc,0x8f,0xff,0xf7,0x08,0xee,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x06,0xef,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfc,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0b,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfc,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe1,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x9f,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xe0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xe0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xe0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x73,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xcd,0xfe,0xc9,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0xff,0xff,0xff,0xff,
+  0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x10,0x00,0x00,0x00,0x00,0x9f,0xff,0xfc,0x62,
+  0x02,0x5a,0xff,0xff,0xc1,0x00,0x00,0x00,0x06,0xff,0xff,0x70,0x00,0x00,0x00,0x5e,0xff,0xfa,0x00,0x00,0x00,0x2e,0xff,0xf7,
+  0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x40,0x00,0x00,0x9f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xd0,0x00,0x01,0xff,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xf4,0x00,0x06,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfa,0x00,
+  0x0b,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xfe,0x00,0x0e,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,
+  0xff,0x30,0x3f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0x60,0x5f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xbf,0xff,0x90,0x7f,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xa0,0x8f,0xff,0xc0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x8f,0xff,0xc0,0x9f,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xc0,0x9f,0xff,0xb0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xd0,0x9f,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xc0,0x8f,0xff,0xc0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xc0,0x7f,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xa0,0x5f,
+  0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0x90,0x3f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,
+  0x60,0x0f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0x40,0x0b,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x05,
+  0xff,0xfe,0x00,0x07,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfa,0x00,0x01,0xff,0xff,0x40,0x00,0x00,0x00,0x00,
+  0x00,0x2f,0xff,0xf4,0x00,0x00,0x9f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xd0,0x00,0x00,0x2e,0xff,0xf7,0x00,0x00,
+  0x00,0x00,0x04,0xff,0xff,0x50,0x00,0x00,0x06,0xff,0xff,0x70,0x00,0x00,0x00,0x5e,0xff,0xfa,0x00,0x00,0x00,0x00,0x9f,0xff,
+  0xfc,0x62,0x01,0x5a,0xff,0xff,0xc1,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x10,0x00,0x00,0x00,0x00,
+  0x00,0x4d,0xff,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xcd,0xfe,0xc9,0x50,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xbf,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0xef,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x08,0xff,
+  0xff,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x01,0xaf,0xff,0xfc,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x1c,0xff,0xff,0xb1,0xff,
+  0xff,0x30,0x00,0x00,0x00,0x03,0xdf,0xff,0xf8,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x1e,0xff,0xff,0x60,0x00,0xff,0xff,0x30,
+  0x00,0x00,0x00,0x08,0xff,0xe4,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x9a,0x20,0x00,0x00,0xff,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xc0,0x00,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0x00,0x4f,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xc0,0x00,0x00,0x00,0x02,0x7b,0xde,0xfd,0xb8,0x30,0x00,0x00,0x00,0x00,0x00,0x03,0xbf,0xff,0xff,0xff,0xff,0xfb,
+  0x20,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xe5,0x00,0x00,0x00,0x06,0xff,0xff,0xd6,0x20,0x13,0x7e,0xff,
+  0xff,0x40,0x00,0x00,0x3f,0xff,0xf9,0x00,0x00,0x00,0x01,0xbf,0xff,0xd1,0x00,0x00,0xbf,0xff,0x90,0x00,0x00,0x00,0x00,0x1d,
+  0xff,0xf7,0x00,0x03,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x07,0xff,0xfc,0x00,0x08,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x03,
+  0xff,0xff,0x10,0x0b,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0x20,0x01,0x46,0x40,0x00,0x00,0x00,0x00,0x00,0x01,
+  0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+  0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,
+  0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,
+  0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,
+  0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0xe3,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0xe3,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xfe,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0xe4,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xf5,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x4f,0xff,0xff,0xdb,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0x90,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xe0,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x00,0x00,0x00,0x01,0x6a,0xde,0xfe,0xda,0x61,
+  0x00,0x00,0x00,0x00,0x00,0x01,0x9f,0xff,0xff,0xff,0xff,0xff,0x81,0x00,0x00,0x00,0x00,0x3e,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xfd,0x20,0x00,0x00,0x03,0xef,0xff,0xe8,0x41,0x01,0x5a,0xff,0xff,0xd1,0x00,0x00,0x1d,0xff,0xfc,0x20,0x00,0x00,0x00,0x5f,
+  0xff,0xf8,0x00,0x00,0x7f,0xff,0xd1,0x00,0x00,0x00,0x00,0x07,0xff,0xfe,0x00,0x00,0xdf,0xff,0x50,0x00,0x00,0x00,0x00,0x01,
+  0xff,0xff,0x30,0x02,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0x50,0x03,0xbd,0xe5,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xbf,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+  0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xaf,
+  0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x25,0x9e,0xff,0xfb,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xff,0xfa,
+  0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xff,0xe9,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,
+  0xfb,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x24,0x7c,0xff,0xff,0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5e,
+  0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x9f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x1f,0xff,0xf1,0x00,0x35,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xf1,0x3c,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x2f,0xff,0xf0,0x2f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x0a,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xdf,0xff,0x70,0x04,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x08,0xff,0xfe,0x20,0x00,0xaf,0xff,0xf6,0x00,0x00,0x00,0x00,0x8f,
+  0xff,0xf7,0x00,0x00,0x1d,0xff,0xff,0xc5,0x20,0x12,0x7d,0xff,0xff,0x90,0x00,0x00,0x02,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xf8,0x00,0x00,0x00,0x00,0x08,0xef,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0x00,0x00,0x00,0x00,0x16,0xac,0xef,0xed,0xb8,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0xcf,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xff,0xf3,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xfa,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0x87,
+  0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfc,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x5f,0xff,0xe2,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0x40,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1c,0xff,0xf7,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xb0,0x00,0x07,0xff,0xf3,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xfd,0x10,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf3,0x00,
+  0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0x70,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x0b,
+  0xff,0xfa,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xd1,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,
+  0x00,0x00,0x05,0xff,0xfe,0x30,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x2e,0xff,0xf6,0x00,0x00,0x00,0x00,0x07,
+  0xff,0xf3,0x00,0x00,0x00,0x01,0xdf,0xff,0x90,0x00,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x0a,0xff,0xfc,0x10,0x00,
+  0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x0e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x50,0x0b,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x50,0x05,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+  0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x07,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0x00,0x00,0x4f,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x60,0x00,0x00,0xaf,0xfd,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x03,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x09,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xba,0xce,0xef,0xec,0x95,0x00,0x00,0x00,0x00,0x6f,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xd6,0x00,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa1,0x00,0x00,0x49,0xed,0x95,0x21,
+  0x01,0x48,0xef,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xaf,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,
+  0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xfe,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xfd,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf8,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1e,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xc0,0x00,0x55,0x00,0x00,0x00,0x00,
+  0x00,0x03,0xff,0xff,0x40,0x06,0xff,0xc3,0x00,0x00,0x00,0x00,0x5e,0xff,0xf9,0x00,0x2e,0xff,0xff,0xb6,0x21,0x02,0x5b,0xff,
+  0xff,0xb0,0x00,0x2a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x4a,0xff,0xff,0xff,0xff,0xff,0xfb,0x40,0x00,
+  0x00,0x00,0x00,0x16,0x9c,0xdf,0xed,0xb7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xdf,0xff,0xb0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xe2,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf5,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xcf,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x5f,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1d,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x75,0xad,0xef,0xdb,0x72,0x00,0x00,0x00,
+  0x00,0x05,0xff,0xfe,0xdf,0xff,0xff,0xff,0xff,0xa1,0x00,0x00,0x00,0x1e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x30,0x00,
+  0x00,0x9f,0xff,0xff,0xc6,0x21,0x13,0x7d,0xff,0xff,0xe2,0x00,0x02,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x8f,0xff,0xfb,0x00,
+  0x08,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0x40,0x0d,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xa0,
+  0x2f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xe0,0x5f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf1,
+  0x6f,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xf3,0x6f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf3,
+  0x5f,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xf1,0x3f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,
+  0x0e,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x0a,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x40,
+  0x03,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x0b,0xff,0xfc,0x00,0x00,0x9f,0xff,0xe3,0x00,0x00,0x00,0x01,0xaf,0xff,0xe3,0x00,
+  0x00,0x0c,0xff,0xff,0xa4,0x10,0x13,0x8e,0xff,0xff,0x50,0x00,0x00,0x01,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0x00,0x00,
+  0x00,0x00,0x06,0xdf,0xff,0xff,0xff,0xff,0xf9,0x20,0x00,0x00,0x00,0x00,0x00,0x05,0x9c,0xef,0xed,0xa6,0x20,0x00,0x00,0x00,
+  0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,
+  0x4e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf2,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf2,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf2,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1e,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0xef,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1e,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xef,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1e,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0xef,0xfd,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x9c,0xef,0xed,0xa6,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0xe9,0x10,0x00,0x00,0x00,0x01,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xd2,0x00,0x00,
+  0x00,0x0c,0xff,0xff,0xa4,0x10,0x13,0x8e,0xff,0xfe,0x20,0x00,0x00,0x8f,0xff,0xe4,0x00,0x00,0x00,0x02,0xdf,0xff,0xb0,0x00,
+  0x01,0xef,0xff,0x50,0x00,0x00,0x00,0x00,0x2f,0xff,0xf3,0x00,0x05,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf8,0x00,
+  0x07,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xfa,0x00,0x08,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xfb,0x00,
+  0x07,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xfa,0x00,0x04,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf7,0x00,
+  0x00,0xdf,0xff,0x50,0x00,0x00,0x00,0x00,0x3f,0xff,0xf2,0x00,0x00,0x5f,0xff,0xe4,0x00,0x00,0x00,0x02,0xdf,0xff,0x80,0x00,
+  0x00,0x07,0xff,0xff,0x94,0x10,0x13,0x8e,0xff,0xfa,0x00,0x00,0x00,0x00,0x4d,0xff,0xff,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,
+  0x00,0x00,0x02,0xcf,0xff,0xff,0xff,0xff,0xd4,0x00,0x00,0x00,0x00,0x02,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xb3,0x00,0x00,
+  0x00,0x4e,0xff,0xfe,0x84,0x10,0x13,0x7d,0xff,0xff,0x60,0x00,0x03,0xef,0xff,0xb1,0x00,0x00,0x00,0x00,0x9f,0xff,0xf5,0x00,
+  0x0c,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xfe,0x10,0x4f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x70,
+  0x8f,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xb0,0xaf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xd0,
+  0xbf,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xe0,0xaf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xd0,
+  0x8f,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xb0,0x4f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x70,
+  0x0d,0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0x20,0x05,0xff,0xff,0xb1,0x00,0x00,0x00,0x00,0x9f,0xff,0xf7,0x00,
+  0x00,0x8f,0xff,0xfe,0x84,0x10,0x13,0x7d,0xff,0xff,0xb0,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x00,0x00,
+  0x00,0x00,0x3b,0xff,0xff,0xff,0xff,0xff,0xfc,0x50,0x00,0x00,0x00,0x00,0x00,0x27,0xad,0xef,0xed,0xb8,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x05,0x9c,0xef,0xed,0xa5,0x10,0x00,0x00,0x00,0x00,0x00,0x07,0xdf,0xff,0xff,0xff,0xff,0xe7,0x00,0x00,0x00,
+  0x00,0x02,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xb1,0x00,0x00,0x00,0x1d,0xff,0xff,0x94,0x10,0x14,0x9f,0xff,0xfc,0x10,0x00,
+  0x00,0xcf,0xff,0xc2,0x00,0x00,0x00,0x02,0xcf,0xff,0x90,0x00,0x06,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x2e,0xff,0xf3,0x00,
+  0x0d,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xf9,0x00,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xfe,0x00,
+  0x6f,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0x20,0x7f,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0x40,
+  0x7f,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0x50,0x6f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x40,
+  0x3f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x30,0x0d,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xfe,0x00,
+  0x05,0xff,0xff,0xa1,0x00,0x00,0x00,0x03,0xdf,0xff,0xfa,0x00,0x00,0xbf,0xff,0xfd,0x73,0x10,0x25,0xaf,0xff,0xff,0xf5,0x00,
+  0x00,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0x00,0x00,0x00,0x8e,0xff,0xff,0xff,0xff,0xe9,0xff,0xff,0x50,0x00,
+  0x00,0x00,0x01,0x7b,0xdf,0xed,0xa6,0x1c,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xe2,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xfb,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0x50,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0xd1,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1c,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x06,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xdf,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x7f,0xff,0xe9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xed,0x70,0x8f,0xff,0xf6,0xdf,0xff,0xfb,0xdf,0xff,0xfb,
+  0x8f,0xff,0xf6,0x19,0xed,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xed,0x70,0x8f,0xff,0xf6,0xdf,0xff,0xfb,
+  0xdf,0xff,0xfb,0x8f,0xff,0xf6,0x19,0xed,0x70,0x08,0xed,0x70,0x8f,0xff,0xf6,0xdf,0xff,0xfb,0xdf,0xff,0xfb,0x8f,0xff,0xf6,
+  0x19,0xed,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xee,0x70,0x7f,0xff,0xf5,0xcf,0xff,0xfa,0xbf,0xff,0xfc,
+  0x7f,0xff,0xfb,0x08,0xef,0xf9,0x00,0x0e,0xf4,0x00,0x5f,0xd0,0x00,0xdf,0x60,0x09,0xfc,0x00,0x6f,0xe2,0x00,0x6e,0x30,0x00,
+  0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x90,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xef,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x06,0xdf,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x05,0xdf,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x05,0xcf,0xff,0xff,0xc4,0x00,
+  0x00,0x00,0x00,0x04,0xcf,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x04,0xcf,0xff,0xff,0xc5,0x00,0x00,0x00,0x00,0x03,0xbf,0xff,
+  0xff,0xc5,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xc5,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xfc,0x60,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x19,0xff,0xff,0xfe,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xff,0xff,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x2a,0xff,0xff,0xfd,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0xff,0xff,0xfd,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,
+  0xff,0xff,0xfd,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xfd,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb0,0x7f,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xb0,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb0,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb0,0x7f,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6a,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xf9,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf8,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0xff,0xe8,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xaf,0xff,0xff,0xe7,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0xaf,0xff,
+  0xff,0xe7,0x10,0x00,0x00,0x00,0x00,0x00,0x03,0xaf,0xff,0xff,0xe6,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xaf,0xff,0xff,0xd6,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xbf,0xff,0xff,0xd5,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xaf,0xff,0xff,0xa0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x4a,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x5c,0xff,0xff,0xfb,0x30,0x00,0x00,0x00,0x00,0x5c,0xff,
+  0xff,0xfb,0x30,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xfc,0x40,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xfc,0x50,0x00,0x00,0x00,
+  0x00,0x4c,0xff,0xff,0xfd,0x50,0x00,0x00,0x00,0x00,0x1b,0xff,0xff,0xfd,0x60,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xfe,0x60,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xfe,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0x81,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0xbd,0xef,0xeb,0x82,0x00,0x00,0x00,0x3b,0xff,
+  0xff,0xff,0xff,0xff,0x91,0x00,0x08,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x10,0x0c,0xff,0xfa,0x52,0x01,0x39,0xff,0xff,0xb0,
+  0x03,0xec,0x30,0x00,0x00,0x00,0x4e,0xff,0xf4,0x00,0x10,0x00,0x00,0x00,0x00,0x07,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x02,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xfb,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x03,0xef,0xff,0x80,
+  0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x19,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x01,0xcf,0xff,
+  0xe5,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfd,0x20,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x4f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xea,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xf2,
+  0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xeb,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x16,0x9c,0xde,0xfe,0xda,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xe8,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe8,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xfb,0x74,0x11,0x01,0x25,0x8c,0xff,0xff,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xaf,0xff,0xf9,0x20,0x00,0x00,0x00,0x00,0x00,0x39,0xff,0xfe,0x40,0x00,0x00,0x00,0x00,0x0b,0xff,0xfb,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3d,0xff,0xe3,0x00,0x00,0x00,0x00,0xaf,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,
+  0xfd,0x10,0x00,0x00,0x07,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0x90,0x00,0x00,0x2f,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf3,0x00,0x00,0xbf,0xfb,0x00,0x00,0x00,0x00,0x00,0x38,
+  0xce,0xff,0xeb,0x82,0x00,0x00,0x9f,0xf9,0x00,0x03,0xff,0xf3,0x00,0x00,0x00,0x00,0x3b,0xff,0xff,0xff,0xff,0xfd,0x00,0x00,
+  0x2f,0xfe,0x00,0x0a,0xff,0xa0,0x00,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xff,0xfa,0x00,0x00,0x0b,0xff,0x40,0x1e,0xff,0x30,
+  0x00,0x00,0x00,0x9f,0xff,0xf9,0x41,0x02,0xcf,0xf6,0x00,0x00,0x08,0xff,0x70,0x5f,0xfc,0x00,0x00,0x00,0x07,0xff,0xfb,0x20,
+  0x00,0x00,0xef,0xf2,0x00,0x00,0x06,0xff,0x90,0x8f,0xf8,0x00,0x00,0x00,0x3f,0xff,0xb0,0x00,0x00,0x03,0xff,0xd0,0x00,0x00,
+  0x04,0xff,0xa0,0xbf,0xf5,0x00,0x00,0x00,0xbf,0xfd,0x10,0x00,0x00,0x07,0xff,0x90,0x00,0x00,0x04,0xff,0xb0,0xdf,0xf3,0x00,
+  0x00,0x03,0xff,0xf5,0x00,0x00,0x00,0x0b,0xff,0x50,0x00,0x00,0x05,0xff,0xa0,0xef,0xf2,0x00,0x00,0x07,0xff,0xd0,0x00,0x00,
+  0x00,0x1f,0xff,0x10,0x00,0x00,0x06,0xff,0x90,0xff,0xf2,0x00,0x00,0x0b,0xff,0x90,0x00,0x00,0x00,0x4f,0xfc,0x00,0x00,0x00,
+  0x0a,0xff,0x60,0xef,0xf2,0x00,0x00,0x0d,0xff,0x60,0x00,0x00,0x00,0x9f,0xf9,0x00,0x00,0x00,0x0e,0xff,0x20,0xdf,0xf3,0x00,
+  0x00,0x0e,0xff,0x50,0x00,0x00,0x01,0xef,0xf7,0x00,0x00,0x00,0x5f,0xfd,0x00,0xbf,0xf5,0x00,0x00,0x0d,0xff,0x70,0x00,0x00,
+  0x07,0xff,0xf6,0x00,0x00,0x01,0xdf,0xf6,0x00,0x9f,0xf8,0x00,0x00,0x0b,0xff,0xd0,0x00,0x00,0x4f,0xff,0xf9,0x00,0x00,0x0b,
+  0xff,0xd0,0x00,0x6f,0xfc,0x00,0x00,0x07,0xff,0xfa,0x31,0x28,0xff,0xbe,0xff,0x61,0x15,0xcf,0xff,0x30,0x00,0x2f,0xff,0x20,
+  0x00,0x01,0xef,0xff,0xff,0xff,0xfd,0x1a,0xff,0xff,0xff,0xff,0xf5,0x00,0x00,0x0c,0xff,0x80,0x00,0x00,0x4f,0xff,0xff,0xff,
+  0xc1,0x02,0xef,0xff,0xff,0xfd,0x30,0x00,0x00,0x05,0xff,0xf2,0x00,0x00,0x02,0x9d,0xfd,0xb5,0x00,0x00,0x29,0xdf,0xdb,0x50,
+  0x00,0x00,0x00,0x00,0xdf,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,
+  0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0xfb,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xb6,0x00,0x00,0x00,0x00,0x02,
+  0xcf,0xff,0xf9,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0xdf,0xfd,0x00,0x00,0x00,0x00,0x00,0x19,0xff,0xff,0xfd,0x95,0x32,
+  0x10,0x12,0x36,0x8c,0xff,0xff,0xf9,0x10,0x00,0x00,0x00,0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe9,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x15,0x8b,0xde,0xff,0xed,0xca,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,
+  0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,
+  0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x08,0xff,0xfb,0xbf,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xf6,0x6f,
+  0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xf1,0x1e,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xcf,0xff,0xa0,0x0a,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x40,0x04,
+  0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xfd,0x00,0x00,0xdf,0xff,0x90,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1e,0xff,0xf7,0x00,0x00,0x7f,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf2,0x00,0x00,
+  0x1f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xa0,0x00,0x00,0x0a,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xff,0x50,0x00,0x00,0x04,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xfd,0x00,0x00,0x00,
+  0x00,0xdf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xf8,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x7f,0xff,0xf2,0x00,0x00,0x00,0x00,0x1f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xb0,0x00,0x00,0x00,
+  0x00,0x0a,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x40,0x00,0x00,0x00,
+  0x00,0x0a,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xa0,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xf2,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,
+  0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x04,0xff,0xff,0x40,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xff,0x50,0x00,0x00,0x0b,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xb0,0x00,0x00,
+  0x2f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf2,0x00,0x00,0x8f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1f,0xff,0xf8,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfe,0x00,0x05,
+  0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x60,0x0b,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xdf,0xff,0xc0,0x2f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf3,0x8f,
+  0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xf9,0xef,0xff,0xff,0xff,0xff,0xfe,0xed,0xb8,0x40,
+  0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x70,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xfd,0x20,0x00,0xef,0xff,0xa0,0x00,0x00,0x01,0x14,0x8d,0xff,0xff,0xd2,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x01,0x9f,
+  0xff,0xfa,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0x20,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x04,
+  0xff,0xff,0x60,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x90,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xdf,0xff,0xa0,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xa0,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x01,
+  0xff,0xff,0x70,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x20,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x1d,
+  0xff,0xf9,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x02,0xcf,0xff,0xc1,0x00,0xef,0xff,0xa0,0x00,0x00,0x01,0x25,0xaf,0xff,
+  0xfa,0x10,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x50,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd8,
+  0x30,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x11,0x48,0xdf,
+  0xff,0xf9,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x19,0xff,0xff,0x80,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xaf,0xff,0xf2,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf8,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0c,0xff,0xfb,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfc,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0b,0xff,0xfb,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfa,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0xf5,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xe1,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x1a,
+  0xff,0xff,0x60,0xef,0xff,0xa0,0x00,0x00,0x00,0x01,0x48,0xef,0xff,0xfa,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0x80,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb3,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xfe,0xda,0x72,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x7a,0xde,0xff,0xed,0xb9,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xa3,0x00,0x00,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb2,0x00,
+  0x00,0x00,0x01,0xbf,0xff,0xff,0xc8,0x42,0x10,0x13,0x6b,0xff,0xff,0xfe,0x10,0x00,0x00,0x2d,0xff,0xff,0xc4,0x00,0x00,0x00,
+  0x00,0x00,0x3b,0xff,0xf6,0x00,0x00,0x01,0xdf,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0xa0,0x00,0x00,0x0b,0xff,
+  0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0xef,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x50,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xe0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xdf,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xd0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xaf,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x20,0x00,
+  0x00,0x03,0xff,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xaf,0xe2,0x00,0x00,0x00,0x6f,0xff,0xff,0xa2,0x00,0x00,0x00,
+  0x00,0x00,0x5d,0xff,0xfd,0x10,0x00,0x00,0x04,0xef,0xff,0xff,0xb6,0x31,0x00,0x24,0x8c,0xff,0xff,0xf7,0x00,0x00,0x00,0x00,
+  0x2b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x30,0x00,0x00,0x00,0x00,0x00,0x4b,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,
+  0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0xac,0xef,0xfe,0xdc,0x96,0x20,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xec,0xa6,0x20,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0x00,0x00,0x00,
+  0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x30,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x01,0x25,0x9d,
+  0xff,0xff,0xf6,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0xff,0xff,0x90,0x00,0x00,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xcf,0xff,0xf7,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xff,
+  0xff,0x40,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0xd0,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xf6,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfe,0x00,
+  0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x50,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xff,0xff,0xa0,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xd0,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf1,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x8f,0xff,0xf3,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf4,0xef,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf4,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf4,
+  0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf3,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xaf,0xff,0xf1,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xd0,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xa0,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,
+  0xff,0xff,0x50,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfe,0x10,0xef,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xf7,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xd0,0x00,
+  0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0x40,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0xbf,0xff,0xf7,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0xff,0xff,0x90,0x00,0x00,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x01,0x25,0x9d,0xff,0xff,0xf6,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x30,
+  0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xec,0xa6,0x20,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xef,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xef,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xfc,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xd0,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x70,0x00,0xef,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0x70,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x70,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x7a,0xce,0xff,
+  0xee,0xca,0x74,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xe9,0x40,0x00,0x00,0x00,0x00,
+  0x07,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x20,0x00,0x00,0x01,0xbf,0xff,0xff,0xc8,0x42,0x10,0x12,0x58,0xdf,
+  0xff,0xff,0xe1,0x00,0x00,0x3e,0xff,0xff,0xc3,0x00,0x00,0x00,0x00,0x00,0x04,0xcf,0xff,0x80,0x00,0x02,0xef,0xff,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xec,0x10,0x00,0x1d,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x7f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xdf,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xff,0xff,0xf9,0xcf,0xff,0xe0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xff,0xff,0xf9,0xaf,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,
+  0xff,0xff,0xf9,0x7f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf9,0x3f,0xff,0xf8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf9,0x0d,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf9,
+  0x07,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf9,0x01,0xef,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x08,0xff,0xf9,0x00,0x7f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf9,0x00,0x0c,0xff,
+  0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf9,0x00,0x01,0xdf,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x08,0xff,0xf9,0x00,0x00,0x3d,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x02,0x9f,0xff,0xf9,0x00,0x00,0x01,0xcf,0xff,0xff,
+  0xc8,0x42,0x10,0x12,0x47,0xcf,0xff,0xff,0xf9,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x92,
+  0x00,0x00,0x00,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x8b,0xde,0xff,
+  0xee,0xda,0x85,0x20,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,
+  0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+  0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,
+  0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xf6,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+  0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,
+  0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0xef,0xff,
+  0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,
+  0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,
+  0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,
+  0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,
+  0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x3f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xe0,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0x80,0x00,
+  0x00,0x00,0x00,0x2c,0xff,0xfe,0x10,0x05,0x41,0x01,0x38,0xef,0xff,0xf5,0x00,0x5f,0xff,0xff,0xff,0xff,0xff,0x60,0x00,0x7f,
+  0xff,0xff,0xff,0xff,0xc3,0x00,0x00,0x5a,0xce,0xff,0xdc,0x84,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x2b,0xff,0xfe,0x20,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0xe3,0x00,0x7f,0xff,0xf1,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1d,0xff,0xfe,0x40,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x01,0xcf,0xff,0xf4,0x00,0x00,0x7f,
+  0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x1b,0xff,0xff,0x50,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xf6,
+  0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x0a,0xff,0xff,0x70,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,
+  0x9f,0xff,0xf8,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x08,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,
+  0x00,0x00,0x00,0x7f,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x06,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x00,0x7f,0xff,0xf1,0x00,0x00,0x5f,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x04,0xff,0xff,0xb1,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x01,0x6e,0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,
+  0xff,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,
+  0xff,0xff,0xff,0xff,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x3c,0xff,0xff,0x90,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x01,0xdf,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x2e,0xff,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x04,0xff,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,
+  0x00,0x00,0x00,0x6f,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x08,0xff,0xff,0xb0,0x00,0x00,0x00,
+  0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0xaf,0xff,0xf9,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x1c,0xff,
+  0xff,0x60,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0xf4,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,
+  0x00,0x00,0x00,0x3f,0xff,0xfe,0x20,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xd1,0x00,0x00,0x7f,
+  0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xfb,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,
+  0xff,0x80,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xcf,0xff,0xf6,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x2d,0xff,0xff,0x30,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xcf,0xff,0xe2,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0xef,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xf3,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0xef,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf2,0xef,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+  0xff,0xff,0xf2,0xef,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xf2,0xef,0xff,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xff,0xf2,0xef,0xff,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xf2,0xef,0xff,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,
+  0xff,0xff,0xf2,0xef,0xff,0xcf,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xed,0xff,0xf2,0xef,0xff,0x5f,
+  0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x7d,0xff,0xf2,0xef,0xff,0x1a,0xff,0xf7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x03,0xff,0xfd,0x0d,0xff,0xf2,0xef,0xff,0x12,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xf6,
+  0x0d,0xff,0xf2,0xef,0xff,0x10,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xc0,0x0d,0xff,0xf2,0xef,0xff,0x10,
+  0x1e,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0x40,0x0d,0xff,0xf2,0xef,0xff,0x10,0x07,0xff,0xfb,0x00,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xfb,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0xdf,0xff,0x50,0x00,0x00,0x00,0x00,0x1e,0xff,0xf3,0x00,
+  0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x5f,0xff,0xd0,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,
+  0x00,0x0c,0xff,0xf7,0x00,0x00,0x00,0x02,0xff,0xff,0x20,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x03,0xff,0xfe,0x10,0x00,
+  0x00,0x0a,0xff,0xf8,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0xaf,0xff,0x90,0x00,0x00,0x3f,0xff,0xe1,0x00,0x00,
+  0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x2f,0xff,0xf3,0x00,0x00,0xcf,0xff,0x70,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,
+  0x00,0x00,0x08,0xff,0xfb,0x00,0x05,0xff,0xfd,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x01,0xef,0xff,0x50,
+  0x0d,0xff,0xf5,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x00,0x7f,0xff,0xd0,0x7f,0xff,0xc0,0x00,0x00,0x00,
+  0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x00,0x0d,0xff,0xf5,0xdf,0xff,0x40,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,
+  0x00,0x00,0x00,0x05,0xff,0xfe,0xff,0xfa,0x00,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0xbf,0xff,
+  0xff,0xf2,0x00,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x0a,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,
+  0x00,0x00,0x00,0x00,0x02,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x13,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf2,0xef,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x09,0xff,0xf6,0xef,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0xff,0xd1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0xff,
+  0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x8f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,
+  0xf6,0xef,0xff,0x1b,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x11,0xdf,0xff,0xb0,0x00,0x00,0x00,
+  0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x10,0x3f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x10,0x06,0xff,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0xaf,0xff,0xe2,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,
+  0xff,0x10,0x00,0x1d,0xff,0xfc,0x00,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0x02,0xef,0xff,0x80,0x00,0x00,0x00,
+  0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x5f,0xff,0xf5,0x00,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x09,0xff,
+  0xfe,0x20,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0xcf,0xff,0xc1,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x10,
+  0x00,0x00,0x00,0x2e,0xff,0xfa,0x00,0x00,0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x04,0xff,0xff,0x60,0x00,0x09,0xff,
+  0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x8f,0xff,0xf3,0x00,0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x0b,0xff,
+  0xfd,0x10,0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xb0,0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x3f,0xff,0xf7,0x09,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x49,0xff,0xf6,0xef,
+  0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xea,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,
+  0xff,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x5f,0xff,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0xf6,0xef,0xff,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,
+  0xf6,0xef,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xdf,0xf6,0x00,0x00,0x00,0x00,0x00,0x04,0x8b,0xde,0xff,
+  0xec,0xa6,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x30,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xff,0xff,
+  0xb7,0x32,0x01,0x24,0x9d,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0xff,0xa2,0x00,0x00,0x00,0x00,0x00,0x6e,0xff,
+  0xff,0x90,0x00,0x00,0x00,0x01,0xdf,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xff,0xf7,0x00,0x00,0x00,0x0b,0xff,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xff,0x40,0x00,0x00,0x6f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xdf,0xff,0xe1,0x00,0x01,0xef,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xf7,0x00,
+  0x07,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfe,0x10,0x0d,0xff,0xfc,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x60,0x3f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xff,0xff,0xb0,0x6f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xe0,0x9f,0xff,0xf1,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf2,0xbf,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x7f,0xff,0xf4,0xcf,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf5,0xdf,
+  0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xf5,0xcf,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf5,0xbf,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,
+  0xff,0xf4,0x9f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf2,0x6f,0xff,0xf4,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xe0,0x3f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xff,0xff,0xb0,0x0d,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x60,0x07,0xff,
+  0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfe,0x10,0x01,0xef,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3f,0xff,0xf7,0x00,0x00,0x7f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xe1,
+  0x00,0x00,0x0c,0xff,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xff,0x50,0x00,0x00,0x01,0xdf,0xff,0xe5,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xff,0xf8,0x00,0x00,0x00,0x00,0x3e,0xff,0xff,0xa2,0x00,0x00,0x00,0x00,0x00,0x6d,0xff,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x02,0xcf,0xff,0xff,0xb6,0x32,0x01,0x24,0x9d,0xff,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x08,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xef,0xff,0xff,0xff,0xff,
+  0xff,0xfc,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x8b,0xde,0xff,0xec,0xa6,0x20,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xff,0xff,0xff,0xfe,0xdc,0x96,0x20,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x40,0x00,0x00,
+  0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x01,0x25,0xaf,0xff,0xff,0xb0,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x02,0xcf,0xff,0xf8,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xff,0x20,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x70,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xc0,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xe0,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf0,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xf0,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xd0,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xa0,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x60,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x3e,0xff,0xfd,0x10,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x04,0xef,0xff,0xf5,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x01,0x36,0xcf,0xff,0xff,0x70,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe6,0x00,0x00,
+  0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe9,0x20,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xfe,0xdc,0x85,0x10,0x00,0x00,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x8b,0xde,0xff,0xec,0xa6,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xef,0xff,0xff,0xff,0xff,0xff,0xfb,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xff,0xff,
+  0xb7,0x32,0x01,0x24,0x9d,0xff,0xff,0xe5,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0xff,0xa2,0x00,0x00,0x00,0x00,0x00,0x6e,
+  0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xff,0xf6,0x00,0x00,0x00,
+  0x00,0x0b,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xff,0x30,0x00,0x00,0x00,0x6f,0xff,0xf6,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xd0,0x00,0x00,0x01,0xef,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x4f,0xff,0xf6,0x00,0x00,0x07,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xfd,0x00,0x00,
+  0x0d,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x50,0x00,0x3f,0xff,0xf8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xa0,0x00,0x6f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xcf,0xff,0xd0,0x00,0x9f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf1,0x00,
+  0xbf,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf3,0x00,0xcf,0xff,0xd0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf5,0x00,0xdf,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x5f,0xff,0xf5,0x00,0xcf,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf5,0x00,
+  0xbf,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf4,0x00,0x9f,0xff,0xf1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf3,0x00,0x6f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xbf,0xff,0xf0,0x00,0x3f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xc0,0x00,
+  0x0d,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x80,0x00,0x07,0xff,0xff,0x40,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0x30,0x00,0x01,0xef,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xff,0xfb,0x00,0x00,0x00,0x7f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xf4,0x00,0x00,
+  0x00,0x0c,0xff,0xfe,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xff,0xa0,0x00,0x00,0x00,0x01,0xdf,0xff,0xe5,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x3e,0xff,0xff,0xa2,0x00,0x00,0x00,0x00,0x00,0x6d,
+  0xff,0xff,0xe3,0x00,0x00,0x00,0x00,0x00,0x02,0xcf,0xff,0xff,0xb6,0x32,0x01,0x24,0x9d,0xff,0xff,0xfe,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x08,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x8b,0xde,0xfe,0xed,0xa8,0x7f,
+  0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xc1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x6f,0xff,0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xc1,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x67,0x88,0x50,0x7f,0xff,0xff,0xff,0xff,0xfe,0xdb,0x96,0x10,0x00,0x00,0x00,
+  0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x20,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,
+  0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x01,0x36,0xbf,0xff,0xff,0x70,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x04,
+  0xef,0xff,0xf3,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xfb,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,
+  0x00,0x00,0x08,0xff,0xff,0x10,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x40,0x00,0x7f,0xff,0xf1,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xff,0xff,0x50,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0x50,0x00,0x7f,0xff,
+  0xf1,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x40,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x10,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfb,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf4,
+  0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x19,0xff,0xff,0x90,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x12,0x48,0xef,0xff,
+  0xfa,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x70,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xfe,0x81,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x02,
+  0xaf,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x0c,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,
+  0x00,0x00,0x02,0xef,0xff,0xd1,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x6f,0xff,0xfa,0x00,0x00,0x00,0x00,0x7f,
+  0xff,0xf1,0x00,0x00,0x00,0x0a,0xff,0xff,0x60,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x01,0xdf,0xff,0xf3,0x00,0x00,
+  0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x3f,0xff,0xfd,0x10,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x07,0xff,0xff,
+  0xa0,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xf6,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,
+  0x1e,0xff,0xfe,0x20,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xc1,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x8f,0xff,0xf9,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0x50,0x7f,0xff,0xf1,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0xbf,0xff,0xe2,0x00,0x00,0x00,0x02,0x6b,0xde,0xfe,0xda,0x73,0x00,0x00,0x00,0x00,0x00,0x01,
+  0x9f,0xff,0xff,0xff,0xff,0xff,0xd6,0x00,0x00,0x00,0x00,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc2,0x00,0x00,0x02,0xef,
+  0xff,0xd7,0x31,0x01,0x49,0xef,0xff,0xe1,0x00,0x00,0x0c,0xff,0xfa,0x10,0x00,0x00,0x00,0x19,0xff,0x80,0x00,0x00,0x6f,0xff,
+  0xc0,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0xbf,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,
+  0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,
+  0xfc,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0xf9,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,
+  0xff,0xff,0xfc,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xff,0xff,0xff,0xc6,0x10,0x00,0x00,0x00,0x00,0x00,0x5e,
+  0xff,0xff,0xff,0xff,0xff,0xe8,0x10,0x00,0x00,0x00,0x00,0x02,0x9f,0xff,0xff,0xff,0xff,0xff,0xe5,0x00,0x00,0x00,0x00,0x00,
+  0x01,0x6c,0xff,0xff,0xff,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0xbf,0xff,0xff,0xff,0xe2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x7e,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xbf,0xff,0xfe,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xfc,0x00,0x00,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xf7,0x00,0x07,0xfe,0x60,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xe1,0x00,0x2f,0xff,0xfa,0x20,0x00,0x00,0x00,0x04,0xef,0xff,0x70,0x00,0x5f,0xff,0xff,
+  0xfa,0x52,0x10,0x25,0xaf,0xff,0xfa,0x00,0x00,0x03,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0x00,0x05,0xcf,
+  0xff,0xff,0xff,0xff,0xff,0xc4,0x00,0x00,0x00,0x00,0x00,0x03,0x6a,0xcd,0xfe,0xdc,0x84,0x00,0x00,0x00,0x00,0x5f,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0x5f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xf0,0x5f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,
+  0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,
+  0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,
+  0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,
+  0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,
+  0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x4f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0f,0xff,0xf9,0x3f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf9,0x3f,0xff,0xf5,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf8,0x1f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xf6,0x0f,
+  0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf5,0x0b,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x6f,0xff,0xf1,0x07,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xc0,0x02,0xff,0xff,0x70,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0xff,0xff,0x60,0x00,0x9f,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfd,0x00,0x00,0x2e,0xff,
+  0xfc,0x10,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xf5,0x00,0x00,0x04,0xff,0xff,0xd4,0x00,0x00,0x00,0x00,0x1a,0xff,0xff,0x90,
+  0x00,0x00,0x00,0x5f,0xff,0xff,0xb6,0x21,0x02,0x49,0xef,0xff,0xf9,0x00,0x00,0x00,0x00,0x03,0xdf,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x07,0xef,0xff,0xff,0xff,0xff,0xff,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+  0x8c,0xde,0xfd,0xca,0x51,0x00,0x00,0x00,0x00,0x9f,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,
+  0xf8,0x3f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf2,0x0c,0xff,0xfe,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xb0,0x05,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,
+  0x40,0x00,0xef,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfd,0x00,0x00,0x8f,0xff,0xf3,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xf7,0x00,0x00,0x2f,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf1,
+  0x00,0x00,0x0a,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x90,0x00,0x00,0x04,0xff,0xff,0x60,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x30,0x00,0x00,0x00,0xdf,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfc,0x00,
+  0x00,0x00,0x00,0x7f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xf6,0x00,0x00,0x00,0x00,0x1e,0xff,0xfa,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xbf,0xff,0xe1,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x80,0x00,
+  0x00,0x00,0x00,0x03,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xd0,0x00,
+  0x00,0x00,0x00,0x0e,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xf4,0x00,0x00,0x00,0x00,0x5f,0xff,0xf5,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0e,0xff,0xfa,0x00,0x00,0x00,0x00,0xbf,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0x20,
+  0x00,0x00,0x02,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x80,0x00,0x00,0x08,0xff,0xff,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xd0,0x00,0x00,0x0e,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xf5,
+  0x00,0x00,0x6f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfb,0x00,0x00,0xcf,0xff,0xc0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x20,0x03,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,
+  0x80,0x09,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xe0,0x1e,0xff,0xf8,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf5,0x5f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,
+  0xf9,0x9f,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xfd,0xdf,0xff,0x50,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,
+  0xff,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,
+  0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xe4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfc,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xff,0xf6,0x3f,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x70,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf1,0x0d,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0xc0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xb0,0x08,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xff,0xf2,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x60,0x04,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xff,0xf7,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0x20,0x00,0xef,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xff,0xfc,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfc,0x00,0x00,0x9f,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xfd,0xef,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf7,0x00,0x00,0x4f,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xf9,0xaf,0xff,0x80,
+  0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf2,0x00,0x00,0x0e,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf4,0x6f,0xff,0xd0,
+  0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xd0,0x00,0x00,0x0a,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x1f,0xff,0xe0,0x1f,0xff,0xf3,
+  0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x80,0x00,0x00,0x05,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x6f,0xff,0x90,0x0a,0xff,0xf8,
+  0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x30,0x00,0x00,0x01,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0xbf,0xff,0x40,0x05,0xff,0xfd,
+  0x00,0x00,0x00,0x00,0x0b,0xff,0xfd,0x00,0x00,0x00,0x00,0xaf,0xff,0xf2,0x00,0x00,0x00,0x01,0xff,0xfe,0x00,0x01,0xff,0xff,
+  0x30,0x00,0x00,0x00,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x6f,0xff,0xf6,0x00,0x00,0x00,0x06,0xff,0xf9,0x00,0x00,0xaf,0xff,
+  0x80,0x00,0x00,0x00,0x5f,0xff,0xf4,0x00,0x00,0x00,0x00,0x1f,0xff,0xfb,0x00,0x00,0x00,0x0c,0xff,0xf4,0x00,0x00,0x5f,0xff,
+  0xd0,0x00,0x00,0x00,0x9f,0xff,0xe0,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0x10,0x00,0x00,0x2f,0xff,0xd0,0x00,0x00,0x1e,0xff,
+  0xf4,0x00,0x00,0x00,0xef,0xff,0x90,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x50,0x00,0x00,0x7f,0xff,0x80,0x00,0x00,0x0a,0xff,
+  0xf9,0x00,0x00,0x03,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0xa0,0x00,0x00,0xcf,0xff,0x30,0x00,0x00,0x05,0xff,
+  0xfe,0x00,0x00,0x08,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xe0,0x00,0x02,0xff,0xfd,0x00,0x00,0x00,0x00,0xef,
+  0xff,0x40,0x00,0x0d,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf4,0x00,0x07,0xff,0xf8,0x00,0x00,0x00,0x00,0xaf,
+  0xff,0x90,0x00,0x2f,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf8,0x00,0x0d,0xff,0xf3,0x00,0x00,0x00,0x00,0x4f,
+  0xff,0xe0,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xfd,0x00,0x3f,0xff,0xd0,0x00,0x00,0x00,0x00,0x0e,
+  0xff,0xf5,0x00,0xbf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0x20,0x8f,0xff,0x80,0x00,0x00,0x00,0x00,0x09,
+  0xff,0xfa,0x01,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x70,0xdf,0xff,0x30,0x00,0x00,0x00,0x00,0x04,
+  0xff,0xfe,0x15,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xb3,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xef,0xff,0x5a,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xe7,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x9f,0xff,0x9d,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xfd,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x4f,0xff,0xdf,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0e,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x09,0xff,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x04,0xff,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xdf,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xe2,
+  0x03,0xff,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x60,0x00,0x7f,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x2f,0xff,0xfb,0x00,0x00,0x0c,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xe1,0x00,0x00,0x02,0xef,
+  0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x50,0x00,0x00,0x00,0x6f,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,
+  0xf9,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0xcf,0xff,0xd1,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0xe1,
+  0x00,0x00,0x00,0x08,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xf9,0x00,0x00,0x00,0x3f,0xff,0xf8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0a,0xff,0xff,0x40,0x00,0x00,0xcf,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xd1,0x00,0x08,
+  0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xf9,0x00,0x3f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x08,0xff,0xff,0x30,0xdf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xd7,0xff,0xfe,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+  0xff,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xca,0xff,
+  0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x41,0xef,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x2e,0xff,0xf8,0x00,0x6f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xd1,0x00,0x0b,0xff,0xfe,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x40,0x00,0x02,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf8,
+  0x00,0x00,0x00,0x7f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xd1,0x00,0x00,0x00,0x0c,0xff,0xfe,0x20,0x00,0x00,
+  0x00,0x00,0x08,0xff,0xff,0x30,0x00,0x00,0x00,0x03,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x3f,0xff,0xf8,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0xf7,0x00,0x00,0x00,0x01,0xdf,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xff,0x20,0x00,0x00,0x09,0xff,
+  0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xc0,0x00,0x00,0x4f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,
+  0xff,0xf7,0x00,0x01,0xdf,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xff,0x30,0x0a,0xff,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xc0,0x5f,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xf8,
+  0x8f,0xff,0xe5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xf2,0x0d,0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x06,0xff,0xff,0x70,0x04,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xfd,0x00,0x00,0xaf,0xff,
+  0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xf4,0x00,0x00,0x1e,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,
+  0xff,0x90,0x00,0x00,0x06,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xfe,0x10,0x00,0x00,0x00,0xcf,0xff,0xe1,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xff,0xf6,0x00,0x00,0x00,0x00,0x3f,0xff,0xf9,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0xb0,0x00,0x00,
+  0x00,0x00,0x08,0xff,0xff,0x40,0x00,0x00,0x00,0x09,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xc0,0x00,0x00,0x00,
+  0x3f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xf6,0x00,0x00,0x00,0xcf,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0a,0xff,0xfe,0x10,0x00,0x06,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0xa0,0x00,0x1e,0xff,0xfa,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf4,0x00,0x9f,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,
+  0xfc,0x02,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x4a,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xbf,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xff,0xff,
+  0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xbf,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xf8,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x8f,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xfe,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xf3,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,
+  0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,
+  0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0b,0xff,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x03,0xff,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x9f,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1e,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xfd,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0x70,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xe2,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0xaf,0xff,0xff,0xff,0xf0,0xaf,0xff,0xff,0xff,0xf0,0xaf,0xff,
+  0xff,0xff,0xa0,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,
+  0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,
+  0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,
+  0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,
+  0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,
+  0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,
+  0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,
+  0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0xaf,0xff,0xff,0xff,
+  0xa0,0xaf,0xff,0xff,0xff,0xf0,0xaf,0xff,0xff,0xff,0xf0,0x4f,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0x70,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf5,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0d,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf5,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0d,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+  0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xe1,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,
+  0xe1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfc,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x06,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xfd,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x78,0x40,0xdf,0xff,0xff,
+  0xff,0xc0,0xdf,0xff,0xff,0xff,0xc0,0x9f,0xff,0xff,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,
+  0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,
+  0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,
+  0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,
+  0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,
+  0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,
+  0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,
+  0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x0c,0xff,0xc0,
+  0x00,0x00,0x0c,0xff,0xc0,0x9f,0xff,0xff,0xff,0xc0,0xdf,0xff,0xff,0xff,0xc0,0xdf,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,
+  0x3f,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,
+  0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xaf,0xff,0x50,
+  0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xfe,0x1d,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf7,0x05,0xff,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x2e,0xff,0xd0,0x00,0xcf,0xfe,0x10,0x00,0x00,0x00,0x00,0xaf,0xff,0x50,0x00,0x3f,0xff,0x90,0x00,0x00,0x00,
+  0x03,0xff,0xfc,0x00,0x00,0x0a,0xff,0xf2,0x00,0x00,0x00,0x0b,0xff,0xf3,0x00,0x00,0x02,0xef,0xfb,0x00,0x00,0x00,0x5f,0xff,
+  0xa0,0x00,0x00,0x00,0x7f,0xff,0x40,0x00,0x00,0xdf,0xfe,0x20,0x00,0x00,0x00,0x1d,0xff,0xc0,0x00,0x07,0xff,0xf8,0x00,0x00,
+  0x00,0x00,0x05,0xff,0xf6,0x00,0x1e,0xff,0xb1,0x00,0x00,0x00,0x00,0x00,0xaf,0xfe,0x10,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0x0a,
+  0xff,0xfe,0x50,0x00,0x00,0x00,0xaf,0xff,0xe1,0x00,0x00,0x00,0x0b,0xff,0xfa,0x00,0x00,0x00,0x01,0xcf,0xff,0x50,0x00,0x00,
+  0x00,0x1c,0xff,0xd1,0x00,0x00,0x00,0x01,0xdf,0xf9,0x00,0x00,0x00,0x00,0x17,0x87,0x10,0x00,0x00,0x02,0x6a,0xce,0xfe,0xc8,
+  0x20,0x00,0x00,0x00,0x03,0xaf,0xff,0xff,0xff,0xff,0xf9,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xb0,0x00,0x07,
+  0xff,0xff,0xc6,0x21,0x03,0x8f,0xff,0xf8,0x00,0x01,0xef,0xd5,0x00,0x00,0x00,0x04,0xff,0xfe,0x10,0x00,0x14,0x00,0x00,0x00,
+  0x00,0x00,0xaf,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,
+  0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0x00,0x00,0x00,
+  0x03,0x69,0xbd,0xef,0xff,0xff,0xe0,0x00,0x00,0x39,0xef,0xff,0xff,0xff,0xff,0xff,0xe0,0x00,0x1a,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xe0,0x02,0xdf,0xff,0xfe,0xa7,0x42,0x11,0x3f,0xff,0xe0,0x0c,0xff,0xfe,0x61,0x00,0x00,0x00,0x3f,0xff,0xe0,0x6f,
+  0xff,0xd1,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0xbf,0xff,0x60,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0xcf,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x3f,0xff,0xe0,0xbf,0xff,0x50,0x00,0x00,0x00,0x01,0xcf,0xff,0xe0,0x9f,0xff,0xc0,0x00,0x00,0x00,0x4d,0xff,0xff,
+  0xe0,0x4f,0xff,0xfb,0x41,0x12,0x6b,0xff,0xce,0xff,0xe0,0x0a,0xff,0xff,0xff,0xff,0xff,0xfb,0x1a,0xff,0xe0,0x01,0xaf,0xff,
+  0xff,0xff,0xfe,0x60,0x07,0xff,0xe0,0x00,0x04,0xad,0xfe,0xda,0x51,0x00,0x03,0xdf,0xe0,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,
+  0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x28,0xce,0xfe,0xc7,0x20,0x00,0x00,0x6f,0xff,0xc0,0x18,0xff,0xff,
+  0xff,0xff,0xf7,0x00,0x00,0x6f,0xff,0xc2,0xdf,0xff,0xff,0xff,0xff,0xff,0x90,0x00,0x6f,0xff,0xdd,0xfe,0x93,0x10,0x26,0xef,
+  0xff,0xf6,0x00,0x6f,0xff,0xff,0xc2,0x00,0x00,0x00,0x1c,0xff,0xfe,0x10,0x6f,0xff,0xfc,0x10,0x00,0x00,0x00,0x02,0xff,0xff,
+  0x70,0x6f,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xd0,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xf1,0x6f,
+  0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xf4,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf7,0x6f,0xff,0xc0,
+  0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xf7,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xf8,0x6f,0xff,0xc0,0x00,0x00,
+  0x00,0x00,0x00,0x0c,0xff,0xf8,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf7,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,
+  0x00,0x0e,0xff,0xf5,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf2,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x7f,
+  0xff,0xe0,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0x80,0x6f,0xff,0xe2,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x20,
+  0x6f,0xff,0xfd,0x20,0x00,0x00,0x00,0x6f,0xff,0xf8,0x00,0x6f,0xff,0xff,0xf9,0x41,0x02,0x5b,0xff,0xff,0xc0,0x00,0x6f,0xff,
+  0x8b,0xff,0xff,0xff,0xff,0xff,0xfc,0x10,0x00,0x6f,0xff,0x61,0x9f,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0x6f,0xfe,0x20,0x03,
+  0x9c,0xef,0xdb,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x7b,0xde,0xed,0xb7,0x30,0x00,0x00,0x00,0x03,0xbf,0xff,0xff,0xff,
+  0xff,0xfa,0x20,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xe5,0x00,0x06,0xff,0xff,0xe7,0x31,0x02,0x5b,0xff,0xf5,0x00,
+  0x3f,0xff,0xfb,0x10,0x00,0x00,0x00,0x4c,0x70,0x00,0xcf,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xc0,0x00,
+  0x00,0x00,0x00,0x02,0x30,0x00,0x4f,0xff,0xfb,0x10,0x00,0x00,0x00,0x7f,0xf3,0x00,0x07,0xff,0xff,0xe7,0x21,0x02,0x6c,0xff,
+  0xfc,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xd2,0x00,0x00,0x05,0xdf,0xff,0xff,0xff,0xff,0xe8,0x10,0x00,0x00,0x00,
+  0x05,0x9d,0xef,0xec,0x95,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,
+  0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,
+  0x15,0xad,0xee,0xda,0x60,0x08,0xff,0xfa,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfd,0x48,0xff,0xfa,0x00,0x00,0x8f,0xff,0xff,
+  0xff,0xff,0xff,0xfc,0xff,0xfa,0x00,0x08,0xff,0xff,0xd6,0x21,0x13,0x8e,0xff,0xff,0xfa,0x00,0x4f,0xff,0xfa,0x10,0x00,0x00,
+  0x02,0xcf,0xff,0xfa,0x00,0xcf,0xff,0xb0,0x00,0x00,0x00,0x00,0x1d,0xff,0xfa,0x04,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x08,
+  0xff,0xfa,0x0a,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x0d,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,
+  0x1f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x3f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x4f,0xff,
+  0xf1,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x4f,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x3f,0xff,0xf1,0x00,
+  0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x3f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x1f,0xff,0xf4,0x00,0x00,0x00,
+  0x00,0x00,0x08,0xff,0xfa,0x0c,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x09,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,
+  0x0a,0xff,0xfa,0x03,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x7f,0xff,0xfa,0x00,0xbf,0xff,0xe3,0x00,0x00,0x00,0x08,0xff,0xff,
+  0xfa,0x00,0x3f,0xff,0xfe,0x83,0x11,0x37,0xdf,0xfb,0xff,0xfa,0x00,0x05,0xff,0xff,0xff,0xff,0xff,0xff,0x62,0xff,0xfa,0x00,
+  0x00,0x5d,0xff,0xff,0xff,0xff,0xc3,0x00,0xff,0xfa,0x00,0x00,0x01,0x6b,0xdf,0xec,0x94,0x00,0x00,0xaf,0xfa,0x00,0x00,0x00,
+  0x03,0x8c,0xdf,0xed,0xa6,0x10,0x00,0x00,0x00,0x00,0x03,0xbf,0xff,0xff,0xff,0xff,0xe6,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x90,0x00,0x00,0x06,0xff,0xff,0xb5,0x20,0x13,0x7e,0xff,0xf8,0x00,0x00,0x3f,0xff,0xf5,0x00,0x00,0x00,
+  0x01,0xcf,0xff,0x40,0x00,0xcf,0xff,0x60,0x00,0x00,0x00,0x00,0x1e,0xff,0xb0,0x04,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x07,
+  0xff,0xf2,0x0a,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf6,0x0d,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xf9,
+  0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x3f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x4f,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xf6,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xaf,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x2e,0xff,0xfc,0x10,0x00,0x00,0x00,0x05,0xdf,
+  0x80,0x00,0x04,0xff,0xff,0xe8,0x31,0x01,0x37,0xdf,0xff,0xf3,0x00,0x00,0x4e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x70,0x00,
+  0x00,0x02,0xaf,0xff,0xff,0xff,0xff,0xff,0x92,0x00,0x00,0x00,0x00,0x02,0x7b,0xde,0xfd,0xc9,0x61,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x49,0xce,0xfe,0xc4,0x00,0x00,0x00,0x2b,0xff,0xff,0xff,0xf7,0x00,0x00,0x02,0xef,0xff,0xff,0xff,0xf5,0x00,0x00,0x0b,
+  0xff,0xfe,0x83,0x10,0x00,0x00,0x00,0x3f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x70,0x00,0x00,0x00,0x6f,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xf5,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0x2d,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0x00,0x13,0xbf,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x59,0xde,0xfe,0xc9,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x5e,0xff,0xff,0xff,0xff,0xfc,0xaa,0xaa,0xaa,0x30,0x00,0x08,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x5f,0xff,0xfa,0x41,0x01,0x4a,0xff,0xff,0xff,0xfb,0x10,0x00,0xef,0xff,
+  0x60,0x00,0x00,0x00,0x7f,0xff,0xc2,0x00,0x00,0x04,0xff,0xfb,0x00,0x00,0x00,0x00,0x0c,0xff,0xf1,0x00,0x00,0x07,0xff,0xf6,
+  0x00,0x00,0x00,0x00,0x07,0xff,0xf4,0x00,0x00,0x08,0xff,0xf5,0x00,0x00,0x00,0x00,0x06,0xff,0xf5,0x00,0x00,0x07,0xff,0xf6,
+  0x00,0x00,0x00,0x00,0x07,0xff,0xf4,0x00,0x00,0x04,0xff,0xfb,0x00,0x00,0x00,0x00,0x0c,0xff,0xf1,0x00,0x00,0x00,0xdf,0xff,
+  0x60,0x00,0x00,0x00,0x7f,0xff,0xb0,0x00,0x00,0x00,0x4f,0xff,0xfa,0x41,0x01,0x4b,0xff,0xff,0x30,0x00,0x00,0x00,0x06,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xff,0xff,0xfc,0x30,0x00,0x00,0x00,0x00,0x02,0xdf,
+  0xfa,0xce,0xfe,0xc9,0x40,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xfc,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,
+  0xd6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xff,0xed,0xb8,0x30,0x00,0x00,0x00,0x08,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x20,0x00,0x00,0x17,0xef,0xdc,0xef,0xff,0xff,0xff,0xff,0xff,0xc1,0x00,0x03,0xdf,0xf8,
+  0x00,0x00,0x00,0x12,0x36,0xcf,0xff,0xf6,0x00,0x2e,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xf9,0x00,0x9f,0xff,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xfa,0x00,0xcf,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf8,0x00,0xbf,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf3,0x00,0x7f,0xff,0xc2,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xa0,0x00,0x1d,0xff,0xfe,
+  0x95,0x21,0x01,0x24,0x8e,0xff,0xfd,0x10,0x00,0x03,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc1,0x00,0x00,0x00,0x18,0xef,
+  0xff,0xff,0xff,0xff,0xff,0xd6,0x00,0x00,0x00,0x00,0x00,0x15,0x9b,0xde,0xfe,0xdb,0x84,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x39,0xce,0xfd,0xb6,0x00,0x00,0x00,0x8f,0xff,
+  0x90,0x2b,0xff,0xff,0xff,0xff,0xd3,0x00,0x00,0x8f,0xff,0x94,0xef,0xff,0xff,0xff,0xff,0xfe,0x30,0x00,0x8f,0xff,0xdf,0xfe,
+  0x93,0x11,0x38,0xef,0xff,0xd1,0x00,0x8f,0xff,0xff,0xb2,0x00,0x00,0x00,0x4f,0xff,0xf6,0x00,0x8f,0xff,0xfa,0x00,0x00,0x00,
+  0x00,0x09,0xff,0xfb,0x00,0x8f,0xff,0xb0,0x00,0x00,0x00,0x00,0x03,0xff,0xfe,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,
+  0xff,0xff,0x20,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x30,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,
+  0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,
+  0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,
+  0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,
+  0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x07,0xde,0x80,0x7f,0xff,0xf8,0xdf,0xff,0xfe,0xdf,0xff,0xfe,0x7f,
+  0xff,0xf8,0x08,0xde,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,
+  0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,
+  0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,
+  0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x00,0x00,0x00,0x7d,0xe8,0x00,0x00,
+  0x00,0x07,0xff,0xff,0x80,0x00,0x00,0x0d,0xff,0xff,0xe0,0x00,0x00,0x0d,0xff,0xff,0xe0,0x00,0x00,0x07,0xff,0xff,0x80,0x00,
+  0x00,0x00,0x8d,0xe8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,
+  0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,
+  0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,
+  0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,
+  0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,
+  0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,
+  0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x01,0xff,0xff,0x10,0x00,0x00,0x02,0xff,0xff,0x10,0x00,0x00,0x03,0xff,0xff,0x00,0x00,
+  0x00,0x07,0xff,0xfc,0x00,0x00,0x01,0x6f,0xff,0xf7,0x00,0x1f,0xff,0xff,0xff,0xd1,0x00,0x3f,0xff,0xff,0xfd,0x20,0x00,0x3c,
+  0xef,0xeb,0x60,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,
+  0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,
+  0x00,0x00,0x0a,0xff,0xfc,0x10,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0xaf,0xff,0xd1,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x09,
+  0xff,0xfe,0x20,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x7f,0xff,0xe3,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x06,0xff,0xff,0x40,
+  0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x4f,0xff,0xf5,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x03,0xef,0xff,0x70,0x00,0x00,0x00,
+  0x6f,0xff,0xc0,0x00,0x2e,0xff,0xf8,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x01,0xdf,0xff,0xa0,0x00,0x00,0x00,0x00,0x6f,0xff,
+  0xc0,0x2c,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,
+  0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x18,0xff,0xff,
+  0x50,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0xaf,0xff,0xf3,0x00,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x1c,0xff,0xfd,0x10,
+  0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x02,0xef,0xff,0xc0,0x00,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x3f,0xff,0xf9,0x00,0x00,
+  0x00,0x6f,0xff,0xc0,0x00,0x00,0x05,0xff,0xff,0x60,0x00,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x8f,0xff,0xf4,0x00,0x00,0x6f,
+  0xff,0xc0,0x00,0x00,0x00,0x0a,0xff,0xfe,0x20,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x01,0xcf,0xff,0xc1,0x00,0x6f,0xff,0xc0,
+  0x00,0x00,0x00,0x00,0x2e,0xff,0xfa,0x00,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x03,0xdf,0xff,0x70,0x1f,0xff,0xf1,0x1f,0xff,
+  0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,
+  0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,
+  0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,
+  0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,0xf1,0x1f,0xff,
+  0xf1,0x8f,0xfb,0x00,0x02,0x8c,0xef,0xd8,0x20,0x00,0x00,0x16,0xbe,0xfe,0xd9,0x30,0x00,0x00,0x8f,0xff,0x20,0x5e,0xff,0xff,
+  0xff,0xe3,0x00,0x04,0xdf,0xff,0xff,0xff,0xf9,0x00,0x00,0x8f,0xff,0x38,0xff,0xff,0xff,0xff,0xfd,0x10,0x5f,0xff,0xff,0xff,
+  0xff,0xff,0xa0,0x00,0x8f,0xff,0xbf,0xfa,0x41,0x14,0xbf,0xff,0x82,0xef,0xe8,0x30,0x14,0xcf,0xff,0xf6,0x00,0x8f,0xff,0xff,
+  0x60,0x00,0x00,0x0a,0xff,0xea,0xfe,0x30,0x00,0x00,0x0b,0xff,0xfd,0x00,0x8f,0xff,0xf5,0x00,0x00,0x00,0x02,0xff,0xff,0xf6,
+  0x00,0x00,0x00,0x02,0xff,0xff,0x40,0x8f,0xff,0xa0,0x00,0x00,0x00,0x00,0xcf,0xff,0xe0,0x00,0x00,0x00,0x00,0xbf,0xff,0x70,
+  0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0xaf,0xff,0xb0,0x00,0x00,0x00,0x00,0x9f,0xff,0x90,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x9f,0xff,0xa0,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,
+  0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,
+  0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,
+  0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x7f,0xff,0xb0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x7f,0xff,
+  0xb0,0x8f,0xfb,0x00,0x00,0x49,0xde,0xfd,0xb6,0x00,0x00,0x00,0x8f,0xff,0x20,0x2b,0xff,0xff,0xff,0xff,0xd3,0x00,0x00,0x8f,
+  0xff,0x34,0xef,0xff,0xff,0xff,0xff,0xfe,0x30,0x00,0x8f,0xff,0xaf,0xfe,0x93,0x11,0x38,0xef,0xff,0xd1,0x00,0x8f,0xff,0xff,
+  0xb2,0x00,0x00,0x00,0x4f,0xff,0xf6,0x00,0x8f,0xff,0xfa,0x00,0x00,0x00,0x00,0x09,0xff,0xfb,0x00,0x8f,0xff,0xb0,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xfe,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x20,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0xef,0xff,0x30,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,
+  0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,
+  0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,
+  0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,
+  0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0x40,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xef,0xff,
+  0x40,0x00,0x00,0x00,0x03,0x7b,0xde,0xed,0xc8,0x30,0x00,0x00,0x00,0x00,0x00,0x03,0xaf,0xff,0xff,0xff,0xff,0xfb,0x30,0x00,
+  0x00,0x00,0x00,0x5f,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x00,0x00,0x00,0x06,0xff,0xff,0xd7,0x21,0x12,0x6c,0xff,0xff,0x80,
+  0x00,0x00,0x3f,0xff,0xf9,0x00,0x00,0x00,0x00,0x8f,0xff,0xf4,0x00,0x00,0xcf,0xff,0xb0,0x00,0x00,0x00,0x00,0x0a,0xff,0xfd,
+  0x00,0x04,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x50,0x09,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,
+  0xb0,0x0d,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xe0,0x2f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,
+  0xf3,0x3f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf4,0x4f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,
+  0xf5,0x4f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xf5,0x3f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,
+  0xf4,0x2f,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf3,0x0d,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,
+  0xe0,0x0a,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xb0,0x04,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x01,0xef,0xff,
+  0x50,0x00,0xcf,0xff,0xa0,0x00,0x00,0x00,0x00,0x09,0xff,0xfd,0x00,0x00,0x3f,0xff,0xf9,0x00,0x00,0x00,0x00,0x8f,0xff,0xf4,
+  0x00,0x00,0x06,0xff,0xff,0xd7,0x21,0x12,0x6c,0xff,0xff,0x80,0x00,0x00,0x00,0x6f,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x00,
+  0x00,0x00,0x00,0x03,0xbf,0xff,0xff,0xff,0xff,0xfc,0x40,0x00,0x00,0x00,0x00,0x00,0x03,0x7b,0xde,0xed,0xc8,0x30,0x00,0x00,
+  0x00,0x8f,0xfb,0x00,0x00,0x39,0xce,0xfd,0xb7,0x10,0x00,0x00,0x8f,0xff,0x20,0x1a,0xff,0xff,0xff,0xff,0xe5,0x00,0x00,0x8f,
+  0xff,0x43,0xef,0xff,0xff,0xff,0xff,0xff,0x70,0x00,0x8f,0xff,0x9e,0xfe,0x83,0x11,0x37,0xef,0xff,0xf4,0x00,0x8f,0xff,0xff,
+  0xb1,0x00,0x00,0x00,0x2e,0xff,0xfd,0x00,0x8f,0xff,0xfa,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0x40,0x8f,0xff,0xc1,0x00,0x00,
+  0x00,0x00,0x00,0xcf,0xff,0xa0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xe0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0x3f,0xff,0xf2,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xf4,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x0f,
+  0xff,0xf5,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xf6,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xf6,
+  0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf5,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xf3,0x8f,0xff,
+  0x90,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xe0,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xb0,0x8f,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x01,0xef,0xff,0x50,0x8f,0xff,0xd1,0x00,0x00,0x00,0x00,0x0a,0xff,0xfe,0x00,0x8f,0xff,0xfc,0x20,0x00,0x00,
+  0x00,0x8f,0xff,0xf5,0x00,0x8f,0xff,0xff,0xe8,0x31,0x02,0x6c,0xff,0xff,0xa0,0x00,0x8f,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
+  0xfa,0x00,0x00,0x8f,0xff,0x93,0xdf,0xff,0xff,0xff,0xfe,0x60,0x00,0x00,0x8f,0xff,0x90,0x05,0xad,0xee,0xdb,0x61,0x00,0x00,
+  0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,
+  0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xad,0xee,0xda,
+  0x50,0x00,0x9f,0xfa,0x00,0x00,0x05,0xef,0xff,0xff,0xff,0xfd,0x40,0xff,0xfa,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xf8,
+  0xff,0xfa,0x00,0x08,0xff,0xff,0xd6,0x21,0x13,0x8e,0xff,0xff,0xfa,0x00,0x4f,0xff,0xfa,0x10,0x00,0x00,0x02,0xcf,0xff,0xfa,
+  0x00,0xcf,0xff,0xb0,0x00,0x00,0x00,0x00,0x1d,0xff,0xfa,0x04,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x0a,0xff,
+  0xfb,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x0d,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x1f,0xff,0xf4,0x00,
+  0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x3f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x4f,0xff,0xf1,0x00,0x00,0x00,
+  0x00,0x00,0x08,0xff,0xfa,0x4f,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x3f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,
+  0x08,0xff,0xfa,0x3f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x1f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x08,0xff,
+  0xfa,0x0c,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x09,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfa,0x03,
+  0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x7f,0xff,0xfa,0x00,0xbf,0xff,0xe3,0x00,0x00,0x00,0x08,0xff,0xff,0xfa,0x00,0x3f,0xff,
+  0xfe,0x83,0x11,0x37,0xdf,0xfd,0xff,0xfa,0x00,0x05,0xff,0xff,0xff,0xff,0xff,0xff,0x68,0xff,0xfa,0x00,0x00,0x5d,0xff,0xff,
+  0xff,0xff,0xc3,0x08,0xff,0xfa,0x00,0x00,0x01,0x6b,0xdf,0xec,0x94,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,
+  0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xfa,0x8f,0xfd,0x00,0x00,0x6b,0xef,0xed,0x90,0x8f,0xff,0x20,0x2d,0xff,0xff,0xff,
+  0xa0,0x8f,0xff,0x43,0xef,0xff,0xff,0xff,0x70,0x8f,0xff,0x6d,0xfe,0x72,0x01,0x36,0x10,0x8f,0xff,0xef,0xd1,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x8f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xe0,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x9c,0xef,0xed,0x95,0x00,0x00,0x00,0x02,0xcf,0xff,0xff,0xff,
+  0xff,0xd6,0x00,0x00,0x3e,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x01,0xdf,0xff,0xd6,0x20,0x13,0x8e,0xff,0x70,0x07,0xff,0xfc,
+  0x10,0x00,0x00,0x01,0x68,0x00,0x0b,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x0d,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xfd,0x72,0x00,
+  0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0xff,0xc7,0x20,0x00,0x00,0x00,0x05,0xdf,0xff,0xff,0xff,0xfb,0x30,0x00,0x00,0x00,0x16,
+  0xbf,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x02,0x6b,0xff,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x28,0xff,0xff,0xe1,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x09,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0xf2,0x07,0xfb,0x20,0x00,0x00,0x00,0x6f,0xff,0xc0,0x3f,0xff,0xf9,
+  0x41,0x01,0x4a,0xff,0xff,0x30,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x00,0x01,0x8e,0xff,0xff,0xff,0xff,0xfd,0x40,0x00,
+  0x00,0x01,0x6a,0xde,0xfe,0xc9,0x50,0x00,0x00,0x00,0x00,0x05,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x4f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xbf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
+  0x00,0x9b,0xce,0xff,0xff,0xff,0xff,0xff,0xc0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xc0,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x02,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0x50,0x00,0x01,0x00,0x00,0x00,0xcf,0xff,0xd4,0x12,0x9f,
+  0x50,0x00,0x00,0x5f,0xff,0xff,0xff,0xff,0xe1,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xb1,0x00,0x00,0x00,0x4a,0xef,0xec,0x93,
+  0x00,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,
+  0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,
+  0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,
+  0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,
+  0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,
+  0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x2f,0xff,
+  0xf1,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x1f,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x0e,0xff,0xf5,0x00,
+  0x00,0x00,0x00,0x00,0x8f,0xff,0xa0,0x0a,0xff,0xfa,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0xa0,0x05,0xff,0xff,0x50,0x00,0x00,
+  0x00,0x8f,0xff,0xff,0xa0,0x00,0xcf,0xff,0xf9,0x31,0x13,0x7d,0xff,0xdf,0xff,0xa0,0x00,0x3e,0xff,0xff,0xff,0xff,0xff,0xf9,
+  0x2f,0xff,0xa0,0x00,0x03,0xdf,0xff,0xff,0xff,0xfd,0x40,0x0f,0xff,0xa0,0x00,0x00,0x06,0xad,0xfe,0xda,0x50,0x00,0x0a,0xff,
+  0xa0,0x6f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf6,0x1e,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,
+  0xe1,0x09,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x02,0xff,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0xef,0xff,
+  0x30,0x00,0xbf,0xff,0x80,0x00,0x00,0x00,0x00,0x05,0xff,0xfc,0x00,0x00,0x5f,0xff,0xe0,0x00,0x00,0x00,0x00,0x0b,0xff,0xf6,
+  0x00,0x00,0x0e,0xff,0xf5,0x00,0x00,0x00,0x00,0x2f,0xff,0xe1,0x00,0x00,0x08,0xff,0xfb,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,
+  0x00,0x00,0x02,0xff,0xff,0x20,0x00,0x00,0x00,0xdf,0xff,0x30,0x00,0x00,0x00,0xbf,0xff,0x80,0x00,0x00,0x04,0xff,0xfc,0x00,
+  0x00,0x00,0x00,0x5f,0xff,0xd0,0x00,0x00,0x0a,0xff,0xf6,0x00,0x00,0x00,0x00,0x0e,0xff,0xf4,0x00,0x00,0x1f,0xff,0xe1,0x00,
+  0x00,0x00,0x00,0x08,0xff,0xfa,0x00,0x00,0x7f,0xff,0x80,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0x10,0x00,0xdf,0xff,0x20,0x00,
+  0x00,0x00,0x00,0x00,0xbf,0xff,0x70,0x04,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xd0,0x0a,0xff,0xf5,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0d,0xff,0xf3,0x1f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf8,0x5f,0xff,0x80,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0xff,0xfc,0xaf,0xff,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xdf,0xfb,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xf5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xff,0xff,0xe0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0x20,0x00,0x00,0x00,
+  0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0xaf,0xfc,0x10,0x00,0x00,0x00,0x00,0x06,0xef,0xf8,0x3f,0xff,0xf1,0x00,0x00,
+  0x00,0x00,0x03,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x0d,0xff,0xf3,0x0d,0xff,0xf6,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xb0,
+  0x00,0x00,0x00,0x00,0x2f,0xff,0xd0,0x08,0xff,0xfa,0x00,0x00,0x00,0x00,0x0c,0xff,0xff,0xf1,0x00,0x00,0x00,0x00,0x7f,0xff,
+  0x90,0x03,0xff,0xfe,0x00,0x00,0x00,0x00,0x2f,0xff,0xff,0xf5,0x00,0x00,0x00,0x00,0xbf,0xff,0x40,0x00,0xef,0xff,0x40,0x00,
+  0x00,0x00,0x7f,0xfe,0xdf,0xfa,0x00,0x00,0x00,0x01,0xff,0xfe,0x00,0x00,0x9f,0xff,0x80,0x00,0x00,0x00,0xcf,0xfa,0xaf,0xfe,
+  0x10,0x00,0x00,0x05,0xff,0xf9,0x00,0x00,0x4f,0xff,0xd0,0x00,0x00,0x02,0xff,0xf6,0x5f,0xff,0x50,0x00,0x00,0x0a,0xff,0xf4,
+  0x00,0x00,0x0e,0xff,0xf2,0x00,0x00,0x07,0xff,0xf1,0x1e,0xff,0x90,0x00,0x00,0x0e,0xff,0xe0,0x00,0x00,0x09,0xff,0xf7,0x00,
+  0x00,0x0b,0xff,0xb0,0x0a,0xff,0xe0,0x00,0x00,0x4f,0xff,0xa0,0x00,0x00,0x05,0xff,0xfb,0x00,0x00,0x1f,0xff,0x60,0x05,0xff,
+  0xf4,0x00,0x00,0x8f,0xff,0x50,0x00,0x00,0x00,0xef,0xff,0x10,0x00,0x6f,0xff,0x10,0x01,0xff,0xf9,0x00,0x00,0xdf,0xfe,0x10,
+  0x00,0x00,0x00,0xaf,0xff,0x50,0x00,0xbf,0xfb,0x00,0x00,0xaf,0xfd,0x00,0x02,0xff,0xfa,0x00,0x00,0x00,0x00,0x5f,0xff,0x90,
+  0x01,0xff,0xf6,0x00,0x00,0x5f,0xff,0x30,0x07,0xff,0xf5,0x00,0x00,0x00,0x00,0x1f,0xff,0xe0,0x06,0xff,0xf1,0x00,0x00,0x1f,
+  0xff,0x80,0x0c,0xff,0xf1,0x00,0x00,0x00,0x00,0x0b,0xff,0xf3,0x0a,0xff,0xb0,0x00,0x00,0x0b,0xff,0xd0,0x1f,0xff,0xb0,0x00,
+  0x00,0x00,0x00,0x06,0xff,0xf7,0x1f,0xff,0x60,0x00,0x00,0x06,0xff,0xf2,0x5f,0xff,0x60,0x00,0x00,0x00,0x00,0x01,0xff,0xfb,
+  0x5f,0xff,0x10,0x00,0x00,0x01,0xff,0xf6,0x9f,0xff,0x10,0x00,0x00,0x00,0x00,0x00,0xbf,0xfd,0x9f,0xfb,0x00,0x00,0x00,0x00,
+  0xbf,0xfa,0xdf,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xef,0xf6,0x00,0x00,0x00,0x00,0x6f,0xfe,0xff,0xf6,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xf1,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,
+  0xff,0xb0,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x60,0x00,0x00,0x00,0x00,
+  0x06,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0x20,0x00,0x00,
+  0x00,0x0a,0xff,0xfd,0x20,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0x50,0x01,0xef,0xff,0xb0,0x00,0x00,0x00,0x00,0x0b,0xff,0xf9,
+  0x00,0x00,0x5f,0xff,0xf5,0x00,0x00,0x00,0x00,0x6f,0xff,0xd1,0x00,0x00,0x0a,0xff,0xfe,0x10,0x00,0x00,0x02,0xef,0xff,0x40,
+  0x00,0x00,0x01,0xef,0xff,0x90,0x00,0x00,0x0b,0xff,0xf8,0x00,0x00,0x00,0x00,0x5f,0xff,0xf4,0x00,0x00,0x6f,0xff,0xd0,0x00,
+  0x00,0x00,0x00,0x0a,0xff,0xfd,0x00,0x02,0xef,0xff,0x30,0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0x80,0x0b,0xff,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x4f,0xff,0xf3,0x5f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xfc,0xcf,0xfe,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xdf,0xff,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0xff,0xff,0xc0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0xff,0xfd,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0c,0xff,0xf7,0xdf,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xd1,0x4f,0xff,0xf4,0x00,0x00,
+  0x00,0x00,0x00,0x03,0xff,0xff,0x30,0x09,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x0d,0xff,0xf8,0x00,0x01,0xef,0xff,0x90,0x00,
+  0x00,0x00,0x00,0x8f,0xff,0xc0,0x00,0x00,0x5f,0xff,0xf4,0x00,0x00,0x00,0x04,0xff,0xff,0x30,0x00,0x00,0x0a,0xff,0xfd,0x10,
+  0x00,0x00,0x1d,0xff,0xf7,0x00,0x00,0x00,0x02,0xef,0xff,0x90,0x00,0x00,0x9f,0xff,0xb0,0x00,0x00,0x00,0x00,0x6f,0xff,0xf4,
+  0x00,0x05,0xff,0xfe,0x20,0x00,0x00,0x00,0x00,0x0b,0xff,0xfe,0x10,0x1e,0xff,0xe5,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,
+  0xa0,0x7f,0xff,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xf7,0x1e,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,
+  0xf1,0x09,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x02,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0xef,0xff,
+  0x30,0x00,0xbf,0xff,0xb0,0x00,0x00,0x00,0x00,0x05,0xff,0xfb,0x00,0x00,0x4f,0xff,0xf3,0x00,0x00,0x00,0x00,0x0b,0xff,0xf5,
+  0x00,0x00,0x0d,0xff,0xf9,0x00,0x00,0x00,0x00,0x2f,0xff,0xd0,0x00,0x00,0x06,0xff,0xfe,0x10,0x00,0x00,0x00,0x9f,0xff,0x70,
+  0x00,0x00,0x01,0xef,0xff,0x70,0x00,0x00,0x01,0xef,0xff,0x10,0x00,0x00,0x00,0x8f,0xff,0xd0,0x00,0x00,0x06,0xff,0xf9,0x00,
+  0x00,0x00,0x00,0x2f,0xff,0xf4,0x00,0x00,0x0c,0xff,0xf3,0x00,0x00,0x00,0x00,0x0a,0xff,0xfa,0x00,0x00,0x3f,0xff,0xb0,0x00,
+  0x00,0x00,0x00,0x04,0xff,0xff,0x20,0x00,0x9f,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0x80,0x01,0xef,0xfd,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x6f,0xff,0xe0,0x06,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0xf6,0x0c,0xff,0xe1,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x08,0xff,0xfb,0x3f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0x9f,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xff,0xfb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xf5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xff,0xff,0x70,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xf9,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0b,0xff,0xf3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xb0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xfd,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x09,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xff,0xe1,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x8f,0xff,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0xfd,0x20,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x09,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf1,0x09,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf1,0x09,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,
+  0xff,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xff,0xff,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2e,0xff,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+  0xff,0xfe,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0xff,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xef,0xff,0x80,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0b,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+  0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xd1,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0xdf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x90,0x5f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x90,0x5f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x90,0x00,0x00,0x01,0x7b,0xef,0xf0,0x00,0x00,0x5e,0xff,0xff,0xf0,0x00,0x05,0xff,0xff,0xff,0xc0,0x00,0x1e,0xff,0xf9,0x20,
+  0x00,0x00,0x7f,0xff,0x80,0x00,0x00,0x00,0xbf,0xff,0x10,0x00,0x00,0x00,0xdf,0xfc,0x00,0x00,0x00,0x00,0xef,0xfb,0x00,0x00,
+  0x00,0x00,0xdf,0xfc,0x00,0x00,0x00,0x00,0xcf,0xfd,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,0x00,0x7f,0xff,0x20,0x00,
+  0x00,0x00,0x4f,0xff,0x40,0x00,0x00,0x00,0x1f,0xff,0x70,0x00,0x00,0x00,0x0e,0xff,0x90,0x00,0x00,0x00,0x0d,0xff,0xa0,0x00,
+  0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x00,0x0d,0xff,0xb0,0x00,0x00,0x00,0x4f,0xff,0x80,0x00,0x00,0x15,0xef,0xfe,0x10,0x00,
+  0x00,0xff,0xff,0xe3,0x00,0x00,0x00,0xff,0xfb,0x10,0x00,0x00,0x00,0xff,0xff,0xd2,0x00,0x00,0x00,0x15,0xef,0xfd,0x10,0x00,
+  0x00,0x00,0x4f,0xff,0x70,0x00,0x00,0x00,0x0d,0xff,0xb0,0x00,0x00,0x00,0x0c,0xff,0xc0,0x00,0x00,0x00,0x0d,0xff,0xa0,0x00,
+  0x00,0x00,0x0e,0xff,0x90,0x00,0x00,0x00,0x1f,0xff,0x70,0x00,0x00,0x00,0x4f,0xff,0x40,0x00,0x00,0x00,0x7f,0xff,0x20,0x00,
+  0x00,0x00,0x9f,0xff,0x00,0x00,0x00,0x00,0xbf,0xfd,0x00,0x00,0x00,0x00,0xdf,0xfc,0x00,0x00,0x00,0x00,0xef,0xfb,0x00,0x00,
+  0x00,0x00,0xdf,0xfc,0x00,0x00,0x00,0x00,0xbf,0xff,0x10,0x00,0x00,0x00,0x7f,0xff,0x80,0x00,0x00,0x00,0x1e,0xff,0xf9,0x20,
+  0x00,0x00,0x05,0xff,0xff,0xff,0xc0,0x00,0x00,0x5e,0xff,0xff,0xf0,0x00,0x00,0x01,0x7b,0xef,0xf0,0x9f,0xfa,0x9f,0xfa,0x9f,
+  0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,
+  0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,
+  0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,
+  0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0x9f,0xfa,0xef,0xeb,0x71,0x00,0x00,0x00,0xef,0xff,0xfe,0x60,0x00,0x00,0xbf,
+  0xff,0xff,0xf7,0x00,0x00,0x00,0x28,0xff,0xff,0x20,0x00,0x00,0x00,0x7f,0xff,0x80,0x00,0x00,0x00,0x0e,0xff,0xd0,0x00,0x00,
+  0x00,0x0b,0xff,0xf0,0x00,0x00,0x00,0x0a,0xff,0xf0,0x00,0x00,0x00,0x0b,0xff,0xe0,0x00,0x00,0x00,0x0c,0xff,0xd0,0x00,0x00,
+  0x00,0x0d,0xff,0xb0,0x00,0x00,0x00,0x1f,0xff,0x80,0x00,0x00,0x00,0x3f,0xff,0x50,0x00,0x00,0x00,0x6f,0xff,0x30,0x00,0x00,
+  0x00,0x8f,0xff,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,0x00,0xaf,0xfd,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,
+  0x00,0x6f,0xff,0x50,0x00,0x00,0x00,0x0d,0xff,0xe6,0x10,0x00,0x00,0x02,0xdf,0xff,0xf1,0x00,0x00,0x00,0x1a,0xff,0xf1,0x00,
+  0x00,0x01,0xcf,0xff,0xf1,0x00,0x00,0x0c,0xff,0xe6,0x10,0x00,0x00,0x6f,0xff,0x50,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,
+  0x00,0xaf,0xfd,0x00,0x00,0x00,0x00,0x9f,0xfe,0x00,0x00,0x00,0x00,0x8f,0xff,0x00,0x00,0x00,0x00,0x6f,0xff,0x30,0x00,0x00,
+  0x00,0x3f,0xff,0x50,0x00,0x00,0x00,0x1f,0xff,0x80,0x00,0x00,0x00,0x0e,0xff,0xb0,0x00,0x00,0x00,0x0c,0xff,0xd0,0x00,0x00,
+  0x00,0x0b,0xff,0xe0,0x00,0x00,0x00,0x0a,0xff,0xf0,0x00,0x00,0x00,0x0a,0xff,0xf0,0x00,0x00,0x00,0x0e,0xff,0xd0,0x00,0x00,
+  0x00,0x7f,0xff,0x80,0x00,0x00,0x28,0xff,0xff,0x20,0x00,0xbf,0xff,0xff,0xf7,0x00,0x00,0xef,0xff,0xfe,0x60,0x00,0x00,0xef,
+  0xeb,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xff,0x70,0x00,0x01,0x7c,0xee,0xc8,0x20,0x00,
+  0x00,0x00,0x2f,0xff,0x50,0x00,0x3d,0xff,0xff,0xff,0xfa,0x30,0x00,0x00,0x9f,0xff,0x20,0x01,0xef,0xff,0xff,0xff,0xff,0xfa,
+  0x41,0x17,0xff,0xfb,0x00,0x08,0xff,0xf9,0x20,0x39,0xff,0xff,0xff,0xff,0xff,0xf3,0x00,0x0e,0xff,0xc0,0x00,0x00,0x29,0xef,
+  0xff,0xff,0xff,0x50,0x00,0x2f,0xff,0x50,0x00,0x00,0x00,0x17,0xce,0xed,0x92,0x00,0x00,0x4f,0xff,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,
+};
+
+// code, offset, w, h, dx, dy, advance (1/16 px), left/right kerning class
+const AaGlyph kGlyphs[] = {
+  {0x0020, 0, 0, 0, 0, 0, 144, 0, 0},
+  {0x0021, 0, 6, 33, 5, -33, 256, 0, 0},
+  {0x0022, 99, 13, 12, 3, -33, 304, 1, 1},
+  {0x0023, 183, 25, 33, 1, -33, 432, 0, 0},
+  {0x0024, 612, 23, 44, 2, -38, 432, 0, 0},
+  {0x0025, 1140, 35, 33, 1, -33, 592, 0, 0},
+  {0x0026, 1734, 32, 33, 1, -33, 528, 0, 2},
+  {0x0027, 2262, 5, 12, 3, -33, 176, 1, 1},
+  {0x0028, 2298, 10, 44, 3, -37, 224, 2, 0},
+  {0x0029, 2518, 10, 44, 1, -37, 224, 0, 3},
+  {0x002a, 2738, 15, 15, 2, -35, 304, 1, 1},
+  {0x002b, 2858, 23, 23, 2, -27, 432, 0, 0},
+  {0x002c, 3134, 6, 13, 2, -6, 160, 3, 4},
+  {0x002d, 3173, 12, 3, 2, -15, 256, 4, 5},
+  {0x002e, 3191, 6, 6, 2, -6, 160, 3, 4},
+  {0x002f, 3209, 19, 37, -1, -34, 288, 5, 2},
+  {0x0030, 3579, 25, 33, 1, -33, 432, 0, 0},
+  {0x0031, 4008, 21, 33, 4, -33, 432, 0, 0},
+  {0x0032, 4371, 23, 33, 2, -33, 432, 0, 0},
+  {0x0033, 4767, 24, 33, 2, -33, 432, 0, 0},
+  {0x0034, 5163, 27, 33, 0, -33, 432, 0, 0},
+  {0x0035, 5625, 22, 33, 2, -33, 432, 0, 0},
+  {0x0036, 5988, 24, 33, 2, -33, 432, 0, 0},
+  {0x0037, 6384, 24, 33, 2, -33, 432, 0, 0},
+  {0x0038, 6780, 23, 33, 2, -33, 432, 0, 0},
+  {0x0039, 7176, 23, 33, 3, -33, 432, 0, 0},
+  {0x003a, 7572, 6, 23, 3, -23, 192, 0, 6},
+  {0x003b, 7641, 6, 30, 3, -23, 192, 0, 6},
+  {0x003c, 7731, 19, 22, 3, -27, 432, 0, 0},
+  {0x003d, 7951, 21, 11, 3, -21, 432, 0, 0},
+  {0x003e, 8072, 19, 22, 5, -27, 432, 0, 0},
+  {0x003f, 8292, 18, 33, 0, -33, 304, 0, 7},
+  {0x0040, 8589, 35, 37, 2, -31, 624, 6, 8},
+  {0x0041, 9255, 32, 33, 0, -33, 512, 7, 2},
+  {0x0042, 9783, 24, 33, 4, -33, 480, 0, 0},
+  {0x0043, 10179, 29, 33, 2, -33, 512, 8, 8},
+  {0x0044, 10674, 30, 33, 4, -33, 560, 6, 0},
+  {0x0045, 11169, 21, 33, 4, -33, 432, 0, 0},
+  {0x0046, 11532, 21, 33, 4, -33, 432, 9, 0},
+  {0x0047, 11895, 30, 33, 2, -33, 560, 0, 8},
+  {0x0048, 12390, 28, 33, 4, -33, 576, 0, 0},
+  {0x0049, 12852, 6, 33, 4, -33, 224, 0, 0},
+  {0x004a, 12951, 16, 33, 1, -33, 336, 10, 9},
+  {0x004b, 13215, 28, 33, 4, -33, 512, 11, 0},
+  {0x004c, 13677, 20, 33, 4, -33, 384, 12, 0},
+  {0x004d, 14007, 36, 33, 4, -33, 688, 0, 0},
+  {0x004e, 14601, 28, 33, 4, -33, 576, 0, 0},
+  {0x004f, 15063, 34, 33, 2, -33, 608, 6, 8},
+  {0x0050, 15624, 24, 33, 4, -33, 464, 13, 0},
+  {0x0051, 16020, 35, 40, 2, -33, 608, 6, 8},
+  {0x0052, 16740, 26, 33, 4, -33, 480, 14, 0},
+  {0x0053, 17169, 23, 33, 1, -33, 400, 0, 0},
+  {0x0054, 17565, 28, 33, 0, -33, 448, 15, 10},
+  {0x0055, 18027, 28, 33, 3, -33, 544, 10, 11},
+  {0x0056, 18489, 32, 33, 0, -33, 512, 5, 12},
+  {0x0057, 19017, 48, 33, 0, -33, 768, 16, 13},
+  {0x0058, 19809, 30, 33, 0, -33, 480, 11, 14},
+  {0x0059, 20304, 30, 33, 0, -33, 480, 17, 15},
+  {0x005a, 20799, 26, 33, 2, -33, 464, 18, 16},
+  {0x005b, 21228, 9, 43, 3, -36, 224, 2, 0},
+  {0x005c, 21443, 19, 37, -1, -34, 288, 7, 12},
+  {0x005d, 21813, 9, 43, 2, -36, 224, 0, 3},
+  {0x005e, 22028, 21, 15, 3, -33, 432, 0, 0},
+  {0x005f, 22193, 19, 3, 0, 4, 304, 0, 0},
+  {0x0060, 22223, 11, 7, 0, -33, 224, 0, 0},
+  {0x0061, 22265, 19, 24, 2, -24, 384, 19, 17},
+  {0x0062, 22505, 22, 34, 3, -34, 416, 20, 0},
+  {0x0063, 22879, 20, 24, 1, -24, 352, 0, 18},
+  {0x0064, 23119, 22, 34, 1, -34, 416, 0, 18},
+  {0x0065, 23493, 22, 24, 1, -24, 400, 20, 18},
+  {0x0066, 23757, 16, 33, 0, -33, 256, 21, 19},
+  {0x0067, 24021, 23, 32, 1, -24, 384, 0, 20},
+  {0x0068, 24405, 21, 34, 3, -34, 416, 19, 0},
+  {0x0069, 24779, 6, 34, 3, -34, 192, 0, 0},
+  {0x006a, 24881, 11, 42, -2, -34, 192, 0, 0},
+  {0x006b, 25133, 21, 34, 3, -34, 400, 22, 0},
+  {0x006c, 25507, 6, 34, 3, -34, 192, 0, 0},
+  {0x006d, 25609, 33, 24, 3, -24, 624, 19, 6},
+  {0x006e, 26017, 21, 24, 3, -24, 416, 19, 6},
+  {0x006f, 26281, 24, 24, 1, -24, 416, 20, 18},
+  {0x0070, 26569, 22, 32, 3, -24, 416, 20, 6},
+  {0x0071, 26921, 22, 32, 1, -24, 416, 0, 18},
+  {0x0072, 27273, 15, 24, 3, -24, 304, 23, 6},
+  {0x0073, 27465, 18, 24, 1, -24, 320, 0, 21},
+  {0x0074, 27681, 16, 32, 1, -32, 288, 0, 22},
+  {0x0075, 27937, 21, 24, 2, -24, 416, 0, 6},
+  {0x0076, 28201, 24, 24, 0, -24, 384, 24, 23},
+  {0x0077, 28489, 36, 24, 0, -24, 576, 25, 24},
+  {0x0078, 28921, 23, 24, 0, -24, 384, 22, 25},
+  {0x0079, 29209, 24, 32, 0, -24, 384, 24, 23},
+  {0x007a, 29593, 20, 24, 1, -24, 352, 0, 26},
+  {0x007b, 29833, 12, 43, 1, -36, 224, 2, 0},
+  {0x007c, 30091, 4, 44, 5, -36, 224, 0, 0},
+  {0x007d, 30179, 12, 43, 2, -36, 224, 0, 3},
+  {0x007e, 30437, 23, 8, 2, -18, 432, 0, 0},
+};
+
+// [left class][right class], 1/16 px
+const int8_t kKerning[26 * 27] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-68,0,-86,-67,0,0,-17,0,0,0,18,18,0,11,0,-24,-35,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,-15,0,0,0,0,0,0,0,0,0,-12,0,0,0,0,0,0,0,0,
+  0,-86,0,0,0,-51,0,0,-21,0,-68,0,-68,-46,0,-57,0,0,0,0,0,0,0,-50,-23,0,0,
+  0,-67,-20,0,-51,0,0,0,0,0,-68,0,-42,-12,-23,-60,-17,0,0,0,0,0,0,0,0,0,0,
+  0,18,-51,0,-72,-42,-33,18,-20,-57,0,0,0,0,0,0,0,-44,-44,-11,-51,-40,-16,-18,0,-20,-31,
+  0,-17,-16,-15,-21,0,0,0,0,0,-37,0,-20,0,-11,-30,-26,0,0,0,0,0,0,0,0,0,0,
+  0,-68,0,0,0,-20,0,-21,-16,19,-50,-21,-51,-32,0,-62,0,0,0,0,0,0,0,-31,0,0,0,
+  0,0,0,0,0,-56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-50,0,-68,0,-23,11,0,-74,0,0,0,0,0,0,0,0,-26,0,0,0,0,0,0,0,0,
+  0,0,-21,0,-19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,-23,0,0,-11,0,0,0,0,0,0,0,0,0,-14,-20,0,0,-31,-25,-21,0,0,
+  0,-109,0,0,20,-74,0,-19,-30,0,-65,0,-68,-57,0,-80,0,0,-14,0,0,0,0,-41,-30,0,0,
+  0,0,-52,0,-93,0,0,0,0,-68,0,0,0,0,0,0,0,-19,-11,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,-17,0,-20,-16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,-50,0,-68,-68,-60,0,-37,-75,0,0,0,0,0,0,0,-94,-79,0,-71,-61,0,-68,-53,-54,-45,
+  0,18,-35,0,-46,-12,0,13,0,-38,0,0,0,0,0,0,0,-33,-12,0,-37,-17,0,0,0,0,0,
+  0,11,-62,0,-57,-60,-46,13,-30,-75,0,0,0,0,0,0,0,-48,-60,0,-65,-48,0,-38,-35,-50,0,
+  0,0,0,0,0,-26,0,13,-22,0,0,0,0,0,0,0,0,0,-14,0,0,-11,0,-15,0,0,0,
+  0,-27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-12,-6,0,0,
+  0,-35,0,-12,0,0,0,0,0,0,0,0,-44,-12,0,0,0,0,0,0,0,0,0,-10,0,-23,0,
+  0,26,0,0,-49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-23,0,0,0,0,0,0,0,0,
+  0,0,0,0,-50,0,0,0,0,0,0,0,0,0,0,0,0,-14,0,0,0,0,0,0,0,0,0,
+  0,0,-31,0,-50,0,0,0,0,0,0,0,0,0,0,0,0,0,-10,0,0,0,0,0,0,0,0,
+  0,0,0,0,-23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+} // namespace
+
+extern const AaFont kAaSans24 = {kBitmap, kGlyphs, 95, kKerning, 27, 58, 47, 11};
+
+} // namespace ui_gfx
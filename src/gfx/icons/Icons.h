@@ -0,0 +1,9 @@
+#pragma once
+#include "gfx/Icon.h"
+
+namespace ui_gfx {
+
+// Icons generated by tools/make_icon_assets.py from tools/icons/*.png
+extern const Icon kIconSpeaker;  // 40x40 white speaker with sound waves
+
+} // namespace ui_gfx
@@ -0,0 +1,42 @@
+// Generated by tools/make_icon_assets.py - do not edit
+// speaker.png: 40x40, ink box 36x34 at (2, 3), one colour 0xffff, 612 bytes
+#include "gfx/icons/Icons.h"
+
+namespace ui_gfx {
+
+namespace {
+
+const uint8_t kAlpha[] = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x02,0xdf,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0x80,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0x80,0x00,0x00,0x01,0x20,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0xff,0x80,0x00,0x00,0x1d,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x02,0xdf,0xf8,0xff,0x80,0x00,0x00,0xaf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0x80,0xff,0x80,0x00,
+  0x07,0xff,0xff,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xf8,0x00,0xff,0x80,0x00,0x4f,0xfd,0x2c,0xff,0x60,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0x80,0x00,0xff,0x80,0x01,0xff,0xf3,0x01,0xdf,0xe2,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,
+  0xf8,0x00,0x00,0xff,0x80,0x0a,0xff,0xfc,0x00,0x4f,0xf9,0x00,0x03,0x44,0x44,0x44,0x4d,0xff,0x80,0x00,0x00,0xff,0x80,0x7f,
+  0xff,0xff,0x80,0x0a,0xff,0x20,0x5f,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0xff,0x83,0xff,0xd4,0xff,0xf2,0x03,0xff,0x80,
+  0x8f,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0x00,0xff,0x8d,0xff,0x30,0x8f,0xfb,0x00,0xcf,0xc0,0x8f,0xf4,0x44,0x44,0x42,0x00,
+  0x00,0x00,0x00,0xff,0x8d,0xff,0x60,0x0e,0xff,0x00,0x7f,0xf1,0x8f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x82,0xdf,
+  0xe0,0x0a,0xff,0x50,0x4f,0xf4,0x8f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x80,0x5f,0xf4,0x05,0xff,0x80,0x2f,0xf6,
+  0x8f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x80,0x1f,0xf7,0x02,0xff,0xa0,0x0f,0xf7,0x8f,0xf0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xff,0x80,0x1f,0xf7,0x02,0xff,0xa0,0x1f,0xf7,0x8f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x80,0x5f,
+  0xf4,0x05,0xff,0x80,0x2f,0xf6,0x8f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x82,0xdf,0xe0,0x0a,0xff,0x50,0x4f,0xf4,
+  0x8f,0xf4,0x44,0x44,0x42,0x00,0x00,0x00,0x00,0xff,0x8d,0xff,0x60,0x0e,0xff,0x00,0x7f,0xf1,0x8f,0xff,0xff,0xff,0xff,0x80,
+  0x00,0x00,0x00,0xff,0x8d,0xff,0x30,0x8f,0xfb,0x00,0xcf,0xc0,0x5f,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0xff,0x83,0xff,
+  0xd4,0xff,0xf2,0x03,0xff,0x80,0x03,0x44,0x44,0x44,0x4d,0xff,0x80,0x00,0x00,0xff,0x80,0x7f,0xff,0xff,0x80,0x0a,0xff,0x20,
+  0x00,0x00,0x00,0x00,0x02,0xdf,0xf8,0x00,0x00,0xff,0x80,0x0a,0xff,0xfc,0x00,0x4f,0xf9,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,
+  0xff,0x80,0x00,0xff,0x80,0x01,0xff,0xf3,0x01,0xef,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xf8,0x00,0xff,0x80,0x00,
+  0x4f,0xfd,0x2c,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0x80,0xff,0x80,0x00,0x07,0xff,0xff,0xf9,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xf8,0xff,0x80,0x00,0x00,0xaf,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x2d,0xff,0xff,0x80,0x00,0x00,0x1d,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0xff,0x80,0x00,
+  0x00,0x01,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xdf,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+} // namespace
+
+extern const Icon kIconSpeaker = {nullptr, kAlpha, 0xffff, 40, 40, 2, 3, 36, 34};
+
+} // namespace ui_gfx
@@ -0,0 +1,88 @@
+#include "ui/UiBench.h"
+
+#ifdef UI_BENCH
+#include <Arduino.h>
+#include "base/Config.h"
+#include "gfx/MemDisplay.h"
+
+#ifndef BENCH_GIT_REV
+#define BENCH_GIT_REV "unknown"
+#endif
+
+namespace ui {
+
+namespace {
+
+static uint32_t fnv1a(const uint16_t* px, size_t n) {
+  uint32_t h = 2166136261u;
+  const uint8_t* b = (const uint8_t*)px;
+  for (size_t i = 0; i < n * 2; ++i) { h ^= b[i]; h *= 16777619u; }
+  return h;
+}
+
+#ifdef UI_BENCH_FRAMES
+// One line per row: 'R' followed by runs as 8 hex digits (16-bit length, RGB565 colour)
+static void dumpFrame(const char* screen, const char* event, const uint16_t* fb) {
+  const int W = sys::kScreenW, H = sys::kScreenH;
+  Serial.printf("{\"bench\":\"frame\",\"screen\":\"%s\",\"event\":\"%s\",\"w\":%d,\"h\":%d}\n", screen, event, W, H);
+  static char line[8 * sys::kScreenW + 3]; // not on the loop task stack
+  for (int y = 0; y < H; ++y, fb += W) {
+    char* p = line;
+    *p++ = 'R';
+    for (int x = 0; x < W; ) {
+      int n = 1;
+      while (x + n < W && fb[x + n] == fb[x]) ++n;
+      p += snprintf(p, 9, "%04x%04x", n, fb[x]);
+      x += n;
+    }
+    *p++ = '\n'; *p = 0;
+    Serial.print(line);
+  }
+  Serial.println("{\"bench\":\"frame_end\"}");
+}
+#endif
+
+} // namespace
+
+UiBench::UiBench() = default;
+UiBench::~UiBench() = default;
+
+Arduino_GFX* UiBench::begin() {
+  Serial.printf("{\"bench\":\"ui_start\",\"rev\":\"%s\",\"cpu_mhz\":%u,\"w\":%d,\"h\":%d}\n",
+                BENCH_GIT_REV, (unsigned)getCpuFrequencyMhz(), sys::kScreenW, sys::kScreenH);
+  ui_gfx::FbLease slab = ui_gfx::FramebufferPool::instance().acquire();
+  if (!slab) { Serial.println("{\"bench\":\"error\",\"reason\":\"no framebuffer\"}"); return nullptr; }
+  mem_.reset(new ui_gfx::MemDisplay(std::move(slab)));
+  if (!mem_->begin(GFX_SKIP_OUTPUT_BEGIN)) { Serial.println("{\"bench\":\"error\",\"reason\":\"canvas init failed\"}"); mem_.reset(); return nullptr; }
+  mem_->fillScreen(BLACK);
+  return mem_.get();
+}
+
+void UiBench::event(const char* screen, const char* event, const std::function<void()>& render) {
+  if (!mem_) return;
+  mem_->resetCounters();
+  unsigned long t0 = micros();
+  render();
+  unsigned long us = micros() - t0;
+  const ui_gfx::MemDisplay::Counters& c = mem_->counters();
+  const size_t px = (size_t)sys::kScreenW * sys::kScreenH;
+  Serial.printf("{\"bench\":\"ui\",\"rev\":\"%s\",\"screen\":\"%s\",\"event\":\"%s\",\"us\":%lu,\"px\":%u,\"calls\":%u,\"screen_pct\":%.1f,\"crc\":\"%08x\"}\n",
+                BENCH_GIT_REV, screen, event, us, (unsigned)c.pixels, (unsigned)c.calls,
+                c.pixels * 100.0 / px, (unsigned)fnv1a(mem_->pixels(), px));
+#ifdef UI_BENCH_FRAMES
+  dumpFrame(screen, event, mem_->pixels());
+#endif
+  ++events_;
+  pixels_ += c.pixels;
+  us_ += us;
+}
+
+void UiBench::end() {
+  Serial.printf("{\"bench\":\"ui_done\",\"rev\":\"%s\",\"events\":%d,\"px\":%llu,\"us\":%lu}\n",
+                BENCH_GIT_REV, events_, (unsigned long long)pixels_, us_);
+  mem_.reset();
+}
+
+} // namespace ui
+
+#endif // UI_BENCH
@@ -0,0 +1,37 @@
+#pragma once
+#include <Arduino_GFX_Library.h>
+#include <functional>
+#include <memory>
+
+namespace ui_gfx { class MemDisplay; }
+
+namespace ui {
+
+// Screen render benchmark (build env `uibench`, -DUI_BENCH). The script in main.cpp
+// points the global draw target at a headless ui_gfx::MemDisplay and drives every
+// screen through its events; each event prints one JSON line on Serial with render
+// time, pixels and primitives that reached the frame, and a CRC of the frame.
+// With -DUI_BENCH_FRAMES the frame after every event is dumped run-length encoded
+// as well; tools/ui_frames.py turns the log into PNGs.
+class UiBench {
+public:
+  UiBench();
+  ~UiBench();
+
+  // Takes one framebuffer slab for the memory display; nullptr when none is free
+  Arduino_GFX* begin();
+
+  // Times render() once; counters and clock cover exactly that call
+  void event(const char* screen, const char* event, const std::function<void()>& render);
+
+  // Summary line; returns the slab
+  void end();
+
+private:
+  std::unique_ptr<ui_gfx::MemDisplay> mem_;
+  int events_ = 0;
+  uint64_t pixels_ = 0;
+  unsigned long us_ = 0;
+};
+
+} // namespace ui
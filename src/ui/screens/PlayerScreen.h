@@ -1,35 +1,45 @@
 #pragma once
 #include <memory>
 #include <functional>
+#include <vector>
 #include <Arduino.h>
 #include "ui/Screen.h"
 #include "albumart/BackgroundArt.h"
 #include "base/Config.h"
+#include "gfx/Compositor.h"
+#include "gfx/TextLayout.h"
+#include "gfx/TextSprite.h"
+#include "gfx/fonts/AaFonts.h"
+#include "gfx/icons/Icons.h"
 #include "sonos.h"
-#include <Fonts/FreeSansBold12pt7b.h>
-#include <Fonts/FreeSansBold18pt7b.h>
 
 
-class Arduino_RGB_Display; extern Arduino_RGB_Display* gfx;
+extern Arduino_GFX* gfx;
 
 namespace ui {
 
+// Album art with title/artist, volume/room header, progress and transport bar as
+// compositor layers (bottom to top). The draw*() entry points only lay out what
+// changed and mark it dirty; draw() composes and pushes the dirty rectangles once
+// per loop, so several updates in one loop cost one flush. While a frame is painted
+// over several passes, layouts wait until it is pushed: the layers read the laid-out
+// state, and a frame must not show it half old, half new.
 class PlayerScreen : public IScreen {
 public:
   explicit PlayerScreen(albumart::BackgroundArt* bg) : bg_(bg) {}
   const char* name() const override { return "PlayerScreen"; }
 
-  // Public redraw entry points (now implemented here)
-  void drawTitleOverlay() { drawTitle_(); }
-  void drawPlay()         { drawPlay_(); }
-  void drawVolume()       { drawVolume_(); }
+  // Public redraw entry points: shown with the next draw()
+  void drawTitleOverlay() { if (!defer_(kLayoutTitle)) layoutTitle_(); }
+  void drawPlay()         { if (!defer_(kLayoutPlay)) layoutPlay_(); }
+  void drawVolume()       { if (!defer_(kLayoutVolume)) layoutVolume_(); }
 
   // Touch hit testing
   bool isVolumeIconHit(int tx, int ty) const {
     return (tx >= volHitX_ && tx < volHitX_ + volHitW_ &&
             ty >= volHitY_ && ty < volHitY_ + volHitH_);
   }
-  void drawProgress()     { drawProgress_(); }
+  void drawProgress()     { if (!defer_(kLayoutProgress)) layoutProgress_(); }
   void drawAllUi()        { drawPlay(); drawVolume(); drawProgress(); }
 
   // Data suppliers (avoid globals)
@@ -43,8 +53,8 @@ public:
   void setRelTimeSupplier(std::function<String()> f){ relTimeFn_   = std::move(f); }
   void setDurationSupplier(std::function<String()> f){ durationFn_ = std::move(f); }
 
-  // Backward-compatible: allow external callback override for title if needed
-  void setOverlayDrawer(std::function<void()> fn)   { overlayDrawCb_ = std::move(fn); }
+  const ui_gfx::Compositor::Stats& compositorStats() const { return comp_.stats(); }
+  const ui_gfx::TextCache::Stats& textCacheStats() const { return textCache_.stats(); }
 
   void enter() override { reset(); }
   void exit() override {}
@@ -57,42 +67,38 @@ public:
     prevRoom_ = "";
     // Reset touch hit areas
     volHitX_ = 0; volHitY_ = 0; volHitW_ = 0; volHitH_ = 0;
-
-    // Clear the entire screen first (config menu may have left artifacts)
-    if (gfx) {
-      Serial.println("PlayerScreen: clearing screen before forceFullRedraw");
-      gfx->fillScreen(RGB(0,0,0));  // Clear to black
-    }
-
-    // Force background to redraw completely on next draw() call
-    if (bg_) {
-      Serial.println("PlayerScreen: bg_ is available");
-      if (gfx) {
-        Serial.println("PlayerScreen: gfx is available, calling forceFullRedraw");
-        ui_gfx::Display disp(gfx);
-        bg_->forceFullRedraw(disp);
-        Serial.println("PlayerScreen: forceFullRedraw completed");
-      } else {
-        Serial.println("PlayerScreen: gfx is NULL, cannot call forceFullRedraw");
-      }
-    } else {
-      Serial.println("PlayerScreen: bg_ is NULL");
-    }
-
+    volRect_ = ui_gfx::Rect{};
+    prgFill_ = -1; relLabel_ = TimeLabel{}; durLabel_ = TimeLabel{};
+    ensureCompositor_();
+    // The config menu may have left anything on the panel: recompose all of it (a
+    // partly painted frame is dropped, so laying out now is safe)
+    comp_.invalidateAll();
+    layoutTitle_();
+    layoutProgress_();
+    layoutPlay_();
     // Note: Don't call drawAllUi() here as data suppliers might not be set yet
     // drawAllUi() will be called later in player_init()
   }
-  void tick() override { /* later: handle encoder/touch & Sonos updates */ }
+  void tick() override { stepMarquee_(); }
 
+  // Paints for at most sys::kUiFrameBudgetUs; a larger frame continues with the next
+  // call and reaches the panel in one piece
   void draw(ui_gfx::Display& d) override {
+    (void)d;
+    if (!ensureCompositor_()) return;
+    if (!comp_.painting()) applyDeferred_();
     if (bg_) {
-      bg_->blitStep(d);
-      if (bg_->consumeDidBlit()) {
-        if (overlayDrawCb_) overlayDrawCb_();
-        else drawTitle_();
-      }
+      // A new cover (and its tone) lies under every layer: at once, or cross-faded
+      // from the old one a step per frame
+      if (bg_->consumeNewFrame() && !bg_->fading()) comp_.invalidateAll();
+      if (!comp_.painting() && bg_->stepFade(millis())) comp_.invalidateAll();
     }
+    comp_.flush(sys::kUiFrameBudgetUs);
+    // The cover must not change under a half-painted frame
+    if (bg_) bg_->hold(comp_.painting());
   }
+  // A frame is still being painted (draw() again to finish it)
+  bool painting() const { return comp_.painting(); }
 
 private:
   // Geometry/colors
@@ -100,164 +106,405 @@ private:
   static constexpr int BTN_H = 90; static constexpr int BTN_W = 160;
   static constexpr int VOL_ICON_W = 40, VOL_ICON_H = 40, VOL_ICON_Y = 12;
   static constexpr int PRG_X = 40, PRG_W = 400, PRG_H = 12, PRG_Y = 480 - BTN_H - 30;
+  static constexpr int PRG_KNOB_R = 9, PRG_LABEL_Y = PRG_Y - 16;
+  // Marquee for a title/artist longer than two lines: one line scrolled through the
+  // window at a fixed frame rate, holding at its start before every pass
+  static constexpr int MARQUEE_X = 20, MARQUEE_W = 440, MARQUEE_GAP = 60;
+  static constexpr int MARQUEE_PX_PER_S = 45;
+  static constexpr unsigned MARQUEE_FRAME_MS = 33, MARQUEE_HOLD_MS = 2000;
+
+  // One laid-out overlay line: baseline origin and painted box (outline included).
+  // A marquee line repeats every period pixels and is drawn shifted left by scroll;
+  // its box is the window.
+  struct TextLine { String text; int16_t x = 0, y = 0; ui_gfx::Rect box; int16_t period = 0, scroll = 0; };
+  // A time label as last laid out: pen origin of its first cell on PRG_LABEL_Y
+  struct TimeLabel { char text[12] = ""; int16_t x = 0; };
+
+  bool ensureCompositor_() {
+    if (g_) return true;
+    if (!gfx) return false;
+    comp_.begin(gfx);
+    g_ = comp_.target();
+    comp_.addLayer([this](Arduino_GFX&, const ui_gfx::Rect& r){ paintArt_(r); });
+    comp_.addLayer([this](Arduino_GFX&, const ui_gfx::Rect& r){ paintTitle_(r); });
+    comp_.addLayer([this](Arduino_GFX&, const ui_gfx::Rect& r){ paintHeader_(r); });
+    comp_.addLayer([this](Arduino_GFX&, const ui_gfx::Rect& r){ paintProgress_(r); });
+    comp_.addLayer([this](Arduino_GFX&, const ui_gfx::Rect& r){ paintControls_(r); });
+    return true;
+  }
+
+  // Layout changes requested while a frame is painted, applied before the next one
+  enum : uint8_t { kLayoutTitle = 1, kLayoutVolume = 2, kLayoutProgress = 4, kLayoutPlay = 8 };
+  bool defer_(uint8_t what) {
+    if (!comp_.painting()) return false;
+    deferred_ |= what;
+    return true;
+  }
+  void applyDeferred_() {
+    const uint8_t d = deferred_;
+    deferred_ = 0;
+    if (d & kLayoutTitle) layoutTitle_();
+    if (d & kLayoutVolume) layoutVolume_();
+    if (d & kLayoutProgress) layoutProgress_();
+    if (d & kLayoutPlay) layoutPlay_();
+  }
+
+  static ui_gfx::Rect playRect_() { return ui_gfx::Rect{BTN_W, 480 - BTN_H, BTN_W, BTN_H}; }
+  static ui_gfx::Rect controlsRect_() { return ui_gfx::Rect{0, 480 - BTN_H, 480, BTN_H}; }
+  // Bar with knob plus the time labels above it
+  static ui_gfx::Rect progressRect_() { return ui_gfx::Rect{PRG_X - 10, PRG_Y - 36, PRG_W + 20, PRG_H + 46}; }
 
   // Helpers
-  static String asciiFallback_(const String &in) {
-    String out; out.reserve(in.length()+8);
-    for (int i = 0; i < (int)in.length(); ) {
-      uint8_t c = (uint8_t)in[i];
-      if (c < 0x80) { out += (char)c; ++i; continue; }
-      // Umlauts and common smart quotes (very small subset)
-      if ((uint8_t)in[i] == 0xC3 && i+1 < (int)in.length()) {
-        uint8_t d = (uint8_t)in[i+1];
-        switch (d) { case 0x84: out += 'A'; break; case 0x96: out += 'O'; break; case 0x9C: out += 'U'; break;
-                     case 0xA4: out += 'a'; break; case 0xB6: out += 'o'; break; case 0xBC: out += 'u'; break;
-                     case 0x9F: out += "ss"; break; default: out += '?'; break; }
-        i += 2; continue;
-      }
-      // quotes/dash (very common)
-      if ((uint8_t)in[i] == 0xE2 && i+2 < (int)in.length()) { out += '-'; i += 3; continue; }
-      out += '?'; ++i;
-    }
-    return out;
+  // Anti-aliased text blended into the surface within clip; straight through the
+  // target (no read-back, so without blending) when painting directly
+  int16_t drawText_(const ui_gfx::AaFont& font, int16_t x, int16_t y, const char* s, uint16_t color, const ui_gfx::Rect& clip) {
+    if (uint16_t* surface = comp_.surface()) return ui_gfx::AaText::draw(surface, sys::kScreenW, clip, font, x, y, s, color);
+    return ui_gfx::AaText::draw(g_, font, x, y, s, color, 0, false);
+  }
+  void drawTextOutline_(int16_t x, int16_t y, const String& s, const ui_gfx::Rect& clip) {
+    for (int dx = -1; dx <= 1; ++dx) for (int dy = -1; dy <= 1; ++dy) { if (!dx && !dy) continue; drawText_(ui_gfx::kAaSans12, x+dx, y+dy, s.c_str(), BLACK, clip); }
+    drawText_(ui_gfx::kAaSans12, x, y, s.c_str(), WHITE, clip);
+  }
+  // Overlay text covering rows [top..top+h): one pass where the cover is uniformly dark
+  // or light there, the outline only over busy parts. During a cross-fade the tone
+  // describes the incoming cover only, so the outline holds until the fade ends.
+  albumart::OverlayInk overlayInk_(int top, int h) const {
+    return (bg_ && bg_->ready() && !bg_->fading()) ? bg_->tone().inkFor(top - 1, top + h) : albumart::OverlayInk::Outline;
   }
-  static void drawTextOutline_(int16_t x, int16_t y, const String& s) {
-    gfx->setTextWrap(false);
-    gfx->setTextColor(BLACK);
-    for (int dx = -1; dx <= 1; ++dx) for (int dy = -1; dy <= 1; ++dy) { if (!dx && !dy) continue; gfx->setCursor(x+dx, y+dy); gfx->print(s); }
-    gfx->setTextColor(WHITE); gfx->setCursor(x, y); gfx->print(s);
+  uint16_t inkColor_(albumart::OverlayInk ink) const { return ink == albumart::OverlayInk::Dark ? bg_->tone().darkInk() : WHITE; }
+  void drawOverlayText_(int16_t x, int16_t y, const String& s, int top, int h, const ui_gfx::Rect& clip) {
+    albumart::OverlayInk ink = overlayInk_(top, h);
+    if (ink == albumart::OverlayInk::Outline) { drawTextOutline_(x, y, s, clip); return; }
+    drawText_(ui_gfx::kAaSans12, x, y, s.c_str(), inkColor_(ink), clip);
   }
-  static void drawIconPlay_(int cx, int cy, uint16_t col){ int s=36; gfx->fillTriangle(cx-s/2,cy-s/2, cx-s/2,cy+s/2, cx+s/2,cy, col); }
-  static void drawIconPause_(int cx, int cy, uint16_t col){ int h=40,w=12,g=10; gfx->fillRect(cx-g/2-w, cy-h/2, w,h,col); gfx->fillRect(cx+g/2, cy-h/2, w,h,col);}
-  static void drawIconPrev_(int cx, int cy, uint16_t col){ int s=36,g=6,cxL=cx-(s/2+g/2),cxR=cx+(s/2+g/2); gfx->fillTriangle(cxL+s/2,cy-s/2,cxL+s/2,cy+s/2,cxL-s/2,cy,col); gfx->fillTriangle(cxR+s/2,cy-s/2,cxR+s/2,cy+s/2,cxR-s/2,cy,col);}
-  static void drawIconNext_(int cx, int cy, uint16_t col){ int s=36,g=6,cxL=cx-(s/2+g/2),cxR=cx+(s/2+g/2); gfx->fillTriangle(cxL-s/2,cy-s/2,cxL-s/2,cy+s/2,cxL+s/2,cy,col); gfx->fillTriangle(cxR-s/2,cy-s/2,cxR-s/2,cy+s/2,cxR+s/2,cy,col);}
-  static void drawSpeaker_(int x, int y, bool muted) {
-    // For now, use improved primitive drawing (PNG integration can be added later)
-    uint16_t FG = WHITE;
-
-    // Draw speaker body (rectangle)
-    int bodyW = 12, bodyH = 16;
-    int bodyX = x + 8, bodyY = y + 12;
-    gfx->fillRect(bodyX, bodyY, bodyW, bodyH, FG);
-
-    // Draw speaker cone (triangle)
-    int coneX = bodyX + bodyW;
-    int coneY1 = bodyY + 2, coneY2 = bodyY + bodyH - 2;
-    int coneW = 8;
-    gfx->fillTriangle(coneX, coneY1, coneX, coneY2, coneX + coneW, bodyY + bodyH/2, FG);
-
-    // Draw sound waves (if not muted)
-    if (!muted) {
-      int waveX = coneX + coneW + 2;
-      int centerY = y + VOL_ICON_H/2;
-      gfx->drawCircle(waveX, centerY, 6, FG);
-      gfx->drawCircle(waveX, centerY, 10, FG);
+  // Cover pixels of a rectangle into the current target, dimmed by dimShift; fallback
+  // colour while there is no cover
+  void artRect_(int x, int y, int w, int h, uint8_t dimShift, uint16_t fallback) {
+    if (bg_ && bg_->ready()) {
+      if (uint16_t* s = comp_.surface()) bg_->copyRect(s, sys::kScreenW, x, y, w, h, dimShift);
+      else { ui_gfx::Display disp(gfx); bg_->blitRect(disp, x, y, w, h, dimShift); }
     } else {
+      g_->fillRect(x, y, w, h, fallback);
+    }
+  }
+  // Backdrop for header text, painted within clip: the cover dimmed just enough for
+  // white text across the whole box (the same dimming whatever the clip), or an opaque
+  // box while there is no cover
+  void drawHeaderBackdrop_(const ui_gfx::Rect& box, uint16_t fallback, const ui_gfx::Rect& clip) {
+    uint8_t dim = (bg_ && bg_->ready()) ? bg_->tone().dimShiftFor(box.y, box.y + box.h - 1) : 0;
+    const ui_gfx::Rect r = box.intersected(clip);
+    if (!r.empty()) artRect_(r.x, r.y, r.w, r.h, dim, fallback);
+  }
+  void drawIconPlay_(int cx, int cy, uint16_t col){ int s=36; g_->fillTriangle(cx-s/2,cy-s/2, cx-s/2,cy+s/2, cx+s/2,cy, col); }
+  void drawIconPause_(int cx, int cy, uint16_t col){ int h=40,w=12,g=10; g_->fillRect(cx-g/2-w, cy-h/2, w,h,col); g_->fillRect(cx+g/2, cy-h/2, w,h,col);}
+  void drawIconPrev_(int cx, int cy, uint16_t col){ int s=36,g=6,cxL=cx-(s/2+g/2),cxR=cx+(s/2+g/2); g_->fillTriangle(cxL+s/2,cy-s/2,cxL+s/2,cy+s/2,cxL-s/2,cy,col); g_->fillTriangle(cxR+s/2,cy-s/2,cxR+s/2,cy+s/2,cxR-s/2,cy,col);}
+  void drawIconNext_(int cx, int cy, uint16_t col){ int s=36,g=6,cxL=cx-(s/2+g/2),cxR=cx+(s/2+g/2); g_->fillTriangle(cxL-s/2,cy-s/2,cxL-s/2,cy+s/2,cxL+s/2,cy,col); g_->fillTriangle(cxR-s/2,cy-s/2,cxR-s/2,cy+s/2,cxR+s/2,cy,col);}
+  // Pre-converted icon asset, blended on the surface; the red X marks mute
+  void drawSpeaker_(int x, int y, bool muted, const ui_gfx::Rect& clip) {
+    const ui_gfx::Icon& icon = ui_gfx::kIconSpeaker;
+    const int ix = x + (VOL_ICON_W - icon.w) / 2, iy = y + (VOL_ICON_H - icon.h) / 2;
+    if (uint16_t* surface = comp_.surface()) ui_gfx::IconBlit::draw(surface, sys::kScreenW, clip, icon, ix, iy);
+    else ui_gfx::IconBlit::draw(g_, icon, ix, iy, 0, false);
+    if (muted) {
       // Draw mute X (thick lines for better visibility)
       uint16_t red = RGB(255, 0, 0);
       int cx = x + VOL_ICON_W/2, cy = y + VOL_ICON_H/2;
       // Draw thick X with multiple parallel lines
       for (int i = -1; i <= 1; i++) {
-        gfx->drawLine(cx-8+i, cy-8, cx+8+i, cy+8, red);
-        gfx->drawLine(cx-8+i, cy+8, cx+8+i, cy-8, red);
-        gfx->drawLine(cx-8, cy-8+i, cx+8, cy+8+i, red);
-        gfx->drawLine(cx-8, cy+8+i, cx+8, cy-8+i, red);
+        g_->drawLine(cx-8+i, cy-8, cx+8+i, cy+8, red);
+        g_->drawLine(cx-8+i, cy+8, cx+8+i, cy-8, red);
+        g_->drawLine(cx-8, cy-8+i, cx+8, cy+8+i, red);
+        g_->drawLine(cx-8, cy+8+i, cx+8, cy-8+i, red);
       }
     }
   }
 
-  void drawTitle_() {
-    const int maxW = 440; const int y_center = 240; const int gap = 6;
-    // Title small font
-    gfx->setFont(&FreeSansBold12pt7b); gfx->setTextColor(WHITE);
-    // Calculate overlay region for background restoration - MUCH LARGER AREA
-    // Cover the entire text overlay region generously to avoid text ghosting
-    int bandY = y_center - 80;  // Start well above text area
-    int bandH = 160;            // Cover 160 pixels height (enough for 4-6 lines)
-    if (bandY < 80) bandY = 80; // Don't overlap with header
-    if (bandY + bandH > 390) bandH = 390 - bandY; // Don't overlap with buttons
-    // Restore background in overlay region (instead of black band)
-    if (bg_) {
-      ui_gfx::Display disp(gfx);
-      bg_->blitRegion(disp, bandY, bandY + bandH - 1);
-    }
+  // Layer 0: the cover (black without one)
+  void paintArt_(const ui_gfx::Rect& r) { artRect_(r.x, r.y, r.w, r.h, 0, BLACK); }
 
-    auto wrap_and_draw = [&](String s, int y)->int{
-      s.trim(); if (!s.length()) return 0; s = asciiFallback_(s);
-      // word wrap into up to two lines within maxW
-      std::vector<String> words; int start=0; while (start < (int)s.length()){ int sp = s.indexOf(' ', start); if (sp<0){ words.push_back(s.substring(start)); break;} words.push_back(s.substring(start, sp+1)); start=sp+1; }
-      auto measure=[&](const String& line){ int16_t bx,by; uint16_t bw,bh; gfx->getTextBounds(line.c_str(),0,0,&bx,&by,&bw,&bh); return (int)bw; };
-      auto draw_line_centered=[&](const String& line, int yy){ int16_t bx,by; uint16_t bw,bh; gfx->getTextBounds(line.c_str(),0,0,&bx,&by,&bw,&bh); int x=(480-(int)bw)/2; drawTextOutline_(x, yy, line); return (int)bh; };
-      String l1,l2; int idx=0; while(idx<(int)words.size()){ String t=l1+words[idx]; if (measure(t)<=maxW){ l1=t; idx++; } else break; }
-      while(idx<(int)words.size()){ String t=l2+words[idx]; if (measure(t)<=maxW){ l2=t; idx++; } else break; }
-      int h1=0,h2=0; if (l1.length()) h1=draw_line_centered(l1,y); if (l2.length()) h2=draw_line_centered(l2, y + h1 + gap); return h1 + (l2.length()? (gap+h2):0);
+  // Title and artist, up to two wrapped lines each; measured once per change
+  void layoutTitle_() {
+    if (!g_) return;
+    const ui_gfx::Rect old = titleRect_;
+    titleLines_.clear(); titleRect_ = ui_gfx::Rect{};
+    const int maxW = 440; const int y_center = 240; const int gap = 6;
+    const ui_gfx::AaFont& font = ui_gfx::kAaSans12;
+    auto wrap = [&](String s, int y)->int{
+      s.trim(); if (!s.length()) return 0;
+      // Up to two lines within maxW, wrapped from the font tables once per text
+      const ui_gfx::WrappedText& wrapped = layouts_.get(s, font, maxW, 2);
+      if (!wrapped.complete && comp_.offscreen()) {
+        // More than two lines: the whole text as one marquee line (scrolled sprite
+        // blits need the surface; painting directly keeps the two lines)
+        const ui_gfx::Rect b = ui_gfx::AaText::bounds(font, s.c_str(), 0, 0);
+        TextLine tl; tl.text = s; tl.x = MARQUEE_X - b.x; tl.y = y;
+        tl.box = ui_gfx::Rect{MARQUEE_X, (int16_t)(y + b.y - 1), MARQUEE_W, (int16_t)(b.h + 2)};
+        tl.period = (int16_t)(ui_gfx::AaText::width(font, s.c_str()) + MARQUEE_GAP);
+        titleRect_ = titleRect_.united(tl.box);
+        titleLines_.push_back(tl);
+        return b.h;
+      }
+      int h = 0;
+      for (const ui_gfx::LineBreak& lb : wrapped.lines) {
+        String line = s.substring(lb.start, lb.start + lb.len); line.trim();
+        if (!line.length()) continue;
+        const int yy = h ? y + h + gap : y;
+        const ui_gfx::Rect b = ui_gfx::AaText::bounds(font, line.c_str(), 0, 0);
+        TextLine tl; tl.text = line; tl.x = (480-(int)b.w)/2 - b.x; tl.y = yy;
+        tl.box = ui_gfx::Rect{(int16_t)(tl.x + b.x - 1), (int16_t)(yy + b.y - 1), (int16_t)(b.w + 2), (int16_t)(b.h + 2)};
+        titleRect_ = titleRect_.united(tl.box);
+        titleLines_.push_back(tl);
+        h = yy - y + b.h;
+      }
+      return h;
     };
     String t1 = titleFn_ ? titleFn_() : String();
     String t2 = artistFn_ ? artistFn_() : String();
-    int title_y = y_center - 24; int title_h = wrap_and_draw(t1, title_y);
-    int artist_y = title_y + title_h + 10; wrap_and_draw(t2, artist_y);
+    int title_y = y_center - 24; int title_h = wrap(t1, title_y);
+    int artist_y = title_y + title_h + 10; wrap(t2, artist_y);
+    marquee_ = false;
+    for (const TextLine& l : titleLines_) marquee_ |= l.period > 0;
+    marqueeMs_ = 0; marqueeLast_ = millis();
+    // Rasterise new lines now; repaints only copy the masks
+    if (comp_.offscreen()) for (const TextLine& l : titleLines_) textCache_.get(l.text, &font);
+    comp_.invalidate(old.united(titleRect_)); // old lines back to cover, new ones drawn
   }
 
-  void drawPlay_() {
-    int y0 = 480 - BTN_H; gfx->fillRect(BTN_W, y0, BTN_W, BTN_H, RGB(0,0,0));
-    int cx = BTN_W + BTN_W/2; int cy = y0 + BTN_H/2; if (isPlayingFn_ ? isPlayingFn_() : false) drawIconPause_(cx, cy, WHITE); else drawIconPlay_(cx, cy, WHITE);
+  // Layer 1: title overlay, as cached sprites on the surface (font renderer when painting directly)
+  void paintTitle_(const ui_gfx::Rect& r) {
+    if (!titleRect_.intersects(r)) return;
+    uint16_t* surface = comp_.surface();
+    for (const TextLine& l : titleLines_) {
+      if (!l.box.intersects(r)) continue;
+      const ui_gfx::TextSprite* sp = surface ? textCache_.get(l.text, &ui_gfx::kAaSans12) : nullptr;
+      if (sp) {
+        albumart::OverlayInk ink = overlayInk_(l.box.y + 1, l.box.h - 2);
+        const uint16_t color = inkColor_(ink); const bool outline = ink == albumart::OverlayInk::Outline;
+        if (!l.period) { sp->blit(surface, sys::kScreenW, l.x, l.y, r, color, outline); continue; }
+        // Marquee: the window of the strip at the scroll position, and the start of
+        // the next repetition coming in behind it
+        const ui_gfx::Rect win = l.box.intersected(r);
+        sp->blit(surface, sys::kScreenW, l.x - l.scroll, l.y, win, color, outline);
+        sp->blit(surface, sys::kScreenW, l.x - l.scroll + l.period, l.y, win, color, outline);
+      } else {
+        drawOverlayText_(l.x, l.y, l.text, l.box.y + 1, l.box.h - 2, r);
+      }
+    }
   }
 
-  void drawVolume_() {
-    int vol = volumeFn_ ? volumeFn_() : 0; bool muted = mutedFn_ ? mutedFn_() : false; int effective = muted ? 0 : vol; String room = asciiFallback_(roomFn_ ? roomFn_() : String());
+  // Advances marquee lines once per frame; only their windows are recomposed (cover
+  // rows plus a blit from the cached sprite, the text is not rendered again)
+  void stepMarquee_() {
+    if (!marquee_ || comp_.painting()) return;
+    const unsigned long now = millis();
+    const unsigned long dt = now - marqueeLast_;
+    if (dt < MARQUEE_FRAME_MS) return;
+    marqueeLast_ = now;
+    // Stand still while a cover is fetched or decoded: no pushes competing for PSRAM
+    // and the CPU, and the text does not stutter along with the decoder
+    if (bg_ && bg_->busy()) return;
+    // A loop stalled by a blocking poll resumes where it stopped instead of jumping
+    marqueeMs_ += dt < 2 * MARQUEE_FRAME_MS ? dt : MARQUEE_FRAME_MS;
+    for (TextLine& l : titleLines_) {
+      if (!l.period) continue;
+      const uint32_t passMs = (uint32_t)l.period * 1000 / MARQUEE_PX_PER_S;
+      const uint32_t t = marqueeMs_ % (MARQUEE_HOLD_MS + passMs);
+      const int16_t scroll = t < MARQUEE_HOLD_MS ? 0 : (int16_t)((t - MARQUEE_HOLD_MS) * MARQUEE_PX_PER_S / 1000);
+      if (scroll == l.scroll) continue;
+      l.scroll = scroll;
+      comp_.invalidate(l.box);
+    }
+  }
+
+  // Volume and room header; laid out only when one of them changed
+  void layoutVolume_() {
+    if (!g_) return;
+    int vol = volumeFn_ ? volumeFn_() : 0; bool muted = mutedFn_ ? mutedFn_() : false; int effective = muted ? 0 : vol; String room = roomFn_ ? roomFn_() : String();
     if (prevVol_ == effective && prevMuted_ == muted && prevRoom_ == room) return;
     prevVol_ = effective; prevMuted_ = muted; prevRoom_ = room;
-    const uint16_t header_bg = RGB(10,10,10); int band_y0 = 0; int band_h = 80;
-    // DON'T fill the entire header area - only draw backgrounds for specific elements
-    // gfx->fillRect(0, band_y0, 480, band_h, header_bg);  // REMOVED: This overwrites album art!
-    char pbuf[8]; snprintf(pbuf, sizeof(pbuf), "%d%%", effective);
-    gfx->setFont(&FreeSansBold18pt7b); int16_t tbx, tby; uint16_t tbw, tbh; gfx->getTextBounds(pbuf, 0, 0, &tbx, &tby, &tbw, &tbh);
-    const int padding = 10; int total_w = VOL_ICON_W + padding + (int)tbw; int start_x = (480 - total_w) / 2;
+    const ui_gfx::Rect old = volRect_;
+    int band_y0 = 0; int band_h = 80;
+    snprintf(volPct_, sizeof(volPct_), "%d%%", effective);
+    const ui_gfx::Rect tb = ui_gfx::AaText::bounds(ui_gfx::kAaSans18, volPct_, 0, 0);
+    const int padding = 10; int total_w = VOL_ICON_W + padding + (int)tb.w; int start_x = (480 - total_w) / 2;
 
     // Update touch hit area (cover icon AND percentage text for easier mute toggle)
     int hit_left = start_x - 40; if (hit_left < 0) hit_left = 0;
     int hit_right = start_x + total_w + 20; if (hit_right > 480) hit_right = 480;
     volHitX_ = hit_left; volHitY_ = 0; volHitW_ = hit_right - hit_left; volHitH_ = band_h;
 
-    // Draw background only for the volume icon and text area
-    int icon_bg_x = start_x - 5; int icon_bg_w = total_w + 10; int icon_bg_y = VOL_ICON_Y - 5; int icon_bg_h = VOL_ICON_H + 10;
-    gfx->fillRect(icon_bg_x, icon_bg_y, icon_bg_w, icon_bg_h, header_bg);
-
-    gfx->setTextColor(WHITE, header_bg);
-    int icon_x = start_x; drawSpeaker_(icon_x, VOL_ICON_Y, muted);
-    int text_x = start_x + VOL_ICON_W + padding; int text_base_y = VOL_ICON_Y + (VOL_ICON_H + (int)tbh) / 2 - 2; gfx->setCursor(text_x, text_base_y); gfx->print(pbuf);
+    // Backdrop only for the volume icon and text area
+    volIconBox_ = ui_gfx::Rect{(int16_t)(start_x - 5), (int16_t)(VOL_ICON_Y - 5), (int16_t)(total_w + 10), (int16_t)(VOL_ICON_H + 10)};
+    volIconX_ = start_x; volTextX_ = start_x + VOL_ICON_W + padding - tb.x; volTextBaseY_ = VOL_ICON_Y + (VOL_ICON_H + (int)tb.h) / 2 - 2;
+    volRect_ = volIconBox_;
 
-    // Draw background only for the room name area
+    // Backdrop only for the room name area
+    volRoomBox_ = ui_gfx::Rect{};
     if (room.length()) {
-      gfx->setFont(&FreeSansBold12pt7b); int16_t rbx, rby; uint16_t rbw, rbh; gfx->getTextBounds(room.c_str(),0,0,&rbx,&rby,&rbw,&rbh);
-      int rx = 240 - (int)rbw/2; int ry = band_y0 + band_h - 10;
-      // Draw background only for room text
-      gfx->fillRect(rx - 5, ry - rbh - 2, rbw + 10, rbh + 4, header_bg);
-      gfx->setTextColor(WHITE, header_bg); gfx->setCursor(rx, ry); gfx->print(room);
+      const ui_gfx::Rect rb = ui_gfx::AaText::bounds(ui_gfx::kAaSans12, room.c_str(), 0, 0);
+      roomX_ = 240 - (int)rb.w/2 - rb.x; roomY_ = band_y0 + band_h - 10;
+      volRoomBox_ = ui_gfx::Rect{(int16_t)(roomX_ + rb.x - 5), (int16_t)(roomY_ + rb.y - 2), (int16_t)(rb.w + 10), (int16_t)(rb.h + 4)};
+      volRect_ = volRect_.united(volRoomBox_);
+    }
+    comp_.invalidate(old.united(volRect_));
+  }
+
+  // Layer 2: volume/room header
+  void paintHeader_(const ui_gfx::Rect& r) {
+    if (!volRect_.intersects(r)) return;
+    const uint16_t header_bg = RGB(10,10,10);
+    drawHeaderBackdrop_(volIconBox_, header_bg, r);
+    drawSpeaker_(volIconX_, VOL_ICON_Y, prevMuted_, r);
+    drawText_(ui_gfx::kAaSans18, volTextX_, volTextBaseY_, volPct_, WHITE, r);
+    if (!volRoomBox_.empty()) {
+      drawHeaderBackdrop_(volRoomBox_, header_bg, r);
+      drawText_(ui_gfx::kAaSans12, roomX_, roomY_, prevRoom_.c_str(), WHITE, r);
+    }
+  }
+
+  // Progress bar and time labels; what is shown is kept, so an update invalidates
+  // only the columns between the old and new knob (the fill edge lies in between)
+  // and the label cells whose character changed
+  void layoutProgress_() {
+    if (!g_) return;
+    if (!timeDigits_.valid()) timeDigits_.render(ui_gfx::kAaSans12, "0123456789:");
+    int pct = progressFn_ ? progressFn_() : 0; if (pct < 0) pct = 0; if (pct > 100) pct = 100;
+    const int16_t fill = (int16_t)(PRG_W * pct / 100);
+    if (prgFill_ < 0) comp_.invalidate(progressRect_());
+    else if (fill != prgFill_) {
+      const int lo = knobX_(fill < prgFill_ ? fill : prgFill_), hi = knobX_(fill < prgFill_ ? prgFill_ : fill);
+      comp_.invalidate(ui_gfx::Rect{(int16_t)(lo - PRG_KNOB_R - 1), (int16_t)(PRG_Y + PRG_H/2 - PRG_KNOB_R - 1),
+                                    (int16_t)(hi - lo + 2*PRG_KNOB_R + 3), (int16_t)(2*PRG_KNOB_R + 3)});
+    }
+    prgFill_ = fill;
+    char buf[12];
+    formatTime_(relTimeFn_ ? relTimeFn_() : String(), buf); layoutLabel_(relLabel_, buf, false);
+    formatTime_(durationFn_ ? durationFn_() : String(), buf);
+    if (!strcmp(buf, "0:00")) buf[0] = 0; // no duration (stream)
+    layoutLabel_(durLabel_, buf, true);
+  }
+  static int knobX_(int fill) { int kx = PRG_X + fill; return kx > PRG_X + PRG_W - 1 ? PRG_X + PRG_W - 1 : kx; }
+  // Sonos "H:MM:SS" as "M:SS", or "H:MM:SS" from an hour on; empty when it does not parse
+  // (NOT_IMPLEMENTED)
+  static void formatTime_(const String& s, char (&out)[12]) {
+    out[0] = 0;
+    const char* p = s.c_str(); char* e;
+    const long h = strtol(p, &e, 10); if (e == p || *e != ':') return;
+    p = e + 1; const long m = strtol(p, &e, 10); if (e == p || *e != ':') return;
+    p = e + 1; const long sec = strtol(p, &e, 10); if (e == p) return;
+    if (h > 0) snprintf(out, sizeof(out), "%ld:%02ld:%02ld", h, m, sec); else snprintf(out, sizeof(out), "%ld:%02ld", m, sec);
+  }
+  int16_t labelAdvance_(char c) const {
+    if (timeDigits_.has(c)) return timeDigits_.advance(c);
+    const char s[2] = {c, 0};
+    return ui_gfx::AaText::width(ui_gfx::kAaSans12, s);
+  }
+  ui_gfx::Rect labelCell_(char c, int16_t x) const {
+    if (timeDigits_.has(c)) return timeDigits_.box(c, x, PRG_LABEL_Y);
+    const ui_gfx::AaFont& f = ui_gfx::kAaSans12;
+    return ui_gfx::Rect{x, (int16_t)(PRG_LABEL_Y - f.ascent), labelAdvance_(c), (int16_t)(f.ascent + f.descent)};
+  }
+  ui_gfx::Rect labelBox_(const TimeLabel& l) const {
+    ui_gfx::Rect b; int16_t x = l.x;
+    for (const char* p = l.text; *p; x += labelAdvance_(*p++)) b = b.united(labelCell_(*p, x));
+    return b;
+  }
+  void layoutLabel_(TimeLabel& l, const char* text, bool alignRight) {
+    if (!strcmp(l.text, text)) return;
+    int16_t w = 0; for (const char* p = text; *p; ++p) w += labelAdvance_(*p);
+    const int16_t x = alignRight && PRG_W > w ? (int16_t)(PRG_X + PRG_W - w) : (int16_t)PRG_X;
+    bool sameCells = x == l.x && strlen(text) == strlen(l.text);
+    for (size_t i = 0; sameCells && text[i]; ++i) sameCells = labelAdvance_(text[i]) == labelAdvance_(l.text[i]);
+    if (sameCells) {
+      int16_t cx = x;
+      for (size_t i = 0; text[i]; cx += labelAdvance_(text[i++])) if (text[i] != l.text[i]) comp_.invalidate(labelCell_(text[i], cx));
+    } else {
+      TimeLabel n; strcpy(n.text, text); n.x = x;
+      comp_.invalidate(labelBox_(l).united(labelBox_(n)));
+    }
+    strcpy(l.text, text); l.x = x;
+  }
+  // Label characters from the digit strip (blended on the surface), the font renderer
+  // for anything else or when painting directly
+  void drawLabel_(const TimeLabel& l, const ui_gfx::Rect& r) {
+    uint16_t* surface = comp_.surface();
+    int16_t x = l.x;
+    for (const char* p = l.text; *p; x += labelAdvance_(*p++)) {
+      if (!labelCell_(*p, x).intersects(r)) continue;
+      if (surface && timeDigits_.has(*p)) { timeDigits_.blit(surface, sys::kScreenW, *p, x, PRG_LABEL_Y, r, WHITE); continue; }
+      const char s[2] = {*p, 0};
+      drawText_(ui_gfx::kAaSans12, x + timeDigits_.penOffset(*p), PRG_LABEL_Y, s, WHITE, r);
     }
   }
+  void fillClipped_(int x, int y, int w, int h, uint16_t color, const ui_gfx::Rect& clip) {
+    const ui_gfx::Rect a = ui_gfx::Rect{(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h}.intersected(clip);
+    if (!a.empty()) g_->fillRect(a.x, a.y, a.w, a.h, color);
+  }
+
+  // Layer 3: progress bar and time labels, painted within r only
+  void paintProgress_(const ui_gfx::Rect& r) {
+    if (!r.intersects(progressRect_()) || prgFill_ < 0) return;
+    fillClipped_(0, PRG_Y - 10, 480, PRG_H + 20, RGB(10,10,10), r);
+    fillClipped_(PRG_X + prgFill_, PRG_Y, PRG_W - prgFill_, PRG_H, RGB(30,30,30), r);
+    fillClipped_(PRG_X, PRG_Y, prgFill_, PRG_H, RGB(0,120,255), r);
+    const int kx = knobX_(prgFill_), ky = PRG_Y + PRG_H/2;
+    if (r.intersects(ui_gfx::Rect{(int16_t)(kx - PRG_KNOB_R), (int16_t)(ky - PRG_KNOB_R), 2*PRG_KNOB_R + 1, 2*PRG_KNOB_R + 1})) g_->fillCircle(kx, ky, PRG_KNOB_R, WHITE);
+    // Border: the rounded ends in full when r reaches them, otherwise its two edges
+    const uint16_t border = RGB(60,60,60);
+    const ui_gfx::Rect inner{(int16_t)(PRG_X + 4), 0, (int16_t)(PRG_W - 8), (int16_t)sys::kScreenH};
+    if (r.x < inner.x || r.x + r.w > inner.x + inner.w) g_->drawRoundRect(PRG_X-1, PRG_Y-1, PRG_W+2, PRG_H+2, 4, border);
+    else { fillClipped_(PRG_X, PRG_Y - 1, PRG_W, 1, border, r); fillClipped_(PRG_X, PRG_Y + PRG_H, PRG_W, 1, border, r); }
+    drawLabel_(relLabel_, r);
+    drawLabel_(durLabel_, r);
+  }
 
-  void drawProgress_() {
-    int pct = progressFn_ ? progressFn_() : 0; gfx->fillRect(0, PRG_Y - 10, 480, PRG_H + 20, RGB(10,10,10));
-    gfx->fillRect(PRG_X, PRG_Y, PRG_W, PRG_H, RGB(30,30,30)); int fw = (PRG_W * pct) / 100; gfx->fillRect(PRG_X, PRG_Y, fw, PRG_H, RGB(0,120,255));
-    int kx = PRG_X + fw; if (kx < PRG_X) kx = PRG_X; if (kx > PRG_X + PRG_W - 1) kx = PRG_X + PRG_W - 1; int ky = PRG_Y + PRG_H/2; int kr = 9; gfx->fillCircle(kx, ky, kr, WHITE);
-    gfx->drawRoundRect(PRG_X-1, PRG_Y-1, PRG_W+2, PRG_H+2, 4, RGB(60,60,60));
-    auto fmt_label=[&](const String &s)->String{ int a=s.indexOf(':'); if(a<0) return String(); int b=s.indexOf(':',a+1); if(b<0) return String(); int h=s.substring(0,a).toInt(); int m=s.substring(a+1,b).toInt(); int sec=s.substring(b+1).toInt(); char buf[12]; if(h>0) snprintf(buf,sizeof(buf),"%d:%02d:%02d",h,m,sec); else snprintf(buf,sizeof(buf),"%d:%02d",m,sec); return String(buf); };
-    String l = fmt_label(relTimeFn_ ? relTimeFn_() : String()); String r = fmt_label(durationFn_ ? durationFn_() : String()); String du_up=r; du_up.trim(); du_up.toUpperCase(); if (!r.length() || du_up=="NOT_IMPLEMENTED" || du_up=="00:00:00") { r=""; }
-    gfx->setFont(&FreeSansBold12pt7b); gfx->setTextColor(WHITE, RGB(10,10,10)); int yText = PRG_Y - 16; if (l.length()) { gfx->setCursor(PRG_X, yText); gfx->print(l); }
-    if (r.length()) { int16_t bx,by; uint16_t bw,bh; gfx->getTextBounds(r.c_str(),0,0,&bx,&by,&bw,&bh); int rx = PRG_X + PRG_W - bw; if (rx < PRG_X) rx = PRG_X; gfx->setCursor(rx, yText); gfx->print(r); }
+  // Play/pause state as shown
+  void layoutPlay_() {
+    const bool playing = isPlayingFn_ ? isPlayingFn_() : false;
+    if (playing == playing_) return;
+    playing_ = playing;
+    comp_.invalidate(playRect_());
+  }
+
+  // Layer 4: transport bar (prev | play/pause | next)
+  void paintControls_(const ui_gfx::Rect& r) {
+    if (!r.intersects(controlsRect_())) return;
+    int y0 = 480 - BTN_H; int cy = y0 + BTN_H/2;
+    g_->fillRect(0, y0, 480, BTN_H, RGB(0,0,0));
+    g_->drawFastVLine(BTN_W, y0 + 8, BTN_H - 16, RGB(40,40,40));
+    g_->drawFastVLine(BTN_W*2, y0 + 8, BTN_H - 16, RGB(40,40,40));
+    int margin = 36/2 + 12; // icons close to the center button
+    drawIconPrev_(BTN_W - margin, cy, WHITE);
+    drawIconNext_(BTN_W*2 + margin, cy, WHITE);
+    int cx = BTN_W + BTN_W/2; if (playing_) drawIconPause_(cx, cy, WHITE); else drawIconPlay_(cx, cy, WHITE);
   }
 
   albumart::BackgroundArt* bg_ = nullptr; // not owned
-  std::function<void()> overlayDrawCb_;
+  ui_gfx::Compositor comp_;
+  Arduino_GFX* g_ = nullptr;              // paint target: compositor surface or panel
   // Data suppliers
   std::function<bool()> isPlayingFn_; std::function<int()> volumeFn_; std::function<bool()> mutedFn_;
   std::function<int()> progressFn_; std::function<String()> titleFn_, artistFn_, roomFn_, relTimeFn_, durationFn_;
   int prevVol_ = -1; bool prevMuted_ = false; String prevRoom_;
-
-  // Touch hit areas (updated by drawVolume_)
+  bool playing_ = false;
+  uint8_t deferred_ = 0;                        // kLayout* bits waiting for the frame to finish
+
+  // Laid-out overlays
+  std::vector<TextLine> titleLines_; ui_gfx::Rect titleRect_;
+  bool marquee_ = false;                        // some title line scrolls
+  uint32_t marqueeMs_ = 0;                      // scroll time since the layout
+  unsigned long marqueeLast_ = 0;               // millis() of the last frame
+  ui_gfx::TextCache textCache_;
+  ui_gfx::LayoutCache layouts_;
+  int16_t prgFill_ = -1;                        // fill width shown, -1: not laid out
+  TimeLabel relLabel_, durLabel_;
+  ui_gfx::GlyphStrip timeDigits_;
+  char volPct_[8] = "";
+  ui_gfx::Rect volIconBox_, volRoomBox_, volRect_;
+  int volIconX_ = 0, volTextX_ = 0, volTextBaseY_ = 0, roomX_ = 0, roomY_ = 0;
+
+  // Touch hit areas (updated by layoutVolume_)
   mutable int volHitX_ = 0, volHitY_ = 0, volHitW_ = 0, volHitH_ = 0;
 };
 
 } // namespace ui
-
@@ -0,0 +1,162 @@
+// Reference renders of the generated atlases: fixed text sheets drawn into a 480x480
+// frame and through Arduino_GFX, compared by CRC-32. A regenerated atlas, a changed
+// kerning table or a different blend shows up here. With AAFONT_DUMP_DIR set the
+// renders are written there as PPM for inspection before the CRCs are updated.
+#include "HostTest.h"
+#include "gfx/AaFont.h"
+#include "gfx/fonts/AaFonts.h"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace ui_gfx;
+
+namespace {
+
+constexpr int kW = sys::kScreenW;
+constexpr int kH = sys::kScreenH;
+
+// Reference CRCs of the renders below, recorded after checking the dumps by eye
+constexpr uint32_t kSheetCrc = 0x93B38ED3;
+constexpr uint32_t kClippedCrc = 0xF74EDC5B;
+constexpr uint32_t kGfxOpaqueCrc = 0x3E3504B5;
+constexpr uint32_t kGfxTransparentCrc = 0xA929FBF0;
+constexpr uint32_t kCoverageCrc = 0x26592F51;
+
+struct Line {
+  const AaFont* font;
+  const char* text;
+  uint16_t color;
+};
+
+// Umlauts and ß, typographic quotes and dashes, kerning pairs, accents the atlas
+// lacks (fallback to the base letter) and Latin-1 bytes that are not UTF-8
+const Line kSheet[] = {
+  {&kAaSans12, "Grüße aus Köln – „Fußball“ über Ärger", 0xFFFF},
+  {&kAaSans12, "AVATAR Tokyo WAVE LT Ty Vo P. F, 'Yes' \"No\"", 0xFFE0},
+  {&kAaSans12, "Beyoncé · Déjà Vu · Sigur Rós · Dvořák · Łódź", 0x07FF},
+  {&kAaSans12, "Motörhead \xD6l 0123456789 {[(|)]} @#%&*?!", 0xF81F},
+  {&kAaSans18, "Grüße aus Köln – „Fußball“", 0xFFFF},
+  {&kAaSans18, "AVATAR Tokyo WAVE To Ty", 0xFD20},
+  {&kAaSans18, "Beyoncé – Déjà Vu … Ærø", 0x8410},
+  {&kAaSans24, "12:34  Vol 42%", 0xFFFF},
+  {&kAaSans24, "AVATAR WAVE Tokyo", 0x07E0},
+  {&kAaSans24, "Grüße „Köln“", 0xF800},  // ASCII atlas: base letters and plain quotes
+};
+
+// A cover-like background: coloured bands with a diagonal gradient
+uint16_t backgroundAt(int x, int y) {
+  const int r = (x * 31) / kW, g = ((x + y) * 63) / (kW + kH), b = 31 - (y * 31) / kH;
+  return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+void fillBackground(uint16_t* fb) {
+  for (int y = 0; y < kH; ++y)
+    for (int x = 0; x < kW; ++x) fb[y * kW + x] = backgroundAt(x, y);
+}
+
+uint32_t crcOf(const uint16_t* fb) { return hosttest::crc32(fb, (size_t)kW * kH * 2); }
+
+void dump(const char* name, const uint16_t* fb) {
+  const char* dir = getenv("AAFONT_DUMP_DIR");
+  if (!dir) return;
+  const std::string path = std::string(dir) + "/" + name + ".ppm";
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return;
+  fprintf(f, "P6\n%d %d\n255\n", kW, kH);
+  for (int i = 0; i < kW * kH; ++i) {
+    const uint16_t p = fb[i];
+    const uint8_t rgb[3] = {(uint8_t)((p >> 8) & 0xF8), (uint8_t)((p >> 3) & 0xFC), (uint8_t)(p << 3)};
+    fwrite(rgb, 1, 3, f);
+  }
+  fclose(f);
+  printf("wrote %s\n", path.c_str());
+}
+
+void checkCrc(const char* name, const uint16_t* fb, uint32_t expected) {
+  dump(name, fb);
+  const uint32_t crc = crcOf(fb);
+  CHECK_MSG(crc == expected, "%s: crc 0x%08X, expected 0x%08X", name, crc, expected);
+}
+
+int16_t drawSheet(uint16_t* fb, const Rect& clip) {
+  int16_t y = 40;
+  for (const Line& l : kSheet) {
+    AaText::draw(fb, kW, clip, *l.font, 24, y, l.text, l.color);
+    y += l.font->lineHeight + 6;
+  }
+  return y;
+}
+
+void testSheet() {
+  std::vector<uint16_t> fb(kW * kH);
+  fillBackground(fb.data());
+  drawSheet(fb.data(), Rect{0, 0, kW, kH});
+  checkCrc("sheet", fb.data(), kSheetCrc);
+}
+
+// Clip edges through the middle of glyphs; nothing may be drawn outside the clip
+void testClipped() {
+  std::vector<uint16_t> fb(kW * kH);
+  fillBackground(fb.data());
+  const Rect clip{61, 47, 233, 151};
+  drawSheet(fb.data(), clip);
+  size_t outside = 0;
+  for (int y = 0; y < kH; ++y)
+    for (int x = 0; x < kW; ++x) {
+      const bool in = x >= clip.x && x < clip.x + clip.w && y >= clip.y && y < clip.y + clip.h;
+      outside += !in && fb[y * kW + x] != backgroundAt(x, y);
+    }
+  CHECK_MSG(outside == 0, "%zu pixels changed outside the clip", outside);
+  checkCrc("clipped", fb.data(), kClippedCrc);
+}
+
+// The Arduino_GFX path: blended against a known background, or thresholded
+void testGfx() {
+  Arduino_Canvas canvas(kW, kH, nullptr);
+  CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+  uint16_t* fb = canvas.getFramebuffer();
+
+  canvas.fillRect(0, 0, kW, kH, 0x2945);
+  int16_t y = 60;
+  for (const Line& l : kSheet) {
+    AaText::draw(&canvas, *l.font, 24, y, l.text, l.color, 0x2945, true);
+    y += l.font->lineHeight + 6;
+  }
+  checkCrc("gfx_opaque", fb, kGfxOpaqueCrc);
+
+  fillBackground(fb);
+  y = 60;
+  for (const Line& l : kSheet) {
+    AaText::draw(&canvas, *l.font, 24, y, l.text, l.color, 0, false);
+    y += l.font->lineHeight + 6;
+  }
+  checkCrc("gfx_transparent", fb, kGfxTransparentCrc);
+}
+
+void testCoverage() {
+  std::vector<uint8_t> mask(kW * 64, 0);
+  AaText::coverage(mask.data(), kW, kW, 64, kAaSans18, 8, 40, "Grüße „Köln“ AVATAR");
+  const uint32_t crc = hosttest::crc32(mask.data(), mask.size());
+  CHECK_MSG(crc == kCoverageCrc, "coverage: crc 0x%08X, expected 0x%08X", crc, kCoverageCrc);
+}
+
+// Text in the background colour leaves the frame as it was, whatever the coverage
+void testSameColour() {
+  std::vector<uint16_t> fb(kW * kH, 0x4208);
+  for (const Line& l : kSheet) AaText::draw(fb.data(), kW, Rect{0, 0, kW, kH}, *l.font, 10, 100, l.text, 0x4208);
+  size_t changed = 0;
+  for (uint16_t p : fb) changed += p != 0x4208;
+  CHECK_MSG(changed == 0, "%zu pixels changed", changed);
+}
+
+} // namespace
+
+int main() {
+  testSheet();
+  testClipped();
+  testGfx();
+  testCoverage();
+  testSameColour();
+  return hosttest::result("aa_font_test");
+}
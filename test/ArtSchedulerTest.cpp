@@ -0,0 +1,233 @@
+// ArtScheduler with a simulated network and decoder: a skipped track's download and
+// decode stop instead of delaying the cover that is actually wanted. The fakes do not
+// sleep for a fixed time; they block on gates the test opens once the scheduler has
+// reached the state under test, so every count below is exact on any machine.
+#include "HostTest.h"
+#include "albumart/AlbumArtService.h"
+#include "albumart/ArtScheduler.h"
+#include "albumart/CoverCache.h"
+#include "albumart/Downloader.h"
+#include "gfx/FramebufferPool.h"
+#include <SPIFFS.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+using namespace albumart;
+
+namespace {
+
+// Upper bound for any wait; only reached when the scheduler is stuck
+constexpr auto kStuck = std::chrono::seconds(10);
+
+// A point the fake download or decode passes only while the gate is open or once its
+// job is cancelled. Counts arrivals and cancellations so the test can wait for them.
+class Gate {
+public:
+  // Worker side: false when cancelled before the gate opened
+  bool pass(const CancelToken* cancel) {
+    std::unique_lock<std::mutex> lock(m_);
+    ++arrived_;
+    cv_.notify_all();
+    // The token has no wakeup of its own: look at it every millisecond
+    while (!open_) {
+      if (CancelToken::isCancelled(cancel)) { ++cancelled_; cv_.notify_all(); return false; }
+      cv_.wait_for(lock, std::chrono::milliseconds(1));
+    }
+    return !CancelToken::isCancelled(cancel);
+  }
+
+  void open() { std::lock_guard<std::mutex> lock(m_); open_ = true; cv_.notify_all(); }
+  void close() { std::lock_guard<std::mutex> lock(m_); open_ = false; }
+  void reset() { std::lock_guard<std::mutex> lock(m_); open_ = false; arrived_ = cancelled_ = 0; }
+
+  // Test side: wait until n jobs arrived / n jobs were cancelled at the gate
+  bool waitArrived(int n) { return waitUntil([&] { return arrived_ >= n; }); }
+  bool waitCancelled(int n) { return waitUntil([&] { return cancelled_ >= n; }); }
+
+  int arrived() { std::lock_guard<std::mutex> lock(m_); return arrived_; }
+  int cancelled() { std::lock_guard<std::mutex> lock(m_); return cancelled_; }
+
+private:
+  template <typename Pred> bool waitUntil(Pred p) {
+    std::unique_lock<std::mutex> lock(m_);
+    return cv_.wait_for(lock, kStuck, p);
+  }
+
+  std::mutex m_;
+  std::condition_variable cv_;
+  bool open_ = false;
+  int arrived_ = 0, cancelled_ = 0;
+};
+
+Gate g_download;
+Gate g_decode;
+// Runs once on the decode worker at the end of the next decode, then clears itself
+std::atomic<void (*)()> g_afterDecode{nullptr};
+
+struct Delivery {
+  String url;
+  bool ok;
+};
+
+std::mutex g_mtx;
+std::condition_variable g_deliveredCv;
+std::vector<Delivery> g_delivered;
+
+void sink(void*, ArtResult& r) {
+  std::lock_guard<std::mutex> lock(g_mtx);
+  g_delivered.push_back(Delivery{r.url, r.ok});
+  g_deliveredCv.notify_all();
+}
+
+// The "image": a PNG signature (routes to createPngDecoder) and the URL
+class FakeDecoder : public IImageDecoder {
+public:
+  DecodeResult sizeOf(const uint8_t*, size_t) override { DecodeResult r; r.ok = true; r.w = r.h = 480; return r; }
+  bool decodeToRGB565(const uint8_t* d, size_t n, uint16_t* out, int w, int h) override {
+    if (!g_decode.pass(cancel_)) return false;
+    const uint16_t c = (uint16_t)hosttest::crc32(d, n);
+    for (int i = 0; i < w * h; ++i) out[i] = c;
+    if (void (*fn)() = g_afterDecode.exchange(nullptr)) fn();
+    return true;
+  }
+};
+
+const Delivery* find(const String& url) {
+  for (const Delivery& d : g_delivered) if (d.url == url) return &d;
+  return nullptr;
+}
+
+// Waits until url was delivered; nullptr when the scheduler got stuck
+const Delivery* waitFor(const String& url) {
+  std::unique_lock<std::mutex> lock(g_mtx);
+  g_deliveredCv.wait_for(lock, kStuck, [&] { return find(url) != nullptr; });
+  return find(url);
+}
+
+// Waits until the owner has nothing queued or running
+bool waitIdle(void* owner) {
+  const auto until = std::chrono::steady_clock::now() + kStuck;
+  while (ArtScheduler::instance().busy(owner)) {
+    if (std::chrono::steady_clock::now() > until) return false;
+    delay(1);
+  }
+  return true;
+}
+
+// Five track skips, each while the previous cover is still downloading: every
+// superseded transfer is cancelled, and only the last cover is decoded and delivered
+void testSkipBurst() {
+  g_download.reset();
+  g_decode.reset();
+  g_decode.open();
+  int owner = 0;
+  const int kSkips = 5;
+  String urls[kSkips];
+  for (int i = 0; i < kSkips; ++i) {
+    urls[i] = String("http://cdn.example/cover-") + String(i) + ".jpg";
+    CHECK(ArtScheduler::instance().submit(urls[i], ArtPriority::Background, sink, &owner) != 0);
+    CHECK_MSG(g_download.waitArrived(i + 1), "download %d never started", i);
+  }
+  // All but the last were cancelled mid-transfer; only then may the network deliver
+  CHECK(g_download.waitCancelled(kSkips - 1));
+  g_download.open();
+
+  const Delivery* last = waitFor(urls[kSkips - 1]);
+  CHECK_MSG(last, "final cover never delivered");
+  CHECK(last && last->ok);
+  CHECK(waitIdle(&owner));
+
+  std::lock_guard<std::mutex> lock(g_mtx);
+  for (int i = 0; i < kSkips - 1; ++i) CHECK_MSG(!find(urls[i]), "superseded cover %d was delivered", i);
+  CHECK(g_download.arrived() == kSkips);
+  CHECK(g_download.cancelled() == kSkips - 1);
+  CHECK(g_decode.arrived() == 1);
+}
+
+const String kEvictedUrl = "http://cdn.example/evicted.jpg";
+
+// Fills the cover cache with other covers until kEvictedUrl is gone
+void evictCover() {
+  CoverCache& cache = CoverCache::instance();
+  std::vector<uint16_t> frame(sys::kScreenW * sys::kScreenH);
+  HttpCacheMeta meta, probe;
+  bool fresh = false;
+  for (int i = 0; i < 10000 && cache.lookup(kEvictedUrl, probe, fresh); ++i) {
+    for (size_t p = 0; p < frame.size(); ++p) frame[p] = (uint16_t)((p / 7) * 2654435761u >> (i & 15));
+    cache.put(String("http://cdn.example/filler-") + String(i) + ".jpg", frame.data(), meta);
+  }
+}
+
+// A fresh cached cover is evicted after the download worker found it but before the
+// decode worker expands it: the job is fetched again instead of failing
+void testCacheEntryLost() {
+  g_download.reset();
+  g_decode.reset();
+  g_download.open();
+  int ownerA = 0, ownerB = 0, ownerC = 0;
+  std::vector<uint16_t> frame(sys::kScreenW * sys::kScreenH, 0x1234);
+  CoverCache::instance().put(kEvictedUrl, frame.data(), HttpCacheMeta());
+
+  // A holds the decode worker at the gate
+  const String urlA = "http://cdn.example/slow.jpg";
+  g_afterDecode = &evictCover;
+  CHECK(ArtScheduler::instance().submit(urlA, ArtPriority::Background, sink, &ownerA) != 0);
+  CHECK(g_decode.waitArrived(1));
+
+  // B is found fresh in the cache and queued for expansion. C, submitted after it,
+  // parks the download worker: once C's download started, B has been looked up.
+  g_download.close();
+  const String urlC = "http://cdn.example/probe.jpg";
+  CHECK(ArtScheduler::instance().submit(kEvictedUrl, ArtPriority::Background, sink, &ownerB) != 0);
+  CHECK(ArtScheduler::instance().submit(urlC, ArtPriority::Background, sink, &ownerC) != 0);
+  CHECK(g_download.waitArrived(2));  // A, C
+
+  // A's decode evicts B; B goes back to the download worker
+  g_decode.open();
+  g_download.open();
+  const Delivery* b = waitFor(kEvictedUrl);
+  CHECK_MSG(b, "cover with the lost cache entry never delivered");
+  CHECK_MSG(b && b->ok, "cover with the lost cache entry failed");
+  CHECK(waitFor(urlA) && waitFor(urlC));
+  CHECK(waitIdle(&ownerB) && waitIdle(&ownerC));
+  CHECK(g_afterDecode == nullptr);
+  CHECK(g_download.arrived() == 3);  // A, C, then B again
+  CHECK(g_decode.arrived() == 3);
+  HttpCacheMeta meta;
+  bool fresh = false;
+  CHECK(CoverCache::instance().lookup(kEvictedUrl, meta, fresh) && fresh);  // stored again
+}
+
+} // namespace
+
+// --- Link-time fakes for the network and the image backends ----------------------
+
+namespace albumart {
+
+bool Downloader::downloadArtToFile(const String& url, const char* path, ArtFetch& fetch) {
+  if (!g_download.pass(fetch.cancel)) return false;
+  static const uint8_t kSig[8] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A};
+  File f = SPIFFS.open(path, FILE_WRITE);
+  f.write(kSig, sizeof kSig);
+  f.write((const uint8_t*)url.c_str(), url.length());
+  f.close();
+  fetch.meta.url = url;
+  return true;
+}
+
+} // namespace albumart
+
+extern "C" IImageDecoder* createPngDecoder() { return new FakeDecoder(); }
+extern "C" IImageDecoder* createTjpgDecoder() { return new FakeDecoder(); }
+extern "C" IImageDecoder* createJpegdecDecoder() { return new FakeDecoder(); }
+extern "C" IImageDecoder* createProgJpegDecoder() { return new FakeDecoder(); }
+
+int main() {
+  CHECK(ui_gfx::FramebufferPool::instance().begin());
+  testSkipBurst();
+  testCacheEntryLost();
+  return hosttest::result("art_scheduler_test");
+}
@@ -0,0 +1,100 @@
+// BackgroundArt cross-fade: a cover arriving mid-fade continues from the mix that is
+// on screen, and a fade never holds more than two slabs.
+#include "HostTest.h"
+#include "albumart/BackgroundArt.h"
+#include "gfx/RoundMask.h"
+#include <vector>
+
+using namespace albumart;
+
+namespace {
+
+constexpr int kW = sys::kScreenW, kH = sys::kScreenH;
+
+ui_gfx::FbLease cover(uint16_t seed) {
+  ui_gfx::FbLease fb = ui_gfx::FramebufferPool::instance().acquire();
+  if (!fb) return fb;
+  uint16_t* p = fb.data();
+  for (int y = 0; y < kH; ++y)
+    for (int x = 0; x < kW; ++x) p[y * kW + x] = (uint16_t)(seed ^ (x * 37) ^ (y * 1021));
+  return fb;
+}
+
+// What blitRect/copyRect show: the mix of both covers during a fade
+std::vector<uint16_t> shown(const BackgroundArt& bg) {
+  std::vector<uint16_t> out(kW * kH, 0);
+  bg.copyRect(out.data(), kW, 0, 0, kW, kH, 0);
+  return out;
+}
+
+// Pixels inside the round panel that differ
+int visibleDiff(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b) {
+  int n = 0;
+  for (int y = 0; y < kH; ++y) {
+    int x = 0, w = kW;
+    if (!ui_gfx::RoundMask::clipRow(y, x, w)) continue;
+    for (int i = x; i < x + w; ++i) n += a[y * kW + i] != b[y * kW + i];
+  }
+  return n;
+}
+
+int slabsInUse() {
+  const ui_gfx::FramebufferPool& pool = ui_gfx::FramebufferPool::instance();
+  return pool.capacity() - pool.available();
+}
+
+void testNewCoverMidFade() {
+  BackgroundArt bg;
+  bg.present(cover(0x1111), CoverTone());
+  bg.tick();
+  CHECK(bg.ready() && !bg.fading());
+
+  bg.present(cover(0x2222), CoverTone());
+  bg.tick();
+  CHECK(bg.fading());
+  const unsigned long t0 = 1000;
+  bg.stepFade(t0);
+  CHECK(bg.stepFade(t0 + sys::kCoverFadeMs / 2));
+  CHECK(slabsInUse() == 2);
+
+  // Halfway through, the next cover arrives: the screen keeps the current mix
+  const std::vector<uint16_t> before = shown(bg);
+  bg.present(cover(0x3333), CoverTone());
+  bg.tick();
+  CHECK(bg.fading());
+  const std::vector<uint16_t> after = shown(bg);
+  const int diff = visibleDiff(before, after);
+  CHECK_MSG(diff == 0, "%d visible pixels jumped", diff);
+  CHECK_MSG(slabsInUse() == 2, "%d slabs in use", slabsInUse());
+
+  // Arriving before the first fade step: still the same picture
+  bg.present(cover(0x4444), CoverTone());
+  bg.tick();
+  CHECK(visibleDiff(after, shown(bg)) == 0);
+  CHECK(slabsInUse() == 2);
+
+  // The fade ends on the newest cover alone
+  bg.stepFade(t0 + 5000);
+  bg.stepFade(t0 + 5000 + sys::kCoverFadeMs);
+  CHECK(!bg.fading());
+  ui_gfx::FbLease expected = cover(0x4444);
+  std::vector<uint16_t> last(expected.data(), expected.data() + kW * kH);
+  expected.reset();
+  CHECK(visibleDiff(last, shown(bg)) == 0);
+  CHECK(slabsInUse() == 1);
+}
+
+} // namespace
+
+// --- Link-time fakes: no jobs are submitted here --------------------------------
+
+namespace albumart {
+ArtJobId ArtScheduler::submit(const String&, ArtPriority, ArtSink, void*) { return 0; }
+bool ArtScheduler::busy(void*) const { return false; }
+} // namespace albumart
+
+int main() {
+  CHECK(ui_gfx::FramebufferPool::instance().begin());
+  testNewCoverMidFade();
+  return hosttest::result("background_art_test");
+}
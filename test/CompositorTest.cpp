@@ -0,0 +1,231 @@
+// Compositor dirty rectangles on a MemDisplay panel: touching rectangles merge, the
+// list overflows into the rectangle that grows least, and flush() pushes exactly the
+// visible pixels of what was invalidated. A budgeted flush paints over several calls
+// and pushes nothing until the frame is complete. The PlayerScreen then runs its UI
+// events against the panel: pixels pushed per event are reported, and each frame must
+// equal a full recompose of the same state.
+#include "HostTest.h"
+#include "PlayerFixture.h"
+#include "gfx/Compositor.h"
+#include "gfx/MemDisplay.h"
+#include "gfx/RoundMask.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using ui_gfx::Compositor;
+using ui_gfx::MemDisplay;
+using ui_gfx::Rect;
+using ui_gfx::RoundMask;
+
+// The panel PlayerScreen paints to
+Arduino_GFX* gfx = nullptr;
+
+namespace {
+
+constexpr int kW = sys::kScreenW, kH = sys::kScreenH;
+
+std::unique_ptr<MemDisplay> makePanel() {
+  std::unique_ptr<MemDisplay> panel(new MemDisplay(ui_gfx::FramebufferPool::instance().acquire()));
+  CHECK(panel->begin(GFX_SKIP_OUTPUT_BEGIN));
+  panel->fillScreen(BLACK);
+  panel->resetCounters();
+  return panel;
+}
+
+bool visible(int x, int y) { return x >= RoundMask::rowStart(y) && x < RoundMask::rowEnd(y); }
+
+bool inside(const Rect& r, int x, int y) { return x >= r.x && x < r.x + r.w && y >= r.y && y < r.y + r.h; }
+
+bool sameRect(const Rect& a, const Rect& b) { return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h; }
+bool sameRects(const std::vector<Rect>& a, const std::vector<Rect>& b) {
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), sameRect);
+}
+
+// The rectangles a flush painted, put back together from their bands
+std::vector<Rect> joinBands(const std::vector<Rect>& bands) {
+  std::vector<Rect> out;
+  for (const Rect& b : bands) {
+    if (!out.empty()) {
+      Rect& l = out.back();
+      if (l.x == b.x && l.w == b.w && l.y + l.h == b.y) { l.h += b.h; continue; }
+    }
+    out.push_back(b);
+  }
+  std::sort(out.begin(), out.end(), [](const Rect& a, const Rect& b) { return a.y != b.y ? a.y < b.y : a.x < b.x; });
+  return out;
+}
+
+struct MergeCase {
+  const char* name;
+  std::vector<Rect> in;
+  std::vector<Rect> want;
+};
+
+void testMerge() {
+  std::vector<MergeCase> cases = {
+    {"overlapping", {{10, 10, 50, 50}, {40, 40, 50, 50}}, {{10, 10, 80, 80}}},
+    {"shared edge", {{100, 100, 50, 20}, {150, 100, 30, 20}}, {{100, 100, 80, 20}}},
+    {"disjoint", {{100, 100, 20, 20}, {300, 300, 20, 20}}, {{100, 100, 20, 20}, {300, 300, 20, 20}}},
+    // The third joins the first, and the union then reaches the second
+    {"chain", {{100, 200, 10, 10}, {130, 200, 10, 10}, {110, 200, 20, 10}}, {{100, 200, 40, 10}}},
+    {"contained", {{100, 100, 200, 200}, {150, 150, 10, 10}}, {{100, 100, 200, 200}}},
+    {"clipped to the screen", {{-20, -20, 60, 60}, {470, 470, 40, 40}, {500, 10, 10, 10}}, {{0, 0, 40, 40}, {470, 470, 10, 10}}},
+    // Seven disjoint boxes in a row: the seventh joins its neighbour, the cheapest union
+    {"overflow", {{0, 200, 10, 10}, {40, 200, 10, 10}, {80, 200, 10, 10}, {120, 200, 10, 10},
+                  {160, 200, 10, 10}, {200, 200, 10, 10}, {240, 200, 10, 10}},
+     {{0, 200, 10, 10}, {40, 200, 10, 10}, {80, 200, 10, 10}, {120, 200, 10, 10}, {160, 200, 10, 10}, {200, 200, 50, 10}}},
+  };
+  for (const MergeCase& c : cases) {
+    std::unique_ptr<MemDisplay> panel = makePanel();
+    Compositor comp;
+    CHECK(comp.begin(panel.get()));
+    std::vector<Rect> bands;
+    comp.addLayer([&](Arduino_GFX& g, const Rect& r) { bands.push_back(r); g.fillRect(r.x, r.y, r.w, r.h, WHITE); });
+    for (const Rect& r : c.in) comp.invalidate(r);
+    comp.flush();
+
+    const std::vector<Rect> got = joinBands(bands);
+    CHECK_MSG(sameRects(got, c.want), "%s: %zu rectangles painted, expected %zu", c.name, got.size(), c.want.size());
+    CHECK_MSG(comp.stats().rects == c.want.size(), "%s: %u rectangles pushed", c.name, (unsigned)comp.stats().rects);
+    CHECK(comp.stats().lastPasses == 1);
+
+    // Exactly the visible pixels of the merged rectangles reach the panel
+    uint32_t want = 0;
+    for (const Rect& r : c.want) want += RoundMask::visiblePixels(r.x, r.y, r.w, r.h);
+    CHECK_MSG(panel->counters().pixels == want && comp.stats().lastPixels == want, "%s: %u px pushed, %u reported, expected %u",
+              c.name, (unsigned)panel->counters().pixels, (unsigned)comp.stats().lastPixels, (unsigned)want);
+    size_t wrong = 0;
+    const uint16_t* fb = panel->pixels();
+    for (int y = 0; y < kH; ++y)
+      for (int x = 0; x < kW; ++x) {
+        bool in = false;
+        for (const Rect& r : c.want) in |= inside(r, x, y);
+        wrong += fb[y * kW + x] != (in && visible(x, y) ? WHITE : BLACK);
+      }
+    CHECK_MSG(wrong == 0, "%s: %zu panel pixels wrong", c.name, wrong);
+  }
+}
+
+uint16_t patternAt(int x, int y) { return (uint16_t)(x * 73 ^ y * 1237); }
+
+// A layer that takes 1 ms per band: with a 3 ms budget a pass paints at most three
+// of the 15 bands of a full frame
+void testBudget() {
+  std::unique_ptr<MemDisplay> panel = makePanel();
+  Compositor comp;
+  CHECK(comp.begin(panel.get()));
+  uint16_t* surface = comp.surface();
+  comp.addLayer([&](Arduino_GFX&, const Rect& r) {
+    const unsigned long t0 = micros();
+    for (int y = r.y; y < r.y + r.h; ++y)
+      for (int x = r.x; x < r.x + r.w; ++x) surface[y * kW + x] = patternAt(x, y);
+    while (micros() - t0 < 1000) {}
+  });
+
+  const uint32_t kBudgetUs = 3000;
+  const Rect late{200, 200, 20, 20};
+  comp.invalidateAll();
+  uint32_t passes = 0;
+  do {
+    comp.flush(kBudgetUs);
+    ++passes;
+    if (comp.painting()) CHECK_MSG(panel->counters().pixels == 0, "pass %u pushed %u px of a partial frame", passes, (unsigned)panel->counters().pixels);
+    // Invalidated mid-frame: waits for the next one
+    if (passes == 2) comp.invalidate(late);
+  } while (comp.painting() && passes < 100);
+
+  const int bands = (kH + Compositor::kBandRows - 1) / Compositor::kBandRows;
+  CHECK_MSG(passes >= (uint32_t)(bands + 2) / 3 && passes <= (uint32_t)bands, "%u passes for %d bands", passes, bands);
+  CHECK(comp.stats().lastPasses == passes);
+  CHECK(comp.stats().flushes == 1 && comp.stats().rects == 1);
+  CHECK(comp.dirty());
+  const uint32_t full = RoundMask::visiblePixels(0, 0, kW, kH);
+  CHECK_MSG(panel->counters().pixels == full, "%u px pushed, expected %u", (unsigned)panel->counters().pixels, (unsigned)full);
+  size_t wrong = 0;
+  for (int y = 0; y < kH; ++y)
+    for (int x = 0; x < kW; ++x) wrong += panel->pixels()[y * kW + x] != (visible(x, y) ? patternAt(x, y) : BLACK);
+  CHECK_MSG(wrong == 0, "%zu panel pixels wrong after the budgeted frame", wrong);
+  printf("budgeted full frame: %u passes of <= %u us, %u us in total\n", passes, (unsigned)kBudgetUs, (unsigned)comp.stats().lastUs);
+
+  // The late rectangle goes with the next frame, in one pass without a budget
+  panel->resetCounters();
+  comp.flush();
+  CHECK(!comp.painting() && !comp.dirty());
+  CHECK(comp.stats().lastPasses == 1);
+  CHECK(panel->counters().pixels == (uint32_t)late.area());
+}
+
+// --- PlayerScreen --------------------------------------------------------------
+
+struct Event {
+  const char* name;
+  void (*apply)(hosttest::PlayerFixture&);
+  bool quiet = false;  // nothing changed: nothing may be pushed
+};
+
+const Event kEvents[] = {
+  {"progress +1 s", [](hosttest::PlayerFixture& f) { f.state.relTime = "0:01:24"; f.screen().drawProgress(); }},
+  {"progress +1 %", [](hosttest::PlayerFixture& f) { f.state.progress = 29; f.state.relTime = "0:01:25"; f.screen().drawProgress(); }},
+  {"progress 9:59 -> 10:00", [](hosttest::PlayerFixture& f) {
+     f.state.relTime = "0:09:59"; f.screen().drawProgress(); f.state.relTime = "0:10:00"; f.screen().drawProgress(); }},
+  {"pause", [](hosttest::PlayerFixture& f) { f.state.playing = false; f.screen().drawPlay(); }},
+  {"play", [](hosttest::PlayerFixture& f) { f.state.playing = true; f.screen().drawPlay(); }},
+  {"volume 35 -> 36", [](hosttest::PlayerFixture& f) { f.state.volume = 36; f.screen().drawVolume(); }},
+  {"volume 36 -> 100", [](hosttest::PlayerFixture& f) { f.state.volume = 100; f.screen().drawVolume(); }},
+  {"mute", [](hosttest::PlayerFixture& f) { f.state.muted = true; f.screen().drawVolume(); }},
+  {"room change", [](hosttest::PlayerFixture& f) { f.state.room = "Küche"; f.screen().drawVolume(); }},
+  {"title change", [](hosttest::PlayerFixture& f) {
+     f.state.title = "Der Weg zur Arbeit"; f.state.artist = "Kraftklub"; f.screen().drawTitleOverlay(); }},
+  {"two-line title", [](hosttest::PlayerFixture& f) {
+     f.state.title = "Ein Lied über die Straßen von München im Regen"; f.state.artist = "Die Fantastischen Vier"; f.screen().drawTitleOverlay(); }},
+  {"nothing changed", [](hosttest::PlayerFixture& f) { f.screen().drawAllUi(); }, true},
+  {"volume + progress", [](hosttest::PlayerFixture& f) {
+     f.state.muted = false; f.state.volume = 40; f.state.relTime = "0:10:01"; f.screen().drawVolume(); f.screen().drawProgress(); }},
+};
+
+void testPlayerEvents() {
+  hosttest::PlayerFixture f;
+  MemDisplay& panel = f.panel();
+  const uint32_t full = RoundMask::visiblePixels(0, 0, kW, kH);
+  printf("%-24s %8s %7s %6s %6s %8s\n", "event", "px", "screen", "rects", "calls", "us");
+  printf("%-24s %8u %6.1f%% %6s %6s %8s\n", "full recompose", (unsigned)full, 100.0, "1", "-", "-");
+  for (const Event& e : kEvents) {
+    const Compositor::Stats before = f.screen().compositorStats();
+    panel.resetCounters();
+    const unsigned long t0 = micros();
+    e.apply(f);
+    f.drawFrame();
+    const unsigned long us = micros() - t0;
+    const Compositor::Stats& after = f.screen().compositorStats();
+    const MemDisplay::Counters c = panel.counters();
+    CHECK_MSG(after.flushes - before.flushes <= 1, "%s: %u pushes", e.name, (unsigned)(after.flushes - before.flushes));
+    CHECK_MSG(c.pixels == (after.flushes != before.flushes ? after.lastPixels : 0), "%s: %u px on the panel, compositor reports %u",
+              e.name, (unsigned)c.pixels, (unsigned)after.lastPixels);
+    if (e.quiet) CHECK_MSG(c.pixels == 0 && after.flushes == before.flushes, "%s: %u px pushed", e.name, (unsigned)c.pixels);
+    printf("%-24s %8u %6.1f%% %6u %6u %8lu\n", e.name, (unsigned)c.pixels, c.pixels * 100.0 / full,
+           (unsigned)(after.rects - before.rects), (unsigned)c.calls, us);
+
+    // The incremental frame equals the whole screen composed from the same state
+    const size_t diff = f.diffFromFullRecompose();
+    CHECK_MSG(diff == 0, "%s: %zu pixels differ from a full recompose", e.name, diff);
+  }
+}
+
+} // namespace
+
+// --- Link-time fakes: no cover jobs are submitted here ---------------------------
+
+namespace albumart {
+ArtJobId ArtScheduler::submit(const String&, ArtPriority, ArtSink, void*) { return 0; }
+bool ArtScheduler::busy(void*) const { return false; }
+} // namespace albumart
+
+int main() {
+  CHECK(ui_gfx::FramebufferPool::instance().begin());
+  testMerge();
+  testBudget();
+  testPlayerEvents();
+  return hosttest::result("compositor_test");
+}
@@ -0,0 +1,195 @@
+// The cross-fade's blend kernel and the fade through the player. blend565x2 must equal
+// blend565 on both halves of the word: every pair of channel values at every alpha,
+// plus random pixels; blend565Row at every alignment and short length, in place too,
+// without touching pixels past the row. Reports µs, MB/s and fps for a 480x480 frame
+// per kernel. Then a cover change runs through PlayerScreen on a MemDisplay panel:
+// every pushed frame is one push, and where the cover shows it is one alpha of the
+// new cover over the old one, rising to the new cover alone.
+#include "HostTest.h"
+#include "PlayerFixture.h"
+#include "gfx/Rgb565.h"
+#include <Arduino.h>
+#include <cstdio>
+#include <vector>
+
+using hosttest::PlayerFixture;
+using ui_gfx::blend565;
+using ui_gfx::blend565Row;
+using ui_gfx::blend565x2;
+
+// The panel PlayerScreen paints to
+Arduino_GFX* gfx = nullptr;
+
+namespace {
+
+constexpr int kW = sys::kScreenW, kH = sys::kScreenH;
+constexpr int kRuns = 200;
+
+uint32_t pair(uint16_t lo, uint16_t hi) { return lo | ((uint32_t)hi << 16); }
+
+bool sameAsScalar(uint16_t f0, uint16_t f1, uint16_t b0, uint16_t b1, uint8_t a) {
+  return blend565x2(pair(f0, f1), pair(b0, b1), a) == pair(blend565(f0, b0, a), blend565(f1, b1, a));
+}
+
+// u and v walk every pair of 6-bit values: green takes them whole, red and blue their
+// upper five bits (blue mirrored), so each channel sees all of its value pairs
+void testPairs() {
+  size_t wrong = 0;
+  for (int a = 0; a <= 32; ++a)
+    for (int u = 0; u < 64; ++u)
+      for (int v = 0; v < 64; ++v) {
+        const uint16_t f = (uint16_t)(((u >> 1) << 11) | (u << 5) | (31 - (u >> 1)));
+        const uint16_t b = (uint16_t)(((v >> 1) << 11) | (v << 5) | (31 - (v >> 1)));
+        wrong += !sameAsScalar(f, b, b, f, (uint8_t)a);
+        wrong += !sameAsScalar(f, f, b, b, (uint8_t)a);
+      }
+  CHECK_MSG(wrong == 0, "%zu channel pairs differ from blend565", wrong);
+
+  uint32_t s = 777;
+  auto next = [&] { s = s * 1103515245u + 12345u; return (uint16_t)(s >> 8); };
+  wrong = 0;
+  for (int i = 0; i < 200000; ++i) {
+    const uint16_t f0 = next(), f1 = next(), b0 = next(), b1 = next();
+    for (int a = 0; a <= 32; ++a) wrong += !sameAsScalar(f0, f1, b0, b1, (uint8_t)a);
+  }
+  CHECK_MSG(wrong == 0, "%zu random pixel pairs differ from blend565", wrong);
+}
+
+// Every start parity of dst, fg and bg and every length up to 41 pixels
+void testRow() {
+  constexpr int kLen = 48, kGuard = 0xDEAD;
+  alignas(4) uint16_t fg[kLen], bg[kLen], dst[kLen], want[kLen];
+  uint32_t s = 4242;
+  auto next = [&] { s = s * 1103515245u + 12345u; return (uint16_t)(s >> 8); };
+  size_t wrong = 0, guards = 0;
+  for (uint8_t a : {0, 1, 7, 16, 31, 32})
+    for (int od = 0; od < 2; ++od)
+      for (int of = 0; of < 2; ++of)
+        for (int ob = 0; ob < 2; ++ob)
+          for (int n = 0; n <= 41; ++n)
+            for (int mode = 0; mode < 3; ++mode) {  // separate dst, dst == fg, dst == bg
+              for (int i = 0; i < kLen; ++i) { fg[i] = next(); bg[i] = next(); dst[i] = kGuard; }
+              const uint16_t* f = fg + of;
+              const uint16_t* b = bg + ob;
+              uint16_t* d = dst + od;
+              if (mode == 1) { d = fg + of; }
+              if (mode == 2) { d = bg + ob; }
+              for (int i = 0; i < n; ++i) want[i] = blend565(f[i], b[i], a);
+              const int after = (int)(d - (mode == 1 ? fg : mode == 2 ? bg : dst)) + n;
+              const uint16_t guard = mode == 0 ? (uint16_t)kGuard : (mode == 1 ? fg : bg)[after];
+              blend565Row(d, f, b, n, a);
+              for (int i = 0; i < n; ++i) wrong += d[i] != want[i];
+              guards += after < kLen && (mode == 1 ? fg : mode == 2 ? bg : dst)[after] != guard;
+              guards += mode == 0 && od && dst[0] != kGuard;
+            }
+  CHECK_MSG(wrong == 0, "blend565Row: %zu pixels differ from blend565", wrong);
+  CHECK_MSG(guards == 0, "blend565Row: %zu writes outside the row", guards);
+}
+
+template <typename Fn> double usPerFrame(Fn fn) {
+  const unsigned long t0 = micros();
+  for (int i = 0; i < kRuns; ++i) fn();
+  return (double)(micros() - t0) / kRuns;
+}
+
+void benchFrame() {
+  std::vector<uint16_t> fg(kW * kH), bg(kW * kH), out(kW * kH);
+  for (int i = 0; i < kW * kH; ++i) { fg[i] = (uint16_t)(i * 2654435761u >> 16); bg[i] = (uint16_t)(i * 40503u); }
+  uint8_t a = 0;
+  const double scalar = usPerFrame([&] {
+    a = (uint8_t)((a + 5) & 31);
+    for (int i = 0; i < kW * kH; ++i) out[i] = blend565(fg[i], bg[i], a);
+  });
+  const double row = usPerFrame([&] {
+    a = (uint8_t)((a + 5) & 31);
+    for (int y = 0; y < kH; ++y) blend565Row(&out[y * kW], &fg[y * kW], &bg[y * kW], kW, a);
+  });
+  const double inPlace = usPerFrame([&] {
+    a = (uint8_t)((a + 5) & 31);
+    for (int y = 0; y < kH; ++y) blend565Row(&out[y * kW], &out[y * kW], &bg[y * kW], kW, a);
+  });
+  uint32_t sum = 0;
+  for (uint16_t p : out) sum += p;
+  const double mb = kW * kH * 2 / 1e6;
+  printf("%-24s %10s %10s %8s   (checksum %08X)\n", "480x480 frame", "us", "MB/s out", "fps", (unsigned)sum);
+  printf("%-24s %10.0f %10.0f %8.0f\n", "blend565", scalar, mb / scalar * 1e6, 1e6 / scalar);
+  printf("%-24s %10.0f %10.0f %8.0f\n", "blend565Row", row, mb / row * 1e6, 1e6 / row);
+  printf("%-24s %10.0f %10.0f %8.0f\n", "blend565Row in place", inPlace, mb / inPlace * 1e6, 1e6 / inPlace);
+}
+
+// A cover change through the player. Where a frame shows the cover (the starting frame
+// shows the old one there and the final frame the new one) it must be a single alpha
+// of the new cover over the old one for all such pixels.
+void testPlayerFade() {
+  PlayerFixture f;
+  constexpr uint16_t kNext = 0xA5C3;
+  const std::vector<uint16_t> start = f.frame();
+
+  f.art().present(PlayerFixture::cover(kNext), albumart::CoverTone());
+  f.art().tick();
+  CHECK(f.art().fading());
+  std::vector<std::vector<uint16_t>> frames;
+  const unsigned long t0 = millis();
+  while (f.art().fading() && millis() - t0 < 4 * sys::kCoverFadeMs) {
+    const uint32_t flushes = f.screen().compositorStats().flushes;
+    f.drawFrame();
+    const uint32_t pushes = f.screen().compositorStats().flushes - flushes;
+    CHECK_MSG(pushes <= 1, "%u pushes in one frame of the fade", (unsigned)pushes);
+    if (pushes) frames.push_back(f.frame());
+    delay(1);
+  }
+  const unsigned long ms = millis() - t0;
+  CHECK(!f.art().fading() && !frames.empty());
+  CHECK((int)frames.size() <= sys::kCoverFadeFrames + 1);
+
+  std::vector<int> shown;
+  for (int y = 0; y < kH; ++y)
+    for (int x = ui_gfx::RoundMask::rowStart(y); x < ui_gfx::RoundMask::rowEnd(y); ++x) {
+      const int i = y * kW + x;
+      const uint16_t o = PlayerFixture::coverPixel(PlayerFixture::kFirstCover, x, y), n = PlayerFixture::coverPixel(kNext, x, y);
+      if (o != n && start[i] == o && frames.back()[i] == n) shown.push_back(i);
+    }
+  CHECK(shown.size() > (size_t)kW * kH / 2);
+
+  int last = -1;
+  size_t off = 0;
+  for (const std::vector<uint16_t>& fr : frames) {
+    // The alpha this frame shows: the one that fits the most cover pixels
+    int best = -1;
+    size_t bestOff = shown.size() + 1;
+    for (int a = 0; a <= 32; ++a) {
+      size_t bad = 0;
+      for (int i : shown) {
+        const int x = i % kW, y = i / kW;
+        bad += fr[i] != blend565(PlayerFixture::coverPixel(kNext, x, y), PlayerFixture::coverPixel(PlayerFixture::kFirstCover, x, y), (uint8_t)a);
+        if (bad >= bestOff) break;
+      }
+      if (bad < bestOff) { best = a; bestOff = bad; }
+    }
+    CHECK_MSG(best > last, "alpha %d after %d", best, last);
+    last = best;
+    off += bestOff;
+  }
+  CHECK_MSG(off == 0, "%zu cover pixels are not one alpha of the two covers", off);
+  CHECK(last == 32);
+  printf("player fade: %zu frames in %lu ms (kCoverFadeMs %u), %zu cover pixels checked per frame\n", frames.size(), ms,
+         sys::kCoverFadeMs, shown.size());
+}
+
+} // namespace
+
+// --- Link-time fakes: no cover jobs are submitted here ---------------------------
+
+namespace albumart {
+ArtJobId ArtScheduler::submit(const String&, ArtPriority, ArtSink, void*) { return 0; }
+bool ArtScheduler::busy(void*) const { return false; }
+} // namespace albumart
+
+int main() {
+  CHECK(ui_gfx::FramebufferPool::instance().begin());
+  testPairs();
+  testRow();
+  benchFrame();
+  testPlayerFade();
+  return hosttest::result("cover_fade_test");
+}
@@ -0,0 +1,102 @@
+// Visible-window decoding of oversized covers: each backend decodes a 640/1000/1500 px
+// source into the 480x480 screen and, for comparison, into an output the size of the
+// whole (scaled) image, which leaves nothing to skip. The window must equal the
+// centre of the full decode pixel for pixel; both times are reported.
+#include "HostTest.h"
+#include "JpegCorpus.h"
+#include "albumart/decoders/IImageDecoder.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using hosttest::JpegSpec;
+
+extern "C" IImageDecoder* createTjpgDecoder();
+extern "C" IImageDecoder* createJpegdecDecoder();
+extern "C" IImageDecoder* createProgJpegDecoder();
+
+namespace {
+
+constexpr int kScreen = 480;
+constexpr int kRuns = 5;
+
+// Median wall time of kRuns decodes of jpg into a w x h frame
+double decodeMs(IImageDecoder* (*factory)(), const std::vector<uint8_t>& jpg, int w, int h,
+                std::vector<uint16_t>& frame, bool& ok) {
+  std::vector<double> ms;
+  ok = true;
+  for (int i = 0; i < kRuns; ++i) {
+    std::unique_ptr<IImageDecoder> dec(factory());
+    frame.assign((size_t)w * h, 0);
+    const unsigned long t0 = micros();
+    ok = dec->decodeToRGB565(jpg.data(), jpg.size(), frame.data(), w, h) && ok;
+    ms.push_back((micros() - t0) / 1000.0);
+  }
+  std::sort(ms.begin(), ms.end());
+  return ms[kRuns / 2];
+}
+
+// The kScreen x kScreen centre of a w x h frame
+std::vector<uint16_t> centre(const std::vector<uint16_t>& frame, int w, int h) {
+  std::vector<uint16_t> out((size_t)kScreen * kScreen);
+  const int x0 = (w - kScreen) / 2, y0 = (h - kScreen) / 2;
+  for (int y = 0; y < kScreen; ++y) {
+    std::copy_n(&frame[(size_t)(y0 + y) * w + x0], kScreen, &out[(size_t)y * kScreen]);
+  }
+  return out;
+}
+
+struct Backend {
+  const char* name;
+  IImageDecoder* (*factory)();
+  bool progressive;
+  int restartRows;
+};
+
+void testWindow() {
+  // The baseline backends show the source unscaled and centred. The progressive one
+  // scales it to cover the screen, so its sources are 4:3 at every DCT scale (edges
+  // rounded up to multiples of 32) and the window is the middle 480 of 640 columns
+  const Backend backends[] = {
+    {"tjpg", createTjpgDecoder, false, 0},
+    {"tjpg+dri", createTjpgDecoder, false, 1},
+    {"jpegdec", createJpegdecDecoder, false, 0},
+    {"progressive", createProgJpegDecoder, true, 0},
+  };
+  printf("%-12s %-24s %10s %10s %8s\n", "backend", "source", "full ms", "window ms", "saved");
+  uint32_t seed = 400;
+  for (const Backend& b : backends) {
+    for (int px : {640, 1000, 1500}) {
+      JpegSpec s;
+      s.w = b.progressive ? (px + 31) / 32 * 32 : px;
+      s.h = b.progressive ? s.w * 3 / 4 : px;
+      s.progressive = b.progressive;
+      s.restartRows = b.restartRows;
+      s.seed = seed++;
+      const std::vector<uint8_t> jpg = hosttest::makeJpeg(s);
+      const int fw = b.progressive ? kScreen * 4 / 3 : s.w, fh = b.progressive ? kScreen : s.h;
+
+      std::vector<uint16_t> full, window;
+      bool okFull = false, okWindow = false;
+      const double msFull = decodeMs(b.factory, jpg, fw, fh, full, okFull);
+      const double msWindow = decodeMs(b.factory, jpg, kScreen, kScreen, window, okWindow);
+      CHECK_MSG(okFull && okWindow, "%s %s failed", b.name, s.name().c_str());
+      CHECK_MSG(window == centre(full, fw, fh), "%s %s: window differs from the full decode", b.name, s.name().c_str());
+      if (!b.progressive) {
+        int w = 0, h = 0;
+        const std::vector<uint16_t> ref = hosttest::referenceDecode(jpg, w, h);
+        CHECK_MSG(full == ref, "%s %s: full decode differs from the reference", b.name, s.name().c_str());
+      }
+      printf("%-12s %-24s %10.2f %10.2f %7.0f%%\n", b.name, s.name().c_str(), msFull, msWindow,
+             100.0 * (1.0 - msWindow / msFull));
+    }
+  }
+}
+
+} // namespace
+
+int main() {
+  testWindow();
+  return hosttest::result("crop_window_test");
+}
@@ -0,0 +1,339 @@
+// Downloader against a loopback HTTP server (HttpTestServer.h) that plays the CDNs
+// under their real URLs: port 80 is mapped to the server, every host resolves to it.
+// The server also injects cuts and mid-body stalls to exercise Range resume, and
+// speaks TLS for the https keep-alive figures.
+#include "HostTest.h"
+#include "HttpTestServer.h"
+#include "albumart/CoverCache.h"
+#include "albumart/Downloader.h"
+#include "base/Config.h"
+#include <FS.h>
+#include <SPIFFS.h>
+#include <WiFi.h>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using albumart::Downloader;
+using albumart::HttpCacheMeta;
+using hosttest::HttpReply;
+using hosttest::HttpRequest;
+using hosttest::HttpTestServer;
+
+namespace {
+
+constexpr const char* kPath = "/dl_test.jpg";
+
+std::string readFile(const char* path) {
+  File f = SPIFFS.open(path, FILE_READ);
+  std::string s;
+  if (!f) return s;
+  s.resize(f.size());
+  f.read((uint8_t*)&s[0], s.size());
+  f.close();
+  return s;
+}
+
+// Deterministic body of n bytes, different per seed
+std::string body(size_t n, uint32_t seed) {
+  std::string s(n, '\0');
+  for (size_t i = 0; i < n; ++i) { seed = seed * 1103515245u + 12345u; s[i] = (char)(seed >> 16); }
+  return s;
+}
+
+// --- Simulated CDN --------------------------------------------------------------
+
+// Edge length of the variant a CDN path names; 0 for unknown paths (404)
+int variantPx(const std::string& path) {
+  static const struct { const char* key; int px; } kVariants[] = {
+    {"ab67616d000082c1", 1000}, {"ab67616d0000b273", 640}, {"ab67616d00001e02", 300},
+    {"-original.", 1400}, {"-t500x500.", 500},
+    {"/1400x1400bb.", 1400}, {"/480x480bb.", 480},
+    {"/1000x1000-", 1000}, {"/500x500-", 500},
+    {"/getaa?", 1400},      // the speaker proxies the original asset
+  };
+  for (const auto& v : kVariants) if (path.find(v.key) != std::string::npos) return v.px;
+  return 0;
+}
+
+// A JPEG cover of px x px at typical CDN quality: about 2 bits per pixel
+size_t coverBytes(int px) { return (size_t)px * px / 4; }
+
+struct CdnCase {
+  const char* source;
+  std::string url;
+  int originalPx, rewrittenPx;
+};
+
+// Original vs rewritten URL per source, bytes on the wire and wall time at a WiFi-like
+// 1 MB/s with 20 ms to the first byte. Times are reported, not asserted.
+void testCdnComparison() {
+  std::atomic<int> missingPx{0};
+  HttpTestServer srv([&](const HttpRequest& rq) {
+    HttpReply rp;
+    const int px = variantPx(rq.path);
+    if (!px || px == missingPx) { rp.status = 404; return rp; }
+    rp.body = body(coverBytes(px), (uint32_t)px);
+    rp.headers.push_back({"Content-Type", "image/jpeg"});
+    return rp;
+  });
+  srv.setRate(1000 * 1000);
+  srv.setHeadDelayMs(20);
+  WiFi.mapPort(80, srv.port());
+
+  // The speaker itself, proxying a SoundCloud original
+  const std::string getaa = "http://127.0.0.1/getaa?s=1&u=http%3A%2F%2Fi1.sndcdn.com%2Fartworks-000123456789-abcdef-original.jpg";
+  const CdnCase cases[] = {
+    {"spotify", "http://i.scdn.co/image/ab67616d000082c1e8107e6d9214baa81bb79bba", 1000, 640},
+    {"soundcloud", "http://i1.sndcdn.com/artworks-000123456789-abcdef-original.jpg", 1400, 500},
+    {"apple", "http://is1-ssl.mzstatic.com/image/thumb/Music/v4/aa/bb/cc/source/1400x1400bb.jpg", 1400, 480},
+    {"deezer", "http://e-cdns-images.dzcdn.net/images/cover/0123456789abcdef/1000x1000-000000-80-0-0.jpg", 1000, 500},
+    {"sonos-getaa", getaa, 1400, 500},
+  };
+
+  printf("%-12s %12s %8s %12s %8s %7s\n", "source", "original KB", "ms", "rewritten KB", "ms", "saved");
+  for (const CdnCase& c : cases) {
+    const String url(c.url.c_str());
+    Downloader::closeIdle();
+    uint64_t b0 = srv.bodyBytes;
+    unsigned long t0 = millis();
+    CHECK_MSG(Downloader::downloadToFile(url, kPath), "%s original", c.source);
+    const unsigned long origMs = millis() - t0;
+    const uint64_t origBytes = srv.bodyBytes - b0;
+    CHECK(readFile(kPath) == body(coverBytes(c.originalPx), (uint32_t)c.originalPx));
+
+    Downloader::closeIdle();
+    b0 = srv.bodyBytes;
+    t0 = millis();
+    CHECK_MSG(Downloader::downloadArtToFile(url, kPath), "%s rewritten", c.source);
+    const unsigned long rwMs = millis() - t0;
+    const uint64_t rwBytes = srv.bodyBytes - b0;
+    CHECK_MSG(readFile(kPath) == body(coverBytes(c.rewrittenPx), (uint32_t)c.rewrittenPx), "%s got the wrong variant", c.source);
+    CHECK_MSG(rwBytes < origBytes, "%s: %llu >= %llu bytes", c.source, (unsigned long long)rwBytes, (unsigned long long)origBytes);
+    printf("%-12s %12.1f %8lu %12.1f %8lu %6.0f%%\n", c.source, origBytes / 1024.0, origMs, rwBytes / 1024.0, rwMs,
+           100.0 * (1.0 - (double)rwBytes / (double)origBytes));
+  }
+
+  // A variant the CDN does not have: the original URL is fetched after the 404
+  missingPx = 500;
+  Downloader::closeIdle();
+  const uint64_t b0 = srv.bodyBytes;
+  CHECK(Downloader::downloadArtToFile(String(cases[3].url.c_str()), kPath));
+  CHECK(readFile(kPath) == body(coverBytes(1000), 1000u));
+  CHECK(srv.bodyBytes - b0 == coverBytes(1000));
+  Downloader::closeIdle();
+}
+
+// --- Stalls and cuts ---------------------------------------------------------------
+
+constexpr size_t kCoverBytes = 256 * 1024;
+constexpr long kFaultAt = 100 * 1024;
+
+struct FaultCase {
+  const char* path;
+  const char* what;
+  bool resumes;        // continues with a Range request
+  unsigned retries;    // attempts after the first
+};
+
+// One cover per path; the first request (no Range header) of each path hits its fault
+HttpReply faultyCover(const HttpRequest& rq) {
+  HttpReply rp;
+  const bool first = rq.header("range").empty();
+  const std::string& p = rq.path;
+  const bool changed = p == "/changed" && !first;
+  rp.body = body(kCoverBytes, changed ? 2u : 1u);
+  rp.headers.push_back({"ETag", changed ? "\"v2\"" : "\"v1\""});
+  rp.ranges = p != "/no-ranges";
+  if (!first) return rp;
+  if (p == "/cut" || p == "/changed") rp.cutAfter = kFaultAt;
+  if (p == "/chunked-cut") { rp.chunked = true; rp.cutAfter = kFaultAt; }
+  if (p == "/no-ranges") rp.cutAfter = kFaultAt;
+  if (p == "/stall") { rp.stallAfter = kFaultAt; rp.stallMs = sys::kHttpInactivityMs + 1000; }
+  if (p == "/short-stall") { rp.stallAfter = kFaultAt; rp.stallMs = sys::kHttpInactivityMs / 5; }
+  return rp;
+}
+
+// Each fault once at 1 MB/s: the file must come out whole, resumed where the server
+// allows it. Wall time and wire bytes are reported; the stall costs the inactivity
+// timeout (kHttpInactivityMs) before the transfer continues on a new connection.
+void testStallsAndCuts() {
+  HttpTestServer srv(faultyCover);
+  srv.setRate(1000 * 1000);
+  const FaultCase cases[] = {
+    {"/plain", "no fault", false, 0},
+    {"/cut", "reset at 100 KB", true, 1},
+    {"/chunked-cut", "chunked, reset", true, 1},
+    {"/short-stall", "1 s stall", false, 0},
+    {"/stall", "6 s stall", true, 1},
+    {"/no-ranges", "reset, no Range", false, 1},
+    {"/changed", "reset, new ETag", false, 1},
+  };
+  printf("%-18s %8s %9s %5s %7s %7s\n", "fault", "ms", "wire KB", "req", "resumed", "retries");
+  for (const FaultCase& c : cases) {
+    Downloader::closeIdle();
+    const albumart::DownloadStats s0 = Downloader::stats();
+    const uint64_t b0 = srv.bodyBytes;
+    const unsigned long t0 = millis();
+    CHECK_MSG(Downloader::downloadToFile(String((srv.origin() + c.path).c_str()), kPath), "%s failed", c.path);
+    const unsigned long ms = millis() - t0;
+    const albumart::DownloadStats& s1 = Downloader::stats();
+    const uint32_t resumed = s1.resumed - s0.resumed, retries = s1.retries - s0.retries;
+    CHECK_MSG(readFile(kPath) == body(kCoverBytes, strcmp(c.path, "/changed") == 0 ? 2u : 1u), "%s: wrong file", c.path);
+    CHECK_MSG(resumed == (c.resumes ? 1u : 0u), "%s: %u resumes", c.path, (unsigned)resumed);
+    CHECK_MSG(retries == c.retries, "%s: %u retries", c.path, (unsigned)retries);
+    CHECK_MSG(s1.bytes - s0.bytes == (c.retries && !c.resumes ? kCoverBytes + kFaultAt : kCoverBytes), "%s: %llu bytes stored",
+              c.path, (unsigned long long)(s1.bytes - s0.bytes));
+    if (!strcmp(c.path, "/stall")) CHECK(ms >= sys::kHttpInactivityMs);
+    printf("%-18s %8lu %9.1f %5u %7u %7u\n", c.what, ms, (srv.bodyBytes - b0) / 1024.0,
+           (unsigned)(s1.requests - s0.requests), (unsigned)resumed, (unsigned)retries);
+  }
+
+  // Keep-alive: five covers from one host over one connection, until closeIdle()
+  Downloader::closeIdle();
+  const unsigned conns = srv.connections;
+  const uint32_t reused = Downloader::stats().reused;
+  for (int i = 0; i < 5; ++i) CHECK(Downloader::downloadToFile(String((srv.origin() + "/plain").c_str()), kPath));
+  CHECK(srv.connections - conns == 1);
+  CHECK(Downloader::stats().reused - reused == 4);
+  Downloader::closeIdle();
+  CHECK(Downloader::downloadToFile(String((srv.origin() + "/plain").c_str()), kPath));
+  CHECK(srv.connections - conns == 2);
+  Downloader::closeIdle();
+}
+
+// --- Revalidation -----------------------------------------------------------------
+
+// A stale cached cover is revalidated the way the download worker does it: validators
+// from CoverCache::lookup go out as If-None-Match/If-Modified-Since, a 304 carries no
+// body and leaves both the spool file and the cache entry in place
+void testNotModified() {
+  std::atomic<int> version{1};
+  std::atomic<bool> etags{true};
+  HttpTestServer srv([&](const HttpRequest& rq) {
+    HttpReply rp;
+    const std::string etag = "\"c" + std::to_string(version.load()) + "\"";
+    const std::string modified = "Mon, 0" + std::to_string(version.load()) + " Jun 2026 10:00:00 GMT";
+    if (etags) rp.headers.push_back({"ETag", etag});
+    rp.headers.push_back({"Last-Modified", modified});
+    rp.headers.push_back({"Cache-Control", "max-age=0"});
+    const std::string inm = rq.header("if-none-match"), ims = rq.header("if-modified-since");
+    if (etags ? inm == etag : (inm.empty() && ims == modified)) { rp.status = 304; return rp; }
+    rp.body = body(kCoverBytes, (uint32_t)version.load());
+    return rp;
+  });
+  const String url((srv.origin() + "/art/cover.jpg").c_str());
+  albumart::CoverCache& cache = albumart::CoverCache::instance();
+  std::vector<uint16_t> frame(sys::kScreenW * sys::kScreenH), back(frame.size());
+  for (size_t i = 0; i < frame.size(); ++i) frame[i] = (uint16_t)(i / 480 * 97);
+
+  // Revalidates url from the cache entry; body bytes served by the server
+  auto revalidate = [&](albumart::ArtFetch& fetch) -> uint64_t {
+    bool fresh = true;
+    CHECK(cache.lookup(url, fetch.ifCached, fresh));
+    CHECK(!fresh);  // max-age=0
+    const uint64_t b0 = srv.bodyBytes;
+    CHECK(Downloader::downloadArtToFile(url, kPath, fetch));
+    return srv.bodyBytes - b0;
+  };
+
+  printf("%-26s %9s %7s\n", "request", "body KB", "status");
+  for (bool withEtag : {true, false}) {
+    etags = withEtag;
+    version = withEtag ? 1 : 3;
+    albumart::ArtFetch first;
+    uint64_t b0 = srv.bodyBytes;
+    CHECK(Downloader::downloadArtToFile(url, kPath, first));
+    CHECK(!first.notModified);
+    CHECK(srv.bodyBytes - b0 == kCoverBytes);
+    CHECK(first.meta.etag == (withEtag ? "\"c1\"" : ""));
+    CHECK(first.meta.lastModified.length() > 0);
+    cache.put(url, frame.data(), first.meta);
+    printf("%-26s %9.1f %7d\n", withEtag ? "first fetch" : "first fetch, no ETag", kCoverBytes / 1024.0, 200);
+
+    // Unchanged: headers only, file and cache entry kept
+    const uint32_t nm0 = Downloader::stats().notModified;
+    const unsigned conns = srv.connections;
+    albumart::ArtFetch again;
+    const uint64_t sent = revalidate(again);
+    CHECK(again.notModified);
+    CHECK(sent == 0);
+    CHECK(Downloader::stats().notModified - nm0 == 1);
+    CHECK(srv.connections == conns);  // the kept-alive connection carried it
+    const HttpRequest last = srv.log().back();
+    if (withEtag) CHECK(last.header("if-none-match") == "\"c1\"");
+    else CHECK(last.header("if-modified-since") == first.meta.lastModified.c_str());
+    CHECK(readFile(kPath) == body(kCoverBytes, (uint32_t)version.load()));
+    cache.revalidated(url, again.meta);
+    HttpCacheMeta meta;
+    bool fresh = false;
+    CHECK(cache.lookup(url, meta, fresh));
+    CHECK(cache.get(url, back.data()) && back == frame);
+    printf("%-26s %9.1f %7d\n", withEtag ? "If-None-Match, unchanged" : "If-Modified-Since", sent / 1024.0, 304);
+
+    // Changed on the server: the validator no longer matches, the new cover comes back
+    version = version + 1;
+    albumart::ArtFetch changed;
+    const uint64_t full = revalidate(changed);
+    CHECK(!changed.notModified);
+    CHECK(full == kCoverBytes);
+    CHECK(readFile(kPath) == body(kCoverBytes, (uint32_t)version.load()));
+    printf("%-26s %9.1f %7d\n", "validator stale", full / 1024.0, 200);
+  }
+  Downloader::closeIdle();
+}
+
+// --- HTTPS keep-alive -------------------------------------------------------------
+
+// 50 consecutive Spotify covers from a local TLS server, once with a fresh connection
+// per cover (every cover pays DNS, TCP and a full handshake) and once as the firmware
+// runs, with the connection kept alive. Handshake and time-to-first-byte figures come
+// from Downloader::stats(); there is no session resumption, so every new connection
+// is a full handshake.
+void testHttpsCovers() {
+  HttpTestServer srv([](const HttpRequest&) {
+    HttpReply rp;
+    rp.body = body(coverBytes(640), 640u);
+    rp.headers.push_back({"Content-Type", "image/jpeg"});
+    return rp;
+  }, true);
+  WiFi.mapPort(443, srv.port());
+  const int kCovers = 50;
+
+  printf("%-16s %6s %10s %10s %8s %9s %8s\n", "https covers", "conns", "handshakes", "avg hs ms", "lookups", "avg ttfb", "total ms");
+  for (bool keepAlive : {false, true}) {
+    Downloader::closeIdle();
+    const albumart::DownloadStats s0 = Downloader::stats();
+    const unsigned conns = srv.connections, hs = srv.handshakes, lookups = WiFi.lookups;
+    const unsigned long t0 = millis();
+    for (int i = 0; i < kCovers; ++i) {
+      if (!keepAlive) Downloader::closeIdle();
+      char url[96];
+      snprintf(url, sizeof url, "https://i.scdn.co/image/ab67616d0000b273%024x", 0xC0FFEE + i);
+      CHECK_MSG(Downloader::downloadArtToFile(String(url), kPath), "cover %d", i);
+    }
+    const unsigned long ms = millis() - t0;
+    const albumart::DownloadStats& s1 = Downloader::stats();
+    CHECK(readFile(kPath) == body(coverBytes(640), 640u));
+    const unsigned handshakes = s1.handshakes - s0.handshakes;
+    CHECK(handshakes == (keepAlive ? 1u : (unsigned)kCovers));
+    CHECK(srv.handshakes - hs == handshakes);
+    CHECK(srv.connections - conns == handshakes);
+    CHECK(s1.reused - s0.reused == (keepAlive ? kCovers - 1u : 0u));
+    printf("%-16s %6u %10u %10.1f %8u %9.2f %8lu\n", keepAlive ? "kept alive" : "fresh per cover", srv.connections - conns,
+           handshakes, (double)(s1.handshakeMs - s0.handshakeMs) / handshakes, WiFi.lookups - lookups,
+           (double)(s1.ttfbMs - s0.ttfbMs) / (s1.responses - s0.responses), ms);
+  }
+  Downloader::closeIdle();
+}
+
+} // namespace
+
+int main() {
+  testCdnComparison();
+  testStallsAndCuts();
+  testNotModified();
+  testHttpsCovers();
+  return hosttest::result("downloader_test");
+}
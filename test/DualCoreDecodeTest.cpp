@@ -0,0 +1,80 @@
+// TjpgBackend's band split (JpegSplit.h): a baseline cover with restart markers is
+// decoded in two bands, the lower one on the aa_band helper thread. The same cover
+// encoded without restart markers takes the single-band path and serves as the
+// single-core reference. Both frames must equal the reference decode bit for bit;
+// the speedup is reported, not asserted (it depends on the host's free cores).
+#include "HostTest.h"
+#include "JpegCorpus.h"
+#include "albumart/AlbumArtService.h"
+#include "albumart/JpegProbe.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using albumart::AlbumArtService;
+using hosttest::Chroma;
+using hosttest::JpegSpec;
+
+namespace {
+
+constexpr size_t kFrame = 480 * 480;
+constexpr int kRuns = 5;
+
+// Median wall time of kRuns decodes into frame
+double decodeMs(const std::vector<uint8_t>& jpg, std::vector<uint16_t>& frame, bool& ok) {
+  std::vector<double> ms;
+  ok = true;
+  for (int i = 0; i < kRuns; ++i) {
+    frame.assign(kFrame, 0);
+    const unsigned long t0 = micros();
+    ok = AlbumArtService::decodeToCropped480(jpg.data(), jpg.size(), frame.data()) && ok;
+    ms.push_back((micros() - t0) / 1000.0);
+  }
+  std::sort(ms.begin(), ms.end());
+  return ms[kRuns / 2];
+}
+
+void testBandSplit() {
+  printf("%-22s %6s %10s %10s %8s\n", "cover", "DRI", "1 core ms", "2 bands ms", "speedup");
+  double sumOne = 0, sumTwo = 0;
+  uint32_t seed = 300;
+  struct Case { int px; Chroma chroma; int restartRows; } cases[] = {
+    {480, Chroma::S420, 1}, {480, Chroma::S420, 4}, {480, Chroma::S444, 1}, {480, Chroma::Gray, 1},
+    {640, Chroma::S420, 1}, {1000, Chroma::S420, 1}, {1500, Chroma::S420, 2},
+  };
+  for (const Case& c : cases) {
+    JpegSpec s;
+    s.w = s.h = c.px;
+    s.chroma = c.chroma;
+    s.seed = seed++;
+    const std::vector<uint8_t> plain = hosttest::makeJpeg(s);
+    s.restartRows = c.restartRows;
+    const std::vector<uint8_t> dri = hosttest::makeJpeg(s);
+    CHECK_MSG(albumart::probeJpeg(dri.data(), dri.size()).restartInterval > 0, "%s has no DRI", s.name().c_str());
+
+    int w = 0, h = 0;
+    const std::vector<uint16_t> full = hosttest::referenceDecode(plain, w, h);
+    std::vector<uint16_t> want(kFrame, 0);
+    albumart::centerCropPadTo480(full.data(), w, h, want.data());
+
+    std::vector<uint16_t> one, two;
+    bool okOne = false, okTwo = false;
+    const double msOne = decodeMs(plain, one, okOne);
+    const double msTwo = decodeMs(dri, two, okTwo);
+    CHECK_MSG(okOne && okTwo, "%s failed", s.name().c_str());
+    CHECK_MSG(one == want, "%s without DRI differs from the reference", s.name().c_str());
+    CHECK_MSG(two == want, "%s split in two bands differs from the reference", s.name().c_str());
+    sumOne += msOne;
+    sumTwo += msTwo;
+    printf("%-22s %6d %10.2f %10.2f %7.2fx\n", s.name().c_str(), c.restartRows, msOne, msTwo, msOne / msTwo);
+  }
+  printf("corpus: %.2fx on %u hardware threads (above 480 px the DRI file also skips rows above the window)\n",
+         sumOne / sumTwo, std::thread::hardware_concurrency());
+}
+
+} // namespace
+
+int main() {
+  testBandSplit();
+  return hosttest::result("dual_core_decode_test");
+}
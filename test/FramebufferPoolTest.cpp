@@ -0,0 +1,127 @@
+// FramebufferPool soak: 10,000 cover changes through the decode-worker -> UI handover
+// must not touch the heap after begin(), and misused leases must be refused.
+#include "HostTest.h"
+#include "esp_heap_caps.h"
+#include "gfx/FramebufferPool.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+using ui_gfx::FbLease;
+using ui_gfx::FramebufferPool;
+
+namespace {
+
+std::atomic<bool> g_counting{false};
+std::atomic<uint32_t> g_news{0};
+
+} // namespace
+
+// Every C++ allocation in the process is counted while g_counting is set
+void* operator new(size_t n) {
+  if (g_counting.load(std::memory_order_relaxed)) g_news++;
+  if (void* p = malloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+namespace {
+
+constexpr int kChanges = 10000;
+
+// Decode worker and UI as in albumart::BackgroundArt: the worker fills a slab and
+// publishes it through an atomic handle, the UI adopts it and drops the cover it showed
+void testSoak() {
+  FramebufferPool& pool = FramebufferPool::instance();
+  const HeapCapsCounters caps0 = heap_caps_test_counters();
+  std::atomic<uint32_t> handover{0};
+  std::atomic<int> decoded{0}, shown{0}, starved{0};
+  std::atomic<bool> go{false};
+
+  // The thread is created before counting starts: only the handover loop is measured
+  std::thread worker([&] {
+    while (!go) std::this_thread::yield();
+    for (int i = 0; i < kChanges; ) {
+      if (handover.load()) { std::this_thread::yield(); continue; }  // UI has not taken the last one
+      FbLease fb = pool.acquire();
+      if (!fb) { starved++; std::this_thread::yield(); continue; }
+      for (int k = 0; k < sys::kScreenW; ++k) fb.data()[k] = (uint16_t)i;  // "decode"
+      handover.store(fb.detach());
+      decoded++; ++i;
+    }
+  });
+  g_news = 0;
+  g_counting = true;
+  go = true;
+  FbLease shownFb;
+  while (shown < kChanges) {
+    const uint32_t h = handover.exchange(0);
+    if (!h) { std::this_thread::yield(); continue; }
+    FbLease next = FbLease::adopt(h);
+    CHECK_MSG(next && next.data()[0] == (uint16_t)shown.load(), "cover %d lost or mixed up", shown.load());
+    shownFb = std::move(next);  // the old cover's slab goes back to the pool
+    shown++;
+  }
+  worker.join();
+  g_counting = false;
+  CHECK_MSG(g_news == 0, "%u allocations during %d cover changes", g_news.load(), kChanges);
+  const HeapCapsCounters& caps = heap_caps_test_counters();
+  CHECK(caps.allocs == caps0.allocs && caps.frees == caps0.frees && caps.liveBytes == caps0.liveBytes);
+  CHECK(decoded == kChanges && shown == kChanges);
+  CHECK_MSG(starved == 0, "worker found no free slab %d times", starved.load());
+  shownFb.reset();
+  CHECK(pool.available() == pool.capacity());
+  printf("%d cover changes, %u heap allocations after begin()\n", kChanges, g_news.load());
+}
+
+// A detached handle is good for exactly one adopt; a released slab's handle is stale
+void testStaleHandles() {
+  FramebufferPool& pool = FramebufferPool::instance();
+  FbLease a = pool.acquire();
+  CHECK(a);
+  const uint32_t h = a.detach();
+  CHECK(!a && h != 0);
+  FbLease b = FbLease::adopt(h);
+  CHECK(b);
+  b.reset();
+  CHECK(!FbLease::adopt(h));                    // released since
+  CHECK(pool.available() == pool.capacity());
+
+  FbLease c = pool.acquire();
+  const uint32_t hc = c.detach();
+  FbLease d = FbLease::adopt(hc);
+  uint16_t* const d0 = d.data();
+  FbLease e = pool.acquire();                   // never d's slab
+  CHECK(e && e.data() != d.data());
+  d.reset();
+  FbLease f = pool.acquire();                   // same slot as d, new generation
+  CHECK(f && f.data() == d0);
+  CHECK(!FbLease::adopt(hc));
+  CHECK(!FbLease::adopt(0));
+}
+
+void testExhaustion() {
+  FramebufferPool& pool = FramebufferPool::instance();
+  FbLease all[FramebufferPool::kMaxSlabs];
+  for (int i = 0; i < pool.capacity(); ++i) {
+    all[i] = pool.acquire();
+    CHECK(all[i]);
+  }
+  CHECK(!pool.acquire());
+  CHECK(pool.available() == 0);
+  all[0].reset();
+  CHECK(pool.available() == 1);
+}
+
+} // namespace
+
+int main() {
+  CHECK(FramebufferPool::instance().begin(sys::kFramebufferSlabs));
+  CHECK(FramebufferPool::instance().capacity() == sys::kFramebufferSlabs);
+  testSoak();
+  testStaleHandles();
+  testExhaustion();
+  return hosttest::result("framebuffer_pool_test");
+}
@@ -0,0 +1,39 @@
+#pragma once
+// Minimal checks for the host tests: a failed CHECK prints where and why and makes
+// the test exit non-zero, the test keeps running so one run shows every failure.
+#include <cstdint>
+#include <cstdio>
+#include <cstddef>
+
+namespace hosttest {
+
+inline int& failures() { static int n = 0; return n; }
+
+inline void fail(const char* file, int line, const char* expr, const char* detail = nullptr) {
+  ++failures();
+  fprintf(stderr, "%s:%d: CHECK failed: %s%s%s\n", file, line, expr, detail ? " -- " : "", detail ? detail : "");
+}
+
+// Exit code for main()
+inline int result(const char* name) {
+  if (failures()) fprintf(stderr, "%s: %d check(s) failed\n", name, failures());
+  else printf("%s: ok\n", name);
+  fflush(stdout);
+  return failures() ? 1 : 0;
+}
+
+// CRC-32 (IEEE), as zlib and the golden files use
+inline uint32_t crc32(const void* data, size_t n, uint32_t crc = 0) {
+  const uint8_t* p = (const uint8_t*)data;
+  crc = ~crc;
+  while (n--) {
+    crc ^= *p++;
+    for (int k = 0; k < 8; ++k) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+} // namespace hosttest
+
+#define CHECK(expr) do { if (!(expr)) ::hosttest::fail(__FILE__, __LINE__, #expr); } while (0)
+#define CHECK_MSG(expr, ...) do { if (!(expr)) { char m_[256]; snprintf(m_, sizeof m_, __VA_ARGS__); ::hosttest::fail(__FILE__, __LINE__, #expr, m_); } } while (0)
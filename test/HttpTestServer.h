@@ -0,0 +1,304 @@
+#pragma once
+// Loopback HTTP/1.1 server for the downloader tests. A handler maps each request to a
+// reply; the server adds Content-Length or chunked framing, answers Range requests
+// (If-Range checked against the ETag), keeps connections alive and can throttle the
+// body to a WiFi-like rate, delay the head, cut the connection or stall mid-body.
+// Counts connections, requests and body bytes so tests can assert what went over
+// the wire. With `tls` set it speaks HTTPS (OpenSSL, throwaway self-signed P-256
+// certificate) and counts completed handshakes.
+#include <arpa/inet.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+#include <csignal>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hosttest {
+
+struct HttpRequest {
+  std::string method, path;
+  std::map<std::string, std::string> headers; // names lower-cased
+
+  std::string header(const char* name) const {
+    auto it = headers.find(name);
+    return it == headers.end() ? std::string() : it->second;
+  }
+};
+
+struct HttpReply {
+  int status = 200;
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::string body;
+  bool chunked = false;
+  bool close = false;      // Connection: close, then close
+  bool ranges = true;      // answer Range requests with 206
+  long cutAfter = -1;      // close the connection after this many body bytes
+  long stallAfter = -1;    // pause after this many body bytes ...
+  unsigned stallMs = 0;    // ... for this long
+  std::string etag() const {
+    for (const auto& h : headers) if (strcasecmp(h.first.c_str(), "ETag") == 0) return h.second;
+    return std::string();
+  }
+};
+
+class HttpTestServer {
+public:
+  using Handler = std::function<HttpReply(const HttpRequest&)>;
+
+  explicit HttpTestServer(Handler h, bool tls = false) : handler_(std::move(h)) {
+    if (tls && !initTls()) { fprintf(stderr, "HttpTestServer: TLS setup failed\n"); return; }
+    lfd_ = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(lfd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof one);
+    sockaddr_in a{};
+    a.sin_family = AF_INET;
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(lfd_, (sockaddr*)&a, sizeof a) != 0 || listen(lfd_, 16) != 0) { perror("HttpTestServer"); return; }
+    socklen_t len = sizeof a;
+    getsockname(lfd_, (sockaddr*)&a, &len);
+    port_ = ntohs(a.sin_port);
+    acceptor_ = std::thread([this] { acceptLoop(); });
+  }
+
+  ~HttpTestServer() {
+    stop_ = true;
+    shutdown(lfd_, SHUT_RDWR);
+    if (acceptor_.joinable()) acceptor_.join();
+    close(lfd_);
+    std::vector<std::thread> workers;
+    {
+      std::lock_guard<std::mutex> lock(m_);
+      for (int fd : fds_) shutdown(fd, SHUT_RDWR);
+      workers.swap(workers_);
+    }
+    for (std::thread& t : workers) t.join();
+    if (ctx_) SSL_CTX_free(ctx_);
+  }
+
+  uint16_t port() const { return port_; }
+  // http(s)://<host>:<port>
+  std::string origin(const char* host = "127.0.0.1") const {
+    return (ctx_ ? "https://" : "http://") + std::string(host) + ":" + std::to_string(port_);
+  }
+
+  // Body bytes per second (0: unthrottled) and the delay before each response head
+  void setRate(size_t bytesPerSec) { rate_ = bytesPerSec; }
+  void setHeadDelayMs(unsigned ms) { headDelayMs_ = ms; }
+
+  std::atomic<unsigned> connections{0};
+  std::atomic<unsigned> requests{0};
+  std::atomic<uint64_t> bodyBytes{0};
+  std::atomic<unsigned> handshakes{0};
+
+  // Every request received so far
+  std::vector<HttpRequest> log() const {
+    std::lock_guard<std::mutex> lock(m_);
+    return log_;
+  }
+
+private:
+  // One accepted connection; ssl is null for plain HTTP
+  struct Link {
+    int fd = -1;
+    SSL* ssl = nullptr;
+  };
+
+  bool initTls() {
+    signal(SIGPIPE, SIG_IGN); // SSL_write to a peer that hung up
+    EVP_PKEY* key = EVP_EC_gen("P-256");
+    X509* cert = X509_new();
+    bool ok = key && cert;
+    if (ok) {
+      ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+      X509_gmtime_adj(X509_getm_notBefore(cert), -3600);
+      X509_gmtime_adj(X509_getm_notAfter(cert), 86400);
+      X509_set_pubkey(cert, key);
+      X509_NAME* name = X509_get_subject_name(cert);
+      X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, (const unsigned char*)"localhost", -1, -1, 0);
+      X509_set_issuer_name(cert, name);
+      ok = X509_sign(cert, key, EVP_sha256()) > 0;
+    }
+    ctx_ = ok ? SSL_CTX_new(TLS_server_method()) : nullptr;
+    ok = ctx_ && SSL_CTX_use_certificate(ctx_, cert) == 1 && SSL_CTX_use_PrivateKey(ctx_, key) == 1;
+    X509_free(cert);
+    EVP_PKEY_free(key);
+    return ok;
+  }
+
+  void acceptLoop() {
+    while (!stop_) {
+      pollfd p{lfd_, POLLIN, 0};
+      if (poll(&p, 1, 50) != 1) continue;
+      int fd = accept(lfd_, nullptr, nullptr);
+      if (fd < 0) continue;
+      ++connections;
+      std::lock_guard<std::mutex> lock(m_);
+      fds_.push_back(fd);
+      workers_.emplace_back([this, fd] { serve(fd); });
+    }
+  }
+
+  bool recvHead(Link& ln, std::string& buf, std::string& head) {
+    for (;;) {
+      size_t e = buf.find("\r\n\r\n");
+      if (e != std::string::npos) { head = buf.substr(0, e); buf.erase(0, e + 4); return true; }
+      if (stop_) return false;
+      pollfd p{ln.fd, POLLIN, 0};
+      if (!(ln.ssl && SSL_pending(ln.ssl) > 0) && poll(&p, 1, 50) != 1) continue;
+      char tmp[2048];
+      ssize_t n = ln.ssl ? SSL_read(ln.ssl, tmp, sizeof tmp) : recv(ln.fd, tmp, sizeof tmp, 0);
+      if (n <= 0) return false;
+      buf.append(tmp, (size_t)n);
+    }
+  }
+
+  static HttpRequest parse(const std::string& head) {
+    HttpRequest rq;
+    size_t eol = head.find("\r\n");
+    std::string line = head.substr(0, eol);
+    size_t s1 = line.find(' '), s2 = line.find(' ', s1 + 1);
+    rq.method = line.substr(0, s1);
+    rq.path = line.substr(s1 + 1, s2 - s1 - 1);
+    while (eol != std::string::npos) {
+      size_t next = head.find("\r\n", eol + 2);
+      std::string h = head.substr(eol + 2, next == std::string::npos ? std::string::npos : next - eol - 2);
+      size_t colon = h.find(':');
+      if (colon != std::string::npos) {
+        std::string name = h.substr(0, colon), value = h.substr(colon + 1);
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        value.erase(0, value.find_first_not_of(' '));
+        rq.headers[name] = value;
+      }
+      eol = next;
+    }
+    return rq;
+  }
+
+  bool sendAll(Link& ln, const char* p, size_t n) {
+    while (n) {
+      ssize_t w = ln.ssl ? SSL_write(ln.ssl, p, (int)n) : send(ln.fd, p, n, MSG_NOSIGNAL);
+      if (w <= 0) return false;
+      p += w; n -= (size_t)w;
+    }
+    return true;
+  }
+
+  void sleepMs(unsigned ms) {
+    for (unsigned t = 0; t < ms && !stop_; t += 10) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // Body bytes [from, to) of the reply, throttled, framed and fault-injected.
+  // False when the connection has to close.
+  bool sendBody(Link& ln, const HttpReply& rp, size_t from, size_t to) {
+    const auto t0 = std::chrono::steady_clock::now();
+    size_t sent = 0;
+    bool stalled = false;
+    for (size_t pos = from; pos < to;) {
+      size_t n = std::min<size_t>(1460, to - pos);
+      if (rp.cutAfter >= 0) {
+        if ((long)sent >= rp.cutAfter) return false;
+        n = std::min<size_t>(n, (size_t)rp.cutAfter - sent);
+      }
+      if (rp.stallAfter >= 0 && !stalled) {
+        if ((long)sent >= rp.stallAfter) { stalled = true; sleepMs(rp.stallMs); }
+        else n = std::min<size_t>(n, (size_t)rp.stallAfter - sent);
+      }
+      if (rp.chunked) {
+        char sz[16];
+        snprintf(sz, sizeof sz, "%zx\r\n", n);
+        if (!sendAll(ln, sz, strlen(sz))) return false;
+      }
+      if (!sendAll(ln, rp.body.data() + pos, n)) return false;
+      if (rp.chunked && !sendAll(ln, "\r\n", 2)) return false;
+      bodyBytes += n;
+      pos += n; sent += n;
+      if (rate_) {
+        const auto due = t0 + std::chrono::microseconds((uint64_t)sent * 1000000 / rate_);
+        std::this_thread::sleep_until(due);
+      }
+      if (stop_) return false;
+    }
+    return !rp.chunked || sendAll(ln, "0\r\n\r\n", 5);
+  }
+
+  void serve(int sock) {
+    Link ln{sock, nullptr};
+    if (ctx_) {
+      ln.ssl = SSL_new(ctx_);
+      SSL_set_fd(ln.ssl, sock);
+      if (SSL_accept(ln.ssl) == 1) ++handshakes;
+      else { SSL_free(ln.ssl); ln.ssl = nullptr; ln.fd = -1; }
+    }
+    std::string buf, head;
+    while (!stop_ && ln.fd >= 0 && recvHead(ln, buf, head)) {
+      HttpRequest rq = parse(head);
+      ++requests;
+      {
+        std::lock_guard<std::mutex> lock(m_);
+        log_.push_back(rq);
+      }
+      HttpReply rp = handler_(rq);
+      size_t from = 0, to = rp.body.size();
+      int status = rp.status;
+      std::string extra;
+      const std::string range = rq.header("range");
+      const std::string ifRange = rq.header("if-range");
+      if (status == 200 && rp.ranges && range.rfind("bytes=", 0) == 0 && (ifRange.empty() || ifRange == rp.etag())) {
+        from = strtoul(range.c_str() + 6, nullptr, 10);
+        if (from >= rp.body.size()) {
+          status = 416;
+          from = to;
+          extra = "Content-Range: bytes */" + std::to_string(rp.body.size()) + "\r\n";
+        } else {
+          status = 206;
+          extra = "Content-Range: bytes " + std::to_string(from) + "-" + std::to_string(to - 1) + "/" + std::to_string(rp.body.size()) + "\r\n";
+        }
+      }
+      if (status == 304 || status == 416) from = to;
+      std::string out = "HTTP/1.1 " + std::to_string(status) + " X\r\n" + extra;
+      for (const auto& h : rp.headers) out += h.first + ": " + h.second + "\r\n";
+      if (status != 304) out += rp.chunked ? std::string("Transfer-Encoding: chunked\r\n") : "Content-Length: " + std::to_string(to - from) + "\r\n";
+      if (rp.close) out += "Connection: close\r\n";
+      out += "\r\n";
+      if (headDelayMs_) sleepMs(headDelayMs_);
+      if (!sendAll(ln, out.data(), out.size())) break;
+      if (from < to && !sendBody(ln, rp, from, to)) break;
+      if (rp.chunked && from == to && status != 304 && !sendAll(ln, "0\r\n\r\n", 5)) break;
+      if (rp.close) break;
+    }
+    if (ln.ssl) { SSL_shutdown(ln.ssl); SSL_free(ln.ssl); }
+    std::lock_guard<std::mutex> lock(m_);
+    fds_.erase(std::remove(fds_.begin(), fds_.end(), sock), fds_.end());
+    close(sock);
+  }
+
+  Handler handler_;
+  SSL_CTX* ctx_ = nullptr;
+  int lfd_ = -1;
+  uint16_t port_ = 0;
+  std::atomic<bool> stop_{false};
+  std::atomic<size_t> rate_{0};
+  std::atomic<unsigned> headDelayMs_{0};
+  std::thread acceptor_;
+  mutable std::mutex m_;
+  std::vector<int> fds_;
+  std::vector<std::thread> workers_;
+  std::vector<HttpRequest> log_;
+};
+
+} // namespace hosttest
@@ -0,0 +1,322 @@
+// IconBlit against the PNG the speaker asset was made from: the asset's 4-bit alpha and
+// colour must be what tools/make_icon_assets.py derives from tools/icons/speaker.png,
+// and every draw path must equal a composite computed from the PNG pixel by pixel:
+// blended into a surface (clipped, partly off screen), and through a display with one
+// bitmap call per run, opaque against a known colour or thresholded at half alpha. A
+// small RGB icon with an odd ink box covers the per-pixel colour path. Reports µs and
+// primitives per call for the old PNG decode (PNGdec stand-in, mask at alpha 64,
+// draw16bitRGBBitmapWithMask) and for each IconBlit path.
+#include "HostTest.h"
+#include "gfx/AaFont.h"
+#include "gfx/Icon.h"
+#include "gfx/MemDisplay.h"
+#include "gfx/Rgb565.h"
+#include "gfx/icons/Icons.h"
+#include <Arduino.h>
+#include <PNGdec.h>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace ui_gfx;
+
+namespace {
+
+constexpr int kW = sys::kScreenW, kH = sys::kScreenH;
+constexpr int kRuns = 2000;
+constexpr uint16_t kHeader = 0x2945;
+
+// A whole icon as levels (0..15) and colours per pixel, independent of the asset layout
+struct Ref {
+  int w = 0, h = 0;
+  std::vector<uint8_t> level, alpha8;  // alpha8: the source's 8-bit alpha, PNG only
+  std::vector<uint16_t> color;
+  std::vector<uint8_t> rgb8;
+};
+
+uint16_t rgb565(int r, int g, int b) { return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)); }
+
+std::vector<uint8_t> readFile(const char* path) {
+  std::vector<uint8_t> data;
+  FILE* f = fopen(path, "rb");
+  if (!f) return data;
+  fseek(f, 0, SEEK_END);
+  data.resize((size_t)ftell(f));
+  fseek(f, 0, SEEK_SET);
+  if (fread(data.data(), 1, data.size(), f) != data.size()) data.clear();
+  fclose(f);
+  return data;
+}
+
+int collectRow(PNGDRAW* d) {
+  Ref& r = *(Ref*)d->pUser;
+  for (int x = 0; x < d->iWidth; ++x) {
+    const uint8_t* p = d->pPixels + x * 4;
+    const size_t i = (size_t)d->y * r.w + x;
+    r.alpha8[i] = p[3];
+    r.level[i] = (uint8_t)((p[3] * 15 + 127) / 255);  // as make_icon_assets.py rounds
+    r.color[i] = rgb565(p[0], p[1], p[2]);
+    for (int c = 0; c < 3; ++c) r.rgb8[i * 3 + c] = p[c];
+  }
+  return 1;
+}
+
+Ref fromPng(std::vector<uint8_t>& file) {
+  Ref r;
+  PNG png;
+  CHECK(png.openRAM(file.data(), (int)file.size(), collectRow) == PNG_SUCCESS);
+  CHECK(png.getPixelType() == PNG_PIXEL_TRUECOLOR_ALPHA);
+  r.w = png.getWidth();
+  r.h = png.getHeight();
+  r.level.assign((size_t)r.w * r.h, 0);
+  r.alpha8.assign(r.level.size(), 0);
+  r.color.assign(r.level.size(), 0);
+  r.rgb8.assign(r.level.size() * 3, 0);
+  CHECK(png.decode(&r, 0) == PNG_SUCCESS);
+  png.close();
+  return r;
+}
+
+// 7x4 icon, ink box 5x3 at (1, 1): odd width (padded rows), every kind of level
+const uint8_t kTestLevels[4][7] = {
+  {0, 0, 0, 0, 0, 0, 0},
+  {0, 15, 8, 0, 3, 15, 0},
+  {0, 1, 15, 15, 7, 0, 0},
+  {0, 12, 0, 9, 15, 2, 0},
+};
+const uint8_t kTestAlpha[] = {0xF8, 0x03, 0xF0, 0x1F, 0xF7, 0x00, 0xC0, 0x9F, 0x20};
+uint16_t testColor(int x, int y) { return (uint16_t)(0x1234 + x * 0x0841 + y * 0x3A07); }
+uint16_t kTestRgb[15];
+const Icon kTestIcon = {kTestRgb, kTestAlpha, 0, 7, 4, 1, 1, 5, 3};
+
+Ref testRef() {
+  for (int y = 0; y < 3; ++y)
+    for (int x = 0; x < 5; ++x) kTestRgb[y * 5 + x] = testColor(x + 1, y + 1);
+  Ref r;
+  r.w = 7;
+  r.h = 4;
+  for (int y = 0; y < 4; ++y)
+    for (int x = 0; x < 7; ++x) {
+      r.level.push_back(kTestLevels[y][x]);
+      r.color.push_back(testColor(x, y));
+    }
+  return r;
+}
+
+// What a pixel of the icon does to bg when blended
+uint16_t over(const Ref& r, int x, int y, uint16_t bg) {
+  const uint8_t q = r.level[(size_t)y * r.w + x];
+  const uint16_t c = r.color[(size_t)y * r.w + x];
+  return !q ? bg : q == 15 ? c : blend565(c, bg, AaText::kAlpha[q]);
+}
+
+std::vector<uint16_t> background() {
+  std::vector<uint16_t> fb(kW * kH);
+  for (int y = 0; y < kH; ++y)
+    for (int x = 0; x < kW; ++x) fb[y * kW + x] = (uint16_t)((((x * 31) / kW) << 11) | ((((x + y) * 63) / (kW + kH)) << 5) | (31 - (y * 31) / kH));
+  return fb;
+}
+
+bool inRect(int x, int y, const Rect& r) { return x >= r.x && x < r.x + r.w && y >= r.y && y < r.y + r.h; }
+
+// The asset holds what the converter makes of the PNG
+void testAsset(const Ref& png) {
+  const Icon& icon = kIconSpeaker;
+  CHECK(icon.w == png.w && icon.h == png.h);
+  const int pitch = (icon.bw + 1) >> 1;
+  size_t wrong = 0;
+  for (int y = 0; y < png.h; ++y)
+    for (int x = 0; x < png.w; ++x) {
+      const size_t i = (size_t)y * png.w + x;
+      const bool box = inRect(x, y, Rect{icon.bx, icon.by, icon.bw, icon.bh});
+      const int bx = x - icon.bx, by = y - icon.by;
+      const uint8_t q = box ? (icon.alpha[by * pitch + bx / 2] >> (bx & 1 ? 0 : 4)) & 0x0F : 0;
+      wrong += q != png.level[i];
+      if (q) wrong += (icon.rgb ? icon.rgb[by * icon.bw + bx] : icon.color) != png.color[i];
+    }
+  CHECK_MSG(wrong == 0, "speaker asset: %zu pixels differ from speaker.png", wrong);
+}
+
+// Blended into a surface: the composite inside clip and icon, nothing outside
+void testSurface(const Icon& icon, const Ref& ref, const char* name) {
+  const std::vector<uint16_t> bg = background();
+  struct Case {
+    int16_t x, y;
+    Rect clip;
+  };
+  const Case cases[] = {
+    {220, 220, Rect{0, 0, kW, kH}},
+    {-7, -5, Rect{0, 0, kW, kH}},
+    {(int16_t)(kW - icon.w + 6), (int16_t)(kH - icon.h + 3), Rect{0, 0, kW, kH}},
+    {100, 100, Rect{(int16_t)(100 + icon.w / 2 - 2), 101, 3, (int16_t)(icon.h / 2)}},
+  };
+  for (const Case& c : cases) {
+    std::vector<uint16_t> fb = bg;
+    IconBlit::draw(fb.data(), kW, c.clip, icon, c.x, c.y);
+    size_t wrong = 0;
+    for (int y = 0; y < kH; ++y)
+      for (int x = 0; x < kW; ++x) {
+        const size_t i = (size_t)y * kW + x;
+        const bool in = inRect(x, y, c.clip) && inRect(x, y, Rect{c.x, c.y, (int16_t)ref.w, (int16_t)ref.h});
+        wrong += fb[i] != (in ? over(ref, x - c.x, y - c.y, bg[i]) : bg[i]);
+      }
+    CHECK_MSG(wrong == 0, "%s at (%d,%d): %zu surface pixels differ from the composite", name, c.x, c.y, wrong);
+  }
+}
+
+// Largest channel error of the 4-bit blend against compositing the PNG's 8-bit alpha
+void reportExactError(const Ref& png) {
+  const std::vector<uint16_t> bg = background();
+  std::vector<uint16_t> fb = bg;
+  const int16_t ox = 220, oy = 220;
+  IconBlit::draw(fb.data(), kW, Rect{0, 0, kW, kH}, kIconSpeaker, ox, oy);
+  auto expand = [](uint16_t p, int c) {
+    const int v = c == 0 ? p >> 11 : c == 1 ? (p >> 5) & 63 : p & 31;
+    return c == 1 ? (v << 2) | (v >> 4) : (v << 3) | (v >> 2);
+  };
+  int worst = 0;
+  for (int y = 0; y < png.h; ++y)
+    for (int x = 0; x < png.w; ++x) {
+      const size_t i = (size_t)y * png.w + x, f = (size_t)(oy + y) * kW + ox + x;
+      const int a = png.alpha8[i];
+      for (int c = 0; c < 3; ++c) {
+        const int exact = (png.rgb8[i * 3 + c] * a + expand(bg[f], c) * (255 - a) + 127) / 255;
+        const int d = abs(expand(fb[f], c) - exact);
+        if (d > worst) worst = d;
+      }
+    }
+  printf("speaker blend vs exact 8-bit alpha compositing: largest channel error %d/255\n", worst);
+  // One 4-bit alpha step (17) plus the 5-bit channel's rounding
+  CHECK(worst <= 17 + 8);
+}
+
+std::unique_ptr<MemDisplay> makePanel() {
+  std::unique_ptr<MemDisplay> panel(new MemDisplay(FramebufferPool::instance().acquire()));
+  CHECK(panel->begin(GFX_SKIP_OUTPUT_BEGIN));
+  return panel;
+}
+
+// Runs of pixels at or above minLevel in the on-screen part of the icon at (ox, oy)
+void runs(const Ref& ref, int ox, int oy, uint8_t minLevel, uint32_t& calls, uint32_t& pixels) {
+  calls = pixels = 0;
+  for (int y = 0; y < ref.h; ++y) {
+    if (oy + y < 0 || oy + y >= kH) continue;
+    bool open = false;
+    for (int x = 0; x < ref.w; ++x) {
+      const bool on = ox + x >= 0 && ox + x < kW && ref.level[(size_t)y * ref.w + x] >= minLevel;
+      calls += on && !open;
+      pixels += on;
+      open = on;
+    }
+  }
+}
+
+// Through the display: opaque against the header colour, or thresholded over a picture
+void testGfx(const Icon& icon, const Ref& ref, const char* name) {
+  std::unique_ptr<MemDisplay> panel = makePanel();
+  const std::vector<uint16_t> bg = background();
+  for (int16_t ox : {(int16_t)200, (int16_t)-6})
+    for (bool opaque : {true, false}) {
+      const int16_t oy = ox < 0 ? (int16_t)(kH - icon.h + 5) : 200;
+      if (opaque) panel->fillScreen(kHeader);
+      else std::copy(bg.begin(), bg.end(), panel->pixels());
+      panel->resetCounters();
+      IconBlit::draw(panel.get(), icon, ox, oy, kHeader, opaque);
+      size_t wrong = 0;
+      for (int y = 0; y < kH; ++y)
+        for (int x = 0; x < kW; ++x) {
+          const size_t i = (size_t)y * kW + x;
+          uint16_t want = opaque ? kHeader : bg[i];
+          if (inRect(x, y, Rect{ox, oy, (int16_t)ref.w, (int16_t)ref.h})) {
+            const size_t j = (size_t)(y - oy) * ref.w + (x - ox);
+            if (opaque) want = over(ref, x - ox, y - oy, kHeader);
+            else if (ref.level[j] >= 8) want = ref.color[j];
+          }
+          wrong += panel->pixels()[i] != want;
+        }
+      uint32_t calls, pixels;
+      runs(ref, ox, oy, opaque ? 1 : 8, calls, pixels);
+      CHECK_MSG(wrong == 0, "%s at (%d,%d) %s: %zu pixels differ", name, ox, oy, opaque ? "opaque" : "threshold", wrong);
+      CHECK_MSG(panel->counters().calls == calls && panel->counters().pixels == pixels,
+                "%s at (%d,%d) %s: %u calls / %u px, expected %u / %u", name, ox, oy, opaque ? "opaque" : "threshold",
+                (unsigned)panel->counters().calls, (unsigned)panel->counters().pixels, (unsigned)calls, (unsigned)pixels);
+    }
+}
+
+// main.cpp's draw_speaker_icon before the asset: decode per call, 1-bit mask at alpha 64
+struct PngIcon {
+  PNG png;
+  MemDisplay* panel;
+  int16_t x, y;
+  uint16_t line[256];
+  uint8_t mask[32];
+};
+
+int pngIconRow(PNGDRAW* d) {
+  PngIcon& s = *(PngIcon*)d->pUser;
+  s.png.getLineAsRGB565(d, s.line, PNG_RGB565_LITTLE_ENDIAN, 0xFFFFFFFF);
+  s.png.getAlphaMask(d, s.mask, 64);
+  s.panel->draw16bitRGBBitmapWithMask(s.x, (int16_t)(s.y + d->y), s.line, s.mask, (int16_t)d->iWidth, 1);
+  return 1;
+}
+
+template <typename Fn> double usPer(Fn fn) {
+  const unsigned long t0 = micros();
+  for (int i = 0; i < kRuns; ++i) fn();
+  return (double)(micros() - t0) / kRuns;
+}
+
+void bench(std::vector<uint8_t>& file) {
+  std::unique_ptr<MemDisplay> panel = makePanel();
+  panel->fillScreen(kHeader);
+  const int16_t x = 220, y = 220;
+  printf("%-32s %10s %10s %10s\n", "speaker icon, per call", "us", "calls", "px");
+  auto row = [&](const char* name, double us) {
+    const MemDisplay::Counters c = panel->counters();
+    printf("%-32s %10.1f %10u %10u\n", name, us, (unsigned)(c.calls / kRuns), (unsigned)(c.pixels / kRuns));
+  };
+
+  PngIcon old;
+  old.panel = panel.get();
+  old.x = x;
+  old.y = y;
+  panel->resetCounters();
+  double us = usPer([&] {
+    old.png.openRAM(file.data(), (int)file.size(), pngIconRow);
+    old.png.decode(&old, 0);
+    old.png.close();
+  });
+  row("PNG decode + mask (before)", us);
+
+  panel->resetCounters();
+  us = usPer([&] { IconBlit::draw(panel.get(), kIconSpeaker, x, y, kHeader, true); });
+  row("IconBlit, panel, opaque", us);
+  panel->resetCounters();
+  us = usPer([&] { IconBlit::draw(panel.get(), kIconSpeaker, x, y, kHeader, false); });
+  row("IconBlit, panel, threshold", us);
+
+  std::vector<uint16_t> fb = background();
+  panel->resetCounters();
+  us = usPer([&] { IconBlit::draw(fb.data(), kW, Rect{0, 0, kW, kH}, kIconSpeaker, x, y); });
+  row("IconBlit, surface blend", us);
+}
+
+} // namespace
+
+int main() {
+  CHECK(FramebufferPool::instance().begin());
+  std::vector<uint8_t> file = readFile(ICON_DIR "/speaker.png");
+  CHECK_MSG(!file.empty(), "cannot read %s", ICON_DIR "/speaker.png");
+  if (file.empty()) return hosttest::result("icon_test");
+  const Ref speaker = fromPng(file);
+  const Ref small = testRef();
+  testAsset(speaker);
+  testSurface(kIconSpeaker, speaker, "speaker");
+  testSurface(kTestIcon, small, "rgb icon");
+  reportExactError(speaker);
+  testGfx(kIconSpeaker, speaker, "speaker");
+  testGfx(kTestIcon, small, "rgb icon");
+  bench(file);
+  return hosttest::result("icon_test");
+}
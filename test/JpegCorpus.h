@@ -0,0 +1,132 @@
+#pragma once
+// Generated JPEG covers for the decoder tests, encoded with libjpeg so no binary
+// fixtures are checked in. Content is photo-like (smooth gradients, soft discs,
+// light grain) and deterministic per seed. Also a reference decode (full image,
+// RGB565, no fancy upsampling, like the embedded decoders).
+#include <jpeglib.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace hosttest {
+
+enum class Chroma { S420, S444, Gray };
+
+struct JpegSpec {
+  int w = 640, h = 640;
+  int quality = 85;
+  Chroma chroma = Chroma::S420;
+  bool progressive = false;
+  int restartRows = 0;  // DRI every n MCU rows (0: none)
+  uint32_t seed = 1;
+
+  std::string name() const {
+    char s[64];
+    snprintf(s, sizeof s, "%s%s_%dx%d%s", progressive ? "prog" : "base",
+             chroma == Chroma::S444 ? "444" : chroma == Chroma::Gray ? "gray" : "",
+             w, h, restartRows ? "_dri" : "");
+    return s;
+  }
+};
+
+inline std::vector<uint8_t> coverPixels(int w, int h, uint32_t seed) {
+  std::vector<uint8_t> rgb((size_t)w * h * 3);
+  struct Disc { float x, y, r; uint8_t c[3]; } discs[6];
+  uint32_t s = seed * 2654435761u + 1;
+  auto rnd = [&s]() { s = s * 1103515245u + 12345u; return (s >> 8) & 0xFFFF; };
+  for (Disc& d : discs) {
+    d.x = rnd() % w; d.y = rnd() % h; d.r = (float)(w / 12 + rnd() % (w / 4 + 1));
+    for (uint8_t& c : d.c) c = (uint8_t)rnd();
+  }
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      float px[3] = {255.f * x / w, 128.f + 100.f * std::sin(y * 6.f / h), 255.f * (w - x + y) / (w + h)};
+      for (const Disc& d : discs) {
+        const float dist = std::hypot(x - d.x, y - d.y);
+        if (dist < d.r) {
+          const float a = dist > d.r * 0.8f ? (d.r - dist) / (d.r * 0.2f) : 1.f;
+          for (int c = 0; c < 3; ++c) px[c] += (d.c[c] - px[c]) * a;
+        }
+      }
+      const int grain = (int)(rnd() % 9) - 4;
+      for (int c = 0; c < 3; ++c) {
+        const int v = (int)px[c] + grain;
+        rgb[((size_t)y * w + x) * 3 + c] = (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+      }
+    }
+  }
+  return rgb;
+}
+
+inline std::vector<uint8_t> makeJpeg(const JpegSpec& spec) {
+  const std::vector<uint8_t> rgb = coverPixels(spec.w, spec.h, spec.seed);
+  jpeg_compress_struct ci;
+  jpeg_error_mgr err;
+  ci.err = jpeg_std_error(&err);
+  jpeg_create_compress(&ci);
+  unsigned char* out = nullptr;
+  unsigned long outLen = 0;
+  jpeg_mem_dest(&ci, &out, &outLen);
+  ci.image_width = (JDIMENSION)spec.w;
+  ci.image_height = (JDIMENSION)spec.h;
+  ci.input_components = 3;
+  ci.in_color_space = JCS_RGB;
+  jpeg_set_defaults(&ci);
+  jpeg_set_quality(&ci, spec.quality, TRUE);
+  if (spec.chroma == Chroma::Gray) jpeg_set_colorspace(&ci, JCS_GRAYSCALE);
+  if (spec.chroma == Chroma::S444) ci.comp_info[0].h_samp_factor = ci.comp_info[0].v_samp_factor = 1;
+  if (spec.progressive) jpeg_simple_progression(&ci);
+  ci.restart_in_rows = spec.restartRows;
+  jpeg_start_compress(&ci, TRUE);
+  while (ci.next_scanline < ci.image_height) {
+    JSAMPROW row = (JSAMPROW)&rgb[(size_t)ci.next_scanline * spec.w * 3];
+    jpeg_write_scanlines(&ci, &row, 1);
+  }
+  jpeg_finish_compress(&ci);
+  std::vector<uint8_t> jpg(out, out + outLen);
+  jpeg_destroy_compress(&ci);
+  free(out);
+  return jpg;
+}
+
+// Full decode of a valid file to RGB565 (w x h)
+inline std::vector<uint16_t> referenceDecode(const std::vector<uint8_t>& jpg, int& w, int& h) {
+  jpeg_decompress_struct ci;
+  jpeg_error_mgr err;
+  ci.err = jpeg_std_error(&err);
+  jpeg_create_decompress(&ci);
+  jpeg_mem_src(&ci, jpg.data(), (unsigned long)jpg.size());
+  jpeg_read_header(&ci, TRUE);
+  ci.out_color_space = JCS_RGB565;
+  ci.dither_mode = JDITHER_NONE;
+  ci.do_fancy_upsampling = FALSE;
+  ci.dct_method = JDCT_ISLOW;
+  jpeg_start_decompress(&ci);
+  w = (int)ci.output_width; h = (int)ci.output_height;
+  std::vector<uint16_t> px((size_t)w * h);
+  while (ci.output_scanline < ci.output_height) {
+    JSAMPROW row = (JSAMPROW)&px[(size_t)ci.output_scanline * w];
+    jpeg_read_scanlines(&ci, &row, 1);
+  }
+  jpeg_finish_decompress(&ci);
+  jpeg_destroy_decompress(&ci);
+  return px;
+}
+
+// PSNR in dB between two RGB565 images of n pixels
+inline double psnr565(const uint16_t* a, const uint16_t* b, size_t n) {
+  double se = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const int dr = ((a[i] >> 11) - (b[i] >> 11)) * 255 / 31;
+    const int dg = (((a[i] >> 5) & 63) - ((b[i] >> 5) & 63)) * 255 / 63;
+    const int db = ((a[i] & 31) - (b[i] & 31)) * 255 / 31;
+    se += dr * dr + dg * dg + db * db;
+  }
+  if (se == 0) return 99.0;
+  return 10.0 * std::log10(255.0 * 255.0 * 3.0 * (double)n / se);
+}
+
+} // namespace hosttest
@@ -0,0 +1,137 @@
+// Baseline vs progressive covers through AlbumArtService::decodeToCropped480, on a
+// corpus generated with libjpeg (JpegCorpus.h). TJPG and JPEGDEC run on libjpeg
+// stand-ins (stubs/TJpg_Decoder.cpp, stubs/JPEGDEC.cpp); the progressive backend is
+// the firmware's own. Reports success rate and decode time per class; baseline
+// frames must equal the reference decode bit for bit, progressive ones (reduced
+// scale, box-filtered) must stay close to a full-resolution reference.
+#include "HostTest.h"
+#include "JpegCorpus.h"
+#include "albumart/AlbumArtService.h"
+#include "albumart/CoverScaler.h"
+#include <esp_heap_caps.h>
+#include <string>
+#include <vector>
+
+using albumart::AlbumArtService;
+using hosttest::Chroma;
+using hosttest::JpegSpec;
+
+namespace {
+
+constexpr int kScreen = 480;
+constexpr size_t kFrame = (size_t)kScreen * kScreen;
+
+// What the firmware should show: baseline centered unscaled, progressive cover-fit
+std::vector<uint16_t> expectedFrame(const std::vector<uint8_t>& jpg, bool progressive) {
+  int w = 0, h = 0;
+  const std::vector<uint16_t> full = hosttest::referenceDecode(jpg, w, h);
+  std::vector<uint16_t> frame(kFrame, 0);
+  if (!progressive) {
+    albumart::centerCropPadTo480(full.data(), w, h, frame.data());
+    return frame;
+  }
+  albumart::CoverScaler scaler;
+  scaler.begin(frame.data(), kScreen, kScreen, w, h);
+  for (int y = 0; y < h; ++y) scaler.pushRow(y, &full[(size_t)y * w], w);
+  scaler.finish();
+  return frame;
+}
+
+struct ClassStats {
+  const char* name;
+  int files = 0, ok = 0;
+  double ms = 0;
+};
+
+void runCase(const JpegSpec& spec, ClassStats& st, const std::vector<uint8_t>* data = nullptr, bool exact = true) {
+  const std::vector<uint8_t> jpg = data ? *data : hosttest::makeJpeg(spec);
+  std::vector<uint16_t> frame(kFrame, 0);
+  const unsigned long t0 = micros();
+  const bool ok = AlbumArtService::decodeToCropped480(jpg.data(), jpg.size(), frame.data());
+  const double ms = (micros() - t0) / 1000.0;
+  ++st.files;
+  st.ok += ok;
+  st.ms += ms;
+  double q = 0;
+  if (ok && exact) {
+    const std::vector<uint16_t> want = expectedFrame(jpg, spec.progressive);
+    q = hosttest::psnr565(frame.data(), want.data(), kFrame);
+    if (spec.progressive) CHECK_MSG(q >= 28.0, "%s: %.1f dB against the reference", spec.name().c_str(), q);
+    else CHECK_MSG(frame == want, "%s differs from the reference decode (%.1f dB)", spec.name().c_str(), q);
+  }
+  printf("  %-22s %7.1f KB %-4s %8.2f ms %6.1f dB\n", spec.name().c_str(), jpg.size() / 1024.0, ok ? "ok" : "FAIL", ms, q);
+}
+
+void testCorpus() {
+  ClassStats base{"baseline"}, prog{"progressive"};
+  printf("corpus:\n");
+  uint32_t seed = 1;
+  for (int px : {300, 640, 1000, 1500, 3000}) {
+    for (bool progressive : {false, true}) {
+      JpegSpec s;
+      s.w = s.h = px;
+      s.progressive = progressive;
+      s.seed = seed++;
+      runCase(s, progressive ? prog : base);
+      CHECK_MSG((progressive ? prog : base).ok == (progressive ? prog : base).files, "%s failed", s.name().c_str());
+    }
+  }
+  for (Chroma c : {Chroma::S444, Chroma::Gray}) {
+    for (bool progressive : {false, true}) {
+      JpegSpec s;
+      s.w = 800; s.h = 600;
+      s.chroma = c;
+      s.progressive = progressive;
+      s.seed = seed++;
+      runCase(s, progressive ? prog : base);
+    }
+  }
+  // Cut in half: the progressive backend renders the scans it received
+  JpegSpec cut;
+  cut.w = cut.h = 1500;
+  cut.progressive = true;
+  cut.seed = seed++;
+  std::vector<uint8_t> half = hosttest::makeJpeg(cut);
+  half.resize(half.size() / 2);
+  runCase(cut, prog, &half, false);
+
+  CHECK(base.ok == base.files);
+  CHECK(prog.ok == prog.files);
+  printf("%-12s %6s %8s %10s\n", "class", "files", "ok %", "mean ms");
+  for (const ClassStats* st : {&base, &prog}) {
+    printf("%-12s %6d %7.0f%% %10.2f\n", st->name, st->files, 100.0 * st->ok / st->files, st->ms / st->files);
+  }
+}
+
+// PSRAM mostly taken by the slab pool, the cover cache and the body: the store shrinks
+// to a lower scale instead of failing, and what does not fit at 1/8 fails cleanly
+void testTightPsram() {
+  JpegSpec s;
+  s.w = s.h = 1500;
+  s.progressive = true;
+  s.seed = 99;
+  const std::vector<uint8_t> jpg = hosttest::makeJpeg(s);
+  const std::vector<uint16_t> want = expectedFrame(jpg, true);
+  std::vector<uint16_t> frame(kFrame, 0);
+
+  const size_t live = heap_caps_test_counters().liveBytes;
+  heap_caps_test_limit_spiram(1600 * 1024); // 1/2 scale would need 2.1 MB
+  CHECK(AlbumArtService::decodeToCropped480(jpg.data(), jpg.size(), frame.data()));
+  const double q = hosttest::psnr565(frame.data(), want.data(), kFrame);
+  CHECK_MSG(q >= 25.0, "%.1f dB at reduced scale", q);
+
+  s.w = s.h = 3000;
+  const std::vector<uint8_t> big = hosttest::makeJpeg(s);
+  CHECK(!AlbumArtService::decodeToCropped480(big.data(), big.size(), frame.data()));
+  heap_caps_test_limit_spiram(SIZE_MAX);
+  CHECK(heap_caps_test_counters().liveBytes == live);
+  printf("tight PSRAM: 1500 px at %.1f dB, 3000 px refused\n", q);
+}
+
+} // namespace
+
+int main() {
+  testCorpus();
+  testTightPsram();
+  return hosttest::result("jpeg_corpus_test");
+}
@@ -0,0 +1,82 @@
+// Two covers decoding at once through AlbumArtService::decodeToCropped480: the backends
+// keep their state per call, so two threads share nothing but the read-only input.
+// Every frame of the parallel run must equal the one decoded alone; throughput of one
+// thread vs two is reported, not asserted (it depends on the host's free cores).
+#include "HostTest.h"
+#include "JpegCorpus.h"
+#include "albumart/AlbumArtService.h"
+#include <thread>
+#include <vector>
+
+using albumart::AlbumArtService;
+using hosttest::JpegSpec;
+
+namespace {
+
+constexpr size_t kFrame = 480 * 480;
+
+struct Cover {
+  std::string name;
+  std::vector<uint8_t> jpg;
+  std::vector<uint16_t> alone;     // decoded on its own
+  std::vector<uint16_t> parallel;  // decoded next to another cover
+};
+
+std::vector<Cover> makeCorpus() {
+  std::vector<Cover> covers;
+  uint32_t seed = 200;
+  for (int px : {640, 1000, 1500}) {
+    for (bool progressive : {false, true}) {
+      JpegSpec s;
+      s.w = s.h = px;
+      s.progressive = progressive;
+      s.seed = seed++;
+      covers.push_back(Cover{s.name(), hosttest::makeJpeg(s), {}, {}});
+    }
+  }
+  return covers;
+}
+
+// Decodes covers[first], covers[first + step], ... into the chosen frame
+void decodeEvery(std::vector<Cover>& covers, size_t first, size_t step, bool parallel, int rounds) {
+  for (int r = 0; r < rounds; ++r) {
+    for (size_t i = first; i < covers.size(); i += step) {
+      std::vector<uint16_t>& out = parallel ? covers[i].parallel : covers[i].alone;
+      out.assign(kFrame, 0);
+      CHECK_MSG(AlbumArtService::decodeToCropped480(covers[i].jpg.data(), covers[i].jpg.size(), out.data()),
+                "%s failed", covers[i].name.c_str());
+    }
+  }
+}
+
+void testTwoDecodes() {
+  std::vector<Cover> covers = makeCorpus();
+  const int kRounds = 3;
+  const size_t n = covers.size() * kRounds;
+
+  unsigned long t0 = micros();
+  decodeEvery(covers, 0, 1, false, kRounds);
+  const double oneMs = (micros() - t0) / 1000.0;
+
+  // Even indices are the baseline covers, odd ones the progressive: one thread runs
+  // the TJPG backend while the other runs the progressive one
+  t0 = micros();
+  std::thread other([&covers] { decodeEvery(covers, 1, 2, true, kRounds); });
+  decodeEvery(covers, 0, 2, true, kRounds);
+  other.join();
+  const double twoMs = (micros() - t0) / 1000.0;
+
+  for (const Cover& c : covers) CHECK_MSG(c.parallel == c.alone, "%s differs when decoded in parallel", c.name.c_str());
+  printf("%zu decodes of %zu covers (640/1000/1500 px, baseline and progressive)\n", n, covers.size());
+  printf("%-10s %10s %10s\n", "threads", "ms", "covers/s");
+  printf("%-10d %10.1f %10.1f\n", 1, oneMs, n * 1000.0 / oneMs);
+  printf("%-10d %10.1f %10.1f\n", 2, twoMs, n * 1000.0 / twoMs);
+  printf("speedup %.2fx on %u hardware threads\n", oneMs / twoMs, std::thread::hardware_concurrency());
+}
+
+} // namespace
+
+int main() {
+  testTwoDecodes();
+  return hosttest::result("parallel_decode_test");
+}
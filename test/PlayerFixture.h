@@ -0,0 +1,103 @@
+#pragma once
+// PlayerScreen on a headless MemDisplay panel for the host tests: a synthetic cover
+// under it and its data suppliers bound to a plain state struct the test changes.
+// The test defines the global `gfx` PlayerScreen paints to and link-time fakes for
+// ArtScheduler::submit/busy (no cover jobs run here).
+#include "HostTest.h"
+#include "albumart/BackgroundArt.h"
+#include "gfx/MemDisplay.h"
+#include "gfx/RoundMask.h"
+#include "ui/screens/PlayerScreen.h"
+#include <memory>
+#include <vector>
+
+namespace hosttest {
+
+struct PlayerState {
+  bool playing = true;
+  int volume = 35;
+  bool muted = false;
+  int progress = 28;
+  String title = "Bohemian Rhapsody";
+  String artist = "Queen";
+  String room = "Wohnzimmer";
+  String relTime = "0:01:23";
+  String duration = "0:04:56";
+};
+
+class PlayerFixture {
+public:
+  static constexpr int kW = sys::kScreenW, kH = sys::kScreenH;
+
+  // Takes two slabs (panel, cover); the screen's compositor takes a third
+  PlayerFixture() : panel_(new ui_gfx::MemDisplay(ui_gfx::FramebufferPool::instance().acquire())) {
+    CHECK(panel_->begin(GFX_SKIP_OUTPUT_BEGIN));
+    panel_->fillScreen(BLACK);
+    gfx = panel_.get();
+    bg_.present(cover(kFirstCover), albumart::CoverTone());
+    bg_.tick();
+    screen_.setIsPlayingSupplier([this] { return state.playing; });
+    screen_.setVolumeSupplier([this] { return state.volume; });
+    screen_.setMutedSupplier([this] { return state.muted; });
+    screen_.setProgressSupplier([this] { return state.progress; });
+    screen_.setTitleSupplier([this] { return state.title; });
+    screen_.setArtistSupplier([this] { return state.artist; });
+    screen_.setRoomNameSupplier([this] { return state.room; });
+    screen_.setRelTimeSupplier([this] { return state.relTime; });
+    screen_.setDurationSupplier([this] { return state.duration; });
+    screen_.enter();
+    screen_.drawAllUi();
+    drawFrame();
+    panel_->resetCounters();
+  }
+  ~PlayerFixture() { gfx = nullptr; }
+
+  PlayerState state;
+
+  ui::PlayerScreen& screen() { return screen_; }
+  ui_gfx::MemDisplay& panel() { return *panel_; }
+  albumart::BackgroundArt& art() { return bg_; }
+
+  // Paints and pushes until the frame is on the panel; returns the draw() calls
+  int drawFrame() {
+    ui_gfx::Display d(gfx);
+    int calls = 0;
+    do { screen_.draw(d); ++calls; } while (screen_.painting() && calls < 100);
+    return calls;
+  }
+
+  std::vector<uint16_t> frame() const { return std::vector<uint16_t>(panel_->pixels(), panel_->pixels() + kW * kH); }
+
+  // Composes the whole screen again from the same state; returns the visible pixels
+  // that differ from what was on the panel before
+  size_t diffFromFullRecompose() {
+    const std::vector<uint16_t> before = frame();
+    screen_.reset();
+    screen_.drawAllUi();
+    drawFrame();
+    const std::vector<uint16_t> after = frame();
+    size_t n = 0;
+    for (int y = 0; y < kH; ++y)
+      for (int x = ui_gfx::RoundMask::rowStart(y); x < ui_gfx::RoundMask::rowEnd(y); ++x) n += before[y * kW + x] != after[y * kW + x];
+    return n;
+  }
+
+  // The synthetic covers; the fixture starts with kFirstCover
+  static constexpr uint16_t kFirstCover = 0x5A5A;
+  static uint16_t coverPixel(uint16_t seed, int x, int y) { return (uint16_t)(seed ^ (x * 37) ^ (y * 1021)); }
+  static ui_gfx::FbLease cover(uint16_t seed) {
+    ui_gfx::FbLease fb = ui_gfx::FramebufferPool::instance().acquire();
+    if (!fb) return fb;
+    uint16_t* p = fb.data();
+    for (int y = 0; y < kH; ++y)
+      for (int x = 0; x < kW; ++x) p[y * kW + x] = coverPixel(seed, x, y);
+    return fb;
+  }
+
+private:
+  std::unique_ptr<ui_gfx::MemDisplay> panel_;
+  albumart::BackgroundArt bg_;
+  ui::PlayerScreen screen_{&bg_};
+};
+
+} // namespace hosttest
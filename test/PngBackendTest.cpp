@@ -0,0 +1,190 @@
+// PngBackend against the fixtures in data/png (tools/make_png_fixtures.py): golden
+// CRCs of the 480x480 frame, and the inputs it has to refuse. Also times the decode of
+// generated covers from 300 to 1500 px (stubs/PNGdec.cpp inflates with zlib, so the
+// numbers compare sizes and modes, not the device).
+#include "HostTest.h"
+#include "albumart/decoders/IImageDecoder.h"
+#include <Arduino.h>
+#include <zlib.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+extern "C" IImageDecoder* createPngDecoder();
+
+namespace {
+
+constexpr int kScreen = 480;
+constexpr uint16_t kUntouched = 0xF81F;
+
+// Printed by tools/make_png_fixtures.py, computed without the decoder
+constexpr uint32_t kAlphaFrameCrc = 0xB23F2153;
+// Recorded from a reviewed decode; changes when scaling or blending changes
+constexpr uint32_t kCoverFrameCrc = 0x28F532A0;
+
+std::vector<uint8_t> load(const char* name) {
+  std::vector<uint8_t> d;
+  const std::string path = std::string(TEST_DATA_DIR "/png/") + name;
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) { CHECK_MSG(f, "cannot open %s", path.c_str()); return d; }
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof buf, f)) > 0) d.insert(d.end(), buf, buf + n);
+  fclose(f);
+  return d;
+}
+
+uint16_t rgb565(int r, int g, int b) { return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)); }
+
+uint32_t frameCrc(const std::vector<uint16_t>& fb) { return hosttest::crc32(fb.data(), fb.size() * 2); }
+
+bool allUntouched(const std::vector<uint16_t>& fb) {
+  for (uint16_t p : fb) if (p != kUntouched) return false;
+  return true;
+}
+
+// Small RGBA image: centered unscaled, alpha blended over black
+void testAlphaCentered() {
+  const std::vector<uint8_t> png = load("alpha_36x28.png");
+  std::unique_ptr<IImageDecoder> dec(createPngDecoder());
+  const DecodeResult size = dec->sizeOf(png.data(), png.size());
+  CHECK(size.ok && size.w == 36 && size.h == 28);
+
+  std::vector<uint16_t> fb(kScreen * kScreen, 0);
+  CHECK(dec->decodeToRGB565(png.data(), png.size(), fb.data(), kScreen, kScreen));
+  CHECK_MSG(frameCrc(fb) == kAlphaFrameCrc, "crc 0x%08X, expected 0x%08X", frameCrc(fb), kAlphaFrameCrc);
+  // Transparent left columns stay black, the opaque right ones keep their colour
+  const int x0 = (kScreen - 36) / 2, y0 = (kScreen - 28) / 2;
+  CHECK(fb[y0 * kScreen + x0] == 0);
+  CHECK(fb[(y0 + 5) * kScreen + x0 + 35] == rgb565((35 * 7) & 0xFF, 5 * 9, (40 * 5) & 0xFF));
+}
+
+// Larger than the screen: the short side is scaled to 480 and the long side cropped
+void testScaledCover() {
+  const std::vector<uint8_t> png = load("cover_720x600.png");
+  std::unique_ptr<IImageDecoder> dec(createPngDecoder());
+  const DecodeResult size = dec->sizeOf(png.data(), png.size());
+  CHECK(size.ok && size.w == 720 && size.h == 600);
+
+  std::vector<uint16_t> fb(kScreen * kScreen, kUntouched);
+  CHECK(dec->decodeToRGB565(png.data(), png.size(), fb.data(), kScreen, kScreen));
+  CHECK_MSG(frameCrc(fb) == kCoverFrameCrc, "crc 0x%08X, expected 0x%08X", frameCrc(fb), kCoverFrameCrc);
+  size_t untouched = 0;
+  for (uint16_t p : fb) untouched += p == kUntouched;
+  CHECK_MSG(untouched == 0, "%zu pixels not written", untouched);
+  // Scale 4/5, 48 scaled columns cropped per side: (0,0) samples source (60,0),
+  // the centre source (360,300); both lie inside a flat 24x24 block
+  CHECK(fb[0] == rgb565(16, 0, 200));
+  CHECK(fb[240 * kScreen + 240] == rgb565(120, 120, 40));
+}
+
+void testRejected() {
+  std::unique_ptr<IImageDecoder> dec(createPngDecoder());
+  std::vector<uint16_t> fb(kScreen * kScreen, kUntouched);
+
+  // Adam7: the header still gives the size, the decode is refused before PNGdec runs
+  const std::vector<uint8_t> interlaced = load("interlaced_16x16.png");
+  const DecodeResult size = dec->sizeOf(interlaced.data(), interlaced.size());
+  CHECK(size.ok && size.w == 16 && size.h == 16);
+  CHECK(!dec->decodeToRGB565(interlaced.data(), interlaced.size(), fb.data(), kScreen, kScreen));
+  CHECK(allUntouched(fb));
+
+  // Not a PNG, or cut off inside the header
+  static const uint8_t kJpeg[32] = {0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 'J', 'F', 'I', 'F'};
+  CHECK(!dec->sizeOf(kJpeg, sizeof kJpeg).ok);
+  CHECK(!dec->decodeToRGB565(kJpeg, sizeof kJpeg, fb.data(), kScreen, kScreen));
+  const std::vector<uint8_t> cover = load("cover_720x600.png");
+  CHECK(!dec->sizeOf(cover.data(), 20).ok);
+  CHECK(!dec->decodeToRGB565(cover.data(), 20, fb.data(), kScreen, kScreen));
+  CHECK(allUntouched(fb));
+
+  // Damaged image data
+  std::vector<uint8_t> corrupt = cover;
+  for (size_t i = 100; i < 200; ++i) corrupt[i] ^= 0x5A;
+  CHECK(!dec->decodeToRGB565(corrupt.data(), corrupt.size(), fb.data(), kScreen, kScreen));
+}
+
+void testCancelled() {
+  const std::vector<uint8_t> png = load("cover_720x600.png");
+  std::unique_ptr<IImageDecoder> dec(createPngDecoder());
+  albumart::CancelToken token;
+  token.cancel();
+  dec->setCancel(&token);
+  std::vector<uint16_t> fb(kScreen * kScreen, kUntouched);
+  CHECK(!dec->decodeToRGB565(png.data(), png.size(), fb.data(), kScreen, kScreen));
+  CHECK(allUntouched(fb));
+}
+
+void putBe32(std::vector<uint8_t>& v, uint32_t x) {
+  for (int s = 24; s >= 0; s -= 8) v.push_back((uint8_t)(x >> s));
+}
+
+void putChunk(std::vector<uint8_t>& png, const char* type, const std::vector<uint8_t>& body) {
+  putBe32(png, (uint32_t)body.size());
+  const size_t at = png.size();
+  png.insert(png.end(), type, type + 4);
+  png.insert(png.end(), body.begin(), body.end());
+  putBe32(png, hosttest::crc32(png.data() + at, png.size() - at));
+}
+
+// Photo-like w x h PNG: smooth gradients plus noise, Sub filter, zlib level 6
+std::vector<uint8_t> makeCover(int w, int h, bool alpha) {
+  const int bpp = alpha ? 4 : 3;
+  std::vector<uint8_t> raw;
+  raw.reserve((size_t)(w * bpp + 1) * h);
+  uint32_t seed = 7;
+  for (int y = 0; y < h; ++y) {
+    raw.push_back(1);
+    uint8_t prev[4] = {0, 0, 0, 0};
+    for (int x = 0; x < w; ++x) {
+      seed = seed * 1103515245u + 12345u;
+      const int n = (int)((seed >> 16) & 7) - 4;
+      const uint8_t px[4] = {(uint8_t)(x * 255 / w + n), (uint8_t)(y * 255 / h + n), (uint8_t)((x + y) * 127 / w - n),
+                             (uint8_t)(255 - (x * 64 / w))};
+      for (int c = 0; c < bpp; ++c) { raw.push_back((uint8_t)(px[c] - prev[c])); prev[c] = px[c]; }
+    }
+  }
+  uLongf zn = compressBound((uLong)raw.size());
+  std::vector<uint8_t> z(zn);
+  compress2(z.data(), &zn, raw.data(), (uLong)raw.size(), 6);
+  z.resize(zn);
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+  std::vector<uint8_t> ihdr;
+  putBe32(ihdr, (uint32_t)w);
+  putBe32(ihdr, (uint32_t)h);
+  ihdr.insert(ihdr.end(), {8, (uint8_t)(alpha ? 6 : 2), 0, 0, 0});
+  putChunk(png, "IHDR", ihdr);
+  putChunk(png, "IDAT", z);
+  putChunk(png, "IEND", {});
+  return png;
+}
+
+void benchDecode() {
+  printf("%-6s %-5s %9s %9s %10s\n", "px", "mode", "KB", "ms", "Mpx/s");
+  std::unique_ptr<IImageDecoder> dec(createPngDecoder());
+  std::vector<uint16_t> fb(kScreen * kScreen);
+  for (int px : {300, 480, 640, 1000, 1500}) {
+    for (bool alpha : {false, true}) {
+      const std::vector<uint8_t> png = makeCover(px, px, alpha);
+      const int runs = px <= 640 ? 5 : 2;
+      bool ok = true;
+      const unsigned long t0 = micros();
+      for (int i = 0; i < runs; ++i) ok = dec->decodeToRGB565(png.data(), png.size(), fb.data(), kScreen, kScreen) && ok;
+      const double ms = (micros() - t0) / 1000.0 / runs;
+      CHECK_MSG(ok, "%d px %s", px, alpha ? "RGBA" : "RGB");
+      printf("%-6d %-5s %9.1f %9.2f %10.1f\n", px, alpha ? "RGBA" : "RGB", png.size() / 1024.0, ms, (double)px * px / ms / 1000.0);
+    }
+  }
+}
+
+} // namespace
+
+int main() {
+  testAlphaCentered();
+  testScaledCover();
+  testRejected();
+  testCancelled();
+  benchDecode();
+  return hosttest::result("png_backend_test");
+}
@@ -0,0 +1,111 @@
+// The player's progress widget updated once per second through whole tracks on a
+// MemDisplay panel: every update is at most one push, stays far below a repaint of
+// the whole progress box, and the frame equals a full recompose of the same state
+// (checked every 30 updates and at the end). Reports pixels, primitives and µs per
+// update, and the same for seeks.
+#include "HostTest.h"
+#include "PlayerFixture.h"
+#include <Arduino.h>
+#include <cstdio>
+
+using ui_gfx::MemDisplay;
+
+// The panel PlayerScreen paints to
+Arduino_GFX* gfx = nullptr;
+
+namespace {
+
+// A knob step plus the label cells that changed; the whole box is 420x58 = 24360 px
+constexpr uint32_t kMaxUpdatePx = 2500;
+
+String hms(int s) {
+  char buf[16];
+  snprintf(buf, sizeof buf, "%d:%02d:%02d", s / 3600, s / 60 % 60, s % 60);
+  return String(buf);
+}
+
+struct Tally {
+  int updates = 0;
+  uint64_t px = 0, calls = 0, us = 0;
+  uint32_t maxPx = 0;
+  void add(const MemDisplay::Counters& c, unsigned long t) {
+    ++updates;
+    px += c.pixels;
+    calls += c.calls;
+    us += t;
+    if (c.pixels > maxPx) maxPx = c.pixels;
+  }
+  void print(const char* name) const {
+    printf("%-22s %7d %9.0f %8u %9.1f %8.2f\n", name, updates, (double)px / updates, (unsigned)maxPx,
+           (double)calls / updates, (double)us / updates);
+  }
+};
+
+// Sets the position and pushes the update; counts what reached the panel
+void update(hosttest::PlayerFixture& f, int pos, int len, Tally& t) {
+  f.state.relTime = hms(pos);
+  f.state.progress = len ? pos * 100 / len : 0;
+  const uint32_t flushes = f.screen().compositorStats().flushes;
+  f.panel().resetCounters();
+  const unsigned long t0 = micros();
+  f.screen().drawProgress();
+  f.drawFrame();
+  const unsigned long us = micros() - t0;
+  const MemDisplay::Counters& c = f.panel().counters();
+  const uint32_t pushes = f.screen().compositorStats().flushes - flushes;
+  CHECK_MSG(pushes <= 1, "%s: %u pushes", f.state.relTime.c_str(), (unsigned)pushes);
+  t.add(c, us);
+}
+
+void playTrack(const char* name, int len) {
+  hosttest::PlayerFixture f;
+  f.state.duration = hms(len);
+  f.state.relTime = hms(0);
+  f.state.progress = 0;
+  f.screen().drawProgress();
+  f.drawFrame();
+
+  Tally t;
+  for (int pos = 1; pos <= len; ++pos) {
+    update(f, pos, len, t);
+    CHECK_MSG(f.panel().counters().pixels <= kMaxUpdatePx, "%s at %s: %u px", name, f.state.relTime.c_str(),
+              (unsigned)f.panel().counters().pixels);
+    if (pos % 30 == 0 || pos == len) {
+      const size_t diff = f.diffFromFullRecompose();
+      CHECK_MSG(diff == 0, "%s at %s: %zu pixels differ from a full recompose", name, f.state.relTime.c_str(), diff);
+    }
+  }
+  t.print(name);
+}
+
+// Seeks move the knob across the bar: the columns in between are repainted
+void seeks() {
+  hosttest::PlayerFixture f;
+  const int len = 296;
+  f.state.duration = hms(len);
+  Tally t;
+  for (int pos : {10, 280, 150, 0, 296, 148, 149}) {
+    update(f, pos, len, t);
+    const size_t diff = f.diffFromFullRecompose();
+    CHECK_MSG(diff == 0, "seek to %s: %zu pixels differ from a full recompose", f.state.relTime.c_str(), diff);
+  }
+  t.print("seeks");
+}
+
+} // namespace
+
+// --- Link-time fakes: no cover jobs are submitted here ---------------------------
+
+namespace albumart {
+ArtJobId ArtScheduler::submit(const String&, ArtPriority, ArtSink, void*) { return 0; }
+bool ArtScheduler::busy(void*) const { return false; }
+} // namespace albumart
+
+int main() {
+  CHECK(ui_gfx::FramebufferPool::instance().begin());
+  printf("%-22s %7s %9s %8s %9s %8s\n", "track", "updates", "px mean", "px max", "calls", "us");
+  playTrack("4:56, 1 s steps", 296);
+  playTrack("1:02:10, 1 s steps", 3730);
+  seeks();
+  return hosttest::result("progress_test");
+}
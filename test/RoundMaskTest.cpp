@@ -0,0 +1,178 @@
+// RoundMask's span table against the circle itself: a pixel is visible when its square
+// shares area with the inscribed circle, computed exactly in integers per pixel. The
+// clip, containment and count helpers are compared with a brute-force count over
+// random rectangles. Display::fillVisible/drawRectVisible and a cover's full redraw
+// then run on a MemDisplay: pixels and bytes per full redraw against the square.
+#include "HostTest.h"
+#include "albumart/BackgroundArt.h"
+#include "gfx/Display.h"
+#include "gfx/MemDisplay.h"
+#include "gfx/RoundMask.h"
+#include <memory>
+#include <vector>
+
+using ui_gfx::MemDisplay;
+using ui_gfx::RoundMask;
+
+namespace {
+
+constexpr int kW = sys::kScreenW, kH = sys::kScreenH;
+constexpr int kR = kW / 2;
+
+int clampTo(int v, int lo, int hi) { return v < lo ? lo : v > hi ? hi : v; }
+
+// The point of pixel (x, y)'s square nearest to the centre lies inside the circle
+bool touched(int x, int y) {
+  const int nx = clampTo(kR, x, x + 1) - kR, ny = clampTo(kR, y, y + 1) - kR;
+  return nx * nx + ny * ny < kR * kR;
+}
+
+// All of the pixel's square lies inside the circle
+bool inside(int x, int y) {
+  const int fx = (x + 1 <= kR ? x : x + 1) - kR, fy = (y + 1 <= kR ? y : y + 1) - kR;
+  return fx * fx + fy * fy <= kR * kR;
+}
+
+bool inSpan(int x, int y) { return x >= RoundMask::rowStart(y) && x < RoundMask::rowEnd(y); }
+
+void testSpanTable() {
+  static_assert(sys::kRoundPanel, "the table is the identity without a round panel");
+  uint32_t visible = 0, full = 0, missed = 0, extra = 0;
+  for (int y = 0; y < kH; ++y) {
+    CHECK_MSG(RoundMask::rowStart(y) == RoundMask::rowStart(kH - 1 - y), "rows %d and %d differ", y, kH - 1 - y);
+    for (int x = 0; x < kW; ++x) {
+      const bool t = touched(x, y), s = inSpan(x, y);
+      visible += s;
+      full += inside(x, y);
+      missed += t && !s;
+      extra += s && !t;
+    }
+  }
+  CHECK_MSG(missed == 0, "%u pixels the circle touches lie outside the spans", missed);
+  CHECK_MSG(extra == 0, "%u pixels in the spans do not touch the circle", extra);
+  CHECK(visible == RoundMask::visiblePixels(0, 0, kW, kH));
+  printf("span table: %u of %u px visible (%.1f%%), %u of them wholly inside the circle\n", visible, kW * kH,
+         visible * 100.0 / (kW * kH), full);
+
+  // Rows outside the screen have no visible columns
+  int x = 0, w = kW;
+  CHECK(!RoundMask::clipRow(-1, x, w));
+  x = 0; w = kW;
+  CHECK(!RoundMask::clipRow(kH, x, w));
+}
+
+void testHelpers() {
+  uint32_t s = 12345;
+  auto next = [&](int n) { s = s * 1103515245u + 12345u; return (int)((s >> 8) % (uint32_t)n); };
+  for (int i = 0; i < 20000; ++i) {
+    const int x = next(kW + 40) - 20, y = next(kH + 40) - 20, w = 1 + next(kW), h = 1 + next(kH / 2);
+    uint32_t brute = 0;
+    bool all = true;
+    for (int yy = y; yy < y + h; ++yy)
+      for (int xx = x; xx < x + w; ++xx) {
+        const bool v = xx >= 0 && yy >= 0 && xx < kW && yy < kH && touched(xx, yy);
+        brute += v;
+        all &= v;
+      }
+    const uint32_t count = RoundMask::visiblePixels(x, y, w, h);
+    CHECK_MSG(count == brute, "visiblePixels(%d,%d,%d,%d) = %u, expected %u", x, y, w, h, count, brute);
+    if (x >= 0 && y >= 0 && x + w <= kW && y + h <= kH)
+      CHECK_MSG(RoundMask::contains(x, y, w, h) == all, "contains(%d,%d,%d,%d) = %d", x, y, w, h, !all);
+    for (int yy = y; yy < y + h; yy += 7) {
+      int cx = x, cw = w;
+      const bool any = RoundMask::clipRow(yy, cx, cw);
+      int first = -1, n = 0;
+      for (int xx = x; xx < x + w; ++xx)
+        if (xx >= 0 && xx < kW && yy >= 0 && yy < kH && touched(xx, yy)) { if (first < 0) first = xx; ++n; }
+      CHECK_MSG(any == (n > 0) && (!any || (cx == first && cw == n)), "clipRow(%d) of [%d,+%d): [%d,+%d), expected [%d,+%d)",
+                yy, x, w, cx, cw, first, n);
+    }
+  }
+}
+
+std::unique_ptr<MemDisplay> makePanel(uint16_t color) {
+  std::unique_ptr<MemDisplay> panel(new MemDisplay(ui_gfx::FramebufferPool::instance().acquire()));
+  CHECK(panel->begin(GFX_SKIP_OUTPUT_BEGIN));
+  panel->fillScreen(color);
+  panel->resetCounters();
+  return panel;
+}
+
+// Visible pixels equal want(x, y), corners keep the panel's earlier colour
+template <typename Want> size_t wrongPixels(MemDisplay& panel, uint16_t corner, Want want) {
+  size_t n = 0;
+  for (int y = 0; y < kH; ++y)
+    for (int x = 0; x < kW; ++x) n += panel.pixels()[y * kW + x] != (inSpan(x, y) ? want(x, y) : corner);
+  return n;
+}
+
+void report(const char* name, const MemDisplay::Counters& c) {
+  const uint32_t square = kW * kH;
+  printf("%-34s %8u px %8u bytes %5u calls, %6u bytes (%.1f%%) saved\n", name, (unsigned)c.pixels, (unsigned)c.pixels * 2,
+         (unsigned)c.calls, (unsigned)(square - c.pixels) * 2, (square - c.pixels) * 100.0 / square);
+}
+
+ui_gfx::FbLease cover(uint16_t seed) {
+  ui_gfx::FbLease fb = ui_gfx::FramebufferPool::instance().acquire();
+  if (!fb) return fb;
+  for (int i = 0; i < kW * kH; ++i) fb.data()[i] = (uint16_t)(seed ^ (i * 2654435761u >> 16));
+  return fb;
+}
+
+void testFullRedraws() {
+  const uint32_t visible = RoundMask::visiblePixels(0, 0, kW, kH);
+  {
+    std::unique_ptr<MemDisplay> panel = makePanel(0x1234);
+    ui_gfx::Display(panel.get()).fill(0xF800);
+    report("Display::fill (square)", panel->counters());
+    CHECK(panel->counters().pixels == (uint32_t)kW * kH && panel->counters().calls == 1);
+  }
+  {
+    std::unique_ptr<MemDisplay> panel = makePanel(0x1234);
+    ui_gfx::Display(panel.get()).fillVisible(0xF800);
+    report("Display::fillVisible", panel->counters());
+    CHECK(panel->counters().pixels == visible && panel->counters().calls == (uint32_t)kH);
+    CHECK(wrongPixels(*panel, 0x1234, [](int, int) { return (uint16_t)0xF800; }) == 0);
+  }
+  ui_gfx::FbLease src = cover(0x0F0F);
+  const uint16_t* s = src.data();
+  {
+    std::unique_ptr<MemDisplay> panel = makePanel(0x1234);
+    ui_gfx::Display(panel.get()).drawRectVisible(0, 0, s, kW, kW, kH);
+    report("Display::drawRectVisible", panel->counters());
+    CHECK(panel->counters().pixels == visible);
+    CHECK(wrongPixels(*panel, 0x1234, [&](int x, int y) { return s[y * kW + x]; }) == 0);
+
+    // A block inside the circle goes as drawRect() sends it: whole rows, a call each
+    panel->resetCounters();
+    ui_gfx::Display(panel.get()).drawRectVisible(140, 140, s + 140 * kW + 140, kW, 200, 200);
+    CHECK(panel->counters().calls == 200 && panel->counters().pixels == 200 * 200);
+  }
+  {
+    std::unique_ptr<MemDisplay> panel = makePanel(0x1234);
+    albumart::BackgroundArt bg;
+    bg.present(std::move(src), albumart::CoverTone());
+    bg.tick();
+    ui_gfx::Display disp(panel.get());
+    bg.forceFullRedraw(disp);
+    report("BackgroundArt::forceFullRedraw", panel->counters());
+    CHECK(panel->counters().pixels == visible);
+  }
+}
+
+} // namespace
+
+// --- Link-time fakes: no cover jobs are submitted here ---------------------------
+
+namespace albumart {
+ArtJobId ArtScheduler::submit(const String&, ArtPriority, ArtSink, void*) { return 0; }
+bool ArtScheduler::busy(void*) const { return false; }
+} // namespace albumart
+
+int main() {
+  CHECK(ui_gfx::FramebufferPool::instance().begin());
+  testSpanTable();
+  testHelpers();
+  testFullRedraws();
+  return hosttest::result("round_mask_test");
+}
@@ -0,0 +1,262 @@
+// TextLayout::wrap checked against AaText::width on long German titles, the release
+// notes as the About page shows them and edge cases (blank lines, words wider than the
+// line, line limits): lines cover the text in order, start on a code point, fit the
+// width, and the word (or glyph) that went to the next line would not have fit.
+// LayoutCache hits and evictions are counted. Reports µs per wrap, per cache hit and
+// for the old way of measuring every candidate line as a String.
+#include "HostTest.h"
+#include "gfx/AaFont.h"
+#include "gfx/TextLayout.h"
+#include "gfx/fonts/AaFonts.h"
+#include "release_notes.h"
+#include <Arduino.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace ui_gfx;
+
+namespace {
+
+constexpr int kRuns = 200;
+
+const char* const kTitles[] = {
+  "Ein Lied über die Straßen von München im Regen und die Menschen, die dort nachts unterwegs sind",
+  "Die Fantastischen Vier feat. Herbert Grönemeyer, Clueso & Xavier Naidoo – Einfach sein (Live aus der Schleyerhalle)",
+  "Donaudampfschifffahrtsgesellschaftskapitänswitwe",
+  "Symphonie Nr. 9 d‑Moll op. 125 „An die Freude“: IV. Presto – Allegro assai – „O Freunde, nicht diese Töne!“",
+  "Grüße aus Köln – „Fußball“ über Ärger",
+  "Beyoncé · Déjà Vu · Sigur Rós · Dvořák · Łódź",
+  "Bohemian Rhapsody",
+};
+
+// The About page's text: main.cpp's Markdown rewrite of kReleaseNotesText
+std::string releaseNotes() {
+  std::string in(kReleaseNotesText), out;
+  size_t start = 0;
+  while (start <= in.size()) {
+    size_t end = in.find('\n', start);
+    if (end == std::string::npos) end = in.size();
+    std::string line = in.substr(start, end - start);
+    if (line.compare(0, 3, "## ") == 0) line = line.substr(3);
+    else if (line.compare(0, 2, "# ") == 0) line = line.substr(2);
+    if (line.compare(0, 2, "- ") == 0) line = "\xE2\x80\xA2 " + line.substr(2);
+    out += line;
+    if (end < in.size()) out += '\n';
+    start = end + 1;
+  }
+  return out;
+}
+
+size_t trimmedLen(const char* s, size_t n) {
+  while (n && (s[n - 1] == ' ' || s[n - 1] == '\r')) --n;
+  return n;
+}
+
+// End of the word starting at p (the next space, newline or end)
+size_t wordEnd(const std::string& t, size_t p) {
+  while (p < t.size() && t[p] == ' ') ++p;
+  while (p < t.size() && t[p] != ' ' && t[p] != '\n') ++p;
+  return p;
+}
+
+// Every property of a wrap of t at maxW
+void checkWrap(const char* name, const std::string& t, const AaFont& font, int16_t maxW, int maxLines) {
+  WrappedText w;
+  TextLayout::wrap(font, t.c_str(), t.size(), maxW, maxLines, w);
+  size_t pos = 0;
+  for (size_t i = 0; i < w.lines.size(); ++i) {
+    const LineBreak& lb = w.lines[i];
+    const char* s = t.c_str() + lb.start;
+    CHECK_MSG(lb.start == pos, "%s@%d line %zu starts at %u, expected %zu", name, maxW, i, lb.start, pos);
+    CHECK_MSG(lb.start >= t.size() || ((uint8_t)*s & 0xC0) != 0x80, "%s@%d line %zu starts inside a code point", name, maxW, i);
+    const size_t n = trimmedLen(s, lb.len);
+    const int16_t measured = AaText::width(font, s, n);
+    CHECK_MSG(lb.width == measured, "%s@%d line %zu: width %d, AaText::width %d", name, maxW, i, lb.width, measured);
+    const char* q = s;
+    AaText::nextCodepoint(q);
+    const bool oneGlyph = n && (size_t)(q - s) == n;
+    CHECK_MSG(lb.width <= maxW || oneGlyph, "%s@%d line %zu is %d px wide", name, maxW, i, lb.width);
+
+    pos = lb.start + lb.len;
+    const bool atNewline = pos < t.size() && t[pos] == '\n';
+    if (atNewline) ++pos;
+    if (i + 1 < w.lines.size() && !atNewline) {
+      // Greedy: the next word (or, inside a split word, the next glyph) did not fit
+      const bool split = lb.len && t[pos - 1] != ' ';
+      size_t next = pos;
+      if (split) { const char* g = t.c_str() + pos; AaText::nextCodepoint(g); next = g - t.c_str(); }
+      else next = wordEnd(t, pos);
+      const int16_t with = AaText::width(font, s, next - lb.start);
+      CHECK_MSG(with >= maxW, "%s@%d line %zu: '%.*s' would have fit (%d px)", name, maxW, i, (int)(next - pos), t.c_str() + pos, with);
+    }
+  }
+  if (maxLines <= 0 || (int)w.lines.size() < maxLines) {
+    CHECK_MSG(w.complete, "%s@%d: incomplete without a line limit", name, maxW);
+    CHECK_MSG(pos >= t.size(), "%s@%d: lines end at %zu of %zu bytes", name, maxW, pos, t.size());
+  } else {
+    size_t rest = pos;
+    while (rest < t.size() && (t[rest] == ' ' || t[rest] == '\n')) ++rest;
+    CHECK_MSG(w.complete == (rest >= t.size()), "%s@%d: complete=%d with %zu bytes left", name, maxW, w.complete, t.size() - rest);
+  }
+}
+
+void testProperties() {
+  const std::string notes = releaseNotes();
+  int cases = 0;
+  for (int16_t maxW : {440, 420, 300, 200, 120, 60}) {
+    for (const char* t : kTitles) {
+      checkWrap(t, t, kAaSans12, maxW, 0);
+      checkWrap(t, t, kAaSans12, maxW, 2);
+      checkWrap(t, t, kAaSans18, maxW, 0);
+      cases += 3;
+    }
+    checkWrap("release notes", notes, kAaSans12, maxW, 0);
+    checkWrap("release notes", notes, kAaSans12, maxW, 5);
+    cases += 2;
+  }
+  printf("wrap properties: %d layouts checked\n", cases);
+}
+
+void testEdges() {
+  WrappedText w;
+  TextLayout::wrap(kAaSans12, "", 0, 440, 0, w);
+  CHECK(w.lines.empty() && w.complete);
+
+  // Blank lines stay lines, and a final '\n' opens an empty one
+  const char* blank = "a\n\nb\n";
+  TextLayout::wrap(kAaSans12, blank, strlen(blank), 440, 0, w);
+  CHECK(w.lines.size() == 4);
+  CHECK(w.lines.size() == 4 && w.lines[1].len == 0 && w.lines[3].len == 0 && w.lines[2].start == 3);
+
+  // A word wider than the line is split instead of dropped
+  const char* word = "Donaudampfschifffahrtsgesellschaftskapitänswitwe";
+  TextLayout::wrap(kAaSans12, word, strlen(word), 100, 0, w);
+  CHECK(w.lines.size() > 2);
+  size_t bytes = 0;
+  for (const LineBreak& lb : w.lines) bytes += lb.len;
+  CHECK(bytes == strlen(word));
+
+  // Trailing spaces hang past the margin and never make a line of their own
+  const std::string spaces = std::string("Bohemian Rhapsody") + std::string(200, ' ');
+  TextLayout::wrap(kAaSans12, spaces.c_str(), spaces.size(), 440, 1, w);
+  CHECK(w.lines.size() == 1 && w.complete);
+  CHECK(w.lines.size() == 1 && w.lines[0].width == AaText::width(kAaSans12, "Bohemian Rhapsody"));
+
+  // Two lines of a three-line title: cut off, and says so
+  TextLayout::wrap(kAaSans12, kTitles[0], strlen(kTitles[0]), 300, 2, w);
+  CHECK(w.lines.size() == 2 && !w.complete);
+
+  // n ends the text before the NUL
+  TextLayout::wrap(kAaSans12, "Bohemian Rhapsody", 8, 440, 0, w);
+  CHECK(w.lines.size() == 1 && w.lines[0].len == 8);
+}
+
+void testCache() {
+  LayoutCache cache;
+  const std::string notes = releaseNotes();
+  const WrappedText& a = cache.get(notes.c_str(), notes.size(), kAaSans12, 420);
+  const WrappedText& b = cache.get(notes.c_str(), notes.size(), kAaSans12, 420);
+  CHECK(&a == &b);
+  CHECK(cache.stats().misses == 1 && cache.stats().hits == 1);
+
+  // Every key part counts: width, line limit, font, length
+  cache.get(notes.c_str(), notes.size(), kAaSans12, 400);
+  cache.get(notes.c_str(), notes.size(), kAaSans12, 420, 5);
+  cache.get(notes.c_str(), notes.size(), kAaSans18, 420);
+  cache.get(notes.c_str(), notes.size() - 1, kAaSans12, 420);
+  CHECK(cache.stats().misses == 5 && cache.stats().hits == 1);
+  cache.get(notes.c_str(), notes.size(), kAaSans12, 420);
+  CHECK(cache.stats().hits == 2);
+
+  // A player redraw loop: title and artist alternate with the notes; all hits
+  const String title = kTitles[1], artist = "Die Fantastischen Vier";
+  cache.get(title, kAaSans12, 440, 2);
+  cache.get(artist, kAaSans12, 440, 2);
+  const LayoutCache::Stats s0 = cache.stats();
+  for (int i = 0; i < 10; ++i) {
+    cache.get(title, kAaSans12, 440, 2);
+    cache.get(artist, kAaSans12, 440, 2);
+    cache.get(notes.c_str(), notes.size(), kAaSans12, 420);
+  }
+  CHECK(cache.stats().hits - s0.hits == 30 && cache.stats().misses == s0.misses);
+
+  // kSlots more texts evict them all, least recently used first
+  for (int i = 0; i < LayoutCache::kSlots; ++i) cache.get(kTitles[i], kAaSans12, 200);
+  const uint32_t misses = cache.stats().misses;
+  cache.get(title, kAaSans12, 440, 2);
+  CHECK(cache.stats().misses == misses + 1);
+
+  // A hit returns the layout of its own text
+  WrappedText direct;
+  TextLayout::wrap(kAaSans12, kTitles[0], strlen(kTitles[0]), 200, 0, direct);
+  const WrappedText& cached = cache.get(kTitles[0], kAaSans12, 200);
+  CHECK(cached.lines.size() == direct.lines.size());
+}
+
+// The player's wrap before the layout cache: words as Strings, every candidate line
+// measured again from its start
+int wrapByMeasuring(const String& text, const AaFont& font, int maxW, std::vector<String>& lines) {
+  lines.clear();
+  String line;
+  int start = 0;
+  while (start < (int)text.length()) {
+    int sp = text.indexOf(' ', start);
+    if (sp < 0) sp = text.length();
+    const String word = text.substring(start, sp);
+    const String candidate = line.length() ? line + " " + word : word;
+    if (line.length() && AaText::width(font, candidate.c_str()) > maxW) { lines.push_back(line); line = word; }
+    else line = candidate;
+    start = sp + 1;
+  }
+  if (line.length()) lines.push_back(line);
+  return (int)lines.size();
+}
+
+template <typename Fn> double usPer(Fn fn) {
+  const unsigned long t0 = micros();
+  for (int i = 0; i < kRuns; ++i) fn();
+  return (double)(micros() - t0) / kRuns;
+}
+
+void bench() {
+  printf("%-36s %6s %6s %12s %10s %10s\n", "text (µs)", "bytes", "lines", "measure all", "wrap", "cache hit");
+  const std::string notes = releaseNotes();
+  struct Item { std::string name, text; int16_t maxW; } items[] = {
+    {"title, 2 lines", kTitles[1], 440},
+    {"title, marquee", kTitles[3], 440},
+    {"short title", kTitles[6], 440},
+    {"release notes", notes, 420},
+  };
+  for (const Item& it : items) {
+    const String s = it.text.c_str();
+    std::vector<String> old;
+    WrappedText w;
+    LayoutCache cache;
+    cache.get(it.text.c_str(), it.text.size(), kAaSans12, it.maxW);
+    // The old wrap split on spaces only: the notes go line by line
+    const double measure = usPer([&] {
+      int from = 0;
+      while (from <= (int)s.length()) {
+        int nl = s.indexOf('\n', from);
+        if (nl < 0) nl = s.length();
+        wrapByMeasuring(s.substring(from, nl), kAaSans12, it.maxW, old);
+        from = nl + 1;
+      }
+    });
+    const double wrap = usPer([&] { TextLayout::wrap(kAaSans12, it.text.c_str(), it.text.size(), it.maxW, 0, w); });
+    const double hit = usPer([&] { cache.get(it.text.c_str(), it.text.size(), kAaSans12, it.maxW); });
+    CHECK(cache.stats().hits == (uint32_t)kRuns);
+    printf("%-36s %6zu %6zu %12.1f %10.1f %10.2f\n", it.name.c_str(), it.text.size(), w.lines.size(), measure, wrap, hit);
+  }
+}
+
+} // namespace
+
+int main() {
+  testProperties();
+  testEdges();
+  testCache();
+  bench();
+  return hosttest::result("text_layout_test");
+}
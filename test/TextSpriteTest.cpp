@@ -0,0 +1,214 @@
+// TextSprite against the font renderer it caches: plain ink must match AaText::draw
+// pixel for pixel, the outlined sprite must touch the same pixels as the player's old
+// nine-pass outline (eight black offsets plus the fill) and keep the glyph cores, and
+// a clipped blit must equal the full one inside the clip. TextCache hits, misses and
+// LRU eviction are counted. Reports µs per overlay redraw for both ways.
+#include "HostTest.h"
+#include "gfx/AaFont.h"
+#include "gfx/TextSprite.h"
+#include "gfx/fonts/AaFonts.h"
+#include <Arduino.h>
+#include <cstdlib>
+#include <vector>
+
+using namespace ui_gfx;
+
+namespace {
+
+constexpr int kW = sys::kScreenW;
+constexpr int kH = sys::kScreenH;
+constexpr int kRuns = 200;
+
+struct Line {
+  const AaFont* font;
+  const char* text;
+};
+
+const Line kLines[] = {
+  {&kAaSans12, "Bohemian Rhapsody"},
+  {&kAaSans12, "Grüße aus Köln – „Fußball“ über Ärger"},
+  {&kAaSans12, "Beyoncé · Déjà Vu · Sigur Rós"},
+  {&kAaSans18, "AVATAR Tokyo WAVE To Ty"},
+  {&kAaSans24, "12:34  Vol 42%"},
+};
+
+// A cover-like background: coloured bands with a diagonal gradient
+std::vector<uint16_t> background() {
+  std::vector<uint16_t> fb(kW * kH);
+  for (int y = 0; y < kH; ++y)
+    for (int x = 0; x < kW; ++x) {
+      const int r = (x * 31) / kW, g = ((x + y) * 63) / (kW + kH), b = 31 - (y * 31) / kH;
+      fb[y * kW + x] = (uint16_t)((r << 11) | (g << 5) | b);
+    }
+  return fb;
+}
+
+const Rect kScreen{0, 0, kW, kH};
+
+// Centred on the title row, as the player lays it out
+void origin(const Line& l, int16_t& x, int16_t& y) {
+  const Rect b = AaText::bounds(*l.font, l.text, 0, 0);
+  x = (int16_t)((kW - b.w) / 2 - b.x);
+  y = 216;
+}
+
+// PlayerScreen::drawTextOutline_ before the sprites: eight black offsets, then the fill
+void outlineDirect(uint16_t* fb, const Line& l, int16_t x, int16_t y, uint16_t ink, const Rect& clip) {
+  for (int dx = -1; dx <= 1; ++dx)
+    for (int dy = -1; dy <= 1; ++dy)
+      if (dx || dy) AaText::draw(fb, kW, clip, *l.font, x + dx, y + dy, l.text, BLACK);
+  AaText::draw(fb, kW, clip, *l.font, x, y, l.text, ink);
+}
+
+int channelDelta(uint16_t a, uint16_t b) {
+  const int dr = abs((a >> 11) - (b >> 11)), dg = abs(((a >> 5) & 63) - ((b >> 5) & 63)) / 2, db = abs((a & 31) - (b & 31));
+  return dr > dg ? (dr > db ? dr : db) : (dg > db ? dg : db);
+}
+
+void testPlain() {
+  const std::vector<uint16_t> bg = background();
+  for (const Line& l : kLines) {
+    TextSprite sp;
+    CHECK_MSG(sp.render(l.text, *l.font), "%s: render failed", l.text);
+    int16_t x, y;
+    origin(l, x, y);
+    for (uint16_t ink : {(uint16_t)WHITE, (uint16_t)0x2104, (uint16_t)0xFD20}) {
+      std::vector<uint16_t> direct = bg, sprite = bg;
+      AaText::draw(direct.data(), kW, kScreen, *l.font, x, y, l.text, ink);
+      sp.blit(sprite.data(), kW, x, y, kScreen, ink, false);
+      size_t diff = 0;
+      for (size_t i = 0; i < direct.size(); ++i) diff += direct[i] != sprite[i];
+      CHECK_MSG(diff == 0, "%s ink 0x%04X: %zu pixels differ from AaText::draw", l.text, ink, diff);
+    }
+  }
+}
+
+// The sprite's outline is the strongest neighbour coverage blended once; the nine
+// passes blend black up to eight times, so edge pixels differ in shade. Same
+// footprint and glyph cores are required, the shade difference is reported.
+void testOutline() {
+  const std::vector<uint16_t> bg = background();
+  printf("%-40s %10s %10s %8s\n", "outlined line", "px drawn", "px differ", "max diff");
+  for (const Line& l : kLines) {
+    TextSprite sp;
+    CHECK(sp.render(l.text, *l.font));
+    int16_t x, y;
+    origin(l, x, y);
+    std::vector<uint16_t> direct = bg, sprite = bg;
+    outlineDirect(direct.data(), l, x, y, WHITE, kScreen);
+    sp.blit(sprite.data(), kW, x, y, kScreen, WHITE, true);
+
+    std::vector<uint8_t> mask(kW * kH, 0);
+    AaText::coverage(mask.data(), kW, kW, kH, *l.font, x, y, l.text);
+    const Rect box = sp.box(x, y);
+    size_t outside = 0, cores = 0, drawn = 0, differ = 0;
+    int maxDelta = 0;
+    for (int py = 0; py < kH; ++py)
+      for (int px = 0; px < kW; ++px) {
+        const size_t i = (size_t)py * kW + px;
+        const bool inBox = px >= box.x && px < box.x + box.w && py >= box.y && py < box.y + box.h;
+        outside += !inBox && (direct[i] != bg[i] || sprite[i] != bg[i]);
+        cores += mask[i] == 0x0F && (direct[i] != WHITE || sprite[i] != WHITE);
+        drawn += (direct[i] != bg[i]) || (sprite[i] != bg[i]);
+        // Drawn by one and not the other; a blend below one step per channel may not show
+        CHECK_MSG((direct[i] == bg[i]) == (sprite[i] == bg[i]) || channelDelta(direct[i], bg[i]) <= 1 || channelDelta(sprite[i], bg[i]) <= 1,
+                  "%s: (%d,%d) drawn by only one of the two", l.text, px, py);
+        if (direct[i] != sprite[i]) {
+          ++differ;
+          const int d = channelDelta(direct[i], sprite[i]);
+          if (d > maxDelta) maxDelta = d;
+        }
+      }
+    CHECK_MSG(outside == 0, "%s: %zu pixels outside the sprite box", l.text, outside);
+    CHECK_MSG(cores == 0, "%s: %zu fully covered pixels not in ink", l.text, cores);
+    printf("%-40s %10zu %10zu %8d\n", l.text, drawn, differ, maxDelta);
+  }
+}
+
+// Clip edges through the middle of glyphs
+void testClipped() {
+  const std::vector<uint16_t> bg = background();
+  const Line& l = kLines[1];
+  TextSprite sp;
+  CHECK(sp.render(l.text, *l.font));
+  int16_t x, y;
+  origin(l, x, y);
+  const Rect b = sp.box(x, y);
+  const Rect clip{(int16_t)(b.x + 37), (int16_t)(b.y + 5), (int16_t)(b.w / 3), (int16_t)(b.h - 9)};
+  std::vector<uint16_t> full = bg, part = bg;
+  sp.blit(full.data(), kW, x, y, kScreen, WHITE, true);
+  sp.blit(part.data(), kW, x, y, clip, WHITE, true);
+  size_t wrong = 0;
+  for (int py = 0; py < kH; ++py)
+    for (int px = 0; px < kW; ++px) {
+      const size_t i = (size_t)py * kW + px;
+      const bool in = px >= clip.x && px < clip.x + clip.w && py >= clip.y && py < clip.y + clip.h;
+      wrong += part[i] != (in ? full[i] : bg[i]);
+    }
+  CHECK_MSG(wrong == 0, "%zu pixels wrong in the clipped blit", wrong);
+}
+
+void testCache() {
+  TextCache cache;
+  const TextSprite* first = cache.get("Bohemian Rhapsody", &kAaSans12);
+  CHECK(first && first->valid());
+  CHECK(cache.get("Bohemian Rhapsody", &kAaSans12) == first);
+  CHECK(cache.get("Bohemian Rhapsody", &kAaSans18) != first);  // keyed by font too
+  CHECK(cache.stats().hits == 1 && cache.stats().misses == 2);
+  CHECK(cache.get("", &kAaSans12) == nullptr);
+  CHECK(cache.get("   ", &kAaSans12) == nullptr);
+
+  // One title more than there are slots: the least recently used one goes, a title
+  // touched again stays
+  cache.clear();
+  const TextCache::Stats s0 = cache.stats();
+  String titles[TextCache::kSlots + 1];
+  for (int i = 0; i <= TextCache::kSlots; ++i) titles[i] = String("Titel Nummer ") + String(i);
+  for (int i = 0; i < TextCache::kSlots; ++i) CHECK(cache.get(titles[i], &kAaSans12));
+  CHECK(cache.get(titles[0], &kAaSans12));                         // hit, now most recent
+  CHECK(cache.get(titles[TextCache::kSlots], &kAaSans12));         // evicts titles[1]
+  CHECK(cache.stats().hits - s0.hits == 1);
+  CHECK(cache.stats().misses - s0.misses == (uint32_t)TextCache::kSlots + 1);
+  CHECK(cache.get(titles[0], &kAaSans12));
+  CHECK(cache.stats().hits - s0.hits == 2);
+  CHECK(cache.get(titles[1], &kAaSans12));
+  CHECK(cache.stats().misses - s0.misses == (uint32_t)TextCache::kSlots + 2);
+
+  size_t bytes = 0;
+  for (int i = 0; i <= TextCache::kSlots; ++i) {
+    TextSprite sp;
+    if (i != 2) { sp.render(titles[i].c_str(), kAaSans12); bytes += sp.bytes(); }  // titles[2] was evicted last
+  }
+  CHECK_MSG(cache.stats().bytes == bytes, "cache holds %zu bytes, its sprites %zu", cache.stats().bytes, bytes);
+}
+
+template <typename Fn> double usPer(Fn fn) {
+  const unsigned long t0 = micros();
+  for (int i = 0; i < kRuns; ++i) fn();
+  return (double)(micros() - t0) / kRuns;
+}
+
+void benchRedraw() {
+  std::vector<uint16_t> fb = background();
+  printf("%-40s %12s %12s %12s %8s\n", "line (µs per redraw)", "9 passes", "sprite", "rasterise", "speedup");
+  for (const Line& l : kLines) {
+    int16_t x, y;
+    origin(l, x, y);
+    TextSprite sp;
+    const double direct = usPer([&] { outlineDirect(fb.data(), l, x, y, WHITE, kScreen); });
+    const double render = usPer([&] { sp.render(l.text, *l.font); });
+    const double blit = usPer([&] { sp.blit(fb.data(), kW, x, y, kScreen, WHITE, true); });
+    printf("%-40s %12.1f %12.1f %12.1f %7.1fx\n", l.text, direct, blit, render, direct / blit);
+  }
+}
+
+} // namespace
+
+int main() {
+  testPlain();
+  testOutline();
+  testClipped();
+  testCache();
+  benchRedraw();
+  return hosttest::result("text_sprite_test");
+}
@@ -0,0 +1,123 @@
+// UrlRewriter rules, one table per source: expected URL, or nullptr when the URL
+// must come back unchanged
+#include "HostTest.h"
+#include "albumart/UrlRewriter.h"
+
+using albumart::UrlRewriter;
+
+namespace {
+
+struct Case {
+  const char* in;
+  int minPx;
+  const char* out;  // nullptr: unchanged
+};
+
+void run(const char* source, const Case* cases, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    const Case& c = cases[i];
+    const String got = UrlRewriter::rewrite(c.in, c.minPx);
+    const char* want = c.out ? c.out : c.in;
+    CHECK_MSG(got == want, "%s #%u (%d px): %s\n    got  %s\n    want %s", source, (unsigned)i, c.minPx, c.in, got.c_str(), want);
+  }
+}
+
+#define RUN(source, table) run(source, table, sizeof(table) / sizeof(table[0]))
+
+const Case kSpotify[] = {
+  // i.scdn.co size codes: 4851 = 64, 1e02 = 300, b273 = 640, 82c1 = 1000 px
+  {"https://i.scdn.co/image/ab67616d00001e02ff9ca10b55ce82ae553c8228", 480, "https://i.scdn.co/image/ab67616d0000b273ff9ca10b55ce82ae553c8228"},
+  {"https://i.scdn.co/image/ab67616d00004851ff9ca10b55ce82ae553c8228", 480, "https://i.scdn.co/image/ab67616d0000b273ff9ca10b55ce82ae553c8228"},
+  {"https://i.scdn.co/image/ab67616d000082c1ff9ca10b55ce82ae553c8228", 480, "https://i.scdn.co/image/ab67616d0000b273ff9ca10b55ce82ae553c8228"},
+  {"https://i.scdn.co/image/ab67616d0000b273ff9ca10b55ce82ae553c8228", 480, nullptr},
+  {"https://i.scdn.co/image/ab67616d00004851ff9ca10b55ce82ae553c8228", 200, "https://i.scdn.co/image/ab67616d00001e02ff9ca10b55ce82ae553c8228"},
+  {"https://i.scdn.co/image/ab67616d0000b273ff9ca10b55ce82ae553c8228", 800, "https://i.scdn.co/image/ab67616d000082c1ff9ca10b55ce82ae553c8228"},
+  {"https://i.scdn.co/image/ab67616d00001e02ff9ca10b55ce82ae553c8228", 1200, nullptr},  // nothing that large
+  {"https://i.scdn.co/image/ab67616d0000b2", 480, nullptr},                             // truncated code
+  {"https://i.scdn.co/image/ab6761610000e5eb0bae7cfb9a4e8f14bd3b5f06", 480, nullptr},   // artist image, other scheme
+  // mosaic.scdn.co/<size>/...: 300 or 640
+  {"https://mosaic.scdn.co/300/ab67616d0000b2731f3b5ec1a5f5d4e7", 480, "https://mosaic.scdn.co/640/ab67616d0000b2731f3b5ec1a5f5d4e7"},
+  {"https://mosaic.scdn.co/640/ab67616d0000b2731f3b5ec1a5f5d4e7", 480, nullptr},
+  {"https://mosaic.scdn.co/640/ab67616d0000b2731f3b5ec1a5f5d4e7", 300, "https://mosaic.scdn.co/300/ab67616d0000b2731f3b5ec1a5f5d4e7"},
+  {"https://mosaic.scdn.co/640", 480, nullptr},                                         // no path after the size
+};
+
+const Case kSoundCloud[] = {
+  // -<variant>.jpg: large = 100, t300x300, crop = 400, t500x500, original
+  {"https://i1.sndcdn.com/artworks-000512345678-abcdef-large.jpg", 480, "https://i1.sndcdn.com/artworks-000512345678-abcdef-t500x500.jpg"},
+  {"https://i1.sndcdn.com/artworks-000512345678-abcdef-t500x500.jpg", 480, nullptr},
+  {"https://i1.sndcdn.com/artworks-000512345678-abcdef-large.jpg", 350, "https://i1.sndcdn.com/artworks-000512345678-abcdef-crop.jpg"},
+  {"https://i1.sndcdn.com/artworks-000512345678-abcdef-large.jpg", 600, "https://i1.sndcdn.com/artworks-000512345678-abcdef-original.jpg"},
+  {"https://i1.sndcdn.com/avatars-000123-xyz-t300x300.png", 480, "https://i1.sndcdn.com/avatars-000123-xyz-t500x500.png"},
+  {"https://i1.sndcdn.com/artworks-000512345678/cover.jpg", 480, nullptr},             // dash only in the directory
+  {"https://i1.sndcdn.com/artworks-000512345678-abcdef-large", 480, nullptr},          // no extension
+};
+
+const Case kAppleMusic[] = {
+  // .../<w>x<h>bb.<ext>: the server renders any size, always asked for as JPEG
+  {"https://is1-ssl.mzstatic.com/image/thumb/Music116/v4/aa/bb/cc/source/100x100bb.jpg", 480, "https://is1-ssl.mzstatic.com/image/thumb/Music116/v4/aa/bb/cc/source/480x480bb.jpg"},
+  {"https://is1-ssl.mzstatic.com/image/thumb/Music116/v4/aa/bb/cc/source/1200x1200bb.webp", 480, "https://is1-ssl.mzstatic.com/image/thumb/Music116/v4/aa/bb/cc/source/480x480bb.jpg"},
+  {"https://is1-ssl.mzstatic.com/image/thumb/Music116/v4/aa/bb/cc/source/480x480bb.jpg", 480, nullptr},
+  {"https://is1-ssl.mzstatic.com/image/thumb/Music116/v4/aa/bb/cc/source/480x480bb.jpg", 240, "https://is1-ssl.mzstatic.com/image/thumb/Music116/v4/aa/bb/cc/source/240x240bb.jpg"},
+  {"https://is1-ssl.mzstatic.com/image/thumb/Music116/v4/aa/bb/cc/source/extra.png", 480, nullptr},  // 'x' but no size
+  {"https://is1-ssl.mzstatic.com/image/thumb/Music116/v4/aa/bb/cc/source/cover.jpg", 480, nullptr},
+};
+
+const Case kDeezer[] = {
+  // .../<w>x<h>-000000-80-0-0.jpg: 250, 500 or 1000
+  {"https://e-cdns-images.dzcdn.net/images/cover/2e018122cb56986277102d2041a592c8/250x250-000000-80-0-0.jpg", 480, "https://e-cdns-images.dzcdn.net/images/cover/2e018122cb56986277102d2041a592c8/500x500-000000-80-0-0.jpg"},
+  {"https://e-cdns-images.dzcdn.net/images/cover/2e018122cb56986277102d2041a592c8/1000x1000-000000-80-0-0.jpg", 480, "https://e-cdns-images.dzcdn.net/images/cover/2e018122cb56986277102d2041a592c8/500x500-000000-80-0-0.jpg"},
+  {"https://e-cdns-images.dzcdn.net/images/cover/2e018122cb56986277102d2041a592c8/500x500-000000-80-0-0.jpg", 480, nullptr},
+  {"https://e-cdns-images.dzcdn.net/images/cover/2e018122cb56986277102d2041a592c8/500x500-000000-80-0-0.jpg", 600, "https://e-cdns-images.dzcdn.net/images/cover/2e018122cb56986277102d2041a592c8/1000x1000-000000-80-0-0.jpg"},
+  {"https://e-cdns-images.dzcdn.net/images/cover/2e018122cb56986277102d2041a592c8/500x500-000000-80-0-0.jpg", 1400, nullptr},
+  {"https://cdn-images.dzcdn.net/images/artist/2e018122cb56986277102d2041a592c8/cover.jpg", 480, nullptr},  // no size segment
+};
+
+const Case kSonosGetaa[] = {
+  // Plain http(s) CDN URLs behind the speaker's proxy are fetched directly, right-sized
+  {"http://192.168.1.20:1400/getaa?s=1&u=https%3A%2F%2Fi.scdn.co%2Fimage%2Fab67616d00001e02ff9ca10b55ce82ae553c8228", 480,
+   "https://i.scdn.co/image/ab67616d0000b273ff9ca10b55ce82ae553c8228"},
+  {"http://192.168.1.20:1400/getaa?s=1&u=https%3A%2F%2Fe-cdns-images.dzcdn.net%2Fimages%2Fcover%2Fabc%2F250x250-000000-80-0-0.jpg&v=3", 480,
+   "https://e-cdns-images.dzcdn.net/images/cover/abc/500x500-000000-80-0-0.jpg"},
+  // Service URIs, unknown hosts and variants that are already right stay on the proxy
+  {"http://192.168.1.20:1400/getaa?s=1&u=x-sonos-spotify%3Aspotify%253atrack%253a4uLU6hMCjMI75M1A2tKUQC%3Fsid%3D12%26flags%3D8224", 480, nullptr},
+  {"http://192.168.1.20:1400/getaa?s=1&u=http%3A%2F%2Fradio.example%2Flogo.png", 480, nullptr},
+  {"http://192.168.1.20:1400/getaa?s=1&u=https%3A%2F%2Fi.scdn.co%2Fimage%2Fab67616d0000b273ff9ca10b55ce82ae553c8228", 480, nullptr},
+  {"http://192.168.1.20:1400/getaa?s=1", 480, nullptr},                                  // no u=
+};
+
+const Case kOther[] = {
+  {"https://example.com/cover.jpg", 480, nullptr},
+  {"http://192.168.1.20:1400/img/album.png", 480, nullptr},
+  {"", 480, nullptr},
+};
+
+const Case kRegistered[] = {
+  // A rule added at run time applies directly and behind the Sonos proxy
+  {"https://art.test/small/1.jpg", 480, "https://art.test/large/1.jpg"},
+  {"http://192.168.1.20:1400/getaa?s=1&u=https%3A%2F%2Fart.test%2Fsmall%2F2.jpg", 480, "https://art.test/large/2.jpg"},
+  {"https://art.test/large/1.jpg", 480, nullptr},
+};
+
+bool artTest(const String& in, int, String& out) {
+  const int p = in.indexOf("art.test/small/");
+  if (p < 0) return false;
+  out = in.substring(0, p) + "art.test/large/" + in.substring(p + 15);
+  return true;
+}
+
+} // namespace
+
+int main() {
+  RUN("spotify", kSpotify);
+  RUN("soundcloud", kSoundCloud);
+  RUN("apple music", kAppleMusic);
+  RUN("deezer", kDeezer);
+  RUN("sonos getaa", kSonosGetaa);
+  RUN("other", kOther);
+  // Default size: the screen
+  CHECK(UrlRewriter::rewrite("https://i.scdn.co/image/ab67616d00001e02aa") == "https://i.scdn.co/image/ab67616d0000b273aa");
+  UrlRewriter::addRule(&artTest);
+  RUN("registered", kRegistered);
+  return hosttest::result("url_rewriter_test");
+}
@@ -0,0 +1,97 @@
+#pragma once
+// Host stand-in for the parts of the Arduino core the tested sources use: String,
+// Serial and the millis()/micros()/delay() clock. Behaviour follows arduino-esp32.
+#include <cctype>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <strings.h>
+
+#define PROGMEM
+
+class String {
+public:
+  String() = default;
+  String(const char* s) : s_(s ? s : "") {}
+  String(const std::string& s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+
+  unsigned length() const { return (unsigned)s_.size(); }
+  const char* c_str() const { return s_.c_str(); }
+  void reserve(unsigned n) { s_.reserve(n); }
+  char operator[](unsigned i) const { return i < s_.size() ? s_[i] : 0; }
+  char charAt(unsigned i) const { return (*this)[i]; }
+
+  int indexOf(char c, unsigned from = 0) const { return pos(s_.find(c, from)); }
+  int indexOf(const char* s, unsigned from = 0) const { return pos(s_.find(s, from)); }
+  int indexOf(const String& s, unsigned from = 0) const { return pos(s_.find(s.s_, from)); }
+  int lastIndexOf(char c) const { return pos(s_.rfind(c)); }
+  int lastIndexOf(const char* s) const { return pos(s_.rfind(s)); }
+  String substring(unsigned from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned from, unsigned to) const {
+    if (from > to) std::swap(from, to);
+    return from < s_.size() ? String(s_.substr(from, to - from)) : String();
+  }
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  bool endsWith(const String& p) const {
+    return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+  }
+  bool equalsIgnoreCase(const String& o) const { return strcasecmp(c_str(), o.c_str()) == 0; }
+  long toInt() const { return atol(c_str()); }
+  void toLowerCase() { for (char& c : s_) c = (char)tolower((unsigned char)c); }
+  void toUpperCase() { for (char& c : s_) c = (char)toupper((unsigned char)c); }
+  void trim() {
+    size_t a = s_.find_first_not_of(" \t\r\n");
+    if (a == std::string::npos) { s_.clear(); return; }
+    s_ = s_.substr(a, s_.find_last_not_of(" \t\r\n") - a + 1);
+  }
+  void remove(unsigned i) { if (i < s_.size()) s_.erase(i); }
+  void remove(unsigned i, unsigned n) { if (i < s_.size()) s_.erase(i, n); }
+  void replace(const String& a, const String& b) {
+    if (a.s_.empty()) return;
+    for (size_t p = 0; (p = s_.find(a.s_, p)) != std::string::npos; p += b.s_.size()) s_.replace(p, a.s_.size(), b.s_);
+  }
+
+  String& operator+=(char c) { s_ += c; return *this; }
+  String& operator+=(const char* s) { s_ += s ? s : ""; return *this; }
+  String& operator+=(const String& s) { s_ += s.s_; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String& a, const char* b) { return String(a.s_ + (b ? b : "")); }
+  friend String operator+(const char* a, const String& b) { return String(std::string(a ? a : "") + b.s_); }
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == (o ? o : ""); }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  bool operator!=(const char* o) const { return !(*this == o); }
+  bool operator<(const String& o) const { return s_ < o.s_; }
+
+private:
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  std::string s_;
+};
+
+struct HostSerial {
+  void begin(unsigned long) {}
+  int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list a; va_start(a, fmt); int n = vprintf(fmt, a); va_end(a); return n;
+  }
+  int vprintf(const char* fmt, va_list a) { return ::vprintf(fmt, a); }
+  void print(char c) { putchar(c); }
+  void print(const char* s) { fputs(s, stdout); }
+  void print(const String& s) { fputs(s.c_str(), stdout); }
+  void println(const char* s = "") { puts(s); }
+  void println(const String& s) { puts(s.c_str()); }
+};
+extern HostSerial Serial;
+
+// Milliseconds/microseconds since the first call, and a sleeping delay()
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
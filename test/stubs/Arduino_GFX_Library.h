@@ -0,0 +1,124 @@
+#pragma once
+// Host stand-in for the Arduino_GFX API the tested sources use (1.5 signatures:
+// int32_t coordinates for the write primitives). Everything is built on
+// writePixelPreclipped; Arduino_Canvas draws into its own RGB565 frame.
+#include <Arduino.h>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <cstring>
+
+#define BLACK 0x0000
+#define WHITE 0xFFFF
+#define RED 0xF800
+#define GFX_NOT_DEFINED -1
+#define GFX_SKIP_OUTPUT_BEGIN -2
+
+class Arduino_G {
+public:
+  Arduino_G(int16_t w, int16_t h) : _width(w), _height(h) {}
+  virtual ~Arduino_G() {}
+  virtual bool begin(int32_t speed = GFX_NOT_DEFINED) { (void)speed; return true; }
+  virtual void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) = 0;
+
+protected:
+  int16_t _width, _height;
+};
+
+class Arduino_GFX : public Arduino_G {
+public:
+  Arduino_GFX(int16_t w, int16_t h) : Arduino_G(w, h) {}
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  virtual void writePixelPreclipped(int32_t x, int32_t y, uint16_t color) = 0;
+  virtual void writeFastVLine(int32_t x, int32_t y, int32_t h, uint16_t color) {
+    for (int32_t i = 0; i < h; ++i) writePixel(x, y + i, color);
+  }
+  virtual void writeFastHLine(int32_t x, int32_t y, int32_t w, uint16_t color) {
+    for (int32_t i = 0; i < w; ++i) writePixel(x + i, y, color);
+  }
+  virtual void writeFillRectPreclipped(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    for (int32_t j = 0; j < h; ++j) for (int32_t i = 0; i < w; ++i) writePixelPreclipped(x + i, y + j, color);
+  }
+
+  void writePixel(int32_t x, int32_t y, uint16_t color) {
+    if (x >= 0 && y >= 0 && x < _width && y < _height) writePixelPreclipped(x, y, color);
+  }
+  void drawPixel(int32_t x, int32_t y, uint16_t color) { writePixel(x, y, color); }
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    int32_t x1 = x + w, y1 = y + h;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 > _width) x1 = _width;
+    if (y1 > _height) y1 = _height;
+    if (x1 > x && y1 > y) writeFillRectPreclipped(x, y, x1 - x, y1 - y, color);
+  }
+  void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint16_t color) { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint16_t color) { fillRect(x, y, 1, h, color); }
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color); drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color); drawFastVLine(x + w - 1, y, h, color);
+  }
+  // Shapes only need to touch the right pixels for the tests: bounding boxes
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t, uint16_t color) { fillRect(x, y, w, h, color); }
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t, uint16_t color) { drawRect(x, y, w, h, color); }
+  void fillCircle(int32_t x, int32_t y, int32_t r, uint16_t color) { fillRect(x - r, y - r, 2 * r + 1, 2 * r + 1, color); }
+  void drawCircle(int32_t x, int32_t y, int32_t r, uint16_t color) { drawRect(x - r, y - r, 2 * r + 1, 2 * r + 1, color); }
+  void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t color) {
+    int32_t xa = std::min(x0, std::min(x1, x2)), xb = std::max(x0, std::max(x1, x2));
+    int32_t ya = std::min(y0, std::min(y1, y2)), yb = std::max(y0, std::max(y1, y2));
+    fillRect(xa, ya, xb - xa + 1, yb - ya + 1, color);
+  }
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color) {
+    int32_t dx = std::abs(x1 - x0), dy = -std::abs(y1 - y0), sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1, err = dx + dy;
+    for (;;) {
+      writePixel(x0, y0, color);
+      if (x0 == x1 && y0 == y1) break;
+      int32_t e2 = 2 * err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+  }
+
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) override {
+    for (int16_t j = 0; j < h; ++j) for (int16_t i = 0; i < w; ++i) writePixel(x + i, y + j, bitmap[(int32_t)j * w + i]);
+  }
+  // 1-bit mask, rows padded to whole bytes, MSB first
+  virtual void draw16bitRGBBitmapWithMask(int16_t x, int16_t y, uint16_t* bitmap, uint8_t* mask, int16_t w, int16_t h) {
+    const int32_t pitch = (w + 7) / 8;
+    for (int16_t j = 0; j < h; ++j)
+      for (int16_t i = 0; i < w; ++i)
+        if (mask[j * pitch + i / 8] & (0x80 >> (i & 7))) writePixel(x + i, y + j, bitmap[(int32_t)j * w + i]);
+  }
+};
+
+class Arduino_Canvas : public Arduino_GFX {
+public:
+  Arduino_Canvas(int16_t w, int16_t h, Arduino_G* output, int16_t = 0, int16_t = 0, uint8_t = 0)
+    : Arduino_GFX(w, h), _output(output) {}
+  ~Arduino_Canvas() override { free(_framebuffer); }
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED) override {
+    if (speed != GFX_SKIP_OUTPUT_BEGIN && _output && !_output->begin(speed)) return false;
+    if (!_framebuffer) _framebuffer = (uint16_t*)calloc((size_t)_width * _height, sizeof(uint16_t));
+    return _framebuffer != nullptr;
+  }
+  uint16_t* getFramebuffer() { return _framebuffer; }
+  void flush() { if (_output) _output->draw16bitRGBBitmap(0, 0, _framebuffer, _width, _height); }
+
+  void writePixelPreclipped(int32_t x, int32_t y, uint16_t color) override { _framebuffer[(int32_t)y * _width + x] = color; }
+  void writeFillRectPreclipped(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) override {
+    for (int32_t j = 0; j < h; ++j) {
+      uint16_t* row = _framebuffer + (int32_t)(y + j) * _width + x;
+      for (int32_t i = 0; i < w; ++i) row[i] = color;
+    }
+  }
+  using Arduino_GFX::draw16bitRGBBitmap;
+
+protected:
+  uint16_t* _framebuffer = nullptr;
+  Arduino_G* _output = nullptr;
+};
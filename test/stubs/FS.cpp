@@ -0,0 +1,96 @@
+#include "FS.h"
+#include "SPIFFS.h"
+#include <map>
+#include <mutex>
+#include <string>
+
+fs::SPIFFSFS SPIFFS;
+
+namespace fs {
+
+struct HostFile {
+  std::mutex m;
+  std::vector<uint8_t> data;
+};
+
+namespace {
+
+std::mutex g_mtx;
+
+std::map<std::string, std::shared_ptr<HostFile>>& files() {
+  static std::map<std::string, std::shared_ptr<HostFile>> m;
+  return m;
+}
+
+} // namespace
+
+size_t File::size() const {
+  if (!f_) return 0;
+  std::lock_guard<std::mutex> lock(f_->m);
+  return f_->data.size();
+}
+
+bool File::seek(uint32_t pos) {
+  if (!f_ || pos > size()) return false;
+  pos_ = pos;
+  return true;
+}
+
+size_t File::read(uint8_t* buf, size_t n) {
+  if (!f_ || write_) return 0;
+  std::lock_guard<std::mutex> lock(f_->m);
+  if (pos_ >= f_->data.size()) return 0;
+  if (n > f_->data.size() - pos_) n = f_->data.size() - pos_;
+  memcpy(buf, f_->data.data() + pos_, n);
+  pos_ += n;
+  return n;
+}
+
+int File::read() {
+  uint8_t b = 0;
+  return read(&b, 1) ? b : -1;
+}
+
+size_t File::write(const uint8_t* buf, size_t n) {
+  if (!f_ || !write_) return 0;
+  std::lock_guard<std::mutex> lock(f_->m);
+  f_->data.insert(f_->data.end(), buf, buf + n);
+  pos_ = f_->data.size();
+  return n;
+}
+
+File FS::open(const char* path, const char* mode) {
+  std::lock_guard<std::mutex> lock(g_mtx);
+  auto it = files().find(path);
+  if (mode[0] == 'r') return it == files().end() ? File() : File(it->second, false);
+  // Writers get a fresh file ("w") or the existing one ("a"); open readers keep theirs
+  if (mode[0] == 'w' || it == files().end()) {
+    auto f = std::make_shared<HostFile>();
+    files()[path] = f;
+    return File(f, true);
+  }
+  File f(it->second, true);
+  f.seek((uint32_t)f.size());
+  return f;
+}
+
+bool FS::exists(const char* path) {
+  std::lock_guard<std::mutex> lock(g_mtx);
+  return files().count(path) != 0;
+}
+
+bool FS::remove(const char* path) {
+  std::lock_guard<std::mutex> lock(g_mtx);
+  return files().erase(path) != 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+  std::lock_guard<std::mutex> lock(g_mtx);
+  auto it = files().find(from);
+  if (it == files().end()) return false;
+  files()[to] = it->second;
+  files().erase(it);
+  return true;
+}
+
+} // namespace fs
@@ -0,0 +1,51 @@
+#pragma once
+// Host stand-in for the Arduino FS File API over an in-memory file table
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+struct HostFile;
+
+class File {
+public:
+  File() = default;
+  explicit File(std::shared_ptr<HostFile> f, bool write) : f_(std::move(f)), write_(write) {}
+
+  explicit operator bool() const { return (bool)f_; }
+  size_t size() const;
+  size_t position() const { return pos_; }
+  int available() const { return (int)(size() - pos_); }
+  bool seek(uint32_t pos);
+  size_t read(uint8_t* buf, size_t n);
+  int read();
+  size_t write(const uint8_t* buf, size_t n);
+  size_t write(uint8_t b) { return write(&b, 1); }
+  void flush() {}
+  void close() { f_.reset(); }
+
+private:
+  std::shared_ptr<HostFile> f_;
+  bool write_ = false;
+  size_t pos_ = 0;
+};
+
+class FS {
+public:
+  File open(const char* path, const char* mode = FILE_READ);
+  File open(const String& path, const char* mode = FILE_READ) { return open(path.c_str(), mode); }
+  bool exists(const char* path);
+  bool exists(const String& path) { return exists(path.c_str()); }
+  bool remove(const char* path);
+  bool remove(const String& path) { return remove(path.c_str()); }
+  bool rename(const char* from, const char* to);
+};
+
+} // namespace fs
+
+using fs::File;
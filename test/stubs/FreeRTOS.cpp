@@ -0,0 +1,83 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+// Waits for pred under lock; false when ticks ran out first
+template <class Lock, class Pred>
+bool waitFor(std::condition_variable& cv, Lock& lock, TickType_t ticks, Pred pred) {
+  if (ticks == portMAX_DELAY) { cv.wait(lock, pred); return true; }
+  return cv.wait_for(lock, std::chrono::milliseconds(ticks), pred);
+}
+
+} // namespace
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t, void* arg, UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+  std::thread(fn, arg).detach();
+  if (handle) *handle = nullptr;
+  return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  SemaphoreHandle_t s = new HostSemaphore();
+  s->count = s->max = 1;
+  return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) {
+  SemaphoreHandle_t s = new HostSemaphore();
+  s->max = max; s->count = initial;
+  return s;
+}
+
+// Binary semaphores start empty
+SemaphoreHandle_t xSemaphoreCreateBinary() { return xSemaphoreCreateCounting(1, 0); }
+
+void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(s->m);
+  if (!waitFor(s->cv, lock, ticks, [&] { return s->count > 0; })) return pdFALSE;
+  --s->count;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  std::lock_guard<std::mutex> lock(s->m);
+  if (s->count >= s->max) return pdFALSE;
+  ++s->count;
+  s->cv.notify_one();
+  return pdTRUE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  QueueHandle_t q = new HostQueue();
+  q->length = length; q->itemSize = itemSize;
+  return q;
+}
+
+void vQueueDelete(QueueHandle_t q) { delete q; }
+
+BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(q->m);
+  if (!waitFor(q->cv, lock, ticks, [&] { return q->items.size() < q->length; })) return pdFALSE;
+  const uint8_t* p = (const uint8_t*)item;
+  q->items.emplace_back(p, p + q->itemSize);
+  q->cv.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(q->m);
+  if (!waitFor(q->cv, lock, ticks, [&] { return !q->items.empty(); })) return pdFALSE;
+  memcpy(item, q->items.front().data(), q->itemSize);
+  q->items.pop_front();
+  q->cv.notify_all();
+  return pdTRUE;
+}
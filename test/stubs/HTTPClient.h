@@ -0,0 +1,5 @@
+#pragma once
+// Host stand-in for arduino-esp32's HTTPClient header: sonos.h includes it, but no
+// source built for the host tests talks HTTP through it (Downloader uses WiFiClient).
+#include <Arduino.h>
+#include "WiFiClient.h"
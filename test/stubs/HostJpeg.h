@@ -0,0 +1,43 @@
+#pragma once
+// libjpeg(-turbo) session shared by the tjpgd and JPEGDEC stand-ins: decodes from
+// memory to RGB565 in native (little-endian) order without fancy upsampling, like the
+// embedded decoders. Corrupt or truncated data is an error, not a libjpeg warning.
+#include <csetjmp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <jpeglib.h>
+
+struct HostJpeg {
+  jpeg_decompress_struct cinfo;
+  struct Err {
+    jpeg_error_mgr mgr;
+    jmp_buf jump;
+  } err;
+  bool open = false;
+
+  HostJpeg() {
+    cinfo.err = jpeg_std_error(&err.mgr);
+    err.mgr.error_exit = [](j_common_ptr c) { longjmp(((Err*)c->err)->jump, 1); };
+    // Warnings are corrupt data (bad Huffman code, premature end): fail like tjpgd
+    err.mgr.emit_message = [](j_common_ptr c, int level) { if (level < 0) longjmp(((Err*)c->err)->jump, 1); };
+    jpeg_create_decompress(&cinfo);
+    open = true;
+  }
+  ~HostJpeg() { if (open) jpeg_destroy_decompress(&cinfo); }
+  HostJpeg(const HostJpeg&) = delete;
+  HostJpeg& operator=(const HostJpeg&) = delete;
+
+  // Call inside `if (setjmp(err.jump) == 0)`
+  void readHeader(const uint8_t* d, size_t n) {
+    jpeg_mem_src(&cinfo, d, (unsigned long)n);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB565;
+    cinfo.dither_mode = JDITHER_NONE;
+    cinfo.do_fancy_upsampling = FALSE;
+    cinfo.dct_method = JDCT_ISLOW;
+  }
+
+  int mcuW() const { return cinfo.num_components == 1 ? 8 : 8 * cinfo.max_h_samp_factor; }
+  int mcuH() const { return cinfo.num_components == 1 ? 8 : 8 * cinfo.max_v_samp_factor; }
+};
@@ -0,0 +1,29 @@
+#pragma once
+// Host stand-in for arduino-esp32's IPv4 IPAddress
+#include <Arduino.h>
+
+class IPAddress {
+public:
+  IPAddress() = default;
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : b_{a, b, c, d} {}
+
+  bool fromString(const char* s) {
+    unsigned v[4];
+    char tail;
+    if (!s || sscanf(s, "%u.%u.%u.%u%c", &v[0], &v[1], &v[2], &v[3], &tail) != 4) return false;
+    for (int i = 0; i < 4; ++i) { if (v[i] > 255) return false; b_[i] = (uint8_t)v[i]; }
+    return true;
+  }
+  bool fromString(const String& s) { return fromString(s.c_str()); }
+  String toString() const {
+    char s[16];
+    snprintf(s, sizeof s, "%u.%u.%u.%u", b_[0], b_[1], b_[2], b_[3]);
+    return String(s);
+  }
+  uint8_t operator[](int i) const { return b_[i]; }
+  bool operator==(const IPAddress& o) const { return memcmp(b_, o.b_, 4) == 0; }
+  bool operator!=(const IPAddress& o) const { return !(*this == o); }
+
+private:
+  uint8_t b_[4] = {0, 0, 0, 0};
+};
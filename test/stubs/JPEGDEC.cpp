@@ -0,0 +1,57 @@
+#include "JPEGDEC.h"
+#include "HostJpeg.h"
+#include <cstring>
+#include <vector>
+
+JPEGDEC::JPEGDEC() = default;
+JPEGDEC::~JPEGDEC() = default;
+
+int JPEGDEC::openRAM(uint8_t* pData, int iDataSize, JPEG_DRAW_CALLBACK* pfnDraw) {
+  data_ = pData; len_ = iDataSize; draw_ = pfnDraw;
+  err_ = JPEG_SUCCESS;
+  HostJpeg j;
+  if (setjmp(j.err.jump) != 0) { err_ = JPEG_INVALID_FILE; return 0; }
+  j.readHeader(pData, (size_t)iDataSize);
+  if (j.cinfo.num_components != 1 && j.cinfo.num_components != 3) { err_ = JPEG_UNSUPPORTED_FEATURE; return 0; }
+  w_ = (int)j.cinfo.image_width; h_ = (int)j.cinfo.image_height;
+  mcuW_ = j.mcuW(); mcuH_ = j.mcuH();
+  cx_ = 0; cy_ = 0; cw_ = w_; ch_ = h_;
+  return 1;
+}
+
+void JPEGDEC::setCropArea(int x, int y, int w, int h) {
+  // Widened to whole MCUs, like the library
+  int x1 = x + w, y1 = y + h;
+  x = x / mcuW_ * mcuW_; y = y / mcuH_ * mcuH_;
+  x1 = (x1 + mcuW_ - 1) / mcuW_ * mcuW_; y1 = (y1 + mcuH_ - 1) / mcuH_ * mcuH_;
+  cx_ = x < 0 ? 0 : x; cy_ = y < 0 ? 0 : y;
+  cw_ = (x1 > w_ ? w_ : x1) - cx_; ch_ = (y1 > h_ ? h_ : y1) - cy_;
+}
+
+int JPEGDEC::decode(int, int, int) {
+  if (!data_ || !draw_ || pixelType_ != RGB565_LITTLE_ENDIAN) { err_ = JPEG_INVALID_PARAMETER; return 0; }
+  HostJpeg j;
+  std::vector<uint16_t> block;
+  if (setjmp(j.err.jump) != 0) { err_ = JPEG_DECODE_ERROR; return 0; }
+  j.readHeader(data_, (size_t)len_);
+  jpeg_start_decompress(&j.cinfo);
+  JDIMENSION xoff = (JDIMENSION)cx_, width = (JDIMENSION)cw_;
+  if (cx_ > 0 || cw_ < w_) jpeg_crop_scanline(&j.cinfo, &xoff, &width); // may widen to the iMCU
+  if (cy_ > 0) jpeg_skip_scanlines(&j.cinfo, (JDIMENSION)cy_);
+  const int bw = (int)width;
+  block.resize((size_t)bw * mcuH_);
+  for (int y = cy_; y < cy_ + ch_; y += mcuH_) {
+    const int bh = cy_ + ch_ - y < mcuH_ ? cy_ + ch_ - y : mcuH_;
+    for (int r = 0; r < bh;) {
+      JSAMPROW row = (JSAMPROW)&block[(size_t)r * bw];
+      r += (int)jpeg_read_scanlines(&j.cinfo, &row, 1);
+    }
+    JPEGDRAW d{(int)xoff, y, bw, bh, bw, 16, block.data(), user_};
+    if (!draw_(&d)) { jpeg_abort_decompress(&j.cinfo); return 0; }
+  }
+  if (cy_ + ch_ < h_) jpeg_skip_scanlines(&j.cinfo, (JDIMENSION)(h_ - cy_ - ch_));
+  jpeg_finish_decompress(&j.cinfo);
+  return 1;
+}
+
+void JPEGDEC::close() { data_ = nullptr; len_ = 0; }
@@ -0,0 +1,58 @@
+#pragma once
+// Host stand-in for bitbank2/JPEGDEC, backed by libjpeg. Covers what JpegdecBackend
+// uses: openRAM(), decode() with one draw call per MCU row, RGB565 little-endian
+// output, the user pointer and an MCU-aligned crop area whose rows and columns are
+// skipped (draw coordinates are image-relative). Unlike the library, progressive
+// files decode completely instead of their DC scan only.
+#include <cstdint>
+#include <memory>
+
+enum {
+  JPEG_SUCCESS = 0,
+  JPEG_INVALID_PARAMETER,
+  JPEG_DECODE_ERROR,
+  JPEG_UNSUPPORTED_FEATURE,
+  JPEG_INVALID_FILE,
+};
+
+enum { RGB565_LITTLE_ENDIAN = 0, RGB565_BIG_ENDIAN };
+
+struct JPEGDRAW {
+  int x, y;           // image position of the block
+  int iWidth, iHeight;
+  int iWidthUsed;
+  int iBpp;
+  uint16_t* pPixels;
+  void* pUser;
+};
+
+typedef int(JPEG_DRAW_CALLBACK)(JPEGDRAW* pDraw);
+
+struct HostJpeg;
+
+class JPEGDEC {
+public:
+  JPEGDEC();
+  ~JPEGDEC();
+
+  int openRAM(uint8_t* pData, int iDataSize, JPEG_DRAW_CALLBACK* pfnDraw);
+  int decode(int x, int y, int iOptions);
+  void close();
+  int getWidth() const { return w_; }
+  int getHeight() const { return h_; }
+  int getLastError() const { return err_; }
+  void setPixelType(int type) { pixelType_ = type; }
+  void setUserPointer(void* p) { user_ = p; }
+  void setCropArea(int x, int y, int w, int h);
+  void getCropArea(int* x, int* y, int* w, int* h) const { *x = cx_; *y = cy_; *w = cw_; *h = ch_; }
+
+private:
+  const uint8_t* data_ = nullptr;
+  int len_ = 0;
+  JPEG_DRAW_CALLBACK* draw_ = nullptr;
+  void* user_ = nullptr;
+  int w_ = 0, h_ = 0, mcuW_ = 8, mcuH_ = 8;
+  int cx_ = 0, cy_ = 0, cw_ = 0, ch_ = 0;
+  int pixelType_ = RGB565_LITTLE_ENDIAN;
+  int err_ = JPEG_SUCCESS;
+};
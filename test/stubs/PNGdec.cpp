@@ -0,0 +1,159 @@
+#include "PNGdec.h"
+#include <cstdlib>
+#include <cstring>
+#include <zlib.h>
+
+namespace {
+
+uint32_t be32(const uint8_t* p) { return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]; }
+
+int channels(int type) {
+  switch (type) {
+    case PNG_PIXEL_GRAYSCALE: case PNG_PIXEL_INDEXED: return 1;
+    case PNG_PIXEL_GRAY_ALPHA: return 2;
+    case PNG_PIXEL_TRUECOLOR: return 3;
+    case PNG_PIXEL_TRUECOLOR_ALPHA: return 4;
+    default: return 0;
+  }
+}
+
+uint8_t paeth(int a, int b, int c) {
+  const int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+  return (uint8_t)(pa <= pb && pa <= pc ? a : pb <= pc ? b : c);
+}
+
+// In-place reversal of the row filter; prev is the previous unfiltered row (or zeros)
+bool unfilter(uint8_t f, uint8_t* row, const uint8_t* prev, int n, int bpp) {
+  for (int i = 0; i < n; ++i) {
+    const int a = i >= bpp ? row[i - bpp] : 0, b = prev[i], c = i >= bpp ? prev[i - bpp] : 0;
+    switch (f) {
+      case 0: break;
+      case 1: row[i] += a; break;
+      case 2: row[i] += b; break;
+      case 3: row[i] += (uint8_t)((a + b) >> 1); break;
+      case 4: row[i] += paeth(a, b, c); break;
+      default: return false;
+    }
+  }
+  return true;
+}
+
+uint16_t pack565(int r, int g, int b) { return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)); }
+
+} // namespace
+
+int PNG::openRAM(uint8_t* d, int n, PNG_DRAW_CALLBACK* pfnDraw) {
+  static const uint8_t kSig[8] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A};
+  close();
+  draw_ = pfnDraw;
+  if (!d || n < 8 || memcmp(d, kSig, 8) != 0) return err_ = PNG_INVALID_FILE;
+  bool header = false;
+  for (int p = 8; p + 12 <= n;) {
+    const uint32_t len = be32(d + p);
+    const uint8_t* type = d + p + 4;
+    const uint8_t* body = d + p + 8;
+    if (len > (uint32_t)(n - p - 12)) return err_ = PNG_INVALID_FILE;
+    if (!memcmp(type, "IHDR", 4) && len >= 13) {
+      w_ = (int)be32(body); h_ = (int)be32(body + 4);
+      type_ = body[9];
+      if (body[8] != 8 || !channels(type_) || body[10] || body[11]) return err_ = PNG_UNSUPPORTED_FEATURE;
+      if (body[12]) return err_ = PNG_UNSUPPORTED_FEATURE;   // Adam7
+      bpp_ = 8 * channels(type_);
+      alpha_ = type_ == PNG_PIXEL_GRAY_ALPHA || type_ == PNG_PIXEL_TRUECOLOR_ALPHA;
+      header = true;
+    } else if (!memcmp(type, "PLTE", 4)) {
+      for (uint32_t i = 0; i < len / 3 && i < 256; ++i) memcpy(&palette_[i * 3], body + i * 3, 3);
+    } else if (!memcmp(type, "tRNS", 4) && type_ == PNG_PIXEL_INDEXED) {
+      for (uint32_t i = 0; i < len && i < 256; ++i) palette_[768 + i] = body[i];
+      alpha_ = 1;
+    } else if (!memcmp(type, "IDAT", 4)) {
+      idat_.insert(idat_.end(), body, body + len);
+    } else if (!memcmp(type, "IEND", 4)) {
+      break;
+    }
+    p += 12 + (int)len;
+  }
+  if (!header || w_ <= 0 || h_ <= 0 || idat_.empty()) return err_ = PNG_INVALID_FILE;
+  return err_ = PNG_SUCCESS;
+}
+
+int PNG::decode(void* pUser, int) {
+  if (err_ != PNG_SUCCESS || !draw_) return err_ ? err_ : PNG_INVALID_PARAMETER;
+  const int pixBytes = channels(type_);
+  const int pitch = w_ * pixBytes;
+  std::vector<uint8_t> raw((size_t)(pitch + 1) * h_);
+  uLongf rawLen = (uLongf)raw.size();
+  if (uncompress(raw.data(), &rawLen, idat_.data(), (uLong)idat_.size()) != Z_OK || rawLen != raw.size())
+    return err_ = PNG_DECODE_ERROR;
+
+  std::vector<uint8_t> zeros((size_t)pitch, 0);
+  const uint8_t* prev = zeros.data();
+  PNGDRAW draw = {};
+  draw.pUser = pUser;
+  draw.iWidth = w_;
+  draw.iPitch = pitch;
+  draw.iPixelType = type_;
+  draw.iBpp = 8;
+  draw.iHasAlpha = alpha_;
+  draw.pPalette = palette_;
+  for (int y = 0; y < h_; ++y) {
+    uint8_t* row = &raw[(size_t)y * (pitch + 1)];
+    if (!unfilter(row[0], row + 1, prev, pitch, pixBytes)) return err_ = PNG_DECODE_ERROR;
+    draw.y = y;
+    draw.pPixels = row + 1;
+    if (!draw_(&draw)) return err_ = PNG_QUIT_EARLY;
+    prev = row + 1;
+  }
+  return PNG_SUCCESS;
+}
+
+void PNG::close() {
+  idat_.clear();
+  memset(palette_, 0, 768);
+  memset(palette_ + 768, 0xFF, 256);   // opaque unless tRNS says otherwise
+  w_ = h_ = bpp_ = type_ = alpha_ = 0;
+  err_ = PNG_SUCCESS;
+}
+
+void PNG::getLineAsRGB565(PNGDRAW* pDraw, uint16_t* out, int iEndianness, uint32_t u32Bkgd) {
+  const int br = (u32Bkgd >> 16) & 0xFF, bg = (u32Bkgd >> 8) & 0xFF, bb = u32Bkgd & 0xFF;
+  const uint8_t* s = pDraw->pPixels;
+  const uint8_t* pal = pDraw->pPalette;
+  for (int x = 0; x < pDraw->iWidth; ++x) {
+    int r, g, b, a = 255;
+    switch (pDraw->iPixelType) {
+      case PNG_PIXEL_GRAYSCALE: r = g = b = s[x]; break;
+      case PNG_PIXEL_GRAY_ALPHA: r = g = b = s[x * 2]; a = s[x * 2 + 1]; break;
+      case PNG_PIXEL_TRUECOLOR: r = s[x * 3]; g = s[x * 3 + 1]; b = s[x * 3 + 2]; break;
+      case PNG_PIXEL_INDEXED:
+        r = pal[s[x] * 3]; g = pal[s[x] * 3 + 1]; b = pal[s[x] * 3 + 2];
+        if (pDraw->iHasAlpha) a = pal[768 + s[x]];
+        break;
+      default: r = s[x * 4]; g = s[x * 4 + 1]; b = s[x * 4 + 2]; a = s[x * 4 + 3]; break;
+    }
+    if (a == 0) { r = br; g = bg; b = bb; }
+    else if (a != 255) {
+      r = (r * a + br * (255 - a)) >> 8;
+      g = (g * a + bg * (255 - a)) >> 8;
+      b = (b * a + bb * (255 - a)) >> 8;
+    }
+    const uint16_t p = pack565(r, g, b);
+    out[x] = iEndianness == PNG_RGB565_BIG_ENDIAN ? (uint16_t)((p >> 8) | (p << 8)) : p;
+  }
+}
+
+uint8_t PNG::getAlphaMask(PNGDRAW* pDraw, uint8_t* pMask, uint8_t ucThreshold) {
+  if (!pDraw->iHasAlpha) return 0;
+  const uint8_t* s = pDraw->pPixels;
+  memset(pMask, 0, (size_t)(pDraw->iWidth + 7) / 8);
+  for (int x = 0; x < pDraw->iWidth; ++x) {
+    int a;
+    switch (pDraw->iPixelType) {
+      case PNG_PIXEL_GRAY_ALPHA: a = s[x * 2 + 1]; break;
+      case PNG_PIXEL_INDEXED: a = pDraw->pPalette[768 + s[x]]; break;
+      default: a = s[x * 4 + 3]; break;
+    }
+    if (a >= ucThreshold) pMask[x >> 3] |= (uint8_t)(0x80 >> (x & 7));
+  }
+  return 1;
+}
@@ -0,0 +1,69 @@
+#pragma once
+// Host stand-in for bitbank2/PNGdec, backed by zlib. Covers what PngBackend uses:
+// openRAM(), decode() with one draw callback per row, getLineAsRGB565() and the
+// header getters, plus getAlphaMask() for the old icon path in icon_test. 8-bit non-interlaced images only (gray, RGB, palette, +alpha);
+// alpha is blended over the background the way PNGdec does it (>> 8, a = 0 and
+// a = 255 exact).
+#include <cstdint>
+#include <vector>
+
+enum {
+  PNG_SUCCESS = 0,
+  PNG_INVALID_PARAMETER,
+  PNG_DECODE_ERROR,
+  PNG_MEM_ERROR,
+  PNG_NO_BUFFER,
+  PNG_UNSUPPORTED_FEATURE,
+  PNG_INVALID_FILE,
+  PNG_TOO_BIG,
+  PNG_QUIT_EARLY,
+};
+
+enum {
+  PNG_PIXEL_GRAYSCALE = 0,
+  PNG_PIXEL_TRUECOLOR = 2,
+  PNG_PIXEL_INDEXED = 3,
+  PNG_PIXEL_GRAY_ALPHA = 4,
+  PNG_PIXEL_TRUECOLOR_ALPHA = 6,
+};
+
+#define PNG_RGB565_LITTLE_ENDIAN 0
+#define PNG_RGB565_BIG_ENDIAN 1
+
+struct PNGDRAW {
+  void* pUser;
+  int y;
+  int iWidth;
+  int iPitch;
+  int iPixelType;
+  int iBpp;
+  int iHasAlpha;
+  uint8_t* pPixels;
+  uint8_t* pPalette;   // 256 RGB entries, then 256 alpha values
+};
+
+typedef int(PNG_DRAW_CALLBACK)(PNGDRAW*);
+
+class PNG {
+public:
+  int openRAM(uint8_t* pData, int iDataSize, PNG_DRAW_CALLBACK* pfnDraw);
+  int decode(void* pUser, int iOptions);
+  void close();
+
+  int getWidth() const { return w_; }
+  int getHeight() const { return h_; }
+  int getBpp() const { return bpp_; }
+  int hasAlpha() const { return alpha_; }
+  int getPixelType() const { return type_; }
+  int getLastError() const { return err_; }
+
+  void getLineAsRGB565(PNGDRAW* pDraw, uint16_t* pPixels, int iEndianness, uint32_t u32Bkgd);
+  // One bit per pixel, MSB first, set where alpha >= ucThreshold; 0 without alpha
+  uint8_t getAlphaMask(PNGDRAW* pDraw, uint8_t* pMask, uint8_t ucThreshold);
+
+private:
+  PNG_DRAW_CALLBACK* draw_ = nullptr;
+  std::vector<uint8_t> idat_;
+  uint8_t palette_[256 * 4] = {};
+  int w_ = 0, h_ = 0, bpp_ = 0, type_ = 0, alpha_ = 0, err_ = PNG_SUCCESS;
+};
@@ -0,0 +1,75 @@
+#include "TJpg_Decoder.h"
+#include "HostJpeg.h"
+#include <cstring>
+#include <vector>
+
+namespace {
+
+struct TjpgHost {
+  std::vector<uint8_t> data;
+  HostJpeg jpeg;
+};
+
+} // namespace
+
+JRESULT jd_prepare(JDEC* jd, size_t (*infunc)(JDEC*, uint8_t*, size_t), void* pool, size_t sz_pool, void* dev) {
+  if (!jd || !infunc || !pool) return JDR_PAR;
+  if (sz_pool < 3100) return JDR_MEM1; // tjpgd's minimum work area
+  memset(jd, 0, sizeof *jd);
+  jd->device = dev;
+  TjpgHost* h = new TjpgHost();
+  uint8_t buf[512];
+  size_t n;
+  while ((n = infunc(jd, buf, sizeof buf)) > 0) h->data.insert(h->data.end(), buf, buf + n);
+
+  JRESULT rc = JDR_OK;
+  if (setjmp(h->jpeg.err.jump) == 0) {
+    h->jpeg.readHeader(h->data.data(), h->data.size());
+    const jpeg_decompress_struct& ci = h->jpeg.cinfo;
+    if (ci.progressive_mode || ci.arith_code) rc = JDR_FMT3;
+    else if (ci.num_components != 1 && ci.num_components != 3) rc = JDR_FMT3;
+    else if (ci.data_precision != 8) rc = JDR_FMT3;
+  } else {
+    rc = h->data.size() < 4 || h->data[0] != 0xFF || h->data[1] != 0xD8 ? JDR_FMT1 : JDR_INP;
+  }
+  if (rc != JDR_OK) { delete h; return rc; }
+  jd->width = (uint16_t)h->jpeg.cinfo.image_width;
+  jd->height = (uint16_t)h->jpeg.cinfo.image_height;
+  jd->msx = (uint8_t)(h->jpeg.mcuW() / 8);
+  jd->msy = (uint8_t)(h->jpeg.mcuH() / 8);
+  jd->ncomp = (uint8_t)h->jpeg.cinfo.num_components;
+  jd->host = h;
+  return JDR_OK;
+}
+
+JRESULT jd_decomp(JDEC* jd, int (*outfunc)(JDEC*, void*, JRECT*), uint8_t scale) {
+  if (!jd || !jd->host || !outfunc || scale != 0) return JDR_PAR;
+  TjpgHost* h = (TjpgHost*)jd->host;
+  jd->host = nullptr;
+  jpeg_decompress_struct& ci = h->jpeg.cinfo;
+  const int mw = jd->msx * 8, mh = jd->msy * 8, w = jd->width, hgt = jd->height;
+  std::vector<uint16_t> rows((size_t)w * mh);
+  std::vector<uint16_t> mcu((size_t)mw * mh);
+  JRESULT rc = JDR_OK;
+  if (setjmp(h->jpeg.err.jump) == 0) {
+    jpeg_start_decompress(&ci);
+    for (int y = 0; y < hgt && rc == JDR_OK; y += mh) {
+      const int bh = hgt - y < mh ? hgt - y : mh;
+      for (int r = 0; r < bh;) {
+        JSAMPROW row = (JSAMPROW)&rows[(size_t)r * w];
+        r += (int)jpeg_read_scanlines(&ci, &row, 1);
+      }
+      for (int x = 0; x < w; x += mw) {
+        const int bw = w - x < mw ? w - x : mw;
+        for (int r = 0; r < bh; ++r) memcpy(&mcu[(size_t)r * bw], &rows[(size_t)r * w + x], (size_t)bw * 2);
+        JRECT rect{(uint16_t)x, (uint16_t)(x + bw - 1), (uint16_t)y, (uint16_t)(y + bh - 1)};
+        if (!outfunc(jd, mcu.data(), &rect)) { rc = JDR_INTR; break; }
+      }
+    }
+    if (rc == JDR_OK) jpeg_finish_decompress(&ci);
+  } else {
+    rc = JDR_FMT1;
+  }
+  delete h;
+  return rc;
+}
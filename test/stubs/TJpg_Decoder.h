@@ -0,0 +1,36 @@
+#pragma once
+// Host stand-in for the tjpgd core that TJpg_Decoder bundles (jd_prepare/jd_decomp),
+// backed by libjpeg. Like tjpgd it reads the stream through the input function,
+// rejects progressive and CMYK files, emits RGB565 one MCU per output call in
+// raster order, and stops with JDR_INTR when the output function returns 0. The
+// work pool is not used; the decoder state is freed when jd_decomp returns.
+#include <cstddef>
+#include <cstdint>
+
+typedef enum {
+  JDR_OK = 0,
+  JDR_INTR,
+  JDR_INP,
+  JDR_MEM1,
+  JDR_MEM2,
+  JDR_PAR,
+  JDR_FMT1,
+  JDR_FMT2,
+  JDR_FMT3,
+} JRESULT;
+
+typedef struct {
+  uint16_t left, right, top, bottom;
+} JRECT;
+
+typedef struct JDEC JDEC;
+struct JDEC {
+  uint16_t width, height;
+  uint8_t msx, msy;   // MCU size in blocks
+  uint8_t ncomp;
+  void* device;
+  void* host;         // stand-in state between jd_prepare and jd_decomp
+};
+
+JRESULT jd_prepare(JDEC* jd, size_t (*infunc)(JDEC*, uint8_t*, size_t), void* pool, size_t sz_pool, void* dev);
+JRESULT jd_decomp(JDEC* jd, int (*outfunc)(JDEC*, void*, JRECT*), uint8_t scale);
@@ -0,0 +1,33 @@
+#pragma once
+// Host stand-in for the WiFi object: only the resolver. Every host name resolves to
+// the loopback address and WiFi.mapPort() redirects a well-known port to a test
+// server's, so a server on 127.0.0.1 can play any CDN under its real URLs. Names
+// listed with WiFi.failLookups() fail like a resolver hiccup.
+#include <Arduino.h>
+#include <map>
+#include <set>
+#include <string>
+#include "IPAddress.h"
+
+class WiFiClass {
+public:
+  int hostByName(const char* host, IPAddress& ip) {
+    ++lookups;
+    if (failing_.count(host)) return 0;
+    if (ip.fromString(host)) return 1;
+    ip = IPAddress(127, 0, 0, 1);
+    return 1;
+  }
+
+  // Test hooks
+  void failLookups(const char* host, bool fail = true) { if (fail) failing_.insert(host); else failing_.erase(host); }
+  void mapPort(uint16_t port, uint16_t to) { ports_[port] = to; }
+  uint16_t portFor(uint16_t port) const { auto it = ports_.find(port); return it == ports_.end() ? port : it->second; }
+  unsigned lookups = 0;
+
+private:
+  std::set<std::string> failing_;
+  std::map<uint16_t, uint16_t> ports_;
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,92 @@
+#include "WiFiClient.h"
+#include "WiFi.h"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+int WiFiClient::connect(IPAddress ip, uint16_t port, int32_t timeoutMs) {
+  stop();
+  fd_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd_ < 0) return 0;
+  sockaddr_in a{};
+  a.sin_family = AF_INET;
+  a.sin_port = htons(WiFi.portFor(port));
+  a.sin_addr.s_addr = htonl(((uint32_t)ip[0] << 24) | ((uint32_t)ip[1] << 16) | ((uint32_t)ip[2] << 8) | ip[3]);
+  fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) | O_NONBLOCK);
+  if (::connect(fd_, (sockaddr*)&a, sizeof a) != 0) {
+    pollfd p{fd_, POLLOUT, 0};
+    int err = 0;
+    socklen_t len = sizeof err;
+    if (errno != EINPROGRESS || poll(&p, 1, timeoutMs) != 1 ||
+        getsockopt(fd_, SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) {
+      stop();
+      return 0;
+    }
+  }
+  return 1;
+}
+
+int WiFiClient::connect(const char* host, uint16_t port, int32_t timeoutMs) {
+  IPAddress ip;
+  if (WiFi.hostByName(host, ip) != 1) return 0;
+  return connect(ip, port, timeoutMs);
+}
+
+size_t WiFiClient::write(const uint8_t* buf, size_t n) {
+  size_t done = 0;
+  while (fd_ >= 0 && done < n) {
+    ssize_t w = send(fd_, buf + done, n - done, MSG_NOSIGNAL);
+    if (w > 0) { done += (size_t)w; continue; }
+    if (w < 0 && errno == EAGAIN) {
+      pollfd p{fd_, POLLOUT, 0};
+      poll(&p, 1, 1000);
+      continue;
+    }
+    break;
+  }
+  return done;
+}
+
+int WiFiClient::available() {
+  if (fd_ < 0) return 0;
+  int n = 0;
+  return ioctl(fd_, FIONREAD, &n) == 0 ? n : 0;
+}
+
+int WiFiClient::read() {
+  uint8_t b;
+  return read(&b, 1) == 1 ? b : -1;
+}
+
+int WiFiClient::read(uint8_t* buf, size_t n) {
+  if (fd_ < 0) return -1;
+  ssize_t r = recv(fd_, buf, n, MSG_DONTWAIT);
+  return r > 0 ? (int)r : -1;
+}
+
+uint8_t WiFiClient::connected() {
+  if (fd_ < 0) return 0;
+  uint8_t b;
+  ssize_t r = recv(fd_, &b, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (r > 0) return 1;
+  if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return 1;
+  return 0;
+}
+
+void WiFiClient::stop() {
+  if (fd_ >= 0) close(fd_);
+  fd_ = -1;
+}
+
+int WiFiClient::setNoDelay(bool nodelay) {
+  int v = nodelay ? 1 : 0;
+  return fd_ >= 0 && setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &v, sizeof v) == 0;
+}
@@ -0,0 +1,30 @@
+#pragma once
+// Host stand-in for arduino-esp32's WiFiClient over a POSIX TCP socket. connected()
+// follows the original: true while unread data is buffered or the peer has not closed.
+#include <Arduino.h>
+#include "IPAddress.h"
+
+class WiFiClient {
+public:
+  WiFiClient() = default;
+  virtual ~WiFiClient() { stop(); }
+  WiFiClient(const WiFiClient&) = delete;
+  WiFiClient& operator=(const WiFiClient&) = delete;
+
+  int connect(IPAddress ip, uint16_t port) { return connect(ip, port, 3000); }
+  int connect(IPAddress ip, uint16_t port, int32_t timeoutMs);
+  int connect(const char* host, uint16_t port, int32_t timeoutMs);
+
+  virtual size_t write(const uint8_t* buf, size_t n);
+  size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  virtual int available();
+  virtual int read();
+  virtual int read(uint8_t* buf, size_t n);
+  virtual uint8_t connected();
+  virtual void stop();
+  int setNoDelay(bool nodelay);
+
+protected:
+  int fd_ = -1;
+};
@@ -0,0 +1,94 @@
+#include "WiFiClientSecure.h"
+#include "WiFi.h"
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <csignal>
+#include <poll.h>
+
+namespace {
+
+SSL_CTX* clientCtx() {
+  static SSL_CTX* ctx = [] {
+    signal(SIGPIPE, SIG_IGN); // SSL_write to a server that hung up
+    return SSL_CTX_new(TLS_client_method());
+  }();
+  return ctx;
+}
+
+// Waits until the socket is ready for what SSL asked for; false on timeout
+bool waitFor(int fd, SSL* ssl, int rc, int timeoutMs) {
+  const int err = SSL_get_error(ssl, rc);
+  if (err != SSL_ERROR_WANT_READ && err != SSL_ERROR_WANT_WRITE) return false;
+  pollfd p{fd, (short)(err == SSL_ERROR_WANT_READ ? POLLIN : POLLOUT), 0};
+  return poll(&p, 1, timeoutMs) == 1;
+}
+
+} // namespace
+
+int WiFiClientSecure::connect(const char* host, uint16_t port, int32_t timeoutMs) {
+  stop();
+  IPAddress ip;
+  if (WiFi.hostByName(host, ip) != 1 || !WiFiClient::connect(ip, port, timeoutMs)) return 0;
+  SSL_CTX* ctx = clientCtx();
+  ssl_ = ctx ? SSL_new(ctx) : nullptr;
+  if (!ssl_) { stop(); return 0; }
+  SSL_set_fd(ssl_, fd_);
+  SSL_set_tlsext_host_name(ssl_, host);
+  SSL_set_verify(ssl_, insecure_ ? SSL_VERIFY_NONE : SSL_VERIFY_PEER, nullptr);
+  for (;;) {
+    const int rc = SSL_connect(ssl_);
+    if (rc == 1) return 1;
+    if (!waitFor(fd_, ssl_, rc, timeoutMs)) { stop(); return 0; }
+  }
+}
+
+size_t WiFiClientSecure::write(const uint8_t* buf, size_t n) {
+  size_t done = 0;
+  while (ssl_ && done < n) {
+    const int w = SSL_write(ssl_, buf + done, (int)(n - done));
+    if (w > 0) { done += (size_t)w; continue; }
+    if (!waitFor(fd_, ssl_, w, 1000)) break;
+  }
+  return done;
+}
+
+void WiFiClientSecure::fill() {
+  if (rxPos_ == rx_.size()) { rx_.clear(); rxPos_ = 0; }
+  char tmp[4096];
+  while (ssl_ && !eof_ && rx_.size() - rxPos_ < 16384) {
+    const int r = SSL_read(ssl_, tmp, sizeof tmp);
+    if (r > 0) { rx_.append(tmp, (size_t)r); continue; }
+    const int err = SSL_get_error(ssl_, r);
+    if (err != SSL_ERROR_WANT_READ && err != SSL_ERROR_WANT_WRITE) { eof_ = true; ERR_clear_error(); }
+    break;
+  }
+}
+
+int WiFiClientSecure::available() {
+  fill();
+  return (int)(rx_.size() - rxPos_);
+}
+
+int WiFiClientSecure::read(uint8_t* buf, size_t n) {
+  if (rxPos_ == rx_.size()) fill();
+  const size_t have = rx_.size() - rxPos_;
+  if (!have) return -1;
+  if (n > have) n = have;
+  memcpy(buf, rx_.data() + rxPos_, n);
+  rxPos_ += n;
+  return (int)n;
+}
+
+uint8_t WiFiClientSecure::connected() {
+  if (rx_.size() > rxPos_) return 1;
+  fill();
+  return rx_.size() > rxPos_ || (ssl_ && !eof_);
+}
+
+void WiFiClientSecure::stop() {
+  if (ssl_) { SSL_free(ssl_); ssl_ = nullptr; }
+  rx_.clear();
+  rxPos_ = 0;
+  eof_ = false;
+  WiFiClient::stop();
+}
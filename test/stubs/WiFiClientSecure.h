@@ -0,0 +1,34 @@
+#pragma once
+// Host stand-in for WiFiClientSecure over OpenSSL. Like the original it resolves the
+// name itself (WiFi.hostByName, so lookups are counted) and sends it as SNI;
+// setInsecure() skips certificate checks, which is all the firmware uses. Decrypted
+// bytes are buffered so available() reports what read() can return without blocking.
+#include <string>
+#include "WiFiClient.h"
+
+struct ssl_st;
+
+class WiFiClientSecure : public WiFiClient {
+public:
+  WiFiClientSecure() = default;
+  ~WiFiClientSecure() override { stop(); }
+
+  void setInsecure() { insecure_ = true; }
+  int connect(const char* host, uint16_t port, int32_t timeoutMs);
+
+  size_t write(const uint8_t* buf, size_t n) override;
+  int available() override;
+  int read() override { return WiFiClient::read(); }
+  int read(uint8_t* buf, size_t n) override;
+  uint8_t connected() override;
+  void stop() override;
+
+private:
+  void fill();  // moves whatever TLS records arrived into rx_
+
+  ssl_st* ssl_ = nullptr;
+  bool insecure_ = false;
+  bool eof_ = false;
+  std::string rx_;
+  size_t rxPos_ = 0;
+};
@@ -0,0 +1,5 @@
+#pragma once
+// Host stand-in for arduino-esp32's WiFiUdp header: sonos.h includes it for discovery,
+// which no host test builds.
+#include <Arduino.h>
+#include "IPAddress.h"
@@ -0,0 +1,81 @@
+#include "esp_heap_caps.h"
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+constexpr size_t kPsram = 8u << 20;
+
+std::mutex g_mtx;
+HeapCapsCounters g_counters;
+size_t g_spiramLimit = SIZE_MAX;
+size_t g_spiramLive = 0;
+
+struct Block { size_t size; bool spiram; };
+
+std::unordered_map<void*, Block>& sizes() {
+  static std::unordered_map<void*, Block> m;
+  return m;
+}
+
+bool reserve(size_t size, uint32_t caps) {
+  if (!(caps & MALLOC_CAP_SPIRAM)) return true;
+  std::lock_guard<std::mutex> lock(g_mtx);
+  if (g_spiramLimit != SIZE_MAX && g_spiramLive + size > g_spiramLimit) return false;
+  g_spiramLive += size;
+  return true;
+}
+
+void* track(void* p, size_t size, uint32_t caps) {
+  const bool spiram = (caps & MALLOC_CAP_SPIRAM) != 0;
+  std::lock_guard<std::mutex> lock(g_mtx);
+  if (!p) { if (spiram) g_spiramLive -= size; return p; }
+  sizes()[p] = Block{size, spiram};
+  g_counters.allocs++;
+  g_counters.liveBytes += size;
+  return p;
+}
+
+} // namespace
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+  if (!reserve(size, caps)) return nullptr;
+  return track(malloc(size), size, caps);
+}
+
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+  if (!reserve(size, caps)) return nullptr;
+  return track(aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment), size, caps);
+}
+
+void heap_caps_free(void* p) {
+  if (!p) return;
+  {
+    std::lock_guard<std::mutex> lock(g_mtx);
+    auto it = sizes().find(p);
+    if (it != sizes().end()) {
+      g_counters.liveBytes -= it->second.size;
+      if (it->second.spiram) g_spiramLive -= it->second.size;
+      sizes().erase(it);
+    }
+    g_counters.frees++;
+  }
+  free(p);
+}
+
+// A PSRAM-sized heap that never fragments, unless a test set a limit
+size_t heap_caps_get_free_size(uint32_t caps) {
+  std::lock_guard<std::mutex> lock(g_mtx);
+  if (!(caps & MALLOC_CAP_SPIRAM) || g_spiramLimit == SIZE_MAX) return kPsram;
+  return g_spiramLimit > g_spiramLive ? g_spiramLimit - g_spiramLive : 0;
+}
+size_t heap_caps_get_largest_free_block(uint32_t caps) { return heap_caps_get_free_size(caps); }
+size_t heap_caps_get_total_size(uint32_t) { return kPsram; }
+
+const HeapCapsCounters& heap_caps_test_counters() { return g_counters; }
+
+void heap_caps_test_limit_spiram(size_t bytes) {
+  std::lock_guard<std::mutex> lock(g_mtx);
+  g_spiramLimit = bytes;
+}
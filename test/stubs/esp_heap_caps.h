@@ -0,0 +1,28 @@
+#pragma once
+// Host stand-in for ESP-IDF capability allocation: every capability is plain heap.
+// heap_caps_test_counters() lets tests assert that a code path does not allocate;
+// heap_caps_test_limit_spiram() shrinks the PSRAM a test sees.
+#include <cstddef>
+#include <cstdint>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+void heap_caps_free(void* p);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+size_t heap_caps_get_total_size(uint32_t caps);
+
+struct HeapCapsCounters {
+  uint32_t allocs = 0;
+  uint32_t frees = 0;
+  size_t liveBytes = 0;
+};
+const HeapCapsCounters& heap_caps_test_counters();
+// MALLOC_CAP_SPIRAM allocations fail once `bytes` are live; the free and largest-block
+// queries report what is left. SIZE_MAX restores the unlimited 8 MB heap.
+void heap_caps_test_limit_spiram(size_t bytes);
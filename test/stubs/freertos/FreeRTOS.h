@@ -0,0 +1,47 @@
+#pragma once
+// Host stand-in for the FreeRTOS/ESP-IDF API the tested sources use, on std::thread.
+// One tick is one millisecond; tasks run unpinned and are never deleted.
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define tskIDLE_PRIORITY 0
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+// Critical sections: a plain mutex (the pool holds them for a few instructions)
+typedef std::mutex portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define portENTER_CRITICAL(m) (m)->lock()
+#define portEXIT_CRITICAL(m) (m)->unlock()
+
+// Counting semaphore; a mutex is one with a single token
+struct HostSemaphore {
+  std::mutex m;
+  std::condition_variable cv;
+  unsigned count = 0;
+  unsigned max = 1;
+};
+
+struct HostQueue {
+  std::mutex m;
+  std::condition_variable cv;
+  std::deque<std::vector<uint8_t>> items;
+  unsigned length = 1;
+  unsigned itemSize = 0;
+};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackBytes, void* arg,
+                                   UBaseType_t prio, TaskHandle_t* handle, BaseType_t core);
+void vTaskDelay(TickType_t ticks);
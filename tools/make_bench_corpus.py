@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""Generate the album-art benchmark corpus (env: bench) into data/bench/.
+
+The corpus is versioned through this script, not through binaries: the same
+CORPUS_VERSION always produces byte-identical files, so results from different
+commits stay comparable. Requires Pillow.
+
+    python3 tools/make_bench_corpus.py
+    pio run -e bench -t uploadfs && pio run -e bench -t upload
+"""
+import io
+import os
+import random
+import sys
+
+from PIL import Image, ImageDraw, ImageFilter
+
+CORPUS_VERSION = 1
+OUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "data", "bench")
+
+
+def cover(size, seed):
+    """Photo-like cover: smooth gradients, soft shapes and some grain."""
+    rnd = random.Random(seed)
+    w, h = size
+    base = Image.linear_gradient("L").resize((w, h))
+    noise = Image.effect_noise((w, h), 40 + seed % 30)
+    img = Image.merge("RGB", (base, noise, base.transpose(Image.Transpose.ROTATE_90).resize((w, h))))
+    d = ImageDraw.Draw(img)
+    for _ in range(8):
+        x0, y0 = rnd.randrange(w), rnd.randrange(h)
+        r = rnd.randrange(max(8, w // 12), max(16, w // 3))
+        d.ellipse([x0 - r, y0 - r, x0 + r, y0 + r],
+                  fill=(rnd.randrange(256), rnd.randrange(256), rnd.randrange(256)))
+    img = img.filter(ImageFilter.GaussianBlur(max(1, w // 240)))
+    d = ImageDraw.Draw(img)
+    d.text((w // 10, h * 8 // 10), "BENCH %d" % seed, fill=(255, 255, 255))
+    return img
+
+
+def jpeg(img, **kw):
+    buf = io.BytesIO()
+    img.save(buf, "JPEG", **kw)
+    return buf.getvalue()
+
+
+def png(img):
+    buf = io.BytesIO()
+    img.save(buf, "PNG", optimize=False)
+    return buf.getvalue()
+
+
+def main():
+    os.makedirs(OUT, exist_ok=True)
+    for f in os.listdir(OUT):
+        os.remove(os.path.join(OUT, f))
+
+    cases = []  # (file name, bytes, expectation)
+
+    def add(name, data, expect="ok"):
+        cases.append((name, data, expect))
+
+    # Baseline at typical cover sizes (4:2:0 and 4:4:4)
+    for px in (300, 480, 640, 1000, 1500, 3000):
+        add("base_%d.jpg" % px, jpeg(cover((px, px), px), quality=85))
+    add("base444_640.jpg", jpeg(cover((640, 640), 7), quality=90, subsampling=0))
+    add("base_1200x800.jpg", jpeg(cover((1200, 800), 8), quality=85))
+    add("gray_640.jpg", jpeg(cover((640, 640), 9).convert("L"), quality=85))
+    # Restart intervals (dual-core band split and windowed start)
+    add("dri_1000.jpg", jpeg(cover((1000, 1000), 10), quality=85, restart_marker_rows=1))
+    add("dri_3000.jpg", jpeg(cover((3000, 3000), 11), quality=80, restart_marker_blocks=64))
+    # Progressive
+    for px in (640, 1500, 3000):
+        add("prog_%d.jpg" % px, jpeg(cover((px, px), 20 + px), quality=85, progressive=True))
+    # EXIF orientation 6 (rotate 90 CW)
+    exif = Image.Exif()
+    exif[0x0112] = 6
+    add("exif6_640.jpg", jpeg(cover((640, 480), 30), quality=85, exif=exif.tobytes()))
+    # CMYK (Adobe) - expected to fail cleanly
+    add("cmyk_640.jpg", jpeg(cover((640, 640), 40).convert("CMYK"), quality=85), "fail")
+    # PNG
+    add("png_480.png", png(cover((480, 480), 50)))
+    add("png_1000.png", png(cover((1000, 1000), 51)))
+    # Corrupt: truncated mid-scan, garbage in the entropy data, no SOI
+    good = jpeg(cover((640, 640), 60), quality=85)
+    add("trunc_640.jpg", good[: len(good) * 2 // 3], "any")
+    rnd = random.Random(61)
+    bad = bytearray(good)
+    for _ in range(64):
+        i = rnd.randrange(len(bad) // 3, len(bad) - 2)
+        bad[i] = rnd.randrange(256)
+    add("flip_640.jpg", bytes(bad), "any")
+    add("nosoi.jpg", good[2:], "fail")
+    tp = jpeg(cover((1500, 1500), 62), quality=85, progressive=True)
+    add("trunc_prog_1500.jpg", tp[: len(tp) // 2], "any")
+
+    total = 0
+    with open(os.path.join(OUT, "corpus.txt"), "w") as m:
+        m.write("# albumart bench corpus v%d: <file> <ok|fail|any>\n" % CORPUS_VERSION)
+        for name, data, expect in cases:
+            with open(os.path.join(OUT, name), "wb") as f:
+                f.write(data)
+            m.write("%s %s\n" % (name, expect))
+            total += len(data)
+    print("corpus v%d: %d files, %d KB -> %s" % (CORPUS_VERSION, len(cases), total // 1024, os.path.normpath(OUT)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Generate a 4-bpp anti-aliased glyph atlas (ui_gfx::AaFont) from a TrueType font.
+
+Writes src/gfx/fonts/<Name>.cpp with the glyph bitmaps, a per-glyph advance table
+(1/16 px) and the font's pair kerning restricted to the atlas, so text can be
+measured without rasterising anything. Kerning is stored as a class matrix: glyphs
+with identical kerning against every other glyph share a left (or right) class.
+The output is deterministic for a given font file, size and charset. Requires
+Pillow; cmap and the legacy kern table are read directly (GPOS is not used).
+
+    python3 tools/make_font_atlas.py --font Lato-Regular.ttf --px 24 --name AaSans12
+"""
+import argparse
+import os
+import struct
+import sys
+
+from PIL import ImageFont
+
+OUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "gfx", "fonts")
+
+PUNCT = [0x2013, 0x2014, 0x2018, 0x2019, 0x201A, 0x201C, 0x201D, 0x201E, 0x2020, 0x2021,
+         0x2022, 0x2026, 0x2030, 0x2039, 0x203A, 0x20AC, 0x2122]
+CHARSETS = {
+    "ascii": list(range(0x20, 0x7F)),
+    "latin1": list(range(0x20, 0x7F)) + list(range(0xA0, 0x100)) + PUNCT,
+    "latin": list(range(0x20, 0x7F)) + list(range(0xA0, 0x180)) + PUNCT,
+}
+MIN_KERN_16 = 4  # pairs below a quarter pixel are not worth a table entry
+
+
+def tables(data):
+    n = struct.unpack(">H", data[4:6])[0]
+    out = {}
+    for i in range(n):
+        tag, _, off, ln = struct.unpack(">4sIII", data[12 + 16 * i:28 + 16 * i])
+        out[tag.decode("latin-1")] = data[off:off + ln]
+    return out
+
+
+def read_cmap(t):
+    """code point -> glyph id from the Unicode BMP subtable (format 4)."""
+    n = struct.unpack(">H", t[2:4])[0]
+    for i in range(n):
+        pid, eid, off = struct.unpack(">HHI", t[4 + 8 * i:12 + 8 * i])
+        if (pid, eid) in ((3, 1), (0, 3), (0, 4)) and struct.unpack(">H", t[off:off + 2])[0] == 4:
+            break
+    else:
+        sys.exit("no Unicode format-4 cmap")
+    seg2 = struct.unpack(">H", t[off + 6:off + 8])[0]
+    ends = struct.unpack(">%dH" % (seg2 // 2), t[off + 14:off + 14 + seg2])
+    p = off + 16 + seg2
+    starts = struct.unpack(">%dH" % (seg2 // 2), t[p:p + seg2])
+    deltas = struct.unpack(">%dh" % (seg2 // 2), t[p + seg2:p + 2 * seg2])
+    ro_pos = p + 2 * seg2
+    ranges = struct.unpack(">%dH" % (seg2 // 2), t[ro_pos:ro_pos + seg2])
+    cmap = {}
+    for s, (st, en, de, ro) in enumerate(zip(starts, ends, deltas, ranges)):
+        for c in range(st, en + 1):
+            if c == 0xFFFF:
+                continue
+            if ro == 0:
+                g = (c + de) & 0xFFFF
+            else:
+                q = ro_pos + 2 * s + ro + 2 * (c - st)
+                g = struct.unpack(">H", t[q:q + 2])[0]
+                g = (g + de) & 0xFFFF if g else 0
+            if g:
+                cmap[c] = g
+    return cmap
+
+
+def read_kern(t):
+    """(left gid, right gid) -> font units from a version-0 'kern' table, format 0."""
+    pairs = {}
+    if not t:
+        return pairs
+    n = struct.unpack(">H", t[2:4])[0]
+    off = 4
+    for _ in range(n):
+        ln, cov = struct.unpack(">HH", t[off + 2:off + 6])
+        if cov >> 8 == 0 and cov & 1:  # horizontal, format 0
+            npairs = struct.unpack(">H", t[off + 6:off + 8])[0]
+            for i in range(npairs):
+                l, r, v = struct.unpack(">HHh", t[off + 14 + 6 * i:off + 20 + 6 * i])
+                pairs[(l, r)] = v
+        off += ln
+    return pairs
+
+
+def c_ident(name):
+    return "k" + name
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--font", required=True, help="TrueType file")
+    ap.add_argument("--px", type=int, required=True, help="em size in pixels")
+    ap.add_argument("--name", required=True, help="C++ name, e.g. AaSans12")
+    ap.add_argument("--charset", default="latin", choices=sorted(CHARSETS))
+    ap.add_argument("--source", default=None, help="font name/licence line for the header comment")
+    args = ap.parse_args()
+
+    data = open(args.font, "rb").read()
+    t = tables(data)
+    units_per_em = struct.unpack(">H", t["head"][18:20])[0]
+    cmap = read_cmap(t["cmap"])
+    kern = read_kern(t.get("kern"))
+    font = ImageFont.truetype(args.font, args.px, layout_engine=ImageFont.Layout.BASIC)
+    ascent, descent = font.getmetrics()
+
+    codes = sorted(c for c in set(CHARSETS[args.charset]) if c in cmap or c == 0x20)
+    glyphs, bitmap = [], bytearray()
+    for c in codes:
+        ch = chr(c)
+        adv16 = int(round(font.getlength(ch) * 16))
+        mask, (ox, oy) = font.getmask2(ch, mode="L")
+        w, h = mask.size
+        bbox = mask.getbbox() if w and h else None
+        if not bbox:
+            glyphs.append([c, len(bitmap), 0, 0, 0, 0, adv16])
+            continue
+        x0, y0, x1, y1 = bbox
+        w, h = x1 - x0, y1 - y0
+        off = len(bitmap)
+        for y in range(y0, y1):
+            row = [(mask.getpixel((x, y)) * 15 + 127) // 255 for x in range(x0, x1)]
+            if len(row) & 1:
+                row.append(0)
+            bitmap += bytes((row[i] << 4) | row[i + 1] for i in range(0, len(row), 2))
+        glyphs.append([c, off, w, h, ox + x0, oy + y0 - ascent, adv16])
+
+    gid = {c: cmap[c] for c in codes if c in cmap}
+    by_gid = {}
+    for c, g in gid.items():
+        by_gid.setdefault(g, []).append(c)
+    pair = {}
+    for (l, r), v in kern.items():
+        v16 = int(round(v * args.px * 16.0 / units_per_em))
+        if abs(v16) < MIN_KERN_16 or l not in by_gid or r not in by_gid:
+            continue
+        for cl in by_gid[l]:
+            for cr in by_gid[r]:
+                pair[(cl, cr)] = max(-128, min(127, v16))
+    # Class 0 is "no kerning"; identical rows/columns share a class
+    def classes(key):
+        ids, out = {(): 0}, {}
+        for c in codes:
+            vec = tuple(sorted((o, v) for o, v in key(c)))
+            out[c] = ids.setdefault(vec, len(ids))
+        return out, ids
+    left, lids = classes(lambda c: [(r, v) for (l, r), v in pair.items() if l == c])
+    right, rids = classes(lambda c: [(l, v) for (l, r), v in pair.items() if r == c])
+    nl, nr = len(lids), len(rids)
+    matrix = [0] * (nl * nr)
+    for (l, r), v in pair.items():
+        matrix[left[l] * nr + right[r]] = v
+
+    name = c_ident(args.name)
+    out = os.path.join(OUT, args.name + ".cpp")
+    with open(out, "w") as f:
+        f.write("// Generated by tools/make_font_atlas.py - do not edit\n")
+        f.write("// %s, %d px em, charset %s: %d glyphs, %d kerning pairs in %dx%d classes, %d bitmap bytes\n"
+                % (args.source or os.path.basename(args.font), args.px, args.charset, len(glyphs), len(pair), nl, nr, len(bitmap)))
+        f.write('#include "gfx/fonts/AaFonts.h"\n\nnamespace ui_gfx {\n\nnamespace {\n\n')
+        f.write("const uint8_t kBitmap[] = {\n")
+        for i in range(0, len(bitmap), 24):
+            f.write("  " + ",".join("0x%02x" % b for b in bitmap[i:i + 24]) + ",\n")
+        f.write("};\n\n")
+        f.write("// code, offset, w, h, dx, dy, advance (1/16 px), left/right kerning class\nconst AaGlyph kGlyphs[] = {\n")
+        for c, off, w, h, dx, dy, adv in glyphs:
+            f.write("  {0x%04x, %d, %d, %d, %d, %d, %d, %d, %d},\n" % (c, off, w, h, dx, dy, adv, left[c], right[c]))
+        f.write("};\n\n")
+        f.write("// [left class][right class], 1/16 px\nconst int8_t kKerning[%d * %d] = {\n" % (nl, nr))
+        for i in range(nl):
+            f.write("  " + ",".join("%d" % v for v in matrix[i * nr:(i + 1) * nr]) + ",\n")
+        f.write("};\n\n} // namespace\n\n")
+        f.write("extern const AaFont %s = {kBitmap, kGlyphs, %d, kKerning, %d, %d, %d, %d};\n\n"
+                % (name, len(glyphs), nr, ascent + descent, ascent, descent))
+        f.write("} // namespace ui_gfx\n")
+    print("%s: %d glyphs, %d kerning pairs, %dx%d classes, %d bitmap bytes" % (out, len(glyphs), len(pair), nl, nr, len(bitmap)))
+
+
+if __name__ == "__main__":
+    main()
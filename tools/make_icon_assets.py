@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""Convert PNG icons into ui_gfx::Icon assets (RGB565 plus 4-bit alpha in flash).
+
+Writes src/gfx/icons/<Name>.cpp for every tools/icons/<name>.png: the ink box
+(bounding box of non-transparent pixels) as 4-bit alpha, two pixels per byte with
+the high nibble first and rows padded to whole bytes, and its colours as RGB565.
+An icon whose visible pixels all share one RGB565 colour stores that colour only.
+Nothing is decoded at run time. The output is deterministic for a given PNG.
+Requires Pillow.
+
+    python3 tools/make_icon_assets.py                  # every PNG in tools/icons/
+    python3 tools/make_icon_assets.py tools/icons/speaker.png
+"""
+import argparse
+import glob
+import os
+
+from PIL import Image
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.join(HERE, "icons")
+OUT = os.path.join(HERE, "..", "src", "gfx", "icons")
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def c_name(path):
+    base = os.path.splitext(os.path.basename(path))[0]
+    return "".join(p[:1].upper() + p[1:] for p in base.replace("-", "_").split("_") if p)
+
+
+def convert(path):
+    im = Image.open(path).convert("RGBA")
+    w, h = im.size
+    if w > 255 or h > 255:
+        raise SystemExit("%s: %dx%d, icons are at most 255x255" % (path, w, h))
+    px = im.load()
+    alpha = lambda x, y: (px[x, y][3] * 15 + 127) // 255
+    ink = [(x, y) for y in range(h) for x in range(w) if alpha(x, y)]
+    if not ink:
+        raise SystemExit("%s: fully transparent" % path)
+    x0, x1 = min(x for x, _ in ink), max(x for x, _ in ink) + 1
+    y0, y1 = min(y for _, y in ink), max(y for _, y in ink) + 1
+
+    mask, colours = bytearray(), []
+    for y in range(y0, y1):
+        row = [alpha(x, y) for x in range(x0, x1)]
+        if len(row) & 1:
+            row.append(0)
+        mask += bytes((row[i] << 4) | row[i + 1] for i in range(0, len(row), 2))
+        # Transparent pixels are never drawn; 0 keeps the table stable when they change
+        colours += [rgb565(*px[x, y][:3]) if alpha(x, y) else 0 for x in range(x0, x1)]
+    solid = {rgb565(*px[x, y][:3]) for x, y in ink}
+    colour = solid.pop() if len(solid) == 1 else None
+    return w, h, (x0, y0, x1 - x0, y1 - y0), mask, colours, colour
+
+
+def write(path, name):
+    w, h, (bx, by, bw, bh), mask, colours, colour = convert(path)
+    out = os.path.join(OUT, name + ".cpp")
+    with open(out, "w") as f:
+        f.write("// Generated by tools/make_icon_assets.py - do not edit\n")
+        f.write("// %s: %dx%d, ink box %dx%d at (%d, %d), %s, %d bytes\n"
+                % (os.path.basename(path), w, h, bw, bh, bx, by,
+                   "one colour 0x%04x" % colour if colour is not None else "RGB565",
+                   len(mask) + (0 if colour is not None else 2 * len(colours))))
+        f.write('#include "gfx/icons/Icons.h"\n\nnamespace ui_gfx {\n\nnamespace {\n\n')
+        f.write("const uint8_t kAlpha[] = {\n")
+        for i in range(0, len(mask), 24):
+            f.write("  " + ",".join("0x%02x" % b for b in mask[i:i + 24]) + ",\n")
+        f.write("};\n\n")
+        if colour is None:
+            f.write("const uint16_t kRgb[] = {\n")
+            for i in range(0, len(colours), 12):
+                f.write("  " + ",".join("0x%04x" % c for c in colours[i:i + 12]) + ",\n")
+            f.write("};\n\n")
+        f.write("} // namespace\n\n")
+        f.write("extern const Icon kIcon%s = {%s, kAlpha, 0x%04x, %d, %d, %d, %d, %d, %d};\n\n"
+                % (name, "nullptr" if colour is not None else "kRgb", colour or 0, w, h, bx, by, bw, bh))
+        f.write("} // namespace ui_gfx\n")
+    print("%s -> %s (%dx%d, ink %dx%d)" % (os.path.relpath(path), os.path.relpath(out), w, h, bw, bh))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("png", nargs="*", help="icons to convert (default: tools/icons/*.png)")
+    args = ap.parse_args()
+    os.makedirs(OUT, exist_ok=True)
+    for path in args.png or sorted(glob.glob(os.path.join(SRC, "*.png"))):
+        write(path, c_name(path))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""Write the PNG fixtures for the host decoder test (test/PngBackendTest.cpp).
+
+    alpha_36x28.png       RGBA, every row filter type, alpha 0, 255 and in between
+    cover_720x600.png     RGB, larger than the screen: box-filtered and center-cropped
+    interlaced_16x16.png  RGB, Adam7: must be rejected
+
+Partial-alpha pixels use channel values for which PNGdec's blend (>> 8) and an exact
+one (/ 255, rounded or not) give the same RGB565 value, so the expected frame does
+not depend on which one a decoder uses. The expected CRC-32 of the 480x480 frame
+for alpha_36x28.png (centered unscaled on black) is computed here independently
+of the decoder and printed for the test. Pure Python, output is deterministic.
+
+    python3 tools/make_png_fixtures.py
+"""
+import os
+import struct
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+OUT = os.path.join(HERE, "..", "test", "data", "png")
+SCREEN = 480
+
+
+def chunk(kind, body):
+    return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body))
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    return a if pa <= pb and pa <= pc else b if pb <= pc else c
+
+
+def filter_row(f, row, prev, bpp):
+    out = bytearray([f])
+    for i, x in enumerate(row):
+        a = row[i - bpp] if i >= bpp else 0
+        b = prev[i]
+        c = prev[i - bpp] if i >= bpp else 0
+        pred = [0, a, b, (a + b) >> 1, paeth(a, b, c)][f]
+        out.append((x - pred) & 0xFF)
+    return out
+
+
+def scanlines(rows, bpp):
+    data = bytearray()
+    prev = bytes(len(rows[0])) if rows else b""
+    for y, row in enumerate(rows):
+        data += filter_row(y % 5, row, prev, bpp)
+        prev = row
+    return data
+
+
+def png(w, h, color_type, data, interlace=0):
+    ihdr = struct.pack(">IIBBBBB", w, h, 8, color_type, 0, 0, interlace)
+    z = zlib.compress(bytes(data), 9)
+    idat = b"".join(chunk(b"IDAT", z[i:i + 8192]) for i in range(0, len(z), 8192))
+    return b"\x89PNG\r\n\x1a\n" + chunk(b"IHDR", ihdr) + idat + chunk(b"IEND", b"")
+
+
+def q565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def blend_agrees(c, a):
+    shift = (c * a) >> 8
+    exact = (c * a) // 255
+    rounded = (c * a + 127) // 255
+    return all(v >> 3 == shift >> 3 for v in (exact, rounded)) and \
+        all(v >> 2 == shift >> 2 for v in (exact, rounded))
+
+
+def stable(c, a):
+    """Nearest channel value to c whose blend does not depend on the rounding."""
+    for d in range(256):
+        for v in (c - d, c + d):
+            if 0 <= v <= 255 and blend_agrees(v, a):
+                return v
+    raise ValueError((c, a))
+
+
+def alpha_image():
+    w, h = 36, 28
+    px = []
+    for y in range(h):
+        row = []
+        for x in range(w):
+            r, g, b = (x * 7) & 0xFF, (y * 9) & 0xFF, ((x + y) * 5) & 0xFF
+            if x < 4:
+                a = 0
+            elif x >= w - 4:
+                a = 255
+            else:
+                a = 24 + ((x * 13 + y * 17) % 208)
+                r, g, b = stable(r, a), stable(g, a), stable(b, a)
+            row.append((r, g, b, a))
+        px.append(row)
+    return w, h, px
+
+
+def expected_frame_crc(w, h, px):
+    frame = [0] * (SCREEN * SCREEN)
+    x0, y0 = (SCREEN - w) // 2, (SCREEN - h) // 2
+    for y in range(h):
+        for x in range(w):
+            r, g, b, a = px[y][x]
+            r, g, b = (r * a) // 255, (g * a) // 255, (b * a) // 255
+            frame[(y0 + y) * SCREEN + x0 + x] = q565(r, g, b)
+    return zlib.crc32(struct.pack("<%dH" % len(frame), *frame))
+
+
+def cover_image():
+    w, h = 720, 600
+    rows = []
+    for y in range(h):
+        row = bytearray()
+        for x in range(w):
+            band = (x // 48 + y // 40) & 1
+            row += bytes(((x // 24) * 8, (y // 24) * 10, 200 if band else 40))
+        rows.append(row)
+    return w, h, rows
+
+
+ADAM7 = [(0, 0, 8, 8), (4, 0, 8, 8), (0, 4, 4, 8), (2, 0, 4, 4), (0, 2, 2, 4), (1, 0, 2, 2), (0, 1, 1, 2)]
+
+
+def interlaced_image():
+    w = h = 16
+    pix = [[bytes(((x * 16) & 0xFF, (y * 16) & 0xFF, 128)) for x in range(w)] for y in range(h)]
+    data = bytearray()
+    for x0, y0, dx, dy in ADAM7:
+        rows = [b"".join(pix[y][x] for x in range(x0, w, dx)) for y in range(y0, h, dy)]
+        if rows and rows[0]:
+            data += scanlines(rows, 3)
+    return w, h, data
+
+
+def main():
+    os.makedirs(OUT, exist_ok=True)
+
+    w, h, px = alpha_image()
+    rows = [bytes(v for p in row for v in p) for row in px]
+    with open(os.path.join(OUT, "alpha_36x28.png"), "wb") as f:
+        f.write(png(w, h, 6, scanlines(rows, 4)))
+    print("alpha_36x28.png: frame crc 0x%08X" % expected_frame_crc(w, h, px))
+
+    w, h, rows = cover_image()
+    with open(os.path.join(OUT, "cover_720x600.png"), "wb") as f:
+        f.write(png(w, h, 2, scanlines(rows, 3)))
+    print("cover_720x600.png")
+
+    w, h, data = interlaced_image()
+    with open(os.path.join(OUT, "interlaced_16x16.png"), "wb") as f:
+        f.write(png(w, h, 2, data, interlace=1))
+    print("interlaced_16x16.png")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Summarise a UI benchmark log (env: uibench) and extract its frame dumps.
+
+Reads the serial log from a file or stdin, prints one row per event (render time,
+pixels and primitives that reached the frame) and, when the firmware was built
+with -DUI_BENCH_FRAMES, writes every dumped frame as <out>/<screen>_<event>.png.
+Standard library only.
+
+    pio device monitor -b 115200 | tee ui.log
+    python3 tools/ui_frames.py ui.log -o frames/
+"""
+import argparse
+import json
+import os
+import struct
+import sys
+import zlib
+
+
+def rgb565_to_rgb(c):
+    r, g, b = (c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F
+    return bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+
+
+def decode_row(line, w):
+    """'R' + runs of 8 hex digits: 16-bit run length, RGB565 colour."""
+    out = bytearray()
+    body = line[1:]
+    for i in range(0, len(body) - 7, 8):
+        n, c = int(body[i:i + 4], 16), int(body[i + 4:i + 8], 16)
+        out += rgb565_to_rgb(c) * n
+    if len(out) != 3 * w:
+        raise ValueError("row has %d pixels, expected %d" % (len(out) // 3, w))
+    return bytes(out)
+
+
+def write_png(path, w, h, rows):
+    def chunk(tag, data):
+        return struct.pack(">I", len(data)) + tag + data + struct.pack(">I", zlib.crc32(tag + data) & 0xFFFFFFFF)
+    raw = b"".join(b"\x00" + r for r in rows)
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(raw, 6)))
+        f.write(chunk(b"IEND", b""))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("log", nargs="?", help="serial log (default: stdin)")
+    ap.add_argument("-o", "--out", default="ui_frames", help="directory for frame PNGs")
+    args = ap.parse_args()
+    src = open(args.log, errors="replace") if args.log else sys.stdin
+
+    frame, rows, written = None, [], 0
+    print("%-12s %-12s %9s %8s %6s %7s" % ("screen", "event", "us", "px", "calls", "screen%"))
+    for line in src:
+        line = line.strip()
+        if frame is not None and line.startswith("R"):
+            rows.append(decode_row(line, frame["w"]))
+            continue
+        if not line.startswith('{"bench"'):
+            continue
+        try:
+            rec = json.loads(line)
+        except ValueError:
+            continue
+        kind = rec.get("bench")
+        if kind == "ui":
+            print("%-12s %-12s %9d %8d %6d %7.1f" % (rec["screen"], rec["event"], rec["us"], rec["px"],
+                                                    rec["calls"], rec["screen_pct"]))
+        elif kind == "frame":
+            frame, rows = rec, []
+        elif kind == "frame_end" and frame is not None:
+            if len(rows) == frame["h"]:
+                os.makedirs(args.out, exist_ok=True)
+                write_png(os.path.join(args.out, "%s_%s.png" % (frame["screen"], frame["event"])),
+                          frame["w"], frame["h"], rows)
+                written += 1
+            else:
+                print("incomplete frame %s/%s (%d rows)" % (frame["screen"], frame["event"], len(rows)), file=sys.stderr)
+            frame = None
+        elif kind == "ui_done":
+            print("total: %d events, %d px, %d us" % (rec["events"], rec["px"], rec["us"]))
+    if written:
+        print("%d frames -> %s/" % (written, args.out))
+
+
+if __name__ == "__main__":
+    main()